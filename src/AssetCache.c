@@ -0,0 +1,203 @@
+#include "AssetCache.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+//Asset cache state
+typedef struct AssetCacheEntry
+{
+	struct AssetCacheEntry *prev, *next; //Most recently used first
+	const void *source; //Compressed asset this was decompressed from
+	size_t size;
+	unsigned locks;     //Locked entries are in use, and aren't evicted
+	bool complete;      //Entries being filled in aren't found until they're unlocked
+	uint8_t *data;      //Follows the entry, unless it was adopted
+} AssetCacheEntry;
+
+static AssetCacheEntry *cache_head, *cache_tail;
+static size_t cache_limit = ASSET_CACHE_LIMIT_DEFAULT;
+static size_t cache_used;
+
+static unsigned long cache_hits, cache_misses, cache_evictions;
+
+//Internal asset cache functions
+static void UnlinkAsset(AssetCacheEntry *entry)
+{
+	if (entry->prev != NULL)
+		entry->prev->next = entry->next;
+	else
+		cache_head = entry->next;
+	if (entry->next != NULL)
+		entry->next->prev = entry->prev;
+	else
+		cache_tail = entry->prev;
+}
+
+static void LinkAsset(AssetCacheEntry *entry)
+{
+	entry->prev = NULL;
+	entry->next = cache_head;
+	if (cache_head != NULL)
+		cache_head->prev = entry;
+	else
+		cache_tail = entry;
+	cache_head = entry;
+}
+
+static void FreeAsset(AssetCacheEntry *entry)
+{
+	UnlinkAsset(entry);
+	cache_used -= entry->size;
+	if (entry->data != (uint8_t*)(entry + 1))
+		free(entry->data);
+	free(entry);
+}
+
+static AssetCacheEntry *GetAssetEntry(const uint8_t *data)
+{
+	for (AssetCacheEntry *entry = cache_head; entry != NULL; entry = entry->next)
+		if (entry->data == data)
+			return entry;
+	return NULL;
+}
+
+static void EvictAssets(size_t limit)
+{
+	//Free least recently used entries until we're under the limit
+	AssetCacheEntry *entry = cache_tail;
+	while (cache_used > limit && entry != NULL)
+	{
+		AssetCacheEntry *prev = entry->prev;
+		if (entry->locks == 0)
+		{
+			FreeAsset(entry);
+			cache_evictions++;
+		}
+		entry = prev;
+	}
+}
+
+static AssetCacheEntry *NewAsset(const void *source, size_t size, uint8_t *data)
+{
+	//Make room for the new entry
+	if (size == 0 || size > cache_limit)
+		return NULL;
+	EvictAssets(cache_limit - size);
+	if (cache_used + size > cache_limit)
+		return NULL;
+	
+	//Allocate entry, locked until it's filled in, with room for the data unless it's been given
+	AssetCacheEntry *entry = malloc(sizeof(AssetCacheEntry) + ((data == NULL) ? size : 0));
+	if (entry == NULL)
+		return NULL;
+	
+	entry->source = source;
+	entry->data = (data != NULL) ? data : (uint8_t*)(entry + 1);
+	entry->size = size;
+	entry->locks = 1;
+	entry->complete = false;
+	
+	LinkAsset(entry);
+	cache_used += size;
+	return entry;
+}
+
+static void CompleteAsset(AssetCacheEntry *entry)
+{
+	//Replace older copies of the same asset
+	for (AssetCacheEntry *old = cache_head, *next; old != NULL; old = next)
+	{
+		next = old->next;
+		if (old != entry && old->source == entry->source && old->locks == 0)
+			FreeAsset(old);
+	}
+	entry->complete = true;
+}
+
+//Asset cache interface
+void SetAssetCacheLimit(size_t limit)
+{
+	cache_limit = limit;
+	EvictAssets(cache_limit);
+}
+
+void QuitAssetCache()
+{
+	//Report how useful the cache was
+	if (cache_hits != 0 || cache_misses != 0)
+		printf("Asset cache: %lu hits, %lu misses, %lu evictions, %lu of %lu bytes used\n", cache_hits, cache_misses, cache_evictions, (unsigned long)cache_used, (unsigned long)cache_limit);
+	
+	//Free every entry
+	while (cache_head != NULL)
+		FreeAsset(cache_head);
+}
+
+bool HasAsset(const void *source)
+{
+	//Check for an entry, even one being filled in, without counting a hit or miss
+	for (AssetCacheEntry *entry = cache_head; entry != NULL; entry = entry->next)
+		if (entry->source == source)
+			return true;
+	return false;
+}
+
+const uint8_t *LockAsset(const void *source, size_t *size)
+{
+	//Find complete entry for this source
+	for (AssetCacheEntry *entry = cache_head; entry != NULL; entry = entry->next)
+	{
+		if (entry->source == source && entry->complete)
+		{
+			//Move to the front of the list
+			UnlinkAsset(entry);
+			LinkAsset(entry);
+			
+			entry->locks++;
+			cache_hits++;
+			
+			*size = entry->size;
+			return entry->data;
+		}
+	}
+	
+	cache_misses++;
+	return NULL;
+}
+
+uint8_t *AddAsset(const void *source, size_t size)
+{
+	AssetCacheEntry *entry = NewAsset(source, size, NULL);
+	return (entry != NULL) ? entry->data : NULL;
+}
+
+bool AdoptAsset(const void *source, uint8_t *data, size_t size)
+{
+	//Take ownership of already decompressed data, it's complete as soon as it's added
+	AssetCacheEntry *entry = NewAsset(source, size, data);
+	if (entry == NULL)
+		return false;
+	CompleteAsset(entry);
+	entry->locks--;
+	return true;
+}
+
+void UnlockAsset(const uint8_t *data)
+{
+	AssetCacheEntry *entry = GetAssetEntry(data);
+	if (entry == NULL)
+		return;
+	
+	//Entries can be found once they've been filled in and unlocked
+	if (entry->complete == false)
+		CompleteAsset(entry);
+	entry->locks--;
+}
+
+void DiscardAsset(const uint8_t *data)
+{
+	//Free an entry that couldn't be filled in
+	AssetCacheEntry *entry = GetAssetEntry(data);
+	if (entry != NULL)
+		FreeAsset(entry);
+}
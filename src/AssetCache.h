@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+//Asset cache constants
+#define ASSET_CACHE_LIMIT_DEFAULT 0x100000 //How many bytes of decompressed assets are kept by default
+
+//Asset cache interface
+void SetAssetCacheLimit(size_t limit);
+void QuitAssetCache();
+
+bool HasAsset(const void *source);
+const uint8_t *LockAsset(const void *source, size_t *size);
+uint8_t *AddAsset(const void *source, size_t size);
+bool AdoptAsset(const void *source, uint8_t *data, size_t size);
+void UnlockAsset(const uint8_t *data);
+void DiscardAsset(const uint8_t *data);
@@ -0,0 +1,22 @@
+#include "Null.h"
+
+#include <Backend/Joypad.h>
+
+//Backend input interface
+int Input_HandleEvents()
+{
+	//Quit once the frame limit has been reached
+	return null_frame_limit != 0 && null_frames >= null_frame_limit;
+}
+
+uint8_t Input_GetState1()
+{
+	//No input
+	return 0;
+}
+
+uint8_t Input_GetState2()
+{
+	//No input
+	return 0;
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <stdio.h>
+
+//Null backend state
+extern unsigned long null_frames;      //Frames presented so far
+extern unsigned long null_frame_limit; //Frames to run before quitting (0 = run forever)
+extern FILE *null_dump;                //Framebuffer sink (NULL = discard frames)
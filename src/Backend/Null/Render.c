@@ -0,0 +1,50 @@
+#include "Null.h"
+
+#include "../VDP.h"
+
+#include <stdio.h>
+
+//Backend render interface
+int Render_Init(const MD_Header *header)
+{
+	(void)header;
+	return 0;
+}
+
+void Render_Quit()
+{
+	
+}
+
+//This takes in the internal VDP screen buffer positioned after the padding
+void Render_Screen(const uint32_t *screen)
+{
+	//Write screen to framebuffer sink
+	if (null_dump != NULL)
+	{
+		for (size_t i = 0; i < SCREEN_HEIGHT; i++)
+		{
+			fwrite(screen, sizeof(*screen), SCREEN_WIDTH, null_dump);
+			screen += SCREEN_WIDTH + (VDP_INTERNAL_PAD * 2);
+		}
+	}
+	
+	null_frames++;
+}
+
+void Render_SkipFrame()
+{
+	//There's no frame limiter to keep on schedule
+}
+
+void Render_SetFastForward(bool enable)
+{
+	//There's no frame limiter to turn off
+	(void)enable;
+}
+
+uint64_t Render_GetFramePeriod()
+{
+	//There's no frame limiter, so go by the MegaDrive's own rate
+	return 1000000000 / 60;
+}
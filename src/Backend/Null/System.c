@@ -0,0 +1,82 @@
+#ifndef _WIN32
+	#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "Null.h"
+
+#include "../MegaDrive.h"
+#include "../System.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+	#include <windows.h>
+#else
+	#include <time.h>
+#endif
+
+//Null backend state
+unsigned long null_frames;
+unsigned long null_frame_limit;
+FILE *null_dump;
+
+static double time_start;
+
+//Get monotonic time
+uint64_t System_GetNanoseconds(void)
+{
+	#ifdef _WIN32
+		LARGE_INTEGER freq, count;
+		QueryPerformanceFrequency(&freq);
+		QueryPerformanceCounter(&count);
+		return ((uint64_t)count.QuadPart / freq.QuadPart) * 1000000000 + (((uint64_t)count.QuadPart % freq.QuadPart) * 1000000000) / freq.QuadPart;
+	#else
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+	#endif
+}
+
+static double GetSeconds()
+{
+	return System_GetNanoseconds() / 1000000000.0;
+}
+
+//System interface
+int System_Init(const MD_Header *header)
+{
+	(void)header;
+	
+	//Get frame limit
+	const char *frames = getenv("SCP_NULL_FRAMES");
+	null_frame_limit = (frames != NULL) ? strtoul(frames, NULL, 0) : 0;
+	null_frames = 0;
+	
+	//Open framebuffer sink
+	const char *dump = getenv("SCP_NULL_DUMP");
+	if (dump != NULL && (null_dump = fopen(dump, "wb")) == NULL)
+	{
+		printf("System_Init: Failed to open %s\n", dump);
+		return -1;
+	}
+	
+	time_start = GetSeconds();
+	return 0;
+}
+
+void System_Quit()
+{
+	//Close framebuffer sink
+	if (null_dump != NULL)
+	{
+		fclose(null_dump);
+		null_dump = NULL;
+	}
+	
+	//Report throughput
+	double elapsed = GetSeconds() - time_start;
+	if (null_frames != 0 && elapsed > 0.0)
+		printf("%lu frames in %.3f seconds (%.1f fps, %.3f ms/frame)\n", null_frames, elapsed, null_frames / elapsed, elapsed * 1000.0 / null_frames);
+	null_frames = 0;
+}
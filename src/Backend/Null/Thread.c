@@ -0,0 +1,208 @@
+#ifdef _WIN32
+	#if !defined(_WIN32_WINNT) || _WIN32_WINNT < 0x0600
+		#undef _WIN32_WINNT
+		#define _WIN32_WINNT 0x0600 //Slim reader/writer locks and condition variables need Vista
+	#endif
+#else
+	#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "../Thread.h"
+
+#ifdef _WIN32
+	#include <windows.h>
+#else
+	#include <pthread.h>
+	#include <unistd.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+
+//Thread structures
+struct Thread
+{
+	#ifdef _WIN32
+		HANDLE thread;
+	#else
+		pthread_t thread;
+	#endif
+	ThreadFunc func;
+	void *arg;
+};
+
+struct Mutex
+{
+	#ifdef _WIN32
+		SRWLOCK mutex;
+	#else
+		pthread_mutex_t mutex;
+	#endif
+};
+
+struct Cond
+{
+	#ifdef _WIN32
+		CONDITION_VARIABLE cond;
+	#else
+		pthread_cond_t cond;
+	#endif
+};
+
+#ifdef _WIN32
+static DWORD WINAPI Thread_Entry(LPVOID data)
+{
+	Thread *thread = (Thread*)data;
+	thread->func(thread->arg);
+	return 0;
+}
+#else
+static void *Thread_Entry(void *data)
+{
+	Thread *thread = (Thread*)data;
+	thread->func(thread->arg);
+	return NULL;
+}
+#endif
+
+//Thread backend interface
+Thread *Thread_Create(ThreadFunc func, void *arg)
+{
+	Thread *thread = malloc(sizeof(Thread));
+	if (thread == NULL)
+		return NULL;
+	
+	thread->func = func;
+	thread->arg = arg;
+	#ifdef _WIN32
+		if ((thread->thread = CreateThread(NULL, 0, Thread_Entry, thread, 0, NULL)) == NULL)
+	#else
+		if (pthread_create(&thread->thread, NULL, Thread_Entry, thread) != 0)
+	#endif
+	{
+		puts("Thread_Create: Failed to create thread");
+		free(thread);
+		return NULL;
+	}
+	return thread;
+}
+
+void Thread_Join(Thread *thread)
+{
+	#ifdef _WIN32
+		WaitForSingleObject(thread->thread, INFINITE);
+		CloseHandle(thread->thread);
+	#else
+		pthread_join(thread->thread, NULL);
+	#endif
+	free(thread);
+}
+
+size_t Thread_GetCPUCount()
+{
+	#if defined(_WIN32)
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		return (info.dwNumberOfProcessors > 0) ? (size_t)info.dwNumberOfProcessors : 1;
+	#elif defined(_SC_NPROCESSORS_ONLN)
+		long count = sysconf(_SC_NPROCESSORS_ONLN);
+		return (count > 0) ? (size_t)count : 1;
+	#else
+		return 1;
+	#endif
+}
+
+Mutex *Mutex_Create()
+{
+	Mutex *mutex = malloc(sizeof(Mutex));
+	#ifdef _WIN32
+		if (mutex != NULL)
+			InitializeSRWLock(&mutex->mutex);
+	#else
+		if (mutex != NULL && pthread_mutex_init(&mutex->mutex, NULL) != 0)
+		{
+			free(mutex);
+			return NULL;
+		}
+	#endif
+	return mutex;
+}
+
+void Mutex_Destroy(Mutex *mutex)
+{
+	//Slim reader/writer locks don't need to be destroyed
+	#ifndef _WIN32
+		pthread_mutex_destroy(&mutex->mutex);
+	#endif
+	free(mutex);
+}
+
+void Mutex_Lock(Mutex *mutex)
+{
+	#ifdef _WIN32
+		AcquireSRWLockExclusive(&mutex->mutex);
+	#else
+		pthread_mutex_lock(&mutex->mutex);
+	#endif
+}
+
+void Mutex_Unlock(Mutex *mutex)
+{
+	#ifdef _WIN32
+		ReleaseSRWLockExclusive(&mutex->mutex);
+	#else
+		pthread_mutex_unlock(&mutex->mutex);
+	#endif
+}
+
+Cond *Cond_Create()
+{
+	Cond *cond = malloc(sizeof(Cond));
+	#ifdef _WIN32
+		if (cond != NULL)
+			InitializeConditionVariable(&cond->cond);
+	#else
+		if (cond != NULL && pthread_cond_init(&cond->cond, NULL) != 0)
+		{
+			free(cond);
+			return NULL;
+		}
+	#endif
+	return cond;
+}
+
+void Cond_Destroy(Cond *cond)
+{
+	//Condition variables don't need to be destroyed on Windows
+	#ifndef _WIN32
+		pthread_cond_destroy(&cond->cond);
+	#endif
+	free(cond);
+}
+
+void Cond_Wait(Cond *cond, Mutex *mutex)
+{
+	#ifdef _WIN32
+		SleepConditionVariableSRW(&cond->cond, &mutex->mutex, INFINITE, 0);
+	#else
+		pthread_cond_wait(&cond->cond, &mutex->mutex);
+	#endif
+}
+
+void Cond_Signal(Cond *cond)
+{
+	#ifdef _WIN32
+		WakeConditionVariable(&cond->cond);
+	#else
+		pthread_cond_signal(&cond->cond);
+	#endif
+}
+
+void Cond_Broadcast(Cond *cond)
+{
+	#ifdef _WIN32
+		WakeAllConditionVariable(&cond->cond);
+	#else
+		pthread_cond_broadcast(&cond->cond);
+	#endif
+}
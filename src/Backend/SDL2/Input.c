@@ -1,6 +1,7 @@
 #include "SDL.h"
 
 #include <Backend/Joypad.h>
+#include <Backend/VDP.h>
 
 //Backend input interface
 int Input_HandleEvents()
@@ -12,6 +13,11 @@ int Input_HandleEvents()
 		{
 			case SDL_QUIT:
 				return 1;
+			case SDL_KEYDOWN:
+				//Toggle fast-forward
+				if (e.key.keysym.scancode == SDL_SCANCODE_TAB && !e.key.repeat)
+					VDP_SetFastForward(!VDP_GetFastForward());
+				break;
 			default:
 				break;
 		}
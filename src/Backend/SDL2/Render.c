@@ -1,9 +1,24 @@
 #include "SDL_render.h"
 #include "SDL_timer.h"
+#include "SDL_version.h"
 
 #include "../VDP.h"
+#include "../VDPKernel.h"
+#include "../System.h"
+#include "../Thread.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+	#define ATOMIC_EXCHANGE(p, v) _InterlockedExchange((volatile long*)(p), (v))
+	#define ATOMIC_LOAD(p)        _InterlockedOr((volatile long*)(p), 0)
+#else
+	#define ATOMIC_EXCHANGE(p, v) __atomic_exchange_n((p), (v), __ATOMIC_ACQ_REL)
+	#define ATOMIC_LOAD(p)        __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#endif
 
 //Render compile options
 //#define DISPLAY_PADDING //Displays the internal VDP padding
@@ -16,6 +31,8 @@
 	#define TEXTURE_HEIGHT SCREEN_HEIGHT
 #endif
 
+#define SCREEN_PITCH (SCREEN_WIDTH + (VDP_INTERNAL_PAD * 2))
+
 //Icon
 static uint8_t icon_data[] = {
 	#include <Resource/Icon.h>
@@ -26,42 +43,178 @@ static SDL_Window *window = NULL;
 static SDL_Renderer *renderer = NULL;
 static SDL_Texture *texture = NULL;
 
+//Window surface present mode (used instead of the renderer when it would be software anyway)
+static bool present_surface;
+static const VDP_Kernels *kernels;
+
 //Render state
 static int vsync;
+static bool fast_forward; //Don't limit the frame rate
 
-//Backend render interface
-int Render_Init(const MD_Header *header)
+//Present thread, frames are handed to it through a triple buffer
+#define FRAME_FRESH 4 //Set in 'frame_middle' when it holds a frame the present thread hasn't taken yet
+
+static uint32_t frame_buffer[3][TEXTURE_HEIGHT][TEXTURE_WIDTH];
+static long frame_back = 0;   //Written by the game thread
+static long frame_middle = 1; //Exchanged between both threads
+static long frame_front = 2;  //Presented by the present thread
+
+static struct
 {
-	//Create window
-	if ((window = SDL_CreateWindow(header->title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, TEXTURE_WIDTH * SCREEN_SCALE, TEXTURE_HEIGHT * SCREEN_SCALE, SDL_WINDOW_HIDDEN)) == NULL)
+	Thread *thread;
+	Mutex *mutex;
+	Cond *cond;
+	bool init_done, quit;
+	int init_result;
+} present;
+
+//Frame pacer
+#define PACE_RESYNC_NS  100000000 //If we're this far behind, give up on catching up and restart from now
+#define PACE_HIST_STEP  50000     //Width of a wake error histogram bucket
+#define PACE_HIST_MIN   -20       //Buckets below the deadline (anything earlier goes in the first one)
+#define PACE_HIST_MAX   40        //Buckets past the deadline (anything later goes in the last one)
+
+static struct
+{
+	uint64_t period, spin; //Nanoseconds
+	uint64_t vsync_period; //Nanoseconds per presented frame at the display's refresh rate
+	bool sleep_only;
+	bool stats;
+	
+	uint64_t prev; //Deadline of the previous frame
+	
+	unsigned long frames, late, resyncs;
+	unsigned long hist[PACE_HIST_MAX - PACE_HIST_MIN + 1];
+} pace;
+
+static void Render_InitPacer()
+{
+	//Get target rate and waiting behaviour
+	const char *env;
+	double rate = ((env = getenv("SCP_FRAME_RATE")) != NULL) ? strtod(env, NULL) : 60.0;
+	if (!(rate >= 1.0 && rate <= 1000.0))
+		rate = 60.0;
+	pace.period = (uint64_t)(1000000000.0 / rate + 0.5);
+	pace.spin = (((env = getenv("SCP_FRAME_SPIN_US")) != NULL) ? strtoul(env, NULL, 0) : 500) * 1000;
+	pace.sleep_only = (env = getenv("SCP_FRAME_SLEEP")) != NULL && strtoul(env, NULL, 0) != 0;
+	pace.stats = (env = getenv("SCP_FRAME_STATS")) != NULL && strtoul(env, NULL, 0) != 0;
+	pace.vsync_period = 0;
+	pace.prev = 0;
+}
+
+static uint64_t Render_PacePeriod()
+{
+	//With vsync, frames go out at the display's rate, otherwise at the configured one
+	return vsync ? pace.vsync_period : pace.period;
+}
+
+static void Render_QuitPacer()
+{
+	if (!pace.stats || pace.frames == 0)
+		return;
+	
+	//Dump wake error histogram
+	printf("Frame pacer: %lu frames at %.3f Hz, %lu late, %lu resyncs\n", pace.frames, 1000000000.0 / Render_PacePeriod(), pace.late, pace.resyncs);
+	puts("Wake error (us) | Frames");
+	for (int i = 0; i <= PACE_HIST_MAX - PACE_HIST_MIN; i++)
 	{
-		printf("Render_Init: %s\n", SDL_GetError());
-		return -1;
+		if (pace.hist[i] == 0)
+			continue;
+		long from = (long)(i + PACE_HIST_MIN) * (PACE_HIST_STEP / 1000);
+		if (i == 0)
+			printf("       < %6ld | %lu\n", from + (PACE_HIST_STEP / 1000), pace.hist[i]);
+		else if (i == PACE_HIST_MAX - PACE_HIST_MIN)
+			printf("      >= %6ld | %lu\n", from, pace.hist[i]);
+		else
+			printf("%6ld .. %6ld | %lu\n", from, from + (PACE_HIST_STEP / 1000), pace.hist[i]);
 	}
+}
+
+static bool Render_UsePacer()
+{
+	//Frame pacer (when VSync is unavailable, or when the present thread is the one waiting on it)
+	return !fast_forward && (!vsync || present.thread != NULL);
+}
+
+static void Render_Pace()
+{
+	uint64_t now = System_GetNanoseconds();
+	uint64_t next = pace.prev + Render_PacePeriod();
 	
-	//Load icon
-	SDL_Surface *icon_surface;
-	if ((icon_surface = SDL_CreateRGBSurfaceWithFormatFrom((void*)icon_data, 16, 16, 24, 16*3, SDL_PIXELFORMAT_RGB24)) == NULL)
+	if (pace.prev == 0 || now >= pace.prev + PACE_RESYNC_NS)
 	{
-		printf("Render_Init: %s\n", SDL_GetError());
+		//Start over from now
+		if (pace.prev != 0)
+			pace.resyncs++;
+		pace.prev = now;
+		return;
+	}
+	
+	if (now < next)
+	{
+		//Sleep through most of the wait, then spin for the rest as sleeping is only millisecond accurate
+		uint64_t spin = pace.sleep_only ? 0 : pace.spin;
+		if (next - now > spin)
+		{
+			uint64_t sleep = next - now - spin;
+			SDL_Delay((uint32_t)((pace.sleep_only ? (sleep + 999999) : sleep) / 1000000));
+		}
+		if (!pace.sleep_only)
+			while ((now = System_GetNanoseconds()) < next);
+		else
+			now = System_GetNanoseconds();
 	}
 	else
 	{
-		SDL_SetWindowIcon(window, icon_surface);
-		SDL_FreeSurface(icon_surface);
+		pace.late++;
 	}
+	pace.prev = next;
 	
-	//Show window now that the icon's been loaded
-	SDL_ShowWindow(window);
+	//Record how far from the deadline we woke up
+	if (pace.stats)
+	{
+		int64_t error = (int64_t)(now - next);
+		int64_t bucket = (error >= 0) ? (error / PACE_HIST_STEP) : -((-error + PACE_HIST_STEP - 1) / PACE_HIST_STEP);
+		if (bucket < PACE_HIST_MIN)
+			bucket = PACE_HIST_MIN;
+		if (bucket > PACE_HIST_MAX)
+			bucket = PACE_HIST_MAX;
+		pace.hist[bucket - PACE_HIST_MIN]++;
+	}
+	pace.frames++;
+}
+
+static bool Render_UseSurface()
+{
+	//Use the requested present mode
+	const char *env = getenv("SCP_PRESENT");
+	if (env != NULL && strcmp(env, "surface") == 0)
+		return true;
+	if (env != NULL && strcmp(env, "renderer") == 0)
+		return false;
 	
-	//Check if VSync should be used
-	SDL_DisplayMode display_mode;
-	SDL_GetWindowDisplayMode(window, &display_mode);
-	if (display_mode.refresh_rate > 0 && (display_mode.refresh_rate % 60) == 0)
-		vsync = display_mode.refresh_rate / 60;
-	else
-		vsync = 0;
+	//Otherwise only write to the window surface if there's no accelerated renderer
+	SDL_RendererInfo info;
+	return SDL_GetRendererInfo(renderer, &info) == 0 && (info.flags & SDL_RENDERER_SOFTWARE);
+}
+
+static bool Render_UseThread()
+{
+	//Use the requested setting
+	const char *env = getenv("SCP_PRESENT_THREAD");
+	if (env != NULL)
+		return strtoul(env, NULL, 0) != 0;
 	
+	//macOS can only render from the main thread
+	#ifdef __APPLE__
+		return false;
+	#else
+		return true;
+	#endif
+}
+
+static int Render_InitRenderer()
+{
 	//Create renderer
 	if ((renderer = SDL_CreateRenderer(window, -1, vsync ? SDL_RENDERER_PRESENTVSYNC : 0)) == NULL)
 	{
@@ -69,6 +222,22 @@ int Render_Init(const MD_Header *header)
 		return -1;
 	}
 	
+	//Switch to the window surface if we'd be using the software renderer
+	if ((present_surface = Render_UseSurface()))
+	{
+		SDL_DestroyRenderer(renderer);
+		renderer = NULL;
+		vsync = 0;
+		
+		if (SDL_GetWindowSurface(window) == NULL)
+		{
+			printf("Render_Init: %s\n", SDL_GetError());
+			return -1;
+		}
+		kernels = VDP_GetKernels();
+		return 0;
+	}
+	
 	//Create screen texture
 	if ((texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STREAMING, TEXTURE_WIDTH, TEXTURE_HEIGHT)) == NULL)
 	{
@@ -79,68 +248,327 @@ int Render_Init(const MD_Header *header)
 	return 0;
 }
 
-void Render_Quit()
+static void Render_QuitRenderer()
 {
 	//Destroy screen texture
 	if (texture != NULL)
 		SDL_DestroyTexture(texture);
+	texture = NULL;
 	
-	//Destroy window and renderer
+	//Destroy renderer
 	if (renderer != NULL)
 		SDL_DestroyRenderer(renderer);
-	if (window != NULL)
-		SDL_DestroyWindow(window);
+	renderer = NULL;
 }
 
-//This takes in the internal VDP screen buffer positioned after the padding
-void Render_Screen(const uint32_t *screen)
+static void Render_PresentSurface(const uint32_t *screen, size_t pitch)
 {
-	//Framerate limiter (when VSync is unavailable)
-	if (!vsync)
+	SDL_Surface *surface = SDL_GetWindowSurface(window);
+	if (surface == NULL)
+		return;
+	
+	//Get the largest integer scale that fits, centred in the window
+	int scale_x = surface->w / TEXTURE_WIDTH, scale_y = surface->h / TEXTURE_HEIGHT;
+	int scale = (scale_x < scale_y) ? scale_x : scale_y;
+	if (scale > 4)
+		scale = 4;
+	if (scale < 1)
+		return;
+	
+	int x = (surface->w - TEXTURE_WIDTH * scale) / 2;
+	int y = (surface->h - TEXTURE_HEIGHT * scale) / 2;
+	
+	//Get how our RGBA colours convert to the surface's format
+	unsigned shift;
+	uint32_t or;
+	switch (surface->format->format)
 	{
-		static const unsigned int delays[3] = {17, 16, 17};
-		static unsigned int counter;
-		
-		static uint32_t time_prev;
-		const uint32_t time_now = SDL_GetTicks();
-		const uint32_t time_next = time_prev + delays[counter % 3];
-		
-		if (time_now >= time_prev + 100)
-		{
-			time_prev = time_now;
-		}
-		else
+		case SDL_PIXELFORMAT_RGBA8888:
+		case SDL_PIXELFORMAT_RGBX8888:
+			shift = 0;
+			or = 0;
+			break;
+		case SDL_PIXELFORMAT_ARGB8888:
+		case SDL_PIXELFORMAT_RGB888:
+			shift = 8;
+			or = 0xFF000000;
+			break;
+		default:
 		{
-			if (time_now < time_next)
-				SDL_Delay(time_next - time_now);
-			time_prev += delays[counter % 3];
+			//Let SDL convert and scale anything else
+			SDL_Surface *frame = SDL_CreateRGBSurfaceWithFormatFrom((void*)screen, TEXTURE_WIDTH, TEXTURE_HEIGHT, 32, pitch << 2, SDL_PIXELFORMAT_RGBA8888);
+			if (frame != NULL)
+			{
+				SDL_Rect rect = {x, y, TEXTURE_WIDTH * scale, TEXTURE_HEIGHT * scale};
+				SDL_BlitScaled(frame, NULL, surface, &rect);
+				SDL_FreeSurface(frame);
+			}
+			SDL_UpdateWindowSurface(window);
+			return;
 		}
-		
-		counter++;
+	}
+	
+	//Convert and scale each line, then repeat it for the rest of the scaled line's height
+	if (SDL_MUSTLOCK(surface))
+		SDL_LockSurface(surface);
+	
+	uint8_t *to = (uint8_t*)surface->pixels + y * surface->pitch + (x << 2);
+	for (size_t i = 0; i < TEXTURE_HEIGHT; i++)
+	{
+		kernels->scale((uint32_t*)to, screen, TEXTURE_WIDTH, scale, shift, or);
+		for (int j = 1; j < scale; j++)
+			memcpy(to + j * surface->pitch, to, (TEXTURE_WIDTH * scale) << 2);
+		to += scale * surface->pitch;
+		screen += pitch;
+	}
+	
+	if (SDL_MUSTLOCK(surface))
+		SDL_UnlockSurface(surface);
+	
+	SDL_UpdateWindowSurface(window);
+}
+
+//Presents a frame, 'pitch' is in pixels
+static void Render_Present(const uint32_t *screen, size_t pitch, int presents)
+{
+	//Write straight to the window surface
+	if (present_surface)
+	{
+		Render_PresentSurface(screen, pitch);
+		return;
 	}
 	
 	//Lock screen texture
 	uint8_t *to;
-	int pitch;
-	SDL_LockTexture(texture, NULL, (void**)&to, &pitch);
+	int to_pitch;
+	SDL_LockTexture(texture, NULL, (void**)&to, &to_pitch);
 	
 	//Copy screen
-	#ifdef DISPLAY_PADDING
-		screen -= VDP_INTERNAL_PAD;
-	#endif
 	for (size_t i = 0; i < TEXTURE_HEIGHT; i++)
 	{
 		memcpy(to, screen, TEXTURE_WIDTH << 2);
-		to += pitch;
-		screen += SCREEN_WIDTH + (VDP_INTERNAL_PAD * 2);
+		to += to_pitch;
+		screen += pitch;
 	}
 	
 	//Unlock screen texture and draw to window
 	SDL_UnlockTexture(texture);
 	
-	for (int i = 0; i < (vsync == 0 ? 1 : vsync); i++)
+	for (int i = 0; i < presents; i++)
 	{
 		SDL_RenderCopy(renderer, texture, NULL, NULL);
 		SDL_RenderPresent(renderer);
 	}
 }
+
+static void Render_PresentThread(void *arg)
+{
+	(void)arg;
+	
+	//Create the renderer on this thread, as it's the only one that will use it
+	int result = Render_InitRenderer();
+	
+	Mutex_Lock(present.mutex);
+	present.init_result = result;
+	present.init_done = true;
+	Cond_Broadcast(present.cond);
+	
+	while (result == 0)
+	{
+		//Wait for a new frame
+		while (!(ATOMIC_LOAD(&frame_middle) & FRAME_FRESH) && !present.quit)
+			Cond_Wait(present.cond, present.mutex);
+		if (present.quit)
+			break;
+		Mutex_Unlock(present.mutex);
+		
+		//Take the new frame and present it, blocking on vsync here rather than in the game
+		frame_front = ATOMIC_EXCHANGE(&frame_middle, frame_front) & ~FRAME_FRESH;
+		Render_Present(&frame_buffer[frame_front][0][0], TEXTURE_WIDTH, 1);
+		
+		Mutex_Lock(present.mutex);
+	}
+	Mutex_Unlock(present.mutex);
+	
+	Render_QuitRenderer();
+}
+
+static int Render_StartThread()
+{
+	//Create synchronization objects
+	present.init_done = false;
+	present.quit = false;
+	if ((present.mutex = Mutex_Create()) == NULL || (present.cond = Cond_Create()) == NULL)
+		return -1;
+	
+	//Start present thread and wait for it to create the renderer
+	if ((present.thread = Thread_Create(Render_PresentThread, NULL)) == NULL)
+		return -1;
+	
+	Mutex_Lock(present.mutex);
+	while (!present.init_done)
+		Cond_Wait(present.cond, present.mutex);
+	Mutex_Unlock(present.mutex);
+	return present.init_result;
+}
+
+static void Render_StopThread()
+{
+	//Stop present thread
+	if (present.thread != NULL)
+	{
+		Mutex_Lock(present.mutex);
+		present.quit = true;
+		Cond_Broadcast(present.cond);
+		Mutex_Unlock(present.mutex);
+		
+		Thread_Join(present.thread);
+		present.thread = NULL;
+	}
+	
+	//Destroy synchronization objects
+	if (present.cond != NULL)
+		Cond_Destroy(present.cond);
+	if (present.mutex != NULL)
+		Mutex_Destroy(present.mutex);
+	present.cond = NULL;
+	present.mutex = NULL;
+}
+
+static void Render_UpdateVSync()
+{
+	//Stop waiting for vsync while fast-forwarding from the game thread (the present thread just drops frames instead)
+	#if SDL_VERSION_ATLEAST(2, 0, 18)
+		if (renderer != NULL && present.thread == NULL && vsync)
+			SDL_RenderSetVSync(renderer, !fast_forward);
+	#endif
+}
+
+//Backend render interface
+int Render_Init(const MD_Header *header)
+{
+	//Initialize frame pacer
+	Render_InitPacer();
+	
+	//Create window
+	if ((window = SDL_CreateWindow(header->title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, TEXTURE_WIDTH * SCREEN_SCALE, TEXTURE_HEIGHT * SCREEN_SCALE, SDL_WINDOW_HIDDEN)) == NULL)
+	{
+		printf("Render_Init: %s\n", SDL_GetError());
+		return -1;
+	}
+	
+	//Load icon
+	SDL_Surface *icon_surface;
+	if ((icon_surface = SDL_CreateRGBSurfaceWithFormatFrom((void*)icon_data, 16, 16, 24, 16*3, SDL_PIXELFORMAT_RGB24)) == NULL)
+	{
+		printf("Render_Init: %s\n", SDL_GetError());
+	}
+	else
+	{
+		SDL_SetWindowIcon(window, icon_surface);
+		SDL_FreeSurface(icon_surface);
+	}
+	
+	//Show window now that the icon's been loaded
+	SDL_ShowWindow(window);
+	
+	//Check if VSync should be used
+	SDL_DisplayMode display_mode;
+	SDL_GetWindowDisplayMode(window, &display_mode);
+	if (display_mode.refresh_rate > 0 && (display_mode.refresh_rate % 60) == 0)
+		vsync = display_mode.refresh_rate / 60;
+	else
+		vsync = 0;
+	if (vsync)
+		pace.vsync_period = 1000000000ull * vsync / display_mode.refresh_rate;
+	
+	//Create renderer, on the present thread if we're using one
+	if (Render_UseThread())
+	{
+		if (Render_StartThread() == 0)
+			return 0;
+		
+		//Fall back to presenting from the game thread
+		puts("Render_Init: Failed to start present thread, presenting from the game thread");
+		Render_StopThread();
+	}
+	if (Render_InitRenderer())
+		return -1;
+	
+	//Apply fast-forward if it was requested before the renderer existed
+	Render_UpdateVSync();
+	return 0;
+}
+
+void Render_Quit()
+{
+	//Stop present thread (which destroys the renderer itself) or destroy renderer
+	if (present.thread != NULL)
+		Render_StopThread();
+	else
+		Render_QuitRenderer();
+	
+	//Destroy window
+	if (window != NULL)
+		SDL_DestroyWindow(window);
+	
+	//Report frame pacing
+	Render_QuitPacer();
+}
+
+//This takes in the internal VDP screen buffer positioned after the padding
+void Render_Screen(const uint32_t *screen)
+{
+	if (Render_UsePacer())
+		Render_Pace();
+	
+	#ifdef DISPLAY_PADDING
+		screen -= VDP_INTERNAL_PAD;
+	#endif
+	
+	if (present.thread != NULL)
+	{
+		//Copy screen into the back buffer
+		uint32_t *to = &frame_buffer[frame_back][0][0];
+		for (size_t i = 0; i < TEXTURE_HEIGHT; i++)
+		{
+			memcpy(to, screen, TEXTURE_WIDTH << 2);
+			to += TEXTURE_WIDTH;
+			screen += SCREEN_PITCH;
+		}
+		
+		//Publish it and wake the present thread, a frame it hasn't taken yet is dropped
+		frame_back = ATOMIC_EXCHANGE(&frame_middle, frame_back | FRAME_FRESH) & ~FRAME_FRESH;
+		
+		Mutex_Lock(present.mutex);
+		Cond_Signal(present.cond);
+		Mutex_Unlock(present.mutex);
+	}
+	else
+	{
+		Render_Present(screen, SCREEN_PITCH, (vsync == 0 || fast_forward) ? 1 : vsync);
+	}
+}
+
+uint64_t Render_GetFramePeriod()
+{
+	//Either vsync or the pacer sets the rate, and with vsync both go by the display
+	return Render_PacePeriod();
+}
+
+void Render_SkipFrame()
+{
+	//Keep the pacer's schedule on the wall clock, or the frames after a skip would run early to make up for it
+	if (Render_UsePacer() && pace.prev != 0)
+		pace.prev += Render_PacePeriod();
+}
+
+void Render_SetFastForward(bool enable)
+{
+	fast_forward = enable;
+	
+	//Restart the pacer's schedule from the next frame
+	pace.prev = 0;
+	
+	Render_UpdateVSync();
+}
@@ -1,6 +1,7 @@
 #include "SDL.h"
 
 #include "../MegaDrive.h"
+#include "../System.h"
 
 #include <stdio.h>
 
@@ -19,6 +20,15 @@ int System_Init(const MD_Header *header)
 	return 0;
 }
 
+uint64_t System_GetNanoseconds(void)
+{
+	static uint64_t freq;
+	if (freq == 0)
+		freq = SDL_GetPerformanceFrequency();
+	uint64_t count = SDL_GetPerformanceCounter();
+	return (count / freq) * 1000000000 + ((count % freq) * 1000000000) / freq;
+}
+
 void System_Quit()
 {
 	//Quit SDL2
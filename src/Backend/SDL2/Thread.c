@@ -0,0 +1,98 @@
+#include "SDL_thread.h"
+#include "SDL_mutex.h"
+#include "SDL_cpuinfo.h"
+
+#include "../Thread.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+//Thread structure
+struct Thread
+{
+	SDL_Thread *thread;
+	ThreadFunc func;
+	void *arg;
+};
+
+static int Thread_Entry(void *data)
+{
+	Thread *thread = (Thread*)data;
+	thread->func(thread->arg);
+	return 0;
+}
+
+//Thread backend interface
+Thread *Thread_Create(ThreadFunc func, void *arg)
+{
+	Thread *thread = malloc(sizeof(Thread));
+	if (thread == NULL)
+		return NULL;
+	
+	thread->func = func;
+	thread->arg = arg;
+	if ((thread->thread = SDL_CreateThread(Thread_Entry, "SoniCPort", thread)) == NULL)
+	{
+		printf("Thread_Create: %s\n", SDL_GetError());
+		free(thread);
+		return NULL;
+	}
+	return thread;
+}
+
+void Thread_Join(Thread *thread)
+{
+	SDL_WaitThread(thread->thread, NULL);
+	free(thread);
+}
+
+size_t Thread_GetCPUCount()
+{
+	int count = SDL_GetCPUCount();
+	return (count > 0) ? (size_t)count : 1;
+}
+
+Mutex *Mutex_Create()
+{
+	return (Mutex*)SDL_CreateMutex();
+}
+
+void Mutex_Destroy(Mutex *mutex)
+{
+	SDL_DestroyMutex((SDL_mutex*)mutex);
+}
+
+void Mutex_Lock(Mutex *mutex)
+{
+	SDL_LockMutex((SDL_mutex*)mutex);
+}
+
+void Mutex_Unlock(Mutex *mutex)
+{
+	SDL_UnlockMutex((SDL_mutex*)mutex);
+}
+
+Cond *Cond_Create()
+{
+	return (Cond*)SDL_CreateCond();
+}
+
+void Cond_Destroy(Cond *cond)
+{
+	SDL_DestroyCond((SDL_cond*)cond);
+}
+
+void Cond_Wait(Cond *cond, Mutex *mutex)
+{
+	SDL_CondWait((SDL_cond*)cond, (SDL_mutex*)mutex);
+}
+
+void Cond_Signal(Cond *cond)
+{
+	SDL_CondSignal((SDL_cond*)cond);
+}
+
+void Cond_Broadcast(Cond *cond)
+{
+	SDL_CondBroadcast((SDL_cond*)cond);
+}
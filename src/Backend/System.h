@@ -0,0 +1,6 @@
+#pragma once
+
+#include <stdint.h>
+
+//System timing interface
+uint64_t System_GetNanoseconds(void);
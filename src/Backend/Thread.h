@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stddef.h>
+
+//Thread types
+typedef struct Thread Thread;
+typedef struct Mutex Mutex;
+typedef struct Cond Cond;
+
+typedef void (*ThreadFunc)(void *arg);
+
+//Thread backend interface
+Thread *Thread_Create(ThreadFunc func, void *arg);
+void Thread_Join(Thread *thread);
+size_t Thread_GetCPUCount();
+
+Mutex *Mutex_Create();
+void Mutex_Destroy(Mutex *mutex);
+void Mutex_Lock(Mutex *mutex);
+void Mutex_Unlock(Mutex *mutex);
+
+Cond *Cond_Create();
+void Cond_Destroy(Cond *cond);
+void Cond_Wait(Cond *cond, Mutex *mutex);
+void Cond_Signal(Cond *cond);
+void Cond_Broadcast(Cond *cond);
@@ -1,6 +1,9 @@
 #include "VDP.h"
 
 #include "MegaDrive.h"
+#include "System.h"
+#include "Thread.h"
+#include "VDPKernel.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -10,6 +13,9 @@
 int Render_Init(const MD_Header *header);
 void Render_Quit();
 void Render_Screen(const uint32_t *screen);
+void Render_SetFastForward(bool enable);
+void Render_SkipFrame();
+uint64_t Render_GetFramePeriod();
 
 //Input backend interface
 int Input_HandleEvents();
@@ -18,27 +24,238 @@ int Input_HandleEvents();
 #define VDP_SANITY //Enable sanity checks for the VDP (slower, but technically safer, basically for testing)
 //#define VDP_PALETTE_DISPLAY //Enable palette display
 
-//VDP masks
-#define VDP_MASK_PLANEPRI (1 << 0)
-#define VDP_MASK_SPRITE   (1 << 1)
+#define VDP_THREADS_MAX 8 //Maximum amount of raster worker threads (in addition to the main thread)
+#define VDP_BAND_HEIGHT 8 //Minimum amount of scanlines in a raster band
+
+#define VDP_QUEUE_SIZE 32 //Maximum amount of pending transfers
+
+#define VDP_LINE_EVENTS     32    //Maximum amount of line events per frame
+#define VDP_LINE_EVENT_DATA 0x100 //Maximum amount of CRAM words written by line events per frame
+#define VDP_PALETTES        4     //Amount of converted palettes kept, so palettes swapped in by line events aren't converted every frame
+
+#define VDP_SKIP_RESYNC_NS 100000000 //If we're this far behind, give up on catching up
+#ifdef SCP_BACKEND_NULL
+	#define VDP_SKIP_DEFAULT 0 //Keep headless runs deterministic
+#else
+	#define VDP_SKIP_DEFAULT 4 //Maximum amount of frames to skip in a row
+#endif
 
 //VDP internal state
-static ALIGNED2 uint8_t vdp_vram[VRAM_SIZE];
-static uint16_t vdp_cram[4][16];
+//The game writes to the live state, which is committed to the renderer's copy once per frame
+struct VDP_Registers
+{
+	size_t plane_a_location, plane_b_location, sprite_location, hscroll_location;
+	size_t plane_w, plane_h;
+	uint8_t background_colour;
+	int16_t vscroll_a, vscroll_b;
+	int16_t hint_pos;
+};
+
+static ALIGNED2 uint8_t vdp_vram_live[VRAM_SIZE];
+static uint16_t vdp_cram_live[4][16];
+static struct VDP_Registers vdp_reg_live;
 
 static uint8_t *vdp_vram_p;
 static uint16_t *vdp_cram_p;
 
-static size_t vdp_plane_a_location, vdp_plane_b_location, vdp_sprite_location, vdp_hscroll_location;
-static size_t vdp_plane_w, vdp_plane_h;
-static uint8_t vdp_background_colour;
-
-static int16_t vdp_vscroll_a, vdp_vscroll_b;
+static uint32_t vdp_vram_dirty[(VRAM_SIZE >> 5) / 32]; //32-byte VRAM blocks written since the last commit
+static bool vdp_vram_dirty_any;
+static bool vdp_cram_live_dirty;
 
-static int16_t vdp_hint_pos;
+static ALIGNED2 uint8_t vdp_vram[VRAM_SIZE];
+static uint16_t vdp_cram[4][16];
+static struct VDP_Registers vdp_reg;
+static bool vdp_cram_dirty;
 
 static MD_Vector vdp_hint, vdp_vint;
 
+//VDP line events
+//Register and CRAM writes that take effect from a scanline onwards, only for the frame they were set for
+typedef enum
+{
+	VDP_LineEvent_CRAM,
+	VDP_LineEvent_VScroll,
+	VDP_LineEvent_BackgroundColour,
+} VDP_LineEventKind;
+
+struct VDP_LineEvent
+{
+	int16_t line;
+	uint8_t kind;
+	uint8_t index;     //CRAM colour index or background colour
+	uint16_t len, data; //CRAM length and position in the timeline's data
+	int16_t vscroll[2];
+};
+
+static struct VDP_Timeline
+{
+	struct VDP_LineEvent event[VDP_LINE_EVENTS]; //Sorted by line
+	size_t events;
+	uint16_t data[VDP_LINE_EVENT_DATA];
+	size_t data_len;
+} vdp_timeline_live, vdp_timeline;
+
+static int16_t vdp_hint_line = -1; //Line the horizontal interrupt is being run for, its writes become line events
+static bool vdp_line_test;          //Add a test pattern of line events to every frame
+
+static const VDP_Kernels *vdp_kernels;
+
+//VDP pattern cache
+#define PATTERNS (VRAM_SIZE >> 5)
+
+static struct VDP_Pattern
+{
+	uint8_t row[2][8][8]; //Decoded pixels, indexed by [x flip][y][x]
+	uint8_t empty;        //Bit y is set if row y is fully transparent
+} vdp_pattern_cache[PATTERNS];
+
+static uint32_t vdp_pattern_dirty[PATTERNS / 32];
+static bool vdp_pattern_dirty_any;
+
+static void VDP_DirtyVRAM(size_t offset, size_t len)
+{
+	if (len == 0)
+		return;
+	
+	//Mark every block in the given VRAM range as written
+	size_t end = (offset + len - 1) >> 5;
+	for (size_t i = offset >> 5; i <= end; i++)
+		vdp_vram_dirty[i >> 5] |= 1UL << (i & 31);
+	vdp_vram_dirty_any = true;
+}
+
+//Marks the patterns that writing the given data would change as dirty
+static void VDP_DirtyWrite(size_t offset, const uint8_t *data, size_t len)
+{
+	while (len != 0)
+	{
+		size_t part = 0x20 - (offset & 0x1F);
+		if (part > len)
+			part = len;
+		if (memcmp(vdp_vram_live + offset, data, part) != 0)
+			VDP_DirtyVRAM(offset, part);
+		offset += part;
+		data += part;
+		len -= part;
+	}
+}
+
+static void VDP_DirtyFill(size_t offset, uint8_t data, size_t len)
+{
+	while (len != 0)
+	{
+		size_t part = 0x20 - (offset & 0x1F);
+		if (part > len)
+			part = len;
+		for (size_t i = 0; i < part; i++)
+		{
+			if (vdp_vram_live[offset + i] != data)
+			{
+				VDP_DirtyVRAM(offset, part);
+				break;
+			}
+		}
+		offset += part;
+		len -= part;
+	}
+}
+
+//VDP transfer queue
+static struct VDP_Transfer
+{
+	VDP_TransferKind kind;
+	const void *data;
+	size_t offset, len; //In bytes
+} vdp_queue[VDP_QUEUE_SIZE];
+
+static size_t vdp_queue_num;
+static size_t vdp_queue_lo[2], vdp_queue_hi[2]; //Byte range covered by pending transfers, per kind
+
+static unsigned long long vdp_transfer_bytes, vdp_transfer_count; //Committed since VDP_Init, reported on exit
+
+//Flushes pending transfers if a direct write would land on top of them, so writes stay in order
+static inline void VDP_QueueCheck(VDP_TransferKind kind, size_t offset, size_t len)
+{
+	if (vdp_queue_num != 0 && offset < vdp_queue_hi[kind] && (offset + len) > vdp_queue_lo[kind])
+		VDP_FlushQueue();
+}
+
+//Decodes dirty patterns, and ORs the dirty bits into 'changed'
+static void VDP_RefreshPatterns(uint32_t *changed)
+{
+	if (!vdp_pattern_dirty_any)
+		return;
+	vdp_pattern_dirty_any = false;
+	
+	for (size_t i = 0; i < PATTERNS / 32; i++)
+	{
+		uint32_t dirty = vdp_pattern_dirty[i];
+		if (dirty == 0)
+			continue;
+		vdp_pattern_dirty[i] = 0;
+		changed[i] |= dirty;
+		
+		for (size_t j = 0; j < 32; j++)
+		{
+			if (!(dirty & (1UL << j)))
+				continue;
+			
+			//Decode pattern rows and their X flipped variants
+			struct VDP_Pattern *pattern = &vdp_pattern_cache[(i << 5) | j];
+			const uint8_t *from = vdp_vram + (((i << 5) | j) << 5);
+			
+			pattern->empty = 0;
+			for (size_t y = 0; y < 8; y++, from += 4)
+			{
+				uint8_t *row = pattern->row[0][y];
+				uint8_t *row_flip = pattern->row[1][y];
+				for (size_t x = 0; x < 8; x++)
+					row_flip[7 - x] = row[x] = (from[x >> 1] >> ((x & 1) ? 0 : 4)) & 0xF;
+				
+				if ((from[0] | from[1] | from[2] | from[3]) == 0)
+					pattern->empty |= 1 << y;
+			}
+		}
+	}
+}
+
+//VDP rendering
+static void VDP_InitScreen();
+static void VDP_InitColourLUT();
+
+//VDP renderers
+static int VDP_InitRenderer();
+static void VDP_QuitRenderer();
+
+//VDP raster worker pool
+static void VDP_PoolInit();
+static void VDP_PoolQuit();
+
+//VDP render thread
+static void VDP_PipeInit();
+static void VDP_PipeQuit();
+
+//VDP frame skipping
+static struct
+{
+	unsigned max, run;
+	unsigned long frames, skipped;
+	uint64_t period;     //Frame period the backend presents at
+	uint64_t work_start; //When the game started working on the current frame
+	uint64_t present;    //Time spent presenting during the current frame, which isn't counted as work
+	uint64_t behind;     //How far the frames' work has run over their periods
+	bool skip;           //Don't draw the current frame
+} vdp_skip;
+
+//VDP fast-forward
+#define VDP_FF_RATE_DEFAULT 8 //Draw every 8th frame while fast-forwarding
+
+static struct
+{
+	bool enable;
+	unsigned rate, count;
+} vdp_ff = {false, VDP_FF_RATE_DEFAULT, 0};
+
 //VDP interface
 int VDP_Init(const MD_Header *header)
 {
@@ -46,17 +263,45 @@ int VDP_Init(const MD_Header *header)
 	if (Render_Init(header))
 		return -1;
 	
+	//Initialize screen and colour conversion
+	VDP_InitScreen();
+	VDP_InitColourLUT();
+	
+	//Select kernels and renderer, and start raster workers
+	vdp_kernels = VDP_GetKernels();
+	if (VDP_InitRenderer())
+		return -1;
+	VDP_PoolInit();
+	VDP_PipeInit();
+	
+	//Get frame skip limit
+	const char *env = getenv("SCP_VDP_FRAMESKIP");
+	memset(&vdp_skip, 0, sizeof(vdp_skip));
+	vdp_skip.max = (env != NULL) ? strtoul(env, NULL, 0) : VDP_SKIP_DEFAULT;
+	vdp_skip.period = Render_GetFramePeriod();
+	vdp_transfer_bytes = 0;
+	vdp_transfer_count = 0;
+	
+	//Get line event test pattern
+	env = getenv("SCP_VDP_LINE_TEST");
+	vdp_line_test = env != NULL && strcmp(env, "0") != 0;
+	
 	//Initialize VDP state
-	vdp_plane_a_location = 0;
-	vdp_plane_b_location = 0;
-	vdp_sprite_location  = 0;
-	vdp_hscroll_location = 0;
-	vdp_plane_w = 32;
-	vdp_plane_h = 32;
-	vdp_background_colour = 0;
-	vdp_vscroll_a = 0;
-	vdp_vscroll_b = 0;
-	vdp_hint_pos = -1;
+	vdp_reg_live.plane_a_location = 0;
+	vdp_reg_live.plane_b_location = 0;
+	vdp_reg_live.sprite_location  = 0;
+	vdp_reg_live.hscroll_location = 0;
+	vdp_reg_live.plane_w = 32;
+	vdp_reg_live.plane_h = 32;
+	vdp_reg_live.background_colour = 0;
+	vdp_reg_live.vscroll_a = 0;
+	vdp_reg_live.vscroll_b = 0;
+	vdp_reg_live.hint_pos = -1;
+	vdp_reg = vdp_reg_live;
+	
+	memset(vdp_pattern_dirty, 0xFF, sizeof(vdp_pattern_dirty));
+	vdp_pattern_dirty_any = true;
+	vdp_cram_dirty = true;
 	
 	vdp_hint = header->h_interrupt;
 	vdp_vint = header->v_interrupt;
@@ -66,6 +311,17 @@ int VDP_Init(const MD_Header *header)
 
 void VDP_Quit()
 {
+	//Stop render thread and raster workers
+	VDP_PipeQuit();
+	VDP_PoolQuit();
+	
+	//Report transfers, skipped frames and renderer verification
+	if (vdp_skip.frames != 0)
+		printf("VDP: %.1f bytes in %.1f transfers committed per frame\n", (double)vdp_transfer_bytes / vdp_skip.frames, (double)vdp_transfer_count / vdp_skip.frames);
+	if (vdp_skip.skipped != 0)
+		printf("VDP: Skipped drawing %lu of %lu frames\n", vdp_skip.skipped, vdp_skip.frames);
+	VDP_QuitRenderer();
+	
 	//Quit backend
 	Render_Quit();
 }
@@ -79,18 +335,20 @@ void VDP_SeekVRAM(size_t offset)
 		return;
 	}
 	#endif
-	vdp_vram_p = vdp_vram + offset;
+	vdp_vram_p = vdp_vram_live + offset;
 }
 
 void VDP_WriteVRAM(const uint8_t *data, size_t len)
 {
 	#ifdef VDP_SANITY
-	if ((vdp_vram_p - vdp_vram) >= VRAM_SIZE || (vdp_vram_p - vdp_vram + len) > VRAM_SIZE)
+	if ((vdp_vram_p - vdp_vram_live) >= VRAM_SIZE || (vdp_vram_p - vdp_vram_live + len) > VRAM_SIZE)
 	{
 		puts("VDP_WriteVRAM: Out-of-bounds");
 		return;
 	}
 	#endif
+	VDP_QueueCheck(VDP_Transfer_VRAM, vdp_vram_p - vdp_vram_live, len);
+	VDP_DirtyWrite(vdp_vram_p - vdp_vram_live, data, len);
 	memcpy(vdp_vram_p, data, len);
 	vdp_vram_p += len;
 }
@@ -98,16 +356,75 @@ void VDP_WriteVRAM(const uint8_t *data, size_t len)
 void VDP_FillVRAM(uint8_t data, size_t len)
 {
 	#ifdef VDP_SANITY
-	if ((vdp_vram_p - vdp_vram) >= VRAM_SIZE || (vdp_vram_p - vdp_vram + len) > VRAM_SIZE)
+	if ((vdp_vram_p - vdp_vram_live) >= VRAM_SIZE || (vdp_vram_p - vdp_vram_live + len) > VRAM_SIZE)
 	{
 		puts("VDP_WriteVRAM: Out-of-bounds");
 		return;
 	}
 	#endif
+	VDP_QueueCheck(VDP_Transfer_VRAM, vdp_vram_p - vdp_vram_live, len);
+	VDP_DirtyFill(vdp_vram_p - vdp_vram_live, data, len);
 	memset(vdp_vram_p, data, len);
 	vdp_vram_p += len;
 }
 
+static inline void VDP_PokeWord(size_t offset, uint16_t v)
+{
+	uint16_t *to = (uint16_t*)(vdp_vram_live + offset);
+	if (*to != v)
+	{
+		*to = v;
+		vdp_vram_dirty[offset >> 10] |= 1UL << ((offset >> 5) & 31);
+		vdp_vram_dirty_any = true;
+	}
+}
+
+static inline bool VDP_CheckRect(const char *name, size_t offset, size_t pitch, size_t width, size_t height)
+{
+	#ifdef VDP_SANITY
+	if ((offset & 1) || offset >= VRAM_SIZE || (width != 0 && height != 0 && (offset + (height - 1) * pitch + (width << 1)) > VRAM_SIZE))
+	{
+		printf("%s: Out-of-bounds\n", name);
+		return false;
+	}
+	#else
+	(void)name;
+	#endif
+	if (width != 0 && height != 0)
+		VDP_QueueCheck(VDP_Transfer_VRAM, offset, (height - 1) * pitch + (width << 1));
+	return true;
+}
+
+void VDP_WriteVRAMWords(size_t offset, size_t stride, const uint16_t *words, size_t count)
+{
+	if (!VDP_CheckRect("VDP_WriteVRAMWords", offset, stride, 1, count))
+		return;
+	for (; count != 0; count--, offset += stride)
+		VDP_PokeWord(offset, *words++);
+}
+
+void VDP_WriteVRAMRect(size_t offset, size_t pitch, const uint8_t *tilemap, size_t width, size_t height, uint16_t add)
+{
+	if (!VDP_CheckRect("VDP_WriteVRAMRect", offset, pitch, width, height))
+		return;
+	for (; height != 0; height--, offset += pitch)
+	{
+		for (size_t x = 0; x < width; x++, tilemap += 2)
+			VDP_PokeWord(offset + (x << 1), ((tilemap[0] << 8) | (tilemap[1] << 0)) + add);
+	}
+}
+
+void VDP_FillVRAMRect(size_t offset, size_t pitch, uint16_t v, size_t width, size_t height)
+{
+	if (!VDP_CheckRect("VDP_FillVRAMRect", offset, pitch, width, height))
+		return;
+	for (; height != 0; height--, offset += pitch)
+	{
+		for (size_t x = 0; x < width; x++)
+			VDP_PokeWord(offset + (x << 1), v);
+	}
+}
+
 void VDP_SeekCRAM(size_t offset)
 {
 	#ifdef VDP_SANITY
@@ -117,33 +434,161 @@ void VDP_SeekCRAM(size_t offset)
 		return;
 	}
 	#endif
-	vdp_cram_p = &vdp_cram[0][0] + offset;
+	vdp_cram_p = &vdp_cram_live[0][0] + offset;
 }
 
 void VDP_WriteCRAM(const uint16_t *data, size_t len)
 {
 	#ifdef VDP_SANITY
-	if ((vdp_cram_p - &vdp_cram[0][0]) >= COLOURS || (vdp_cram_p - &vdp_cram[0][0] + len) > COLOURS)
+	if ((vdp_cram_p - &vdp_cram_live[0][0]) >= COLOURS || (vdp_cram_p - &vdp_cram_live[0][0] + len) > COLOURS)
 	{
 		puts("VDP_WriteCRAM: Out-of-bounds");
 		return;
 	}
 	#endif
-	memcpy(vdp_cram_p, data, len << 1);
+	if (vdp_hint_line >= 0)
+	{
+		VDP_SetLineCRAM(vdp_hint_line, vdp_cram_p - &vdp_cram_live[0][0], data, len);
+		vdp_cram_p += len;
+		return;
+	}
+	VDP_QueueCheck(VDP_Transfer_CRAM, (vdp_cram_p - &vdp_cram_live[0][0]) << 1, len << 1);
+	if (memcmp(vdp_cram_p, data, len << 1) != 0)
+	{
+		memcpy(vdp_cram_p, data, len << 1);
+		vdp_cram_live_dirty = true;
+	}
 	vdp_cram_p += len;
 }
 
 void VDP_FillCRAM(uint16_t data, size_t len)
 {
 	#ifdef VDP_SANITY
-	if ((vdp_cram_p - &vdp_cram[0][0]) >= COLOURS || (vdp_cram_p - &vdp_cram[0][0] + len) > COLOURS)
+	if ((vdp_cram_p - &vdp_cram_live[0][0]) >= COLOURS || (vdp_cram_p - &vdp_cram_live[0][0] + len) > COLOURS)
 	{
 		puts("VDP_WriteCRAM: Out-of-bounds");
 		return;
 	}
 	#endif
-	while (len-- > 0)
-		*vdp_cram_p++ = data;
+	if (vdp_hint_line >= 0)
+	{
+		//Only fill as much as fits in CRAM
+		size_t offset = vdp_cram_p - &vdp_cram_live[0][0];
+		size_t room = (offset < COLOURS) ? (COLOURS - offset) : 0;
+		if (len > room)
+			len = room;
+		
+		uint16_t fill[COLOURS];
+		for (size_t i = 0; i < len; i++)
+			fill[i] = data;
+		VDP_SetLineCRAM(vdp_hint_line, offset, fill, len);
+		vdp_cram_p += len;
+		return;
+	}
+	VDP_QueueCheck(VDP_Transfer_CRAM, (vdp_cram_p - &vdp_cram_live[0][0]) << 1, len << 1);
+	for (; len-- > 0; vdp_cram_p++)
+	{
+		if (*vdp_cram_p != data)
+		{
+			*vdp_cram_p = data;
+			vdp_cram_live_dirty = true;
+		}
+	}
+}
+
+static void VDP_Queue(VDP_TransferKind kind, size_t offset, const void *data, size_t len)
+{
+	if (len == 0)
+		return;
+	
+	//Extend the last transfer if this one continues it, otherwise push a new one
+	struct VDP_Transfer *last = (vdp_queue_num != 0) ? &vdp_queue[vdp_queue_num - 1] : NULL;
+	if (last != NULL && last->kind == kind && last->offset + last->len == offset && (const uint8_t*)last->data + last->len == (const uint8_t*)data)
+	{
+		last->len += len;
+	}
+	else
+	{
+		if (vdp_queue_num == VDP_QUEUE_SIZE)
+			VDP_FlushQueue();
+		if (vdp_queue_num == 0)
+		{
+			vdp_queue_lo[0] = vdp_queue_lo[1] = SIZE_MAX;
+			vdp_queue_hi[0] = vdp_queue_hi[1] = 0;
+		}
+		
+		struct VDP_Transfer *transfer = &vdp_queue[vdp_queue_num++];
+		transfer->kind = kind;
+		transfer->data = data;
+		transfer->offset = offset;
+		transfer->len = len;
+	}
+	
+	//Update covered range
+	if (offset < vdp_queue_lo[kind])
+		vdp_queue_lo[kind] = offset;
+	if (offset + len > vdp_queue_hi[kind])
+		vdp_queue_hi[kind] = offset + len;
+}
+
+void VDP_QueueVRAM(size_t offset, const uint8_t *data, size_t len)
+{
+	#ifdef VDP_SANITY
+	if (offset >= VRAM_SIZE || (offset + len) > VRAM_SIZE)
+	{
+		puts("VDP_QueueVRAM: Out-of-bounds");
+		return;
+	}
+	#endif
+	VDP_Queue(VDP_Transfer_VRAM, offset, data, len);
+}
+
+void VDP_QueueCRAM(size_t offset, const uint16_t *data, size_t len)
+{
+	#ifdef VDP_SANITY
+	if (offset >= COLOURS || (offset + len) > COLOURS)
+	{
+		puts("VDP_QueueCRAM: Out-of-bounds");
+		return;
+	}
+	#endif
+	if (vdp_hint_line >= 0)
+	{
+		VDP_SetLineCRAM(vdp_hint_line, offset, data, len);
+		return;
+	}
+	VDP_Queue(VDP_Transfer_CRAM, offset << 1, data, len << 1);
+}
+
+void VDP_FlushQueue()
+{
+	//Take the queue first so the writes below don't see it
+	size_t num = vdp_queue_num;
+	vdp_queue_num = 0;
+	
+	uint8_t *vram_p = vdp_vram_p;
+	uint16_t *cram_p = vdp_cram_p;
+	
+	for (size_t i = 0; i < num; i++)
+	{
+		const struct VDP_Transfer *transfer = &vdp_queue[i];
+		switch (transfer->kind)
+		{
+			case VDP_Transfer_VRAM:
+				VDP_SeekVRAM(transfer->offset);
+				VDP_WriteVRAM((const uint8_t*)transfer->data, transfer->len);
+				break;
+			case VDP_Transfer_CRAM:
+				VDP_SeekCRAM(transfer->offset >> 1);
+				VDP_WriteCRAM((const uint16_t*)transfer->data, transfer->len >> 1);
+				break;
+		}
+		vdp_transfer_bytes += transfer->len;
+	}
+	vdp_transfer_count += num;
+	
+	vdp_vram_p = vram_p;
+	vdp_cram_p = cram_p;
 }
 
 void VDP_SetPlaneALocation(size_t loc)
@@ -156,7 +601,7 @@ void VDP_SetPlaneALocation(size_t loc)
 		return;
 	}
 	#endif
-	vdp_plane_a_location = loc;
+	vdp_reg_live.plane_a_location = loc;
 }
 
 void VDP_SetPlaneBLocation(size_t loc)
@@ -169,7 +614,7 @@ void VDP_SetPlaneBLocation(size_t loc)
 		return;
 	}
 	#endif
-	vdp_plane_b_location = loc;
+	vdp_reg_live.plane_b_location = loc;
 }
 
 void VDP_SetSpriteLocation(size_t loc)
@@ -182,7 +627,7 @@ void VDP_SetSpriteLocation(size_t loc)
 		return;
 	}
 	#endif
-	vdp_sprite_location = loc;
+	vdp_reg_live.sprite_location = loc;
 }
 
 void VDP_SetHScrollLocation(size_t loc)
@@ -195,7 +640,7 @@ void VDP_SetHScrollLocation(size_t loc)
 		return;
 	}
 	#endif
-	vdp_hscroll_location = loc;
+	vdp_reg_live.hscroll_location = loc;
 }
 
 void VDP_SetPlaneSize(size_t w, size_t h)
@@ -207,8 +652,8 @@ void VDP_SetPlaneSize(size_t w, size_t h)
 		return;
 	}
 	#endif
-	vdp_plane_w = w;
-	vdp_plane_h = h;
+	vdp_reg_live.plane_w = w;
+	vdp_reg_live.plane_h = h;
 }
 
 void VDP_SetBackgroundColour(uint8_t index)
@@ -220,39 +665,199 @@ void VDP_SetBackgroundColour(uint8_t index)
 		return;
 	}
 	#endif
-	vdp_background_colour = index;
+	if (vdp_hint_line >= 0)
+	{
+		VDP_SetLineBackgroundColour(vdp_hint_line, index);
+		return;
+	}
+	vdp_reg_live.background_colour = index;
 }
 
 void VDP_SetVScroll(int16_t scroll_a, int16_t scroll_b)
 {
-	vdp_vscroll_a = scroll_a;
-	vdp_vscroll_b = scroll_b;
+	if (vdp_hint_line >= 0)
+	{
+		VDP_SetLineVScroll(vdp_hint_line, scroll_a, scroll_b);
+		return;
+	}
+	vdp_reg_live.vscroll_a = scroll_a;
+	vdp_reg_live.vscroll_b = scroll_b;
 }
 
 void VDP_SetHIntPosition(int16_t pos)
 {
-	vdp_hint_pos = pos;
+	vdp_reg_live.hint_pos = pos;
+}
+
+//Adds a line event to the next frame's timeline, keeping it sorted by line (events on the same line stay in order)
+static struct VDP_LineEvent *VDP_AddLineEvent(int16_t line, VDP_LineEventKind kind)
+{
+	//Events past the bottom of the screen would never be reached
+	if (line >= SCREEN_HEIGHT)
+		return NULL;
+	if (line < 0)
+		line = 0;
+	
+	struct VDP_Timeline *timeline = &vdp_timeline_live;
+	if (timeline->events >= VDP_LINE_EVENTS)
+	{
+		puts("VDP_AddLineEvent: Too many line events");
+		return NULL;
+	}
+	
+	size_t i = timeline->events++;
+	for (; i > 0 && timeline->event[i - 1].line > line; i--)
+		timeline->event[i] = timeline->event[i - 1];
+	
+	struct VDP_LineEvent *event = &timeline->event[i];
+	event->line = line;
+	event->kind = kind;
+	return event;
+}
+
+void VDP_SetLineCRAM(int16_t line, size_t offset, const uint16_t *data, size_t len)
+{
+	#ifdef VDP_SANITY
+	if (offset >= COLOURS || (offset + len) > COLOURS)
+	{
+		puts("VDP_SetLineCRAM: Out-of-bounds");
+		return;
+	}
+	#endif
+	struct VDP_Timeline *timeline = &vdp_timeline_live;
+	if (timeline->data_len + len > VDP_LINE_EVENT_DATA)
+	{
+		puts("VDP_SetLineCRAM: Too much CRAM data for one frame");
+		return;
+	}
+	
+	struct VDP_LineEvent *event = VDP_AddLineEvent(line, VDP_LineEvent_CRAM);
+	if (event == NULL)
+		return;
+	event->index = offset;
+	event->len = len;
+	event->data = timeline->data_len;
+	memcpy(timeline->data + timeline->data_len, data, len << 1);
+	timeline->data_len += len;
+}
+
+void VDP_SetLineVScroll(int16_t line, int16_t scroll_a, int16_t scroll_b)
+{
+	struct VDP_LineEvent *event = VDP_AddLineEvent(line, VDP_LineEvent_VScroll);
+	if (event == NULL)
+		return;
+	event->vscroll[0] = scroll_a;
+	event->vscroll[1] = scroll_b;
+}
+
+void VDP_SetLineBackgroundColour(int16_t line, uint8_t index)
+{
+	#ifdef VDP_SANITY
+	if (index >= COLOURS)
+	{
+		puts("VDP_SetLineBackgroundColour: Illegal colour index");
+		return;
+	}
+	#endif
+	struct VDP_LineEvent *event = VDP_AddLineEvent(line, VDP_LineEvent_BackgroundColour);
+	if (event == NULL)
+		return;
+	event->index = index;
+}
+
+//Adds a test pattern of line events to the current frame, written the way a horizontal interrupt would write them
+//(lets headless and verification runs exercise mid-frame changes, the game itself doesn't make any)
+static void VDP_LineTest()
+{
+	uint16_t *cram_p = vdp_cram_p;
+	uint16_t cram[COLOURS];
+	memcpy(cram, vdp_cram_live, sizeof(cram));
+	
+	//Shift plane A over a band of lines, by an amount that changes every frame
+	vdp_hint_line = 64;
+	VDP_SetVScroll(vdp_reg.vscroll_a + (vdp_skip.frames & 0x1F), vdp_reg.vscroll_b);
+	vdp_hint_line = 96;
+	VDP_SetVScroll(vdp_reg.vscroll_a, vdp_reg.vscroll_b);
+	
+	//Swap the palettes around and change the backdrop for another band, then put them back
+	vdp_hint_line = 128;
+	VDP_SeekCRAM(0);
+	VDP_WriteCRAM(cram + 32, 32);
+	VDP_WriteCRAM(cram, 32);
+	VDP_SetBackgroundColour(0x3F - vdp_reg.background_colour);
+	vdp_hint_line = 160;
+	VDP_SeekCRAM(0x10);
+	VDP_FillCRAM(cram[0x10], 16);
+	vdp_hint_line = 192;
+	VDP_SeekCRAM(0);
+	VDP_WriteCRAM(cram, COLOURS);
+	VDP_SetBackgroundColour(vdp_reg.background_colour);
+	
+	vdp_hint_line = -1;
+	vdp_cram_p = cram_p;
 }
 
 //VDP rendering
-#define SCREEN_PITCH SCREEN_WIDTH + (VDP_INTERNAL_PAD * 2)
+#define SCREEN_PITCH (SCREEN_WIDTH + (VDP_INTERNAL_PAD * 2))
 
 #define SCANLINE_SPRITES 40
+#define FRAME_SPRITES    80
 
-static uint32_t vdp_screen_internal[SCREEN_HEIGHT][SCREEN_PITCH];
-static uint8_t vdp_mask_internal[SCREEN_HEIGHT][SCREEN_PITCH];
+static uint32_t vdp_screen_internal[SCREEN_HEIGHT][SCREEN_PITCH]; //Resolved colours
+static uint8_t vdp_pixel_internal[SCREEN_HEIGHT][SCREEN_PITCH];   //Colour indices and mask bits
 
 static uint32_t *vdp_screen;
-static uint8_t *vdp_mask;
+static uint8_t *vdp_pixel;
+
+static uint32_t vdp_colour_lut[0x200];
 
-static uint32_t vdp_screen_pal[4][16];
+static struct VDP_Palette
+{
+	uint16_t cram[4][16];
+	uint32_t colour[4][16];
+	uint32_t gen;
+} vdp_palette[VDP_PALETTES];
+
+static struct VDP_Palette *vdp_palette_cur; //Palette converted from the current CRAM
+static size_t vdp_palette_next;             //Palette to convert into next
+
+static struct VDP_Sprite
+{
+	int16_t left, top;
+	uint16_t pattern;
+	uint8_t width, height; //In tiles, minus 1
+	uint8_t palette, and;
+	uint8_t x_flip, y_flip;
+} vdp_sprites[FRAME_SPRITES];
 
-static struct VDP_SpriteCache
+static struct VDP_SpriteBin
 {
-	const uint16_t *sprite[SCANLINE_SPRITES];
+	uint8_t sprite[SCANLINE_SPRITES];
 	uint8_t pushind;
 	uint16_t pixels;
-} vdp_sprite_cache[SCREEN_HEIGHT];
+} vdp_sprite_bin[SCREEN_HEIGHT];
+
+static int vdp_sprite_bin_top, vdp_sprite_bin_bottom; //Lines that hold sprites
+
+static void VDP_InitScreen()
+{
+	//Get VDP screen pointers
+	vdp_screen = &vdp_screen_internal[0][VDP_INTERNAL_PAD];
+	vdp_pixel = &vdp_pixel_internal[0][VDP_INTERNAL_PAD];
+}
+
+static void VDP_InitColourLUT()
+{
+	//Convert every possible 9-bit CRAM colour to RGBA
+	static const uint8_t col_level[] = {0, 52, 87, 116, 144, 172, 206, 255};
+	for (size_t i = 0; i < 0x200; i++)
+	{
+		uint8_t r = (i >> 0) & 7;
+		uint8_t g = (i >> 3) & 7;
+		uint8_t b = (i >> 6) & 7;
+		vdp_colour_lut[i] = (col_level[r] << 24) | (col_level[g] << 16) | (col_level[b] << 8) | 0xFF;
+	}
+}
 
 static inline uint32_t VDP_GetColour(size_t index)
 {
@@ -265,84 +870,532 @@ static inline uint32_t VDP_GetColour(size_t index)
 	#endif
 	
 	uint16_t cv = vdp_cram[index >> 4][index & 0xF];
-	uint8_t r = (cv & 0x00E) >> 1;
-	uint8_t g = (cv & 0x0E0) >> 5;
-	uint8_t b = (cv & 0xE00) >> 9;
-	
-	static const uint8_t col_level[] = {0, 52, 87, 116, 144, 172, 206, 255};
-	return (col_level[r] << 24) | (col_level[g] << 16) | (col_level[b] << 8) | 0xFF;
+	return vdp_colour_lut[((cv & 0x00E) >> 1) | ((cv & 0x0E0) >> 2) | ((cv & 0xE00) >> 3)];
 }
 
-static inline uint8_t *VDP_GetPatternAddress(size_t pattern)
+static inline const struct VDP_Pattern *VDP_GetPattern(size_t pattern)
 {
 	#ifdef VDP_SANITY
-	if (pattern >= (VRAM_SIZE >> 5))
+	if (pattern >= PATTERNS)
 	{
-		puts("VDP_GetPatternAddress: Out-of-bounds");
-		return vdp_vram;
+		puts("VDP_GetPattern: Out-of-bounds");
+		return vdp_pattern_cache;
 	}
 	#endif
 	
-	return vdp_vram + (pattern << 5);
+	return &vdp_pattern_cache[pattern];
 }
 
-#define WRITE_NIBBLE(from, to, tom, pal, and, or, nibs) \
-{                                             \
-	uint8_t v = (*from >> nibs) & 0xF;        \
-	if (v != 0)                               \
-	{                                         \
-		if (*tom & and)                       \
-		{                                     \
-			*tom |= or;                       \
-			to++;                             \
-		}                                     \
-		else                                  \
-		{                                     \
-			*tom |= or;                       \
-			*to++ = vdp_screen_pal[(pal)][v]; \
-		}                                     \
-		tom++;                                \
-	}                                         \
-	else                                      \
-	{                                         \
-		to++;                                 \
-		tom++;                                \
-	}                                         \
+#define WRITE_ROW(pattern, y, x_flip, to, pal, and, or)                       \
+{                                                                             \
+	if (!((pattern)->empty & (1 << (y))))                                     \
+		vdp_kernels->row(to, (pattern)->row[x_flip][y], (pal) << 4, and, or); \
+	to += 8;                                                                  \
 }
 
-#define WRITE_BYTE(from, to, tom, pal, and, or)  \
-{                                                \
-	WRITE_NIBBLE(from, to, tom, pal, and, or, 4) \
-	WRITE_NIBBLE(from, to, tom, pal, and, or, 0) \
-	from++;                                      \
-}
+//VDP plane bitmaps
+//Both planes are kept fully drawn, only the cells whose nametable entry or pattern changed are redrawn each frame
+#define PLANE_TILES (PLANE_SIZE >> 1)
 
-#define WRITE_BYTE_FLIP(from, to, tom, pal, and, or) \
-{                                                \
-	WRITE_NIBBLE(from, to, tom, pal, and, or, 0) \
-	WRITE_NIBBLE(from, to, tom, pal, and, or, 4) \
-	from--;                                      \
-}
+static struct VDP_PlaneCache
+{
+	bool valid;
+	size_t location, w, h;                   //Plane the bitmap was drawn from
+	uint8_t pixel[PLANE_TILES << 6];         //'palette | v | priority' pixels, 0 where transparent
+	uint32_t cell_changed[PLANE_TILES / 32]; //Cells redrawn for the current frame
+} vdp_plane_cache_a, vdp_plane_cache_b;
 
-static inline void VDP_DrawPlaneRow(uint32_t *to, uint8_t *tom, const uint16_t *plane, int16_t x, int16_t y)
+static void VDP_DrawPlaneCell(struct VDP_PlaneCache *cache, size_t px, size_t py, uint16_t tile)
 {
-	//Get plane tile to use
-	size_t px = (x >> 3) % vdp_plane_w;
-	size_t py = (y >> 3) % vdp_plane_h;
-	const uint16_t *pb = plane + py * vdp_plane_w;
+	//Get tile information
+	const struct VDP_Pattern *pattern = VDP_GetPattern((tile & TILE_PATTERN_AND) >> TILE_PATTERN_SHIFT);
+	uint8_t or = ((tile & TILE_PRIORITY_AND) ? VDP_MASK_PLANEPRI : 0) | (((tile & TILE_PALETTE_AND) >> TILE_PALETTE_SHIFT) << 4);
+	uint8_t y_flip = (tile & TILE_Y_FLIP_AND) ? 7 : 0;
+	uint8_t x_flip = (tile & TILE_X_FLIP_AND) != 0;
 	
-	//Draw plane row
-	uint32_t *toend = to + SCREEN_WIDTH;
-	to -= x & 7;
-	tom -= x & 7;
-	y &= 7;
+	//Write cell
+	size_t pitch = cache->w << 3;
+	uint8_t *to = cache->pixel + (py << 3) * pitch + (px << 3);
+	for (size_t y = 0; y < 8; y++, to += pitch)
+	{
+		const uint8_t *from = pattern->row[x_flip][y ^ y_flip];
+		for (size_t x = 0; x < 8; x++)
+			to[x] = from[x] ? (from[x] | or) : 0;
+	}
+}
+
+//Plane row a line was drawn from, consecutive lines that scroll the same way and land on the same row of tiles share its changed check
+struct VDP_PlaneRow
+{
+	bool valid;
+	size_t py;
+	int16_t x;
+	int8_t changed; //If any of the row's visible cells were redrawn, -1 if not checked yet
+};
+
+static inline struct VDP_PlaneRow *VDP_GetPlaneRow(struct VDP_PlaneRow *row, int16_t x, int16_t y)
+{
+	//Reuse the row if it's the same as the previous line's
+	size_t py = (y >> 3) % vdp_reg.plane_h;
+	if (row->valid && row->py == py && row->x == x)
+		return row;
+	
+	row->valid = true;
+	row->py = py;
+	row->x = x;
+	row->changed = -1;
+	return row;
+}
+
+static inline void VDP_DrawPlaneRow(uint8_t *to, const struct VDP_PlaneCache *cache, int16_t x, int16_t y)
+{
+	//Get bitmap row and position
+	size_t width = cache->w << 3;
+	size_t px = x % width;
+	const uint8_t *from = cache->pixel + (y % (cache->h << 3)) * width;
+	
+	//Draw plane row, wrapping around the bitmap
+	for (size_t done = 0; done < SCREEN_WIDTH; px = 0)
+	{
+		size_t run = width - px;
+		if (run > SCREEN_WIDTH - done)
+			run = SCREEN_WIDTH - done;
+		vdp_kernels->span(to + done, from + px, run, VDP_MASK_PLANEPRI);
+		done += run;
+	}
+}
+
+static inline void VDP_DrawSpriteRow(uint8_t *to, const struct VDP_Sprite *sprite, int16_t y)
+{
+	//Get sprite left and right coordinates
+	int16_t left = sprite->left;
+	int16_t right = left + ((sprite->width + 1) << 3);
+	if (right <= 0 || left >= SCREEN_WIDTH)
+		return;
+	to += left;
+	
+	uint8_t palette = sprite->palette;
+	uint8_t and = sprite->and;
+	uint8_t height = sprite->height;
+	uint16_t pattern = sprite->pattern;
+	
+	//Get Y tile
+	y -= sprite->top;
+	size_t ty = y >> 3;
+	if (sprite->y_flip)
+	{
+		ty = height - ty;
+		y = (y & 7) ^ 7;
+	}
+	else
+	{
+		y &= 7;
+	}
+	pattern += ty;
+	
+	//Get X tile
+	if (sprite->x_flip)
+	{
+		pattern += sprite->width * (height + 1);
+		for (; left < right; left += 8)
+		{
+			//Write tile
+			const struct VDP_Pattern *pat = VDP_GetPattern(pattern);
+			WRITE_ROW(pat, y, 1, to, palette, and, VDP_MASK_SPRITE)
+			pattern -= height + 1;
+		}
+	}
+	else
+	{
+		for (; left < right; left += 8)
+		{
+			//Write tile
+			const struct VDP_Pattern *pat = VDP_GetPattern(pattern);
+			WRITE_ROW(pat, y, 0, to, palette, and, VDP_MASK_SPRITE)
+			pattern += height + 1;
+		}
+	}
+}
+
+static inline void VDP_DrawScanline(size_t y, uint8_t *to, const struct VDP_SpriteBin *bin, const int16_t *hscroll)
+{
+	//Clear scanline
+	memset(to, vdp_reg.background_colour, SCREEN_WIDTH);
+	
+	//Draw planes
+	VDP_DrawPlaneRow(to, &vdp_plane_cache_b, -hscroll[1], y + vdp_reg.vscroll_b);
+	VDP_DrawPlaneRow(to, &vdp_plane_cache_a, -hscroll[0], y + vdp_reg.vscroll_a);
+	
+	//Draw sprites
+	for (uint8_t i = 0; i < bin->pushind; i++)
+		VDP_DrawSpriteRow(to, &vdp_sprites[bin->sprite[i]], y);
 	
-	for (; to < toend; px = (px + 1) % vdp_plane_w, plane++)
+	#ifdef VDP_PALETTE_DISPLAY
+		for (size_t i = 0; i < 4 * 16; i++)
+			to[i] = i;
+	#endif
+}
+
+static uint32_t vdp_palette_gen;
+
+static inline void VDP_RefreshPalette()
+{
+	//Only rebuild the palette if CRAM has changed
+	if (!vdp_cram_dirty)
+		return;
+	vdp_cram_dirty = false;
+	
+	//Reuse a palette that's already been converted from this CRAM
+	for (size_t i = 0; i < VDP_PALETTES; i++)
+	{
+		if (vdp_palette[i].gen != 0 && memcmp(vdp_palette[i].cram, vdp_cram, sizeof(vdp_cram)) == 0)
+		{
+			vdp_palette_cur = &vdp_palette[i];
+			return;
+		}
+	}
+	
+	//Convert CRAM into the oldest palette
+	struct VDP_Palette *palette = &vdp_palette[vdp_palette_next];
+	vdp_palette_next = (vdp_palette_next + 1) % VDP_PALETTES;
+	memcpy(palette->cram, vdp_cram, sizeof(vdp_cram));
+	palette->gen = ++vdp_palette_gen;
+	
+	uint32_t *pal_to = &palette->colour[0][0];
+	for (size_t i = 0; i < 4 * 16; i++)
+		*pal_to++ = VDP_GetColour(i);
+	vdp_palette_cur = palette;
+}
+
+//VDP line tracking
+static uint32_t vdp_vram_changed[PATTERNS / 32]; //VRAM blocks (32 bytes each) changed since the previous frame
+
+#define VDP_VRAM_CHANGED(block) ((vdp_vram_changed[(block) >> 5] >> ((block) & 31)) & 1)
+
+static struct VDP_LineState
+{
+	bool valid;
+	uint32_t palette_gen;
+	int16_t hscroll[2], vscroll[2];
+	uint8_t background_colour;
+	uint8_t sprites;
+	struct VDP_Sprite sprite[SCANLINE_SPRITES];
+} vdp_line_state[SCREEN_HEIGHT];
+
+static struct VDP_FrameState
+{
+	size_t plane_a_location, plane_b_location;
+	size_t plane_w, plane_h;
+} vdp_frame_state;
+
+static void VDP_RefreshFrameState()
+{
+	//Get the state that applies to the whole frame
+	struct VDP_FrameState state;
+	memset(&state, 0, sizeof(state));
+	state.plane_a_location = vdp_reg.plane_a_location;
+	state.plane_b_location = vdp_reg.plane_b_location;
+	state.plane_w = vdp_reg.plane_w;
+	state.plane_h = vdp_reg.plane_h;
+	
+	//Redraw every line if it's changed
+	if (memcmp(&state, &vdp_frame_state, sizeof(state)) != 0)
+	{
+		vdp_frame_state = state;
+		for (size_t i = 0; i < SCREEN_HEIGHT; i++)
+			vdp_line_state[i].valid = false;
+	}
+}
+
+static void VDP_RefreshPlaneCache(struct VDP_PlaneCache *cache, size_t location)
+{
+	//Redraw the whole plane if it's been moved or resized
+	bool all = !cache->valid || cache->location != location || cache->w != vdp_reg.plane_w || cache->h != vdp_reg.plane_h;
+	cache->valid = true;
+	cache->location = location;
+	cache->w = vdp_reg.plane_w;
+	cache->h = vdp_reg.plane_h;
+	memset(cache->cell_changed, 0, sizeof(cache->cell_changed));
+	
+	//Redraw the cells whose nametable entry or pattern changed
+	const uint16_t *plane = (const uint16_t*)(vdp_vram + location);
+	size_t cells = cache->w * cache->h;
+	for (size_t i = 0; i < cells; i++)
+	{
+		uint16_t tile = plane[i];
+		if (!all && !VDP_VRAM_CHANGED((location + (i << 1)) >> 5) && !VDP_VRAM_CHANGED((tile & TILE_PATTERN_AND) >> TILE_PATTERN_SHIFT))
+			continue;
+		VDP_DrawPlaneCell(cache, i % cache->w, i / cache->w, tile);
+		cache->cell_changed[i >> 5] |= 1UL << (i & 31);
+	}
+}
+
+static bool VDP_PlaneRowChanged(const struct VDP_PlaneCache *cache, struct VDP_PlaneRow *row)
+{
+	//Lines sharing the row share the result
+	if (row->changed >= 0)
+		return row->changed;
+	
+	//Check the cells that the visible part of the row uses
+	size_t px = (row->x >> 3) % cache->w;
+	size_t at = row->py * cache->w;
+	for (int x_at = -(row->x & 7); x_at < SCREEN_WIDTH; x_at += 8, px = (px + 1) % cache->w)
+	{
+		if ((cache->cell_changed[(at + px) >> 5] >> ((at + px) & 31)) & 1)
+		{
+			row->changed = 1;
+			return true;
+		}
+	}
+	
+	row->changed = 0;
+	return false;
+}
+
+static bool VDP_SpriteRowChanged(const struct VDP_Sprite *sprite, int16_t y)
+{
+	//Check the patterns that this row of the sprite uses
+	size_t ty = (y - sprite->top) >> 3;
+	if (sprite->y_flip)
+		ty = sprite->height - ty;
+	
+	for (size_t i = 0; i <= sprite->width; i++)
+	{
+		size_t at = sprite->pattern + ty + i * (sprite->height + 1);
+		if (at >= PATTERNS || VDP_VRAM_CHANGED(at))
+			return true;
+	}
+	return false;
+}
+
+static bool VDP_LineChanged(size_t y, const struct VDP_LineState *state, const struct VDP_SpriteBin *bin, const int16_t *hscroll, struct VDP_PlaneRow *row_b, struct VDP_PlaneRow *row_a)
+{
+	//Check line inputs against the previous frame
+	if (!state->valid || state->hscroll[0] != hscroll[0] || state->hscroll[1] != hscroll[1] || state->sprites != bin->pushind)
+		return true;
+	if (state->vscroll[0] != vdp_reg.vscroll_a || state->vscroll[1] != vdp_reg.vscroll_b || state->background_colour != vdp_reg.background_colour)
+		return true;
+	for (uint8_t i = 0; i < bin->pushind; i++)
+		if (memcmp(&state->sprite[i], &vdp_sprites[bin->sprite[i]], sizeof(state->sprite[i])) != 0)
+			return true;
+	
+	//Check the VRAM that the line uses
+	if (VDP_PlaneRowChanged(&vdp_plane_cache_b, row_b) || VDP_PlaneRowChanged(&vdp_plane_cache_a, row_a))
+		return true;
+	for (uint8_t i = 0; i < bin->pushind; i++)
+		if (VDP_SpriteRowChanged(&vdp_sprites[bin->sprite[i]], y))
+			return true;
+	return false;
+}
+
+static void VDP_DrawLines(size_t y, size_t y_end)
+{
+	uint32_t *out = vdp_screen + y * SCREEN_PITCH;
+	uint8_t *to = vdp_pixel + y * SCREEN_PITCH;
+	const struct VDP_SpriteBin *bin = &vdp_sprite_bin[y];
+	struct VDP_LineState *state = &vdp_line_state[y];
+	const int16_t *hscroll = (int16_t*)(vdp_vram + vdp_reg.hscroll_location) + (y << 1);
+	
+	//Plane rows, runs of lines with the same scroll values share them
+	struct VDP_PlaneRow rows[2];
+	memset(rows, 0, sizeof(rows));
+	
+	for (; y < y_end; y++, bin++, state++, hscroll += 2, out += SCREEN_PITCH, to += SCREEN_PITCH)
+	{
+		struct VDP_PlaneRow *row_b = VDP_GetPlaneRow(&rows[0], -hscroll[1], y + vdp_reg.vscroll_b);
+		struct VDP_PlaneRow *row_a = VDP_GetPlaneRow(&rows[1], -hscroll[0], y + vdp_reg.vscroll_a);
+		
+		if (VDP_LineChanged(y, state, bin, hscroll, row_b, row_a))
+		{
+			//Draw line and remember what it was drawn from
+			VDP_DrawScanline(y, to, bin, hscroll);
+			
+			state->valid = true;
+			state->hscroll[0] = hscroll[0];
+			state->hscroll[1] = hscroll[1];
+			state->vscroll[0] = vdp_reg.vscroll_a;
+			state->vscroll[1] = vdp_reg.vscroll_b;
+			state->background_colour = vdp_reg.background_colour;
+			state->sprites = bin->pushind;
+			for (uint8_t i = 0; i < bin->pushind; i++)
+				state->sprite[i] = vdp_sprites[bin->sprite[i]];
+		}
+		else if (state->palette_gen == vdp_palette_cur->gen)
+		{
+			//Line is identical to the previous frame's
+			continue;
+		}
+		
+		//Resolve colours
+		state->palette_gen = vdp_palette_cur->gen;
+		vdp_kernels->resolve(out, to, &vdp_palette_cur->colour[0][0], SCREEN_WIDTH);
+	}
+}
+
+static void VDP_BinSprites()
+{
+	//Clear the lines that were binned last frame
+	for (int v = vdp_sprite_bin_top; v < vdp_sprite_bin_bottom; v++)
+	{
+		vdp_sprite_bin[v].pushind = 0;
+		vdp_sprite_bin[v].pixels = 0;
+	}
+	vdp_sprite_bin_top = SCREEN_HEIGHT;
+	vdp_sprite_bin_bottom = 0;
+	
+	//Walk the sprite link list, stopping after as many sprites as the VDP can hold in case of a link loop
+	uint8_t i = 0;
+	for (uint8_t n = 0; n < FRAME_SPRITES; n++)
+	{
+		//Decode sprite
+		const uint16_t *sprite_raw = (const uint16_t*)(vdp_vram + vdp_reg.sprite_location + (i << 3));
+		uint16_t sprite_y = sprite_raw[0];
+		uint16_t sprite_sl = sprite_raw[1];
+		uint16_t sprite_tile = sprite_raw[2];
+		uint16_t sprite_x = sprite_raw[3];
+		uint8_t sprite_link = (sprite_sl & SPRITE_SL_L_AND) >> SPRITE_SL_L_SHIFT;
+		
+		struct VDP_Sprite *sprite = &vdp_sprites[n];
+		sprite->left = sprite_x - 128;
+		sprite->top = sprite_y - 128;
+		sprite->pattern = (sprite_tile & TILE_PATTERN_AND) >> TILE_PATTERN_SHIFT;
+		sprite->width = (sprite_sl & SPRITE_SL_W_AND) >> SPRITE_SL_W_SHIFT;
+		sprite->height = (sprite_sl & SPRITE_SL_H_AND) >> SPRITE_SL_H_SHIFT;
+		sprite->palette = (sprite_tile & TILE_PALETTE_AND) >> TILE_PALETTE_SHIFT;
+		sprite->and = (sprite_tile & TILE_PRIORITY_AND) ? VDP_MASK_SPRITE : (VDP_MASK_PLANEPRI | VDP_MASK_SPRITE);
+		sprite->x_flip = (sprite_tile & TILE_X_FLIP_AND) != 0;
+		sprite->y_flip = (sprite_tile & TILE_Y_FLIP_AND) != 0;
+		
+		//Get sprite bounding area
+		int top = sprite->top;
+		int bottom = top + ((sprite->height + 1) << 3);
+		if (top < 0)
+			top = 0;
+		if (bottom > SCREEN_HEIGHT)
+			bottom = SCREEN_HEIGHT;
+		
+		//Write sprite bins
+		if (top < bottom)
+		{
+			if (top < vdp_sprite_bin_top)
+				vdp_sprite_bin_top = top;
+			if (bottom > vdp_sprite_bin_bottom)
+				vdp_sprite_bin_bottom = bottom;
+		}
+		
+		for (int v = top; v < bottom; v++)
+		{
+			struct VDP_SpriteBin *bin = &vdp_sprite_bin[v];
+			bin->pixels += sprite->width + 1;
+			if (bin->pixels <= SCANLINE_SPRITES)
+				bin->sprite[bin->pushind++] = n;
+		}
+		
+		//Go to next sprite
+		if (sprite_link != 0)
+			i = sprite_link;
+		else
+			break;
+	}
+}
+
+//Prepares the fast renderer's caches for a new frame
+static void VDP_RefreshCaches()
+{
+	VDP_BinSprites();
+	VDP_RefreshFrameState();
+	memset(vdp_vram_changed, 0, sizeof(vdp_vram_changed));
+	VDP_RefreshPatterns(vdp_vram_changed);
+	VDP_RefreshPlaneCache(&vdp_plane_cache_b, vdp_reg.plane_b_location);
+	VDP_RefreshPlaneCache(&vdp_plane_cache_a, vdp_reg.plane_a_location);
+}
+
+//VDP reference renderer
+//The original per-pixel renderer, it walks the sprite list and converts CRAM itself and writes colours straight out, for checking the fast renderer against
+#define REF_WRITE_NIBBLE(from, to, tom, pal, and, or, nibs) \
+{                                             \
+	uint8_t v = (*from >> nibs) & 0xF;        \
+	if (v != 0)                               \
+	{                                         \
+		if (*tom & and)                       \
+		{                                     \
+			*tom |= or;                       \
+			to++;                             \
+		}                                     \
+		else                                  \
+		{                                     \
+			*tom |= or;                       \
+			*to++ = pal[v];                   \
+		}                                     \
+		tom++;                                \
+	}                                         \
+	else                                      \
+	{                                         \
+		to++;                                 \
+		tom++;                                \
+	}                                         \
+}
+
+#define REF_WRITE_BYTE(from, to, tom, pal, and, or)  \
+{                                                    \
+	REF_WRITE_NIBBLE(from, to, tom, pal, and, or, 4) \
+	REF_WRITE_NIBBLE(from, to, tom, pal, and, or, 0) \
+	from++;                                          \
+}
+
+#define REF_WRITE_BYTE_FLIP(from, to, tom, pal, and, or) \
+{                                                    \
+	REF_WRITE_NIBBLE(from, to, tom, pal, and, or, 0) \
+	REF_WRITE_NIBBLE(from, to, tom, pal, and, or, 4) \
+	from--;                                          \
+}
+
+static inline const uint8_t *VDP_ReferencePatternAddress(size_t pattern)
+{
+	#ifdef VDP_SANITY
+	if (pattern >= PATTERNS)
+	{
+		puts("VDP_ReferencePatternAddress: Out-of-bounds");
+		return vdp_vram;
+	}
+	#endif
+	
+	return vdp_vram + (pattern << 5);
+}
+
+static void VDP_ReferencePalette(uint32_t pal[4][16])
+{
+	static const uint8_t col_level[] = {0, 52, 87, 116, 144, 172, 206, 255};
+	for (size_t i = 0; i < 4 * 16; i++)
+	{
+		uint16_t cv = vdp_cram[i >> 4][i & 0xF];
+		uint8_t r = (cv & 0x00E) >> 1;
+		uint8_t g = (cv & 0x0E0) >> 5;
+		uint8_t b = (cv & 0xE00) >> 9;
+		pal[i >> 4][i & 0xF] = (col_level[r] << 24) | (col_level[g] << 16) | (col_level[b] << 8) | 0xFF;
+	}
+}
+
+static void VDP_ReferencePlaneRow(uint32_t *to, uint8_t *tom, uint32_t pal[4][16], size_t location, int16_t x, int16_t y)
+{
+	//Get plane tile to use
+	const uint16_t *plane = (const uint16_t*)(vdp_vram + location);
+	size_t px = (x >> 3) % vdp_reg.plane_w;
+	size_t py = (y >> 3) % vdp_reg.plane_h;
+	const uint16_t *pb = plane + py * vdp_reg.plane_w;
+	
+	//Draw plane row
+	uint32_t *toend = to + SCREEN_WIDTH;
+	to -= x & 7;
+	tom -= x & 7;
+	y &= 7;
+	
+	for (; to < toend; px = (px + 1) % vdp_reg.plane_w)
 	{
 		//Get tile information
 		const uint16_t tile = pb[px];
 		uint8_t or = (tile & TILE_PRIORITY_AND) ? VDP_MASK_PLANEPRI : 0;
-		uint8_t palette = (tile & TILE_PALETTE_AND) >> TILE_PALETTE_SHIFT;
+		const uint32_t *palette = pal[(tile & TILE_PALETTE_AND) >> TILE_PALETTE_SHIFT];
 		uint8_t y_flip = (tile & TILE_Y_FLIP_AND) != 0;
 		uint8_t x_flip = (tile & TILE_X_FLIP_AND) != 0;
 		uint16_t pattern = (tile & TILE_PATTERN_AND) >> TILE_PATTERN_SHIFT;
@@ -350,28 +1403,28 @@ static inline void VDP_DrawPlaneRow(uint32_t *to, uint8_t *tom, const uint16_t *
 		//Write tile
 		const uint8_t *from;
 		if (y_flip)
-			from = VDP_GetPatternAddress(pattern) + ((y ^ 7) << 2);
+			from = VDP_ReferencePatternAddress(pattern) + ((y ^ 7) << 2);
 		else
-			from = VDP_GetPatternAddress(pattern) + (y << 2);
+			from = VDP_ReferencePatternAddress(pattern) + (y << 2);
 		if (x_flip)
 		{
 			from += 3;
-			WRITE_BYTE_FLIP(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
-			WRITE_BYTE_FLIP(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
-			WRITE_BYTE_FLIP(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
-			WRITE_BYTE_FLIP(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
+			REF_WRITE_BYTE_FLIP(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
+			REF_WRITE_BYTE_FLIP(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
+			REF_WRITE_BYTE_FLIP(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
+			REF_WRITE_BYTE_FLIP(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
 		}
 		else
 		{
-			WRITE_BYTE(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
-			WRITE_BYTE(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
-			WRITE_BYTE(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
-			WRITE_BYTE(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
+			REF_WRITE_BYTE(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
+			REF_WRITE_BYTE(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
+			REF_WRITE_BYTE(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
+			REF_WRITE_BYTE(from, to, tom, palette, VDP_MASK_PLANEPRI, or)
 		}
 	}
 }
 
-static inline void VDP_DrawSpriteRow(uint32_t *to, uint8_t *tom, const uint16_t *sprite, int16_t y)
+static void VDP_ReferenceSpriteRow(uint32_t *to, uint8_t *tom, uint32_t pal[4][16], const uint16_t *sprite, int16_t y)
 {
 	//Get sprite information
 	uint16_t sprite_y = *sprite++;
@@ -383,7 +1436,7 @@ static inline void VDP_DrawSpriteRow(uint32_t *to, uint8_t *tom, const uint16_t
 	uint8_t height = (sprite_sl & SPRITE_SL_H_AND) >> SPRITE_SL_H_SHIFT;
 	
 	uint8_t and = (sprite_tile & TILE_PRIORITY_AND) ? VDP_MASK_SPRITE : (VDP_MASK_PLANEPRI | VDP_MASK_SPRITE);
-	uint16_t palette = (sprite_tile & TILE_PALETTE_AND) >> TILE_PALETTE_SHIFT;
+	const uint32_t *palette = pal[(sprite_tile & TILE_PALETTE_AND) >> TILE_PALETTE_SHIFT];
 	uint8_t y_flip = (sprite_tile & TILE_Y_FLIP_AND) != 0;
 	uint8_t x_flip = (sprite_tile & TILE_X_FLIP_AND) != 0;
 	uint16_t pattern = (sprite_tile & TILE_PATTERN_AND) >> TILE_PATTERN_SHIFT;
@@ -420,11 +1473,11 @@ static inline void VDP_DrawSpriteRow(uint32_t *to, uint8_t *tom, const uint16_t
 		for (; left < right; left += 8)
 		{
 			//Write tile
-			const uint8_t *from = VDP_GetPatternAddress(pattern) + (y << 2) + 3;
-			WRITE_BYTE_FLIP(from, to, tom, palette, and, VDP_MASK_SPRITE)
-			WRITE_BYTE_FLIP(from, to, tom, palette, and, VDP_MASK_SPRITE)
-			WRITE_BYTE_FLIP(from, to, tom, palette, and, VDP_MASK_SPRITE)
-			WRITE_BYTE_FLIP(from, to, tom, palette, and, VDP_MASK_SPRITE)
+			const uint8_t *from = VDP_ReferencePatternAddress(pattern) + (y << 2) + 3;
+			REF_WRITE_BYTE_FLIP(from, to, tom, palette, and, VDP_MASK_SPRITE)
+			REF_WRITE_BYTE_FLIP(from, to, tom, palette, and, VDP_MASK_SPRITE)
+			REF_WRITE_BYTE_FLIP(from, to, tom, palette, and, VDP_MASK_SPRITE)
+			REF_WRITE_BYTE_FLIP(from, to, tom, palette, and, VDP_MASK_SPRITE)
 			pattern -= height + 1;
 		}
 	}
@@ -433,78 +1486,37 @@ static inline void VDP_DrawSpriteRow(uint32_t *to, uint8_t *tom, const uint16_t
 		for (; left < right; left += 8)
 		{
 			//Write tile
-			const uint8_t *from = VDP_GetPatternAddress(pattern) + (y << 2);
-			WRITE_BYTE(from, to, tom, palette, and, VDP_MASK_SPRITE)
-			WRITE_BYTE(from, to, tom, palette, and, VDP_MASK_SPRITE)
-			WRITE_BYTE(from, to, tom, palette, and, VDP_MASK_SPRITE)
-			WRITE_BYTE(from, to, tom, palette, and, VDP_MASK_SPRITE)
+			const uint8_t *from = VDP_ReferencePatternAddress(pattern) + (y << 2);
+			REF_WRITE_BYTE(from, to, tom, palette, and, VDP_MASK_SPRITE)
+			REF_WRITE_BYTE(from, to, tom, palette, and, VDP_MASK_SPRITE)
+			REF_WRITE_BYTE(from, to, tom, palette, and, VDP_MASK_SPRITE)
+			REF_WRITE_BYTE(from, to, tom, palette, and, VDP_MASK_SPRITE)
 			pattern += height + 1;
 		}
 	}
 }
 
-static inline void VDP_DrawScanline(size_t y, uint32_t *to, uint8_t *tom, struct VDP_SpriteCache *scache, const int16_t *hscroll)
-{
-	//Clear scanline
-	for (size_t i = 0; i < SCREEN_WIDTH; i++)
-		to[i] = vdp_screen_pal[0][vdp_background_colour];
-	memset(tom, 0, SCREEN_WIDTH);
-	
-	//Draw planes
-	VDP_DrawPlaneRow(to, tom, (const uint16_t*)(vdp_vram + vdp_plane_b_location), -hscroll[1], y + vdp_vscroll_b);
-	VDP_DrawPlaneRow(to, tom, (const uint16_t*)(vdp_vram + vdp_plane_a_location), -hscroll[0], y + vdp_vscroll_a);
-	
-	//Draw sprites
-	for (uint8_t i = 0; i < scache->pushind; i++)
-		VDP_DrawSpriteRow(to, tom, scache->sprite[i], y);
-	
-	#ifdef VDP_PALETTE_DISPLAY
-		for (size_t i = 0; i < 4 * 16; i++)
-			to[i] = vdp_screen_pal[i >> 4][i & 0xF];
-	#endif
-}
-
-static inline void VDP_RefreshPalette()
+static void VDP_ReferenceSprites(uint32_t *to, uint8_t *tom, uint32_t pal[4][16], int16_t y)
 {
-	uint32_t *pal_to = &vdp_screen_pal[0][0];
-	for (size_t i = 0; i < 4 * 16; i++)
-		*pal_to++ = VDP_GetColour(i);
-}
-
-void VDP_Render()
-{
-	//Get VDP screen pointer
-	vdp_screen = &vdp_screen_internal[0][VDP_INTERNAL_PAD];
-	vdp_mask = &vdp_mask_internal[0][VDP_INTERNAL_PAD];
-	
-	//Calculate sprite cache
-	memset(vdp_sprite_cache, 0, sizeof(vdp_sprite_cache));
-	
-	for (uint8_t i = 0;;)
+	//Walk the sprite link list, drawing the sprites on this line until the line is full
+	uint16_t pixels = 0;
+	uint8_t i = 0;
+	for (uint8_t n = 0; n < FRAME_SPRITES; n++)
 	{
-		//Get sprite values
-		const uint16_t *sprite = (const uint16_t*)(vdp_vram + vdp_sprite_location + (i << 3));
+		const uint16_t *sprite = (const uint16_t*)(vdp_vram + vdp_reg.sprite_location + (i << 3));
 		uint16_t sprite_y = sprite[0];
 		uint16_t sprite_sl = sprite[1];
 		uint8_t sprite_width = (sprite_sl & SPRITE_SL_W_AND) >> SPRITE_SL_W_SHIFT;
 		uint8_t sprite_height = (sprite_sl & SPRITE_SL_H_AND) >> SPRITE_SL_H_SHIFT;
 		uint8_t sprite_link = (sprite_sl & SPRITE_SL_L_AND) >> SPRITE_SL_L_SHIFT;
 		
-		//Get sprite bounding area
 		int top = sprite_y - 128;
 		int bottom = top + ((sprite_height + 1) << 3);
-		if (top < 0)
-			top = 0;
-		if (bottom > SCREEN_HEIGHT)
-			bottom = SCREEN_HEIGHT;
-		
-		//Write sprite cache
-		for (int v = top; v < bottom; v++)
+		if (y >= top && y < bottom)
 		{
-			struct VDP_SpriteCache *scache = &vdp_sprite_cache[v];
-			scache->pixels += sprite_width + 1;
-			if (scache->pixels <= SCANLINE_SPRITES)
-				scache->sprite[scache->pushind++] = sprite;
+			pixels += sprite_width + 1;
+			if (pixels <= SCANLINE_SPRITES)
+				VDP_ReferenceSpriteRow(to, tom, pal, sprite, y);
 		}
 		
 		//Go to next sprite
@@ -513,45 +1525,659 @@ void VDP_Render()
 		else
 			break;
 	}
+}
+
+static void VDP_ReferenceLines(size_t y, size_t y_end, uint32_t *to)
+{
+	//Convert CRAM as it is for these lines
+	uint32_t pal[4][16];
+	VDP_ReferencePalette(pal);
+	
+	const int16_t *hscroll = (int16_t*)(vdp_vram + vdp_reg.hscroll_location);
+	uint8_t mask[SCREEN_PITCH];
+	uint8_t *tom = &mask[VDP_INTERNAL_PAD];
+	to += y * SCREEN_PITCH;
+	
+	for (; y < y_end; y++, to += SCREEN_PITCH)
+	{
+		//Clear scanline
+		for (size_t i = 0; i < SCREEN_WIDTH; i++)
+			to[i] = pal[vdp_reg.background_colour >> 4][vdp_reg.background_colour & 0xF];
+		memset(mask, 0, sizeof(mask));
+		
+		//Draw planes
+		VDP_ReferencePlaneRow(to, tom, pal, vdp_reg.plane_b_location, -hscroll[(y << 1) | 1], y + vdp_reg.vscroll_b);
+		VDP_ReferencePlaneRow(to, tom, pal, vdp_reg.plane_a_location, -hscroll[(y << 1) | 0], y + vdp_reg.vscroll_a);
+		
+		//Draw sprites
+		VDP_ReferenceSprites(to, tom, pal, y);
+		
+		#ifdef VDP_PALETTE_DISPLAY
+			for (size_t i = 0; i < 4 * 16; i++)
+				to[i] = pal[i >> 4][i & 0xF];
+		#endif
+	}
+}
+
+static void VDP_DrawLinesReference(size_t y, size_t y_end)
+{
+	VDP_ReferenceLines(y, y_end, vdp_screen);
+}
+
+//VDP renderer selection
+static const struct VDP_Renderer
+{
+	const char *name;
+	void (*begin_frame)();
+	void (*draw_lines)(size_t y, size_t y_end);
+} vdp_renderers[] = {
+	{"fast", VDP_RefreshCaches, VDP_DrawLines},
+	{"reference", NULL, VDP_DrawLinesReference},
+};
+
+static const struct VDP_Renderer *vdp_renderer;
+
+//Verification mode, draws every frame with the reference renderer as well and compares them
+static struct
+{
+	bool enable;
+	unsigned long frame;              //Frame being drawn
+	unsigned long frames, mismatches; //Frames verified / frames that differed
+	unsigned long mismatch_frame;     //Last frame that differed
+	uint32_t screen[SCREEN_HEIGHT][SCREEN_PITCH];
+} vdp_verify;
+
+int VDP_SetRenderer(const char *name)
+{
+	//Verification mode uses the fast renderer
+	vdp_verify.enable = strcmp(name, "verify") == 0;
+	if (vdp_verify.enable)
+		name = "fast";
+	
+	for (size_t i = 0; i < sizeof(vdp_renderers) / sizeof(*vdp_renderers); i++)
+	{
+		if (strcmp(name, vdp_renderers[i].name) == 0)
+		{
+			vdp_renderer = &vdp_renderers[i];
+			return 0;
+		}
+	}
 	
-	//Render VDP screen
-	VDP_RefreshPalette();
+	printf("VDP_SetRenderer: Unknown renderer %s\n", name);
+	return -1;
+}
+
+static int VDP_InitRenderer()
+{
+	//Use the renderer from the environment unless one's already been set
+	if (vdp_renderer == NULL)
+	{
+		const char *env = getenv("SCP_VDP_RENDERER");
+		if (VDP_SetRenderer((env != NULL) ? env : "fast"))
+			return -1;
+	}
 	
-	uint32_t *to = vdp_screen;
-	uint8_t *tom = vdp_mask;
-	struct VDP_SpriteCache *scache = vdp_sprite_cache;
-	const int16_t *hscroll = (int16_t*)(vdp_vram + vdp_hscroll_location);
+	vdp_verify.frames = 0;
+	vdp_verify.mismatches = 0;
+	return 0;
+}
+
+static void VDP_QuitRenderer()
+{
+	if (vdp_verify.enable)
+		printf("VDP: Verified %lu frames against the reference renderer, %lu differed\n", vdp_verify.frames, vdp_verify.mismatches);
+}
+
+static void VDP_VerifyLines(size_t y, size_t y_end)
+{
+	//Count frames as their first lines are checked
+	if (y == 0)
+		vdp_verify.frames++;
+	
+	//Draw the same lines with the reference renderer
+	uint32_t *ref_screen = &vdp_verify.screen[0][VDP_INTERNAL_PAD];
+	VDP_ReferenceLines(y, y_end, ref_screen);
 	
-	if (vdp_hint_pos >= 0 && vdp_hint_pos < SCREEN_HEIGHT)
+	//Compare final colours
+	for (; y < y_end; y++)
 	{
-		//Draw up to horizontal interrupt
-		size_t y = 0;
-		while (y < (size_t)vdp_hint_pos && y < SCREEN_HEIGHT)
+		const uint32_t *out = vdp_screen + y * SCREEN_PITCH, *ref_out = ref_screen + y * SCREEN_PITCH;
+		for (size_t x = 0; x < SCREEN_WIDTH; x++)
 		{
-			for (; y < (size_t)vdp_hint_pos && y < SCREEN_HEIGHT; y++, scache++, hscroll += 2, to += SCREEN_PITCH, tom += SCREEN_PITCH)
-				VDP_DrawScanline(y, to, tom, scache, hscroll);
+			if (out[x] == ref_out[x])
+				continue;
 			
-			//Send horizontal interrupt
-			vdp_hint();
-			VDP_RefreshPalette();
+			//Count each frame that differs once, and report where the first one did
+			if (vdp_verify.mismatches != 0 && vdp_verify.mismatch_frame == vdp_verify.frame)
+				return;
+			if (vdp_verify.mismatches == 0)
+				printf("VDP: Frame %lu differs from the reference renderer at scanline %u, pixel %u (colour %08X, expected %08X)\n",
+					vdp_verify.frame, (unsigned)y, (unsigned)x, (unsigned)out[x], (unsigned)ref_out[x]);
+			vdp_verify.mismatch_frame = vdp_verify.frame;
+			vdp_verify.mismatches++;
+			return;
 		}
+	}
+}
+
+//VDP raster worker pool
+static struct
+{
+	Thread *thread[VDP_THREADS_MAX];
+	size_t threads;
+	
+	Mutex *mutex;
+	Cond *work_cond, *done_cond;
+	bool quit;
+	
+	size_t y, y_end;            //Segment being rendered
+	size_t band_height;
+	size_t band_next, band_num; //Bands handed out / bands in segment
+	size_t band_done;           //Bands finished
+} vdp_pool;
+
+//Takes a band from the current segment and draws it, returns false if there's no band left (mutex must be locked)
+static bool VDP_PoolRunBand()
+{
+	if (vdp_pool.band_next >= vdp_pool.band_num)
+		return false;
+	
+	//Get band area
+	size_t band = vdp_pool.band_next++;
+	size_t y = vdp_pool.y + band * vdp_pool.band_height;
+	size_t y_end = y + vdp_pool.band_height;
+	if (band == vdp_pool.band_num - 1)
+		y_end = vdp_pool.y_end;
+	
+	//Draw band
+	Mutex_Unlock(vdp_pool.mutex);
+	vdp_renderer->draw_lines(y, y_end);
+	Mutex_Lock(vdp_pool.mutex);
+	
+	if (++vdp_pool.band_done == vdp_pool.band_num)
+		Cond_Signal(vdp_pool.done_cond);
+	return true;
+}
+
+static void VDP_PoolWorker(void *arg)
+{
+	(void)arg;
+	
+	Mutex_Lock(vdp_pool.mutex);
+	while (!vdp_pool.quit)
+	{
+		if (!VDP_PoolRunBand())
+			Cond_Wait(vdp_pool.work_cond, vdp_pool.mutex);
+	}
+	Mutex_Unlock(vdp_pool.mutex);
+}
+
+static void VDP_PoolInit()
+{
+	//Get the amount of workers to use
+	size_t threads = Thread_GetCPUCount() - 1;
+	const char *env = getenv("SCP_VDP_THREADS");
+	if (env != NULL)
+		threads = strtoul(env, NULL, 0);
+	if (threads > VDP_THREADS_MAX)
+		threads = VDP_THREADS_MAX;
+	
+	vdp_pool.threads = 0;
+	vdp_pool.quit = false;
+	if (threads == 0)
+		return;
+	
+	//Create synchronization objects
+	if ((vdp_pool.mutex = Mutex_Create()) == NULL ||
+	    (vdp_pool.work_cond = Cond_Create()) == NULL ||
+	    (vdp_pool.done_cond = Cond_Create()) == NULL)
+	{
+		puts("VDP_PoolInit: Failed to create synchronization objects, rendering on one thread");
+		return;
+	}
+	
+	//Start workers
+	for (; vdp_pool.threads < threads; vdp_pool.threads++)
+		if ((vdp_pool.thread[vdp_pool.threads] = Thread_Create(VDP_PoolWorker, NULL)) == NULL)
+			break;
+}
+
+static void VDP_PoolQuit()
+{
+	//Stop workers
+	if (vdp_pool.threads != 0)
+	{
+		Mutex_Lock(vdp_pool.mutex);
+		vdp_pool.quit = true;
+		Cond_Broadcast(vdp_pool.work_cond);
+		Mutex_Unlock(vdp_pool.mutex);
 		
-		//Draw rest of screen
-		for (; y < SCREEN_HEIGHT; y++, scache++, hscroll += 2, to += SCREEN_PITCH, tom += SCREEN_PITCH)
-			VDP_DrawScanline(y, to, tom, scache, hscroll);
+		for (size_t i = 0; i < vdp_pool.threads; i++)
+			Thread_Join(vdp_pool.thread[i]);
+		vdp_pool.threads = 0;
 	}
-	else
+	
+	//Destroy synchronization objects
+	if (vdp_pool.done_cond != NULL)
+		Cond_Destroy(vdp_pool.done_cond);
+	if (vdp_pool.work_cond != NULL)
+		Cond_Destroy(vdp_pool.work_cond);
+	if (vdp_pool.mutex != NULL)
+		Mutex_Destroy(vdp_pool.mutex);
+	vdp_pool.done_cond = NULL;
+	vdp_pool.work_cond = NULL;
+	vdp_pool.mutex = NULL;
+}
+
+//Draws a segment of the screen, split into bands across the worker pool
+static void VDP_DrawSegment(size_t y, size_t y_end)
+{
+	if (vdp_pool.threads == 0)
+	{
+		vdp_renderer->draw_lines(y, y_end);
+		return;
+	}
+	
+	//Split segment into bands (a few per thread so uneven lines balance out)
+	size_t lines = y_end - y;
+	size_t band_height = (lines + (vdp_pool.threads + 1) * 4 - 1) / ((vdp_pool.threads + 1) * 4);
+	if (band_height < VDP_BAND_HEIGHT)
+		band_height = VDP_BAND_HEIGHT;
+	
+	//Hand out bands and help draw them
+	Mutex_Lock(vdp_pool.mutex);
+	vdp_pool.y = y;
+	vdp_pool.y_end = y_end;
+	vdp_pool.band_height = band_height;
+	vdp_pool.band_next = 0;
+	vdp_pool.band_num = (lines + band_height - 1) / band_height;
+	vdp_pool.band_done = 0;
+	Cond_Broadcast(vdp_pool.work_cond);
+	
+	while (VDP_PoolRunBand());
+	while (vdp_pool.band_done != vdp_pool.band_num)
+		Cond_Wait(vdp_pool.done_cond, vdp_pool.mutex);
+	Mutex_Unlock(vdp_pool.mutex);
+}
+
+//Prepares the renderer's state for drawing a new frame
+static void VDP_BeginFrame()
+{
+	if (vdp_renderer->begin_frame != NULL)
+		vdp_renderer->begin_frame();
+}
+
+//Applies a line event to the renderer's state
+static void VDP_ApplyLineEvent(const struct VDP_LineEvent *event)
+{
+	switch (event->kind)
+	{
+		case VDP_LineEvent_CRAM:
+		{
+			uint16_t *to = &vdp_cram[0][0] + event->index;
+			const uint16_t *from = vdp_timeline.data + event->data;
+			if (memcmp(to, from, event->len << 1) != 0)
+			{
+				memcpy(to, from, event->len << 1);
+				vdp_cram_dirty = true;
+			}
+			break;
+		}
+		case VDP_LineEvent_VScroll:
+			vdp_reg.vscroll_a = event->vscroll[0];
+			vdp_reg.vscroll_b = event->vscroll[1];
+			break;
+		case VDP_LineEvent_BackgroundColour:
+			vdp_reg.background_colour = event->index;
+			break;
+	}
+}
+
+//Draws the entire screen, splitting it wherever a line event changes the state
+static void VDP_DrawFrame()
+{
+	VDP_BeginFrame();
+	
+	//Keep the committed state, line events only last for this frame
+	struct VDP_Registers reg = vdp_reg;
+	uint16_t cram[4][16];
+	if (vdp_timeline.events != 0)
+		memcpy(cram, vdp_cram, sizeof(cram));
+	
+	size_t y = 0, i = 0;
+	while (y < SCREEN_HEIGHT)
+	{
+		//Apply the events that start on this line, and draw up to the next one
+		for (; i < vdp_timeline.events && (size_t)vdp_timeline.event[i].line <= y; i++)
+			VDP_ApplyLineEvent(&vdp_timeline.event[i]);
+		size_t y_end = (i < vdp_timeline.events) ? (size_t)vdp_timeline.event[i].line : SCREEN_HEIGHT;
+		
+		VDP_RefreshPalette();
+		VDP_DrawSegment(y, y_end);
+		if (vdp_verify.enable)
+			VDP_VerifyLines(y, y_end);
+		y = y_end;
+	}
+	
+	//Restore the committed state
+	if (vdp_timeline.events != 0)
 	{
+		vdp_reg = reg;
+		if (memcmp(cram, vdp_cram, sizeof(cram)) != 0)
+		{
+			memcpy(vdp_cram, cram, sizeof(cram));
+			vdp_cram_dirty = true;
+		}
+	}
+}
+
+//VDP state commit
+
+//Copies the live state written by the game to the renderer's copy
+static void VDP_Commit()
+{
+	//Copy written VRAM blocks and mark their patterns for decoding
+	if (vdp_vram_dirty_any)
+	{
+		for (size_t i = 0; i < PATTERNS / 32; i++)
+		{
+			uint32_t dirty = vdp_vram_dirty[i];
+			if (dirty == 0)
+				continue;
+			vdp_vram_dirty[i] = 0;
+			vdp_pattern_dirty[i] |= dirty;
+			
+			for (size_t j = 0; j < 32; j++)
+			{
+				if (dirty & (1UL << j))
+				{
+					size_t offset = ((i << 5) | j) << 5;
+					memcpy(vdp_vram + offset, vdp_vram_live + offset, 0x20);
+				}
+			}
+		}
+		vdp_vram_dirty_any = false;
+		vdp_pattern_dirty_any = true;
+	}
+	
+	//Copy CRAM
+	if (vdp_cram_live_dirty)
+	{
+		memcpy(vdp_cram, vdp_cram_live, sizeof(vdp_cram));
+		vdp_cram_live_dirty = false;
+		vdp_cram_dirty = true;
+	}
+	
+	//Copy registers
+	vdp_reg = vdp_reg_live;
+}
+
+//Hands the line events set since the last commit to the renderer
+static void VDP_CommitTimeline()
+{
+	memcpy(vdp_timeline.event, vdp_timeline_live.event, vdp_timeline_live.events * sizeof(vdp_timeline.event[0]));
+	memcpy(vdp_timeline.data, vdp_timeline_live.data, vdp_timeline_live.data_len * sizeof(vdp_timeline.data[0]));
+	vdp_timeline.events = vdp_timeline_live.events;
+	vdp_timeline.data_len = vdp_timeline_live.data_len;
+	
+	vdp_timeline_live.events = 0;
+	vdp_timeline_live.data_len = 0;
+}
+
+//VDP render thread
+static struct
+{
+	Thread *thread;
+	Mutex *mutex;
+	Cond *cond;
+	bool busy, quit;
+} vdp_pipe;
+
+static bool vdp_frame_pending; //A frame is being drawn by the render thread and needs to be presented
+
+static void VDP_PipeWorker(void *arg)
+{
+	(void)arg;
+	
+	Mutex_Lock(vdp_pipe.mutex);
+	for (;;)
+	{
+		//Wait for a frame to draw
+		while (!vdp_pipe.busy && !vdp_pipe.quit)
+			Cond_Wait(vdp_pipe.cond, vdp_pipe.mutex);
+		if (vdp_pipe.quit)
+			break;
+		
 		//Draw entire screen
-		for (size_t y = 0; y < SCREEN_HEIGHT; y++, scache++, hscroll += 2, to += SCREEN_PITCH, tom += SCREEN_PITCH)
-			VDP_DrawScanline(y, to, tom, scache, hscroll);
+		Mutex_Unlock(vdp_pipe.mutex);
+		VDP_DrawFrame();
+		Mutex_Lock(vdp_pipe.mutex);
+		
+		vdp_pipe.busy = false;
+		Cond_Broadcast(vdp_pipe.cond);
 	}
+	Mutex_Unlock(vdp_pipe.mutex);
+}
+
+static void VDP_PipeInit()
+{
+	//Check if the render thread should be used
+	bool enable = Thread_GetCPUCount() > 1;
+	const char *env = getenv("SCP_VDP_PIPELINE");
+	if (env != NULL)
+		enable = strtoul(env, NULL, 0) != 0;
 	
-	//Send vertical interrupt
-	vdp_vint();
+	vdp_pipe.busy = false;
+	vdp_pipe.quit = false;
+	vdp_frame_pending = false;
+	if (!enable)
+		return;
 	
-	//Render screen
+	//Create synchronization objects and thread
+	if ((vdp_pipe.mutex = Mutex_Create()) == NULL ||
+	    (vdp_pipe.cond = Cond_Create()) == NULL ||
+	    (vdp_pipe.thread = Thread_Create(VDP_PipeWorker, NULL)) == NULL)
+	{
+		puts("VDP_PipeInit: Failed to start render thread, rendering on the game thread");
+		VDP_PipeQuit();
+	}
+}
+
+static void VDP_PipeQuit()
+{
+	//Stop render thread
+	if (vdp_pipe.thread != NULL)
+	{
+		Mutex_Lock(vdp_pipe.mutex);
+		vdp_pipe.quit = true;
+		Cond_Broadcast(vdp_pipe.cond);
+		Mutex_Unlock(vdp_pipe.mutex);
+		
+		Thread_Join(vdp_pipe.thread);
+		vdp_pipe.thread = NULL;
+	}
+	
+	//Destroy synchronization objects
+	if (vdp_pipe.cond != NULL)
+		Cond_Destroy(vdp_pipe.cond);
+	if (vdp_pipe.mutex != NULL)
+		Mutex_Destroy(vdp_pipe.mutex);
+	vdp_pipe.cond = NULL;
+	vdp_pipe.mutex = NULL;
+}
+
+static void VDP_PipeStart()
+{
+	Mutex_Lock(vdp_pipe.mutex);
+	vdp_pipe.busy = true;
+	Cond_Broadcast(vdp_pipe.cond);
+	Mutex_Unlock(vdp_pipe.mutex);
+}
+
+static void VDP_PipeWait()
+{
+	Mutex_Lock(vdp_pipe.mutex);
+	while (vdp_pipe.busy)
+		Cond_Wait(vdp_pipe.cond, vdp_pipe.mutex);
+	Mutex_Unlock(vdp_pipe.mutex);
+}
+
+//Decides if the next frame should be skipped, called when a frame's work is done
+static void VDP_SkipUpdate()
+{
+	vdp_skip.frames++;
+	if (vdp_skip.skip && !vdp_ff.enable)
+		vdp_skip.skipped++;
+	
+	//While fast-forwarding, only draw every Nth frame
+	if (vdp_ff.enable)
+	{
+		vdp_skip.skip = (++vdp_ff.count % vdp_ff.rate) != 0;
+		vdp_skip.work_start = 0;
+		vdp_skip.run = 0;
+		return;
+	}
+	
+	if (vdp_skip.max == 0)
+		return;
+	
+	//Measure how long the game logic and VDP took on this frame, without the time spent presenting (waiting on the pacer or vsync)
+	uint64_t now = System_GetNanoseconds();
+	uint64_t start = vdp_skip.work_start;
+	uint64_t work = now - start - vdp_skip.present;
+	vdp_skip.work_start = now;
+	vdp_skip.present = 0;
+	
+	if (start == 0)
+	{
+		//Start over
+		vdp_skip.behind = 0;
+		vdp_skip.skip = false;
+		vdp_skip.run = 0;
+		return;
+	}
+	
+	//Keep track of how far behind the frame period we are, giving up on catching up if it's hopeless
+	if (work > vdp_skip.period)
+		vdp_skip.behind += work - vdp_skip.period;
+	else if (vdp_skip.behind > vdp_skip.period - work)
+		vdp_skip.behind -= vdp_skip.period - work;
+	else
+		vdp_skip.behind = 0;
+	if (vdp_skip.behind > VDP_SKIP_RESYNC_NS)
+		vdp_skip.behind = 0;
+	
+	//Skip the next frame while we're more than half a frame behind
+	if (vdp_skip.behind > vdp_skip.period / 2 && vdp_skip.run < vdp_skip.max)
+	{
+		vdp_skip.skip = true;
+		vdp_skip.run++;
+	}
+	else
+	{
+		vdp_skip.skip = false;
+		vdp_skip.run = 0;
+	}
+}
+
+static void VDP_Present()
+{
+	//Present the screen, timing it so it isn't counted as work by the frame skipper
+	if (vdp_skip.max == 0 || vdp_ff.enable)
+	{
+		Render_Screen(vdp_screen);
+		return;
+	}
+	
+	uint64_t start = System_GetNanoseconds();
 	Render_Screen(vdp_screen);
+	vdp_skip.present += System_GetNanoseconds() - start;
+}
+
+//Fast-forward, this can be called before the VDP is initialized
+void VDP_SetFastForward(bool enable)
+{
+	vdp_ff.enable = enable;
+	vdp_ff.count = 0;
+	
+	//Draw the next frame either way, and let the frame skipper start over
+	vdp_skip.skip = false;
+	vdp_skip.work_start = 0;
+	vdp_skip.run = 0;
+	
+	//Let the backend stop (or resume) limiting the frame rate
+	Render_SetFastForward(enable);
+}
+
+bool VDP_GetFastForward()
+{
+	return vdp_ff.enable;
+}
+
+void VDP_SetFastForwardRate(unsigned rate)
+{
+	vdp_ff.rate = (rate != 0) ? rate : 1;
+	vdp_ff.count = 0;
+}
+
+void VDP_Render()
+{
+	//Present the frame the render thread was drawing, the renderer's state is ours again after this
+	if (vdp_frame_pending)
+	{
+		VDP_PipeWait();
+		VDP_Present();
+		vdp_frame_pending = false;
+	}
+	
+	//Commit the frame's state
+	VDP_Commit();
+	
+	//Send horizontal interrupt, its CRAM and register writes become line events for this frame
+	//(VRAM and other writes it makes only show up next frame)
+	if (vdp_reg.hint_pos > 0 && vdp_reg.hint_pos < SCREEN_HEIGHT)
+	{
+		vdp_hint_line = vdp_reg.hint_pos;
+		vdp_hint();
+		vdp_hint_line = -1;
+	}
+	if (vdp_line_test)
+		VDP_LineTest();
+	VDP_CommitTimeline();
+	
+	bool drawn = false;
+	if (!vdp_skip.skip)
+	{
+		if (vdp_pipe.thread != NULL)
+		{
+			//Draw entire screen on the render thread while the game runs the next frame
+			vdp_verify.frame = vdp_skip.frames;
+			VDP_PipeStart();
+			vdp_frame_pending = true;
+		}
+		else
+		{
+			//Draw entire screen
+			vdp_verify.frame = vdp_skip.frames;
+			VDP_DrawFrame();
+			drawn = true;
+		}
+	}
+	else
+	{
+		//Nothing gets presented, but the backend still has to count the frame's time
+		Render_SkipFrame();
+	}
+	
+	//Send vertical interrupt, then commit what it queued
+	vdp_vint();
+	VDP_FlushQueue();
+	
+	//Render screen, and check if we're keeping up
+	//Skipped frames still commit their state, so the next drawn frame picks up every change
+	if (drawn)
+		VDP_Present();
+	VDP_SkipUpdate();
 	
 	//Handle events
 	if (Input_HandleEvents())
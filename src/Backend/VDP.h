@@ -60,10 +60,28 @@ void VDP_SeekVRAM(size_t offset);
 void VDP_WriteVRAM(const uint8_t *data, size_t len);
 void VDP_FillVRAM(uint8_t data, size_t len);
 
+//Tilemap writes, these take their own offset and leave the VRAM seek position alone
+//'stride' and 'pitch' are the distance in bytes between consecutive words and rows
+void VDP_WriteVRAMWords(size_t offset, size_t stride, const uint16_t *words, size_t count);
+void VDP_WriteVRAMRect(size_t offset, size_t pitch, const uint8_t *tilemap, size_t width, size_t height, uint16_t add); //Big-endian tilemap
+void VDP_FillVRAMRect(size_t offset, size_t pitch, uint16_t v, size_t width, size_t height);
+
 void VDP_SeekCRAM(size_t offset);
 void VDP_WriteCRAM(const uint16_t *data, size_t len);
 void VDP_FillCRAM(uint16_t data, size_t len);
 
+//Transfer queue, transfers are held until the end of the vertical interrupt and then written in order
+//The source data must stay valid until then
+typedef enum
+{
+	VDP_Transfer_VRAM,
+	VDP_Transfer_CRAM,
+} VDP_TransferKind;
+
+void VDP_QueueVRAM(size_t offset, const uint8_t *data, size_t len);
+void VDP_QueueCRAM(size_t offset, const uint16_t *data, size_t len);
+void VDP_FlushQueue();
+
 void VDP_SetPlaneALocation(size_t loc);
 void VDP_SetPlaneBLocation(size_t loc);
 void VDP_SetSpriteLocation(size_t loc);
@@ -73,4 +91,16 @@ void VDP_SetBackgroundColour(uint8_t index);
 void VDP_SetVScroll(int16_t scroll_a, int16_t scroll_b);
 void VDP_SetHIntPosition(int16_t pos);
 
+//Line events change CRAM or registers from a scanline onwards, for the next frame drawn only
+//Writes made by the horizontal interrupt become line events on its line
+void VDP_SetLineCRAM(int16_t line, size_t offset, const uint16_t *data, size_t len);
+void VDP_SetLineVScroll(int16_t line, int16_t scroll_a, int16_t scroll_b);
+void VDP_SetLineBackgroundColour(int16_t line, uint8_t index);
+
 void VDP_Render();
+
+int VDP_SetRenderer(const char *name); //"fast", "reference", or "verify" (fast, checked against reference every frame)
+
+void VDP_SetFastForward(bool enable); //Run uncapped, only drawing every Nth frame
+bool VDP_GetFastForward();
+void VDP_SetFastForwardRate(unsigned rate); //Draw every 'rate'th frame while fast-forwarding
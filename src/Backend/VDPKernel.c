@@ -0,0 +1,432 @@
+#include "VDPKernel.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+//Instruction sets to compile
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define KERNEL_SSE2
+	#include <emmintrin.h>
+#endif
+
+#if (defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+	#define KERNEL_AVX2
+	#include <immintrin.h>
+	#ifdef _MSC_VER
+		#include <intrin.h>
+		#define TARGET_AVX2
+	#else
+		#define TARGET_AVX2 __attribute__((target("avx2")))
+	#endif
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+	#define KERNEL_NEON
+	#include <arm_neon.h>
+	#if (defined(__aarch64__) || defined(_M_ARM64)) && !defined(__ARM_BIG_ENDIAN)
+		#define KERNEL_NEON_TBL
+	#endif
+#endif
+
+//Scalar kernels
+static void VDP_RowKernel_Scalar(uint8_t *to, const uint8_t *from, uint8_t pal, uint8_t and, uint8_t or)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		//Opaque pixels always write the mask, but only draw if the mask doesn't block them
+		uint8_t v = from[i];
+		uint8_t p = to[i];
+		if (v != 0)
+			to[i] = (p & and) ? (p | or) : ((p & VDP_MASK_AND) | or | pal | v);
+	}
+}
+
+static void VDP_SpanKernel_Scalar(uint8_t *to, const uint8_t *from, size_t width, uint8_t and)
+{
+	for (size_t i = 0; i < width; i++)
+	{
+		//Opaque pixels carry their own mask bits and colour index
+		uint8_t v = from[i];
+		uint8_t p = to[i];
+		if (v != 0)
+			to[i] = (p & and) ? (p | (v & VDP_MASK_AND)) : ((p & VDP_MASK_AND) | v);
+	}
+}
+
+static void VDP_ResolveKernel_Scalar(uint32_t *to, const uint8_t *from, const uint32_t *pal, size_t width)
+{
+	for (size_t i = 0; i < width; i++)
+		to[i] = pal[from[i] & VDP_PIXEL_INDEX_AND];
+}
+
+static void VDP_ScaleKernel_Scalar(uint32_t *to, const uint32_t *from, size_t width, unsigned scale, unsigned shift, uint32_t or)
+{
+	for (size_t i = 0; i < width; i++)
+	{
+		uint32_t v = (from[i] >> shift) | or;
+		for (unsigned j = 0; j < scale; j++)
+			*to++ = v;
+	}
+}
+
+#ifdef KERNEL_SSE2
+//SSE2 kernels
+static void VDP_RowKernel_SSE2(uint8_t *to, const uint8_t *from, uint8_t pal, uint8_t and, uint8_t or)
+{
+	//Build opacity and draw masks
+	__m128i zero = _mm_setzero_si128();
+	__m128i v = _mm_loadl_epi64((const __m128i*)from);
+	__m128i p = _mm_loadl_epi64((const __m128i*)to);
+	__m128i opaque = _mm_andnot_si128(_mm_cmpeq_epi8(v, zero), _mm_set1_epi8(-1));
+	__m128i draw = _mm_and_si128(opaque, _mm_cmpeq_epi8(_mm_and_si128(p, _mm_set1_epi8((char)and)), zero));
+	
+	//Blend drawn pixels over the mask-only update
+	__m128i vor = _mm_set1_epi8((char)or);
+	__m128i masked = _mm_or_si128(p, _mm_and_si128(opaque, vor));
+	__m128i drawn = _mm_or_si128(_mm_or_si128(_mm_and_si128(p, _mm_set1_epi8((char)VDP_MASK_AND)), vor), _mm_or_si128(v, _mm_set1_epi8((char)pal)));
+	_mm_storel_epi64((__m128i*)to, _mm_or_si128(_mm_and_si128(draw, drawn), _mm_andnot_si128(draw, masked)));
+}
+
+static void VDP_SpanKernel_SSE2(uint8_t *to, const uint8_t *from, size_t width, uint8_t and)
+{
+	__m128i zero = _mm_setzero_si128();
+	__m128i vand = _mm_set1_epi8((char)and);
+	__m128i vmask = _mm_set1_epi8((char)VDP_MASK_AND);
+	
+	size_t i = 0;
+	for (; i + 16 <= width; i += 16)
+	{
+		//Build draw mask from the opaque pixels that aren't blocked
+		__m128i v = _mm_loadu_si128((const __m128i*)(from + i));
+		__m128i p = _mm_loadu_si128((const __m128i*)(to + i));
+		__m128i draw = _mm_andnot_si128(_mm_cmpeq_epi8(v, zero), _mm_cmpeq_epi8(_mm_and_si128(p, vand), zero));
+		
+		//Blend drawn pixels over the mask-only update (transparent pixels are 0, so they leave the mask alone)
+		__m128i masked = _mm_or_si128(p, _mm_and_si128(v, vmask));
+		__m128i drawn = _mm_or_si128(_mm_and_si128(p, vmask), v);
+		_mm_storeu_si128((__m128i*)(to + i), _mm_or_si128(_mm_and_si128(draw, drawn), _mm_andnot_si128(draw, masked)));
+	}
+	VDP_SpanKernel_Scalar(to + i, from + i, width - i, and);
+}
+
+static void VDP_ScaleKernel_SSE2(uint32_t *to, const uint32_t *from, size_t width, unsigned scale, unsigned shift, uint32_t or)
+{
+	__m128i count = _mm_cvtsi32_si128((int)shift);
+	__m128i vor = _mm_set1_epi32((int)or);
+	
+	//Convert 4 pixels at a time and spread them across 'scale' times as many
+	size_t i = 0;
+	switch (scale)
+	{
+		case 1:
+			for (; i + 4 <= width; i += 4, to += 4)
+			{
+				__m128i v = _mm_or_si128(_mm_srl_epi32(_mm_loadu_si128((const __m128i*)(from + i)), count), vor);
+				_mm_storeu_si128((__m128i*)to, v);
+			}
+			break;
+		case 2:
+			for (; i + 4 <= width; i += 4, to += 8)
+			{
+				__m128i v = _mm_or_si128(_mm_srl_epi32(_mm_loadu_si128((const __m128i*)(from + i)), count), vor);
+				_mm_storeu_si128((__m128i*)(to + 0), _mm_unpacklo_epi32(v, v));
+				_mm_storeu_si128((__m128i*)(to + 4), _mm_unpackhi_epi32(v, v));
+			}
+			break;
+		case 3:
+			for (; i + 4 <= width; i += 4, to += 12)
+			{
+				__m128i v = _mm_or_si128(_mm_srl_epi32(_mm_loadu_si128((const __m128i*)(from + i)), count), vor);
+				_mm_storeu_si128((__m128i*)(to + 0), _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 0, 0)));
+				_mm_storeu_si128((__m128i*)(to + 4), _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 2, 1, 1)));
+				_mm_storeu_si128((__m128i*)(to + 8), _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 2)));
+			}
+			break;
+		case 4:
+			for (; i + 4 <= width; i += 4, to += 16)
+			{
+				__m128i v = _mm_or_si128(_mm_srl_epi32(_mm_loadu_si128((const __m128i*)(from + i)), count), vor);
+				_mm_storeu_si128((__m128i*)(to +  0), _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 0, 0, 0)));
+				_mm_storeu_si128((__m128i*)(to +  4), _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 1, 1, 1)));
+				_mm_storeu_si128((__m128i*)(to +  8), _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 2, 2, 2)));
+				_mm_storeu_si128((__m128i*)(to + 12), _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 3)));
+			}
+			break;
+	}
+	
+	VDP_ScaleKernel_Scalar(to, from + i, width - i, scale, shift, or);
+}
+#endif
+
+#ifdef KERNEL_AVX2
+//AVX2 kernels
+//Pattern rows are only 8 pixels wide, so rows are left to the SSE2 kernel
+TARGET_AVX2 static void VDP_SpanKernel_AVX2(uint8_t *to, const uint8_t *from, size_t width, uint8_t and)
+{
+	__m256i zero = _mm256_setzero_si256();
+	__m256i vand = _mm256_set1_epi8((char)and);
+	__m256i vmask = _mm256_set1_epi8((char)VDP_MASK_AND);
+	
+	size_t i = 0;
+	for (; i + 32 <= width; i += 32)
+	{
+		//Build draw mask from the opaque pixels that aren't blocked
+		__m256i v = _mm256_loadu_si256((const __m256i*)(from + i));
+		__m256i p = _mm256_loadu_si256((const __m256i*)(to + i));
+		__m256i draw = _mm256_andnot_si256(_mm256_cmpeq_epi8(v, zero), _mm256_cmpeq_epi8(_mm256_and_si256(p, vand), zero));
+		
+		//Blend drawn pixels over the mask-only update (transparent pixels are 0, so they leave the mask alone)
+		__m256i masked = _mm256_or_si256(p, _mm256_and_si256(v, vmask));
+		__m256i drawn = _mm256_or_si256(_mm256_and_si256(p, vmask), v);
+		_mm256_storeu_si256((__m256i*)(to + i), _mm256_blendv_epi8(masked, drawn, draw));
+	}
+	VDP_SpanKernel_Scalar(to + i, from + i, width - i, and);
+}
+
+TARGET_AVX2 static void VDP_ScaleKernel_AVX2(uint32_t *to, const uint32_t *from, size_t width, unsigned scale, unsigned shift, uint32_t or)
+{
+	__m128i count = _mm_cvtsi32_si128((int)shift);
+	__m256i vor = _mm256_set1_epi32((int)or);
+	
+	//Convert 8 pixels at a time and spread them across 'scale' times as many
+	size_t i = 0;
+	switch (scale)
+	{
+		case 1:
+			for (; i + 8 <= width; i += 8, to += 8)
+			{
+				__m256i v = _mm256_or_si256(_mm256_srl_epi32(_mm256_loadu_si256((const __m256i*)(from + i)), count), vor);
+				_mm256_storeu_si256((__m256i*)to, v);
+			}
+			break;
+		case 2:
+			for (; i + 8 <= width; i += 8, to += 16)
+			{
+				__m256i v = _mm256_or_si256(_mm256_srl_epi32(_mm256_loadu_si256((const __m256i*)(from + i)), count), vor);
+				_mm256_storeu_si256((__m256i*)(to + 0), _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3)));
+				_mm256_storeu_si256((__m256i*)(to + 8), _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7)));
+			}
+			break;
+		case 3:
+			for (; i + 8 <= width; i += 8, to += 24)
+			{
+				__m256i v = _mm256_or_si256(_mm256_srl_epi32(_mm256_loadu_si256((const __m256i*)(from + i)), count), vor);
+				_mm256_storeu_si256((__m256i*)(to +  0), _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 0, 0, 1, 1, 1, 2, 2)));
+				_mm256_storeu_si256((__m256i*)(to +  8), _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(2, 3, 3, 3, 4, 4, 4, 5)));
+				_mm256_storeu_si256((__m256i*)(to + 16), _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(5, 5, 6, 6, 6, 7, 7, 7)));
+			}
+			break;
+		case 4:
+			for (; i + 8 <= width; i += 8, to += 32)
+			{
+				__m256i v = _mm256_or_si256(_mm256_srl_epi32(_mm256_loadu_si256((const __m256i*)(from + i)), count), vor);
+				_mm256_storeu_si256((__m256i*)(to +  0), _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1)));
+				_mm256_storeu_si256((__m256i*)(to +  8), _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(2, 2, 2, 2, 3, 3, 3, 3)));
+				_mm256_storeu_si256((__m256i*)(to + 16), _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(4, 4, 4, 4, 5, 5, 5, 5)));
+				_mm256_storeu_si256((__m256i*)(to + 24), _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(6, 6, 6, 6, 7, 7, 7, 7)));
+			}
+			break;
+	}
+	
+	VDP_ScaleKernel_Scalar(to, from + i, width - i, scale, shift, or);
+}
+
+TARGET_AVX2 static void VDP_ResolveKernel_AVX2(uint32_t *to, const uint8_t *from, const uint32_t *pal, size_t width)
+{
+	__m128i index_and = _mm_set1_epi8(VDP_PIXEL_INDEX_AND);
+	
+	size_t i = 0;
+	for (; i + 8 <= width; i += 8)
+	{
+		__m128i v = _mm_and_si128(_mm_loadl_epi64((const __m128i*)(from + i)), index_and);
+		__m256i col = _mm256_i32gather_epi32((const int*)pal, _mm256_cvtepu8_epi32(v), 4);
+		_mm256_storeu_si256((__m256i*)(to + i), col);
+	}
+	for (; i < width; i++)
+		to[i] = pal[from[i] & VDP_PIXEL_INDEX_AND];
+}
+
+//AVX2 support check
+static int VDP_HasAVX2()
+{
+	#ifdef _MSC_VER
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7)
+			return 0;
+		__cpuid(info, 1);
+		if (!(info[2] & (1 << 27)) || !(info[2] & (1 << 28))) //OSXSAVE and AVX
+			return 0;
+		if ((_xgetbv(0) & 6) != 6) //OS saves XMM and YMM state
+			return 0;
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+	#else
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2");
+	#endif
+}
+#endif
+
+#ifdef KERNEL_NEON
+//NEON kernels
+static void VDP_RowKernel_NEON(uint8_t *to, const uint8_t *from, uint8_t pal, uint8_t and, uint8_t or)
+{
+	//Build opacity and draw masks
+	uint8x8_t v = vld1_u8(from);
+	uint8x8_t p = vld1_u8(to);
+	uint8x8_t opaque = vtst_u8(v, v);
+	uint8x8_t draw = vbic_u8(opaque, vtst_u8(p, vdup_n_u8(and)));
+	
+	//Blend drawn pixels over the mask-only update
+	uint8x8_t vor = vdup_n_u8(or);
+	uint8x8_t masked = vorr_u8(p, vand_u8(opaque, vor));
+	uint8x8_t drawn = vorr_u8(vorr_u8(vand_u8(p, vdup_n_u8(VDP_MASK_AND)), vor), vorr_u8(v, vdup_n_u8(pal)));
+	vst1_u8(to, vbsl_u8(draw, drawn, masked));
+}
+
+static void VDP_SpanKernel_NEON(uint8_t *to, const uint8_t *from, size_t width, uint8_t and)
+{
+	uint8x16_t vand = vdupq_n_u8(and);
+	uint8x16_t vmask = vdupq_n_u8(VDP_MASK_AND);
+	
+	size_t i = 0;
+	for (; i + 16 <= width; i += 16)
+	{
+		//Build draw mask from the opaque pixels that aren't blocked
+		uint8x16_t v = vld1q_u8(from + i);
+		uint8x16_t p = vld1q_u8(to + i);
+		uint8x16_t draw = vbicq_u8(vtstq_u8(v, v), vtstq_u8(p, vand));
+		
+		//Blend drawn pixels over the mask-only update (transparent pixels are 0, so they leave the mask alone)
+		uint8x16_t masked = vorrq_u8(p, vandq_u8(v, vmask));
+		uint8x16_t drawn = vorrq_u8(vandq_u8(p, vmask), v);
+		vst1q_u8(to + i, vbslq_u8(draw, drawn, masked));
+	}
+	VDP_SpanKernel_Scalar(to + i, from + i, width - i, and);
+}
+
+static void VDP_ScaleKernel_NEON(uint32_t *to, const uint32_t *from, size_t width, unsigned scale, unsigned shift, uint32_t or)
+{
+	int32x4_t count = vdupq_n_s32(-(int32_t)shift);
+	uint32x4_t vor = vdupq_n_u32(or);
+	
+	//Convert 4 pixels at a time and spread them across 'scale' times as many with interleaved stores
+	size_t i = 0;
+	switch (scale)
+	{
+		case 1:
+			for (; i + 4 <= width; i += 4, to += 4)
+				vst1q_u32(to, vorrq_u32(vshlq_u32(vld1q_u32(from + i), count), vor));
+			break;
+		case 2:
+			for (; i + 4 <= width; i += 4, to += 8)
+			{
+				uint32x4_t v = vorrq_u32(vshlq_u32(vld1q_u32(from + i), count), vor);
+				uint32x4x2_t s = {{v, v}};
+				vst2q_u32(to, s);
+			}
+			break;
+		case 3:
+			for (; i + 4 <= width; i += 4, to += 12)
+			{
+				uint32x4_t v = vorrq_u32(vshlq_u32(vld1q_u32(from + i), count), vor);
+				uint32x4x3_t s = {{v, v, v}};
+				vst3q_u32(to, s);
+			}
+			break;
+		case 4:
+			for (; i + 4 <= width; i += 4, to += 16)
+			{
+				uint32x4_t v = vorrq_u32(vshlq_u32(vld1q_u32(from + i), count), vor);
+				uint32x4x4_t s = {{v, v, v, v}};
+				vst4q_u32(to, s);
+			}
+			break;
+	}
+	
+	VDP_ScaleKernel_Scalar(to, from + i, width - i, scale, shift, or);
+}
+
+#ifdef KERNEL_NEON_TBL
+static void VDP_ResolveKernel_NEON(uint32_t *to, const uint8_t *from, const uint32_t *pal, size_t width)
+{
+	//Split the palette into byte planes for table lookups
+	uint8x16x4_t pal_lo = vld4q_u8((const uint8_t*)(pal +  0));
+	uint8x16x4_t pal_1 = vld4q_u8((const uint8_t*)(pal + 16));
+	uint8x16x4_t pal_2 = vld4q_u8((const uint8_t*)(pal + 32));
+	uint8x16x4_t pal_hi = vld4q_u8((const uint8_t*)(pal + 48));
+	
+	uint8x16x4_t plane[4];
+	for (int k = 0; k < 4; k++)
+	{
+		plane[k].val[0] = pal_lo.val[k];
+		plane[k].val[1] = pal_1.val[k];
+		plane[k].val[2] = pal_2.val[k];
+		plane[k].val[3] = pal_hi.val[k];
+	}
+	
+	//Look up 16 pixels at a time
+	uint8x16_t index_and = vdupq_n_u8(VDP_PIXEL_INDEX_AND);
+	
+	size_t i = 0;
+	for (; i + 16 <= width; i += 16)
+	{
+		uint8x16_t v = vandq_u8(vld1q_u8(from + i), index_and);
+		uint8x16x4_t col;
+		col.val[0] = vqtbl4q_u8(plane[0], v);
+		col.val[1] = vqtbl4q_u8(plane[1], v);
+		col.val[2] = vqtbl4q_u8(plane[2], v);
+		col.val[3] = vqtbl4q_u8(plane[3], v);
+		vst4q_u8((uint8_t*)(to + i), col);
+	}
+	for (; i < width; i++)
+		to[i] = pal[from[i] & VDP_PIXEL_INDEX_AND];
+}
+#else
+	#define VDP_ResolveKernel_NEON VDP_ResolveKernel_Scalar
+#endif
+#endif
+
+//Kernel interface
+static const VDP_Kernels kernels[] = {
+	#ifdef KERNEL_AVX2
+		#ifdef KERNEL_SSE2
+			{"avx2", VDP_RowKernel_SSE2, VDP_SpanKernel_AVX2, VDP_ResolveKernel_AVX2, VDP_ScaleKernel_AVX2},
+		#else
+			{"avx2", VDP_RowKernel_Scalar, VDP_SpanKernel_AVX2, VDP_ResolveKernel_AVX2, VDP_ScaleKernel_AVX2},
+		#endif
+	#endif
+	#ifdef KERNEL_SSE2
+		{"sse2", VDP_RowKernel_SSE2, VDP_SpanKernel_SSE2, VDP_ResolveKernel_Scalar, VDP_ScaleKernel_SSE2},
+	#endif
+	#ifdef KERNEL_NEON
+		{"neon", VDP_RowKernel_NEON, VDP_SpanKernel_NEON, VDP_ResolveKernel_NEON, VDP_ScaleKernel_NEON},
+	#endif
+	{"scalar", VDP_RowKernel_Scalar, VDP_SpanKernel_Scalar, VDP_ResolveKernel_Scalar, VDP_ScaleKernel_Scalar},
+};
+
+static int VDP_KernelsSupported(const VDP_Kernels *set)
+{
+	#ifdef KERNEL_AVX2
+		if (set->resolve == VDP_ResolveKernel_AVX2)
+			return VDP_HasAVX2();
+	#endif
+	(void)set;
+	return 1;
+}
+
+const VDP_Kernels *VDP_GetKernels()
+{
+	//Use the requested kernels if they're supported
+	const char *env = getenv("SCP_VDP_KERNEL");
+	
+	for (size_t i = 0; i < sizeof(kernels) / sizeof(*kernels); i++)
+		if (env != NULL && strcmp(env, kernels[i].name) == 0 && VDP_KernelsSupported(&kernels[i]))
+			return &kernels[i];
+	
+	//Otherwise use the best supported kernels (the scalar kernels always are)
+	for (size_t i = 0;; i++)
+		if (VDP_KernelsSupported(&kernels[i]))
+			return &kernels[i];
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+//Screen pixel structure (colour index in the low bits, mask bits above it)
+#define VDP_PIXEL_INDEX_AND  0x3F
+#define VDP_MASK_PLANEPRI    (1 << 6)
+#define VDP_MASK_SPRITE      (1 << 7)
+#define VDP_MASK_AND         (VDP_MASK_PLANEPRI | VDP_MASK_SPRITE)
+
+//Kernel types
+//Composites one 8 pixel pattern row onto a line of screen pixels. Each opaque pixel ORs 'or' into the pixel's mask,
+//and replaces the pixel's colour index with 'pal | v' unless the mask already had any bit of 'and' set.
+typedef void (*VDP_RowKernel)(uint8_t *to, const uint8_t *from, uint8_t pal, uint8_t and, uint8_t or);
+
+//Composites a run of pre-drawn plane pixels ('pal | v | or', 0 where transparent) onto a line of screen pixels, the same way as the row kernel
+typedef void (*VDP_SpanKernel)(uint8_t *to, const uint8_t *from, size_t width, uint8_t and);
+
+//Resolves a line of screen pixels to colours through the given palette
+typedef void (*VDP_ResolveKernel)(uint32_t *to, const uint8_t *from, const uint32_t *pal, size_t width);
+
+//Converts a line of resolved colours for presentation, each pixel becomes '(v >> shift) | or' and is written 'scale' times
+typedef void (*VDP_ScaleKernel)(uint32_t *to, const uint32_t *from, size_t width, unsigned scale, unsigned shift, uint32_t or);
+
+typedef struct
+{
+	const char *name;
+	VDP_RowKernel row;
+	VDP_SpanKernel span;
+	VDP_ResolveKernel resolve;
+	VDP_ScaleKernel scale;
+} VDP_Kernels;
+
+//Kernel interface
+const VDP_Kernels *VDP_GetKernels();
@@ -33,6 +33,9 @@ void GM_Level()
 	if (demo >= 0)
 		{;} //sfx	bgm_Fade,0,1,1 ; fade out music //TODO
 	
+	//Start decompressing the level's assets in the background
+	PreloadLevel(level_id);
+	
 	//Clear the pattern load queue and fade out
 	ClearPLC();
 	PaletteFadeOut();
@@ -226,7 +229,7 @@ void GM_Level()
 			ExecuteObjects();
 			BuildSprites();
 			RunPLC();
-		} while (objects[4].pos.s.x != objects[4].scratch.u16[4] || plc_buffer[0].art != NULL);
+		} while (objects[4].pos.s.x != objects[4].scratch.u16[4] || PLCPending());
 	}
 	
 	//Load level
@@ -10,6 +10,7 @@
 #include "Kosinski.h"
 #include "PLC.h"
 
+#include <stdio.h>
 #include <string.h>
 
 //SSRG memory
@@ -55,28 +56,12 @@ static const uint16_t pal_ssrg[] = {
 //SSRG planes
 static void CopyTilemap_Single(uint16_t v, size_t offset, size_t width, size_t height)
 {
-	while (height-- > 0)
-	{
-		VDP_SeekVRAM(offset);
-		for (size_t x = 0; x < width; x++)
-			VDP_WriteVRAM((const uint8_t*)&v, 2);
-		offset += PLANE_WIDTH * 2;
-	}
+	VDP_FillVRAMRect(offset, PLANE_WIDTH * 2, v, width, height);
 }
 
-
 static void CopyTilemap_Add(const uint8_t *tilemap, size_t offset, size_t width, size_t height, uint16_t add)
 {
-	while (height-- > 0)
-	{
-		VDP_SeekVRAM(offset);
-		for (size_t x = 0; x < width; x++)
-		{
-			uint16_t v = ((*tilemap++ << 8) | (*tilemap++ << 0)) + add;
-			VDP_WriteVRAM((const uint8_t*)&v, 2);
-		}
-		offset += PLANE_WIDTH * 2;
-	}
+	VDP_WriteVRAMRect(offset, PLANE_WIDTH * 2, tilemap, width, height, add);
 }
 
 static void SRG_ScrollFG()
@@ -118,14 +103,13 @@ static void SRG_DrawFG()
 		const uint8_t *mapp = ssrg_memory + scroll_off;
 		
 		//Write plane data
+		uint16_t v[3];
 		for (int i = 0; i < 3; i++)
 		{
-			uint16_t v = ((mapp[0] << 8) | (mapp[1] << 0)) + 0x2000;
-			VDP_SeekVRAM(offset);
-			VDP_WriteVRAM((const uint8_t*)&v, 2);
-			offset += PLANE_WIDTH << 1;
+			v[i] = ((mapp[0] << 8) | (mapp[1] << 0)) + 0x2000;
 			mapp += 0x46;
 		}
+		VDP_WriteVRAMWords(offset, PLANE_WIDTH << 1, v, 3);
 	}
 	else
 	{
@@ -575,11 +559,21 @@ void GM_SSRG()
 	NemDec(art_link);
 	
 	//Decompress mappings
-	KosDec(map_link, ssrg_memory);
-	CopyTilemap(ssrg_memory, MAP_PLANE(VRAM_FG, 4, 24) + PLANE_WIDEADD + (PLANE_TALLADD * 2), 32, 1);
+	if (KosDec(map_link, ssrg_memory, sizeof(ssrg_memory)) != NULL)
+		CopyTilemap(ssrg_memory, MAP_PLANE(VRAM_FG, 4, 24) + PLANE_WIDEADD + (PLANE_TALLADD * 2), 32, 1);
+	else
+		puts("GM_SSRG: Link mappings are corrupt or too large");
 	
-	KosDec(map_main, &ssrg_memory[0x0000]);
-	KosDec(map_square, &ssrg_memory[0x4000]);
+	if (KosDec(map_main, &ssrg_memory[0x0000], sizeof(ssrg_memory)) == NULL)
+	{
+		puts("GM_SSRG: Main mappings are corrupt or too large");
+		memset(ssrg_memory, 0, sizeof(ssrg_memory));
+	}
+	if (KosDec(map_square, &ssrg_memory[0x4000], sizeof(ssrg_memory) - 0x4000) == NULL)
+	{
+		puts("GM_SSRG: Square mappings are corrupt or too large");
+		memset(&ssrg_memory[0x4000], 0, sizeof(ssrg_memory) - 0x4000);
+	}
 	
 	//Copy palette
 	memcpy(&dry_palette_dup[0][0], pal_ssrg, sizeof(pal_ssrg));
@@ -166,6 +166,10 @@ void GM_Title()
 	//Run title screen for 376 frames
 	demo_length = 376;
 	
+	//Start decompressing the next demo's level in the background
+	if (title_demos[demo_num & 7] != 0x600)
+		PreloadLevel(title_demos[demo_num & 7]);
+	
 	//Clear objects
 	#ifdef SCP_FIX_BUGS
 		memset(&objects[2], 0, sizeof(Object));
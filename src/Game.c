@@ -92,17 +92,14 @@ void WriteVRAMBuffers()
 	ReadJoypads();
 	
 	//Copy palette
-	VDP_SeekCRAM(0);
 	if (wtr_state)
-		VDP_WriteCRAM(&wet_palette[0][0], 0x40);
+		VDP_QueueCRAM(0, &wet_palette[0][0], 0x40);
 	else
-		VDP_WriteCRAM(&dry_palette[0][0], 0x40);
+		VDP_QueueCRAM(0, &dry_palette[0][0], 0x40);
 	
 	//Copy buffers
-	VDP_SeekVRAM(VRAM_SPRITES);
-	VDP_WriteVRAM((const uint8_t*)sprite_buffer, sizeof(sprite_buffer));
-	VDP_SeekVRAM(VRAM_HSCROLL);
-	VDP_WriteVRAM((const uint8_t*)hscroll_buffer, sizeof(hscroll_buffer));
+	VDP_QueueVRAM(VRAM_SPRITES, (const uint8_t*)sprite_buffer, sizeof(sprite_buffer));
+	VDP_QueueVRAM(VRAM_HSCROLL, (const uint8_t*)hscroll_buffer, sizeof(hscroll_buffer));
 }
 
 void VBlank()
@@ -139,24 +136,20 @@ void VBlank()
 			ReadJoypads();
 			
 			//Copy palette
-			VDP_SeekCRAM(0);
 			if (wtr_state)
-				VDP_WriteCRAM(&wet_palette[0][0], 0x40);
+				VDP_QueueCRAM(0, &wet_palette[0][0], 0x40);
 			else
-				VDP_WriteCRAM(&dry_palette[0][0], 0x40);
+				VDP_QueueCRAM(0, &dry_palette[0][0], 0x40);
 			
 			//Copy buffers
 			VDP_SetHIntPosition(hbla_pos);
-			VDP_SeekVRAM(VRAM_SPRITES);
-			VDP_WriteVRAM((const uint8_t*)sprite_buffer, sizeof(sprite_buffer));
-			VDP_SeekVRAM(VRAM_HSCROLL);
-			VDP_WriteVRAM((const uint8_t*)hscroll_buffer, sizeof(hscroll_buffer));
+			VDP_QueueVRAM(VRAM_SPRITES, (const uint8_t*)sprite_buffer, sizeof(sprite_buffer));
+			VDP_QueueVRAM(VRAM_HSCROLL, (const uint8_t*)hscroll_buffer, sizeof(hscroll_buffer));
 			
 			//Update Sonic's art
 			if (sonframe_chg)
 			{
-				VDP_SeekVRAM(0xF000);
-				VDP_WriteVRAM(sgfx_buffer, SONIC_DPLC_SIZE);
+				VDP_QueueVRAM(0xF000, sgfx_buffer, SONIC_DPLC_SIZE);
 				sonframe_chg = false;
 			}
 			
@@ -196,24 +189,20 @@ void VBlank()
 			ReadJoypads();
 			
 			//Copy palette
-			VDP_SeekCRAM(0);
 			if (wtr_state)
-				VDP_WriteCRAM(&wet_palette[0][0], 0x40);
+				VDP_QueueCRAM(0, &wet_palette[0][0], 0x40);
 			else
-				VDP_WriteCRAM(&dry_palette[0][0], 0x40);
+				VDP_QueueCRAM(0, &dry_palette[0][0], 0x40);
 			
 			//Copy buffers
 			VDP_SetHIntPosition(hbla_pos);
-			VDP_SeekVRAM(VRAM_SPRITES);
-			VDP_WriteVRAM((const uint8_t*)sprite_buffer, sizeof(sprite_buffer));
-			VDP_SeekVRAM(VRAM_HSCROLL);
-			VDP_WriteVRAM((const uint8_t*)hscroll_buffer, sizeof(hscroll_buffer));
+			VDP_QueueVRAM(VRAM_SPRITES, (const uint8_t*)sprite_buffer, sizeof(sprite_buffer));
+			VDP_QueueVRAM(VRAM_HSCROLL, (const uint8_t*)hscroll_buffer, sizeof(hscroll_buffer));
 			
 			//Update Sonic's art
 			if (sonframe_chg)
 			{
-				VDP_SeekVRAM(0xF000);
-				VDP_WriteVRAM(sgfx_buffer, SONIC_DPLC_SIZE);
+				VDP_QueueVRAM(0xF000, sgfx_buffer, SONIC_DPLC_SIZE);
 				sonframe_chg = false;
 			}
 			
@@ -3,92 +3,176 @@
 #include "Kosinski.h"
 
 #include <stdbool.h>
+#include <string.h>
 
-static uint16_t descriptor_field;
-static uint32_t descriptor_bits_remaining;
-const uint8_t *source;
+//Kosinski state
+typedef struct
+{
+	const uint8_t *source;
+	uint32_t descriptor_field; //Next descriptor bit is the lowest one
+	unsigned descriptor_bits_remaining;
+} KosinskiState;
 
-static void RefreshDescriptorField()
+static inline void RefreshDescriptorField(KosinskiState *state)
 {
-	descriptor_field = source[0] | (source[1] << 8);
-	source += 2;
+	state->descriptor_field = state->source[0] | (state->source[1] << 8);
+	state->source += 2;
 	
-	descriptor_bits_remaining = 16;
+	state->descriptor_bits_remaining = 16;
 }
 
-static bool GetDescriptorBit()
+static inline bool GetDescriptorBit(KosinskiState *state)
 {
-	bool bit = descriptor_field & 1;
+	bool bit = state->descriptor_field & 1;
 	
-	descriptor_field >>= 1;
+	state->descriptor_field >>= 1;
 	
-	if (--descriptor_bits_remaining == 0)
-		RefreshDescriptorField();
+	//The next field is read as soon as this one runs out, before any data following this bit
+	if (--state->descriptor_bits_remaining == 0)
+		RefreshDescriptorField(state);
 	
 	return bit;
 }
 
-uint8_t* KosDec(const uint8_t *_source, void *_destination)
+static inline unsigned GetDescriptorBits(KosinskiState *state, unsigned bits)
 {
-	source = _source;
-	uint8_t *destination = _destination;
+	//Take several bits at once if the field has enough of them
+	if (bits > state->descriptor_bits_remaining)
+	{
+		unsigned value = 0;
+		for (unsigned i = 0; i < bits; i++)
+			value |= GetDescriptorBit(state) << i;
+		return value;
+	}
 	
-	RefreshDescriptorField();
+	unsigned value = state->descriptor_field & ((1 << bits) - 1);
 	
-	for (;;)
+	state->descriptor_field >>= bits;
+	
+	if ((state->descriptor_bits_remaining -= bits) == 0)
+		RefreshDescriptorField(state);
+	
+	return value;
+}
+
+static inline void CopyMatch(uint8_t *destination, size_t distance, size_t length)
+{
+	const uint8_t *from = destination - distance;
+	
+	if (distance == 1)
 	{
-		if (GetDescriptorBit())
+		//Run of one byte
+		memset(destination, *from, length);
+		return;
+	}
+	
+	if (distance >= 8)
+	{
+		//Copy 8 bytes at a time, each chunk only reads bytes that have already been written
+		for (; length >= 8; length -= 8)
 		{
-			*destination++ = *source++;
+			uint64_t chunk;
+			memcpy(&chunk, from, 8);
+			memcpy(destination, &chunk, 8);
+			from += 8;
+			destination += 8;
 		}
-		else
+	}
+	
+	while (length-- != 0)
+		*destination++ = *from++;
+}
+
+uint8_t *KosDec(const uint8_t *source, void *destination, size_t size)
+{
+	KosinskiState state;
+	state.source = source;
+	
+	uint8_t *start = destination;
+	uint8_t *end = start + size;
+	uint8_t *to = start;
+	
+	RefreshDescriptorField(&state);
+	
+	for (;;)
+	{
+		if (state.descriptor_field & 1)
 		{
-			uint32_t length = 0;
-			int offset;
+			//Copy a run of literals, up to the end of the descriptor field
+			unsigned run = 1;
+			while (run < state.descriptor_bits_remaining && (state.descriptor_field >> run) & 1)
+				run++;
 			
-			if (!GetDescriptorBit())
+			if (run > (size_t)(end - to))
+				return NULL;
+			
+			if (run == state.descriptor_bits_remaining)
 			{
-				if (GetDescriptorBit())
-					length += 2;
+				//The last literal's byte comes after the next descriptor field
+				memcpy(to, state.source, run - 1);
+				state.source += run - 1;
+				to += run - 1;
 				
-				if (GetDescriptorBit())
-					++length;
+				RefreshDescriptorField(&state);
+				*to++ = *state.source++;
+			}
+			else
+			{
+				memcpy(to, state.source, run);
+				state.source += run;
+				to += run;
 				
-				++length;
+				state.descriptor_field >>= run;
+				state.descriptor_bits_remaining -= run;
+			}
+		}
+		else
+		{
+			size_t length;
+			size_t distance;
+			
+			if (!(GetDescriptorBits(&state, 2) & 2))
+			{
+				//Inline match, the length bits are stored high bit first
+				unsigned bits = GetDescriptorBits(&state, 2);
+				length = ((bits & 1) << 1 | bits >> 1) + 2;
 				
-				offset = -0x100 + *source++;
+				distance = 0x100 - *state.source++;
 			}
 			else
 			{
-				uint8_t d0 = *source++;
-				uint8_t d1 = *source++;
+				//Full match
+				uint8_t d0 = *state.source++;
+				uint8_t d1 = *state.source++;
 				
-				offset = -0x2000 + (((d1 & 0xF8) << 5) | d0);
+				distance = 0x2000 - (((d1 & 0xF8) << 5) | d0);
 				length = d1 & 7;
 				
 				if (length != 0)
 				{
-					++length;
+					length += 2;
 				}
 				else
 				{
-					length = *source++;
+					length = *state.source++;
 					
 					if (length == 0)
 						break;
 					
 					if (length == 1)
 						continue;
+					
+					++length;
 				}
 			}
 			
-			do
-			{
-				*destination = destination[offset];
-				++destination;
-			} while (length-- != 0);
+			if (distance > (size_t)(to - start) || length > (size_t)(end - to))
+				return NULL;
+			
+			CopyMatch(to, distance, length);
+			to += length;
 		}
 	}
 	
-	return destination;
+	return to;
 }
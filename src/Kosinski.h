@@ -1,5 +1,6 @@
 #pragma once
 
 #include <stdint.h>
+#include <stddef.h>
 
-uint8_t *KosDec(const uint8_t *source, void *destination);
+uint8_t *KosDec(const uint8_t *source, void *destination, size_t size); //Returns the end of the output, or NULL if it's corrupt or doesn't fit in 'size' bytes
@@ -5,11 +5,14 @@
 #include "LevelScroll.h"
 #include "LevelDraw.h"
 #include "Kosinski.h"
+#include "AssetCache.h"
+#include "Preload.h"
 #include "PLC.h"
 #include "Palette.h"
 
 #include <Backend/VDP.h>
 
+#include <stdio.h>
 #include <string.h>
 
 //Level layouts
@@ -612,13 +615,63 @@ void AddPoints(uint16_t points)
 }
 
 //Level loading
+static void DecompressMap256(const uint8_t *map256)
+{
+	//Let the preload worker finish these chunks if it's already started on them
+	WaitPreload(map256);
+	
+	//Copy chunks from the asset cache if we've decompressed them before
+	size_t size;
+	const uint8_t *cached = LockAsset(map256, &size);
+	if (cached != NULL)
+	{
+		memcpy(level_map256, cached, size);
+		UnlockAsset(cached);
+		return;
+	}
+	
+	//Decompress chunks and keep a copy in the asset cache
+	uint8_t *end = KosDec(map256, level_map256, sizeof(level_map256));
+	if (end == NULL)
+	{
+		//Don't leave a level made of whatever chunks were there before
+		puts("DecompressMap256: Chunks are corrupt or too large");
+		memset(level_map256, 0, sizeof(level_map256));
+		return;
+	}
+	
+	size = end - level_map256;
+	uint8_t *asset = AddAsset(map256, size);
+	if (asset != NULL)
+	{
+		memcpy(asset, level_map256, size);
+		UnlockAsset(asset);
+	}
+}
+
+void PreloadLevel(uint16_t id)
+{
+	//Get header
+	if (LEVEL_ZONE(id) >= ZoneId_Num)
+		return;
+	const LevelHeader *header = &level_header[LEVEL_ZONE(id)];
+	
+	//Decompress the level's chunk maps and art in the background
+	PreloadKosinski(header->map256, sizeof(level_map256));
+	if (header->plc1 != 0)
+		PreloadPLC(header->plc1);
+	PreloadPLC(PlcId_Main2);
+	if (header->plc2 != 0)
+		PreloadPLC(header->plc2);
+}
+
 void LoadLevelMaps()
 {
 	//Get header
 	const LevelHeader *header = &level_header[LEVEL_ZONE(level_id)];
 	
 	//Load chunk maps and tile map
-	KosDec(header->map256, level_map256);
+	DecompressMap256(header->map256);
 	memcpy(level_map16, header->map16, header->map16_size);
 }
 
@@ -729,7 +782,7 @@ void LevelDataLoad()
 	const LevelHeader *header = &level_header[LEVEL_ZONE(level_id)];
 	
 	//Load chunk maps and tile map
-	KosDec(header->map256, level_map256);
+	DecompressMap256(header->map256);
 	memcpy(level_map16, header->map16, header->map16_size);
 	
 	//Load level layout
@@ -157,6 +157,7 @@ extern uint16_t sprite_anim_3buf;
 void AddPoints(uint16_t points);
 
 //Level functions
+void PreloadLevel(uint16_t id);
 void LoadLevelMaps();
 void LoadLevelLayout();
 void LoadMap16(ZoneId zone);
@@ -52,49 +52,54 @@ void GetBlockData(const uint8_t **meta, const uint8_t **block, int16_t sx, int16
 	*block = level_map16 + (tile << 3);
 }
 
-#define WRITE_TILE(off, xor)                                \
+#define READ_TILE(to, xor)                                  \
 {                                                           \
-	VDP_SeekVRAM(offset + (off));                           \
-	uint16_t v = ((block[0] << 8) | (block[1] << 0)) ^ xor; \
+	to = ((block[0] << 8) | (block[1] << 0)) ^ xor;         \
 	block += 2;                                             \
-	VDP_WriteVRAM((const uint8_t*)&v, 2);                   \
 }
 
 void DrawBlock(const uint8_t *meta, const uint8_t *block, size_t offset)
 {
 	uint8_t flag = meta[0];
 	
+	//Read block tiles in the order they appear on the plane
+	uint16_t tile[2][2];
+	
 	if (flag & 0x08) //X flip
 	{
 		if (flag & 0x10) //Y flip
 		{
-			WRITE_TILE((PLANE_WIDTH << 1) + 2, 0x1800)
-			WRITE_TILE((PLANE_WIDTH << 1) + 0, 0x1800)
-			WRITE_TILE(                     2, 0x1800)
-			WRITE_TILE(                     0, 0x1800)
+			READ_TILE(tile[1][1], 0x1800)
+			READ_TILE(tile[1][0], 0x1800)
+			READ_TILE(tile[0][1], 0x1800)
+			READ_TILE(tile[0][0], 0x1800)
 		}
 		else
 		{
-			WRITE_TILE(                     2, 0x0800)
-			WRITE_TILE(                     0, 0x0800)
-			WRITE_TILE((PLANE_WIDTH << 1) + 2, 0x0800)
-			WRITE_TILE((PLANE_WIDTH << 1) + 0, 0x0800)
+			READ_TILE(tile[0][1], 0x0800)
+			READ_TILE(tile[0][0], 0x0800)
+			READ_TILE(tile[1][1], 0x0800)
+			READ_TILE(tile[1][0], 0x0800)
 		}
 	}
 	else if (flag & 0x10) //Y flip
 	{
-		WRITE_TILE((PLANE_WIDTH << 1) + 0, 0x1000)
-		WRITE_TILE((PLANE_WIDTH << 1) + 2, 0x1000)
-		WRITE_TILE(                     0, 0x1000)
-		WRITE_TILE(                     2, 0x1000)
+		READ_TILE(tile[1][0], 0x1000)
+		READ_TILE(tile[1][1], 0x1000)
+		READ_TILE(tile[0][0], 0x1000)
+		READ_TILE(tile[0][1], 0x1000)
 	}
 	else
 	{
-		WRITE_TILE(                     0, 0x0000)
-		WRITE_TILE(                     2, 0x0000)
-		WRITE_TILE((PLANE_WIDTH << 1) + 0, 0x0000)
-		WRITE_TILE((PLANE_WIDTH << 1) + 2, 0x0000)
+		READ_TILE(tile[0][0], 0x0000)
+		READ_TILE(tile[0][1], 0x0000)
+		READ_TILE(tile[1][0], 0x0000)
+		READ_TILE(tile[1][1], 0x0000)
 	}
+	
+	//Write block tiles
+	VDP_WriteVRAMWords(offset, 2, tile[0], 2);
+	VDP_WriteVRAMWords(offset + (PLANE_WIDTH << 1), 2, tile[1], 2);
 }
 
 void DrawBlocks_LR_2(size_t offset, size_t pos, int16_t sx, int16_t sy, int16_t x, int16_t y, uint8_t *layout, size_t width)
@@ -367,8 +372,7 @@ void AnimateLevelGfx()
 				uint8_t frame = level_anim[0].frame++ & 1;
 				
 				//Write to VRAM
-				VDP_SeekVRAM(0x6F00);
-				VDP_WriteVRAM(art_ghz_waterfall + (frame * 8 * 0x20), 8 * 0x20);
+				VDP_QueueVRAM(0x6F00, art_ghz_waterfall + (frame * 8 * 0x20), 8 * 0x20);
 			}
 			
 			//Animate large flowers
@@ -379,8 +383,7 @@ void AnimateLevelGfx()
 				uint8_t frame = level_anim[1].frame++ & 1;
 				
 				//Write to VRAM
-				VDP_SeekVRAM(0x6B80);
-				VDP_WriteVRAM(art_ghz_flower_large + (frame * 16 * 0x20), 16 * 0x20);
+				VDP_QueueVRAM(0x6B80, art_ghz_flower_large + (frame * 16 * 0x20), 16 * 0x20);
 			}
 			
 			//Animate small flowers
@@ -396,8 +399,7 @@ void AnimateLevelGfx()
 					level_anim[2].time = 127;
 				
 				//Write to VRAM
-				VDP_SeekVRAM(0x6D80);
-				VDP_WriteVRAM(art_ghz_flower_small + (frame * 12 * 0x20), 12 * 0x20);
+				VDP_QueueVRAM(0x6D80, art_ghz_flower_small + (frame * 12 * 0x20), 12 * 0x20);
 			}
 			break;
 	}
@@ -2,6 +2,13 @@
 #include <Backend/VDP.h>
 
 #include "Game.h"
+#include "AssetCache.h"
+#include "Preload.h"
+#include "PLC.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 //Sonic 1 ROM header
 static const MD_Header s1_header = {
@@ -17,8 +24,72 @@ static const MD_Header s1_header = {
 //MegaDrive entry point
 int main(int argc, char *argv[])
 {
-	(void)argc;
-	(void)argv;
+	//Handle command line options
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--fast-forward") == 0)
+		{
+			//Start fast-forwarding
+			VDP_SetFastForward(true);
+		}
+		else if (strncmp(argv[i], "--fast-forward=", 15) == 0)
+		{
+			//Start fast-forwarding, drawing every Nth frame
+			VDP_SetFastForwardRate(strtoul(argv[i] + 15, NULL, 0));
+			VDP_SetFastForward(true);
+		}
+		else if (strncmp(argv[i], "--fast-forward-rate=", 20) == 0)
+		{
+			//Draw every Nth frame when fast-forward is toggled
+			VDP_SetFastForwardRate(strtoul(argv[i] + 20, NULL, 0));
+		}
+		else if (strncmp(argv[i], "--renderer=", 11) == 0)
+		{
+			//Use the given VDP renderer
+			if (VDP_SetRenderer(argv[i] + 11))
+				return 1;
+		}
+		else if (strncmp(argv[i], "--asset-cache=", 14) == 0)
+		{
+			//Limit the asset cache to N KiB
+			SetAssetCacheLimit(strtoul(argv[i] + 14, NULL, 0) * 0x400);
+		}
+		else if (strncmp(argv[i], "--preload=", 10) == 0)
+		{
+			//Turn background asset decompression on or off
+			SetPreload(strtoul(argv[i] + 10, NULL, 0) != 0);
+		}
+		else if (strcmp(argv[i], "--plc=classic") == 0)
+		{
+			//Load queued art a few tiles a frame, like the original
+			SetPLCMode(PlcMode_Classic);
+		}
+		else if (strcmp(argv[i], "--plc=budget") == 0)
+		{
+			//Load as much queued art as fits in a time budget each frame
+			SetPLCMode(PlcMode_Budget);
+		}
+		else if (strncmp(argv[i], "--plc-budget=", 13) == 0)
+		{
+			//Load as much queued art as fits in N microseconds each frame
+			SetPLCBudget(strtoul(argv[i] + 13, NULL, 0));
+			SetPLCMode(PlcMode_Budget);
+		}
+		else if (strcmp(argv[i], "--plc=instant") == 0)
+		{
+			//Load queued art all at once
+			SetPLCMode(PlcMode_Instant);
+		}
+		else
+		{
+			printf("Unknown option %s\n", argv[i]);
+		}
+	}
+	
+	//Report and free the asset cache when the game quits, after stopping the preload worker
+	atexit(QuitAssetCache);
+	atexit(QuitPreload);
+	atexit(QuitPLC);
 	
 	//Start MegaDrive
 	return MegaDrive_Start(&s1_header);
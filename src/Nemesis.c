@@ -2,14 +2,21 @@
 
 #include "Nemesis.h"
 
-#include <stdbool.h>
-#include <stddef.h>
+#include "AssetCache.h"
 
 #include <Backend/VDP.h>
 
-uint8_t nemesis_buffer[0x200];
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+//Nemesis constants
+#define NEM_INLINE_PREFIX 0xFC //Codes starting with 6 set bits are an inline run instead of a table code
+#define NEM_MAX_CODE      13   //Longest symbol in bits (6 bit inline prefix and 7 bit run)
+#define NEM_BATCH_TILES   64   //Tiles decoded at a time before being written to VRAM
 
-void NemDecPrepare(NemesisState *state)
+//Builds the code table, each entry is the code's length in bits 8-11 and its run in bits 0-6 (length - 1 in bits 4-6, nibble in bits 0-3)
+static void NemDecPrepare(NemesisState *state)
 {
 	uint8_t d0;
 	uint8_t d7;
@@ -38,185 +45,151 @@ void NemDecPrepare(NemesisState *state)
 		d7 |= d0 & 0x70;
 		d0 &= 0xF;
 		
-		uint8_t d1 = 8 - d0;
+		//Fill every table entry that starts with this code
+		uint8_t code = *state->source++;
+		if (d0 == 0 || d0 > 8 || (code >> d0) != 0)
+			continue;
 		
-		if (d1 == 0)
-		{
-			size_t index = *state->source++ * 2;
-			
-			state->dictionary[index] = d0;
-			state->dictionary[index+1] = d7;
-		}
-		else
-		{
-			size_t index = (*state->source++ << d1) * 2;
-			uint16_t d5 = (1 << d1) - 1;
-			
-			do
-			{
-				state->dictionary[index++] = d0;
-				state->dictionary[index++] = d7;
-			} while (d5-- != 0);
-		}
+		uint8_t d1 = 8 - d0;
+		uint16_t *entry = &state->table[code << d1];
+		for (size_t i = 0; i < (1U << d1); i++)
+			entry[i] = (d0 << 8) | d7;
 	}
 }
 
-//This function needed a lot of restructuring to look good in C
-void NemDecRun(NemesisState *state)
+//Tops up the bit buffer a byte at a time, so we never read further ahead than the symbol being decoded needs
+static inline void NemDecRefill(NemesisState *state)
 {
-	for (;;)
+	while (state->bit_count < NEM_MAX_CODE)
 	{
-		while (state->d0-- != 0)
+		state->bits = (state->bits << 8) | *state->source++;
+		state->bit_count += 8;
+	}
+}
+
+void NemDecInit(NemesisState *state, const uint8_t *source)
+{
+	//Read header
+	uint16_t header = (source[0] << 8) | source[1];
+	state->source = source + 2;
+	state->xor_mode = (header & 0x8000) != 0;
+	state->tiles = header & 0x7FFF;
+	
+	//Read code table
+	memset(state->table, 0, sizeof(state->table));
+	NemDecPrepare(state);
+	
+	//Start decoding
+	state->bits = 0;
+	state->bit_count = 0;
+	state->xor_row = 0;
+	state->run = 0;
+	state->nibble = 0;
+}
+
+size_t NemDecTiles(NemesisState *state, uint8_t *destination, size_t tiles)
+{
+	if (tiles > state->tiles)
+		tiles = state->tiles;
+	state->tiles -= tiles;
+	
+	for (size_t rows = tiles << 3; rows != 0; rows--)
+	{
+		//Fill a row of 8 nibbles, one run at a time
+		uint32_t row = 0;
+		unsigned row_nibbles = 0;
+		
+		for (;;)
 		{
-			state->d4 <<= 4;
-			state->d4 |= state->d1;
-			
-			if (--state->d3 == 0)
+			if (state->run == 0)
 			{
-				if (state->xor_mode)
+				//Decode the next run
+				NemDecRefill(state);
+				
+				uint8_t index = (state->bits >> (state->bit_count - 8)) & 0xFF;
+				uint8_t value;
+				if (index < NEM_INLINE_PREFIX)
 				{
-					state->d2 ^= state->d4;
-					
-					if (state->vram_mode)
-					{
-						uint32_t wdw = LESWAP_32(state->d2);
-						VDP_WriteVRAM((const uint8_t*)&wdw, 4);
-					}
-					else
-					{
-						// NemDec_WriteAndAdvance_XOR
-						*state->destination++ = (state->d2 >> 8 * 3) & 0xFF;
-						*state->destination++ = (state->d2 >> 8 * 2) & 0xFF;
-						*state->destination++ = (state->d2 >> 8 * 1) & 0xFF;
-						*state->destination++ = (state->d2 >> 8 * 0) & 0xFF;
-					}
+					uint16_t entry = state->table[index];
+					state->bit_count -= entry >> 8;
+					value = entry & 0xFF;
 				}
 				else
 				{
-					if (state->vram_mode)
-					{
-						uint32_t wdw = LESWAP_32(state->d4);
-						VDP_WriteVRAM((const uint8_t*)&wdw, 4);
-					}
-					else
-					{
-						// NemDec_WriteAndAdvance
-						*state->destination++ = (state->d4 >> 8 * 3) & 0xFF;
-						*state->destination++ = (state->d4 >> 8 * 2) & 0xFF;
-						*state->destination++ = (state->d4 >> 8 * 1) & 0xFF;
-						*state->destination++ = (state->d4 >> 8 * 0) & 0xFF;
-					}
+					state->bit_count -= 6;
+					value = (state->bits >> (state->bit_count - 7)) & 0x7F;
+					state->bit_count -= 7;
 				}
 				
-				if (--state->remaining == 0)
-					return;
-				
-				state->d4 = 0;
-				state->d3 = 8;
-			}
-		}
-		
-		size_t index = (state->d5 >> (state->d6 - 8)) & 0xFF;
-		
-		if (index < 0xFC)
-		{
-			index *= 2;
-			
-			state->d6 -= state->dictionary[index];
-			
-			if (state->d6 < 9)
-			{
-				state->d6 += 8;
-				
-				state->d5 <<= 8;
-				state->d5 |= *state->source++;
+				state->run = ((value >> 4) & 7) + 1;
+				state->nibble = value & 0xF;
 			}
 			
-			state->d0 = state->d1 = state->dictionary[index + 1];
-			
-			state->d1 &= 0xF;
-			state->d0 &= 0xF0;
-		}
-		else
-		{
-			state->d6 -= 6;
-			
-			if (state->d6 < 9)
-			{
-				state->d6 += 8;
-				
-				state->d5 <<= 8;
-				state->d5 |= *state->source++;
-			}
+			//Write as much of the run as fits in the row
+			unsigned take = 8 - row_nibbles;
+			if (take > state->run)
+				take = state->run;
 			
-			state->d6 -= 7;
+			uint32_t fill = state->nibble * 0x11111111U;
+			if (take == 8)
+				row = fill;
+			else
+				row = (row << (take << 2)) | (fill >> ((8 - take) << 2));
 			
-			state->d0 = state->d1 = state->d5 >> state->d6;
-			
-			state->d1 &= 0xF;
-			state->d0 &= 0x70;
-			
-			if (state->d6 < 9)
-			{
-				state->d6 += 8;
-				
-				state->d5 <<= 8;
-				state->d5 |= *state->source++;
-			}
+			state->run -= take;
+			if ((row_nibbles += take) == 8)
+				break;
 		}
 		
-		state->d0 >>= 4;
+		//Write row
+		if (state->xor_mode)
+			row = state->xor_row ^= row;
 		
-		++state->d0;
+		*destination++ = (row >> 8 * 3) & 0xFF;
+		*destination++ = (row >> 8 * 2) & 0xFF;
+		*destination++ = (row >> 8 * 1) & 0xFF;
+		*destination++ = (row >> 8 * 0) & 0xFF;
 	}
-}
-
-static void NemDecMain(NemesisState *state)
-{
-	state->dictionary = nemesis_buffer;
 	
-	uint16_t header = (state->source[0] << 8) | state->source[1];
-	state->source += 2;
-	
-	state->xor_mode = header & 0x8000;
-	
-	state->remaining = (header << 3) & 0xFFFF;
-	
-	state->d3 = 8;
-	state->d2 = 0;
-	state->d4 = 0;
-	
-	NemDecPrepare(state);
-	
-	state->d5 = (state->source[0] << 8) | state->source[1];
-	state->source += 2;
-	
-	state->d6 = 0x10;
-	
-	// These lines are new, to suit the restructured NemDecRun
-	state->d0 = 0;
-	//state->d1 = 0; // This line isn't actually necessary
-	
-	NemDecRun(state);
+	return tiles;
 }
 
 void NemDec(const uint8_t *source)
 {
+	//Upload art straight from the asset cache if we've decoded it before
+	size_t size;
+	const uint8_t *cached = LockAsset(source, &size);
+	if (cached != NULL)
+	{
+		VDP_WriteVRAM(cached, size);
+		UnlockAsset(cached);
+		return;
+	}
+	
 	NemesisState state;
+	NemDecInit(&state, source);
 	
-	state.source = source;
-	state.vram_mode = true;
+	//Decode into the asset cache if there's room for it
+	size = state.tiles * 0x20;
+	uint8_t *asset = AddAsset(source, size);
+	if (asset != NULL)
+	{
+		NemDecTiles(&state, asset, state.tiles);
+		VDP_WriteVRAM(asset, size);
+		UnlockAsset(asset);
+		return;
+	}
 	
-	NemDecMain(&state);
+	//Write whole batches of tiles to VRAM
+	uint8_t buffer[NEM_BATCH_TILES * 0x20];
+	size_t tiles;
+	while ((tiles = NemDecTiles(&state, buffer, NEM_BATCH_TILES)) != 0)
+		VDP_WriteVRAM(buffer, tiles * 0x20);
 }
 
 void NemDecToRAM(const uint8_t *source, uint8_t *destination)
 {
 	NemesisState state;
-	
-	state.source = source;
-	state.destination = destination;
-	state.vram_mode = false;
-	
-	NemDecMain(&state);
+	NemDecInit(&state, source);
+	NemDecTiles(&state, destination, state.tiles);
 }
@@ -6,25 +6,17 @@
 
 typedef struct NemesisState
 {
-	const uint8_t *source; // a0
-	uint8_t *dictionary;   // a1
-	bool xor_mode;         // a3
-	bool vram_mode;        // a3
-	uint8_t *destination;  // a4
-	uint16_t remaining;    // a5
-	uint8_t d0;            // d0
-	uint8_t d1;            // d1
-	uint32_t d2;           // d2
-	uint16_t d3;           // d3
-	uint32_t d4;           // d4
-	uint16_t d5;           // d5
-	uint16_t d6;           // d6
+	const uint8_t *source;
+	uint32_t bits;         //Bit buffer, the next 'bit_count' bits are the low ones
+	unsigned bit_count;
+	bool xor_mode;
+	uint32_t xor_row;      //Previous row written, in XOR mode
+	uint16_t tiles;        //Tiles left to decode
+	uint8_t run, nibble;   //Rest of the current run, which can carry on into the next tile
+	uint16_t table[0x100]; //Code table, indexed by the next 8 bits of the stream
 } NemesisState;
 
-extern uint8_t nemesis_buffer[0x200];
-
-void NemDecPrepare(NemesisState *state);
-void NemDecRun(NemesisState *state);
-void NemDecSeek(size_t off);
+void NemDecInit(NemesisState *state, const uint8_t *source);
+size_t NemDecTiles(NemesisState *state, uint8_t *destination, size_t tiles); //Decodes up to 'tiles' tiles, returns how many were decoded
 void NemDec(const uint8_t *source);
 void NemDecToRAM(const uint8_t *source, uint8_t *destination);
@@ -3,14 +3,23 @@
 #include "PLC.h"
 
 #include "Nemesis.h"
+#include "AssetCache.h"
+#include "Preload.h"
 
 #include <Backend/VDP.h>
+#include <Backend/System.h>
 
+#include <stdio.h>
 #include <string.h>
 
 //PLC constants
 #define PLC_SPEED_1 9 //How many tiles are loaded per frame during a 'loading' state
 #define PLC_SPEED_2 3 //How many tiles are loaded per frame while the game's running
+#define PLC_CHUNK   16 //Most tiles loaded at once, between checks of the time budget
+#define PLC_QUEUE   16 //How many requests can be queued
+
+#define PLC_BUDGET_DEFAULT  1000 //Microseconds per frame spent loading art in the budgeted mode, ProcessDPLC2 gets PLC_SPEED_2 / PLC_SPEED_1 of it
+#define PLC_TILE_NS_DEFAULT 2000 //Initial guess of how long a tile takes to load
 
 //Level art
 const uint8_t art_ghz1[] = {
@@ -406,13 +415,236 @@ static const PLCList *plcs[PlcId_Num] = {
 };
 
 //PLC state
-PLC plc_buffer[16];
+static PLC plc_queue[PLC_QUEUE]; //Ring buffer of art waiting to be loaded, the head is the art being loaded
+static size_t plc_head, plc_count;
+
+static PlcMode plc_mode;
+static unsigned long plc_budget = PLC_BUDGET_DEFAULT;
+static uint64_t plc_tile_ns = PLC_TILE_NS_DEFAULT; //Measured time to load a tile, averaged over the last few chunks
+
+static NemesisState plc_nemesis;
+static uint16_t plc_buffer_reg18; //Tiles left in the art being decoded
+
+static const uint8_t *plc_asset; //Cached art being loaded, NULL if it's decoded without the cache
+static uint8_t *plc_asset_fill;  //Set if the art is being decoded into the cache
+static size_t plc_asset_pos;
+
+static struct
+{
+	size_t peak;                 //Most requests queued at once
+	unsigned long overflows;     //Requests dropped because the queue was full
+	unsigned long tiles, frames; //Tiles loaded and frames spent loading them
+	unsigned long drains;        //Times the queue was emptied
+	unsigned long drain_frames, drain_frames_max;
+	unsigned long drain_current; //Frames spent on the queue since it was last empty
+} plc_stats;
+
+//Internal PLC functions
+static PLC *GetPLC(size_t i)
+{
+	return &plc_queue[(plc_head + i) % PLC_QUEUE];
+}
+
+static void PushPLCList(const PLCList *list)
+{
+	//Push PLCs to the tail of the queue, dropping any that don't fit
+	for (size_t i = 0; i < list->plcs; i++)
+	{
+		if (plc_count == PLC_QUEUE)
+		{
+			plc_stats.overflows += list->plcs - i;
+			break;
+		}
+		*GetPLC(plc_count++) = list->plc[i];
+	}
+	if (plc_count > plc_stats.peak)
+		plc_stats.peak = plc_count;
+}
+
+static void PopPLC()
+{
+	//Pop the finished request off the head of the queue
+	plc_head = (plc_head + 1) % PLC_QUEUE;
+	if (--plc_count == 0)
+	{
+		//Record how long the queue took to drain
+		plc_stats.drains++;
+		plc_stats.drain_frames += plc_stats.drain_current;
+		if (plc_stats.drain_current > plc_stats.drain_frames_max)
+			plc_stats.drain_frames_max = plc_stats.drain_current;
+		plc_stats.drain_current = 0;
+	}
+}
+
+static void ReleasePLCAsset()
+{
+	//Release the cached art, which is only complete if every tile was loaded
+	if (plc_asset_fill != NULL && plc_buffer_reg18 != 0)
+		DiscardAsset(plc_asset);
+	else if (plc_asset != NULL)
+		UnlockAsset(plc_asset);
+	plc_asset = NULL;
+	plc_asset_fill = NULL;
+}
+
+static void StartPLC()
+{
+	const uint8_t *art = GetPLC(0)->art;
+	
+	//Load the next art from the asset cache if we've decoded it before
+	size_t size;
+	plc_asset_pos = 0;
+	if ((plc_asset = LockAsset(art, &size)) != NULL)
+	{
+		plc_buffer_reg18 = size / 0x20;
+		return;
+	}
+	
+	//Start decoding the next art, into the asset cache if there's room for it
+	NemDecInit(&plc_nemesis, art);
+	plc_buffer_reg18 = plc_nemesis.tiles;
+	plc_asset = plc_asset_fill = AddAsset(art, plc_nemesis.tiles * 0x20);
+}
+
+static size_t ProcessDPLC_Main(size_t tiles)
+{
+	//Load the next few tiles and write them at once
+	uint8_t buffer[PLC_CHUNK * 0x20];
+	const uint8_t *data;
+	
+	if (tiles > plc_buffer_reg18)
+		tiles = plc_buffer_reg18;
+	
+	if (plc_asset_fill != NULL)
+		NemDecTiles(&plc_nemesis, plc_asset_fill + plc_asset_pos, tiles);
+	else if (plc_asset == NULL)
+		NemDecTiles(&plc_nemesis, buffer, tiles);
+	data = (plc_asset != NULL) ? (plc_asset + plc_asset_pos) : buffer;
+	plc_asset_pos += tiles * 0x20;
+	
+	PLC *plc = GetPLC(0);
+	VDP_SeekVRAM(plc->off);
+	VDP_WriteVRAM(data, tiles * 0x20);
+	plc->off += tiles * 0x20;
+	
+	plc_stats.tiles += tiles;
+	
+	if ((plc_buffer_reg18 -= tiles) == 0)
+	{
+		ReleasePLCAsset();
+		
+		//Pop one request off the queue so that the next one can be filled
+		PopPLC();
+	}
+	return tiles;
+}
+
+static void ProcessDPLC_Budget(uint64_t budget, size_t tiles_min)
+{
+	uint64_t start = System_GetNanoseconds();
+	uint64_t now = start;
+	size_t loaded = 0;
+	
+	while (plc_buffer_reg18 != 0)
+	{
+		//Always load at least as many tiles as the original would, then as many as we expect to fit in the budget
+		size_t tiles = PLC_CHUNK;
+		if (loaded < tiles_min)
+		{
+			if (tiles > tiles_min - loaded)
+				tiles = tiles_min - loaded;
+		}
+		else
+		{
+			uint64_t elapsed = now - start;
+			if (elapsed >= budget)
+				break;
+			uint64_t fit = (budget - elapsed) / plc_tile_ns;
+			if (fit == 0)
+				break;
+			if (tiles > fit)
+				tiles = fit;
+		}
+		
+		tiles = ProcessDPLC_Main(tiles);
+		loaded += tiles;
+		
+		//Update throughput estimate
+		uint64_t then = System_GetNanoseconds();
+		uint64_t tile_ns = (then - now) / tiles;
+		plc_tile_ns = (plc_tile_ns * 7 + tile_ns) / 8 + 1;
+		now = then;
+		
+		//Carry on with the next art in the same frame
+		if (plc_buffer_reg18 == 0 && plc_count != 0)
+			StartPLC();
+	}
+}
+
+static void ProcessDPLC_Frame(size_t tiles)
+{
+	if (plc_buffer_reg18 != 0)
+	{
+		plc_stats.frames++;
+		plc_stats.drain_current++;
+		
+		if (plc_mode == PlcMode_Budget)
+			ProcessDPLC_Budget((uint64_t)plc_budget * 1000 * tiles / PLC_SPEED_1, tiles);
+		else
+			ProcessDPLC_Main(tiles);
+	}
+}
 
-static NemesisState plc_buffer_regs;
-static uint16_t plc_buffer_reg18;
-static uint16_t plc_buffer_reg1A;
+static void LoadPLCInstant()
+{
+	plc_stats.frames++;
+	plc_stats.drain_current++;
+	
+	//Finish the art that was being loaded a few tiles at a time
+	while (plc_buffer_reg18 != 0)
+		ProcessDPLC_Main(PLC_CHUNK);
+	
+	//Load the rest of the queue at once
+	while (plc_count != 0)
+	{
+		const PLC *plc = GetPLC(0);
+		plc_stats.tiles += ((plc->art[0] << 8) | plc->art[1]) & 0x7FFF;
+		
+		VDP_SeekVRAM(plc->off);
+		NemDec(plc->art);
+		PopPLC();
+	}
+}
 
 //PLC interface
+void SetPLCMode(PlcMode mode)
+{
+	plc_mode = mode;
+}
+
+void SetPLCBudget(unsigned long budget)
+{
+	plc_budget = budget;
+}
+
+void QuitPLC()
+{
+	//Report how the queue was used
+	if (plc_stats.tiles != 0)
+	{
+		printf("PLC: %lu tiles loaded over %lu frames (%.1f per frame), peak queue depth %lu, %lu requests dropped\n", plc_stats.tiles, plc_stats.frames, (double)plc_stats.tiles / plc_stats.frames, (unsigned long)plc_stats.peak, plc_stats.overflows);
+		if (plc_mode == PlcMode_Budget)
+			printf("PLC: Loading a tile took %.1f us on average\n", plc_tile_ns / 1000.0);
+		if (plc_stats.drains != 0)
+			printf("PLC: Queue drained %lu times, in %.1f frames on average and %lu at most\n", plc_stats.drains, (double)plc_stats.drain_frames / plc_stats.drains, plc_stats.drain_frames_max);
+	}
+}
+
+bool PLCPending()
+{
+	return plc_count != 0;
+}
+
 void AddPLC(PlcId plc)
 {
 	//Get PLC list to load
@@ -420,14 +652,8 @@ void AddPLC(PlcId plc)
 	if (list == NULL)
 		return;
 	
-	//Find empty PLC slot
-	PLC *plc_free = plc_buffer;
-	while (plc_free->art != NULL)
-		plc_free++;
-	
-	//Push PLCs to buffer
-	for (size_t i = 0; i < list->plcs; i++)
-		plc_free[i] = list->plc[i];
+	//Push PLCs to queue
+	PushPLCList(list);
 }
 
 void NewPLC(PlcId plc)
@@ -440,92 +666,51 @@ void NewPLC(PlcId plc)
 	//Clear previous PLCs
 	ClearPLC();
 	
-	//Push PLCs to buffer
-	for (size_t i = 0; i < list->plcs; i++)
-		plc_buffer[i] = list->plc[i];
+	//Push PLCs to queue
+	PushPLCList(list);
 }
 
 void ClearPLC()
 {
-	//Clear PLC buffer
+	//Clear PLC queue
+	ReleasePLCAsset();
 	plc_buffer_reg18 = 0;
-	memset(plc_buffer, 0, sizeof(plc_buffer));
+	plc_head = 0;
+	plc_count = 0;
+	plc_stats.drain_current = 0;
 }
 
-void RunPLC()
+void PreloadPLC(PlcId plc)
 {
-	if (plc_buffer[0].art != NULL && plc_buffer_reg18 == 0)
-	{
-		plc_buffer_regs.source = plc_buffer[0].art;
-		plc_buffer_regs.vram_mode = true;
-		plc_buffer_regs.dictionary = nemesis_buffer;
-		
-		uint16_t header = (plc_buffer_regs.source[0] << 8) | plc_buffer_regs.source[1];
-		
-		plc_buffer_regs.source += 2;
-		plc_buffer_regs.xor_mode = header & 0x8000;
-		plc_buffer_reg18 = header & 0x7FFF;
-		
-		NemDecPrepare(&plc_buffer_regs);
-		
-		plc_buffer_regs.d5 = (plc_buffer_regs.source[0] << 8) | plc_buffer_regs.source[1];
-		plc_buffer_regs.source += 2;
-		
-		plc_buffer_regs.d0 = 0;
-		plc_buffer_regs.d1 = 0;
-		plc_buffer_regs.d2 = 0;
-		plc_buffer_regs.d6 = 0x10;
-	}
+	//Get PLC list to decompress in the background
+	const PLCList *list = plcs[plc];
+	if (list == NULL)
+		return;
+	for (size_t i = 0; i < list->plcs; i++)
+		PreloadNemesis(list->plc[i].art);
 }
 
-static void ProcessDPLC_Main(size_t off)
+void RunPLC()
 {
-	VDP_SeekVRAM(off);
+	//Pick up any art that's been preloaded
+	CommitPreloads();
 	
-	do
-	{
-		plc_buffer_regs.remaining = 8;
-		
-		//Inlined NemDec_WriteIter
-		plc_buffer_regs.d3 = 8;
-		plc_buffer_regs.d4 = 0;
-		
-		NemDecRun(&plc_buffer_regs);
-		
-		if (--plc_buffer_reg18 == 0)
-		{
-			//Pop one request off the buffer so that the next one can be filled
-			for (size_t i = 0; i < sizeof(plc_buffer) / sizeof(*plc_buffer) - 1; i++)
-				plc_buffer[i] = plc_buffer[i + 1];
-			return;
-		}
-	} while (--plc_buffer_reg1A != 0);
+	if (plc_count != 0 && plc_mode == PlcMode_Instant)
+		LoadPLCInstant();
+	else if (plc_count != 0 && plc_buffer_reg18 == 0)
+		StartPLC();
 }
 
 void ProcessDPLC()
 {
-	if (plc_buffer_reg18 != 0)
-	{
-		plc_buffer_reg1A = PLC_SPEED_1; //Process PLC_SPEED_1 tiles
-		
-		size_t off = plc_buffer[0].off;
-		plc_buffer[0].off += PLC_SPEED_1 * 0x20;
-		
-		ProcessDPLC_Main(off);
-	}
+	//Process PLC_SPEED_1 tiles, or a full time budget's worth
+	ProcessDPLC_Frame(PLC_SPEED_1);
 }
 
 void ProcessDPLC2()
 {
-	if (plc_buffer_reg18 != 0)
-	{
-		plc_buffer_reg1A = PLC_SPEED_2; //Process PLC_SPEED_2 tiles
-		
-		size_t off = plc_buffer[0].off;
-		plc_buffer[0].off += PLC_SPEED_2 * 0x20;
-		
-		ProcessDPLC_Main(off);
-	}
+	//Process PLC_SPEED_2 tiles, or a fraction of the time budget
+	ProcessDPLC_Frame(PLC_SPEED_2);
 }
 
 void QuickPLC(PlcId plc)
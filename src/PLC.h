@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
@@ -10,9 +11,6 @@ typedef struct
 	size_t off;
 } PLC;
 
-//PLC buffer
-extern PLC plc_buffer[16];
-
 //PLC IDs
 typedef enum
 {
@@ -60,10 +58,23 @@ extern const uint8_t art_slz[];
 extern const uint8_t art_syz[];
 extern const uint8_t art_sbz[];
 
+//PLC loading modes
+typedef enum
+{
+	PlcMode_Classic, //PLC_SPEED_1 or PLC_SPEED_2 tiles a frame, like the original
+	PlcMode_Budget,  //As many tiles as fit in a time budget each frame
+	PlcMode_Instant, //The whole queue on the next RunPLC
+} PlcMode;
+
 //PLC interface
+void SetPLCMode(PlcMode mode);
+void SetPLCBudget(unsigned long budget); //In microseconds
+void QuitPLC();
+bool PLCPending();
 void AddPLC(PlcId plc);
 void NewPLC(PlcId plc);
 void ClearPLC();
+void PreloadPLC(PlcId plc);
 void RunPLC();
 void ProcessDPLC();
 void ProcessDPLC2();
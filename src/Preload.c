@@ -0,0 +1,259 @@
+#include "Preload.h"
+
+#include "AssetCache.h"
+#include "Kosinski.h"
+#include "Nemesis.h"
+
+#include <Backend/Thread.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+//Preload constants
+#define PRELOAD_JOBS 32 //Maximum amount of assets waiting to be decompressed or committed
+
+//Preload state
+typedef enum
+{
+	PreloadType_Nemesis,
+	PreloadType_Kosinski,
+} PreloadType;
+
+typedef struct
+{
+	PreloadType type;
+	const uint8_t *source;
+	uint8_t *data; //Staging buffer, filled in by the worker
+	size_t size;
+} PreloadJob;
+
+static struct
+{
+	int enable; //-1 uses the worker if there's a spare core
+	bool started;
+	Thread *thread;
+	Mutex *mutex;
+	Cond *work_cond, *done_cond;
+	bool quit;
+	
+	PreloadJob queue[PRELOAD_JOBS]; //Waiting for the worker, oldest first
+	size_t queued;
+	const void *busy;               //Source the worker is decompressing
+	PreloadJob done[PRELOAD_JOBS];  //Waiting to be committed to the asset cache
+	size_t finished;
+} preload = {.enable = -1};
+
+//Preload worker
+static void DecompressPreload(PreloadJob *job)
+{
+	switch (job->type)
+	{
+		case PreloadType_Nemesis:
+		{
+			NemesisState state;
+			NemDecInit(&state, job->source);
+			
+			job->size = state.tiles * 0x20;
+			if ((job->data = malloc(job->size)) != NULL)
+				NemDecTiles(&state, job->data, state.tiles);
+			break;
+		}
+		case PreloadType_Kosinski:
+		{
+			if ((job->data = malloc(job->size)) == NULL)
+				break;
+			
+			uint8_t *end = KosDec(job->source, job->data, job->size);
+			if (end == NULL)
+			{
+				free(job->data);
+				job->data = NULL;
+				break;
+			}
+			job->size = end - job->data;
+			break;
+		}
+	}
+}
+
+static void PreloadWorker(void *arg)
+{
+	(void)arg;
+	
+	Mutex_Lock(preload.mutex);
+	for (;;)
+	{
+		//Wait for a job, and for room to put it once it's done
+		while (!preload.quit && (preload.queued == 0 || preload.finished == PRELOAD_JOBS))
+			Cond_Wait(preload.work_cond, preload.mutex);
+		if (preload.quit)
+			break;
+		
+		PreloadJob job = preload.queue[0];
+		memmove(&preload.queue[0], &preload.queue[1], --preload.queued * sizeof(PreloadJob));
+		preload.busy = job.source;
+		
+		//Decompress without holding the lock
+		Mutex_Unlock(preload.mutex);
+		DecompressPreload(&job);
+		Mutex_Lock(preload.mutex);
+		
+		preload.busy = NULL;
+		if (job.data != NULL)
+			preload.done[preload.finished++] = job;
+		Cond_Broadcast(preload.done_cond);
+	}
+	Mutex_Unlock(preload.mutex);
+}
+
+//Internal preload functions
+static bool StartPreload()
+{
+	//Start the worker the first time something's preloaded, if there's a spare core for it
+	if (!preload.started)
+	{
+		preload.started = true;
+		if (preload.enable < 0)
+			preload.enable = Thread_GetCPUCount() > 1;
+		if (!preload.enable)
+			return false;
+		
+		if ((preload.mutex = Mutex_Create()) == NULL ||
+		    (preload.work_cond = Cond_Create()) == NULL ||
+		    (preload.done_cond = Cond_Create()) == NULL ||
+		    (preload.thread = Thread_Create(PreloadWorker, NULL)) == NULL)
+		{
+			QuitPreload();
+			return false;
+		}
+	}
+	return preload.thread != NULL;
+}
+
+static bool IsPreloading(const void *source)
+{
+	if (preload.busy == source)
+		return true;
+	for (size_t i = 0; i < preload.queued; i++)
+		if (preload.queue[i].source == source)
+			return true;
+	for (size_t i = 0; i < preload.finished; i++)
+		if (preload.done[i].source == source)
+			return true;
+	return false;
+}
+
+static void QueuePreload(PreloadType type, const uint8_t *source, size_t size)
+{
+	//Skip assets that are already cached or on their way
+	if (source == NULL || !StartPreload() || HasAsset(source))
+		return;
+	
+	Mutex_Lock(preload.mutex);
+	if (preload.queued < PRELOAD_JOBS && !IsPreloading(source))
+	{
+		PreloadJob *job = &preload.queue[preload.queued++];
+		job->type = type;
+		job->source = source;
+		job->data = NULL;
+		job->size = size;
+		Cond_Signal(preload.work_cond);
+	}
+	Mutex_Unlock(preload.mutex);
+}
+
+//Preload interface
+void SetPreload(bool enable)
+{
+	preload.enable = enable;
+}
+
+void QuitPreload()
+{
+	//Stop worker
+	if (preload.thread != NULL)
+	{
+		Mutex_Lock(preload.mutex);
+		preload.quit = true;
+		Cond_Broadcast(preload.work_cond);
+		Mutex_Unlock(preload.mutex);
+		
+		Thread_Join(preload.thread);
+		preload.thread = NULL;
+	}
+	
+	//Free anything that was never committed
+	for (size_t i = 0; i < preload.finished; i++)
+		free(preload.done[i].data);
+	preload.queued = 0;
+	preload.finished = 0;
+	
+	if (preload.done_cond != NULL)
+		Cond_Destroy(preload.done_cond);
+	if (preload.work_cond != NULL)
+		Cond_Destroy(preload.work_cond);
+	if (preload.mutex != NULL)
+		Mutex_Destroy(preload.mutex);
+	preload.done_cond = NULL;
+	preload.work_cond = NULL;
+	preload.mutex = NULL;
+}
+
+void PreloadNemesis(const uint8_t *source)
+{
+	QueuePreload(PreloadType_Nemesis, source, 0);
+}
+
+void PreloadKosinski(const uint8_t *source, size_t size)
+{
+	QueuePreload(PreloadType_Kosinski, source, size);
+}
+
+void CommitPreloads()
+{
+	if (preload.thread == NULL)
+		return;
+	
+	//Take the finished assets
+	PreloadJob done[PRELOAD_JOBS];
+	size_t finished;
+	
+	Mutex_Lock(preload.mutex);
+	finished = preload.finished;
+	memcpy(done, preload.done, finished * sizeof(PreloadJob));
+	preload.finished = 0;
+	if (finished != 0)
+		Cond_Signal(preload.work_cond);
+	Mutex_Unlock(preload.mutex);
+	
+	//Hand them to the asset cache, unless they were decompressed here in the meantime
+	for (size_t i = 0; i < finished; i++)
+		if (HasAsset(done[i].source) || !AdoptAsset(done[i].source, done[i].data, done[i].size))
+			free(done[i].data);
+}
+
+void WaitPreload(const void *source)
+{
+	if (preload.thread == NULL)
+		return;
+	
+	Mutex_Lock(preload.mutex);
+	
+	//Drop the job if the worker hasn't started it, it's quicker to decompress it ourselves
+	for (size_t i = 0; i < preload.queued; i++)
+	{
+		if (preload.queue[i].source == source)
+		{
+			memmove(&preload.queue[i], &preload.queue[i + 1], (--preload.queued - i) * sizeof(PreloadJob));
+			break;
+		}
+	}
+	
+	//Wait for the worker to finish it
+	while (preload.busy == source)
+		Cond_Wait(preload.done_cond, preload.mutex);
+	
+	Mutex_Unlock(preload.mutex);
+	
+	CommitPreloads();
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+//Preload interface
+void SetPreload(bool enable);
+void QuitPreload();
+
+void PreloadNemesis(const uint8_t *source);
+void PreloadKosinski(const uint8_t *source, size_t size);
+void CommitPreloads();
+void WaitPreload(const void *source);
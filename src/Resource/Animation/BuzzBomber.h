@@ -0,0 +1 @@
+0,6,0,10,0,14,1,0,1,255,1,2,3,255,1,4,5,255
@@ -0,0 +1 @@
+0,4,0,8,7,0,1,252,1,2,3,255
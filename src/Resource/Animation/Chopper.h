@@ -0,0 +1 @@
+0,6,0,10,0,14,7,0,1,255,3,0,1,255,7,0,255,0
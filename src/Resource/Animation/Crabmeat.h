@@ -0,0 +1 @@
+0,16,0,20,0,24,0,28,0,34,0,40,0,46,0,50,15,0,255,0,15,2,255,0,15,34,255,0,15,1,33,0,255,0,15,33,3,2,255,0,15,1,35,34,255,0,15,4,255,0,1,5,6,255
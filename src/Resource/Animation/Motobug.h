@@ -0,0 +1 @@
+0,6,0,10,0,16,15,2,255,0,7,0,1,0,2,255,1,3,6,3,6,4,6,4,6,4,6,5,252,0
@@ -0,0 +1 @@
+0,10,0,14,0,22,0,26,0,30,15,10,255,0,19,0,1,3,4,5,254,1,2,6,7,255,2,8,9,255,19,0,1,1,2,1,1,0,252,0
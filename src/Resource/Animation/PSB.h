@@ -0,0 +1 @@
+0,2,31,0,1,255
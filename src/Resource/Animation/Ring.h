@@ -0,0 +1 @@
+0,2,5,4,5,6,7,252
@@ -0,0 +1,4 @@
+0,62,0,70,0,78,0,86,0,94,0,102,0,124,0,128,0,132,0,136,0,140,0,144,0,148,0,152,0,156,0,160,0,168,0,172,0,176,0,182,0,188,0,192,0,200,0,204,0,208,0,212,0,222,0,226,0,230,0,234,0,242,255,8,
+9,10,11,6,7,255,255,30,31,32,33,255,255,255,254,46,47,48,49,50,255,255,254,46,47,50,48,49,50,255,253,69,70,71,72,255,255,255,23,1,1,1,1,1,1,1,1,1,1,1,1,3,2,2,2,3,4,254,2,0,31,58,59,255,
+63,5,255,0,63,57,255,0,63,51,255,0,63,52,255,0,63,53,255,0,63,54,255,0,7,55,56,255,7,60,63,255,7,60,61,83,62,84,255,0,47,64,253,0,4,65,66,255,15,67,67,67,254,1,15,67,68,254,1,0,63,73,255,0,
+11,86,86,10,11,253,0,0,32,75,255,0,47,76,255,0,3,77,255,0,3,78,79,80,81,82,0,254,1,0,3,85,255,0,7,85,87,255,119,0,253,0,3,60,61,83,62,84,255,0,3,60,253,0
@@ -0,0 +1 @@
+0,4,0,16,0,1,0,0,2,2,2,2,2,2,0,252,0,4,3,3,5,5,5,5,5,5,3,252
@@ -0,0 +1 @@
+0,2,7,0,1,2,3,4,5,6,7,254,2,0
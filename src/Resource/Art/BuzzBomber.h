@@ -0,0 +1,15 @@
+128,55,128,4,3,20,5,36,8,52,7,69,21,86,54,103,111,115,0,129,4,2,21,19,39,116,130,6,53,24,242,131,4,6,22,46,39,122,132,7,117,133,7,118,134,6,47,135,5,18,22,56,72,243,88,247,136,4,4,23,114,137,5,22,
+138,6,52,24,246,139,6,50,23,110,140,5,24,23,119,141,7,120,142,5,20,23,115,143,6,51,255,0,111,205,124,81,115,95,7,157,51,58,120,60,76,233,169,224,143,58,98,94,9,124,176,79,216,251,58,31,105,19,222,178,172,223,75,251,
+25,63,109,155,46,173,214,10,215,149,224,120,223,143,0,126,137,109,153,146,234,73,149,140,149,151,95,202,197,209,217,248,33,156,117,252,177,232,172,127,165,127,202,182,74,199,193,91,202,96,1,253,149,69,253,71,230,83,58,34,242,50,217,57,
+165,121,0,18,202,130,16,172,105,251,27,36,192,0,11,111,75,13,233,96,43,97,188,191,51,91,33,148,175,214,248,43,203,126,108,78,86,43,234,70,64,11,248,182,165,105,210,244,101,75,209,249,27,117,103,38,234,203,200,230,105,215,60,66,
+98,234,224,240,125,15,51,166,168,104,84,50,205,20,157,143,67,42,103,63,47,29,247,105,171,118,235,218,236,126,206,47,59,141,151,175,229,111,237,148,255,158,86,45,136,255,194,127,187,84,47,217,242,35,254,136,142,43,41,163,231,76,201,231,
+178,110,71,43,138,179,27,203,181,255,149,45,250,197,237,249,103,211,26,25,45,249,146,18,216,179,40,36,207,145,220,146,79,224,233,213,139,202,122,173,202,66,232,98,118,50,86,54,156,116,0,0,3,218,191,153,197,160,180,44,37,140,152,252,
+65,27,21,250,31,35,189,138,180,82,116,101,180,53,80,217,88,173,30,172,159,193,212,0,63,114,248,93,63,51,30,218,251,88,239,170,91,85,242,61,80,25,57,68,204,170,206,208,199,113,220,237,175,79,41,128,0,0,91,126,66,195,149,83,
+164,49,242,39,232,228,165,43,245,190,10,242,223,155,19,149,138,250,145,144,2,254,45,169,90,116,189,25,82,244,126,70,221,89,201,186,181,127,194,7,75,126,91,132,52,42,25,102,138,91,100,101,76,201,91,34,211,119,70,183,168,254,8,243,
+180,255,158,73,188,143,252,39,251,181,66,253,159,34,63,232,133,46,11,94,151,206,204,115,206,153,244,89,236,155,145,202,226,172,192,145,200,228,190,235,239,30,111,251,122,200,228,0,150,254,14,79,231,30,235,254,115,145,251,196,143,244,251,72,
+0,37,183,21,253,188,121,196,143,135,145,241,30,231,255,127,251,255,223,244,231,37,145,202,178,57,63,156,121,199,237,222,71,32,0,1,13,31,249,11,200,255,80,169,9,84,222,128,13,147,127,35,71,254,68,33,161,160,0,13,144,210,191,168,
+217,22,253,247,128,21,13,21,15,255,31,248,254,65,161,255,33,208,208,3,67,67,72,254,194,255,97,127,176,191,184,52,84,52,2,56,126,38,188,79,219,131,35,253,87,233,200,244,61,22,81,164,74,38,178,45,50,60,156,183,17,200,143,35,
+41,71,78,20,164,114,89,31,233,214,71,35,147,200,252,207,137,238,41,79,216,203,67,246,219,217,244,93,20,178,41,104,70,79,208,242,140,151,35,41,70,68,229,161,72,156,164,178,137,109,40,144,0,0,124,235,75,158,141,56,163,16,122,49,
+7,163,16,11,53,110,151,29,15,215,53,253,240,127,223,47,63,71,67,187,163,44,192,82,106,7,38,160,114,106,68,218,143,117,43,204,0,3,243,126,119,69,46,157,73,232,196,0,173,24,129,86,151,77,249,221,183,48,7,61,174,230,243,186,
+149,32,77,64,5,73,168,229,89,221,72,187,155,243,3,21,166,27,188,106,199,118,23,86,59,176,180,195,119,174,0,173,63,59,250,197,105,250,238,173,23,43,71,169,250,239,79,206,254,176,0,23,190,252,109,128,0,2,187,159,116,227,41,247,
+174,31,34,192,2,185,22,6,43,148,251,190,233,237,184,1,187,105,238,126,243,202,184,24,44,128,21,193,100,248,175,121,229,19,220,251,134,192
@@ -0,0 +1,10 @@
+128,32,128,4,2,20,5,36,10,53,18,69,23,86,54,101,24,116,3,129,3,0,23,123,130,7,122,131,5,25,132,5,26,133,6,55,134,5,22,135,4,7,22,58,136,4,4,22,59,137,5,19,138,8,249,139,6,57,140,6,56,141,6,60,
+142,4,6,143,4,8,24,248,255,51,60,49,236,199,179,30,193,120,151,229,184,122,120,4,22,198,163,155,21,129,65,14,111,22,121,89,150,192,152,33,89,90,117,59,167,193,52,233,32,226,119,73,158,201,178,3,186,13,135,114,239,226,147,226,
+73,5,250,229,180,249,220,65,54,125,121,233,9,136,105,251,21,55,70,130,245,174,138,219,172,223,245,21,55,239,122,153,54,75,230,159,114,201,120,60,224,130,238,219,100,129,2,204,253,230,134,109,23,17,249,59,228,241,60,69,5,22,44,208,
+223,2,224,181,7,5,153,123,130,246,89,184,205,193,68,251,92,241,98,248,183,197,175,249,106,255,247,254,109,249,219,178,249,45,200,23,146,6,66,66,78,191,171,86,114,252,176,228,180,207,66,155,162,6,162,63,67,242,179,111,212,210,15,209,
+220,75,88,236,134,252,175,16,132,25,126,72,22,183,45,87,50,105,147,46,165,185,107,109,109,174,238,158,251,160,190,209,94,66,186,167,151,71,209,54,207,63,239,47,246,92,204,204,204,223,13,108,69,143,17,105,8,33,41,182,200,9,158,147,
+1,48,16,153,228,19,1,48,12,220,204,204,204,213,240,242,111,206,73,189,126,118,155,214,186,188,250,188,250,151,173,117,180,222,254,180,245,11,235,204,53,237,195,202,96,133,62,214,4,220,219,102,228,173,41,189,2,107,134,66,181,52,214,119,
+79,133,137,170,70,16,162,107,58,153,221,15,105,152,194,108,130,232,18,233,48,159,150,188,249,180,172,92,35,213,151,119,91,34,240,142,86,222,191,51,100,39,168,77,201,213,231,146,249,252,233,62,229,146,129,231,4,23,118,219,36,8,22,103,
+239,52,51,104,184,143,201,223,38,89,32,162,119,5,24,178,228,129,111,129,27,105,33,115,72,34,226,89,144,133,207,20,34,95,184,248,239,244,37,217,15,252,127,196,255,59,116,95,37,185,2,242,64,200,72,73,215,245,106,206,95,150,28,150,
+153,232,83,116,64,212,71,232,126,86,109,250,154,65,250,51,93,99,181,223,149,226,16,131,47,201,2,214,229,170,230,77,50,101,212,183,45,29,51,151,9,126,61,247,65,125,162,245,101,8,95,158,143,203,56,122,248,110,191,112,191,158,253,143,
+238,37,251,19,51,51,51,55,195,91,17,99,196,90,66,8,74,109,178,2,103,164,192,76,4,38,121,4,192,76,3,55,51,51,53,124,51,237,55,216
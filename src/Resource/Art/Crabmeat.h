@@ -0,0 +1,20 @@
+0,68,128,5,18,21,15,37,16,53,21,70,53,86,56,103,114,116,2,129,3,0,21,20,39,120,134,6,50,23,119,135,4,6,22,52,39,118,136,5,14,21,22,137,4,4,21,19,39,122,138,6,54,23,115,139,5,24,23,116,140,6,47,22,
+46,38,51,55,117,71,121,141,4,3,21,17,40,246,56,247,142,4,5,22,55,255,34,229,127,6,181,49,197,244,214,255,16,59,169,8,220,33,28,224,106,119,84,212,239,169,172,117,53,61,98,188,140,165,153,195,62,119,156,151,62,113,146,231,
+181,230,245,234,111,94,167,73,46,103,225,110,143,133,186,55,5,247,254,226,198,227,222,245,246,89,254,184,213,63,80,167,188,221,145,17,72,249,31,40,241,30,13,178,106,183,233,154,29,233,148,27,42,52,13,178,106,154,59,83,77,36,184,216,
+228,141,44,92,244,211,57,69,102,236,181,155,185,33,23,39,66,122,35,230,217,57,158,154,57,26,72,239,219,137,141,41,36,103,32,130,6,112,130,9,48,130,7,184,60,84,87,1,201,70,197,244,233,178,49,249,49,119,243,68,83,179,189,135,
+103,104,97,59,165,153,194,98,118,22,58,76,88,26,132,22,144,136,91,62,134,186,87,246,36,69,172,86,167,122,223,83,189,111,129,220,183,192,238,48,248,230,30,106,119,43,205,79,55,154,158,112,53,59,160,107,27,234,107,29,77,79,131,82,
+47,109,111,231,24,95,206,248,190,237,174,140,188,198,75,159,184,95,238,173,63,155,121,168,247,234,177,149,231,189,234,114,53,158,239,84,253,66,189,103,108,158,107,59,100,68,68,69,6,201,170,212,201,161,149,59,193,191,76,213,108,155,84,119,
+8,220,38,139,141,160,141,139,160,141,153,17,23,17,226,58,251,107,237,171,100,213,111,211,87,42,101,86,166,90,182,77,182,21,238,67,187,18,100,145,230,230,73,25,19,227,115,227,207,56,243,205,101,126,217,171,252,171,252,171,250,172,27,53,
+134,89,172,168,222,203,224,215,173,22,253,207,61,230,167,114,254,161,22,36,68,69,83,224,95,173,47,56,120,188,223,251,27,205,254,46,55,210,232,188,103,23,230,106,111,190,42,112,142,231,196,221,166,179,119,36,34,214,122,204,37,125,52,61,
+104,255,90,58,66,97,45,41,134,114,7,204,51,132,16,73,133,80,73,181,21,192,114,81,177,125,58,108,140,126,76,93,255,212,237,45,12,118,253,67,4,253,51,146,194,110,71,35,135,238,40,130,212,222,150,144,142,246,125,13,116,175,240,121,
+14,84,71,38,31,183,74,95,134,242,108,239,123,130,118,72,187,246,224,244,78,232,52,112,152,115,56,45,133,130,157,188,122,176,254,77,191,125,77,20,232,255,216,145,87,43,77,99,105,169,238,233,203,221,57,126,221,25,249,57,172,26,86,79,
+216,183,138,130,253,205,80,127,38,67,253,50,254,138,114,4,91,198,177,34,34,46,27,144,34,228,156,130,112,39,197,19,144,214,43,55,101,172,221,201,8,136,136,171,251,152,127,37,255,185,164,189,81,191,114,37,147,154,98,76,228,105,137,118,
+8,36,238,193,4,134,130,72,36,228,15,15,103,14,28,56,97,195,2,174,3,146,141,139,233,211,100,99,242,98,239,230,136,167,111,113,219,220,39,127,230,143,244,139,122,176,176,209,200,44,206,74,47,234,60,26,232,33,252,18,34,34,34,34,
+229,68,114,97,251,116,165,248,111,38,206,247,184,39,100,139,191,110,15,68,238,131,71,9,135,51,130,216,88,78,222,18,150,19,10,45,251,225,45,20,232,255,216,145,87,43,77,99,105,169,238,233,203,221,32,208,253,186,51,242,115,88,52,172,
+159,177,111,31,185,30,191,226,68,68,69,174,241,172,72,136,184,245,175,236,72,136,136,136,185,77,218,107,55,114,66,34,34,228,154,205,213,152,117,102,217,67,214,143,245,163,164,38,18,210,152,103,32,124,195,56,65,4,152,85,4,155,80,68,
+69,92,7,37,27,23,211,166,200,199,228,197,223,253,78,222,227,183,184,78,254,214,30,191,112,44,150,152,253,68,206,159,184,67,222,211,161,174,137,15,224,145,23,33,200,17,17,17,20,174,139,207,62,113,146,231,204,222,185,237,123,215,203,215,
+201,17,20,120,143,30,218,251,17,17,22,183,242,191,252,57,255,6,95,236,145,255,113,241,235,15,230,234,123,145,20,23,172,23,54,130,231,148,23,217,160,121,159,139,183,190,151,43,145,115,52,115,30,102,142,201,174,61,205,217,71,247,198,159,
+190,139,247,50,171,161,61,17,243,108,157,166,77,175,233,154,185,83,42,229,70,171,100,218,154,57,235,141,142,72,210,197,199,36,103,102,252,35,146,141,139,233,211,103,49,249,65,119,243,68,83,179,189,135,103,104,97,59,165,153,194,111,77,28,
+141,36,119,237,196,198,148,146,51,144,65,3,56,65,4,152,65,3,220,30,42,30,39,97,99,164,197,129,168,65,105,8,133,179,232,107,165,127,98,68,69,198,245,222,48,88,221,5,60,222,167,213,234,125,94,167,213,234,125,96,167,156,22,55,
+87,120,241,185,17,22,252,71,122,221,21,134,102,176,234,106,254,166,175,234,106,254,166,175,204,214,23,69,97,29,235,185,17,17,87,165,122,115,134,57,247,134,54,253,51,241,183,237,159,141,191,108,252,109,251,103,227,111,219,67,27,126,154,24,
+231,222,189,57,241,208,136,139,167,28,250,87,191,60,67,244,219,98,31,182,219,15,253,182,216,127,237,182,195,255,109,182,31,250,109,177,14,252,241,14,125,43,208,139,128,0
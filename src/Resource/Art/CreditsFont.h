@@ -0,0 +1,24 @@
+128,96,128,3,0,20,10,37,22,53,23,70,57,87,119,101,26,116,7,129,3,1,22,55,130,4,6,23,123,40,249,131,5,19,21,18,38,50,87,118,132,5,24,133,6,60,134,4,8,22,58,135,3,2,22,51,38,54,54,56,72,248,87,122,
+255,175,233,6,61,108,198,11,100,16,152,108,234,97,120,22,225,181,227,187,235,203,238,27,188,194,240,32,132,195,102,198,11,100,24,245,183,187,251,219,162,195,38,48,91,54,144,67,54,196,129,144,88,6,211,10,142,86,35,224,111,197,229,222,
+65,96,17,155,98,64,230,210,8,100,198,11,109,209,97,252,33,238,236,97,92,163,59,48,51,185,84,169,129,149,138,172,83,3,33,128,85,126,82,108,12,132,233,87,229,40,137,12,102,8,199,22,67,45,242,61,8,218,55,191,236,179,131,121,
+16,214,84,141,228,67,91,20,141,228,67,91,20,141,228,67,98,177,72,78,210,165,108,13,243,239,49,181,143,240,247,143,136,30,220,70,209,91,228,67,89,9,210,178,162,37,74,136,86,101,83,230,117,142,114,84,70,116,173,251,61,25,217,87,
+64,228,65,17,180,6,30,238,199,217,142,55,71,35,153,152,66,123,204,43,72,42,154,165,100,51,188,236,187,161,229,213,27,33,149,164,121,253,53,109,184,63,179,246,35,143,249,70,183,210,103,230,123,190,147,61,228,121,58,242,139,221,81,188,
+143,57,195,143,217,8,244,15,107,124,105,62,150,147,187,190,149,190,1,236,35,214,155,226,43,248,102,184,162,56,7,188,237,183,59,88,143,217,149,109,250,54,222,20,87,240,247,28,95,139,255,15,113,241,14,24,71,160,123,91,227,73,221,221,
+244,180,158,220,81,236,35,215,63,57,244,90,164,198,11,4,210,10,147,98,86,152,88,27,212,223,83,239,48,176,55,9,177,43,38,144,85,38,48,90,138,130,214,71,221,145,109,127,72,71,160,123,91,135,119,119,119,119,86,248,7,176,143,85,
+253,40,209,119,119,119,45,221,31,217,81,140,226,191,135,184,226,252,95,248,123,143,136,123,70,208,88,28,143,86,77,35,127,202,203,150,199,154,103,187,107,198,215,152,110,101,231,121,89,84,16,114,34,4,109,5,156,198,209,99,145,168,165,121,
+234,93,241,230,155,205,51,191,56,110,243,252,175,50,101,120,57,26,49,180,87,190,88,49,235,102,48,91,32,132,195,103,83,11,192,183,13,175,29,223,94,95,112,221,230,23,129,4,38,27,54,48,91,32,199,173,189,223,222,221,22,25,49,130,
+217,180,130,25,182,36,12,130,192,52,102,21,26,57,23,177,200,209,152,84,100,22,1,25,182,36,14,109,32,134,76,96,182,221,22,215,177,30,129,237,111,141,39,119,119,210,210,123,113,71,176,143,92,252,231,209,106,147,24,44,19,72,34,19,
+98,86,152,88,6,211,125,79,188,194,197,155,105,210,11,12,132,247,147,97,93,164,172,81,203,120,49,180,15,122,99,214,204,96,182,65,9,134,206,166,23,129,110,27,94,59,190,188,190,225,187,204,47,2,8,76,54,108,96,182,65,143,91,123,
+191,189,186,44,50,99,5,179,105,4,51,108,72,25,12,32,109,149,203,232,190,86,144,194,4,102,216,144,57,180,130,25,49,130,219,116,91,94,196,122,7,181,184,190,44,192,202,222,5,88,179,111,44,93,25,89,138,165,117,83,96,192,204,99,
+202,52,177,221,74,183,200,134,17,180,123,239,6,54,128,81,200,137,153,133,121,133,139,76,121,137,17,137,137,21,93,82,53,18,130,27,18,52,194,65,30,96,134,169,154,107,20,90,232,183,37,187,255,201,143,92,4,91,246,117,49,198,225,89,
+61,177,101,188,185,84,174,132,194,173,229,74,234,251,142,45,49,192,69,191,102,199,174,26,255,57,244,90,164,197,91,49,59,236,55,186,212,183,164,38,21,213,46,101,189,240,250,67,122,204,78,242,98,173,159,69,181,242,35,208,61,173,195,187,
+187,222,124,145,29,230,206,176,16,71,44,216,173,242,12,122,219,223,120,17,180,2,14,71,149,69,221,193,210,209,157,200,152,144,34,98,107,19,172,206,47,155,72,161,150,232,182,221,22,30,239,236,49,235,102,48,91,32,132,155,58,150,25,96,
+17,133,83,230,124,171,48,63,179,30,4,68,194,164,102,21,140,194,238,181,240,15,97,30,185,249,207,162,213,38,48,88,38,144,86,243,18,6,232,23,230,1,229,167,206,41,26,242,65,82,97,45,199,23,226,255,195,220,124,67,134,17,232,30,
+214,225,221,214,147,187,187,219,138,61,132,122,120,17,180,15,208,228,105,82,185,239,151,60,95,139,229,220,233,104,187,210,177,7,34,32,70,208,245,30,129,237,111,139,109,99,149,250,55,246,87,118,46,238,239,89,220,229,120,219,231,159,80,59,
+17,241,206,221,242,60,158,185,71,221,203,59,187,214,125,242,55,218,28,124,136,244,15,107,124,105,59,187,187,190,149,190,1,236,35,215,63,57,244,125,137,49,232,182,109,34,134,101,9,222,109,48,68,135,152,163,83,125,79,153,15,49,70,166,
+211,4,102,80,157,102,210,40,73,143,69,179,232,251,239,243,30,160,246,53,195,187,187,187,187,223,138,61,140,122,135,17,232,30,214,248,210,119,119,119,125,43,124,3,216,71,173,55,196,22,254,25,67,129,50,54,194,163,251,62,242,188,134,16,
+223,110,118,194,27,254,206,255,179,190,216,84,120,19,35,248,101,15,136,63,210,166,239,11,185,155,187,255,10,241,197,142,93,211,137,95,30,92,202,54,8,75,102,48,127,102,24,199,30,249,111,136,175,225,154,225,221,221,223,83,210,239,137,26,
+206,65,86,70,11,13,160,182,190,68,122,7,181,184,190,44,192,201,171,192,136,134,166,34,81,116,101,224,98,140,199,140,16,152,206,1,97,152,157,179,19,186,19,51,7,34,136,141,160,195,193,141,160,20,114,34,102,97,94,99,59,76,102,24,
+136,204,76,32,222,9,148,88,121,34,175,18,5,169,160,20,60,166,145,13,108,95,139,118,35,212,61,71,160,123,91,227,73,221,221,221,244,173,240,15,97,30,185,249,207,163,236,73,143,68,102,210,40,102,80,157,230,211,4,72,121,142,102,250,
+159,50,30,99,153,180,193,25,148,39,89,180,138,18,99,209,25,244,125,247,249,17,232,30,214,225,221,107,205,51,187,187,219,138,61,132,122,126,184,129,191,236,247,201,149,166,216,42,216,43,45,255,40,38,122,19,18,52,195,242,148,170,66,68,
+53,126,82,162,164,36,111,249,74,32,201,88,193,203,120,17,180,61,71,160,123,91,227,73,244,180,157,221,222,220,81,236,35,214,155,226,43,248,102,184,162,56,7,188,237,183,59,88,143,217,149,99,10,11,82,63,54,44,239,201,212,104
@@ -0,0 +1,26 @@
+128,96,128,3,0,20,4,36,7,52,10,69,23,86,50,102,51,116,5,129,3,1,22,52,39,121,131,7,118,132,5,18,23,120,134,5,24,135,4,6,22,56,40,246,136,5,19,22,58,137,4,8,22,53,40,247,138,7,122,139,7,115,140,6,
+55,141,6,54,142,7,114,143,5,22,23,119,255,206,215,239,123,101,205,225,83,156,146,21,85,95,156,146,22,185,201,34,185,203,62,126,50,252,223,255,211,221,245,125,86,21,85,85,85,115,247,125,95,221,63,233,255,177,221,108,188,214,161,37,
+205,85,85,225,37,205,111,46,119,151,59,203,158,92,213,85,87,44,103,140,142,102,21,115,158,124,150,243,190,7,85,249,100,106,252,183,231,170,52,83,69,127,95,71,56,57,144,106,96,215,234,13,77,205,230,39,148,239,214,83,85,85,188,243,
+233,231,135,152,179,12,35,89,48,48,207,19,120,104,168,31,158,78,78,121,6,162,252,174,83,149,20,228,180,96,126,197,205,21,41,97,106,228,150,22,4,31,215,165,136,32,130,154,2,132,20,238,135,148,31,207,88,126,122,58,35,243,208,63,
+99,202,40,234,147,85,73,170,77,114,155,205,49,150,7,31,168,192,41,198,51,132,58,205,160,23,179,232,8,228,180,104,161,22,114,132,121,5,59,167,145,203,190,71,144,208,16,104,191,236,92,130,44,95,68,209,244,228,11,148,209,14,14,7,
+155,38,45,202,216,131,128,122,48,152,130,157,103,53,85,84,198,120,81,140,177,150,6,6,43,147,126,89,207,43,99,43,79,35,202,110,115,40,107,78,86,155,233,105,209,6,250,12,81,4,97,244,79,203,95,3,15,134,190,51,108,236,185,193,
+204,229,140,240,170,170,170,183,226,236,13,48,57,27,177,93,50,42,110,110,212,67,37,180,189,157,149,255,98,182,66,52,185,85,115,100,42,240,65,114,157,205,65,29,197,159,65,103,247,243,127,117,90,246,194,113,229,24,16,81,129,26,92,174,
+70,180,173,16,174,70,141,16,65,82,14,90,33,200,143,55,210,217,242,5,13,28,202,149,83,115,223,200,34,217,20,179,242,176,253,249,79,215,165,148,28,160,127,71,31,174,253,200,243,192,106,211,5,84,23,41,163,156,188,161,5,202,30,234,
+191,175,42,69,158,200,71,235,193,75,57,4,114,67,125,16,131,145,87,209,8,208,16,104,228,84,26,32,141,28,219,149,129,6,207,160,176,208,126,191,246,41,166,165,14,169,172,227,63,107,249,195,102,91,50,217,149,101,83,145,5,77,30,227,
+246,45,97,107,158,249,23,53,229,25,107,69,185,87,101,4,104,24,26,106,211,15,220,88,77,63,94,107,185,142,147,207,79,160,157,126,161,85,85,85,95,171,204,90,166,45,83,22,22,85,191,124,172,106,99,144,40,200,106,202,211,169,215,231,
+146,201,59,93,129,182,102,172,209,147,60,248,154,66,230,215,246,191,183,76,158,194,195,135,183,22,246,22,12,147,225,27,167,158,169,97,104,174,249,244,144,58,100,138,101,16,201,62,32,48,135,229,52,53,105,189,174,82,223,158,72,242,8,152,
+253,203,205,219,247,14,195,254,249,254,221,236,193,135,8,193,131,11,59,11,48,154,48,155,76,79,59,78,186,180,217,255,80,24,127,29,39,100,179,87,116,214,111,55,141,38,39,9,171,36,200,135,238,10,51,217,32,69,133,146,1,178,26,238,
+82,7,234,23,247,42,141,60,173,52,233,170,125,199,66,107,86,191,119,152,178,90,105,213,51,205,44,213,213,216,53,171,216,52,39,0,242,26,178,127,37,85,93,179,180,242,176,158,86,19,202,203,126,233,59,242,191,148,157,105,92,161,11,176,
+130,147,169,199,74,170,170,179,206,106,243,70,174,184,201,175,49,250,139,254,161,250,140,167,25,76,106,185,107,155,9,212,91,57,137,214,162,97,175,48,207,10,183,227,47,100,103,224,112,236,141,148,195,79,38,157,79,91,192,129,211,194,167,77,
+155,8,86,205,148,78,243,19,118,120,126,79,2,30,111,2,39,156,215,129,194,112,63,174,61,131,89,131,6,13,54,12,236,237,155,42,188,221,158,110,193,135,21,96,214,121,137,137,141,127,80,254,226,18,105,2,27,54,19,108,217,85,68,8,
+173,114,132,133,84,155,244,147,78,172,39,94,211,78,131,87,95,183,121,164,219,41,170,228,201,58,103,104,185,229,23,213,85,114,108,237,159,89,53,132,235,218,121,54,109,213,77,148,206,186,137,187,68,193,118,215,56,16,170,170,152,207,25,28,
+206,202,255,157,203,97,249,219,236,159,130,190,217,239,181,96,126,114,191,44,157,171,242,223,154,173,181,88,163,44,219,242,116,115,216,230,65,173,193,175,214,26,221,205,247,27,229,189,255,57,150,234,170,183,223,63,206,62,248,125,197,187,12,39,
+107,38,6,59,60,108,241,218,1,72,31,154,79,79,30,135,106,135,245,120,79,85,9,233,107,81,251,151,138,133,132,236,59,87,224,147,176,236,32,31,209,167,98,8,35,100,208,20,32,163,118,144,63,130,216,227,240,93,135,228,182,252,225,31,
+146,216,126,199,240,91,81,252,234,110,170,155,170,110,185,110,251,38,19,112,70,7,102,31,156,192,129,46,205,140,165,9,238,59,64,135,236,250,136,30,150,162,161,32,118,120,72,30,226,19,242,105,238,61,126,79,40,244,53,16,34,161,245,148,
+60,8,219,180,62,169,171,235,235,104,125,146,80,155,122,140,75,93,153,48,223,130,237,235,99,128,127,56,118,76,108,83,243,153,238,170,170,152,207,10,49,150,50,192,192,197,122,183,229,158,61,118,198,93,183,202,61,110,241,156,36,86,190,187,
+23,215,177,31,157,16,32,126,180,106,57,212,8,24,125,83,158,47,207,110,105,46,127,130,216,108,158,134,215,97,181,249,170,109,91,111,176,218,136,253,106,98,182,76,42,170,170,173,255,55,125,196,171,118,146,214,234,194,89,73,100,175,186,72,
+72,110,193,132,157,131,62,236,25,127,104,140,178,30,47,37,87,44,146,87,216,137,60,147,137,86,196,112,25,244,12,255,173,243,127,214,170,215,234,236,159,155,253,34,115,18,18,78,98,67,180,132,63,101,100,132,237,94,43,194,73,131,35,59,
+59,73,218,85,33,33,37,144,150,94,18,89,72,126,147,87,240,53,188,132,146,85,39,135,146,64,135,144,129,21,33,173,228,33,36,24,73,36,178,70,18,24,97,236,37,147,33,246,70,216,28,191,59,252,27,126,111,31,189,31,164,252,216,231,
+170,120,180,147,90,247,121,36,132,15,3,194,164,132,146,66,65,132,152,72,51,254,220,22,70,30,67,72,55,236,82,65,134,140,146,118,18,126,4,132,132,146,87,240,34,66,73,170,73,253,239,225,36,60,9,9,84,132,145,132,132,175,224,51,
+181,72,48,246,34,65,147,79,28,13,7,3,246,41,167,231,74,31,206,167,231,119,219,63,213,223,244,150,231,156,185,191,184,151,52,132,129,39,138,230,240,33,82,79,168,144,241,82,127,218,14,47,205,131,14,18,92,14,30,79,36,129,250,68,
+230,53,203,81,224,52,103,36,146,163,110,36,236,140,146,77,242,222,188,115,166,12,55,79,99,92,29,191,56,158,127,56,250,13,235,245,151,0
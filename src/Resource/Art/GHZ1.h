@@ -0,0 +1,90 @@
+129,205,128,3,1,20,4,37,18,52,7,70,49,86,38,102,53,115,0,129,4,5,21,17,40,244,55,117,130,5,20,22,43,119,115,131,4,6,22,46,56,247,132,7,118,23,120,133,7,111,22,52,134,7,113,120,246,135,6,54,23,110,136,6,
+51,23,112,137,6,47,23,114,138,6,42,24,243,139,6,50,23,116,140,6,48,24,242,141,6,39,24,245,142,5,16,24,239,143,5,22,24,238,255,0,0,0,214,216,247,43,218,47,5,198,30,243,122,192,193,140,243,79,43,65,167,149,146,121,
+89,33,43,77,105,173,53,181,234,61,0,0,106,211,52,243,78,159,206,0,13,127,95,42,88,196,210,211,197,45,60,94,33,63,121,44,15,235,83,15,89,65,103,198,154,206,0,0,77,105,172,125,18,216,173,166,132,208,154,24,193,177,156,207,
+139,77,13,87,91,119,128,0,253,112,253,112,239,24,46,11,135,164,230,115,56,1,26,102,154,211,88,224,246,150,5,109,138,194,104,36,63,122,144,44,26,80,118,51,205,112,2,101,153,102,84,254,119,235,192,26,211,92,0,132,204,127,92,253,
+109,57,158,87,25,209,89,231,90,73,82,131,21,213,169,50,235,67,132,202,112,155,213,94,146,234,20,76,197,146,227,9,205,221,243,150,42,236,84,193,26,74,140,119,44,37,178,66,77,250,64,6,182,154,211,90,107,77,105,169,53,39,198,147,
+235,250,211,58,97,250,211,57,156,255,71,0,0,12,1,99,31,38,90,42,122,168,198,39,248,40,160,13,105,174,31,238,75,119,250,224,108,99,114,217,226,218,168,0,1,52,246,151,235,97,57,245,61,234,87,245,133,113,105,81,26,37,130,52,
+81,102,100,104,227,72,126,189,83,247,166,116,157,39,73,223,247,148,244,122,13,84,0,63,252,63,155,228,89,227,58,221,52,110,154,55,77,223,60,187,157,109,141,160,63,91,100,245,74,231,149,115,164,230,137,105,81,39,214,211,79,28,105,229,
+234,186,224,108,18,127,215,88,207,6,69,158,12,125,11,24,188,64,2,101,49,253,249,183,123,192,13,127,155,229,52,103,213,74,255,55,9,240,0,0,38,156,78,39,19,186,202,121,97,235,25,241,242,156,39,112,238,22,166,179,218,154,207,41,
+207,243,76,230,127,222,119,93,95,122,121,12,6,0,15,222,191,239,64,199,247,218,182,179,205,9,155,89,230,128,0,0,0,9,251,231,89,173,52,29,81,100,169,9,42,65,102,132,250,208,207,53,48,62,178,157,151,15,89,78,139,131,192,54,
+179,182,179,159,223,126,189,82,50,82,184,193,113,89,150,19,66,101,214,19,44,211,193,253,104,49,194,131,89,245,105,187,231,187,180,59,36,240,216,179,206,151,170,78,201,84,167,130,51,206,153,202,118,43,84,167,130,43,206,167,41,91,178,85,
+43,84,138,240,76,177,223,232,240,170,110,250,181,135,108,63,220,172,38,134,13,141,14,1,158,189,247,134,125,151,43,255,70,138,119,223,142,91,241,92,142,251,228,167,76,114,222,151,162,228,119,186,157,49,203,126,43,145,222,234,116,199,45,242,
+255,62,244,219,13,169,45,203,190,183,158,146,236,120,225,199,98,160,1,104,212,167,74,187,101,86,75,189,116,202,172,187,30,208,243,202,174,232,0,0,127,249,128,0,14,186,206,186,216,46,171,172,22,74,107,193,113,194,124,19,3,135,169,84,
+89,229,128,156,0,0,6,2,125,91,1,170,224,247,4,195,21,9,128,24,34,235,134,56,4,192,98,186,224,152,0,48,0,12,0,24,1,128,0,90,147,78,107,127,223,96,6,0,96,125,7,93,103,19,78,38,93,112,19,46,184,76,186,225,
+50,235,132,205,9,241,98,216,206,198,124,103,45,52,12,243,93,52,230,121,160,210,237,190,219,234,80,0,54,141,74,116,171,182,85,100,187,215,76,170,203,177,236,139,82,239,0,4,180,106,83,165,93,178,171,37,222,186,101,86,93,143,99,227,
+127,104,135,130,66,80,72,46,48,75,27,9,172,140,17,113,103,86,117,22,57,163,9,65,51,154,7,55,253,182,82,217,242,15,180,204,118,12,24,39,236,183,236,247,62,245,252,182,219,211,136,252,182,218,38,255,203,126,150,91,217,124,7,131,
+216,194,80,154,198,6,9,2,161,64,10,192,177,80,85,26,74,5,158,210,179,219,28,37,67,129,167,106,78,104,112,78,56,241,198,143,198,84,1,255,111,251,65,255,81,255,95,250,245,253,160,18,128,72,24,24,36,21,44,144,75,5,8,193,
+23,22,117,103,80,160,107,100,192,218,86,76,18,213,194,137,99,197,56,154,75,138,81,40,156,101,64,1,253,167,237,199,253,71,253,127,235,251,78,160,24,36,29,97,140,30,8,169,4,134,171,7,96,138,85,157,68,153,20,172,176,72,99,62,
+56,61,142,18,128,52,157,55,208,4,216,13,128,155,250,161,63,170,19,250,169,252,94,201,226,61,128,0,13,96,240,213,96,144,48,178,65,44,0,87,103,80,89,213,217,68,153,212,1,57,128,149,146,115,1,228,108,0,230,0,235,238,0,148,
+30,18,129,178,90,101,48,72,24,1,170,129,139,42,41,96,235,38,69,70,0,3,9,89,48,198,216,206,152,36,39,0,30,96,14,96,15,233,26,39,23,167,16,156,77,37,197,40,0,151,176,1,255,104,0,230,252,101,68,161,227,42,99,197,
+41,46,32,3,236,0,253,175,184,0,0,30,6,201,13,86,9,3,11,36,0,146,128,29,157,65,103,87,101,18,103,81,223,251,222,240,0,18,131,194,80,54,48,183,121,129,133,146,0,9,43,179,168,45,138,159,209,170,41,96,235,38,69,70,
+0,99,223,251,222,240,3,193,236,97,40,77,99,3,4,129,140,202,6,170,236,234,11,58,187,40,147,58,128,39,48,18,178,78,96,254,254,171,0,0,148,2,64,192,193,32,165,108,144,72,13,84,12,89,81,75,7,89,50,42,48,0,24,74,
+201,134,54,198,120,206,173,60,24,0,0,15,3,100,134,171,4,129,133,146,0,73,64,238,253,247,112,0,9,65,225,40,27,24,91,188,192,194,201,0,4,149,217,212,22,123,119,250,195,184,0,240,54,72,106,176,72,24,89,32,4,148,12,89,
+81,75,7,89,50,47,235,191,91,222,30,6,201,13,86,9,3,11,36,0,146,135,103,80,89,213,217,68,153,212,1,57,128,198,150,166,9,60,208,154,9,56,0,14,96,15,94,250,97,250,244,195,27,99,58,96,144,79,233,90,128,0,0,230,
+252,101,68,161,227,42,99,197,40,124,83,176,3,152,0,0,63,164,104,156,94,156,66,113,52,78,212,241,64,4,185,128,0,3,155,241,149,18,135,140,169,143,31,43,79,211,10,157,157,65,103,87,101,18,103,80,0,177,195,26,26,77,57,130,
+90,108,38,193,45,135,172,48,183,122,187,40,147,58,128,39,48,19,78,96,150,155,9,176,75,115,0,67,187,9,225,62,11,38,69,70,0,3,9,89,48,198,216,206,152,36,4,224,243,0,122,247,249,119,1,99,134,52,52,154,115,4,180,216,
+77,130,88,0,57,128,58,251,128,30,6,201,13,86,9,3,11,36,0,146,129,139,42,41,96,235,38,69,213,66,51,168,2,115,1,139,65,191,91,222,30,6,201,13,86,9,3,11,36,0,146,135,103,80,89,213,217,68,153,212,0,3,194,86,
+76,49,182,51,166,9,4,235,116,24,0,6,48,154,7,189,59,209,66,88,35,34,216,40,44,89,65,80,89,212,88,27,230,176,55,165,166,189,35,226,126,203,0,4,160,240,148,13,146,211,41,130,64,192,13,84,12,89,81,75,7,89,50,42,
+48,0,27,229,100,195,27,99,85,112,166,252,45,191,137,226,38,226,120,165,15,237,169,219,141,31,138,113,0,0,61,128,30,192,15,96,0,0,123,0,61,128,30,192,0,0,246,0,123,0,61,128,0,1,236,0,127,218,0,57,128,5,13,4,
+212,52,78,39,246,212,60,104,244,74,1,251,64,3,243,0,14,39,136,155,137,226,148,63,182,167,110,52,126,41,196,7,253,160,3,155,241,149,18,135,140,169,143,20,164,184,128,15,176,3,246,128,7,254,145,162,113,122,113,9,196,210,92,82,
+128,9,123,0,31,135,108,177,194,108,18,195,152,0,0,63,164,104,156,94,156,66,113,52,78,212,241,64,4,185,128,7,19,196,77,196,241,74,31,219,83,183,26,63,20,226,5,123,163,224,1,255,80,0,2,154,211,127,236,180,77,243,111,125,
+239,188,239,77,63,79,67,188,1,255,80,0,0,126,215,246,79,190,91,211,126,59,241,223,30,203,189,55,128,61,128,0,1,236,0,246,0,123,0,0,3,216,1,236,0,246,0,0,7,176,3,216,1,236,0,0,15,96,3,254,208,1,204,1,
+173,38,231,64,255,194,74,223,244,67,90,210,154,215,141,120,214,159,162,79,209,37,120,215,141,115,80,1,175,48,7,48,7,48,0,28,192,28,192,0,115,0,1,204,1,204,0,7,48,0,28,192,28,192,0,115,0,1,204,1,204,110,211,118,
+128,14,122,180,205,54,211,109,46,39,118,63,230,77,227,120,222,55,254,90,109,231,246,159,150,223,51,21,150,205,142,210,83,69,253,182,140,244,19,80,76,175,250,111,226,165,4,212,155,143,249,87,93,55,86,0,78,96,0,193,191,164,140,24,
+48,106,230,99,215,244,96,3,204,0,7,48,7,49,239,212,0,6,48,154,7,189,59,209,66,88,35,34,216,40,44,89,65,80,89,212,88,24,77,96,96,150,154,9,27,167,101,128,2,80,120,74,6,201,105,148,193,32,96,6,170,6,44,168,
+165,131,172,153,21,24,0,12,37,100,195,27,99,58,66,134,22,160,3,152,0,0,57,128,18,180,172,1,204,0,0,28,192,30,150,247,120,27,37,132,18,6,2,194,101,17,63,163,89,51,168,176,48,154,192,193,45,52,38,130,88,1,204,0,
+0,28,192,17,186,118,137,134,171,4,129,133,146,9,96,2,187,74,37,139,69,24,0,12,37,100,195,27,99,58,96,144,156,0,121,128,0,3,152,3,210,222,240,148,13,146,211,41,130,64,192,13,84,21,70,153,157,93,148,73,157,64,19,152,
+9,167,48,75,77,130,126,202,21,206,0,0,15,233,26,39,23,167,16,156,77,19,123,105,111,209,152,106,176,72,24,89,32,150,0,43,182,183,42,41,96,235,38,69,70,0,3,9,89,48,198,216,206,152,36,19,250,86,160,0,0,57,191,25,
+81,40,120,202,152,241,253,17,252,181,59,0,57,128,0,3,152,0,0,57,128,0,3,152,1,43,74,192,28,192,0,1,204,0,0,28,192,0,1,204,1,251,64,3,251,0,0,3,216,0,0,30,192,0,0,246,0,123,0,61,128,0,1,236,
+0,0,15,96,0,0,123,0,27,127,79,91,128,7,253,192,14,48,78,242,160,15,247,40,3,175,235,179,0,127,132,0,115,61,253,203,152,0,255,184,3,14,189,249,152,247,64,0,127,220,160,126,251,208,94,0,255,8,24,250,31,95,223,207,
+216,1,204,1,90,86,0,78,96,15,127,219,128,61,128,27,180,186,32,14,96,13,218,110,208,127,212,115,0,115,0,115,0,127,212,127,212,115,0,117,253,168,3,216,15,217,126,216,15,250,142,96,15,219,254,212,0,0,0,0,6,89,229,125,
+87,231,146,180,89,88,178,149,161,86,82,209,254,26,150,254,13,203,238,85,34,151,47,232,250,183,163,35,41,184,198,185,55,161,104,220,110,82,209,104,220,172,85,138,162,220,110,91,143,86,244,99,114,155,141,22,136,209,185,110,55,69,162,209,
+184,220,110,83,232,138,87,244,113,253,31,165,203,43,138,214,212,90,126,141,46,86,49,104,180,110,91,141,209,111,224,177,95,225,173,221,75,21,253,25,98,201,232,200,198,239,70,234,89,63,134,90,93,79,167,232,202,220,84,196,210,44,183,82,
+44,172,140,85,141,21,149,21,148,171,35,43,34,220,169,250,53,44,84,209,76,110,139,43,70,234,112,162,223,145,202,172,150,244,204,213,95,3,149,87,173,252,14,85,95,195,166,57,199,146,126,235,150,87,210,174,89,154,92,121,103,202,172,143,
+74,175,200,240,174,163,145,225,122,223,82,116,225,125,92,163,156,185,126,234,89,242,170,151,228,183,240,91,243,170,107,159,244,120,177,103,184,172,152,196,169,253,28,100,200,198,56,255,206,228,254,139,44,191,79,19,184,169,217,82,38,59,149,138,
+149,216,171,41,83,77,59,126,212,0,38,105,123,171,22,83,18,165,168,223,178,2,77,38,118,44,173,37,101,43,114,149,220,85,55,24,149,60,118,60,83,98,187,29,149,55,62,201,215,99,23,140,152,39,240,205,212,210,191,209,166,197,101,184,
+172,155,101,118,42,84,177,103,103,253,24,75,143,249,251,39,240,205,199,169,244,253,186,166,198,39,99,177,84,142,197,79,232,204,102,237,183,143,211,246,98,211,93,53,216,241,141,207,177,82,201,29,202,110,42,155,69,35,94,155,27,157,131,0,
+6,190,255,162,223,250,50,179,49,83,180,203,139,34,140,88,39,109,191,168,173,18,210,138,49,109,138,152,178,126,220,170,46,49,77,165,177,84,253,57,237,165,127,165,0,48,105,148,255,79,111,68,187,127,232,138,214,237,25,174,92,127,71,50,
+178,49,98,178,254,156,153,247,254,139,244,189,182,150,227,25,46,171,40,210,39,98,183,22,84,185,77,203,177,101,253,26,203,244,110,201,29,197,139,41,217,217,78,228,101,253,58,150,83,186,44,122,149,99,252,51,251,77,221,182,86,139,27,148,
+197,177,247,72,220,127,71,177,82,172,89,118,61,89,78,229,220,191,181,167,29,148,177,184,122,27,145,82,228,244,44,138,127,78,209,59,117,216,236,178,216,241,244,252,183,244,119,52,162,84,183,161,86,79,209,174,172,24,26,111,253,19,75,246,
+235,113,93,199,101,42,99,185,127,135,25,189,245,97,191,252,155,122,36,79,233,226,118,69,59,29,162,251,68,169,235,183,232,223,105,92,99,219,127,109,56,238,42,99,78,178,104,236,86,109,209,69,49,216,196,169,101,253,188,155,174,237,253,191,
+76,178,93,142,202,85,63,78,169,177,217,118,42,119,41,142,228,137,98,187,24,162,152,221,37,75,141,202,88,220,89,81,141,203,178,178,50,108,141,47,66,210,247,0,254,141,46,72,150,139,46,207,178,236,187,75,113,93,155,211,244,234,84,183,
+161,98,199,248,122,199,244,101,142,232,163,38,197,95,104,220,88,173,201,113,100,185,91,22,87,183,149,176,180,209,239,247,17,173,46,75,146,55,11,147,246,79,221,222,254,169,114,86,254,254,65,61,226,19,222,63,191,253,224,0,63,127,112,78,
+254,169,223,221,222,0,29,254,83,93,228,145,75,147,185,35,229,221,53,201,20,254,157,111,114,123,196,36,94,53,245,173,34,241,75,162,145,75,135,95,112,151,87,119,119,148,95,186,104,251,247,93,251,33,117,125,102,234,149,165,119,126,249,251,
+147,221,235,75,187,162,63,166,30,232,215,117,119,77,214,232,167,91,146,124,110,63,173,138,81,41,234,33,132,253,211,249,90,121,162,151,36,125,228,175,20,141,200,178,137,82,179,218,121,97,57,161,158,141,229,53,201,228,145,242,187,168,185,35,
+116,66,123,254,203,203,184,93,31,36,185,35,220,43,186,33,35,239,55,81,238,145,122,194,92,158,227,221,61,235,19,86,158,224,37,193,250,167,90,194,79,104,251,167,118,16,172,225,62,207,5,150,221,200,213,29,251,21,103,223,67,113,242,245,
+23,36,82,53,165,167,214,159,189,180,239,89,132,242,166,211,171,31,43,85,113,128,141,127,193,148,109,56,83,235,222,244,59,147,59,80,237,189,51,183,173,167,134,1,39,238,157,51,179,249,75,103,216,194,169,207,232,176,82,208,51,202,120,44,
+39,164,44,105,108,30,146,160,164,187,187,194,119,93,25,163,234,149,164,255,175,194,24,119,225,221,77,124,168,98,253,193,63,166,30,232,251,254,200,93,20,139,245,72,189,201,112,79,233,215,26,210,35,173,209,75,162,38,136,75,146,41,229,212,
+37,15,116,95,117,167,238,216,237,45,142,216,238,161,166,207,132,168,105,178,250,219,214,184,139,79,108,210,34,105,237,44,167,194,146,193,76,43,69,184,223,85,235,15,92,179,90,165,82,154,185,112,170,243,85,124,47,170,245,232,151,213,126,73,
+231,210,89,221,211,60,170,207,145,207,209,227,86,78,185,158,28,142,102,171,185,74,174,135,59,234,206,250,141,85,174,119,213,125,125,47,171,43,248,30,85,101,143,159,73,95,231,209,60,223,133,217,85,121,225,203,42,175,60,179,122,154,252,205,
+73,230,111,168,228,111,225,127,158,70,251,170,57,30,21,212,114,60,47,91,234,78,156,47,171,148,115,151,47,221,75,62,85,82,252,150,254,11,126,117,0,0,79,26,7,241,160,15,94,128,13,2,126,89,52,0,0,2,120,208,0,19,79,26,
+0,154,120,210,111,21,167,128,0,15,162,70,176,241,0,0,155,158,176,55,69,63,44,0,31,181,253,160,127,26,0,38,136,127,2,109,0,15,164,127,44,19,68,252,176,0,4,241,249,111,1,60,86,0,1,52,19,104,0,241,160,0,38,158,
+52,15,160,1,244,77,2,120,136,120,128,2,68,38,159,150,142,130,104,128,0,79,203,39,128,159,150,0,37,96,60,119,0,159,150,15,160,19,105,249,104,238,0,7,211,242,192,105,249,109,60,1,186,33,235,253,187,238,175,192,209,60,0,2,
+104,157,124,110,208,39,143,203,36,64,122,252,13,34,3,199,117,122,1,16,0,155,77,222,55,4,136,0,1,249,106,192,1,255,45,88,15,16,241,0,1,55,80,38,136,0,60,82,176,38,172,7,220,19,72,254,90,176,52,136,2,33,244,74,
+192,0,37,105,88,0,0,0,211,242,209,208,4,138,110,15,20,253,184,122,211,79,203,0,2,86,145,155,112,211,250,64,61,97,55,86,3,238,173,52,27,128,21,166,224,63,45,227,246,64,0,145,120,165,97,52,77,43,0,4,220,55,86,31,
+112,0,7,175,112,122,247,0,4,219,158,176,253,110,92,205,93,37,121,170,190,7,42,175,91,248,28,170,191,135,76,115,143,36,253,215,44,175,165,92,179,43,76,239,142,102,172,141,247,126,233,58,121,221,193,249,112,55,213,145,207,145,190,172,
+142,119,181,82,170,243,230,149,101,159,240,114,9,227,64,0,15,227,64,0,79,218,86,2,117,0,0,3,196,9,162,6,234,211,112,155,246,90,86,2,104,155,128,1,63,170,5,96,77,89,225,149,245,37,87,69,146,174,149,103,120,19,120,0,
+9,162,3,233,184,12,184,101,134,244,91,163,122,85,210,172,239,15,160,253,144,26,110,172,38,149,135,241,160,172,4,138,110,9,253,80,0,79,218,128,52,9,166,224,3,232,38,211,118,129,227,160,0,86,60,71,117,96,77,88,252,182,231,175,
+246,225,43,221,165,99,246,67,74,192,2,189,0,79,217,0,63,110,19,77,213,128,0,1,52,77,43,9,160,220,0,172,37,245,103,211,52,82,209,100,185,75,45,87,198,229,98,172,85,22,227,114,220,122,183,163,27,148,181,89,103,203,206,241,
+187,74,192,154,180,253,189,97,50,225,211,58,212,180,89,46,82,202,145,185,90,252,152,170,69,46,95,209,245,111,70,70,83,113,158,215,249,223,208,15,219,214,2,87,166,224,245,128,3,215,185,43,3,246,233,88,125,0,77,213,128,245,233,226,
+176,0,120,191,237,195,254,220,0,31,246,245,128,149,238,0,9,180,79,218,214,19,77,193,244,221,88,9,251,119,253,147,199,135,95,30,119,68,0,55,37,105,251,175,236,215,117,105,251,186,155,57,151,51,203,129,205,57,93,81,170,252,207,74,
+138,215,81,170,252,250,87,125,87,231,121,225,126,85,94,217,27,243,106,175,101,55,240,168,223,87,14,85,26,175,225,93,70,171,211,162,223,211,205,50,191,165,217,203,51,203,58,178,207,47,209,174,85,94,31,57,87,127,11,250,38,84,55,167,
+3,159,75,171,243,141,221,107,186,138,106,253,74,210,57,75,63,62,137,230,252,46,202,171,207,14,89,85,121,229,155,212,215,230,106,79,51,125,87,180,124,85,120,125,201,157,245,213,125,113,74,100,141,78,85,30,23,39,159,240,148,250,114,203,
+133,253,2,126,200,104,38,221,250,159,212,93,232,99,195,247,189,57,1,251,122,195,214,245,205,215,132,115,75,218,243,150,105,122,229,82,249,167,79,59,184,63,46,6,250,178,57,242,55,213,145,206,246,170,85,94,124,211,206,252,106,225,201,243,
+163,83,39,243,232,149,107,80,79,212,254,161,63,83,193,181,200,15,63,213,202,170,93,78,73,250,143,212,156,245,108,188,223,165,26,247,170,187,223,207,33,231,210,89,209,169,148,184,114,127,60,147,133,237,86,73,195,147,254,163,245,63,168,90,
+55,232,179,55,249,244,168,31,212,254,169,63,83,233,194,95,171,253,70,85,63,12,170,207,145,206,89,221,210,252,147,207,165,235,209,47,168,213,95,11,234,53,114,225,87,38,225,145,170,243,127,14,149,114,60,47,202,171,250,87,125,87,230,181,
+212,106,191,58,175,204,244,170,92,174,168,230,121,112,57,174,121,28,170,191,133,245,45,89,102,160,99,11,96,0,1,224,165,64,153,128,151,114,149,62,95,191,245,0,0,46,242,126,239,40,91,0,6,0,74,1,25,251,251,176,2,104,97,140,
+0,79,41,241,242,167,114,178,189,194,80,80,36,212,2,203,70,242,133,128,1,168,160,99,135,232,237,135,235,226,37,238,98,29,68,174,147,106,173,70,182,0,36,110,159,2,181,220,49,161,82,165,102,194,120,121,126,182,80,182,0,7,130,166,
+0,74,29,222,64,0,18,22,242,15,11,87,221,128,146,210,228,239,18,96,18,56,224,221,198,139,50,133,56,10,91,2,193,130,41,242,150,250,172,159,172,122,198,180,9,162,80,7,208,77,184,77,88,3,90,120,208,4,161,226,186,0,148,20,
+59,99,218,177,143,96,0,18,174,85,154,192,18,172,0,13,96,77,88,0,119,127,48,12,104,198,113,112,8,178,194,140,90,216,79,38,89,66,140,152,98,218,171,171,171,174,45,143,239,61,120,121,7,220,4,213,128,148,214,128,0,0,61,246,
+194,123,106,161,34,202,10,247,220,36,195,208,225,235,130,176,19,42,47,144,192,178,137,175,207,187,245,148,214,135,106,195,237,65,53,0,74,1,173,0,2,104,91,0,30,10,91,12,105,138,227,11,37,49,137,84,91,119,216,208,219,21,176,48,
+193,217,237,41,222,146,83,130,51,170,42,85,159,119,12,51,60,83,182,52,77,231,126,212,154,128,13,119,235,188,0,0,0,12,123,222,216,81,117,105,204,44,197,82,121,189,97,111,41,240,3,200,106,178,134,5,79,150,52,99,132,167,182,87,
+225,12,36,187,241,166,240,38,160,19,111,151,106,241,90,206,241,45,224,0,0,0,66,194,101,108,4,173,130,46,44,248,77,98,200,167,4,92,90,74,139,37,148,254,95,205,3,4,182,2,75,57,101,194,121,96,145,158,74,138,125,112,254,104,
+0,39,150,171,58,88,224,178,193,142,31,173,62,64,99,108,4,204,179,225,58,96,145,62,165,74,254,247,15,214,128,31,64,158,52,220,19,79,23,46,102,167,169,42,229,194,171,205,85,240,190,171,215,162,95,85,249,39,159,73,103,119,76,242,
+171,62,71,58,26,175,224,115,166,70,254,7,129,225,200,230,106,187,148,170,232,115,190,172,239,168,213,90,231,125,87,215,210,250,178,191,129,190,124,170,253,164,248,239,93,251,62,254,201,225,22,109,234,234,155,229,199,109,233,28,87,133,102,133,
+125,82,146,226,244,223,174,156,70,61,143,92,149,55,114,171,122,239,78,11,219,121,172,0,52,241,88,9,164,127,45,88,0,36,64,155,194,86,2,86,0,19,110,141,96,0,155,128,127,27,180,172,0,4,83,64,159,213,127,26,1,91,232,18,
+184,129,251,33,88,17,172,37,113,15,92,107,9,160,155,116,168,30,33,235,210,128,1,43,243,201,122,121,231,125,87,215,210,250,178,191,129,191,60,170,235,152,0,117,233,231,44,238,233,158,85,103,200,231,125,89,117,188,0,35,203,132,115,60,
+57,30,23,213,145,203,56,231,149,75,85,249,128,4,121,112,141,245,112,229,81,190,163,151,6,190,61,173,235,230,0,77,227,124,102,220,31,74,246,160,155,126,59,198,63,167,26,211,26,244,74,75,120,27,210,128,7,236,155,223,176,77,147,126,
+62,6,171,191,30,59,39,162,80,169,225,90,46,249,240,155,136,215,140,221,130,152,229,233,187,149,72,169,201,51,86,168,212,153,154,146,174,92,42,188,213,95,11,234,189,122,37,245,95,146,121,244,150,119,116,207,42,179,228,120,101,83,254,163,
+147,231,70,166,79,231,208,12,127,83,250,132,253,79,6,215,41,116,171,28,171,207,27,248,0,115,213,178,243,126,158,96,0,255,169,253,82,126,167,211,132,191,87,192,0,31,135,39,225,123,107,80,0,11,245,111,213,189,95,171,0,99,231,150,
+53,81,179,229,47,212,114,0,0,0,126,158,111,149,26,153,191,46,0,0,37,250,158,7,149,212,108,207,47,62,132,0
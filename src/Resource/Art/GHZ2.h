@@ -0,0 +1,79 @@
+129,113,128,3,1,20,6,37,15,53,19,70,46,85,18,102,47,115,0,129,4,4,23,112,130,4,8,23,108,39,113,55,114,120,235,131,4,5,24,240,56,237,132,7,109,133,5,14,23,110,40,239,56,231,134,5,24,24,238,56,245,120,246,135,
+6,50,23,116,136,7,111,137,8,234,138,6,53,24,243,139,6,51,24,241,140,6,52,24,236,141,5,21,24,230,142,5,20,24,244,143,5,22,24,242,255,252,167,175,229,0,29,115,214,123,239,77,91,83,190,51,212,254,96,239,0,113,215,150,
+247,234,115,110,169,33,222,218,157,64,23,160,23,42,50,21,157,60,180,182,150,160,2,91,0,19,221,208,1,203,156,1,201,182,0,37,178,118,157,175,75,53,141,163,74,199,145,176,3,141,121,236,253,78,109,73,33,179,106,117,252,207,238,186,
+183,128,58,231,190,122,222,155,219,121,214,58,183,159,51,168,3,142,254,90,191,121,234,108,228,135,86,222,119,250,126,246,150,0,117,206,211,173,233,102,177,172,82,199,152,212,1,198,220,170,251,26,54,146,67,86,177,183,143,159,54,149,0,127,
+220,1,203,244,238,0,127,136,1,119,56,3,254,243,172,245,189,53,106,154,229,165,114,242,139,0,56,215,137,179,234,116,106,73,13,154,166,222,159,191,165,165,73,216,62,211,180,232,251,53,141,166,130,212,54,190,211,160,160,12,160,61,30,160,
+73,68,248,40,101,64,201,218,151,163,34,134,80,10,61,68,233,111,223,121,0,58,229,164,173,59,79,77,150,49,94,201,105,59,7,215,137,172,63,71,217,170,107,52,21,208,218,251,79,65,160,12,160,63,203,210,180,242,0,78,147,165,233,70,
+161,165,154,141,99,229,251,235,80,7,210,116,125,13,154,210,67,70,161,160,2,244,154,205,1,89,164,213,1,253,119,235,105,96,39,73,210,244,163,80,210,205,70,176,62,95,190,181,3,233,58,62,134,205,105,33,163,80,208,1,122,77,102,128,
+172,210,106,129,235,52,244,253,239,160,157,39,75,210,141,67,75,53,26,192,4,23,42,50,21,19,71,171,35,40,0,11,170,104,37,83,70,180,180,150,255,202,36,181,150,161,191,77,150,172,129,145,232,200,244,108,126,159,95,213,222,146,73,35,
+127,27,244,239,73,36,146,72,253,63,91,43,92,146,202,207,253,62,195,22,104,148,62,173,23,249,118,122,86,194,199,65,116,86,40,214,150,146,209,172,59,57,180,183,161,64,86,105,53,64,245,154,0,4,232,251,54,147,138,157,141,102,163,104,
+44,15,55,167,103,149,77,4,170,104,214,60,141,34,234,53,64,244,242,230,236,185,81,144,168,154,61,89,25,64,0,209,246,109,46,181,213,217,77,154,24,149,128,63,173,167,101,168,203,52,0,102,104,31,102,177,164,243,181,104,214,122,128,1,
+163,236,212,186,215,107,75,45,42,217,132,122,178,50,128,1,163,236,218,93,107,170,218,53,5,79,88,3,16,219,4,221,39,61,204,139,179,40,202,3,220,31,187,14,253,59,160,1,254,44,131,139,139,131,227,108,56,187,39,0,10,255,72,1,
+176,241,118,66,78,156,79,252,91,64,31,229,219,60,62,26,46,139,191,77,183,184,198,37,0,30,126,215,210,116,125,13,154,210,67,70,161,160,23,240,181,26,134,198,210,67,70,161,160,23,160,8,104,212,54,67,70,161,160,23,160,23,42,31,
+47,215,86,150,0,9,90,84,157,39,102,163,83,202,86,157,3,233,58,78,207,163,80,210,104,41,99,75,233,59,11,0,202,4,211,181,1,73,36,212,213,244,124,3,89,233,117,31,109,15,161,211,201,13,27,73,104,214,53,191,102,155,12,74,
+166,194,250,91,178,180,174,129,36,147,83,103,232,248,6,211,165,218,62,180,61,134,156,200,116,106,74,141,83,107,246,83,97,137,88,212,95,214,4,176,118,109,227,136,24,156,93,135,198,15,113,226,216,104,148,52,28,74,59,143,113,196,182,152,
+1,255,180,2,80,118,30,56,129,19,197,208,252,65,216,127,76,208,216,150,27,6,37,29,219,123,163,18,131,129,127,176,3,218,117,158,119,166,109,83,83,174,103,152,212,1,250,108,253,106,252,206,173,164,144,213,179,57,249,248,243,105,80,7,
+180,243,157,111,74,182,103,51,165,79,137,204,1,250,106,250,230,250,157,27,89,33,205,170,107,231,227,205,165,64,30,181,253,49,173,233,86,204,231,163,85,181,61,156,222,58,230,3,235,58,247,28,241,174,14,178,67,155,84,212,120,249,254,99,
+243,32,15,241,40,3,183,246,224,78,175,198,125,199,244,197,42,217,156,244,106,182,160,246,115,120,235,152,125,103,87,230,117,109,48,216,56,67,155,84,212,2,159,163,40,82,106,0,190,134,198,193,168,108,115,219,249,134,216,0,246,15,172,234,
+252,206,166,173,91,109,166,208,7,46,112,251,78,207,212,230,107,178,185,166,168,39,156,235,44,37,112,115,198,122,182,109,160,7,207,199,155,74,191,57,230,250,157,27,89,33,205,170,106,5,233,217,83,227,231,87,230,117,109,36,134,173,153,204,
+11,208,38,185,181,78,135,89,33,205,170,106,5,232,2,26,182,103,84,53,108,206,96,94,128,92,168,82,150,109,18,134,146,67,102,177,176,23,160,8,108,218,156,208,217,181,58,129,122,1,114,161,236,230,207,126,122,128,61,115,198,184,57,222,
+153,181,77,117,108,231,231,227,205,165,68,234,116,108,229,132,207,6,166,186,53,64,122,118,115,120,249,128,61,131,243,158,111,169,208,215,186,167,7,6,183,165,91,51,158,141,80,30,128,106,217,189,53,108,192,15,73,172,208,21,158,190,59,233,
+94,192,7,173,113,166,13,111,74,182,103,61,26,179,236,230,241,215,49,60,206,173,89,97,43,131,153,207,86,204,7,167,159,137,169,208,231,122,102,213,53,213,179,1,232,6,141,87,166,141,80,3,210,107,52,5,102,158,59,233,94,195,156,148,
+230,36,167,63,89,160,64,140,183,33,176,6,211,209,252,225,172,46,253,167,36,8,18,238,253,190,179,64,129,15,47,208,128,15,180,180,149,103,156,244,238,175,118,126,114,214,117,15,207,244,199,60,63,87,213,179,57,205,6,122,156,239,206,122,
+141,64,101,1,254,126,52,175,100,180,158,97,245,253,49,174,31,163,243,106,154,205,5,116,53,190,179,208,104,3,40,15,241,243,210,222,131,104,218,63,170,200,16,13,160,109,3,107,133,232,59,127,98,4,236,248,174,195,196,165,154,166,180,107,
+54,128,250,126,246,150,15,172,236,250,154,53,33,160,194,27,53,141,64,252,207,230,60,243,212,1,215,61,243,214,244,213,183,157,231,61,241,249,136,212,1,199,127,45,239,212,245,55,84,144,234,218,157,254,62,126,84,177,246,191,43,221,250,127,
+218,30,254,208,63,99,251,79,96,63,105,251,126,222,112,56,120,115,227,45,137,52,198,69,46,76,20,41,207,14,238,232,200,247,79,40,103,109,100,155,128,23,227,156,0,247,113,218,0,22,164,184,90,151,165,168,212,253,253,0,0,55,243,255,
+92,134,173,193,144,86,104,201,83,91,191,91,193,74,69,82,112,81,235,12,168,254,12,141,74,233,205,232,146,165,233,43,74,151,164,169,122,78,141,252,243,91,212,86,245,173,234,43,122,191,208,240,242,139,85,252,197,10,161,253,106,222,175,65,
+114,45,202,33,76,121,126,133,150,150,253,15,106,31,6,64,37,193,65,175,235,186,183,248,223,137,98,88,111,93,188,95,137,98,88,150,117,209,40,190,74,83,245,183,37,184,77,74,163,213,234,202,147,94,7,131,251,31,192,250,33,225,10,203,
+192,21,154,240,146,240,240,10,245,224,202,245,63,173,167,27,187,7,96,0,13,63,91,250,234,148,101,101,110,5,91,177,144,171,251,10,21,159,103,9,118,4,239,237,59,70,209,180,71,233,174,218,48,49,31,164,216,252,12,12,79,150,95,166,
+185,2,14,29,73,191,109,54,208,20,122,20,5,74,189,65,66,133,74,3,15,131,1,234,80,168,42,81,232,10,21,42,84,21,48,80,61,30,165,1,82,133,10,206,147,66,175,70,164,150,134,144,96,61,30,160,163,212,165,31,67,102,82,165,
+10,161,165,214,138,45,22,193,144,169,66,128,173,202,10,20,42,80,95,0,169,82,133,65,66,133,74,2,175,66,160,193,67,1,232,245,40,10,148,122,206,147,66,165,10,53,36,148,52,83,0,163,208,92,133,76,81,244,54,101,42,80,170,26,
+92,152,140,142,69,204,129,22,229,122,9,164,213,232,183,43,211,182,254,10,0,159,5,12,162,12,44,41,84,122,61,74,178,43,208,172,213,22,106,85,21,25,20,163,34,232,144,168,250,33,88,84,110,10,10,149,19,82,175,86,91,149,235,53,
+43,90,105,8,96,232,218,24,75,180,100,186,56,53,47,74,52,24,179,81,160,24,253,25,91,82,113,86,224,87,71,195,232,108,209,36,42,212,52,3,203,247,220,5,233,122,95,23,173,232,37,75,95,23,90,43,56,169,172,237,250,201,215,194,
+92,203,125,79,147,233,228,222,69,101,104,67,91,184,105,253,27,187,91,194,168,181,240,230,60,40,167,245,170,128,9,232,250,181,46,173,214,106,54,141,205,67,161,177,173,209,118,144,97,169,135,126,158,45,27,127,110,0,244,242,230,236,15,80,
+85,10,4,101,163,237,114,78,152,169,74,21,174,122,89,25,74,165,203,163,210,118,106,173,27,100,244,134,174,41,136,187,23,87,242,155,207,112,197,182,105,135,187,163,167,251,127,218,0,61,121,1,63,219,254,211,246,224,15,218,0,63,111,249,
+78,238,155,128,13,177,182,75,13,13,137,67,241,183,17,220,123,131,96,75,186,252,9,98,94,192,0,7,237,231,185,184,126,80,1,249,78,29,54,1,63,219,254,208,1,62,155,186,112,110,147,135,127,91,32,47,246,31,148,217,211,128,28,135,
+56,1,182,54,193,214,0,235,13,177,182,62,37,18,139,160,255,8,197,209,40,148,63,137,226,96,195,224,164,62,10,78,10,54,195,9,56,43,56,43,37,189,127,99,224,97,240,86,31,5,103,5,91,97,133,156,20,156,20,146,74,40,181,74,
+250,62,143,182,43,221,118,25,218,55,237,50,139,68,160,2,157,73,212,186,175,80,40,245,40,10,148,40,84,20,42,244,5,95,6,3,209,234,10,61,74,2,165,74,21,6,12,11,145,234,80,21,40,245,5,10,148,40,10,61,76,2,143,65,
+114,21,48,10,149,40,84,88,209,104,182,12,143,66,128,169,87,172,145,144,161,82,128,195,225,32,61,74,21,146,20,82,143,73,172,208,169,82,179,161,171,120,69,18,13,110,134,70,209,74,53,11,142,70,22,19,36,201,65,66,175,65,101,124,
+98,5,140,38,25,92,114,187,36,200,237,93,168,10,149,40,84,105,21,91,45,3,33,82,133,1,91,150,72,200,80,169,65,36,128,84,169,66,178,67,192,161,82,147,89,171,208,172,232,106,208,169,77,134,183,67,35,104,165,26,133,199,35,11,
+9,145,201,65,66,165,10,11,35,215,16,44,144,112,140,227,149,217,28,147,106,237,128,84,169,66,163,35,146,20,15,66,165,10,7,43,139,139,148,20,40,84,160,190,1,82,165,10,135,35,145,202,228,5,94,133,67,161,200,232,112,100,122,148,
+14,87,35,139,148,20,42,80,160,40,245,48,10,61,3,56,185,28,174,128,84,169,66,161,197,202,229,112,100,122,20,14,87,43,139,148,20,40,84,160,48,248,48,30,165,10,135,43,145,197,200,10,21,42,84,57,93,14,71,6,71,169,64,229,
+114,57,28,160,161,87,160,42,248,48,30,143,80,228,113,114,185,1,82,165,10,141,182,219,92,181,119,85,208,4,31,96,7,110,236,245,0,62,147,163,232,81,173,36,52,106,20,244,242,230,210,163,172,9,217,241,93,135,137,75,53,77,99,75,
+31,35,81,214,3,234,212,54,216,107,6,16,218,117,180,107,154,109,206,130,104,115,107,94,154,182,102,150,108,192,122,91,197,51,214,150,0,11,112,215,51,187,95,29,74,57,29,195,83,153,212,211,82,153,186,128,1,184,166,169,157,145,201,159,
+153,215,105,241,213,181,67,103,98,189,131,156,115,245,128,63,234,7,60,249,126,220,1,255,80,7,245,246,75,112,29,191,183,245,129,196,117,243,142,240,239,219,246,129,198,238,39,242,157,210,216,55,75,195,187,144,3,216,108,27,49,42,159,210,
+0,0,0,0,0,125,96,74,176,0,18,172,7,254,223,159,244,250,229,222,0,125,96,93,187,246,251,165,223,189,223,167,1,245,128,119,31,211,238,108,133,255,167,215,46,247,214,7,123,116,115,247,127,72,1,223,189,223,167,0,0,250,192,61,
+31,88,61,4,226,85,110,147,221,177,186,79,160,151,233,255,133,222,5,221,98,247,93,186,93,224,75,119,46,155,27,116,247,11,176,255,219,161,233,118,66,254,176,37,186,91,132,183,79,115,113,203,147,58,237,211,217,116,55,237,226,237,211,220,
+46,199,244,142,31,141,143,238,187,23,250,203,186,236,75,23,251,0,28,255,210,97,215,68,162,236,67,225,191,141,0,95,236,0,246,233,45,221,37,187,15,253,161,254,54,211,210,237,187,186,75,119,244,128,19,139,24,0,0,46,172,74,176,0,
+0,6,117,238,0,0,250,193,221,115,174,169,117,213,46,147,174,233,115,191,164,224,47,239,223,211,99,234,92,36,233,59,145,221,115,128,2,78,147,143,240,178,217,55,73,194,124,127,142,5,238,254,150,81,115,174,221,115,132,224,186,112,93,56,
+187,16,254,63,198,104,148,74,47,115,246,254,153,193,241,44,79,143,241,154,37,18,139,255,111,218,0,235,18,220,254,249,198,91,186,93,222,221,239,221,46,176,6,198,216,11,164,233,57,185,101,197,238,147,164,233,71,233,251,64,30,194,124,189,
+64,255,168,159,88,151,78,126,141,251,78,64,75,103,233,182,183,240,131,247,63,189,184,229,206,219,30,237,147,117,219,155,103,78,91,128,151,88,3,248,95,167,110,142,127,64,107,15,253,62,185,58,91,167,210,125,26,37,80,4,255,79,174,93,
+224,75,119,45,215,58,78,48,253,198,179,220,107,115,141,102,224,0,0,0,4,157,39,93,18,169,116,157,44,132,157,252,34,233,56,95,187,250,71,33,44,175,235,2,247,63,159,12,231,224,51,165,253,46,231,78,4,161,255,183,220,47,116,156,
+254,183,185,240,25,207,131,184,227,100,240,37,139,255,204,0,216,221,223,148,189,210,116,156,220,178,226,247,73,210,116,176,188,58,110,0,123,95,137,98,88,111,227,0,31,236,47,196,177,44,75,18,135,185,161,238,56,60,114,217,135,186,78,147,
+164,233,56,9,59,250,78,150,82,202,78,159,28,187,197,238,147,155,147,132,156,39,223,88,0,0,27,32,119,111,119,64,11,175,235,189,192,126,159,93,209,144,125,78,66,78,226,31,144,159,233,223,184,11,156,221,115,112,147,159,136,233,177,176,
+28,31,15,229,234,248,2,80,4,162,91,127,204,0,187,140,225,156,7,175,39,195,56,62,46,233,207,208,93,144,111,225,94,224,30,239,211,199,233,196,61,193,252,114,228,206,18,116,156,217,115,134,200,192,124,100,106,38,224,31,7,163,234,114,
+2,254,34,110,0,75,33,127,240,153,192,93,148,126,223,113,112,18,254,151,115,56,63,0,77,192,79,252,88,19,115,64,110,155,192,15,216,0,150,238,155,251,192,13,253,32,3,59,46,208,7,31,227,0,59,215,46,32,14,176,7,237,214,252,
+74,37,19,118,15,44,163,19,116,157,39,94,238,29,46,196,177,40,159,233,185,100,216,123,131,97,238,108,30,241,55,73,215,245,139,242,150,71,47,225,110,14,23,245,223,148,178,150,87,59,43,156,107,55,24,155,128,2,254,252,171,39,73,198,
+179,113,137,197,249,1,127,232,87,247,151,84,218,86,173,214,173,214,149,165,102,79,35,100,242,163,86,23,155,210,190,18,77,60,10,190,188,21,46,66,144,83,195,97,67,77,63,66,178,91,170,245,157,66,223,80,183,212,6,253,119,235,210,31,
+250,19,87,240,211,152,240,110,102,240,225,52,59,60,17,145,250,81,233,58,126,183,177,162,250,197,245,176,176,179,252,145,173,58,121,37,141,63,91,165,45,118,146,73,171,105,36,0,93,205,163,249,131,233,58,62,134,26,210,67,70,161,80,60,
+124,255,49,213,188,117,128,58,199,126,90,254,156,0,1,177,217,52,179,88,219,46,173,93,231,150,241,214,0,235,30,63,180,238,125,38,175,161,179,68,144,209,168,104,5,252,53,57,243,118,32,213,171,44,193,175,112,23,43,112,62,23,40,20,
+7,78,234,154,3,164,234,0,18,254,151,112,124,28,9,98,232,186,5,248,143,235,28,1,39,33,215,25,66,128,5,144,234,134,142,215,111,158,104,83,61,190,126,41,170,103,187,111,235,165,105,208,62,147,164,209,244,100,52,154,10,101,76,83,
+43,56,20,122,148,5,74,20,43,58,79,105,87,161,74,51,142,71,42,26,100,92,30,143,80,80,184,169,74,62,134,205,135,161,84,52,103,29,182,202,155,104,235,109,5,30,165,1,82,143,89,210,123,74,148,40,82,141,145,200,186,134,155,75,
+129,71,160,187,5,76,81,244,54,109,175,66,168,104,217,29,190,95,190,181,7,252,255,239,255,21,42,84,171,41,82,165,64,31,243,255,143,253,250,255,226,45,64,0,1,169,52,52,125,10,31,70,160,2,116,54,12,148,106,26,62,147,183,238,
+245,207,93,169,250,63,216,169,252,206,165,27,168,193,214,112,96,0,216,118,148,236,166,223,211,152,48,141,175,55,19,153,131,89,170,64,1,233,213,179,133,50,110,163,7,89,245,121,223,231,156,245,59,4,245,59,17,89,127,84,117,223,174,252,
+246,224,230,96,214,122,243,63,245,87,108,53,19,216,107,63,58,183,29,167,244,206,201,219,83,244,127,177,86,86,67,191,243,62,111,78,39,89,67,211,101,219,250,142,198,198,237,63,93,183,163,65,132,108,155,139,107,250,221,27,51,197,94,169,
+122,108,87,172,26,232,83,171,243,25,227,110,66,127,170,205,253,71,140,224,236,158,195,155,250,191,84,81,89,89,10,70,236,109,192,253,85,103,196,213,251,12,79,83,178,239,62,107,178,110,59,79,233,157,147,182,167,232,255,98,172,172,128,239,
+252,207,158,108,156,144,50,114,67,138,246,122,91,111,70,131,8,217,55,16,124,255,91,163,39,134,197,12,158,27,20,167,234,60,119,228,37,227,36,129,61,74,65,234,159,138,30,166,212,161,241,119,102,220,13,122,165,10,37,10,218,63,88,157,
+14,103,45,31,30,57,103,212,238,172,175,95,241,98,89,9,100,223,194,253,52,213,252,58,119,6,246,2,248,254,182,78,158,198,225,211,242,156,31,144,150,83,77,158,187,92,85,241,114,67,212,165,249,57,183,52,73,36,151,255,212,1,187,150,
+225,176,6,228,63,164,27,119,77,221,47,116,178,139,156,220,157,39,75,47,225,23,74,63,207,123,164,233,57,185,101,197,238,147,164,233,71,249,239,119,244,157,39,75,46,47,116,246,58,78,150,212,240,221,208,56,56,127,89,148,40,14,1,192,
+59,2,245,7,244,124,224,168,31,214,103,0,28,0,11,250,96,5,206,0,14,224,36,160,0,48,0,231,253,30,28,28,28,28,191,166,185,193,193,199,191,180,184,56,56,122,205,193,193,205,250,31,210,32,40,7,245,91,104,3,104,0,39,120,
+3,181,59,192,253,191,46,126,64,8,253,39,35,129,129,137,242,63,166,135,198,31,15,140,62,31,24,124,62,39,2,26,46,131,7,248,79,129,19,135,195,227,244,199,150,47,140,95,24,159,22,253,52,79,15,137,225,241,60,126,135,244,125,0,
+18,220,4,144,0,3,128,23,237,0,0,47,75,208,11,210,239,8,122,44,248,92,151,254,199,180,0,5,235,37,189,111,89,45,200,183,47,240,138,201,69,253,188,158,151,112,185,47,235,0,118,254,134,36,178,89,45,252,158,178,89,45,255,163,
+253,141,235,37,146,201,56,189,100,178,91,255,71,119,232,230,162,254,176,0,28,68,123,122,128,61,121,1,139,240,255,218,0,57,122,128,58,253,120,136,30,188,128,29,99,151,168,93,124,121,184,117,39,235,207,98,89,173,119,135,98,50,157,138,
+81,148,161,163,212,161,163,41,216,167,133,57,183,126,97,42,219,206,244,208,213,191,80,121,143,230,26,167,209,211,66,165,207,66,165,205,83,232,231,233,250,239,212,163,102,51,150,103,244,142,126,99,104,252,163,146,205,103,215,69,244,78,164,187,
+41,100,255,212,237,57,75,41,109,159,234,110,211,153,191,112,127,67,213,87,117,83,245,231,177,31,105,47,232,91,192,218,147,216,151,112,90,79,194,188,10,126,183,127,230,119,165,91,121,222,154,26,183,234,57,157,190,123,233,143,212,93,87,63,
+126,41,117,93,191,115,244,94,239,212,160,187,242,142,158,217,102,127,40,233,237,150,115,75,53,159,93,23,209,58,144,126,100,117,93,249,147,182,93,67,108,244,230,111,220,126,229,58,147,219,30,159,193,59,211,202,238,174,31,175,127,230,127,67,
+119,234,64,254,54,91,207,240,77,175,177,254,248,67,253,22,255,73,254,54,91,206,61,56,27,54,244,179,89,253,73,75,36,255,50,151,254,100,0,0,23,118,254,198,124,167,255,49,47,7,167,131,126,143,248,64,12,15,211,108,27,7,176,2,
+124,243,239,14,30,192,14,126,209,184,110,87,255,27,188,1,219,206,0,28,227,180,126,208,1,62,176,37,178,91,0,29,96,114,245,237,231,0,0,47,91,212,11,214,237,216,122,186,126,23,45,253,188,224,0,47,116,157,123,175,116,157,114,186,
+231,127,24,186,78,23,243,250,189,110,240,185,111,246,0,126,211,244,247,229,44,165,147,251,255,132,217,67,224,229,15,131,148,62,26,30,238,151,229,23,101,23,101,13,223,7,139,101,56,57,78,14,83,134,240,108,126,145,188,6,225,184,0,57,
+251,64,27,191,172,202,21,193,205,207,225,220,7,56,237,0,118,243,128,61,187,195,188,7,135,63,111,63,104,0,1,219,206,163,244,124,224,0,0,0
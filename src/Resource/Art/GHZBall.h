@@ -0,0 +1,7 @@
+128,38,128,5,23,20,9,37,22,52,10,69,25,84,5,101,26,114,0,129,4,4,22,56,130,4,6,22,57,38,60,131,5,24,22,59,132,6,58,23,122,133,4,7,23,123,134,5,27,24,248,135,4,8,24,250,40,249,255,0,13,97,112,184,
+23,11,129,112,46,0,92,0,107,254,122,198,123,174,243,140,246,0,0,0,0,11,250,60,254,140,0,0,0,0,0,51,255,48,0,214,21,27,40,168,42,10,130,161,110,94,121,127,155,69,32,192,169,223,237,48,47,20,152,230,83,13,45,116,
+107,53,240,214,105,253,148,126,150,206,175,73,158,37,229,21,21,50,226,10,154,255,176,106,3,246,126,63,236,103,202,105,106,249,167,21,235,244,191,199,191,25,64,47,176,39,230,223,89,140,237,63,165,0,26,245,253,96,0,210,42,42,42,95,
+154,230,241,100,152,166,84,152,166,84,107,193,100,87,179,89,169,238,234,227,236,254,143,78,47,21,197,113,148,84,21,213,238,212,247,72,253,45,248,167,109,229,167,226,96,88,87,211,0,44,31,11,239,191,31,142,255,101,62,30,87,237,103,221,
+123,47,252,27,241,148,3,95,25,73,248,148,138,218,94,45,245,228,197,218,161,98,89,88,86,21,254,127,109,229,255,99,126,114,198,156,247,79,250,30,154,238,173,15,109,217,167,107,181,216,107,228,250,183,54,138,230,99,45,49,158,70,15,251,
+28,24,77,54,18,125,217,146,223,86,74,130,208,250,104,150,204,16,116,249,220,186,165,108,178,78,197,218,193,179,226,186,253,31,237,64,1,4,19,76,154,99,6,98,113,63,165,57,186,47,58,107,160,168,3,245,253,17,125,87,171,165,186,191,
+24,164,237,39,171,35,217,48,143,110,159,113,201,233,82,254,171,28,95,171,39,105,78,150,234,206,152,75,0,0
@@ -0,0 +1,4 @@
+0,10,128,5,26,21,25,36,9,70,57,116,11,129,5,27,130,5,29,131,3,2,21,30,40,250,72,251,132,3,1,23,124,133,3,0,20,10,134,3,3,21,24,135,4,8,22,56,255,231,234,124,248,202,125,138,210,125,5,111,75,160,238,147,
+131,177,216,80,16,236,21,3,98,15,83,8,65,107,8,96,160,194,24,209,193,85,164,112,61,148,127,76,39,198,185,254,159,56,62,154,96,172,251,244,165,106,144,97,106,24,69,148,112,83,9,150,21,32,88,80,17,193,80,86,2,16,80,40,
+116,45,120,116,21,175,211,130,178,62,122,126,174,238,200,124,73,15,137,35,244,217,223,222,83,253,189,221,195,5,76,48,84,224,21,63,179,252,142,112,107,102,127,169,149,79,140,239,238,126,12,73,15,137,33,241,36,62,36,135,195,249,244,68,
+48,86,254,125,239,44,31,76,48,84,195,5,76,48,84,195,5,75,255,0,135,201,168,124,154,135,201,168,254,129,23,119,119,111,252,2,31,38,161,242,106,30,128,0
@@ -0,0 +1,16 @@
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,192,0,0,0,198,192,0,0,220,102,0,0,12,204,0,0,0,6,0,0,0,6,0,0,0,198,0,0,0,108,0,0,0,108,0,0,12,108,108,0,6,204,198,108,204,221,
+0,0,0,204,0,0,0,204,0,0,0,12,0,0,0,12,0,0,0,12,0,0,12,205,0,198,102,205,102,108,204,205,204,204,210,34,204,210,35,51,205,35,52,85,210,52,85,67,210,53,83,51,35,69,51,51,35,69,51,51,35,84,51,51,
+208,0,0,0,208,0,0,0,205,0,0,0,205,0,0,0,205,0,0,0,204,208,0,0,204,208,0,198,221,204,102,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,96,0,12,108,208,0,108,205,0,0,204,208,0,0,
+34,46,204,204,51,50,46,204,68,51,34,236,51,67,50,45,51,51,50,46,51,51,51,34,51,51,51,34,51,51,51,34,205,0,0,0,205,0,0,0,208,0,0,0,192,0,0,0,192,0,0,0,220,192,0,0,220,204,204,0,236,204,204,204,
+221,204,204,205,0,221,204,205,0,0,13,205,0,0,0,12,0,0,0,12,0,0,0,6,0,0,0,198,0,0,0,108,35,83,51,51,35,83,51,51,35,67,51,51,226,52,51,51,210,51,51,51,206,35,51,51,204,226,35,51,204,205,226,34,
+0,0,6,204,0,0,220,204,0,0,108,208,0,6,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,204,204,205,222,221,0,12,204,0,0,12,204,0,0,0,204,0,0,0,204,0,0,0,204,0,0,0,236,0,0,0,236,
+51,51,51,34,51,51,51,34,51,51,51,34,51,51,50,46,51,51,50,46,51,50,34,237,34,34,46,220,34,46,221,204,236,204,204,221,220,205,222,0,221,208,0,0,192,0,0,0,192,0,0,0,192,0,0,0,204,0,0,0,204,0,0,0,
+237,221,204,204,204,208,0,221,204,208,0,0,205,0,0,0,205,0,0,0,205,0,0,0,222,0,0,0,222,0,0,0,204,192,0,0,204,205,0,0,13,204,0,0,0,13,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,6,208,0,0,6,205,0,0,6,204,208,0,6,204,205,0,6,204,204,208,6,204,204,204,6,204,204,221,
+0,0,0,0,214,102,102,102,13,204,204,204,0,220,204,204,0,13,204,204,0,0,220,205,0,0,13,205,0,0,0,205,12,204,210,34,108,210,35,51,205,35,52,85,210,52,85,68,210,53,83,51,35,69,51,51,35,84,51,51,35,83,51,51,
+0,0,0,208,0,0,6,208,0,0,108,208,0,6,204,208,0,108,204,208,6,204,204,208,108,204,204,208,221,204,204,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+34,46,221,192,51,50,46,214,84,51,34,236,51,67,50,45,51,51,50,46,51,51,51,34,51,51,51,34,51,51,51,34,0,0,0,0,102,102,102,109,204,204,204,208,204,204,205,0,204,204,208,0,220,205,0,0,220,208,0,0,236,0,0,0,
+0,0,0,109,0,0,6,205,0,0,108,205,0,6,204,204,0,108,204,204,6,204,204,204,221,221,221,221,0,0,0,0,35,83,51,51,35,67,51,51,35,67,51,51,226,52,51,51,210,51,51,51,206,35,51,51,220,226,35,51,6,205,226,34,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,204,205,222,6,204,204,204,6,204,204,222,6,204,205,238,6,204,208,237,6,205,0,237,6,208,0,237,13,0,0,237,
+51,51,51,34,51,51,51,34,51,51,51,34,51,51,50,46,51,51,50,46,51,50,34,237,34,34,46,220,34,46,221,192,236,0,0,0,220,192,0,0,220,204,0,0,204,204,192,0,204,204,204,0,204,204,204,192,221,221,221,221,0,0,0,0,
+237,221,204,208,204,204,204,208,236,204,204,208,238,204,204,208,238,12,204,208,238,0,204,208,222,0,12,208,222,0,0,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
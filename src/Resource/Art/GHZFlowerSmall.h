@@ -0,0 +1,18 @@
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,136,0,0,152,153,0,0,137,153,0,0,137,153,0,0,0,0,0,0,0,0,0,7,119,112,0,120,136,135,151,136,136,136,151,136,136,136,151,136,136,136,151,137,136,152,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,121,136,144,0,121,153,137,0,121,153,152,0,121,153,152,0,0,0,153,153,0,0,119,119,0,7,136,136,0,120,136,137,0,120,136,136,0,120,136,136,0,120,136,137,0,7,136,136,
+153,120,153,135,153,155,170,185,121,166,102,171,139,102,170,170,154,106,170,170,154,106,170,170,139,170,170,171,121,186,170,187,0,0,119,119,0,0,153,153,0,0,137,153,0,0,137,153,0,0,152,153,0,0,9,136,0,0,0,0,0,0,0,0,
+153,155,187,185,153,120,153,135,151,137,136,152,151,136,136,136,151,136,136,136,151,136,136,136,0,120,136,135,0,7,119,123,153,153,153,0,153,119,119,0,151,136,136,112,184,152,136,135,185,136,136,135,185,136,136,135,184,152,136,135,151,136,136,112,
+153,119,119,0,153,153,153,0,121,153,152,0,121,153,152,0,121,153,137,0,121,136,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,11,187,0,0,10,187,0,0,10,171,0,0,10,171,0,0,10,171,0,0,10,171,0,0,10,171,0,0,10,171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,119,112,0,120,136,135,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,136,0,0,152,153,0,0,137,153,0,0,137,153,0,0,153,153,0,0,119,119,0,7,136,136,0,120,136,137,
+151,136,136,136,151,136,136,136,151,136,136,136,151,137,136,152,153,120,153,135,153,155,170,185,121,166,102,171,139,102,170,170,0,120,136,136,0,120,136,136,0,120,136,137,0,7,136,136,0,0,119,119,0,0,153,153,0,0,137,153,0,0,137,153,
+154,106,170,170,154,106,170,170,139,170,170,171,121,186,170,187,153,155,187,185,153,120,153,135,151,137,136,152,151,136,136,136,121,136,144,0,121,153,137,0,121,153,152,0,121,153,152,0,153,153,153,0,153,119,119,0,151,136,136,112,184,152,136,135,
+185,136,136,135,185,136,136,135,184,152,136,135,151,136,136,112,153,119,119,0,153,153,153,0,121,153,152,0,121,153,152,0,0,0,152,153,0,0,9,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+151,136,136,136,151,136,136,136,0,120,136,135,0,7,119,123,0,0,11,187,0,0,10,187,0,0,10,171,0,0,10,171,121,153,137,0,121,136,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,136,0,0,152,153,0,0,137,153,0,0,137,153,
+0,0,0,0,0,0,0,0,0,7,119,112,0,120,136,135,151,136,136,136,151,136,136,136,151,136,136,136,151,137,136,152,0,0,153,153,0,0,119,119,0,7,136,136,0,120,136,137,0,120,136,136,0,120,136,136,0,120,136,137,0,7,136,136,
+153,120,153,135,153,155,170,185,121,166,102,171,139,102,170,170,154,106,170,170,154,106,170,170,139,170,170,171,121,186,170,187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,121,136,144,0,121,153,137,0,121,153,152,0,121,153,152,0,
+153,153,153,0,153,119,119,0,151,136,136,112,184,152,136,135,185,136,136,135,185,136,136,135,184,152,136,135,151,136,136,112,0,0,119,119,0,0,153,153,0,0,137,153,0,0,137,153,0,0,152,153,0,0,9,136,0,0,0,0,0,0,0,0,
+153,155,187,185,153,120,153,135,151,137,136,152,151,136,136,136,151,136,136,136,151,136,136,136,0,120,136,135,0,7,119,123,153,119,119,0,153,153,153,0,121,153,152,0,121,153,152,0,121,153,137,0,121,136,144,0,0,0,0,0,0,0,0,0
@@ -0,0 +1,5 @@
+128,18,128,4,7,20,12,37,22,53,27,68,10,85,26,101,28,116,2,129,3,2,21,29,39,120,130,5,23,22,61,131,3,0,23,121,39,124,132,4,8,24,250,133,4,3,134,4,9,135,4,6,24,251,255,179,70,141,84,63,157,172,109,131,
+163,216,178,163,22,76,8,42,109,118,124,12,55,253,23,140,254,142,127,84,137,184,122,147,212,104,221,108,49,139,9,117,191,179,27,187,167,86,131,209,161,94,117,11,145,249,102,175,132,8,140,184,140,149,50,129,77,145,74,90,155,14,166,250,
+246,189,108,253,147,57,191,232,135,214,124,34,34,195,107,238,91,242,182,152,55,59,35,115,174,146,218,249,54,144,233,183,36,101,0,136,136,154,71,14,52,47,7,191,61,55,55,21,55,241,111,187,50,179,59,83,30,67,179,155,220,100,15,4,
+68,69,250,93,159,162,199,119,67,14,235,75,75,205,220,99,78,133,214,148,18,26,130,92,130,28,50,147,154,186,188,242,231,100,236,232,233,158,78,154,243,87,39,27,29,179,16,45,13,46,65,17,126,147,230,43,175,203,51,152,178,120,215,217,
+33,168,219,56,116,226,163,19,139,14,46,70,10,28,56,43,31,208,67,6,219,37,63,177,97,141,185,123,197,46,95,135,169,54,5,105,235,176,229,242,90,126,145,96
@@ -0,0 +1,5 @@
+128,24,128,4,7,20,10,37,22,54,54,69,23,85,24,101,26,114,0,129,3,4,24,251,130,4,6,22,60,131,5,25,135,6,61,136,7,124,137,6,57,139,8,250,140,6,55,141,6,58,142,6,59,143,3,2,22,56,255,0,0,13,123,166,
+191,229,239,239,155,122,215,252,43,97,169,157,172,198,26,205,94,148,192,93,140,45,69,190,223,79,31,117,210,124,226,59,86,95,63,154,252,158,253,245,187,252,93,126,201,211,248,171,155,249,49,192,1,198,167,5,149,77,150,149,160,234,210,160,
+66,90,0,6,179,182,108,207,154,105,120,237,76,237,210,253,242,237,140,117,253,46,167,247,225,120,64,0,2,94,16,1,251,133,214,22,16,82,127,183,221,213,51,199,239,237,227,83,59,110,187,223,243,219,247,227,179,181,112,201,151,133,208,0,
+232,251,86,69,248,218,108,159,239,247,239,29,91,135,69,145,74,200,169,100,21,44,176,176,138,203,202,205,178,249,166,151,142,212,206,220,126,187,118,250,183,138,191,69,195,202,226,163,242,2,45,42,0,10,97,60,0,188,168,5,160,1,179,108,
+218,141,76,237,207,226,190,185,252,223,63,64,1,233,243,156,40,105,93,87,205,35,230,151,204,39,228,164,233,225,178,30,0,24,154,109,179,102,124,211,75,199,106,103,250,0
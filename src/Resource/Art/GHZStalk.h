@@ -0,0 +1,2 @@
+0,4,128,36,11,52,10,67,3,85,30,116,13,142,2,0,52,12,143,3,4,19,2,36,14,255,155,15,99,153,127,222,185,149,63,93,88,208,208,208,208,215,235,173,127,59,240,8,254,105,13,221,241,31,95,243,255,1,254,255,225,117,126,9,
+170,17,92,208,225,233,254,3,252,0
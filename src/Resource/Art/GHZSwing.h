@@ -0,0 +1,5 @@
+128,14,128,4,2,20,3,36,4,54,55,69,26,86,57,102,44,116,5,129,3,0,21,25,38,60,117,20,130,5,21,117,12,131,5,13,23,123,132,4,7,23,124,133,6,45,119,122,134,5,23,135,4,8,22,56,118,58,136,6,54,137,5,18,
+22,59,142,5,19,24,250,143,5,24,24,251,255,215,23,72,184,32,119,207,235,138,8,76,118,89,159,103,5,141,121,37,85,214,101,189,203,22,9,246,151,33,49,45,142,249,159,218,69,254,177,27,72,255,80,95,123,73,62,199,212,143,243,24,
+242,73,180,20,198,129,203,120,44,5,91,6,240,88,215,146,61,160,176,123,68,202,98,69,50,250,18,60,76,118,159,173,254,37,24,172,167,76,245,70,43,41,211,61,81,133,252,95,197,149,75,247,165,80,109,65,6,212,138,243,91,121,180,114,
+42,109,74,163,119,172,255,102,85,31,216,29,51,213,24,172,167,76,245,70,43,41,211,63,131,111,196,123,70,238,61,163,134,229,166,26,63,42,26,246,3,31,149,13,63,121,110,189,169,139,29,69,142,44,113,99,219,229,191,15,244,132,11,230,
+179,15,207,15,160,188,58,216,21,119,28,14,67,160,48,128,162,238,89,46,45,63,211,181,208,0
@@ -0,0 +1,3 @@
+128,12,128,2,1,21,23,37,25,114,0,129,5,27,37,28,130,4,8,21,24,37,30,55,125,131,6,59,132,4,10,133,4,9,22,58,39,124,134,117,26,135,5,22,255,173,219,242,211,249,64,150,63,38,245,248,106,229,126,91,252,27,0,33,
+248,199,123,175,211,87,228,115,249,16,253,132,247,109,247,128,248,199,232,255,77,95,225,0,63,129,250,55,246,188,175,219,127,3,129,207,202,124,3,64,0,104,13,1,160,0,52,5,175,31,134,253,32,78,24,207,223,218,190,127,78,0,126,194,
+125,110,159,175,229,239,224,152,180,94,3,51,140,203,245,139,95,192,5,227,252,24,183,89,195,249,123,192,0,0
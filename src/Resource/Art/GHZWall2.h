@@ -0,0 +1,2 @@
+128,12,128,4,9,20,11,37,30,55,124,113,0,130,4,12,21,27,87,125,101,28,117,29,131,4,10,133,4,8,135,5,26,255,253,159,236,71,64,116,110,246,47,160,58,63,8,76,127,66,61,23,248,26,222,179,88,244,61,1,53,244,126,87,
+95,165,208,158,105,19,19,15,145,49,48,71,204,249,207,194,11,221,229,9,175,160,38,190,139,221,229,14,80,14,80,0
@@ -0,0 +1,8 @@
+184,152,169,170,184,152,169,170,137,169,186,186,137,169,186,139,154,185,139,155,154,186,139,152,171,139,152,169,171,139,152,185,137,139,170,139,137,139,154,155,154,136,155,152,154,152,171,168,155,9,171,169,171,9,8,185,171,10,8,186,171,10,8,138,
+184,8,169,186,184,8,169,10,185,8,186,11,9,8,186,11,10,9,11,8,10,9,11,8,11,10,11,9,11,10,11,9,8,10,9,11,8,10,9,11,8,11,9,8,8,11,9,8,9,11,10,9,9,11,10,9,10,8,11,10,10,8,11,10,
+152,171,139,154,152,187,136,154,169,184,152,155,169,184,153,171,186,136,169,184,10,152,169,184,11,169,186,137,11,169,186,9,139,152,154,184,139,152,154,184,136,168,171,136,152,169,171,137,153,185,8,153,169,186,8,154,185,11,9,154,186,11,9,170,
+8,186,139,10,8,186,139,10,9,138,152,11,9,138,8,11,10,11,8,8,10,11,8,8,11,8,9,9,11,8,9,9,10,8,10,11,10,8,10,11,11,8,11,11,11,8,11,11,11,9,8,9,11,9,8,9,8,10,9,10,8,10,9,10,
+184,152,169,170,184,152,169,170,137,169,186,186,137,169,186,139,154,185,139,155,154,186,139,152,171,139,152,169,171,139,152,185,137,139,170,139,137,139,154,155,154,136,155,152,154,152,171,168,155,153,171,169,171,169,171,9,171,170,184,10,11,10,184,10,
+184,152,169,186,184,152,169,186,185,152,186,139,137,8,186,139,138,9,139,8,10,9,139,8,11,10,139,9,11,10,11,9,8,10,9,11,8,10,9,11,8,11,9,8,8,11,9,8,9,11,10,9,9,11,10,9,10,8,11,10,10,8,11,10,
+152,171,139,154,152,187,136,154,169,184,152,155,169,184,153,171,186,136,169,184,186,152,169,184,139,169,186,137,139,169,186,137,139,152,154,184,139,152,154,184,136,168,171,136,152,169,171,137,153,9,184,153,9,10,184,154,9,11,9,10,10,11,9,10,
+8,186,139,154,8,186,139,154,9,138,8,155,9,138,8,11,10,155,8,8,10,155,8,8,11,8,9,9,11,8,9,9,10,8,10,11,10,8,10,11,11,8,11,11,11,8,11,11,11,9,8,9,11,9,8,9,8,10,9,10,8,10,9,10
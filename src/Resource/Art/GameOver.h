@@ -0,0 +1,7 @@
+128,34,128,5,27,20,7,36,6,53,23,70,58,85,22,100,9,115,0,129,8,250,130,3,1,21,28,38,60,131,4,10,132,3,2,22,59,37,26,72,249,133,7,122,134,4,8,21,25,39,123,56,248,135,5,24,255,235,219,103,168,180,54,174,
+188,135,68,0,25,58,44,89,22,76,179,178,164,247,110,107,37,252,117,4,55,118,231,118,243,175,130,5,145,15,234,209,65,209,191,101,187,229,249,124,223,61,64,126,222,29,112,1,184,101,144,54,155,91,55,224,15,166,143,225,50,131,40,178,
+146,157,22,32,91,32,91,187,112,1,166,202,198,207,85,131,106,101,124,29,155,208,193,181,12,94,158,175,129,83,137,53,56,147,91,211,99,126,99,55,245,86,171,122,154,183,169,171,122,154,122,156,90,167,7,170,156,30,170,112,95,91,47,31,
+180,2,221,201,120,101,0,58,110,220,220,129,101,0,55,207,190,247,192,62,91,250,79,236,129,125,117,251,32,47,252,98,3,252,177,249,200,27,77,173,155,240,1,210,200,233,5,37,73,15,166,143,225,50,131,40,178,146,157,22,34,97,209,120,
+14,143,72,217,12,151,82,84,157,117,226,203,103,168,180,54,174,188,135,68,0,25,58,44,89,22,76,179,178,164,247,110,107,37,252,117,6,81,126,217,29,241,73,78,139,16,4,195,162,241,214,89,30,145,191,101,187,229,249,240,103,232,218,25,
+23,166,48,223,76,90,46,94,175,18,65,152,146,12,196,144,175,240,212,208,209,52,254,110,154,26,38,159,155,250,166,135,205,191,38,252,180,11,114,208,47,174,177,175,140,73,169,198,175,251,32,0,0,0,6,189,250,253,147,80,193,127,218,98,
+255,194,0,0,0,0,58,246,64,101,36,0,0,0,1,171,128,0
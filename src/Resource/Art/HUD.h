@@ -0,0 +1,4 @@
+128,24,128,4,12,20,9,36,10,52,11,70,60,85,28,102,58,114,0,129,3,2,24,251,37,27,54,61,142,3,3,21,26,55,124,143,4,8,22,59,56,250,255,39,233,76,91,85,174,60,210,200,151,138,162,90,184,150,179,181,28,113,113,109,
+79,197,94,128,95,210,152,182,171,93,35,92,223,157,162,156,92,91,83,241,87,160,23,244,166,45,170,215,72,3,142,46,45,169,248,171,208,10,254,122,233,170,215,75,142,49,162,181,141,90,11,212,234,119,155,0,207,231,174,154,173,116,184,227,
+24,169,198,52,6,106,117,59,205,128,79,106,96,0,0,157,83,157,202,0,133,93,163,25,4,120,230,60,125,39,210,125,42,119,172,251,173,128,79,210,152,182,171,93,35,94,70,143,35,142,46,45,169,248,171,208,10,254,250,51,185,215,95,96,
+1,90,230,192,43,181,61,128,0,25,170,214,110,126,192,21,246,135,81,113,145,200,241,211,183,141,90,107,136,39,88,175,96,25,253,244,87,207,61,167,218,47,245,220,221,191,215,163,63,189,63,225,0,0
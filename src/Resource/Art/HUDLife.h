@@ -0,0 +1,5 @@
+128,12,128,3,1,19,2,36,9,53,24,70,53,85,27,102,50,116,6,129,3,0,22,51,38,59,130,6,58,131,5,21,132,5,22,133,6,60,23,124,134,4,8,135,4,7,22,56,137,7,122,141,7,123,142,5,20,22,52,40,250,143,5,23,
+22,57,40,251,255,255,143,253,213,190,126,75,197,108,249,121,178,23,195,160,171,212,126,34,158,141,94,2,130,248,122,219,1,126,211,117,178,252,71,227,13,93,87,42,254,40,47,202,57,169,123,113,111,201,254,41,191,239,230,79,241,90,97,254,
+72,79,136,9,194,243,164,241,99,199,71,170,182,177,234,120,252,101,125,123,177,252,225,252,220,137,30,212,126,159,220,254,243,246,255,241,95,191,10,231,232,220,220,233,156,232,110,39,61,126,205,5,207,239,132,254,197,152,192,220,62,81,148,110,
+31,110,54,15,216,92,154,26,6,102,197,13,4,253,5,167,115,155,40,24,16,227,28,13,120,26,136,113,183,203,60,3,200,60,209,175,186,53,50,13,162,208,30,206,108,204,204,204,193,125,137,185,161,160,215,77,247,175,33,92,208,208,79,208,
+33,118,204,204,204,200
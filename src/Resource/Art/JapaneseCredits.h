@@ -0,0 +1,19 @@
+0,166,128,4,12,20,10,37,26,52,11,69,27,85,28,99,4,114,1,129,2,0,21,29,40,248,56,251,72,249,86,60,102,61,120,250,255,85,85,85,107,197,93,247,101,22,87,215,8,42,187,249,209,5,86,252,132,21,72,78,236,223,87,133,
+27,40,124,132,21,119,242,181,226,175,139,94,170,170,65,82,16,85,87,60,162,16,217,8,66,123,134,204,54,97,178,200,67,70,124,194,28,33,70,26,40,216,154,56,97,102,138,54,35,94,45,120,186,249,125,132,51,238,136,67,62,52,42,173,
+252,187,56,67,135,13,245,92,33,8,66,124,174,200,66,16,175,21,85,112,191,135,100,56,112,225,193,85,85,191,135,132,56,112,223,111,170,217,14,16,225,191,23,66,66,119,95,24,81,178,14,27,48,217,158,225,8,66,13,24,95,197,152,97,
+178,16,132,27,247,13,152,108,195,102,27,48,217,158,217,8,66,124,171,70,141,26,52,104,209,163,62,52,66,23,246,171,125,122,138,170,240,130,215,184,66,200,87,187,40,132,250,132,31,173,12,249,209,8,87,116,81,101,22,87,95,170,56,115,
+200,66,188,209,14,125,46,16,131,102,251,127,16,133,251,103,58,183,229,22,81,101,22,81,101,22,112,135,14,27,238,197,108,225,14,125,163,191,138,248,225,14,16,223,120,103,94,165,148,89,70,141,118,136,104,162,202,52,112,72,87,150,66,139,
+52,104,191,187,52,66,28,44,162,202,52,81,95,120,112,134,141,22,36,47,227,62,236,134,190,44,195,13,24,89,68,33,8,89,101,22,81,101,22,81,101,22,81,101,120,176,126,240,70,188,87,100,33,191,116,43,69,154,52,97,178,140,243,98,
+174,16,225,190,223,85,89,234,144,132,33,62,136,60,56,95,206,137,243,162,124,232,91,249,134,190,97,175,149,119,227,191,141,144,178,190,225,62,137,228,33,94,42,184,66,28,48,132,32,144,130,54,66,28,33,194,254,30,16,85,209,127,13,144,
+225,14,28,21,191,138,248,85,91,33,8,66,16,93,144,225,14,28,56,111,188,32,144,68,71,186,249,209,62,118,104,209,163,70,189,125,115,234,24,108,195,127,27,55,221,20,89,69,149,241,69,22,81,101,124,81,60,217,10,242,16,175,26,250,
+225,194,28,33,195,135,4,72,36,17,17,207,97,14,16,225,6,190,149,86,132,76,239,10,44,209,174,232,162,22,66,254,176,209,163,69,125,97,163,70,135,94,236,225,195,158,103,97,134,14,125,20,89,163,69,149,238,27,248,195,12,22,189,135,
+13,247,102,251,175,136,79,172,17,234,87,198,187,127,122,48,215,104,132,33,9,245,216,66,16,132,51,216,66,22,97,179,11,40,178,141,20,81,159,45,123,69,154,40,223,111,180,81,190,209,69,152,97,162,24,97,162,139,48,195,68,54,81,70,
+24,97,134,27,48,195,12,48,162,140,48,195,12,54,97,125,93,120,236,225,190,186,23,220,33,69,154,52,95,112,116,66,16,132,251,178,27,33,8,67,126,171,175,40,133,22,104,209,163,69,148,103,219,236,44,163,70,141,26,40,179,62,112,90,
+243,100,33,11,241,207,112,162,140,40,163,61,194,138,48,162,140,245,175,93,124,232,132,249,209,100,250,39,148,89,69,149,229,22,55,226,170,190,112,225,195,125,224,141,19,238,206,16,135,14,15,62,225,8,66,16,225,8,81,101,22,81,101,124,
+81,13,155,48,217,133,20,97,69,24,81,70,125,209,13,252,108,132,33,62,43,225,116,104,132,47,219,33,11,250,209,62,94,22,81,101,26,44,195,133,149,227,93,209,102,132,178,190,119,234,170,243,235,184,66,16,135,8,42,232,132,55,229,138,
+232,132,242,16,86,16,132,239,12,21,177,44,75,21,90,249,85,87,230,28,32,144,132,47,205,156,248,223,196,33,8,95,155,33,163,67,191,149,86,199,94,209,8,66,19,205,144,85,126,27,33,194,28,55,213,112,85,90,235,178,16,132,33,7,
+93,122,170,188,249,85,107,196,132,33,8,79,181,191,85,85,84,225,190,223,94,28,56,96,136,136,232,195,13,24,97,69,16,132,33,13,148,89,70,204,33,8,67,127,28,33,8,66,16,191,112,132,33,8,67,159,92,33,14,124,108,225,195,130,
+187,251,132,56,65,194,20,89,70,141,26,52,81,101,119,102,13,249,8,66,188,178,12,242,136,66,16,131,191,112,217,134,204,54,97,179,13,152,108,208,136,209,134,202,52,88,215,116,89,69,148,95,182,66,23,244,171,13,246,251,125,135,8,112,
+193,30,162,104,174,232,132,33,163,69,22,97,178,253,209,207,139,48,195,101,22,104,209,101,19,202,33,8,66,19,235,227,12,54,97,179,13,152,108,195,102,27,51,213,77,26,52,104,162,202,44,195,98,251,8,66,25,239,8,89,69,148,95,148,
+81,163,68,44,132,57,238,22,81,102,24,104,209,67,127,48,133,152,112,191,108,161,117,242,185,238,200,81,9,229,16,159,90,32,174,253,178,9,10,33,9,245,100,56,65,195,13,247,125,190,225,8,66,27,48,217,135,8,112,194,202,52,89,135,
+11,33,191,157,144,159,121,240,166,27,33,8,66,27,248,112,215,139,175,149,104,223,184,66,121,68,32,236,130,48,223,111,183,216,67,135,4,122,245,232
@@ -0,0 +1,110 @@
+129,198,128,4,2,20,5,37,18,53,19,69,22,85,20,102,46,115,0,129,4,3,22,49,40,240,120,238,130,5,21,23,115,131,4,4,23,110,40,235,132,6,54,24,236,133,4,7,23,111,40,237,134,4,8,23,114,135,4,6,23,113,136,6,
+50,137,6,48,24,234,138,6,47,139,6,52,140,7,112,141,6,51,142,6,53,143,7,116,255,0,0,0,255,177,127,141,127,162,39,251,59,126,152,2,78,103,250,127,249,247,15,249,242,230,156,156,182,230,142,81,183,232,164,105,92,73,192,217,
+173,176,5,2,219,47,51,98,125,142,10,46,236,145,205,214,9,201,225,29,149,227,113,151,233,146,28,225,82,10,167,182,53,236,130,168,238,31,243,126,93,124,142,31,173,237,205,30,42,117,90,183,248,64,47,217,207,246,192,78,176,240,108,150,
+133,57,246,41,171,204,246,120,114,114,98,170,67,171,22,196,144,81,177,108,80,144,73,206,29,56,136,112,226,208,1,37,177,71,71,227,68,186,18,232,2,113,250,75,71,236,81,202,29,9,34,162,105,27,90,6,198,167,181,118,50,106,186,157,
+185,28,182,130,106,108,214,229,181,209,52,237,2,63,239,250,114,175,99,78,176,91,126,158,113,252,66,135,254,30,241,255,113,181,75,106,237,198,111,9,116,81,201,46,141,170,114,117,55,73,57,221,200,157,90,9,34,201,20,128,21,39,190,180,
+99,121,166,206,138,198,169,51,95,227,191,47,226,70,255,225,184,255,191,113,147,167,34,67,120,179,197,34,239,218,137,255,89,127,198,95,247,47,241,175,244,68,255,103,109,213,179,6,50,78,103,190,191,243,238,31,243,255,53,123,6,214,66,55,
+142,103,115,91,178,144,91,82,42,41,80,85,35,120,38,83,45,166,196,116,98,61,165,138,157,185,19,175,105,68,220,156,161,106,220,248,152,46,225,255,61,139,250,212,223,103,88,175,233,49,111,240,128,95,179,159,92,81,168,212,98,216,157,90,
+110,21,164,234,215,98,168,92,164,197,5,218,176,78,78,92,79,172,246,97,217,109,138,44,128,109,2,199,8,232,228,215,48,165,104,224,171,71,163,74,165,4,113,181,157,79,115,149,90,72,85,236,46,36,139,89,113,45,160,185,138,196,246,222,
+117,228,118,216,154,209,181,209,180,211,122,1,31,247,175,30,109,4,235,218,127,215,132,254,164,23,244,221,7,253,195,99,182,59,50,189,33,11,122,47,89,33,49,58,161,50,194,23,35,35,179,237,56,126,70,200,228,149,70,3,104,186,182,218,
+10,39,21,20,217,171,11,88,62,213,114,72,254,185,71,245,17,255,166,63,239,221,24,191,34,70,45,162,219,69,182,138,39,104,159,245,151,252,98,127,196,93,169,178,254,198,70,0,183,103,241,127,137,113,186,254,197,107,70,2,144,106,248,151,
+38,112,176,214,133,105,214,95,166,90,145,210,163,246,125,191,179,148,73,22,36,139,18,74,37,18,137,68,187,254,229,254,53,254,136,0,2,79,233,127,207,184,0,5,76,0,0,20,169,128,0,2,157,195,184,0,7,248,91,252,32,0,5,204,
+0,0,2,198,124,64,0,0,70,0,0,82,63,239,254,112,0,31,247,31,215,35,0,0,5,26,0,0,127,223,187,250,196,128,0,63,172,191,227,1,168,212,106,53,26,141,70,187,252,255,244,0,0,54,254,153,149,103,85,103,90,219,120,0,
+79,246,95,181,14,28,56,112,225,203,252,224,0,0,42,207,139,128,0,150,49,51,151,34,168,220,55,13,192,1,187,250,171,200,114,28,183,13,195,112,221,255,91,162,145,72,94,75,22,228,39,255,63,241,220,148,74,37,18,137,68,162,0,0,
+22,227,62,51,227,79,235,211,140,248,207,140,248,129,106,219,153,52,255,68,11,116,235,110,115,74,128,36,219,142,220,237,80,0,23,127,215,252,149,75,69,34,72,177,58,227,197,107,102,13,255,90,138,138,138,138,138,138,147,6,13,35,155,17,
+208,192,18,127,15,211,56,0,74,41,4,211,137,48,101,173,153,106,42,42,42,42,43,253,93,210,253,50,254,152,1,45,210,235,94,187,127,212,0,46,137,254,153,127,77,111,211,73,0,11,202,124,128,22,65,114,79,173,122,230,128,93,252,59,
+117,203,112,0,10,127,220,191,198,191,209,151,240,231,251,107,109,190,113,83,182,197,83,36,169,190,63,243,78,239,249,254,155,154,20,43,226,144,142,93,112,76,79,4,142,166,78,92,106,115,217,90,219,82,11,176,231,202,105,218,131,254,240,213,
+216,154,177,139,171,57,52,18,44,50,180,99,191,244,157,171,255,63,251,143,251,14,239,249,242,230,133,201,35,99,36,137,245,195,171,161,67,147,87,26,236,109,254,16,95,195,151,241,165,191,104,177,212,162,71,82,121,177,34,185,65,36,43,226,
+80,168,77,27,215,148,255,171,255,63,251,247,68,158,12,161,94,142,81,45,229,10,104,177,109,221,178,254,178,255,140,182,255,57,127,136,3,23,48,184,192,185,0,3,252,187,55,244,74,191,213,95,232,131,23,48,185,63,201,253,85,254,142,250,
+24,49,115,15,242,32,255,42,255,69,206,134,24,92,159,228,3,252,165,254,23,184,238,97,254,68,0,127,22,95,193,237,105,248,4,255,32,0,126,214,127,177,253,172,252,35,252,136,0,0,127,22,221,178,199,246,179,253,142,250,30,192,15,242,
+151,112,223,77,143,182,222,29,182,240,5,254,94,224,3,220,125,182,240,237,47,218,254,145,255,194,224,0,6,251,147,244,211,253,150,250,98,247,98,46,97,114,127,144,111,166,59,233,142,250,99,190,135,3,252,136,0,3,125,32,222,198,71,190,
+152,239,166,46,148,48,1,127,151,184,7,184,247,211,23,184,247,175,237,123,28,182,254,11,171,220,123,233,139,200,228,123,233,139,181,12,39,249,0,0,111,166,59,233,142,250,99,190,134,215,32,3,252,165,220,55,211,99,223,76,119,211,29,244,
+196,191,203,220,0,15,113,239,179,246,118,174,216,246,203,182,222,29,182,240,115,161,134,23,39,249,0,237,183,135,109,188,55,208,224,127,145,0,3,125,32,191,107,47,224,239,79,226,111,0,0,59,109,219,111,218,205,188,63,106,146,253,136,0,
+191,203,220,59,109,225,252,89,126,199,96,63,202,93,192,61,219,127,148,191,194,11,252,189,192,7,184,255,202,95,209,219,252,165,220,0,27,233,177,255,84,159,250,157,192,0,63,170,191,212,223,253,29,224,0,7,253,127,231,255,96,0,3,254,
+220,191,164,191,212,0,1,254,103,255,17,127,80,108,224,0,255,230,47,241,7,254,160,216,1,254,103,255,16,5,254,67,187,96,31,252,197,254,32,14,239,226,15,210,15,243,63,248,128,6,63,105,38,159,233,18,223,164,183,233,0,0,15,242,
+87,176,126,208,109,80,0,175,249,0,174,195,244,131,244,128,127,146,160,92,131,97,250,65,250,73,127,25,151,244,223,162,183,96,216,0,63,204,255,226,5,216,59,36,115,236,29,129,255,204,95,226,0,197,205,114,108,59,7,96,236,0,1,254,
+74,129,181,16,187,6,195,176,108,191,214,98,143,233,47,96,216,118,13,128,255,51,255,136,0,99,106,49,118,14,197,59,108,54,168,0,10,255,144,10,236,59,7,96,236,31,228,168,23,32,27,14,207,218,207,195,117,57,128,0,15,254,103,255,
+17,126,144,126,144,108,0,255,51,255,136,2,253,36,206,95,164,29,129,255,204,95,226,0,197,221,131,246,150,253,33,68,191,105,80,0,2,191,228,21,253,32,253,160,0,127,146,160,126,146,105,47,218,24,2,191,228,1,46,49,254,64,63,201,
+80,46,65,176,254,161,138,255,144,4,2,227,216,127,211,248,149,2,228,0,127,81,238,61,168,244,115,179,157,156,212,213,206,206,115,103,58,63,245,34,142,118,115,179,157,156,236,231,103,59,30,223,213,238,0,83,124,247,226,187,241,92,123,63,
+107,253,30,201,239,197,119,226,187,241,158,32,83,254,189,192,10,111,158,252,87,126,43,191,25,239,253,165,78,123,235,45,248,174,252,103,141,140,92,194,230,0,0,63,235,254,29,133,30,5,156,197,156,197,156,201,132,156,197,156,197,156,197,31,
+248,137,2,142,98,206,98,206,98,206,98,206,98,206,98,201,31,215,238,233,250,159,217,66,181,26,141,70,83,161,208,202,38,101,20,62,63,155,252,233,26,177,68,141,88,185,41,171,22,159,173,253,102,128,0,0,167,230,231,249,222,75,195,57,
+254,112,177,151,243,51,229,63,206,242,94,25,207,243,133,140,184,200,255,58,188,127,56,188,191,55,63,206,211,243,127,188,159,31,206,47,47,205,207,243,160,0,45,157,51,166,116,225,225,46,18,224,188,37,193,116,253,63,5,210,90,75,244,218,
+83,58,103,76,192,0,75,243,127,157,155,20,81,138,40,214,53,107,24,59,66,156,244,253,104,3,79,214,126,119,243,100,202,101,18,101,50,228,172,166,89,254,175,137,217,138,40,197,20,98,211,245,152,178,178,153,68,153,76,185,43,41,172,93,
+4,202,101,4,202,114,101,53,134,83,253,110,138,116,50,137,153,69,191,59,249,176,90,221,168,23,104,90,219,66,214,122,207,245,197,250,237,46,210,137,173,218,137,160,73,165,191,61,158,191,173,187,57,234,185,207,82,206,236,198,178,206,236,231,
+250,236,245,252,237,73,21,0,35,146,9,178,41,145,200,233,159,12,248,103,249,200,182,119,103,119,2,59,112,25,219,50,207,132,243,150,124,51,225,159,231,52,163,72,200,192,101,59,152,93,167,239,63,87,62,23,112,93,41,195,74,112,26,91,
+82,210,218,174,156,52,225,250,189,73,132,157,93,88,43,217,229,171,130,121,240,72,170,115,122,113,44,72,216,154,70,76,172,88,147,76,218,204,92,102,197,198,76,76,85,126,92,73,213,46,75,34,154,185,110,59,140,183,170,17,130,215,125,121,
+53,69,30,108,91,203,243,114,222,90,75,124,222,154,239,158,164,228,156,245,146,17,150,146,66,50,209,119,17,205,20,203,85,73,112,212,145,76,179,84,44,75,62,31,158,207,134,124,11,128,2,238,18,214,92,37,170,233,118,128,91,89,103,45,
+87,92,203,85,252,244,181,252,239,89,126,118,70,89,145,175,132,103,195,243,165,157,116,45,75,90,234,186,150,165,215,170,238,151,89,25,98,191,177,92,84,248,207,137,61,127,89,250,191,207,83,57,240,92,231,194,90,23,2,204,191,54,229,192,
+163,78,213,211,121,36,105,171,245,146,105,171,254,119,20,93,63,56,196,101,249,191,211,147,104,228,236,85,150,246,171,147,166,248,237,87,220,229,215,82,66,66,66,57,161,33,25,126,204,177,84,254,10,155,23,240,112,212,177,78,172,121,229,166,
+43,249,254,207,218,254,243,165,253,138,105,166,184,193,225,166,43,174,24,207,16,41,255,95,206,254,114,255,214,182,48,203,196,234,77,205,218,189,178,114,117,79,205,174,237,50,199,119,230,49,95,204,99,60,53,233,250,170,157,119,151,230,235,47,
+205,226,191,155,198,120,216,197,204,63,200,128,10,105,118,147,214,237,75,133,220,0,3,89,107,45,101,169,102,188,39,153,112,57,234,92,16,180,95,215,46,139,170,166,101,249,228,45,223,157,46,179,76,250,235,224,91,170,196,117,45,204,229,82,
+207,92,244,212,170,133,154,232,70,133,154,177,146,75,67,83,46,26,65,150,37,193,188,37,193,77,138,53,95,211,213,200,235,190,165,162,73,11,69,221,84,208,213,14,186,28,142,186,26,156,87,67,155,232,115,109,14,154,254,191,245,80,229,189,
+11,67,40,235,208,201,8,211,67,92,107,161,206,186,28,235,161,219,166,223,213,238,0,11,181,187,81,108,238,204,14,23,112,22,210,237,11,133,52,225,170,234,186,107,45,66,234,85,92,203,91,103,39,105,107,38,45,75,114,215,82,213,106,218,
+33,33,25,85,82,77,164,44,27,58,156,113,125,13,93,158,117,222,154,26,239,221,61,53,221,167,230,191,58,73,108,245,36,181,100,132,146,66,74,159,2,253,153,169,146,22,53,45,196,101,82,170,254,163,243,165,186,213,77,14,103,114,104,98,
+218,24,163,255,17,50,151,11,184,46,141,61,46,252,219,46,151,104,186,43,81,158,127,171,212,91,91,181,22,210,237,37,173,218,207,243,122,233,45,11,182,110,79,45,94,73,52,36,93,75,114,157,145,117,93,216,215,174,176,85,209,79,141,100,
+127,167,45,49,86,121,177,57,104,100,215,57,57,104,107,190,142,85,208,231,206,237,14,124,238,208,237,91,179,143,235,247,127,200,1,78,11,172,248,46,171,194,218,23,13,11,130,232,186,23,0,1,103,118,107,192,179,150,101,192,179,47,206,31,
+239,117,225,207,150,53,215,125,158,109,78,42,242,227,46,213,226,187,231,187,246,170,101,251,62,69,225,76,105,252,25,254,196,153,127,130,95,183,31,167,255,216,2,125,5,54,184,193,37,205,99,188,146,200,116,66,100,150,192,208,218,201,70,50,
+172,210,13,38,138,116,229,36,111,211,42,49,171,22,207,138,182,213,36,147,109,250,111,210,32,0,83,177,37,217,205,183,109,142,237,183,109,251,80,46,217,127,137,94,207,225,39,62,178,66,75,142,176,168,167,116,52,89,160,92,115,253,57,25,
+67,43,19,68,163,30,79,196,230,130,220,167,197,121,14,75,140,219,110,94,4,241,217,250,36,187,106,109,167,245,28,191,132,186,23,236,228,146,54,4,220,177,100,52,142,26,85,145,111,234,42,178,22,19,50,168,3,248,119,114,52,145,205,46,
+66,54,177,181,26,145,115,15,219,52,32,0,6,23,39,237,86,37,217,250,178,236,252,222,31,154,216,171,133,233,58,160,184,194,242,231,137,31,29,214,107,27,11,162,223,166,95,211,78,46,254,60,182,27,73,167,251,114,69,104,98,57,108,134,
+214,132,44,103,6,213,254,31,38,182,48,189,117,50,221,62,96,3,185,250,255,68,236,88,170,25,28,144,158,219,151,194,73,251,102,253,49,207,192,142,154,25,99,179,29,232,118,58,171,164,23,237,80,215,246,100,203,252,105,126,196,79,186,37,
+140,162,102,139,15,47,209,43,218,166,79,76,94,227,253,175,237,28,3,6,195,246,194,10,46,254,138,176,12,24,6,18,127,216,241,185,151,246,44,0,1,94,108,24,8,3,248,195,244,201,251,108,73,28,0,63,79,138,4,173,15,246,124,204,
+0,41,249,233,231,173,179,66,221,44,255,61,249,208,46,225,78,0,237,192,142,135,47,206,234,121,47,2,220,104,92,12,144,216,178,92,120,161,98,95,167,50,54,86,95,219,171,222,202,210,77,180,252,231,230,245,204,13,165,251,178,215,243,127,
+181,87,141,210,74,206,242,196,177,69,203,243,255,158,233,250,107,185,8,16,32,64,130,253,199,230,138,24,185,254,108,201,235,249,185,31,230,232,96,232,108,118,54,196,187,84,200,255,73,116,82,8,231,18,53,139,114,159,18,255,149,191,196,116,
+74,37,18,137,42,170,81,39,82,65,251,36,198,228,0,23,236,119,42,82,183,84,186,203,154,4,149,102,129,45,250,35,79,209,91,16,135,250,47,0,23,174,117,20,173,49,172,205,127,99,159,13,39,194,227,46,51,53,107,48,15,61,39,195,
+243,101,87,77,3,43,130,73,185,36,158,198,21,233,250,231,229,93,69,158,206,3,129,47,215,18,115,212,73,0,20,65,111,207,103,187,158,165,158,180,206,156,40,156,53,18,69,210,200,90,42,42,22,164,133,83,174,116,101,65,68,83,38,185,
+139,91,52,206,217,167,232,158,43,170,161,36,145,119,73,9,9,13,80,146,125,118,220,70,70,9,144,140,163,139,205,174,98,117,54,187,140,144,230,228,133,198,105,198,153,225,250,255,205,109,118,96,0,5,78,153,220,151,107,153,103,100,206,122,
+150,169,45,81,117,93,83,57,230,153,151,135,235,49,29,194,208,45,202,208,177,77,41,249,187,105,77,75,73,234,154,114,146,101,76,193,69,30,124,64,18,204,83,52,150,18,213,112,44,115,151,231,135,0,0,225,78,23,30,101,156,179,166,105,
+118,182,252,237,179,66,121,231,173,191,58,9,208,243,92,201,225,115,158,101,144,166,212,73,186,235,39,39,31,181,205,242,114,73,166,116,208,126,97,51,87,5,146,166,111,44,139,75,159,46,220,247,130,74,61,201,20,128,1,102,185,235,5,154,
+75,9,254,118,249,167,231,88,22,75,156,176,166,101,148,243,44,23,53,252,235,114,2,45,154,20,9,126,116,144,191,76,78,191,179,36,252,198,252,139,36,44,193,58,164,157,114,92,221,116,147,170,81,46,235,36,44,114,208,240,252,216,1,112,
+75,201,5,48,166,233,96,93,91,175,3,1,133,48,11,213,108,46,234,61,215,174,4,100,150,194,178,234,92,171,113,214,234,151,80,193,112,166,31,154,94,161,63,205,90,250,151,234,149,50,231,185,112,47,204,117,5,194,221,96,9,222,131,1,
+59,211,11,210,245,189,48,191,0,128,46,9,108,1,37,186,167,129,95,133,248,95,129,94,152,78,251,183,97,110,160,41,213,43,211,245,43,133,248,22,11,124,250,132,186,134,22,192,117,2,192,146,88,75,247,52,234,2,157,86,195,27,26,225,
+124,178,58,211,4,188,176,150,18,234,44,12,28,186,143,41,224,89,17,146,46,11,130,23,84,204,146,199,118,0,146,251,96,14,227,166,68,139,126,5,150,52,252,192,158,2,93,75,130,254,166,87,220,133,133,248,95,132,175,76,4,176,0,75,
+9,222,152,224,183,166,31,152,44,45,121,96,85,74,101,95,205,18,21,229,151,53,190,71,151,232,146,121,87,44,39,122,74,245,169,225,113,149,233,129,126,160,18,97,76,0,20,194,152,3,166,25,0,6,25,97,99,35,190,217,83,33,63,212,
+169,151,238,87,10,156,250,185,254,161,112,252,215,234,58,128,20,253,77,63,115,78,170,117,81,11,10,31,80,44,46,234,42,229,60,50,169,117,23,230,42,157,75,171,63,78,15,182,238,164,197,137,58,147,22,0,147,169,49,98,78,164,197,137,
+58,147,22,90,150,60,64,0,0,186,97,82,137,117,38,44,73,212,152,176,4,157,73,139,18,117,38,44,73,212,152,177,30,227,226,117,108,91,20,38,197,177,64,9,177,108,80,155,22,197,9,177,108,80,154,11,18,64,0,0,44,20,55,39,
+47,243,129,35,184,192,183,253,255,206,77,115,72,238,53,59,141,90,230,145,178,180,142,76,0,59,140,79,252,45,254,16,8,238,48,196,118,98,57,119,127,219,254,226,103,54,83,155,1,79,251,255,158,0,38,83,155,41,128,20,192,83,184,213,
+174,96,189,197,253,18,57,53,204,36,119,28,206,227,95,240,151,255,47,91,231,249,162,190,127,170,183,238,167,252,169,95,159,238,150,252,255,148,87,149,229,120,43,229,125,215,128,5,47,43,202,242,253,86,127,234,207,255,95,250,252,214,127,234,
+207,245,89,255,171,63,237,21,229,121,94,87,205,174,97,125,215,180,154,77,38,22,255,208,181,247,94,0,11,255,161,38,91,230,203,120,11,124,217,111,155,23,254,174,190,151,181,175,227,59,255,79,43,255,110,183,255,28,175,254,189,255,247,255,
+191,253,255,239,255,127,251,255,223,254,228,196,196,203,122,180,239,86,22,101,190,108,183,206,249,178,223,62,55,48,147,21,242,98,98,190,76,2,180,239,86,91,229,121,95,31,218,224,119,231,250,174,24,223,159,230,184,120,126,171,135,236,127,53,
+195,248,55,240,254,143,14,239,216,215,252,53,238,238,240,175,248,107,221,221,254,18,130,130,130,50,254,190,37,252,127,2,253,191,236,75,244,255,193,46,63,209,38,255,9,119,55,248,120,255,71,244,255,193,253,191,236,127,143,225,253,124,127,206,
+76,108,108,108,93,221,223,209,175,248,107,221,221,137,84,140,140,142,43,7,24,255,156,191,206,95,231,47,243,151,249,203,252,229,254,114,131,131,131,131,2,103,113,205,46,75,29,198,18,228,153,220,96,81,46,73,25,25,25,25,127,134,63,163,
+23,255,6,63,53,251,24,253,87,132,126,235,24,254,81,199,246,163,253,69,251,172,255,52,95,186,207,243,69,254,162,191,63,229,21,249,255,40,191,149,157,229,252,172,239,229,194,56,71,8,145,220,96,146,228,19,57,154,156,206,105,99,36,177,
+128,2,157,198,167,7,7,24,255,95,243,191,199,206,242,253,190,101,121,126,159,57,241,206,205,153,95,60,214,249,255,235,255,83,190,235,196,175,186,249,223,117,235,255,175,205,23,242,150,241,59,238,190,119,221,120,149,229,121,94,95,202,207,245,
+75,249,172,255,52,87,175,238,138,249,127,42,127,186,183,234,169,255,171,196,191,77,250,121,98,92,104,210,67,147,80,236,100,114,126,95,167,31,245,173,204,245,185,171,102,38,172,184,171,85,90,109,188,127,214,234,210,161,174,107,155,121,117,147,
+9,34,157,145,78,200,55,1,71,20,66,123,175,154,19,94,0,226,253,57,19,177,53,234,196,202,196,196,230,70,92,102,106,197,121,28,218,244,35,38,86,36,35,99,158,234,153,48,20,98,113,107,213,231,121,53,213,121,241,181,69,69,64,113,
+115,86,85,222,215,49,84,21,101,82,58,171,45,76,152,154,85,38,43,231,85,204,183,174,36,212,59,142,227,0,230,130,213,84,22,170,164,206,170,139,137,86,230,177,147,86,198,71,91,203,113,146,86,251,85,89,107,46,46,188,193,113,39,155,
+19,94,242,50,60,201,213,42,149,223,204,83,152,90,239,233,188,159,244,249,149,245,38,253,18,241,172,239,131,253,145,50,155,43,78,8,232,101,138,13,195,248,97,234,187,183,223,102,43,219,158,42,202,210,99,226,92,115,101,98,98,189,76,153,
+90,94,12,77,201,20,193,205,36,115,65,184,34,255,84,113,254,170,254,138,204,169,207,22,83,105,126,198,15,254,127,245,29,191,198,150,233,117,175,88,235,22,255,168,1,127,170,0,23,58,255,20,23,237,110,121,50,186,241,87,98,98,230,229,
+199,156,218,165,218,173,188,75,143,245,86,182,230,85,149,100,203,89,196,154,230,223,84,86,206,213,43,231,86,38,149,88,154,171,86,163,19,90,242,107,94,46,101,105,180,234,37,123,19,78,245,105,59,92,214,98,126,56,181,105,89,114,20,253,
+152,1,121,173,92,41,206,245,57,222,173,54,86,149,102,114,169,84,142,223,162,18,173,42,214,169,55,240,150,167,106,145,147,45,102,212,50,169,87,121,31,63,211,175,54,188,152,171,43,237,86,38,229,42,181,17,179,197,82,26,245,170,27,85,
+248,145,130,173,43,74,210,160,93,190,123,192,166,245,175,109,25,89,78,11,136,46,36,127,178,12,71,85,220,214,57,85,92,47,53,113,100,237,170,1,43,238,188,1,68,47,209,34,185,52,221,90,78,196,214,226,76,167,197,98,227,18,230,109,
+251,32,166,85,237,69,226,77,35,38,44,228,134,77,155,73,63,98,72,191,179,228,91,185,164,144,140,142,104,88,217,6,224,191,213,28,75,140,113,86,83,163,75,21,107,127,71,117,55,255,88,114,254,168,84,1,4,255,109,251,81,255,64,0,
+151,70,183,69,105,116,155,23,73,153,53,14,227,44,166,100,101,148,206,89,41,165,142,103,36,86,134,233,27,240,167,74,116,167,74,116,187,33,144,201,89,127,79,249,242,96,212,50,106,25,53,140,142,102,71,67,183,30,71,199,163,92,115,48,
+11,40,153,150,65,164,199,40,120,40,110,134,16,0,1,68,154,55,207,42,116,167,73,126,189,134,74,214,201,114,92,151,37,202,156,127,63,250,114,107,141,174,54,161,148,80,237,138,88,232,220,158,63,94,45,144,184,255,49,99,7,67,187,147,
+1,111,215,139,100,46,60,169,7,125,33,46,143,215,128,210,232,185,75,162,228,173,208,178,47,204,47,231,217,127,48,77,47,204,73,139,243,18,50,108,172,119,25,101,51,35,44,166,106,121,17,213,39,149,140,178,22,59,96,107,146,166,18,200,
+79,21,61,214,57,156,144,91,43,25,100,44,116,101,201,82,136,80,71,104,233,250,143,212,159,75,163,42,29,178,44,114,92,148,225,191,63,250,130,106,28,154,102,197,148,141,122,79,35,44,167,132,178,158,82,201,76,178,253,63,76,139,34,253,
+254,75,149,12,178,161,150,75,146,153,25,100,166,71,67,92,50,35,95,15,204,37,206,71,145,26,244,252,198,2,89,46,74,101,148,146,127,152,50,198,71,214,70,71,52,44,9,21,9,41,249,172,38,151,38,84,194,152,17,254,96,185,150,24,
+203,44,38,121,96,73,60,9,20,228,132,139,145,25,36,49,228,100,145,67,182,53,232,197,12,183,171,75,9,177,101,51,38,161,220,101,148,204,140,178,153,169,254,96,152,143,34,53,105,29,217,97,250,140,12,101,108,151,33,146,228,118,200,210,
+199,51,146,11,101,99,44,132,241,167,38,233,27,225,127,190,9,173,147,22,86,53,201,114,50,57,96,71,44,176,35,83,203,2,66,199,44,9,22,36,132,144,89,96,169,135,231,240,45,209,100,134,180,46,74,144,76,185,19,175,21,194,135,67,
+36,180,8,75,160,14,156,99,246,248,101,51,92,50,197,77,11,12,139,21,69,53,132,92,50,53,141,197,130,177,66,46,83,253,55,70,202,157,41,208,178,159,79,204,91,166,52,130,58,64,134,95,219,49,65,66,41,175,39,69,57,67,161,99,
+40,220,117,240,93,197,250,46,177,187,154,22,227,92,164,135,77,203,148,146,200,175,7,146,195,203,33,56,108,112,54,133,50,195,37,67,36,44,50,50,53,66,195,41,33,34,185,30,8,184,50,224,91,165,148,144,141,176,148,17,211,24,156,24,
+83,83,84,162,18,26,154,73,21,22,187,176,61,232,101,130,242,50,192,178,145,225,249,130,57,95,137,98,168,184,215,30,178,66,231,36,159,232,186,249,221,145,151,132,241,230,185,29,217,25,111,131,203,5,105,100,89,93,121,229,196,231,148,142,
+70,71,79,216,146,20,82,10,8,242,155,46,20,202,80,198,216,18,46,50,170,41,194,157,82,135,185,76,141,119,74,189,100,135,114,18,115,189,57,203,44,8,212,242,192,144,177,203,2,69,57,33,34,158,10,152,25,33,110,44,22,164,146,202,
+120,149,231,89,101,39,186,37,144,36,36,83,201,80,185,22,75,188,65,65,25,67,31,37,50,198,199,51,145,174,37,141,113,174,42,156,201,11,174,105,39,221,84,231,124,22,43,150,19,60,176,47,216,229,129,37,108,146,60,176,84,170,224,91,
+161,114,84,133,110,159,166,147,6,13,108,90,102,81,72,164,0,0,11,210,251,116,91,229,210,119,151,73,161,95,68,185,9,230,132,132,243,73,58,161,217,38,146,53,215,61,116,207,135,230,192,161,160,31,167,253,50,248,126,204,191,69,251,29,
+105,210,157,41,210,157,46,112,225,214,245,253,87,231,202,241,125,16,175,162,21,246,66,73,161,37,18,223,154,234,79,205,116,190,228,154,0,79,132,208,156,95,43,210,88,101,129,97,127,68,6,0,0,176,149,248,126,98,111,78,148,233,47,215,
+222,29,111,179,171,171,171,171,211,243,95,159,253,81,95,114,95,114,95,68,44,40,150,220,118,74,95,213,150,31,175,22,113,114,111,178,4,162,93,213,120,22,253,120,179,139,145,233,130,53,48,59,176,253,120,23,203,162,188,186,43,173,253,9,
+203,122,254,126,245,222,87,203,124,175,45,242,66,189,236,151,33,60,208,144,158,104,168,228,149,57,189,144,156,89,45,8,174,167,18,113,61,202,152,217,38,146,49,103,178,19,139,37,47,87,83,161,150,4,150,195,167,111,233,147,165,216,61,18,
+206,91,157,93,83,11,255,63,218,87,209,37,124,210,242,121,34,244,155,161,60,226,79,55,147,170,19,254,171,163,147,151,239,221,94,136,79,68,39,87,84,36,39,84,36,162,44,57,34,245,239,59,178,36,114,69,233,190,4,157,93,80,158,71,
+61,232,91,164,158,4,132,147,50,130,53,50,58,113,137,157,198,244,138,65,38,242,230,81,186,79,19,71,130,57,193,26,164,140,141,92,144,143,11,209,208,143,10,37,183,87,165,229,133,234,203,124,162,119,147,205,10,250,37,200,79,52,36,39,
+154,42,111,43,201,28,145,111,146,92,241,219,8,30,206,174,29,93,44,232,118,73,164,140,89,236,132,226,123,169,213,127,76,63,49,130,255,124,21,246,123,201,236,138,234,232,73,40,36,147,193,34,163,193,25,110,120,35,92,36,100,120,19,194,
+156,126,126,11,28,44,120,95,108,21,212,240,43,213,203,37,252,210,197,18,136,71,108,6,7,118,0,116,252,214,31,186,135,154,44,62,229,67,40,114,220,166,168,184,26,195,162,225,137,66,222,88,26,188,255,83,210,247,167,74,116,39,159,77,
+246,233,186,152,18,83,1,133,235,251,155,203,2,192,213,23,171,35,84,150,25,25,110,150,24,165,122,215,18,253,23,128,199,153,150,40,175,35,74,98,175,35,177,174,88,35,174,25,73,196,240,191,116,37,248,42,20,58,154,17,148,58,18,41,
+148,60,140,141,114,36,131,88,189,96,177,147,200,201,47,137,96,73,77,216,79,4,10,138,138,116,50,52,84,57,26,154,215,24,79,204,26,20,47,82,20,19,201,35,121,36,155,113,110,83,93,213,221,224,70,92,228,115,253,23,135,59,157,11,
+174,123,185,171,165,206,133,249,140,17,225,111,147,147,220,200,255,154,73,188,146,72,73,79,217,145,150,20,192,176,36,121,222,177,71,150,23,165,240,70,187,165,83,84,193,82,167,68,197,80,145,113,149,124,8,210,227,35,230,199,206,79,4,138,
+143,4,101,185,224,141,82,70,70,169,10,112,132,101,137,66,212,142,79,61,196,201,89,60,178,187,9,56,35,35,84,117,50,234,39,95,204,12,11,2,66,194,244,234,84,45,214,73,164,145,119,22,234,238,174,229,62,100,101,225,51,150,88,212,
+249,182,5,185,94,38,143,5,251,55,130,58,216,228,143,10,117,88,44,112,87,83,193,111,233,250,153,94,47,23,219,117,243,66,194,152,83,0,0,206,236,229,173,218,211,57,126,184,179,44,203,245,210,204,0,90,221,169,105,45,101,164,181,150,
+182,252,233,127,57,122,237,215,111,233,219,175,25,117,175,244,90,237,63,89,94,13,195,247,197,171,235,77,233,55,84,159,111,93,141,127,134,95,193,95,222,87,134,105,63,215,75,66,205,83,50,211,53,221,153,112,45,198,146,74,226,133,167,54,
+36,87,38,122,203,243,218,107,219,109,6,131,64,0,204,102,56,14,19,206,92,39,156,180,159,9,105,62,18,209,116,224,77,18,211,132,162,127,156,31,157,0,15,205,143,206,14,25,205,165,159,234,228,115,211,132,162,127,156,31,157,0,15,205,
+143,206,14,25,205,165,158,128
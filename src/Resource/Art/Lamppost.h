@@ -0,0 +1,3 @@
+128,10,128,3,1,37,28,53,20,68,6,85,21,101,22,115,0,129,3,2,130,6,58,131,4,7,132,5,26,53,25,134,6,59,135,5,23,39,125,136,6,60,138,6,61,139,21,24,140,5,27,141,7,124,142,4,9,143,4,8,255,111,196,249,
+118,80,133,97,50,48,223,137,252,141,149,84,83,203,254,70,178,222,25,172,91,196,0,0,86,127,11,237,37,218,92,174,77,61,50,92,175,200,124,126,151,226,255,52,92,163,250,160,1,140,224,0,1,140,224,24,206,12,103,0,198,112,1,140,
+224,1,233,252,159,240,127,93,249,223,212,243,242,141,170,35,170,39,26,100,246,64,92,89,238,47,87,250,218,185,251,205,63,214,253,71,63,56,219,167,103,116,239,99,109,222,237,216,10,207,105,232,117,89,126,147,124,252,159,232,185,242,127,70
@@ -0,0 +1,162 @@
+130,151,128,3,0,20,5,37,20,53,21,70,48,86,49,102,51,115,1,129,4,6,23,107,40,234,119,113,130,4,4,23,109,40,238,131,4,8,23,106,40,237,132,5,22,24,231,133,4,9,23,111,40,240,134,6,46,24,236,135,4,7,23,116,
+136,7,112,137,6,47,24,230,138,7,108,139,8,235,140,6,52,141,7,114,142,6,50,143,7,110,255,36,146,73,255,177,95,233,213,132,82,3,8,164,8,13,86,128,209,70,164,82,3,97,1,132,81,169,20,104,13,70,16,26,141,72,89,253,
+180,221,57,255,212,175,244,234,194,41,1,132,82,4,6,171,64,104,163,82,41,1,176,128,194,40,212,138,52,6,163,8,13,70,164,44,254,218,110,156,255,203,156,143,233,210,4,53,97,161,41,1,4,82,26,49,64,209,88,13,20,129,11,11,
+13,168,69,16,67,87,80,106,180,8,165,207,217,55,21,255,46,114,63,167,72,16,213,134,132,164,4,17,72,104,197,3,69,96,52,82,4,44,44,54,161,20,65,13,93,65,170,208,34,151,63,100,220,87,254,165,127,167,86,17,72,12,34,144,
+32,53,90,3,69,26,145,72,13,132,6,17,70,164,81,160,53,24,64,106,53,33,103,246,211,116,231,255,82,191,211,171,8,164,6,17,72,16,26,173,1,162,141,72,164,6,194,3,8,163,82,40,208,26,140,32,53,26,144,179,251,105,186,115,
+255,46,114,63,167,72,16,213,134,132,164,4,17,72,104,197,3,69,96,52,82,4,44,44,54,161,20,65,13,93,65,170,208,34,151,63,100,220,87,252,185,200,254,157,32,67,86,26,18,144,16,69,33,163,20,13,21,128,209,72,16,176,176,218,
+132,81,4,53,117,6,171,64,138,92,253,147,113,94,90,191,59,26,64,221,139,12,151,33,145,57,177,58,199,107,26,69,88,147,184,104,112,157,147,122,236,198,250,244,203,167,42,160,122,56,64,244,112,225,42,142,17,232,148,117,122,35,171,171,
+163,209,195,225,33,194,43,216,56,69,113,33,238,73,75,165,30,233,8,168,188,154,63,59,26,64,221,139,12,151,33,145,57,177,58,199,107,26,69,88,147,184,104,112,157,154,115,46,229,189,111,95,219,203,238,9,68,162,58,189,93,3,224,129,
+232,225,3,209,194,96,225,213,213,211,160,122,72,116,175,64,151,4,8,225,233,251,39,185,40,152,54,145,187,150,174,88,238,25,12,151,32,196,177,37,187,70,178,213,130,78,122,13,199,243,92,195,77,155,176,190,189,50,233,202,168,30,142,16,
+61,28,56,74,163,132,122,37,29,94,136,234,234,232,244,112,248,72,112,138,246,14,17,92,72,123,146,82,233,71,186,66,42,44,101,31,157,213,203,29,195,33,146,228,24,150,36,183,104,214,90,176,73,207,65,184,254,104,115,105,91,214,245,253,
+188,190,224,148,74,35,171,213,208,62,8,30,142,16,61,28,38,14,29,93,93,58,7,164,135,74,244,9,112,64,142,30,159,178,123,146,137,130,111,127,218,137,63,211,163,64,138,164,52,86,2,8,194,26,41,12,18,176,194,41,11,2,22,6,
+166,138,52,4,171,13,85,129,13,75,167,177,238,63,245,61,169,251,49,1,168,194,4,44,48,97,1,161,80,64,106,64,128,195,83,81,2,67,66,198,181,129,1,131,8,9,70,16,26,41,2,4,48,186,110,158,199,184,255,212,246,167,236,196,
+6,163,8,16,176,193,132,6,133,65,1,169,2,3,13,77,68,9,13,11,26,214,4,6,12,32,37,24,64,104,164,8,16,194,233,186,123,30,227,255,50,73,36,156,119,87,35,76,171,149,119,83,37,200,101,86,36,154,65,174,184,43,12,73,
+13,139,86,7,42,95,155,209,198,224,139,164,215,74,110,108,181,242,234,36,156,119,26,100,185,99,146,238,166,85,220,119,18,176,73,33,149,160,172,18,26,144,77,88,94,183,213,198,78,55,13,138,149,233,146,85,28,56,220,55,13,178,133,120,
+147,76,151,118,25,46,67,117,50,92,134,85,98,73,164,26,235,130,176,196,144,216,181,96,108,165,244,122,61,16,108,174,73,92,169,200,108,15,146,96,225,3,209,40,244,71,9,68,14,18,137,71,89,253,148,164,231,213,185,183,54,225,186,187,
+176,201,91,33,145,193,137,52,130,25,90,10,193,33,169,4,213,133,235,125,92,104,227,112,228,169,87,25,61,93,3,141,195,144,64,244,112,129,232,225,48,112,234,234,233,208,61,36,58,87,160,74,163,135,162,13,178,133,127,234,87,250,245,64,
+244,112,129,232,225,194,85,28,35,209,40,244,112,152,56,64,244,74,61,17,195,209,195,134,163,82,2,77,219,68,164,170,81,30,122,79,68,198,71,245,232,225,210,174,143,52,113,33,232,232,248,200,71,162,116,71,166,214,89,162,7,186,2,11,
+132,136,172,88,69,26,4,4,87,236,155,138,255,220,254,222,127,78,148,65,33,30,224,226,21,216,56,97,112,96,247,32,128,215,56,139,146,228,23,6,141,112,176,208,24,64,140,16,64,101,134,16,24,52,8,16,46,126,201,186,110,63,231,69,
+69,73,29,33,218,2,9,14,213,141,105,71,8,32,32,215,24,160,104,172,6,138,64,133,133,134,212,34,136,33,171,168,53,90,4,82,231,236,155,138,255,204,141,195,34,185,12,134,75,147,97,146,238,44,74,193,86,194,42,209,86,45,88,36,
+156,242,28,136,228,185,13,212,200,56,145,176,38,78,28,72,154,35,237,117,116,112,129,195,225,33,194,43,160,112,129,28,56,112,131,108,164,161,226,73,27,134,69,114,25,12,151,38,195,37,220,88,146,208,68,6,33,150,41,173,98,154,214,40,
+216,65,39,12,179,75,215,119,37,71,27,131,139,214,245,125,221,3,210,67,165,122,4,170,56,122,32,219,40,87,137,36,141,196,228,185,46,229,200,228,87,118,59,141,96,147,131,26,67,82,14,12,105,4,225,146,228,27,98,233,154,46,234,32,
+200,34,236,74,58,207,236,167,116,231,196,146,73,36,110,43,149,50,43,150,57,83,112,106,228,50,36,154,193,49,172,52,18,112,108,88,114,16,70,84,67,162,160,252,253,52,167,133,251,246,73,95,235,213,46,123,149,194,7,84,113,33,233,114,
+64,104,69,181,34,144,27,8,12,34,141,72,163,64,106,48,128,212,106,66,207,237,166,233,207,252,233,140,143,219,203,170,81,40,142,175,87,64,248,37,207,71,8,25,81,95,6,72,89,69,176,129,24,32,138,195,8,163,64,138,92,253,147,113,
+95,251,149,254,189,80,61,28,32,122,56,112,149,71,8,244,74,58,189,17,213,213,209,232,225,240,144,225,21,236,28,34,184,144,247,36,165,210,143,116,132,84,87,159,227,166,50,63,175,71,14,149,116,121,163,137,15,71,71,198,66,61,92,35,
+209,195,171,171,167,64,244,144,233,94,129,46,8,17,195,211,246,79,114,81,48,109,77,251,50,107,149,119,12,169,150,59,134,67,37,200,49,44,73,104,34,3,16,203,20,108,32,147,134,71,37,229,177,118,141,201,35,69,209,91,47,232,146,105,
+145,92,134,67,37,201,151,114,228,187,137,98,176,85,176,138,180,85,139,86,9,57,228,57,17,185,116,77,200,186,97,185,135,32,195,143,30,60,120,241,227,199,143,30,60,120,241,227,199,143,30,60,120,241,227,199,143,30,60,120,241,227,199,143,
+30,60,120,241,227,199,143,30,60,120,241,227,199,143,30,60,120,241,227,199,143,30,60,120,241,226,220,52,229,167,45,57,104,73,194,105,36,146,86,78,19,73,36,225,114,201,38,146,183,18,78,17,113,49,112,184,146,46,172,196,197,32,146,78,
+48,105,36,193,38,144,86,226,113,146,86,9,173,216,201,36,146,32,231,35,183,8,56,197,34,69,194,9,130,105,3,81,88,52,130,73,164,18,86,8,130,73,38,9,37,102,7,240,238,206,43,4,210,10,193,43,20,130,77,97,96,149,138,64,
+138,192,130,113,129,4,210,9,36,147,7,31,254,146,107,149,119,12,169,150,59,134,67,37,200,54,91,191,125,249,242,73,166,69,114,25,12,151,38,25,15,207,12,183,18,73,174,85,202,153,13,195,37,203,12,179,108,151,33,150,229,200,154,49,
+59,151,42,54,229,200,147,70,172,85,136,140,24,106,86,39,54,39,8,101,97,24,48,129,26,201,205,171,21,98,34,173,88,97,172,118,235,57,177,56,67,43,8,53,106,70,17,86,36,242,25,96,129,41,185,119,13,43,250,253,23,117,32,146,
+69,244,220,186,77,119,97,250,241,249,197,220,73,174,84,228,185,61,19,112,73,93,203,162,232,185,126,127,243,155,155,38,172,49,164,85,137,59,6,152,108,26,19,94,91,6,89,165,57,46,196,201,93,103,104,210,82,105,165,119,79,235,63,62,
+155,159,37,228,168,28,101,132,228,227,114,186,7,8,17,195,135,8,54,202,74,28,191,63,166,237,55,100,212,133,101,130,73,23,211,98,228,244,216,35,243,202,203,21,98,78,193,126,14,30,155,151,96,210,168,249,38,67,118,205,185,45,225,194,
+7,15,202,178,28,34,186,7,8,17,195,135,8,54,202,74,29,233,40,54,209,194,7,162,81,232,142,18,136,28,32,65,106,58,205,221,206,146,129,15,112,112,234,234,233,208,61,36,58,87,160,74,163,137,193,4,165,19,4,232,142,169,87,8,
+30,137,71,162,62,8,28,93,75,82,2,77,195,108,164,213,40,138,129,3,135,87,87,78,129,233,33,210,151,116,22,170,61,208,169,118,219,167,4,162,14,129,194,96,225,3,209,40,200,46,71,9,70,14,44,168,215,44,44,246,32,155,166,137,
+75,133,212,219,23,66,186,8,104,144,212,65,8,168,53,11,85,160,69,46,126,201,184,175,253,202,255,94,168,30,142,16,61,28,56,74,163,4,116,91,81,208,62,191,211,159,219,207,233,210,136,28,35,171,135,23,116,14,18,140,28,56,139,154,
+231,16,176,241,114,118,45,208,44,34,140,183,69,26,3,81,132,6,163,82,22,127,109,55,78,127,156,229,249,239,206,232,26,42,197,171,4,156,242,28,176,74,108,92,147,147,174,85,125,139,147,132,162,7,9,68,163,172,254,202,82,115,252,255,
+239,63,62,121,26,222,55,14,84,112,129,22,241,176,32,208,74,74,83,74,255,212,254,222,127,78,148,64,225,29,92,58,186,7,9,68,14,36,56,64,225,213,231,246,233,140,143,235,209,195,165,93,30,104,226,67,209,209,241,64,143,68,14,143,
+112,116,232,46,139,64,107,156,66,221,88,12,176,194,3,6,129,2,5,207,217,55,77,199,29,174,29,93,89,58,7,164,135,75,130,6,112,149,103,18,16,92,225,38,236,18,188,159,243,223,167,69,190,146,57,116,202,93,82,137,68,117,122,186,
+7,193,3,209,194,7,171,163,142,234,56,64,244,74,61,44,225,40,129,130,92,129,41,43,35,176,77,210,152,255,171,172,127,84,146,72,111,234,11,159,135,103,7,224,195,37,200,100,78,108,78,16,202,194,42,212,133,101,130,73,26,83,114,233,
+93,203,249,194,105,200,101,154,96,252,167,37,220,29,29,114,164,132,189,119,56,201,31,45,210,185,45,225,232,225,249,86,67,132,87,64,225,21,195,135,89,219,41,41,57,239,73,65,182,142,16,61,18,143,68,112,148,64,225,40,148,112,146,59,
+165,39,61,175,220,187,93,94,136,28,62,18,30,174,129,232,142,30,136,54,186,42,42,85,247,105,211,77,235,122,223,77,159,215,170,7,163,132,15,71,14,18,168,225,30,137,71,216,63,61,251,117,191,14,93,50,159,211,165,16,56,71,87,14,
+174,129,194,81,3,137,14,16,56,117,116,112,152,56,64,244,74,61,17,194,81,3,132,162,81,214,80,109,148,154,34,160,73,84,15,181,213,209,194,7,15,132,135,8,174,129,194,4,112,225,194,13,178,36,143,226,188,185,253,188,254,220,92,16,
+56,103,23,56,117,214,30,231,163,7,8,32,48,97,23,8,72,215,13,130,47,236,198,173,116,97,1,161,96,66,195,8,13,70,16,16,64,97,2,22,6,173,119,42,42,72,254,154,44,8,106,195,66,82,2,8,164,52,98,129,162,144,140,129,
+183,170,42,81,53,39,109,88,70,16,34,140,32,53,24,64,74,48,129,1,21,187,110,84,164,134,212,218,169,2,26,176,208,148,128,130,41,13,24,160,104,164,221,54,186,117,83,42,229,76,134,229,221,139,12,151,33,145,57,183,231,242,31,158,
+252,254,84,200,110,93,216,176,201,114,25,19,155,28,219,54,172,85,136,138,181,97,141,34,189,95,179,214,78,16,202,194,13,90,144,172,176,73,195,144,203,55,199,115,228,187,2,13,163,73,195,69,253,127,239,63,62,77,116,167,37,201,43,185,
+93,119,32,209,39,67,184,111,73,65,182,142,16,61,18,142,130,228,112,148,96,225,21,26,229,149,158,196,18,147,68,93,161,232,143,181,213,209,194,7,15,132,220,225,46,15,96,225,7,65,1,197,206,46,145,57,160,64,244,71,218,234,232,225,
+3,135,91,133,210,28,34,194,7,8,30,46,113,34,231,236,145,41,84,84,199,107,135,87,87,78,129,233,35,165,46,233,115,87,160,133,75,156,93,36,32,255,153,36,149,203,13,217,238,25,18,107,184,225,145,199,35,134,84,220,72,220,185,28,
+55,82,24,146,212,130,96,154,180,97,151,43,255,93,187,102,214,89,71,185,4,136,193,4,92,139,13,116,4,15,2,4,11,159,178,110,147,158,215,14,174,174,157,3,209,195,165,97,194,93,70,112,244,71,9,55,13,180,74,126,119,45,63,61,
+187,67,176,140,179,124,220,227,178,153,6,165,225,48,124,147,4,205,28,110,162,7,9,68,163,242,19,251,41,73,207,243,255,188,221,145,228,70,89,190,111,130,4,199,117,52,13,225,205,63,154,43,253,116,163,135,163,135,15,70,14,30,189,46,
+232,16,61,31,107,62,77,249,218,223,79,235,209,195,160,220,191,167,154,61,29,119,58,62,40,17,233,190,239,211,237,164,92,193,232,203,115,209,160,53,202,194,3,81,169,11,63,182,155,164,225,182,67,171,172,39,64,244,155,157,42,240,19,8,
+15,75,133,194,115,64,131,248,124,163,42,100,187,137,93,203,145,134,37,119,15,207,114,109,196,154,228,87,113,43,145,92,176,200,145,12,187,137,205,160,136,86,203,30,84,129,150,111,155,171,85,2,46,148,220,55,100,223,157,234,36,145,184,229,
+134,234,228,186,227,243,177,150,229,189,111,13,176,62,65,206,202,56,200,58,236,112,225,42,142,19,101,18,143,215,179,46,95,158,229,161,108,88,108,17,131,211,35,68,202,187,185,74,223,71,15,120,125,146,168,168,168,35,164,116,165,200,38,144,
+44,33,82,4,6,171,64,105,163,82,54,255,6,216,200,254,189,36,58,86,17,230,229,112,225,232,237,21,75,144,36,211,45,55,112,221,127,45,133,181,111,231,152,223,206,182,142,207,225,15,249,255,150,63,205,255,162,79,230,177,213,142,252,123,
+63,53,135,111,238,99,252,177,254,97,255,63,242,199,233,147,244,194,218,135,236,217,228,60,184,185,231,243,218,101,251,90,254,219,243,75,253,53,240,125,234,157,129,46,221,176,76,44,8,96,234,225,249,244,223,107,144,235,191,92,77,181,54,169,
+176,218,219,95,81,227,199,255,100,159,205,156,117,227,175,243,103,247,124,120,159,216,203,91,93,181,134,12,26,86,68,217,102,188,251,255,61,187,47,216,215,246,57,117,238,89,19,89,105,89,25,49,56,182,235,186,126,127,161,36,146,120,117,126,
+99,89,36,146,120,117,126,99,89,38,188,132,172,230,210,188,133,185,44,215,127,62,251,73,172,139,45,179,107,44,141,235,98,104,221,157,59,58,18,73,39,94,222,173,132,146,105,53,186,142,46,14,200,225,134,192,249,179,173,195,177,92,154,49,
+63,157,253,231,231,73,38,186,95,134,139,179,174,156,237,12,63,57,175,133,247,104,36,71,230,150,68,43,93,135,86,130,7,82,178,82,212,231,138,101,8,46,178,229,215,115,135,16,50,13,72,13,216,28,78,226,113,98,110,240,210,121,231,59,
+161,57,168,201,215,193,41,204,25,210,204,52,162,11,131,104,178,19,146,205,109,54,232,144,229,132,7,17,120,182,108,242,16,101,42,132,209,173,54,232,145,113,97,2,68,222,68,9,19,121,16,36,77,230,146,38,243,73,19,121,194,111,56,77,
+231,27,233,251,154,222,111,55,155,201,63,168,254,99,45,176,101,182,12,182,193,150,194,250,50,216,95,70,173,244,97,250,202,181,36,201,147,38,108,169,91,168,130,6,95,156,200,72,145,150,109,146,184,125,203,145,52,98,110,183,245,66,85,168,
+149,106,33,76,221,22,94,168,172,234,226,110,155,71,60,62,112,88,176,181,100,48,176,149,182,44,37,108,45,249,255,223,110,200,156,250,241,235,199,175,30,188,122,232,139,215,68,94,186,34,245,209,22,40,139,20,69,138,34,197,17,94,174,32,
+88,72,202,246,144,194,6,84,69,235,105,87,15,101,146,104,196,221,9,210,211,98,73,36,223,249,206,111,205,117,146,113,252,214,58,171,144,222,55,12,134,203,147,43,175,88,151,23,74,200,150,8,168,16,156,216,159,207,254,123,127,61,127,98,
+191,155,253,137,93,114,214,110,188,181,134,12,26,86,68,217,102,188,255,181,180,241,253,141,154,88,78,58,229,132,141,235,98,104,223,159,253,244,216,146,73,36,147,76,171,149,50,18,187,177,97,146,228,38,215,91,123,239,36,146,73,36,214,68,
+171,230,214,87,19,101,154,218,235,111,125,230,178,37,95,54,178,184,155,44,147,70,185,211,165,209,113,36,146,73,36,227,21,122,184,64,247,43,132,113,117,46,205,145,197,193,238,39,22,38,239,227,246,47,245,73,170,8,91,179,100,84,9,114,
+165,119,254,210,109,255,58,184,185,95,54,117,112,247,43,147,70,213,251,40,203,252,132,146,71,250,71,254,7,249,73,36,183,249,63,229,255,50,73,255,175,253,63,229,255,50,73,240,127,218,167,56,75,69,159,95,70,184,127,148,146,72,255,32,
+187,111,98,58,9,133,129,12,29,92,57,57,177,54,159,218,111,95,233,147,87,23,45,179,103,144,225,236,169,91,75,239,181,210,73,56,221,89,172,135,19,101,144,242,45,75,102,207,34,194,108,78,44,77,209,119,68,123,137,53,112,234,152,203,
+93,33,3,194,165,110,139,186,39,67,87,14,168,30,174,215,42,7,98,113,111,207,254,249,238,36,146,73,36,154,100,86,233,200,100,185,48,182,206,125,150,155,191,230,73,171,210,95,120,240,179,109,9,109,179,251,68,183,252,201,163,213,232,226,
+229,186,86,68,176,69,64,159,155,253,215,94,195,63,231,74,165,93,82,175,139,170,85,213,3,143,235,132,198,87,248,234,234,245,117,112,138,225,213,42,234,234,149,117,76,54,171,225,182,127,132,127,234,87,160,253,61,94,159,167,166,215,14,149,
+157,163,105,95,250,153,255,58,85,23,248,243,208,175,65,250,122,185,124,220,38,14,18,136,31,4,47,89,219,61,211,159,249,115,149,254,58,186,189,123,109,171,89,56,233,126,26,76,26,233,48,153,197,116,191,103,93,230,253,48,145,55,225,174,
+252,109,141,134,153,205,250,47,235,36,93,249,178,186,76,48,188,141,38,24,115,29,38,24,115,26,70,222,183,235,19,73,89,93,235,162,83,246,129,229,121,248,82,109,54,208,69,132,194,72,129,251,57,252,223,15,205,115,28,244,147,134,147,6,
+186,76,49,191,103,230,242,70,34,24,115,26,48,230,163,17,205,70,35,154,140,32,223,70,16,106,194,4,149,97,2,72,252,223,230,185,191,56,73,38,186,115,87,73,91,233,167,234,103,29,39,13,39,13,36,69,52,145,12,186,72,134,93,36,
+67,46,130,97,150,255,214,108,253,94,88,233,56,105,56,105,34,41,164,136,101,210,68,50,233,34,25,116,145,12,183,200,134,94,97,12,188,194,25,121,149,151,155,14,108,57,170,220,213,97,125,91,22,88,163,44,81,150,4,134,88,18,25,96,
+77,96,74,200,129,43,34,4,172,139,196,172,139,196,172,139,235,34,250,200,190,178,47,198,252,111,57,223,254,193,254,95,249,158,63,171,254,29,63,112,120,127,243,254,191,243,60,127,198,244,253,164,240,231,30,3,74,127,215,246,191,243,60,127,
+239,225,119,237,251,91,247,63,154,185,242,253,90,232,179,134,135,65,39,29,9,95,213,126,109,50,67,24,94,73,36,54,221,91,53,127,211,254,167,254,127,230,79,211,126,214,221,93,162,123,123,181,255,211,254,167,254,127,242,253,38,27,199,233,
+27,134,223,211,72,188,214,42,216,73,164,21,146,19,179,120,252,228,210,111,194,111,194,111,56,77,228,225,102,254,64,255,32,255,41,31,227,31,178,253,80,183,234,43,161,36,225,215,143,88,235,193,240,252,220,189,52,84,151,29,111,213,126,157,
+106,203,176,61,25,118,75,209,169,47,70,8,37,232,193,4,190,8,37,215,243,111,40,225,7,92,135,84,235,9,33,240,73,15,130,72,113,181,82,66,42,42,77,81,82,123,130,56,151,84,18,233,46,168,36,36,186,165,18,93,81,213,37,232,
+234,146,226,67,170,75,223,249,207,213,223,161,59,14,195,179,6,93,152,50,236,193,151,102,12,186,7,163,92,52,151,84,154,75,162,200,69,106,77,44,212,65,34,204,191,169,252,231,14,98,116,58,29,48,149,211,9,93,40,222,26,97,191,155,
+64,214,89,97,192,115,139,14,124,109,78,113,97,53,97,41,133,208,47,209,225,26,16,117,209,23,174,136,177,68,88,162,44,81,22,40,139,24,198,49,140,19,139,98,216,182,45,139,86,23,185,97,97,83,8,84,194,2,98,152,182,45,139,85,
+162,231,163,132,144,225,37,82,68,96,138,213,73,176,101,69,155,42,86,108,152,206,175,225,43,85,3,85,49,76,83,20,197,48,148,194,113,109,245,96,213,155,43,44,173,169,53,176,156,109,157,177,176,183,133,26,204,178,44,211,102,89,22,19,
+102,89,164,217,150,89,102,205,70,89,179,11,6,89,179,78,191,13,56,82,87,64,212,149,210,205,73,165,154,146,36,89,169,34,69,155,9,22,97,120,150,180,176,208,77,131,44,172,216,50,178,205,131,43,44,216,50,178,205,168,212,211,128,106,
+95,141,244,179,45,244,155,48,190,179,194,243,86,191,30,4,146,112,252,230,29,110,94,157,122,37,122,195,202,98,225,7,93,17,122,232,139,9,132,9,69,72,164,162,178,184,148,86,87,18,138,223,155,209,208,58,117,233,122,43,200,121,8,174,
+175,33,48,121,8,26,143,33,3,81,228,108,132,234,185,186,246,246,67,66,43,137,65,40,174,37,30,81,92,72,121,69,122,60,162,186,43,202,44,190,187,153,217,238,234,135,128,213,76,81,82,137,73,64,152,75,224,252,243,73,123,11,54,241,
+191,171,57,198,113,156,103,25,56,255,208,127,7,244,149,156,103,25,198,113,147,141,177,182,54,198,202,212,178,181,44,173,75,43,82,202,212,189,90,151,173,188,47,91,255,59,60,186,171,195,22,36,146,73,36,147,94,238,189,157,197,127,132,73,
+84,195,105,36,146,78,124,73,56,254,110,191,155,175,230,235,249,186,244,254,223,74,254,110,191,155,175,230,235,210,189,55,175,77,250,186,111,212,187,245,87,110,190,205,75,211,126,174,155,225,53,239,132,106,106,106,160,106,164,87,108,47,118,170,
+118,210,49,97,21,108,90,144,173,139,98,217,255,72,55,248,137,255,191,253,127,230,113,234,166,188,118,209,151,86,213,106,106,166,179,212,127,229,251,45,245,233,191,87,77,250,151,126,170,54,166,133,101,106,49,86,84,138,126,198,58,137,253,140,
+102,145,154,66,247,85,59,118,192,78,173,173,5,179,130,216,234,108,117,35,97,219,183,15,217,174,184,171,42,65,36,211,246,85,254,25,13,139,98,216,182,45,139,98,197,81,130,49,42,144,90,169,24,38,40,32,53,33,53,213,176,76,83,85,
+54,194,247,106,86,237,29,67,246,53,227,20,234,212,173,139,98,216,177,57,255,134,63,242,63,207,135,85,53,172,21,106,70,49,134,170,189,222,27,127,174,19,250,40,73,198,49,138,92,203,251,50,78,113,140,7,31,179,162,98,149,128,202,194,
+43,174,48,111,217,210,49,140,24,118,171,47,240,105,255,195,215,181,251,157,81,82,144,176,73,167,91,7,96,142,123,159,246,80,139,219,155,38,45,155,33,216,200,172,146,73,172,86,17,81,122,246,191,115,150,8,250,202,28,225,12,34,246,142,
+231,253,145,39,254,95,179,238,23,43,21,219,33,169,33,24,213,200,255,144,238,29,181,72,93,185,205,19,86,59,67,213,42,232,18,143,48,149,152,9,84,186,189,211,31,242,238,33,51,64,233,131,204,53,92,206,181,238,159,249,126,200,147,254,
+39,212,176,139,175,52,197,146,112,140,208,78,40,99,4,206,99,25,212,33,23,252,78,127,239,251,85,223,156,46,165,129,170,183,103,55,97,41,43,174,67,39,103,77,247,63,96,254,42,221,57,220,186,169,118,170,221,53,213,114,87,107,34,235,
+162,106,108,217,49,72,198,27,22,205,51,132,206,41,221,175,246,85,218,19,20,41,154,98,145,93,177,135,230,63,55,249,174,159,217,222,121,207,58,234,175,62,189,245,212,187,214,195,246,180,183,253,73,255,159,24,255,61,191,234,73,38,190,21,
+147,73,167,237,71,248,205,191,197,251,74,254,146,121,215,156,54,254,124,119,175,63,253,127,106,79,252,248,255,223,254,167,254,103,255,68,147,255,201,31,213,56,246,211,82,176,213,87,154,235,154,107,174,174,231,255,28,159,243,74,239,253,182,253,
+77,252,61,104,53,107,43,183,89,36,245,22,53,253,223,238,191,146,63,59,91,249,47,58,242,195,159,150,119,242,197,185,115,239,86,157,127,152,252,237,255,168,230,95,220,216,217,121,233,202,188,252,175,198,246,191,6,145,126,250,79,80,223,95,
+216,213,134,188,27,22,205,179,179,103,109,98,117,239,234,156,108,216,205,179,156,219,22,182,54,207,166,165,212,115,108,91,52,206,19,22,207,111,236,123,134,184,205,35,52,205,49,72,174,216,106,237,100,175,112,253,190,22,223,91,54,45,155,103,
+102,198,109,174,173,58,247,245,26,73,156,219,22,182,115,142,188,120,126,147,195,128,254,161,36,149,254,200,254,15,234,240,234,56,117,163,99,12,73,253,223,48,99,84,17,142,214,36,158,60,75,58,107,116,215,49,174,97,137,47,41,8,33,8,
+176,106,206,178,73,195,254,191,245,51,193,183,240,109,247,219,125,246,146,76,216,111,176,145,254,66,73,60,191,211,250,223,228,127,212,207,9,194,111,36,255,80,127,135,254,164,146,127,233,255,47,225,245,28,25,27,13,76,127,170,191,212,95,210,
+126,163,103,95,129,194,120,95,132,222,73,205,134,152,71,1,165,235,12,152,48,186,211,126,51,125,32,115,205,44,37,134,151,189,124,44,243,134,165,240,88,195,65,27,214,68,90,178,19,159,125,169,175,125,166,248,18,178,47,222,55,173,251,199,
+241,76,240,198,111,36,255,82,250,126,145,133,181,254,153,5,181,254,153,5,181,254,153,4,234,234,188,95,249,175,205,198,89,218,191,156,215,167,54,201,185,110,219,193,56,109,187,111,4,225,182,237,188,19,134,214,230,23,142,103,255,119,253,25,
+27,108,109,191,101,247,66,97,34,48,145,24,104,121,191,52,73,217,215,179,173,63,87,213,120,189,122,175,23,149,71,134,224,53,155,76,107,191,89,145,114,62,80,251,110,78,198,187,109,201,216,215,109,185,59,26,238,102,191,92,55,231,159,46,
+151,63,253,25,53,217,185,217,53,217,173,167,236,121,216,126,199,157,135,236,121,216,126,207,124,11,147,243,92,219,5,179,231,252,229,110,126,203,246,115,117,14,209,212,59,74,164,93,40,210,91,86,254,121,41,170,71,231,47,37,100,95,78,111,
+206,18,107,165,251,63,54,159,155,36,146,77,208,53,240,215,195,252,36,145,254,159,217,126,238,169,219,251,166,167,18,79,254,127,247,255,63,221,49,234,175,238,201,36,255,235,140,116,218,219,108,39,83,106,36,76,107,191,89,223,119,76,186,71,
+249,73,35,252,119,127,138,127,201,57,255,148,146,63,199,63,178,253,85,255,164,194,86,223,188,31,229,27,255,131,27,249,214,196,182,173,252,242,95,177,175,252,229,254,13,95,220,146,73,175,254,184,159,205,255,69,127,162,87,243,127,177,175,236,
+127,117,199,246,39,143,19,199,138,127,158,63,202,63,231,254,104,255,40,255,159,249,163,252,183,127,215,252,191,243,254,183,230,191,170,191,211,95,219,126,105,127,107,95,220,147,251,186,254,198,157,127,177,167,240,87,175,248,43,253,30,26,66,181,
+45,58,155,246,111,181,182,241,227,199,143,17,171,179,109,209,191,157,108,55,255,7,254,191,245,255,175,253,127,235,255,195,251,154,254,214,191,181,190,159,197,167,241,111,95,234,175,99,254,187,110,200,79,204,95,249,133,141,119,235,170,42,18,73,
+88,100,224,36,94,33,131,92,188,215,71,101,102,30,227,179,243,105,215,194,246,185,27,247,35,36,234,77,124,54,246,77,219,27,86,241,52,185,108,73,38,157,130,108,173,48,179,120,187,195,75,214,233,18,106,201,116,108,230,217,175,183,124,126,
+107,245,63,156,188,146,107,165,248,104,187,58,233,206,200,227,243,154,255,48,52,18,35,243,75,34,21,174,195,171,65,3,169,89,48,208,89,34,146,210,169,8,33,35,102,164,156,238,132,230,163,39,95,4,167,48,110,230,195,109,195,154,175,215,
+253,39,77,75,224,88,64,145,55,145,2,68,222,35,126,16,182,155,214,225,96,212,252,231,234,52,191,14,11,178,154,115,215,133,165,167,9,142,197,224,183,11,169,193,110,195,78,116,166,151,247,82,87,95,90,181,53,245,232,26,173,149,134,214,
+184,95,149,131,14,198,191,43,8,184,35,245,209,195,92,143,178,5,208,27,152,117,47,5,224,47,101,97,250,144,202,223,169,86,17,120,188,117,8,116,125,79,48,232,250,174,154,50,197,25,96,72,101,129,33,150,4,172,8,18,178,46,18,178,
+38,205,206,38,253,63,113,207,134,139,165,56,6,174,156,225,41,189,164,92,183,234,236,174,198,29,149,235,96,248,63,6,31,156,191,133,178,225,166,240,194,217,72,237,65,106,126,196,95,77,123,70,181,224,63,49,103,215,250,158,31,156,217,249,
+180,235,58,29,13,248,93,190,250,180,72,190,142,200,35,98,186,14,177,27,21,24,52,15,212,240,235,191,132,12,133,253,124,47,65,108,175,12,129,5,178,93,162,5,178,188,35,132,22,202,246,187,175,103,230,52,79,205,27,205,249,206,152,64,
+157,48,121,26,82,26,225,109,41,116,93,25,117,160,186,3,94,47,141,97,168,203,192,117,47,54,28,202,194,57,177,190,172,33,83,85,218,195,66,11,56,234,12,44,245,139,11,117,8,185,130,44,82,194,238,213,222,24,106,91,130,71,133,226,
+228,139,185,244,104,75,161,133,157,4,176,97,103,93,98,194,215,64,214,44,52,217,19,207,54,93,146,24,91,243,23,137,19,97,105,27,213,134,151,210,70,139,249,201,23,227,126,55,156,255,57,93,151,137,174,203,230,252,111,36,146,191,168,252,
+229,121,247,147,78,31,156,230,36,233,126,156,219,57,166,38,16,106,38,253,156,58,246,93,249,177,195,151,230,46,253,69,167,83,106,180,198,187,245,173,207,25,106,152,223,105,231,39,135,95,230,57,112,252,231,15,206,254,167,65,27,249,197,180,
+109,91,249,230,54,235,252,229,255,164,22,38,159,172,225,161,36,147,78,31,172,195,244,152,126,144,146,191,156,195,75,11,120,53,150,222,11,105,183,129,22,152,158,218,207,104,152,105,237,53,138,114,134,190,58,185,67,94,58,171,61,162,97,167,
+181,173,49,61,163,133,167,30,26,27,120,28,63,73,95,220,19,89,254,36,89,92,54,14,26,151,127,28,63,249,135,236,70,186,56,108,29,94,140,154,238,103,97,12,34,144,24,66,178,127,4,127,72,48,254,30,13,140,48,101,123,147,179,165,
+144,58,7,163,132,14,169,63,194,31,245,31,231,162,43,209,208,35,209,213,42,129,194,81,3,132,19,254,47,242,143,219,142,148,64,248,34,162,221,251,121,121,87,12,30,142,24,56,187,252,255,230,31,177,26,232,225,176,117,117,112,202,234,225,
+156,53,24,56,101,123,191,142,63,236,63,195,71,86,163,56,118,22,123,111,77,245,76,210,169,143,248,151,184,109,193,13,29,39,246,74,142,129,232,129,3,172,255,72,39,249,87,250,244,69,122,58,4,113,28,250,155,81,39,31,205,103,4,221,
+252,92,180,86,17,72,96,200,206,215,127,28,63,254,127,230,79,246,96,156,238,156,127,56,73,255,201,63,245,255,225,38,45,63,180,135,12,225,149,195,135,185,194,79,244,191,241,255,82,111,255,66,184,96,225,156,61,206,30,127,197,255,143,250,
+146,73,255,167,254,9,49,111,233,135,64,225,6,208,146,129,15,255,127,232,79,254,9,58,54,54,36,223,253,130,127,243,196,147,193,137,198,252,245,146,113,255,161,36,156,127,61,95,207,99,251,227,143,231,171,249,234,254,121,123,63,60,189,155,
+215,179,122,246,111,175,103,244,207,253,184,127,148,156,191,198,73,255,183,253,73,255,153,255,247,255,143,253,191,234,189,179,88,23,78,17,53,254,24,147,203,248,211,195,151,241,167,135,47,217,221,60,23,182,73,167,47,215,114,224,73,36,149,229,
+249,237,156,182,97,14,107,169,99,103,39,213,94,67,178,188,135,102,118,175,45,153,108,135,135,172,62,25,82,41,11,22,27,14,81,142,172,222,183,197,156,56,115,75,8,17,53,129,25,219,8,205,243,149,111,210,9,253,38,54,29,171,11,218,
+177,91,97,170,150,93,89,219,11,249,127,101,120,126,182,156,174,129,60,150,22,55,172,103,48,34,105,194,98,71,10,112,229,249,130,77,111,56,222,86,250,95,157,246,124,159,151,2,78,14,77,138,223,103,200,94,198,183,214,78,55,156,47,206,
+85,191,78,37,108,127,77,135,99,97,171,56,57,190,23,242,231,139,111,93,66,57,201,197,9,35,243,157,130,228,28,251,199,129,93,99,171,27,169,249,193,160,208,149,252,194,112,78,31,245,58,237,252,19,164,143,230,86,250,95,159,87,6,253,
+71,253,79,26,205,63,120,63,89,133,230,191,158,135,217,194,177,98,97,6,194,72,181,120,38,91,35,100,108,172,108,38,54,4,36,141,149,225,176,108,17,126,203,241,188,154,94,86,243,75,240,188,115,71,234,73,56,236,36,225,176,108,36,236,
+39,13,135,31,221,86,54,19,27,6,194,72,217,134,193,178,241,126,123,23,97,43,176,225,121,199,101,227,247,68,154,222,77,229,127,82,188,198,183,147,75,206,23,149,254,76,115,18,73,199,97,38,187,9,52,216,87,102,127,154,31,170,36,222,
+73,38,242,72,188,147,94,97,121,36,139,201,55,211,243,67,86,194,77,118,19,93,132,146,73,131,133,241,124,126,232,231,121,91,205,47,56,95,79,236,139,201,53,188,147,79,220,139,197,228,225,121,36,175,238,107,121,43,121,39,27,240,124,163,
+248,231,176,127,27,132,143,226,147,147,143,225,156,151,187,85,63,73,170,168,77,54,19,84,94,136,54,246,106,254,169,95,232,149,254,225,60,251,56,126,107,243,196,154,33,37,108,57,246,15,213,100,73,22,36,227,97,176,126,171,34,73,206,48,
+129,6,195,96,217,126,204,151,100,21,252,245,162,186,177,124,63,60,34,186,132,85,233,2,7,109,176,131,157,137,37,127,78,213,125,71,29,237,135,102,58,142,51,108,30,231,104,253,63,106,246,159,5,240,253,176,185,23,180,65,91,188,4,175,
+102,219,32,77,71,29,235,117,59,21,43,7,27,159,27,185,208,88,91,180,69,132,31,10,67,220,157,152,234,53,184,75,214,224,130,4,8,57,206,119,18,35,11,179,104,120,253,162,194,246,231,101,145,118,250,48,253,54,26,156,225,105,95,211,
+179,176,126,218,193,240,23,44,254,217,171,218,107,119,133,127,113,250,158,11,200,242,195,148,17,195,145,225,133,216,193,39,23,56,216,171,210,243,131,26,185,19,157,194,252,46,205,138,255,39,85,255,206,92,169,106,254,152,92,183,120,9,89,88,
+16,174,176,46,193,196,210,220,191,53,203,245,66,242,127,61,155,254,122,183,83,243,203,35,179,29,253,156,220,175,252,239,230,9,56,94,87,243,199,243,203,126,25,116,200,255,219,132,183,241,72,182,57,44,91,181,243,253,56,115,79,251,127,214,
+182,52,253,152,182,163,88,114,191,182,31,166,253,168,240,197,200,253,152,129,5,127,104,44,123,22,234,111,89,205,205,53,103,108,94,45,31,180,43,112,253,51,172,143,10,88,210,216,106,197,233,253,112,231,248,203,119,241,87,133,108,105,251,58,
+100,114,133,123,54,68,146,73,229,11,104,158,7,151,233,133,211,195,151,233,133,211,195,151,104,185,248,46,161,36,156,97,201,141,129,201,34,216,126,107,46,89,114,201,108,121,207,57,177,39,250,154,240,156,101,90,146,172,44,37,90,150,26,235,
+175,22,199,254,132,147,157,216,221,141,217,254,152,156,238,198,232,167,100,197,46,212,53,137,133,106,120,66,50,47,96,129,29,157,172,186,135,85,88,48,213,174,157,180,109,65,149,132,6,195,94,13,139,85,177,108,245,146,71,85,88,107,193,177,
+98,73,207,254,135,27,158,183,62,186,59,6,163,214,3,209,161,157,117,195,15,211,246,74,70,23,99,112,106,205,26,69,181,6,129,102,29,189,80,32,107,93,65,150,19,181,131,6,88,163,85,131,66,195,6,133,133,106,64,101,212,173,72,26,
+213,135,29,120,48,106,107,13,70,86,52,97,174,140,85,179,100,206,48,96,216,182,44,73,194,208,139,250,71,8,188,235,24,89,179,66,112,108,58,135,237,55,243,158,115,99,99,99,206,109,78,170,107,128,202,218,145,169,1,49,140,97,177,99,
+159,253,57,207,233,15,233,9,39,254,132,216,243,158,115,206,109,79,226,83,246,134,196,146,127,232,79,57,253,33,177,177,255,165,137,36,243,159,210,83,248,132,158,201,164,221,2,22,117,13,66,117,6,13,58,135,80,100,214,24,54,44,113,96,
+213,96,213,234,193,141,83,90,178,192,101,101,215,131,98,217,235,36,255,210,217,183,62,26,199,233,41,212,188,229,88,181,127,238,127,228,85,51,76,83,52,170,15,233,20,95,225,42,42,85,21,42,129,51,69,76,208,213,51,67,135,252,138,237,
+29,213,74,119,96,129,48,67,159,252,143,252,143,252,138,237,29,213,66,153,166,105,154,28,82,168,169,68,207,252,89,162,255,9,81,82,187,66,4,205,51,76,208,226,149,69,74,33,9,154,98,153,165,83,52,162,102,135,4,205,2,102,138,153,
+165,83,4,9,130,28,255,250,87,250,132,156,121,138,254,211,243,167,254,132,159,252,159,206,254,228,146,73,43,207,94,98,191,217,36,146,191,217,63,249,36,147,254,220,249,15,234,18,87,155,62,88,223,106,243,31,228,219,27,241,190,216,245,147,
+94,96,159,157,230,36,146,79,49,33,36,215,104,116,149,218,29,36,213,39,20,222,130,105,250,116,162,47,64,152,244,93,161,213,41,180,116,148,195,244,251,194,126,158,146,60,63,79,130,20,40,187,241,124,210,107,52,79,206,243,18,73,38,137,
+249,222,96,146,152,116,197,194,82,70,218,75,225,47,132,190,18,248,207,236,149,60,16,36,254,221,127,79,131,156,16,226,139,180,56,238,94,152,38,125,9,170,7,166,213,253,149,63,133,154,98,152,166,40,18,81,81,122,98,225,48,218,78,9,
+224,138,159,183,8,58,28,92,119,83,109,16,161,37,41,53,74,33,193,21,6,208,227,109,39,162,18,73,172,247,47,116,247,85,202,161,197,49,76,54,215,110,60,196,154,119,87,151,235,233,203,27,255,136,121,235,205,159,44,111,177,36,114,254,
+207,34,78,127,242,255,249,255,161,253,79,95,57,43,251,42,254,191,145,175,245,10,243,215,152,243,146,113,254,201,93,253,211,183,7,9,131,132,162,7,193,11,214,118,207,116,231,182,127,132,175,139,170,85,213,3,230,244,124,54,207,240,140,254,
+202,142,29,82,174,174,169,87,84,15,131,135,74,206,209,180,175,253,10,255,4,146,183,127,29,174,207,252,243,140,143,235,146,87,250,69,127,234,87,250,228,145,63,210,156,255,203,156,211,246,228,154,79,236,150,115,255,207,19,127,250,3,99,205,
+253,131,127,254,63,83,95,216,154,254,224,215,247,6,191,184,174,188,121,191,177,127,250,8,255,65,167,242,43,251,150,252,192,253,207,238,43,251,131,95,220,26,240,206,252,239,253,65,38,141,139,103,172,230,216,182,122,243,98,73,45,249,129,250,
+158,4,146,73,224,188,63,114,73,36,155,255,81,70,36,146,79,250,120,127,208,233,254,208,223,217,252,231,245,14,159,237,225,250,154,254,211,247,39,247,191,249,175,237,63,114,127,123,251,157,127,217,252,231,245,52,255,104,255,72,255,33,167,241,
+15,14,113,251,159,218,126,231,247,191,249,175,237,63,114,109,141,230,255,214,254,164,127,228,255,167,134,44,63,179,249,131,254,158,24,176,254,207,230,63,211,192,255,164,143,228,154,55,231,121,151,129,36,146,120,45,169,121,36,146,111,253,109,234,
+196,146,73,254,94,221,156,73,235,255,24,225,253,31,205,255,72,241,226,79,252,248,255,200,245,255,140,112,254,143,230,255,164,127,231,195,252,35,252,71,135,248,248,255,200,255,207,143,252,143,252,248,147,255,143,252,241,60,120,147,254,143,244,176,
+254,143,49,255,199,254,120,159,252,127,231,137,255,71,250,88,127,71,152,255,227,253,60,72,191,186,151,156,117,18,73,191,248,90,207,236,201,36,215,103,86,221,100,146,73,191,187,243,31,155,53,253,201,36,159,220,117,112,60,196,146,113,252,198,
+191,212,145,249,203,241,176,190,179,109,248,111,31,156,84,93,227,69,69,145,110,11,190,150,92,158,198,205,132,20,36,175,230,155,243,93,124,57,32,76,16,231,251,47,218,209,235,221,252,117,69,76,54,142,224,152,33,207,246,191,178,171,210,127,
+111,251,44,246,186,247,4,124,93,82,136,234,129,243,122,62,27,103,248,71,252,185,202,255,29,93,94,174,174,17,100,58,165,93,94,137,71,93,175,155,209,21,213,42,234,129,211,23,163,225,182,127,132,86,123,149,4,165,82,155,74,255,11,195,
+14,131,252,82,119,255,75,243,155,191,149,160,182,185,215,43,207,60,243,75,45,139,230,153,167,230,247,117,236,221,215,179,243,255,203,110,127,228,217,121,133,244,188,147,134,225,125,135,11,94,133,121,216,94,47,91,11,94,189,124,195,153,2,45,
+234,135,62,87,142,97,121,94,97,125,45,125,57,135,238,69,228,149,219,61,202,225,208,34,206,208,134,158,31,194,29,48,159,241,30,31,219,224,159,209,143,240,255,206,252,239,254,158,26,199,240,255,131,79,205,126,175,183,247,35,183,247,35,245,
+43,251,154,254,164,127,167,248,107,127,240,117,95,251,38,93,84,253,155,118,254,228,117,108,253,79,237,91,180,126,144,117,79,87,253,107,250,79,218,219,183,246,49,250,159,225,222,47,253,155,11,196,55,60,166,160,157,4,235,213,182,210,172,25,
+35,247,127,154,230,43,254,157,159,211,26,151,170,245,213,181,135,238,86,63,146,53,127,103,243,88,127,228,127,207,136,150,95,226,194,55,237,27,111,31,216,137,253,159,230,186,242,138,126,229,191,199,63,225,31,229,183,78,125,226,57,191,53,182,
+207,251,238,150,253,245,127,115,251,127,249,241,255,169,231,254,175,230,191,119,183,251,35,254,124,127,139,213,105,253,39,82,245,120,55,237,105,63,231,183,248,248,143,250,255,223,254,124,124,23,170,155,249,217,122,115,200,123,126,207,124,117,106,180,
+176,223,212,55,174,245,254,175,29,95,177,93,67,248,43,61,75,174,105,251,95,216,205,53,171,91,126,191,217,163,106,31,185,253,157,111,234,254,85,63,98,63,197,24,255,207,252,54,223,212,178,191,170,252,218,116,31,185,237,217,255,63,217,173,
+255,179,165,253,67,180,111,166,171,230,205,171,152,38,172,63,135,250,158,165,237,222,63,130,191,229,95,226,182,255,224,198,186,106,191,247,93,191,201,141,127,195,97,63,193,240,172,172,142,175,218,183,111,236,127,103,132,47,85,185,181,117,74,243,
+118,181,127,83,21,253,77,57,135,106,254,167,183,15,212,255,251,246,181,253,143,237,127,103,251,31,220,254,207,255,43,255,149,253,207,251,186,215,127,60,141,250,245,126,111,94,174,97,126,175,228,142,101,253,72,254,200,190,188,203,251,47,221,14,
+174,209,215,252,49,23,211,243,92,223,179,253,204,83,246,119,255,140,127,231,247,52,254,31,234,123,87,183,245,63,195,189,127,147,31,217,17,253,145,121,173,255,154,254,76,47,236,199,248,199,254,73,52,253,207,238,162,159,179,217,254,154,127,229,
+99,13,67,85,235,251,53,254,72,143,213,126,173,53,108,143,216,197,226,255,217,254,229,121,151,246,127,169,133,213,78,213,253,74,254,167,15,212,227,205,79,252,254,167,82,254,164,106,23,211,247,36,146,73,39,31,220,215,247,36,146,71,242,86,
+255,225,243,0
@@ -0,0 +1,11 @@
+0,29,128,4,6,21,17,37,22,54,50,70,46,87,106,103,117,116,4,129,3,0,21,18,38,43,55,107,71,119,87,120,130,7,113,39,115,131,6,42,24,245,132,8,244,133,7,114,134,5,14,22,52,135,4,5,22,54,39,116,136,4,3,21,
+20,137,4,2,21,15,39,118,87,123,138,7,110,139,5,19,140,5,16,22,51,40,242,72,248,88,243,141,6,47,22,48,142,7,112,143,7,111,22,49,255,68,68,187,29,67,22,253,124,70,246,174,30,163,33,15,65,110,53,15,202,217,106,244,
+252,172,77,93,87,163,162,106,239,87,68,194,241,169,209,48,188,106,116,120,175,236,147,86,232,91,118,120,55,230,161,135,234,179,190,27,180,206,252,247,105,95,151,230,167,249,41,121,78,174,99,63,79,94,98,31,166,230,33,250,101,230,52,219,
+157,106,124,235,83,253,151,79,225,39,255,124,240,221,254,207,205,64,127,106,191,45,217,215,231,47,58,252,229,230,33,127,255,62,47,5,229,128,35,16,253,104,120,195,149,66,4,137,132,46,135,235,97,109,217,225,8,231,186,24,65,190,48,255,
+101,255,236,254,238,119,240,255,111,15,222,97,249,237,63,174,122,127,99,79,228,17,251,143,244,162,9,193,203,16,174,225,164,76,47,7,43,80,24,80,212,147,3,99,26,140,93,252,41,226,160,184,207,23,108,92,112,155,235,55,95,48,240,174,
+91,223,39,41,10,73,210,40,201,213,239,28,156,85,9,150,240,66,170,241,21,126,187,247,247,215,124,241,152,124,175,156,169,58,207,167,252,78,27,254,63,227,224,143,218,135,211,96,199,210,81,93,118,6,67,40,117,135,88,117,225,13,74,86,
+217,168,65,116,253,192,167,242,71,176,195,58,237,38,8,136,136,140,93,226,93,236,90,236,250,238,120,234,72,143,241,219,89,143,220,254,162,94,245,246,5,225,17,148,200,100,111,25,60,92,82,184,34,34,49,119,177,107,179,235,185,227,169,34,
+35,207,90,135,211,99,151,106,22,190,192,188,34,35,27,198,79,23,20,174,8,136,136,223,210,136,39,7,44,66,187,134,150,11,193,203,29,224,194,134,223,51,19,6,223,155,148,196,76,78,81,255,146,130,254,22,197,251,32,82,252,222,51,31,
+255,197,197,140,241,153,15,213,227,250,188,43,228,226,168,78,92,136,85,95,47,209,254,187,151,175,125,245,75,247,51,145,126,226,240,84,233,255,19,134,255,143,248,248,35,246,161,244,216,49,244,148,87,93,129,144,203,245,3,42,11,140,106,49,
+168,194,34,117,253,70,182,87,119,103,40,42,217,194,47,12,225,145,34,34,37,148,174,90,22,70,70,87,61,19,82,190,219,21,30,221,40,253,141,77,230,191,200,35,42,21,30,212,237,145,80,174,54,43,25,88,172,108,76,76,122,137,158,197,
+98,200,152,162,76,90,137,138,32,0
@@ -0,0 +1,25 @@
+0,85,128,4,3,21,15,37,16,54,49,70,52,88,244,103,114,115,0,129,4,2,21,17,38,44,54,51,71,112,120,242,130,4,6,22,43,40,239,55,116,131,5,19,22,46,40,241,132,6,42,22,47,133,5,20,23,108,134,7,118,22,50,135,
+5,14,23,113,40,238,136,4,5,23,106,40,240,137,4,4,23,107,56,243,138,8,235,24,245,139,7,111,56,246,140,6,45,24,234,39,110,141,5,18,22,48,39,109,142,7,115,255,24,200,228,33,35,168,232,32,199,51,236,32,199,51,152,131,
+27,28,132,24,200,228,52,35,96,1,204,250,207,121,239,7,81,204,230,123,193,208,230,115,54,7,35,180,228,115,7,105,246,59,78,64,237,59,76,142,64,228,118,156,140,128,7,188,250,198,155,207,121,145,184,30,243,67,83,152,50,52,50,58,
+3,35,83,35,152,53,55,27,141,1,161,246,55,26,131,67,83,83,32,1,160,228,134,166,225,10,28,205,198,128,234,58,29,70,128,216,234,50,58,3,113,184,200,220,15,177,184,212,212,0,1,184,114,236,104,0,229,81,177,160,129,0,0,0,
+0,0,0,0,52,83,35,35,64,105,162,142,72,57,32,131,29,70,194,4,100,0,0,0,0,2,10,106,104,106,13,13,12,140,128,0,1,10,26,155,129,169,180,8,26,25,13,8,232,100,52,99,35,81,161,25,0,12,142,135,49,6,58,141,
+68,8,212,220,52,67,112,208,141,134,132,116,26,17,144,209,77,4,42,50,50,16,99,32,0,15,195,31,230,195,10,174,126,23,236,124,174,166,79,107,169,147,218,119,236,125,115,170,114,62,151,72,203,164,173,59,43,149,175,174,60,237,135,73,
+99,22,231,14,16,225,14,24,231,165,128,0,49,253,213,222,190,213,117,255,110,255,31,213,211,246,117,239,167,240,235,158,219,171,150,236,38,223,204,193,173,203,116,154,220,163,108,155,116,112,47,222,109,41,117,109,179,158,22,39,150,108,79,224,
+207,42,162,239,2,107,219,89,25,87,155,255,163,141,128,250,249,111,245,211,245,125,104,229,79,98,226,191,155,138,187,86,242,73,173,202,93,223,180,39,34,151,233,117,18,149,244,138,217,58,139,247,5,54,213,220,168,200,236,156,168,200,236,157,
+168,145,120,234,39,107,240,66,112,1,57,33,26,98,132,168,228,125,203,220,135,79,23,46,189,151,205,117,223,75,230,133,59,233,85,38,85,222,91,63,113,50,170,157,187,172,227,147,181,18,254,153,218,137,92,0,0,0,0,11,201,203,233,217,
+103,167,109,122,23,156,117,112,243,225,175,130,240,61,73,24,42,22,138,133,162,161,27,62,173,100,125,245,86,79,239,177,249,128,13,57,32,0,0,7,114,235,87,120,107,37,47,50,214,95,169,205,188,161,193,254,94,86,66,193,78,48,216,90,
+156,101,85,113,82,82,98,121,50,161,29,141,175,250,58,243,59,41,24,21,117,19,148,140,171,39,41,30,122,201,255,209,199,49,27,177,45,151,66,253,133,6,188,150,21,151,24,71,83,149,241,69,114,190,40,174,87,216,145,126,109,81,62,45,
+74,137,241,106,84,80,38,190,47,177,162,244,213,154,106,78,10,153,213,66,75,14,170,243,58,243,127,244,95,194,22,0,252,49,254,108,48,170,231,225,126,199,202,234,100,246,186,153,61,167,126,199,215,58,167,35,233,116,140,186,74,211,178,185,
+91,139,23,59,96,214,74,13,103,55,183,7,183,7,147,103,2,233,142,96,0,49,253,213,222,190,213,117,255,110,255,31,213,211,246,117,239,167,240,235,158,219,171,150,236,38,223,204,193,173,203,116,154,220,163,108,155,116,112,47,222,109,41,117,
+109,179,158,21,146,71,191,58,236,123,102,207,205,222,4,215,182,178,50,175,55,255,71,27,7,166,24,255,54,24,85,115,240,191,99,229,117,50,123,93,76,158,211,191,99,235,157,83,145,244,186,70,93,37,105,217,92,173,125,113,231,107,203,164,
+161,99,115,199,61,44,0,0,0,199,247,87,122,251,85,215,253,187,252,127,87,79,217,215,190,159,195,174,123,110,174,91,176,155,127,51,6,183,45,210,107,114,141,178,109,209,192,191,121,180,165,213,182,206,120,88,158,92,26,39,193,136,227,84,
+92,166,85,213,90,60,187,227,141,128,25,121,197,127,163,252,156,208,147,200,201,163,84,11,190,172,75,191,75,0,0,0,59,151,90,187,195,89,41,121,150,178,253,78,109,229,95,145,66,205,35,200,128,0,1,27,177,45,151,66,253,133,6,188,
+150,21,151,24,71,83,149,241,69,114,190,40,174,87,216,145,126,109,83,236,106,85,8,181,42,132,90,248,102,208,36,212,80,77,72,88,170,22,52,36,47,72,250,71,210,62,132,0,60,49,254,108,48,170,231,225,126,199,202,234,100,246,186,153,
+61,167,126,199,215,58,167,47,225,93,40,244,149,185,215,43,95,92,121,219,14,146,198,45,207,210,35,31,221,93,235,237,87,95,246,239,241,253,93,63,103,94,250,127,14,185,237,186,185,110,194,109,252,204,26,220,183,73,173,202,54,201,183,71,
+2,253,230,210,151,86,219,57,225,4,228,93,124,183,250,233,250,190,180,114,167,177,113,95,205,197,93,171,121,36,214,229,39,35,191,104,78,69,47,210,162,146,149,244,138,217,58,139,247,5,54,213,220,168,200,236,156,168,200,236,157,168,145,120,
+234,39,107,240,66,112,1,57,33,26,98,132,168,228,125,203,220,135,79,23,46,189,151,205,117,223,75,230,133,59,233,85,38,85,222,91,63,113,50,170,157,187,172,227,147,181,18,254,153,218,137,92,94,113,83,225,175,208,147,145,0,7,114,235,
+87,120,107,37,47,50,214,95,169,205,172,196,128,17,187,18,217,116,47,216,80,107,203,26,203,72,128,0,199,215,78,191,205,194,159,179,125,59,82,120,63,42,78,86,156,246,78,93,71,251,57,90,71,117,114,180,191,165,43,123,236,192,218,61,
+30,95,194,132,123,244,178,31,250,255,223,254,253,143,109,127,155,61,216,54,243,253,228,153,93,110,93,82,78,197,149,184,35,139,171,106,59,171,111,52,95,230,177,38,222,117,199,248,81,62,133,12,198,61,96,105,113,161,248,236,122,207,247,8,
+181,106,226,165,216,149,217,56,156,72,236,156,78,36,94,42,75,250,159,2,66,254,73,36,124,236,72,161,66,40,77,165,128,15,225,195,248,190,63,181,240,69,74,106,227,169,9,93,147,149,9,29,147,149,9,23,138,255,39,195,89,127,100,155,
+249,37,222,150,127,139,200,0,1,207,146,119,20,21,50,47,210,42,113,47,210,170,113,47,210,107,212,94,40,90,139,188,191,83,155,103,2,0,110,198,223,215,245,63,249,255,188,253,127,86,223,222,74,31,189,24,255,49,246,254,255,119,227,242,
+253,253,191,198,253,254,95,191,234,253,254,233,127,51,3,254,104,15,221,167,227,255,152,253,219,95,180,13,0,0
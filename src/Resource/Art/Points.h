@@ -0,0 +1,3 @@
+128,9,128,3,3,21,26,36,12,54,60,69,29,103,125,116,8,129,3,1,21,27,38,61,130,4,9,140,3,0,23,124,141,3,2,20,11,37,28,143,4,10,255,192,116,52,48,45,47,166,34,48,44,88,129,101,13,217,28,223,134,34,52,37,
+132,37,170,46,235,223,143,97,142,16,176,245,17,62,17,52,112,77,30,202,4,39,251,221,32,247,123,178,57,191,12,68,104,75,8,75,84,93,214,215,196,200,215,8,90,186,57,201,243,222,143,171,228,176,153,186,45,15,80,221,145,205,248,98,
+35,66,88,66,90,162,238,182,139,54,70,15,222,244,179,17,24,16,150,178,233,148,61,68,112,133,134,34,58,16,150,17,119,69,161,251,29,27,61,49,17,244,79,244,21,30,128,0
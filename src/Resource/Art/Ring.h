@@ -0,0 +1,4 @@
+0,14,128,6,61,21,25,37,24,52,10,68,9,85,26,101,28,118,58,134,4,8,22,59,40,250,55,124,140,3,3,20,11,56,251,141,3,2,22,60,142,2,0,21,27,255,148,227,11,239,42,214,253,19,70,6,168,76,162,228,113,35,137,28,
+72,161,200,226,68,225,208,159,214,54,174,127,93,245,63,172,239,27,79,186,218,238,71,18,39,18,56,145,196,142,36,186,19,84,175,2,181,236,126,179,204,218,222,63,93,214,60,149,116,154,48,154,41,50,134,138,26,145,169,26,145,169,26,36,
+106,71,228,150,164,79,91,189,92,58,19,135,66,113,41,195,161,67,161,56,161,56,161,56,161,56,161,66,165,102,4,214,60,179,23,186,223,94,220,190,222,23,197,149,241,101,124,89,95,22,83,237,172,167,219,89,62,204,159,102,69,104,200,173,
+25,63,122,100,253,233,131,194,119,195,139,143,68,20,40,71,162,127,77,100,80,138,32,211,226,225,165,164,214,151,93,116,113,104,102,4,225,163,3,50,97,112,235,71,22,134,105,112,235,174,168,0
@@ -0,0 +1,159 @@
+130,169,128,4,2,20,7,37,16,53,17,69,22,85,21,102,47,115,0,129,4,3,22,46,40,237,56,236,130,4,6,22,52,40,230,56,244,131,4,4,22,50,40,231,132,5,20,23,114,133,4,5,22,49,40,234,134,5,19,23,113,40,242,135,
+5,18,23,109,136,7,107,24,238,137,7,102,24,240,138,7,116,139,6,48,140,7,110,23,106,141,7,108,23,103,142,7,112,23,111,143,8,235,255,0,0,0,2,43,198,75,199,111,37,151,44,73,73,73,93,73,73,73,111,83,135,233,217,46,
+37,227,183,146,203,150,36,164,164,174,164,164,164,183,169,214,137,83,98,54,254,188,212,0,4,87,140,151,142,222,88,241,151,160,2,43,198,75,199,111,37,151,44,73,73,73,93,75,18,87,82,196,149,212,148,148,150,245,58,209,42,108,70,206,
+109,201,103,201,103,251,127,218,126,206,10,117,162,84,216,141,156,219,146,207,146,207,254,227,179,157,139,154,6,196,108,230,220,150,124,150,127,247,31,241,17,209,11,246,220,150,127,247,31,241,0,126,207,246,255,180,82,82,82,87,82,82,82,81,
+5,58,209,42,109,15,250,79,252,225,63,194,0,63,241,132,255,16,255,136,3,254,99,252,74,63,195,32,7,248,204,92,73,213,62,75,63,251,135,254,9,104,113,54,52,56,154,18,127,17,80,255,170,76,59,95,181,207,67,129,161,177,189,16,
+145,127,73,50,69,137,162,218,74,255,189,124,241,235,221,217,158,58,163,170,61,123,128,143,231,243,199,174,89,192,142,233,71,84,117,71,243,255,179,221,215,31,207,191,238,191,107,31,248,128,63,230,35,255,48,35,255,48,4,127,231,31,249,128,
+0,0,0,0,143,253,64,0,0,0,0,70,120,210,120,210,92,150,120,211,176,1,25,227,73,227,73,114,89,114,196,148,148,149,212,150,135,67,253,160,140,241,164,241,164,185,44,185,98,74,74,74,234,74,74,75,122,156,63,72,105,113,79,26,
+75,146,203,150,36,164,164,174,164,164,164,183,169,214,137,83,98,54,198,38,196,181,80,234,117,162,84,216,141,156,219,146,207,146,207,246,229,250,126,192,0,2,66,29,145,255,9,29,143,67,129,161,178,254,145,9,22,19,36,88,154,45,144,151,
+248,135,161,196,216,211,246,147,146,20,255,132,168,84,210,10,133,59,42,20,236,168,126,82,164,208,224,108,70,206,109,201,103,201,103,255,113,115,246,17,233,99,99,209,11,140,191,72,179,255,184,255,140,110,174,134,95,182,53,148,226,223,198,95,
+234,49,164,102,73,25,146,109,121,146,46,133,50,69,132,201,22,38,139,84,171,20,255,138,104,73,218,196,200,77,145,145,228,70,143,116,144,180,131,18,19,70,228,35,209,110,36,143,248,72,236,122,28,77,141,46,227,114,18,25,77,157,9,137,
+13,29,10,104,200,110,145,61,34,104,108,191,164,66,66,108,102,73,3,66,71,50,98,66,186,9,183,200,166,190,146,161,47,28,82,168,72,75,60,138,106,234,133,56,42,18,126,213,42,197,199,246,166,159,194,161,36,172,132,146,178,18,74,211,
+36,147,232,168,73,43,33,33,237,234,153,54,213,163,206,76,104,107,34,146,161,37,153,9,44,168,71,21,100,41,193,137,144,140,191,110,169,123,66,83,148,205,30,83,50,67,121,76,146,19,50,69,35,87,202,124,229,148,77,15,248,72,201,77,
+13,173,147,220,89,17,193,80,141,231,145,38,132,168,73,3,66,156,88,166,95,181,52,253,180,50,180,203,43,161,50,70,178,18,53,144,145,108,132,138,253,83,38,218,180,121,201,141,41,19,66,155,241,37,66,155,155,170,20,205,229,67,66,55,
+52,35,66,50,187,76,138,146,242,52,59,25,55,23,153,34,220,83,36,88,76,145,96,100,135,41,145,146,25,26,62,92,207,161,92,133,59,50,89,144,142,12,132,112,200,147,66,100,35,230,52,38,253,155,20,255,136,105,250,122,43,163,88,201,
+26,198,72,208,209,9,13,249,140,145,255,102,196,139,252,73,147,126,211,20,80,0,0,122,101,51,170,222,177,53,37,138,80,150,44,100,183,173,234,74,74,93,68,164,174,181,90,154,146,197,40,75,22,50,91,214,245,10,230,75,83,88,55,108,
+102,188,152,223,246,243,94,81,253,191,100,127,55,203,246,191,159,2,58,163,170,58,163,159,179,84,115,191,239,127,126,255,159,142,175,217,254,126,58,163,170,58,128,142,127,235,254,104,11,208,0,63,103,205,48,4,13,229,49,122,14,126,105,160,
+22,65,84,21,72,243,246,205,173,41,192,224,129,205,229,51,170,57,188,167,122,27,243,208,221,106,183,172,13,95,23,74,64,221,140,18,222,164,182,196,94,100,106,253,68,148,171,28,14,221,85,56,126,111,167,94,189,157,105,126,224,44,196,98,
+8,35,171,102,253,95,173,222,53,103,4,132,196,100,128,68,201,11,14,238,152,107,252,223,240,116,75,255,226,127,210,203,250,36,119,152,252,223,135,119,230,251,188,35,115,38,26,240,104,92,201,211,182,23,122,92,253,154,93,14,221,63,171,200,
+13,227,86,200,180,54,112,137,146,23,6,171,126,179,62,253,192,0,6,237,151,158,125,250,129,25,33,49,30,107,25,38,26,201,161,114,107,204,113,185,48,36,185,238,253,223,76,219,102,174,133,194,246,221,4,38,125,132,132,206,101,178,38,232,
+76,70,232,77,20,127,214,103,253,112,3,128,225,123,110,179,62,200,254,167,95,233,16,0,7,96,143,248,206,171,22,50,88,165,9,98,106,75,122,146,146,146,197,73,73,95,127,231,245,105,93,66,243,252,214,26,255,54,253,188,221,48,255,143,
+55,61,223,164,234,227,156,111,221,20,134,237,145,98,50,217,174,168,218,240,204,112,187,76,53,161,38,136,199,249,168,127,4,0,0,124,180,66,185,145,174,111,224,165,208,237,106,220,215,152,31,245,0,112,28,47,109,81,103,61,150,55,224,253,
+13,208,184,17,224,72,237,186,236,29,161,118,182,115,98,187,165,196,108,87,96,72,70,197,118,178,198,156,100,188,0,216,54,94,149,66,221,109,11,116,127,127,251,48,0,31,242,31,244,255,159,252,191,231,255,31,249,127,207,254,63,227,111,241,
+151,240,161,252,56,127,6,31,194,135,240,225,252,16,236,57,199,240,192,184,127,71,254,255,228,88,155,17,198,137,85,48,31,250,175,119,237,178,89,255,92,219,246,152,196,218,232,209,42,166,3,255,196,14,113,252,48,14,246,255,24,0,127,12,
+115,143,232,188,173,116,255,142,237,203,25,237,133,205,69,137,177,28,105,122,179,255,203,180,118,22,219,26,207,246,238,109,76,103,182,23,54,49,54,254,137,37,192,0,16,115,142,112,131,180,118,188,173,116,255,79,22,162,207,107,220,73,142,153,
+12,134,67,33,112,186,61,128,0,0,141,217,115,37,204,87,17,185,232,71,27,152,142,199,165,110,0,179,119,126,175,51,102,36,118,118,193,218,39,173,158,231,62,151,19,27,158,4,134,198,231,131,155,27,158,14,108,110,145,67,35,133,196,118,
+54,8,118,186,243,97,225,221,213,66,55,225,3,116,46,16,201,219,113,36,25,246,62,133,115,179,155,163,21,197,145,106,253,111,235,128,0,112,23,225,250,223,223,33,100,250,30,15,164,112,103,184,141,10,235,102,124,140,143,158,184,22,157,48,
+148,215,134,167,217,107,130,112,142,67,72,232,251,171,116,63,83,221,212,0,21,147,90,74,118,83,171,100,0,8,71,84,186,168,71,14,114,209,34,109,114,89,43,217,84,7,107,144,126,167,94,52,82,184,182,67,51,229,14,119,225,12,31,71,
+50,210,200,247,108,134,99,139,33,126,163,50,214,224,0,188,194,50,107,253,90,193,34,143,135,54,231,58,155,246,65,34,112,253,152,100,100,253,217,255,142,31,194,135,240,225,252,24,127,10,31,195,135,240,83,252,64,0,0,255,139,127,140,0,
+0,111,249,255,140,0,0,48,0,0,94,96,1,122,12,134,80,254,24,0,0,29,47,64,47,74,165,178,142,81,202,191,179,143,236,192,5,255,17,127,237,251,60,165,107,163,116,59,68,54,195,244,243,167,233,230,180,98,154,209,142,7,3,253,
+93,179,118,177,145,142,122,224,230,198,70,77,84,138,67,55,118,109,127,154,154,199,40,115,197,33,163,250,62,235,118,151,96,231,46,236,218,252,53,173,78,29,174,128,0,63,87,211,95,132,225,233,187,154,255,248,215,254,99,254,95,201,195,243,
+86,59,208,35,94,96,14,123,172,149,67,179,27,156,59,0,17,255,168,3,112,221,123,111,189,54,65,137,31,115,235,129,150,226,61,100,110,220,46,193,218,23,116,103,70,43,181,146,17,177,93,174,6,197,118,179,198,156,100,187,128,216,54,94,
+117,50,225,86,46,17,215,249,172,63,107,3,140,160,112,89,64,220,197,37,3,38,42,74,7,10,74,9,218,188,200,16,32,64,18,7,20,116,244,158,150,89,84,197,37,125,44,108,75,26,94,172,83,79,225,24,115,138,64,227,43,214,78,112,
+56,156,41,43,92,188,217,0,128,32,9,109,39,232,142,178,169,216,218,199,71,89,65,88,140,9,201,249,141,23,64,32,128,68,224,130,9,204,139,164,76,88,216,167,40,81,210,42,196,96,78,73,232,104,160,142,8,0,17,56,33,118,193,47,
+202,224,98,232,74,38,235,182,29,184,202,38,235,232,16,32,200,32,71,59,33,38,137,59,154,7,77,181,162,202,6,196,107,10,64,224,172,32,183,205,63,164,230,46,132,162,111,73,68,222,146,137,189,54,214,139,39,253,162,46,95,180,99,169,
+181,104,149,83,170,146,186,146,146,150,37,213,73,31,81,177,181,33,68,170,155,172,84,149,212,148,177,162,151,87,46,175,210,43,242,91,127,204,1,178,243,220,56,85,139,132,122,126,163,246,200,50,8,16,35,152,56,161,126,107,187,193,103,93,
+224,119,97,175,192,147,183,155,94,31,241,230,231,187,244,157,92,115,141,92,7,13,142,100,208,217,174,40,70,221,51,97,27,180,238,50,215,225,210,107,168,178,45,144,193,238,130,92,251,161,153,244,115,45,44,144,77,144,195,40,92,143,116,110,
+130,62,110,110,14,117,55,253,156,18,39,14,192,104,201,251,161,20,129,136,164,12,69,32,98,41,3,140,132,14,11,42,152,89,57,192,235,114,243,100,16,0,128,12,185,149,0,0,86,68,142,112,187,155,41,213,111,88,154,146,197,40,75,22,
+50,91,214,245,35,178,129,19,88,35,165,42,199,9,152,172,155,248,115,0,6,23,157,236,100,220,230,70,198,231,152,216,220,240,54,55,61,104,70,231,209,209,207,2,104,54,16,98,108,16,141,219,8,108,253,99,161,108,138,57,238,116,115,126,
+15,115,177,112,56,51,163,232,89,59,58,67,119,235,191,122,0,3,101,231,126,110,31,189,213,147,220,231,129,28,25,245,190,142,105,165,112,124,140,143,158,186,202,238,152,74,107,179,81,55,11,48,36,217,28,133,209,185,247,87,72,126,107,55,
+230,241,161,36,76,144,68,234,117,56,73,206,18,153,28,37,54,56,74,109,25,43,67,106,156,37,53,56,205,142,204,70,213,162,65,93,76,186,141,97,137,37,22,211,44,108,161,177,180,206,254,170,180,57,20,142,104,207,73,64,224,178,169,216,
+216,150,80,162,17,197,77,214,85,55,254,33,26,89,175,158,53,107,230,183,181,243,31,212,91,204,45,141,141,99,75,213,139,26,181,231,58,53,233,105,76,200,214,8,233,66,146,155,177,146,157,148,197,177,54,134,39,68,124,79,19,37,117,130,
+146,210,10,75,72,117,82,42,116,177,173,78,135,73,212,231,28,82,167,56,226,150,83,157,141,106,151,225,179,127,231,246,37,252,0,22,98,64,55,231,221,191,245,186,134,252,224,140,152,144,17,128,236,72,70,88,116,252,220,110,100,195,94,102,
+133,204,154,251,97,119,165,207,217,165,208,237,211,250,188,128,212,55,236,139,67,102,232,164,55,52,76,155,245,217,245,112,0,0,55,143,214,234,225,19,38,116,174,14,100,206,152,107,138,92,157,51,18,66,228,214,247,61,216,119,97,249,173,179,
+88,30,232,36,120,68,201,139,131,153,51,166,203,35,153,52,76,153,208,140,187,188,48,59,243,104,108,100,99,158,186,220,216,200,200,234,145,72,120,97,211,15,9,171,67,40,115,197,33,115,246,62,235,115,23,160,231,47,217,142,221,221,151,255,
+202,223,243,31,241,255,255,253,34,109,90,37,84,196,20,148,148,177,37,37,37,46,167,90,72,177,37,53,154,146,209,149,214,140,179,131,44,237,48,5,15,248,132,215,207,26,157,233,141,166,14,244,198,211,6,47,76,109,48,98,244,190,99,17,
+83,2,244,190,96,5,188,192,23,167,245,22,97,108,100,174,109,5,122,69,93,90,11,89,173,127,103,232,0,0,164,231,4,7,207,204,139,122,212,201,72,218,42,84,178,146,180,86,245,172,168,112,198,120,254,146,224,0,3,250,60,142,92,191,
+106,83,199,149,192,0,63,233,252,88,75,151,241,103,141,27,146,198,120,208,1,251,67,159,40,171,62,53,254,44,24,233,251,82,158,44,116,198,19,197,169,89,175,237,49,173,216,196,218,232,210,245,103,91,250,172,212,234,129,178,113,77,54,198,
+234,46,219,29,23,109,142,139,42,157,37,19,98,164,105,14,76,107,37,132,213,169,140,102,173,74,205,64,3,254,139,127,85,154,152,198,106,116,198,42,148,198,51,83,162,217,82,139,119,233,24,214,152,217,78,139,101,74,45,166,180,90,173,22,
+171,75,214,139,62,74,82,42,64,214,68,173,3,91,204,5,169,209,109,69,162,197,73,104,181,90,45,86,139,84,162,218,105,69,180,201,106,167,251,111,211,169,121,126,156,0,70,47,145,78,249,128,1,79,105,109,242,218,91,120,138,202,178,62,
+59,94,94,91,94,94,91,94,94,91,94,94,91,94,94,91,64,147,237,180,182,86,91,37,89,1,111,243,151,253,192,134,219,74,233,70,87,72,91,104,22,151,25,70,92,101,25,113,148,101,198,64,1,105,95,43,229,124,175,149,242,175,25,86,
+114,177,223,32,0,182,159,180,90,84,209,238,116,88,25,34,192,201,35,50,72,204,146,198,157,156,143,154,151,18,29,89,47,100,41,195,66,66,74,161,33,197,80,147,178,134,135,253,105,44,101,89,30,209,25,30,219,72,0,45,180,182,195,105,
+109,0,10,200,95,180,95,180,95,32,95,215,127,235,128,0,2,56,74,187,165,89,0,0,174,18,174,233,86,64,1,101,167,248,138,127,213,66,78,214,116,38,200,203,68,35,71,187,34,210,57,19,23,233,24,210,45,73,179,226,244,52,44,138,
+100,146,43,166,72,115,116,36,100,98,66,66,209,38,72,178,234,52,58,79,244,134,222,87,18,29,45,36,42,69,89,10,155,74,236,138,143,204,104,84,63,210,78,72,73,250,78,38,135,253,90,76,95,74,171,89,80,226,168,107,5,67,197,232,
+135,140,41,52,145,41,81,120,200,177,105,81,100,237,69,161,195,19,178,157,76,95,197,14,140,70,84,74,221,137,27,165,104,120,145,135,59,238,82,50,201,138,226,77,32,117,52,177,163,28,13,24,210,8,198,141,6,36,104,228,121,21,223,183,
+105,92,95,164,58,93,19,253,36,105,229,26,121,70,158,81,162,113,141,19,138,246,211,34,255,9,29,244,116,230,42,66,231,165,244,190,151,155,243,232,31,250,42,255,193,91,212,147,248,79,253,35,255,25,101,11,129,181,76,94,215,233,94,126,
+221,183,61,211,80,0,0,27,115,233,64,0,0,83,243,243,195,166,29,101,220,72,70,144,235,135,93,82,29,112,235,170,67,174,29,98,27,122,211,60,139,184,142,187,175,56,96,251,163,71,56,27,238,141,42,111,62,191,215,116,195,128,0,0,
+63,138,106,96,0,0,225,251,252,12,191,162,93,41,10,95,133,105,126,16,55,164,104,248,67,2,252,255,235,168,180,44,63,146,101,72,238,44,44,101,72,238,188,235,185,206,38,233,195,175,110,110,153,181,128,0,1,185,201,137,128,0,1,225,
+175,62,174,132,105,250,157,104,253,112,235,116,138,17,245,195,173,210,40,253,112,235,189,29,54,106,46,91,136,201,11,186,61,112,235,116,191,174,29,110,151,245,195,172,67,246,187,58,103,0,0,3,92,91,74,64,0,0,195,94,11,179,163,46,
+79,221,30,184,245,130,235,21,235,2,210,204,75,197,102,105,20,36,117,155,166,47,50,69,117,153,33,117,33,101,19,67,111,224,183,241,137,14,133,164,16,169,84,41,180,100,133,75,73,10,135,25,33,37,222,70,135,207,3,66,211,248,48,107,
+157,11,77,215,65,54,22,195,148,54,22,200,221,176,165,19,218,82,56,126,156,164,93,51,107,233,32,4,54,112,235,217,31,227,130,152,47,211,147,90,76,145,147,36,100,201,102,74,183,97,31,253,255,206,31,248,247,204,8,249,70,93,132,159,
+228,255,191,252,127,236,0,26,109,226,180,0,0,3,169,80,217,0,0,0,180,83,165,204,0,0,3,70,231,96,0,0,19,93,51,35,64,0,0,54,71,61,0,0,1,9,229,198,76,83,253,187,42,17,219,34,56,205,80,142,77,5,66,154,
+217,9,30,83,209,33,41,237,67,89,254,158,100,209,50,67,129,146,49,74,134,73,37,41,80,146,80,66,73,89,15,140,160,222,82,116,58,113,148,16,154,139,20,41,180,100,133,71,210,102,133,67,178,23,59,220,151,18,121,73,64,0,0,70,
+197,39,144,0,0,45,197,133,178,59,98,128,0,3,200,164,242,47,243,148,191,162,70,95,195,116,46,194,52,46,198,70,229,112,35,197,241,58,78,84,80,4,18,139,166,39,60,72,249,48,60,174,218,110,152,242,80,4,166,162,139,182,96,126,
+146,221,137,15,217,153,26,118,17,146,255,5,38,231,250,122,92,197,59,42,20,236,168,83,178,161,78,202,133,59,42,20,236,169,123,86,102,145,153,34,194,100,139,9,146,44,38,72,176,153,34,196,209,108,135,253,79,248,255,220,1,94,54,155,
+255,26,31,241,255,184,132,191,172,173,252,49,27,137,103,213,162,88,239,145,29,102,119,204,0,188,101,232,156,164,221,83,101,47,227,148,139,254,229,250,114,254,188,227,250,121,143,251,127,199,254,226,107,61,181,186,123,96,143,114,95,145,36,127,
+227,255,112,6,209,43,117,54,217,203,169,164,180,47,219,146,180,184,237,41,20,184,200,191,111,229,251,114,242,144,142,217,214,234,156,171,42,200,1,124,214,239,218,26,81,123,43,165,83,93,85,175,221,94,65,24,203,254,61,159,242,205,211,94,
+110,154,243,116,52,99,70,52,225,215,155,135,76,216,116,228,116,236,8,223,179,35,0,0,3,38,132,148,47,224,165,23,74,235,189,175,205,121,176,171,33,27,18,245,197,39,215,210,173,122,89,39,195,11,36,243,87,41,26,31,166,205,104,76,
+114,215,155,243,100,147,225,130,146,65,9,73,160,197,155,243,68,147,235,233,249,184,36,245,165,178,255,151,241,216,192,0,11,44,63,106,112,253,161,219,16,0,17,187,150,51,144,0,11,214,170,127,213,35,254,165,208,82,80,0,15,250,67,161,
+171,127,7,147,153,93,64,0,15,57,78,95,170,204,249,227,158,57,227,158,57,227,156,8,231,235,221,181,105,211,134,111,205,89,73,172,164,150,205,249,187,97,210,169,127,164,141,40,221,179,185,13,0,0,10,240,151,47,13,121,159,60,122,246,
+71,60,115,199,60,122,246,1,28,253,115,244,252,251,21,63,132,168,83,178,161,78,27,240,66,158,255,210,117,161,107,167,103,4,45,214,224,133,253,22,47,226,110,52,253,230,178,73,115,80,145,89,230,72,176,153,34,194,100,139,19,67,254,33,
+29,83,252,51,255,56,0,15,251,127,199,254,224,0,63,63,253,44,224,71,102,232,231,142,120,231,142,205,209,206,253,63,83,251,68,255,10,151,245,193,82,66,250,72,95,73,11,233,33,125,36,47,164,130,255,80,0,0,4,117,144,0,0,63,
+195,47,240,255,220,0,1,72,165,57,60,138,108,141,50,144,35,100,105,196,208,228,82,134,76,172,230,95,179,121,127,25,255,174,0,31,242,255,159,253,191,238,63,228,255,211,36,137,214,103,99,153,28,77,205,191,194,63,229,255,50,55,55,57,
+153,76,202,103,50,57,145,206,6,230,233,14,123,115,28,121,142,60,199,30,99,143,49,151,108,87,254,243,198,114,227,34,208,228,242,45,14,79,34,208,228,242,45,14,79,34,208,228,242,56,74,239,251,255,220,127,203,254,110,110,112,153,148,204,
+166,115,35,153,28,205,205,204,191,226,63,197,47,233,177,27,156,76,166,118,57,212,239,254,52,138,127,231,135,76,218,250,102,131,22,145,215,155,166,188,192,23,249,199,249,203,93,237,127,66,212,43,170,63,231,15,41,175,237,136,208,191,102,83,
+66,253,158,217,175,237,159,250,224,69,138,64,8,155,72,165,204,141,213,255,63,251,44,138,107,57,2,75,207,110,69,39,153,185,148,155,156,228,249,49,200,164,124,127,110,104,94,91,102,178,231,151,145,192,249,206,7,206,92,242,242,151,105,72,
+164,95,167,143,237,214,27,93,13,91,141,223,243,202,238,118,187,111,151,233,202,75,34,253,184,4,197,32,45,255,127,251,127,207,254,127,246,255,183,252,127,239,255,112,0,236,99,41,118,33,200,191,111,57,23,253,192,0,191,109,206,101,250,78,
+208,1,40,189,150,144,105,162,209,160,172,242,121,65,11,34,66,67,43,136,200,222,105,66,202,103,75,139,77,177,253,183,52,150,116,93,10,68,203,200,209,233,228,148,122,121,37,30,158,73,71,167,146,81,233,228,148,121,118,75,35,137,186,104,
+113,53,38,56,26,157,152,201,162,122,17,199,182,31,226,43,155,157,140,147,180,166,133,118,70,70,233,114,68,241,56,158,38,34,151,36,25,29,21,130,17,242,56,211,141,35,78,52,141,56,210,43,162,135,70,71,69,98,145,228,112,145,178,28,
+77,144,226,108,135,19,100,56,155,33,196,217,13,209,167,38,53,104,82,232,173,252,214,78,96,3,207,169,22,74,7,237,210,77,32,0,57,41,35,168,9,38,52,57,48,0,49,72,200,246,128,0,1,138,70,71,180,0,0,12,115,53,161,76,
+3,200,228,198,128,0,107,41,200,166,160,28,155,248,224,0,76,166,82,54,0,0,1,50,153,72,216,0,0,12,148,254,25,127,132,0,0,47,248,255,132,0,0,38,95,225,0,0,0,153,127,132,232,70,72,220,230,167,161,131,67,83,208,165,
+53,162,206,71,254,116,255,9,127,141,151,37,201,78,122,75,73,61,197,113,28,242,150,91,75,137,113,47,219,207,244,253,137,219,252,54,200,69,24,197,81,140,85,24,35,33,35,41,147,37,145,208,229,20,57,67,35,147,200,248,201,228,101,252,
+115,36,254,14,68,158,151,50,127,68,2,64,0,171,66,134,150,91,173,161,217,25,3,157,255,242,79,233,66,134,150,91,173,161,217,25,0,135,248,172,197,32,0,129,177,52,216,57,178,44,213,138,70,147,144,0,59,77,9,26,97,22,108,140,
+179,44,110,148,212,0,17,209,166,128,155,38,89,178,93,50,218,70,0,8,211,41,8,50,207,108,37,3,253,56,0,0,39,9,128,0,2,13,253,73,255,132,0,0,0,0,0,0,0,1,127,140,191,230,35,147,35,254,206,226,66,75,144,221,
+13,205,35,140,13,11,19,66,100,237,36,25,86,101,148,101,55,75,27,163,157,231,100,38,145,166,153,0,0,1,164,105,166,64,0,0,41,26,17,205,128,0,1,180,216,141,91,141,223,243,202,238,118,187,111,151,233,203,254,224,17,232,101,35,
+97,122,70,68,96,208,146,18,137,194,68,135,40,161,255,94,18,138,28,170,135,252,116,36,63,219,31,248,229,119,240,203,111,245,164,242,242,57,60,187,101,31,211,151,253,192,23,254,220,191,78,0,0,9,66,64,0,0,131,127,150,60,237,4,
+44,142,41,115,62,70,74,32,104,100,166,247,37,200,232,200,233,255,47,248,255,207,254,35,254,63,243,200,167,113,28,39,182,114,116,41,254,158,221,176,64,131,32,159,242,255,191,253,255,226,0,255,153,50,21,196,129,205,46,67,70,70,228,200,
+104,101,141,192,20,244,185,26,57,19,9,20,172,179,145,195,35,144,22,156,171,212,223,179,134,92,206,159,193,36,237,231,138,118,149,200,120,222,167,101,55,98,108,152,180,78,197,50,63,217,146,29,164,104,191,193,6,75,252,20,107,73,9,138,
+226,155,154,92,134,140,141,201,144,210,236,110,0,52,215,209,82,74,110,100,114,78,194,110,63,199,67,47,219,156,123,64,41,237,56,227,253,29,19,178,70,71,251,57,33,151,244,81,98,128,209,123,50,59,93,35,253,158,210,78,194,145,31,237,
+200,230,95,199,127,232,129,149,236,73,162,19,29,76,146,217,17,172,59,86,252,76,191,162,72,95,195,99,35,153,189,204,0,3,104,59,72,187,38,191,247,254,185,127,196,0,95,243,211,248,110,117,48,5,146,168,255,195,130,21,220,187,80,203,
+27,128,0,6,38,77,57,206,64,0,5,174,84,211,32,0,0,167,165,200,199,180,242,35,0,0,39,42,173,25,127,104,197,59,42,20,236,168,83,134,36,133,60,123,16,144,255,102,200,77,102,66,254,155,23,240,88,210,40,72,95,167,66,77,
+186,80,145,116,41,146,44,38,72,177,52,63,226,19,127,79,254,191,252,255,167,252,71,252,127,233,255,193,255,127,248,128,63,231,255,96,5,251,45,187,101,184,17,213,179,116,142,245,149,119,199,60,117,63,239,159,60,117,71,187,142,54,71,199,
+203,248,160,1,93,81,223,28,239,169,243,239,25,227,170,59,223,247,175,170,59,227,156,10,231,223,184,110,216,54,119,97,210,243,205,173,245,254,111,192,252,29,136,245,221,179,134,172,248,129,176,112,170,23,1,186,61,9,139,116,51,61,219,215,
+55,77,100,132,217,187,115,116,98,56,93,172,203,43,33,196,243,53,247,37,178,63,212,173,56,68,246,62,179,214,113,76,32,156,29,143,50,65,175,185,249,139,42,233,175,55,235,33,158,58,128,0,0,0,1,243,239,125,81,222,255,155,238,124,
+216,65,55,177,243,188,205,11,201,208,166,91,109,40,32,125,174,165,221,211,103,39,238,29,27,113,28,14,23,66,226,54,188,225,145,52,14,19,150,52,222,0,22,253,179,172,160,133,54,62,119,156,166,189,202,45,144,174,133,136,196,174,178,193,
+114,125,232,232,83,45,182,148,16,62,216,27,156,153,10,144,52,103,59,81,77,255,54,183,84,218,26,57,213,161,218,70,213,103,62,137,178,7,108,121,111,0,1,190,57,227,169,247,190,172,227,84,119,199,59,254,241,247,199,60,117,0,0,2,
+57,227,170,59,223,59,239,212,55,199,60,117,63,239,159,60,117,71,120,174,125,245,223,28,224,0,43,191,85,117,71,120,0,0,89,248,74,118,214,105,11,137,4,116,65,108,142,243,126,174,232,249,28,38,91,110,132,156,218,243,125,174,208,57,
+50,27,64,211,71,62,175,5,186,180,81,13,5,114,21,186,29,94,11,200,225,119,233,58,185,0,0,14,160,11,204,95,64,249,235,112,174,130,185,10,220,43,160,174,64,150,80,184,152,237,51,72,104,73,29,243,196,15,219,99,100,124,121,235,
+228,112,153,109,185,242,228,180,196,0,2,139,214,157,84,156,138,144,52,103,59,232,167,125,58,128,18,234,166,162,103,58,88,222,226,187,148,121,67,33,93,5,110,21,200,87,65,91,133,169,220,177,167,85,117,71,60,119,191,239,31,60,119,199,
+85,121,103,212,255,154,134,232,231,221,13,224,0,11,85,116,21,200,86,225,93,5,114,21,184,87,65,92,171,148,241,135,56,183,104,182,230,232,119,230,215,29,238,159,180,159,117,141,246,187,64,228,200,109,3,77,28,234,100,112,187,245,25,191,
+55,224,63,121,191,56,0,0,234,47,59,111,142,167,161,103,127,223,62,168,231,142,241,13,226,186,10,220,43,144,174,130,183,10,228,43,160,47,226,230,215,178,243,189,172,121,146,167,27,186,23,103,129,49,107,205,208,201,11,49,150,26,238,101,
+186,173,14,103,106,166,7,152,101,192,181,158,107,205,246,63,131,93,179,24,49,107,187,54,191,205,235,63,205,118,120,33,126,107,184,27,240,182,114,223,250,200,83,245,155,33,210,27,34,197,186,187,171,194,188,0,23,238,253,118,193,158,41,13,
+217,191,55,153,206,39,175,51,230,252,223,113,247,58,17,230,187,119,12,250,177,3,112,225,86,46,3,100,122,18,22,200,107,123,183,174,190,153,137,137,53,246,235,232,132,112,187,49,150,86,99,137,235,75,238,75,50,31,234,22,156,34,123,159,
+49,230,56,182,16,110,14,135,173,160,151,220,252,229,165,119,173,63,90,90,179,239,212,7,135,118,253,89,55,233,223,13,121,184,96,178,87,98,62,181,109,156,53,103,105,103,223,171,56,25,247,234,206,2,223,175,134,236,251,231,155,166,178,66,
+110,157,185,186,49,28,46,214,101,149,146,145,60,204,181,185,44,134,95,181,167,3,106,224,83,178,102,58,177,172,89,210,55,87,42,239,227,29,250,179,239,3,126,172,251,192,3,86,125,250,128,213,159,126,160,0,207,191,86,112,51,239,213,156,
+0,55,234,207,188,13,250,179,239,2,245,189,117,103,223,168,13,89,255,55,224,255,167,108,150,75,211,175,54,190,140,188,12,145,228,218,179,254,110,172,118,153,116,177,230,104,169,165,145,210,183,87,73,239,221,211,2,108,16,152,179,116,214,100,
+157,53,246,145,230,186,13,110,125,103,26,29,85,172,135,129,196,250,94,119,165,143,91,84,227,118,98,236,215,209,31,95,76,196,196,154,201,181,230,221,189,110,170,4,171,96,74,35,152,148,91,54,25,245,98,232,71,154,236,223,155,215,152,249,
+118,114,127,14,237,249,192,207,171,126,122,95,64,47,213,191,62,160,53,111,207,170,56,231,173,215,181,90,202,88,32,178,150,177,85,59,232,6,252,250,183,129,191,62,173,248,236,213,195,102,235,181,147,67,145,235,252,222,188,207,203,179,62,175,
+205,120,1,159,86,252,250,150,159,173,43,170,144,202,9,20,38,192,245,176,110,5,152,243,24,61,207,155,163,158,236,93,8,243,93,155,243,122,243,31,119,103,131,247,126,105,206,200,251,173,156,181,126,186,20,225,250,216,116,44,182,65,159,133,
+155,133,119,87,112,0,7,255,169,115,150,47,145,35,254,215,43,41,36,84,146,216,241,31,197,24,151,240,221,127,231,12,161,206,95,189,253,183,238,192,24,143,226,151,236,203,23,202,107,9,227,127,245,95,246,164,145,196,146,63,181,21,197,255,
+106,248,199,26,226,249,22,37,251,50,196,184,227,110,175,217,172,50,135,236,248,103,95,36,253,116,127,106,0,0,127,215,252,161,64,0,91,170,24,229,28,120,151,253,95,248,107,151,235,73,11,249,165,150,114,254,31,151,249,107,136,29,80,198,
+24,219,168,191,107,25,245,70,125,66,223,229,44,75,156,186,137,29,21,242,253,105,99,199,245,96,62,49,197,241,143,237,93,11,170,60,229,213,251,111,218,129,31,218,193,96,144,234,36,174,37,213,21,117,44,75,169,241,5,251,80,176,231,126,
+174,37,206,74,255,182,80,0,22,234,47,218,228,88,186,108,36,124,103,135,21,2,245,189,68,127,106,248,151,59,226,92,239,137,117,18,195,246,182,203,23,203,62,49,206,92,229,177,209,243,150,200,236,134,201,243,239,207,14,120,99,251,50,234,
+124,159,246,188,229,137,44,113,47,226,223,252,190,109,143,224,94,5,159,245,49,217,15,7,217,15,12,139,60,49,231,253,107,245,113,254,28,20,0,0,31,183,253,166,5,129,96,88,22,5,129,96,88,22,5,129,96,88,22,5,129,96,88,22,
+5,129,96,88,22,5,129,96,88,22,5,129,96,88,22,233,110,150,233,110,144,0,11,126,158,210,27,64,0,127,220,127,19,244,239,207,20,170,0,5,255,243,0,91,90,87,2,75,100,16,22,187,240,74,161,37,80,146,8,232,73,12,137,9,
+9,31,156,147,93,178,193,242,182,9,92,0,0,23,236,193,106,127,205,62,167,252,208,45,207,249,167,212,255,154,125,194,50,77,160,11,80,1,95,219,128,43,164,125,31,209,253,43,253,32,0,0,127,74,188,208,254,17,122,19,62,142,213,106,
+181,90,173,198,211,121,198,111,59,113,0,11,127,200,12,35,128,124,35,128,0,8,254,208,71,246,128,63,63,233,242,21,229,94,64,1,15,211,164,161,147,210,41,133,248,0,5,114,218,31,144,28,132,41,90,95,251,112,0,17,253,184,0,7,
+194,252,47,194,252,45,129,96,95,183,221,45,210,0,176,142,1,240,142,0,0,35,251,65,31,218,0,95,227,149,105,133,168,88,70,152,22,16,161,96,88,61,48,44,11,2,161,96,88,22,20,192,176,44,11,10,117,150,5,129,117,223,65,127,
+233,47,160,0,11,80,95,64,5,11,244,252,171,150,187,101,128,0,2,72,32,0,58,1,100,0,0,9,63,206,84,174,95,215,0,1,254,123,228,95,199,166,66,200,2,0,128,191,206,82,0,2,221,182,216,60,135,233,202,64,0,0,143,237,
+57,192,0,1,92,128,0,0,92,239,206,33,144,21,200,10,255,12,94,213,106,181,89,218,12,237,6,118,142,133,204,92,209,104,243,63,49,122,65,170,194,173,30,98,244,143,48,96,0,31,242,12,24,48,96,193,159,72,52,25,216,85,162,192,
+11,244,47,225,2,97,86,0,11,105,86,0,48,2,239,233,7,66,64,0,0,0,0,16,237,99,208,6,143,54,106,225,126,22,103,194,204,43,164,116,142,149,255,144,2,31,194,3,140,121,1,198,60,132,63,132,7,24,241,3,140,120,136,127,
+8,0,0,29,91,64,190,64,1,15,218,232,0,16,240,182,103,205,28,207,154,222,0,0,0,16,208,0,47,106,181,90,254,97,110,103,230,47,72,53,88,85,163,204,252,209,97,86,0,8,243,87,8,96,33,132,48,125,163,104,218,63,239,180,
+176,134,2,24,67,0,0,0,0,43,251,113,31,219,139,229,126,21,150,23,225,105,22,22,192,176,182,233,112,23,206,180,182,147,171,21,4,116,189,128,0,0,24,0,95,242,0,0,0,127,233,19,85,175,255,144,0,127,200,8,254,222,216,22,
+16,145,96,88,67,2,192,176,121,96,88,22,16,192,176,44,10,69,129,96,88,22,5,129,96,88,22,228,215,45,203,184,63,16,0,0,0,0,17,209,244,38,0,10,233,29,35,165,127,164,0,21,107,53,154,246,38,38,189,172,197,163,180,24,
+154,26,85,173,165,90,204,95,242,254,144,0,1,255,120,224,88,91,2,194,24,22,5,132,48,44,11,8,96,88,22,16,192,176,44,11,2,192,176,44,11,116,183,75,116,183,72,0,7,253,240,191,8,126,223,2,194,216,22,22,192,176,182,5,
+133,176,44,45,129,97,108,11,11,116,62,135,251,96,95,211,116,60,77,97,71,164,19,248,174,135,137,172,40,244,143,241,128,118,65,102,35,254,145,31,240,162,206,196,198,148,100,100,98,58,17,178,53,14,141,70,8,212,58,53,25,26,135,70,
+163,65,43,50,153,76,191,229,255,19,44,143,35,17,103,104,201,10,76,143,36,41,0,3,178,4,209,52,116,209,52,116,209,34,154,35,178,8,183,244,230,127,211,5,78,99,130,246,139,118,166,139,254,18,200,203,246,118,146,24,66,100,37,116,
+138,49,218,226,110,115,121,131,189,175,151,52,103,46,216,255,90,31,214,203,250,68,101,255,19,190,235,238,188,243,108,182,106,29,168,111,217,195,87,240,73,172,132,109,4,170,91,102,106,157,58,84,233,109,155,182,101,195,175,133,168,117,233,67,
+138,30,29,112,67,131,18,28,81,142,173,253,125,90,255,109,34,58,88,233,133,186,240,35,6,12,77,191,174,165,253,125,11,250,40,33,156,87,56,130,127,72,53,90,29,150,252,248,175,231,226,223,179,118,191,254,69,254,23,253,87,234,31,183,
+153,249,251,95,155,157,255,85,250,143,249,55,244,255,226,127,155,252,215,115,221,166,79,166,87,62,87,104,255,155,252,215,115,255,136,191,228,33,252,39,111,224,146,31,240,201,27,182,134,133,216,87,115,35,167,162,21,16,127,203,254,63,243,255,
+143,252,127,230,142,100,146,48,0,0,39,135,79,205,245,235,118,36,35,118,36,35,38,116,35,38,116,35,38,36,115,38,36,115,38,36,35,118,36,35,124,223,155,238,240,18,254,17,146,255,4,57,232,90,63,248,109,252,39,254,16,38,38,38,
+130,146,146,193,73,73,96,100,100,112,66,66,71,254,20,152,150,7,67,73,104,255,211,35,230,231,47,72,27,65,137,144,253,36,196,158,146,107,26,30,76,255,195,103,254,18,63,240,144,63,162,67,209,4,63,165,182,170,20,65,78,180,74,155,
+67,254,159,182,253,184,143,96,3,254,99,22,86,200,0,0,5,180,164,87,48,47,251,255,92,164,223,193,147,31,240,238,95,224,162,223,35,203,146,49,75,25,203,20,55,67,115,71,52,14,166,234,98,11,5,142,78,147,15,252,83,10,23,248,
+40,14,250,47,241,36,1,127,148,5,255,8,166,45,206,83,218,93,164,159,209,67,255,24,95,240,130,255,44,185,45,49,14,149,200,140,71,248,34,31,229,16,94,75,12,104,72,164,166,74,230,175,67,101,129,232,178,126,202,33,27,254,205,248,
+127,190,61,188,33,113,126,126,6,89,167,154,23,126,166,6,254,16,56,44,14,39,11,181,167,251,129,127,88,203,251,47,252,152,34,162,136,225,185,82,125,103,215,110,57,173,199,52,13,206,61,111,215,30,15,192,181,230,254,54,103,215,154,26,
+243,107,142,179,205,221,108,221,192,11,102,238,205,28,215,224,203,205,211,112,0,0,55,230,111,205,55,78,114,238,143,92,58,195,245,195,172,63,92,58,196,52,86,233,249,189,118,200,227,44,105,124,128,0,0,82,63,219,28,140,191,134,232,93,
+146,52,46,194,148,255,171,202,238,74,120,190,39,67,149,22,27,64,19,86,196,223,108,90,226,62,76,121,93,180,221,56,237,156,63,142,5,22,118,253,56,35,201,128,236,72,126,204,200,211,176,140,167,252,20,89,127,22,114,44,127,108,100,151,
+154,127,7,105,255,29,139,250,237,34,254,59,23,245,212,105,142,152,146,65,3,161,186,24,115,147,156,156,228,231,40,75,25,203,20,93,49,208,191,198,19,252,32,255,206,123,99,41,237,47,211,159,237,125,63,199,122,23,240,80,150,38,70,91,
+73,163,41,152,115,121,76,212,242,144,0,10,154,70,231,148,205,83,74,8,29,80,85,42,98,253,159,175,225,215,198,7,5,129,191,132,12,191,93,11,184,31,8,92,93,121,161,113,117,198,226,235,159,77,152,108,204,92,9,21,22,63,201,135,
+247,159,252,37,50,226,92,65,76,184,151,18,233,62,156,122,113,253,97,106,47,214,22,162,220,91,139,81,110,124,218,233,155,90,244,92,221,217,181,230,159,135,118,109,121,167,154,6,252,11,171,187,54,186,25,108,134,199,217,13,143,178,27,31,
+103,237,191,87,255,111,251,79,255,253,121,139,172,252,30,113,152,17,235,169,196,223,129,235,126,16,225,198,28,63,109,195,174,25,187,173,117,110,173,213,186,28,53,149,208,225,225,116,48,167,135,118,37,178,27,12,182,67,97,30,232,108,125,133,
+229,250,191,251,127,219,143,255,231,251,153,173,58,225,214,73,178,29,111,215,14,183,235,45,222,19,148,251,151,245,58,243,119,126,231,94,110,236,198,70,71,14,152,108,221,250,221,197,35,78,199,54,236,155,35,27,180,118,110,7,109,232,72,101,
+252,22,253,159,233,63,131,39,254,9,72,180,55,99,147,238,216,14,223,159,72,127,69,15,164,179,75,9,96,185,247,234,207,187,62,253,91,53,103,223,171,134,172,251,247,111,213,159,126,205,250,179,240,207,191,86,126,27,55,112,217,187,134,205,
+250,179,239,217,191,86,126,25,247,234,207,187,62,253,91,53,103,223,171,134,172,251,247,111,213,159,126,238,27,55,112,217,187,134,172,251,245,112,213,159,126,237,250,179,239,217,191,86,126,25,247,234,207,187,62,253,91,53,103,223,169,115,46,181,
+194,157,42,108,5,230,0,244,46,168,162,185,192,194,59,11,43,156,12,35,165,110,22,80,0,9,232,140,96,58,57,128,14,40,2,57,129,100,1,1,41,127,6,68,150,89,76,193,26,213,41,20,54,56,74,97,34,133,35,253,154,176,188,235,
+139,11,206,184,180,114,154,183,56,138,64,222,83,59,210,178,153,185,197,43,41,158,147,71,147,62,45,121,215,22,115,88,27,165,31,22,38,56,45,26,243,230,67,37,137,177,212,216,234,108,117,54,188,192,209,11,246,174,104,181,52,90,154,57,
+196,212,152,226,138,108,112,52,116,137,151,109,77,129,212,216,29,77,129,212,216,144,191,107,73,26,94,107,122,94,107,122,11,205,97,204,135,68,90,202,104,231,9,68,226,130,7,20,129,197,35,217,205,51,174,32,235,37,55,53,130,58,81,229,
+51,38,56,73,78,28,202,156,209,64,128,32,64,61,20,187,98,135,105,78,7,9,41,185,194,75,3,132,146,7,20,129,193,187,30,141,121,215,20,174,45,121,181,177,54,182,38,197,251,125,9,44,168,117,84,189,64,3,248,237,41,219,19,174,
+48,83,117,55,162,65,76,141,161,37,58,201,78,178,111,217,181,230,213,83,107,98,109,108,104,214,198,136,214,198,159,210,147,79,250,115,95,240,176,3,252,109,255,31,242,211,170,205,148,250,159,181,178,157,187,69,213,211,43,159,179,68,56,246,
+181,230,0,3,254,160,45,233,60,99,115,36,214,215,36,214,215,37,230,135,83,100,59,92,200,118,185,144,237,115,94,97,144,191,138,70,139,83,105,173,77,22,166,139,116,77,52,56,246,177,199,38,78,100,188,224,129,2,12,128,230,82,237,132,
+150,226,56,75,19,35,134,213,115,140,160,113,72,28,82,23,21,223,194,156,20,221,97,68,133,196,109,12,78,219,86,235,75,27,163,183,19,230,187,138,65,6,65,2,0,63,196,183,90,78,98,232,36,78,9,27,159,33,147,153,122,92,180,107,
+99,68,107,99,68,104,245,81,45,213,5,55,88,81,33,206,199,206,0,107,232,140,113,198,146,70,55,253,173,36,151,63,81,99,116,118,227,116,118,227,116,118,227,93,183,11,163,233,151,24,41,146,198,136,75,19,98,91,214,245,189,111,82,255,
+59,0,0,10,56,254,159,69,227,250,125,0,0,15,233,109,105,114,253,169,47,29,186,0,0,255,191,241,97,46,95,213,227,38,228,177,94,50,0,126,221,151,108,85,159,26,255,22,12,116,253,169,47,22,58,99,5,226,212,170,205,214,114,210,
+78,179,106,99,21,155,82,171,48,0,255,186,223,213,102,166,49,89,157,49,140,210,152,197,102,116,91,77,41,61,63,78,199,58,99,105,157,22,211,74,45,150,116,90,206,139,89,210,249,148,219,248,229,58,45,103,69,172,232,181,74,45,149,40,
+182,82,90,204,230,223,199,52,162,217,75,27,76,54,54,83,190,120,213,175,234,171,95,213,86,191,27,218,245,5,38,254,57,53,253,85,59,211,27,40,59,211,27,40,49,122,99,101,6,47,75,212,98,42,96,94,151,168,1,111,48,5,233,213,
+250,69,64,0,0,126,159,202,84,10,74,74,74,234,74,74,75,15,226,186,127,25,209,187,32,126,144,254,43,167,241,157,27,178,7,233,15,226,186,127,25,209,187,32,126,159,245,10,74,75,21,37,37,127,234,191,237,164,175,219,162,191,49,146,
+191,245,95,246,210,87,237,209,95,152,201,95,250,175,251,105,43,246,232,175,204,100,175,205,207,42,0,0,189,43,119,55,241,157,63,140,232,221,144,63,65,255,31,249,255,199,254,223,182,146,191,110,138,252,198,75,122,191,240,85,255,134,106,95,
+193,209,91,248,36,199,254,53,255,12,20,226,165,68,138,145,180,86,245,169,254,145,57,139,244,230,0,0,65,63,73,255,85,130,71,168,191,103,15,222,150,69,251,222,123,36,63,122,89,23,238,252,149,241,143,237,107,213,110,171,99,21,135,81,
+43,254,212,183,167,30,167,206,89,23,131,231,36,127,212,150,119,253,73,103,240,47,214,146,126,181,60,151,201,99,136,253,171,229,28,118,18,69,118,100,93,68,133,140,113,2,191,229,143,57,99,12,249,41,33,108,44,249,22,120,126,183,245,37,
+152,188,33,152,184,114,240,142,91,255,79,255,80,0,0,126,214,41,15,218,236,255,25,127,183,253,49,253,201,126,165,255,91,252,228,227,253,80,47,234,183,80,0,0
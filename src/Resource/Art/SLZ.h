@@ -0,0 +1,238 @@
+131,106,128,3,0,20,5,37,16,54,38,69,18,86,46,102,48,116,4,129,4,3,22,42,39,110,56,242,120,237,130,6,49,23,107,131,4,2,21,17,39,106,56,230,120,235,132,7,114,133,7,108,134,5,20,23,112,135,5,22,23,109,136,7,
+103,24,240,137,4,7,22,39,39,113,56,238,120,234,138,6,43,23,116,139,6,52,24,231,140,7,111,141,7,102,142,6,47,143,4,6,22,50,40,236,255,68,68,68,68,194,137,117,29,37,73,210,106,78,73,10,78,70,139,73,200,236,130,147,
+145,216,210,147,145,216,201,39,35,177,146,78,71,99,32,215,56,35,177,144,107,157,78,198,65,131,76,240,177,144,96,211,60,198,65,131,76,243,25,6,13,51,204,106,193,166,121,140,19,6,64,96,149,164,80,48,74,210,40,24,36,40,24,36,
+40,24,36,41,18,20,136,95,118,45,118,180,235,230,152,142,252,26,69,174,232,162,34,34,36,136,239,193,164,90,212,239,15,209,235,72,86,149,165,114,173,107,149,106,114,175,76,247,103,190,79,123,76,247,182,120,61,237,157,115,11,219,58,226,
+87,182,120,21,237,158,99,202,94,22,90,222,210,43,218,103,189,142,15,126,80,123,218,103,189,179,193,239,108,243,94,217,228,207,115,233,92,141,107,149,107,92,171,74,210,180,101,174,127,5,53,48,210,60,246,105,157,115,162,34,34,34,36,206,
+185,230,60,246,105,140,52,57,235,223,152,243,222,136,136,136,136,136,136,136,135,137,114,217,70,76,40,233,42,78,147,82,114,72,82,114,52,90,78,71,100,20,156,142,198,148,156,142,198,72,28,22,59,57,91,171,168,117,255,133,127,174,118,254,
+140,63,135,99,33,221,7,253,249,144,107,157,123,8,48,105,158,106,131,6,153,230,48,87,213,249,236,183,245,117,117,246,255,223,183,175,171,255,233,255,244,237,78,191,254,117,117,117,246,255,223,183,175,171,253,232,63,158,144,220,146,44,55,229,
+249,234,175,255,72,254,202,255,14,30,83,126,158,85,92,72,136,136,136,152,30,37,203,101,25,48,163,164,169,58,77,73,201,33,73,200,209,105,57,29,144,82,114,59,26,82,114,59,25,36,228,118,50,73,200,236,100,26,231,4,118,50,13,115,
+169,216,200,48,105,158,22,50,12,26,103,152,200,48,105,158,99,32,193,166,121,141,88,52,207,49,130,96,200,12,18,178,3,4,173,34,129,130,66,129,130,66,129,130,66,145,33,72,148,142,248,20,26,69,173,119,246,126,113,183,245,117,117,246,
+255,223,183,175,171,255,234,223,199,97,156,126,248,53,198,28,126,248,24,254,79,95,252,135,251,215,251,208,143,25,87,42,214,185,86,167,42,244,207,118,123,228,247,180,207,123,103,131,222,217,230,189,179,201,135,234,22,255,231,159,251,191,255,213,
+213,215,219,255,126,222,190,175,255,255,29,151,247,195,56,107,152,126,248,56,63,228,131,29,127,194,5,143,239,241,43,199,239,138,252,184,139,219,61,149,239,108,240,123,219,60,30,246,207,53,237,158,76,247,62,149,200,214,185,86,181,202,181,173,
+127,81,250,44,246,255,120,255,247,255,250,186,186,251,127,239,219,215,213,255,245,111,227,176,206,63,124,26,227,14,63,124,12,127,39,175,18,31,194,23,150,63,223,188,191,125,108,237,120,226,185,218,247,150,118,189,229,157,175,121,103,107,238,118,
+149,122,60,213,169,194,181,174,21,173,107,108,255,162,253,64,255,127,255,191,255,213,213,215,219,255,126,222,190,175,255,255,29,151,247,195,56,107,152,126,248,56,63,228,131,29,127,242,255,120,254,242,241,140,171,186,181,174,6,181,205,159,74,229,
+126,123,154,247,150,118,189,229,157,175,121,103,107,225,250,128,208,254,125,235,254,227,255,255,87,87,95,111,253,251,122,250,191,254,173,252,118,25,199,239,67,92,97,199,239,65,143,228,245,255,200,127,189,127,189,8,241,149,114,173,107,149,106,114,
+175,76,247,103,190,79,123,76,247,182,120,61,237,158,107,219,60,152,126,161,111,254,121,255,187,255,253,93,93,125,191,247,237,235,234,255,255,241,217,127,122,51,134,185,135,239,67,131,254,72,49,215,252,32,88,254,255,18,188,126,248,175,203,136,
+189,179,217,94,246,207,7,189,179,193,239,108,243,94,217,228,207,115,233,92,141,107,149,107,92,171,90,215,245,31,162,207,111,247,143,255,127,255,171,171,175,183,254,253,189,125,95,255,86,254,59,12,227,247,161,174,48,227,247,160,199,242,122,241,
+33,252,33,121,99,253,251,203,247,214,206,215,142,43,157,175,121,103,107,222,89,218,247,150,118,190,231,105,87,163,205,90,156,43,90,225,90,214,182,207,250,47,212,15,247,255,251,255,253,93,93,125,191,247,237,235,234,255,255,241,217,127,122,51,
+134,185,135,239,67,131,254,72,49,215,255,47,247,143,239,47,24,202,187,171,90,224,107,92,217,244,174,87,231,185,175,121,103,107,222,89,218,247,150,118,190,31,168,13,15,231,222,191,238,63,255,245,117,117,246,255,223,183,175,171,255,255,254,159,
+87,21,173,107,149,107,92,171,83,149,122,103,187,61,242,123,218,103,189,179,193,239,108,240,123,219,58,214,247,176,253,65,95,253,251,216,255,156,195,250,63,255,86,254,59,12,227,247,97,174,48,227,247,96,199,242,122,255,249,213,213,215,219,255,
+126,222,191,228,233,157,255,127,137,94,63,124,87,229,196,94,217,236,175,123,103,131,222,217,224,247,182,121,175,108,242,103,185,244,174,70,181,202,181,174,85,173,107,250,143,209,103,183,251,199,255,187,127,255,252,118,95,221,140,225,174,97,251,176,
+224,255,146,12,117,255,243,171,171,175,183,254,253,189,111,159,79,228,139,203,31,239,222,95,190,182,118,188,113,92,237,123,203,59,94,242,206,215,188,179,181,247,59,74,189,30,106,212,225,90,215,10,214,181,182,127,209,126,160,127,191,255,221,191,
+255,86,254,59,12,227,247,97,174,48,227,247,96,199,242,122,255,249,213,213,215,219,255,126,222,190,175,255,255,251,142,169,214,181,174,21,173,112,53,174,108,250,87,43,243,220,215,188,179,181,239,44,237,123,203,59,94,235,250,128,215,189,127,223,
+188,191,156,109,127,244,71,255,219,248,236,191,187,25,195,92,195,247,97,193,255,36,24,235,255,231,87,87,95,111,253,251,122,243,211,63,240,82,238,147,116,149,112,174,28,206,191,206,55,254,241,211,253,253,93,93,125,191,247,237,235,62,119,224,
+231,90,227,217,157,122,120,100,43,155,59,87,118,126,174,222,223,255,245,117,117,246,255,223,183,175,250,57,221,45,158,236,188,38,207,217,158,15,142,108,179,238,142,61,149,41,99,153,135,150,181,255,252,63,143,149,135,239,82,167,31,189,135,242,
+122,196,117,254,119,20,68,68,68,68,135,132,157,109,47,206,162,36,49,59,126,116,91,57,229,34,189,179,205,137,94,217,230,204,47,108,237,72,61,246,190,211,102,188,102,187,53,179,217,199,42,105,140,154,234,238,174,106,114,174,86,217,120,174,
+25,134,203,230,182,107,139,76,252,137,244,198,236,214,153,241,25,161,88,125,114,174,51,87,117,105,49,105,156,134,123,61,179,93,152,99,164,218,235,108,240,139,222,215,61,249,73,239,99,145,94,223,202,5,155,174,87,153,73,176,214,82,138,34,
+34,34,93,121,148,155,13,101,252,239,206,222,200,200,200,223,190,149,230,82,108,53,151,239,239,252,237,232,137,255,228,68,242,68,68,68,73,188,145,17,17,18,111,247,21,217,174,205,118,104,126,250,107,204,164,216,107,41,69,17,17,17,46,242,
+44,216,220,216,107,41,70,108,121,151,27,177,187,28,58,209,19,173,17,51,98,10,102,195,89,74,55,115,34,36,163,175,243,184,162,75,36,155,248,40,63,199,166,119,189,183,236,222,151,61,218,166,242,135,241,215,250,35,252,127,167,229,179,18,
+19,221,61,218,165,229,55,241,225,253,21,255,24,238,240,208,118,36,187,18,94,73,55,244,215,253,86,186,143,42,79,53,39,154,147,130,90,78,8,197,39,4,118,164,224,142,199,56,35,177,147,130,59,25,56,35,177,147,177,29,140,157,129,216,
+201,216,53,140,157,131,3,39,96,192,201,216,48,48,236,24,24,38,12,12,18,176,48,74,192,193,2,83,5,49,130,17,129,2,152,129,75,28,215,213,6,12,12,18,176,48,64,152,24,32,74,96,129,41,130,5,49,2,152,146,51,69,17,17,
+72,239,193,164,90,215,187,163,214,152,81,46,163,164,169,58,81,169,179,150,204,214,73,200,236,100,232,228,118,50,118,66,59,25,59,32,217,200,177,218,120,164,41,57,26,45,39,35,178,10,78,71,99,78,91,51,91,49,114,173,44,100,236,25,
+1,147,176,96,104,78,193,129,160,118,12,12,18,48,96,98,40,24,24,138,6,6,34,144,49,20,129,136,164,163,133,230,80,32,216,107,40,99,249,220,77,73,24,48,48,72,172,12,18,69,129,136,164,12,69,32,98,41,40,162,222,122,160,216,
+107,42,251,186,58,34,34,77,255,110,239,219,126,253,17,38,255,183,87,87,55,237,191,106,147,127,219,171,171,175,183,246,255,180,253,175,237,186,186,186,251,127,239,219,205,251,223,219,247,117,246,255,223,183,175,171,247,255,189,230,242,255,191,111,
+95,87,255,211,247,255,180,253,215,151,95,87,255,211,255,233,229,221,229,221,255,244,255,250,118,167,55,239,191,123,55,255,211,181,58,198,160,74,80,196,245,249,77,218,157,125,98,243,41,54,26,202,81,151,95,48,212,151,94,101,38,195,89,76,
+87,115,34,34,11,204,164,216,107,47,231,126,118,249,191,254,157,169,215,204,53,77,143,248,102,237,78,178,95,225,136,162,36,186,198,160,90,238,214,82,138,36,213,255,165,17,17,19,10,97,68,76,41,46,15,53,56,194,156,87,132,234,67,131,
+126,155,98,34,38,20,151,7,154,156,102,167,25,169,198,20,226,188,39,82,167,17,19,226,10,171,58,145,237,49,19,181,69,79,202,227,191,242,150,28,39,82,167,17,19,226,10,171,58,145,237,49,19,181,81,170,199,23,61,166,83,177,237,50,
+157,143,105,148,237,106,137,242,7,23,101,98,157,134,65,242,12,166,202,194,165,200,26,149,191,81,198,188,41,46,15,53,56,194,156,87,132,234,84,226,34,124,65,85,110,32,170,183,16,85,89,212,143,105,136,157,170,141,86,56,185,237,50,157,
+173,81,62,64,226,236,173,203,110,98,252,165,98,39,106,163,85,142,46,123,76,167,107,84,79,144,56,187,43,20,236,50,15,144,101,55,200,50,155,228,25,77,149,133,75,144,53,38,83,17,90,129,64,212,134,181,136,45,101,95,134,135,249,219,
+206,46,202,197,59,12,131,228,25,77,149,133,75,144,53,38,83,17,90,129,41,10,129,41,10,129,41,26,144,205,137,8,130,101,37,33,172,132,86,32,145,22,51,68,20,9,74,81,76,47,50,147,97,172,161,190,155,55,183,231,51,113,5,85,
+157,72,246,152,137,218,168,213,99,139,152,177,148,237,180,201,242,21,19,178,183,71,59,255,59,136,168,18,145,169,8,172,65,64,148,165,21,188,227,51,97,172,191,93,84,87,32,106,76,166,34,181,2,82,53,33,21,136,40,18,148,163,119,248,
+199,92,215,153,73,176,214,82,138,32,236,223,155,166,130,39,106,163,85,142,46,123,76,167,107,84,79,144,56,187,43,16,118,25,7,163,6,83,122,48,101,55,163,6,83,101,97,82,228,13,73,148,196,86,160,74,70,164,34,177,5,11,255,59,
+137,205,144,53,38,83,17,90,129,41,26,144,138,198,68,184,200,134,37,49,2,148,100,72,137,53,230,82,108,53,148,34,164,34,63,134,184,148,197,142,26,202,81,68,154,190,63,191,253,178,245,117,117,246,255,223,183,175,171,255,233,255,244,237,
+72,255,103,167,245,151,251,60,58,191,167,91,255,132,191,207,219,111,241,18,127,152,127,166,157,95,227,175,183,254,255,226,63,244,151,251,223,15,247,166,95,209,74,191,247,215,213,255,244,255,250,118,245,34,127,152,127,166,157,95,211,15,253,24,
+255,83,242,168,137,252,104,127,39,244,221,92,195,143,237,191,43,175,250,59,127,167,87,246,99,253,249,238,255,251,35,126,243,247,191,183,237,253,191,55,151,119,55,239,251,166,255,251,67,249,31,167,68,68,253,52,184,255,27,171,244,223,207,68,
+68,68,254,52,10,111,211,31,240,214,223,193,137,255,30,162,254,14,215,254,29,77,252,152,143,231,207,252,131,252,247,86,165,227,187,152,126,159,200,183,126,220,245,121,91,143,54,63,158,207,252,25,255,108,191,217,224,191,217,230,89,252,185,191,
+111,219,251,127,217,115,39,11,167,253,178,255,103,130,255,103,153,103,242,230,253,167,237,81,19,133,211,254,154,31,201,253,50,255,103,248,221,136,136,136,159,166,151,235,63,85,56,255,26,222,100,34,173,134,178,148,81,38,44,58,255,135,155,27,
+155,13,101,40,162,33,224,127,227,82,214,53,46,178,82,88,162,77,143,111,146,110,254,28,58,229,169,19,119,243,161,252,253,201,252,29,87,127,142,31,195,76,223,158,254,12,63,255,146,118,127,5,55,127,14,29,127,184,211,245,29,220,223,191,
+238,201,127,126,191,191,90,166,201,124,150,51,85,63,79,222,249,126,223,155,203,187,155,247,253,217,47,239,215,247,235,84,217,16,253,149,75,253,59,162,136,183,153,73,176,214,80,33,21,170,51,85,253,57,191,167,116,101,121,148,155,13,101,250,
+204,191,56,219,181,47,233,247,71,119,233,234,213,187,111,29,85,118,113,139,47,100,246,240,221,225,253,158,4,191,201,61,75,61,183,106,7,250,125,209,221,250,115,125,91,172,56,254,151,145,195,177,119,65,138,27,151,84,12,22,108,117,65,151,
+82,235,37,44,199,175,245,26,14,206,37,146,246,58,246,43,85,14,197,221,8,195,119,240,225,63,234,184,211,7,253,52,221,223,166,95,236,210,43,221,86,165,125,187,191,135,250,79,210,162,39,11,167,225,55,119,9,187,184,126,83,242,187,244,
+215,29,223,167,159,86,236,184,234,94,206,61,139,217,14,197,221,12,191,56,223,190,181,90,149,246,238,136,171,244,245,106,221,180,231,213,85,178,159,72,154,229,139,232,95,183,240,172,209,18,238,19,112,120,112,112,227,131,135,82,224,223,166,5,
+55,7,135,7,14,56,56,117,39,14,177,55,88,213,97,26,182,153,85,182,162,223,249,223,221,62,165,169,75,52,84,213,177,17,134,190,101,140,9,19,19,253,245,75,146,229,82,229,53,75,148,86,165,33,21,168,68,70,81,17,148,80,145,18,
+87,153,73,176,215,31,14,121,243,98,250,70,171,101,139,233,19,92,177,125,11,37,203,23,92,151,42,151,41,170,92,179,126,113,191,93,182,168,171,158,218,162,10,173,181,22,145,171,105,226,250,70,171,101,139,233,19,92,177,125,11,243,191,158,
+171,23,88,173,66,34,50,136,140,163,11,204,148,149,176,214,80,196,255,59,249,234,151,37,202,165,202,106,151,40,173,74,66,42,107,17,16,112,136,143,242,122,111,68,68,68,74,53,54,114,44,108,232,142,71,99,39,68,68,177,227,191,159,62,
+40,140,129,129,130,68,44,11,111,132,245,239,68,75,168,232,137,42,78,136,147,82,116,36,70,166,206,91,51,91,50,35,145,216,201,217,17,16,241,223,207,159,27,240,36,192,131,3,17,68,65,143,231,43,231,59,214,198,78,200,136,14,198,78,
+200,25,11,74,243,158,107,205,129,160,142,17,187,89,73,160,98,55,153,77,205,158,125,251,55,181,232,139,73,208,142,200,41,58,17,216,197,26,155,57,22,40,152,81,18,234,58,10,53,54,114,217,154,147,145,165,140,157,28,142,198,133,57,33,
+216,201,219,30,24,215,76,172,100,236,129,144,25,59,32,96,104,79,115,213,154,253,119,107,35,17,13,133,230,72,9,9,37,159,31,207,84,138,236,129,129,130,70,12,128,196,112,43,243,84,188,200,144,136,41,181,148,155,11,207,172,191,244,137,
+133,18,234,60,168,232,232,147,82,116,40,82,116,35,90,78,72,118,252,174,59,255,41,191,144,59,25,58,48,59,26,19,176,107,26,19,176,96,120,99,203,243,218,247,233,71,129,216,213,200,224,243,88,200,57,29,160,229,3,39,83,177,192,142,
+202,78,214,217,167,45,142,27,3,39,96,208,121,26,176,105,154,99,4,172,13,1,43,3,129,74,33,144,24,138,64,196,82,6,130,41,40,225,25,163,172,164,216,94,101,55,248,235,223,179,178,247,20,122,212,236,180,122,238,163,214,14,234,229,
+71,5,42,79,117,31,19,240,219,158,243,39,12,24,88,201,224,194,198,78,202,106,100,236,167,105,152,129,216,201,195,144,53,46,43,99,4,164,14,198,41,57,64,197,3,145,218,15,3,178,210,114,149,39,35,77,156,139,29,183,226,118,56,52,
+196,236,182,50,120,49,193,131,41,59,76,79,6,6,172,26,20,13,125,88,134,152,177,37,59,141,98,101,8,192,208,70,81,145,230,252,245,74,202,192,230,105,136,50,157,198,177,96,107,25,70,7,13,70,75,253,59,137,38,141,218,202,77,133,
+231,214,95,250,68,68,187,132,169,60,56,56,127,210,227,179,126,110,81,7,96,98,114,7,180,248,196,197,184,113,42,150,156,74,110,19,215,42,78,126,31,167,252,241,56,101,96,101,59,43,3,139,228,44,12,19,134,59,3,4,224,143,109,69,
+57,24,176,50,156,140,88,29,39,44,78,203,78,36,118,90,113,35,135,9,202,84,158,234,62,20,106,126,87,148,113,114,7,96,113,7,96,100,224,236,12,156,29,129,147,134,176,50,112,202,100,225,148,201,195,43,19,134,25,7,12,25,76,52,
+198,25,88,28,204,13,72,48,57,154,81,83,88,135,7,249,236,213,56,101,104,50,178,155,43,41,174,74,106,208,53,40,26,196,84,34,10,90,141,99,40,202,43,17,24,107,140,205,133,231,215,204,57,148,177,41,139,52,163,121,146,34,36,43,
+255,74,34,77,255,110,174,161,171,248,223,165,68,68,75,184,67,244,211,195,244,217,93,194,31,166,159,244,221,92,65,113,26,143,155,117,188,191,78,124,191,69,249,205,156,169,252,152,247,70,167,213,80,177,110,253,61,67,110,226,219,80,139,213,
+170,113,175,119,234,18,238,19,112,157,120,119,112,238,5,220,34,115,136,213,106,47,77,124,3,135,4,125,209,59,79,26,172,165,86,218,136,197,129,130,61,181,69,237,84,103,106,109,252,175,62,193,86,218,129,237,168,70,213,8,206,122,167,200,
+184,228,174,50,95,223,174,75,249,90,50,229,23,25,44,249,47,239,215,41,178,90,178,129,202,165,33,82,196,126,182,189,51,243,158,211,5,61,129,197,195,84,83,134,17,113,146,206,25,114,25,43,43,46,66,166,92,133,76,185,41,171,45,74,
+202,112,101,53,136,169,117,28,35,54,168,94,122,206,12,181,41,41,194,53,46,169,136,20,35,140,218,140,166,255,31,250,183,165,212,116,68,68,106,108,228,88,237,68,68,68,76,231,155,125,124,248,224,88,18,96,72,137,156,243,111,175,156,208,
+17,216,201,209,25,17,51,227,191,159,62,55,164,162,138,192,209,76,146,236,74,222,19,215,190,136,137,42,58,34,34,74,142,43,68,185,230,163,169,163,108,229,179,55,231,137,17,43,59,26,19,178,32,199,127,62,124,127,59,116,110,50,73,136,
+98,76,13,98,136,51,111,175,156,255,60,135,99,66,118,12,137,100,50,12,24,105,95,134,107,234,72,70,99,68,133,230,82,105,162,53,150,119,173,169,179,126,105,58,20,40,234,118,73,157,10,20,117,56,83,42,126,80,145,17,19,10,32,166,
+84,228,92,160,232,80,163,169,218,103,129,148,10,208,117,57,60,13,119,242,182,254,91,43,116,72,48,101,50,145,171,166,12,24,24,211,63,231,117,198,31,195,149,230,66,42,216,107,41,69,4,110,211,63,231,170,131,162,64,193,6,13,51,164,
+163,49,195,31,207,26,146,32,36,73,175,50,147,97,172,191,147,209,174,163,164,168,232,243,81,209,202,20,120,53,54,99,191,53,179,35,145,216,208,157,136,236,104,78,192,236,104,78,203,200,177,218,120,146,210,114,67,176,164,228,107,73,88,196,
+228,118,87,145,144,114,59,26,239,229,109,154,126,85,212,157,160,114,101,39,96,200,12,157,131,32,48,236,26,102,12,42,140,181,64,228,200,98,42,200,177,152,210,227,17,73,69,37,27,204,164,216,107,40,86,253,39,106,74,142,143,53,39,40,
+81,209,200,214,147,148,40,240,59,10,101,77,156,137,48,165,212,121,82,234,9,229,57,66,147,144,224,194,188,120,9,200,212,231,37,177,148,14,208,114,59,3,39,40,25,64,236,100,29,142,208,118,24,254,155,26,232,202,118,50,82,59,65,218,
+6,78,167,99,37,97,104,59,64,202,102,50,14,193,134,206,1,175,60,85,129,204,211,20,199,51,76,64,148,193,2,83,129,74,48,175,57,230,252,245,68,240,96,106,193,160,237,49,134,86,7,51,76,65,148,193,76,112,43,207,18,82,152,165,
+25,18,21,197,53,230,82,108,53,151,242,122,58,38,20,186,143,42,60,168,225,225,71,14,80,166,84,216,137,133,46,163,202,143,42,56,117,224,225,202,14,28,150,142,28,129,209,195,144,59,56,114,7,99,14,64,236,100,228,14,198,64,129,216,
+200,56,59,25,7,27,239,125,60,53,150,185,137,89,98,8,239,17,148,84,214,42,107,21,48,197,3,132,65,140,160,97,149,129,134,86,6,25,88,56,101,96,225,149,131,130,86,14,8,195,7,4,118,205,84,245,242,136,53,107,153,88,24,101,
+103,57,153,224,193,156,16,96,206,8,216,50,145,140,167,35,181,3,130,59,24,112,71,101,32,71,96,100,228,118,6,78,13,76,156,56,177,147,135,165,140,156,61,6,252,205,195,127,73,185,129,130,152,208,16,41,181,77,20,186,183,203,134,75,
+195,186,110,19,221,193,17,17,19,10,75,131,205,65,60,41,197,120,56,120,211,184,170,166,92,54,107,149,39,135,7,14,56,119,21,3,135,137,247,16,59,79,26,172,35,86,218,186,98,116,181,12,57,3,218,117,149,86,6,64,197,170,33,77,
+166,8,56,170,51,177,130,15,144,140,236,172,86,190,213,99,191,144,156,17,142,32,140,88,60,79,105,185,3,176,56,213,96,100,12,90,162,15,180,193,78,214,82,154,198,65,195,3,32,225,148,131,134,86,15,146,176,118,131,3,104,48,56,100,
+13,127,43,56,63,207,2,15,146,148,236,185,56,101,101,201,89,77,114,21,43,41,169,50,154,144,101,53,32,202,99,82,152,32,66,160,64,166,213,52,86,243,213,6,82,155,89,126,122,161,168,48,53,32,192,212,129,3,82,4,13,72,20,218,
+166,140,163,117,127,233,68,68,68,255,183,253,145,17,17,127,140,212,111,236,211,251,244,68,75,184,15,219,52,237,213,221,171,248,223,165,73,126,153,127,76,39,163,127,164,119,70,126,106,163,229,183,242,191,180,138,34,34,37,220,46,224,136,151,
+112,155,128,113,203,128,156,83,31,236,240,105,213,255,76,56,175,17,213,169,249,183,16,221,250,122,191,79,187,110,225,31,206,102,252,165,191,41,198,59,181,84,54,238,253,61,95,167,221,29,218,167,17,19,134,46,61,128,255,81,251,123,184,77,
+194,113,250,105,195,208,127,36,187,132,78,125,85,90,34,173,167,26,249,246,82,211,137,200,24,158,53,89,227,86,211,42,182,212,71,182,160,66,213,8,206,98,51,229,195,102,58,87,249,95,211,212,35,187,84,226,60,114,41,251,21,242,135,100,
+50,135,100,14,142,189,151,207,148,59,33,148,217,41,246,45,83,84,164,42,88,131,88,169,126,118,183,240,211,56,176,48,65,237,84,103,99,140,225,129,7,25,6,159,37,97,146,229,54,75,87,247,234,13,6,86,92,133,67,37,53,101,169,73,
+77,117,84,164,10,28,203,86,179,186,165,33,82,234,53,230,88,130,129,12,216,148,196,216,107,40,68,20,218,164,72,137,53,230,82,108,53,145,220,71,14,101,140,209,215,34,214,82,138,36,219,63,205,213,215,219,255,126,222,190,173,191,222,159,
+175,183,254,253,189,125,95,255,75,191,254,157,169,214,9,121,179,95,249,223,223,47,255,211,181,58,245,107,17,134,178,203,245,153,111,143,111,253,251,71,95,87,255,229,252,63,210,127,31,183,175,171,176,126,254,13,55,96,253,252,217,75,177,59,
+83,175,17,168,22,56,107,40,98,122,234,135,240,84,229,17,252,49,214,10,107,204,164,216,107,42,255,183,156,249,184,151,119,99,254,254,13,55,96,253,252,26,109,203,186,71,252,238,200,101,14,197,236,152,230,220,187,160,71,14,97,253,53,212,
+177,94,190,104,18,37,230,82,108,53,148,163,49,34,34,77,121,148,155,13,101,127,150,36,26,21,67,116,8,225,204,191,195,28,210,36,184,151,248,99,174,43,121,198,102,195,89,74,40,131,174,41,253,58,147,250,57,39,255,238,233,253,84,237,
+255,191,111,95,87,87,229,63,188,191,218,170,237,189,191,215,143,244,103,254,159,87,231,63,170,58,255,135,15,241,156,162,63,130,173,42,135,243,215,251,186,255,199,49,29,235,24,50,234,26,230,212,8,85,13,75,186,111,223,254,186,191,231,195,
+247,67,35,155,245,67,202,31,199,237,253,63,240,255,131,250,239,214,175,100,26,110,202,255,127,55,234,134,64,225,250,166,182,232,86,127,167,220,27,245,220,115,245,145,223,131,72,181,221,25,106,151,244,229,17,29,203,170,21,67,40,85,14,197,
+60,161,144,233,148,25,122,118,15,221,238,205,27,185,174,230,83,134,165,170,4,25,106,82,25,45,67,245,222,72,136,128,142,249,22,57,174,230,131,229,249,206,193,254,100,68,68,79,231,254,155,171,246,195,140,223,182,68,68,253,175,229,63,167,
+86,222,34,53,127,102,63,166,254,76,63,77,61,220,16,191,133,225,109,203,208,246,138,148,170,218,42,120,213,181,103,141,86,156,79,19,225,252,146,207,109,219,111,25,46,67,160,104,50,244,201,106,94,153,88,28,43,7,182,165,172,170,219,80,
+167,229,121,99,249,92,211,112,15,119,4,68,68,110,27,63,72,65,193,84,45,221,26,184,113,5,14,28,74,106,113,151,7,194,153,248,254,232,26,198,106,148,134,74,106,74,203,80,101,201,78,188,149,161,209,149,135,234,49,253,110,63,227,4,
+164,119,172,96,208,136,215,49,41,41,174,168,84,177,31,170,210,175,206,212,181,134,22,6,189,24,246,212,181,145,139,3,129,85,180,196,241,49,99,226,8,197,142,251,94,219,243,94,25,77,73,89,77,114,12,181,86,24,52,213,134,13,53,97,
+131,10,135,70,13,211,245,103,249,226,195,85,196,10,99,4,10,99,4,10,99,5,113,136,140,255,158,181,50,204,56,56,114,56,81,195,148,212,227,42,7,186,137,68,229,31,209,103,176,176,53,173,170,176,53,172,129,216,26,185,3,176,49,57,
+3,176,49,57,3,176,160,156,150,194,130,114,56,80,78,71,10,43,148,212,112,242,163,225,71,76,41,111,220,79,88,105,19,6,83,90,216,50,156,24,50,152,172,48,101,49,88,96,211,87,6,127,212,99,250,209,253,49,16,71,124,34,173,118,
+181,48,66,50,140,198,177,93,255,187,198,252,202,107,91,3,176,56,49,29,129,138,224,118,133,110,75,99,131,145,169,135,14,71,101,191,107,111,189,243,178,152,40,52,197,6,7,6,152,193,86,193,145,129,173,109,49,243,159,231,183,33,29,248,
+52,139,93,209,68,68,152,160,71,126,13,34,215,116,81,16,18,33,38,17,191,6,184,177,147,182,198,252,230,106,197,39,37,180,136,225,73,238,164,228,120,20,212,157,31,95,133,143,105,138,224,211,86,208,177,201,166,173,148,236,112,105,140,86,
+164,118,153,169,179,145,107,190,216,61,212,68,162,34,83,103,40,235,206,228,118,64,98,185,200,236,128,224,228,118,90,58,7,35,177,187,126,87,123,94,230,8,115,66,51,26,44,85,129,162,197,88,26,44,88,48,52,185,129,130,173,146,99,90,
+216,50,67,156,255,61,81,33,34,97,16,71,126,13,34,214,175,91,83,123,102,116,90,78,71,100,184,142,20,157,18,234,78,72,151,79,42,34,34,254,139,62,219,236,105,133,140,86,200,25,18,6,43,96,217,171,126,115,191,50,33,136,162,36,
+140,70,25,183,215,166,115,191,50,33,29,140,86,200,136,130,255,206,215,159,67,204,136,192,196,81,17,22,222,19,214,251,209,17,17,48,163,83,103,34,215,157,17,17,39,35,177,138,208,243,223,249,218,252,17,17,17,131,3,4,131,62,223,9,
+247,162,37,212,116,73,81,104,212,217,203,103,43,209,17,17,29,17,200,236,100,232,142,132,118,50,118,68,191,18,210,188,231,154,232,176,96,104,136,164,24,24,44,112,196,173,225,62,253,140,147,81,39,36,133,29,28,141,22,147,146,29,133,18,
+114,59,26,82,114,67,177,148,229,42,241,165,169,141,116,152,157,144,29,141,9,216,50,88,208,157,131,14,85,185,223,155,91,3,132,102,44,198,82,108,53,144,49,204,136,57,243,227,249,237,196,232,193,129,161,59,32,96,97,209,131,3,83,191,
+53,72,147,69,37,24,94,101,38,195,89,108,109,249,171,253,69,197,57,29,141,9,216,142,198,132,236,14,198,132,236,187,249,108,113,249,236,204,25,1,136,134,64,98,40,24,24,36,40,24,36,40,24,36,41,18,102,50,129,6,184,181,148,43,
+109,251,50,223,154,130,112,70,56,130,49,96,241,61,166,228,14,192,227,85,129,144,49,106,136,62,211,5,59,71,62,153,234,101,172,160,112,174,55,116,141,213,165,104,158,31,183,240,86,131,10,134,74,202,107,144,37,169,90,184,169,194,176,75,
+82,244,141,213,130,187,161,97,90,93,192,126,217,167,110,174,237,93,159,158,253,105,45,80,174,43,250,225,94,252,132,244,111,244,142,232,207,205,84,124,182,174,63,171,252,169,130,156,79,106,163,56,61,181,69,202,173,181,98,8,85,194,211,197,
+75,28,167,143,237,252,42,253,181,211,240,154,117,252,162,254,203,242,188,45,250,93,161,241,217,180,78,45,143,246,106,207,58,190,225,197,120,142,173,79,205,184,134,239,211,213,250,125,219,119,8,235,233,249,94,19,229,14,200,101,54,74,125,139,
+84,213,41,10,150,32,214,35,159,118,178,240,133,74,66,165,141,102,177,211,58,196,105,137,196,115,226,45,78,120,139,25,2,7,2,183,44,99,203,242,179,255,91,170,63,217,171,250,123,123,127,175,30,223,233,127,152,127,166,157,95,227,127,240,
+151,249,251,109,254,51,255,73,127,189,240,255,250,55,248,80,250,147,252,195,253,52,234,255,27,255,132,191,206,127,227,228,137,254,97,254,154,117,127,141,255,194,95,246,255,25,255,164,191,222,248,127,253,27,252,35,253,91,255,195,111,241,159,250,
+75,253,239,135,255,209,191,240,136,159,198,135,242,127,77,220,56,243,119,126,215,246,200,136,159,182,155,187,246,221,92,221,222,92,223,183,237,253,191,55,151,119,55,239,251,166,253,255,253,209,17,17,27,246,208,254,79,233,139,184,78,63,135,63,
+240,68,127,143,219,250,127,225,238,254,78,175,207,126,163,116,255,182,95,236,240,143,246,106,230,159,111,148,106,253,189,81,242,219,87,236,162,156,46,159,244,208,254,75,112,143,246,106,230,159,111,151,55,237,63,42,136,148,193,255,77,51,137,219,
+128,33,252,154,111,253,255,6,255,26,148,53,46,184,18,235,41,69,18,98,184,240,63,241,142,104,20,196,165,40,162,14,223,36,242,230,151,248,230,230,68,199,119,239,166,253,255,146,121,115,77,254,57,115,96,95,206,221,47,255,167,103,240,83,
+119,52,191,199,137,248,115,248,101,221,21,253,252,237,44,135,239,224,115,118,15,40,20,219,191,135,55,248,229,169,18,87,153,73,176,214,92,255,170,123,243,71,203,108,250,133,76,56,234,31,191,226,211,118,15,223,192,230,236,254,111,235,173,229,
+168,255,78,55,22,239,219,190,173,193,184,234,49,217,196,166,236,127,231,100,10,109,195,84,191,199,55,50,222,101,38,195,89,67,19,215,251,233,187,6,233,154,27,151,84,42,254,156,163,140,101,136,47,211,101,190,191,244,240,213,252,157,218,167,
+253,62,232,212,63,79,84,119,13,179,234,221,225,187,244,92,46,113,250,104,119,14,0,191,146,40,34,59,183,106,159,244,251,163,249,77,63,57,179,242,139,217,199,40,118,47,100,14,108,151,116,24,161,185,117,64,255,80,253,63,59,170,161,182,
+113,29,217,113,212,189,156,114,134,80,202,13,82,246,9,255,145,100,68,166,15,250,105,184,142,10,95,201,224,35,252,157,209,19,254,158,173,85,13,187,163,187,244,243,234,168,101,198,38,185,9,203,117,191,80,115,142,16,254,79,1,25,196,244,
+170,61,219,106,136,115,27,106,213,187,110,239,209,71,242,136,148,193,248,75,143,9,187,184,13,92,69,59,63,57,179,123,15,241,173,230,74,74,216,107,41,69,18,98,135,145,67,112,230,129,143,225,220,66,50,212,136,127,206,168,118,46,71,12,
+161,84,50,37,221,8,194,161,205,119,48,199,195,159,59,214,211,196,84,50,159,84,50,227,148,50,135,98,181,80,202,21,65,162,181,47,50,212,188,215,115,93,25,94,101,38,195,89,126,119,249,148,219,80,32,245,109,171,154,173,181,79,26,182,
+176,158,53,12,132,228,25,114,14,86,171,111,129,241,225,55,119,1,16,226,122,85,25,195,237,170,51,213,182,173,66,171,10,159,166,206,81,223,12,149,170,131,77,82,229,21,170,26,150,165,215,25,181,144,33,142,125,51,233,62,102,158,53,88,
+101,60,78,12,39,44,151,32,235,146,229,82,229,49,195,46,63,200,68,162,82,233,248,77,221,193,98,225,197,1,130,238,165,170,143,19,219,84,92,24,176,49,170,173,181,79,26,182,229,57,3,131,7,141,91,124,42,197,248,92,226,147,56,159,
+130,149,125,212,21,16,112,244,176,56,241,61,181,69,241,143,229,63,43,68,68,74,96,244,193,248,77,178,153,63,234,53,45,75,204,167,14,100,41,106,68,63,223,85,156,100,172,30,12,185,84,185,77,82,229,21,57,162,181,67,82,159,234,222,
+252,223,156,114,7,182,160,241,170,195,41,200,29,149,131,196,217,114,156,134,74,193,224,203,150,59,175,205,249,233,106,186,40,139,121,148,155,13,101,2,26,234,252,242,156,24,18,212,173,169,78,26,150,168,106,184,177,43,177,5,151,6,253,84,
+92,63,0,96,184,138,90,162,28,78,192,227,56,61,181,16,137,139,3,41,202,173,167,224,122,227,201,19,133,206,41,46,52,152,156,63,8,23,17,65,142,107,237,127,229,8,101,57,3,101,96,228,172,172,28,149,151,39,53,201,88,84,172,164,
+166,172,47,205,189,175,218,118,7,23,14,123,76,20,228,98,213,16,114,170,192,200,57,3,218,108,30,38,44,50,156,170,253,63,129,235,225,115,138,75,141,38,39,15,72,25,56,126,10,101,221,75,3,32,226,123,243,111,107,246,136,173,80,205,
+21,53,108,65,77,175,84,34,177,192,147,31,215,85,159,64,202,193,201,89,88,61,65,151,37,49,146,146,154,176,138,154,176,138,156,209,83,155,80,57,181,97,28,10,87,153,73,176,214,90,116,205,250,202,3,22,56,188,76,90,162,156,140,88,
+27,7,42,172,172,28,129,217,131,7,32,97,131,7,141,175,219,225,80,122,73,195,210,98,227,193,76,132,226,138,100,39,20,176,50,19,131,218,113,158,190,114,215,125,141,89,89,77,89,89,77,89,73,77,114,152,228,74,114,136,171,158,123,255,
+56,206,70,44,96,131,145,139,24,96,229,85,140,48,114,7,102,12,28,129,134,12,28,160,193,131,151,234,54,248,26,34,34,83,7,166,15,73,56,122,76,78,30,147,19,135,162,212,78,30,130,192,201,195,208,236,12,156,56,59,3,39,30,15,
+249,236,168,63,167,11,204,132,85,166,37,214,82,138,36,197,187,243,213,3,86,25,41,171,41,41,171,8,169,171,8,169,205,21,57,162,167,52,112,142,17,192,146,87,153,73,176,214,95,201,175,125,38,225,60,41,196,150,142,28,140,81,195,145,
+138,56,114,49,103,14,70,44,97,201,108,97,202,171,24,137,139,24,39,49,99,4,236,44,96,157,133,140,19,178,152,39,101,96,78,202,192,157,149,150,217,177,46,93,28,129,216,193,61,86,48,78,194,198,9,216,88,193,59,41,130,118,86,4,
+240,96,78,24,50,190,65,148,217,89,78,12,167,6,83,82,101,53,40,26,197,77,75,21,53,33,138,241,253,83,214,136,136,152,225,155,27,169,95,134,223,11,153,77,89,88,129,171,72,213,132,84,213,132,84,230,138,156,209,83,154,56,69,48,
+140,175,59,155,13,101,159,78,153,155,125,20,212,202,114,7,105,156,129,216,201,131,144,59,24,96,228,182,96,193,200,213,131,64,255,61,183,57,235,113,73,79,132,244,152,132,244,129,144,158,147,20,40,44,96,167,93,55,235,61,184,152,104,57,
+65,131,7,6,172,26,6,172,24,148,228,83,50,196,26,179,215,126,246,190,215,152,177,146,185,26,153,56,114,59,41,60,14,198,9,156,150,199,7,35,83,12,28,142,195,93,251,113,46,64,167,164,9,209,233,52,247,56,165,212,75,183,244,227,
+224,53,41,194,252,74,76,164,13,117,148,162,35,132,112,44,223,158,60,252,245,178,179,148,26,14,70,172,24,57,28,205,3,12,172,234,97,160,87,52,12,50,197,76,50,198,102,145,205,28,34,13,14,104,175,242,107,157,17,48,162,93,71,149,
+30,20,106,21,122,10,60,14,208,114,53,164,240,177,206,8,236,112,35,129,57,45,140,157,78,199,10,108,228,88,242,252,244,212,156,161,71,64,70,180,158,184,81,224,118,131,145,173,39,37,177,150,152,210,219,52,216,182,50,117,59,28,26,98,
+118,91,25,60,24,224,193,148,157,166,39,131,46,154,255,59,172,255,167,133,248,148,155,13,101,40,162,46,239,207,30,112,115,51,204,208,32,106,193,160,114,41,153,98,13,12,54,125,31,54,246,181,229,3,41,212,237,51,146,216,201,195,145,192,
+154,7,99,86,114,129,200,236,51,94,127,187,223,113,205,28,34,13,22,243,213,6,195,89,8,227,126,108,115,233,91,204,228,106,193,145,156,170,12,138,206,64,195,65,230,96,193,159,245,27,115,163,209,46,158,137,34,158,146,39,145,171,210,99,
+41,225,105,154,22,50,113,64,106,101,58,157,166,98,91,25,56,114,56,19,231,60,75,151,229,104,136,136,136,216,88,245,151,47,202,179,146,216,224,228,106,97,131,145,218,13,53,153,89,200,213,160,228,106,193,161,125,179,237,206,120,173,36,83,
+220,78,211,26,187,76,100,180,91,41,79,64,118,48,83,142,125,250,206,199,6,131,131,86,13,3,86,12,74,114,41,153,98,13,90,70,185,235,124,219,219,105,26,153,56,114,59,41,60,14,198,172,228,182,50,87,35,83,12,28,142,193,131,64,
+237,159,110,115,214,84,193,233,115,163,210,69,61,36,83,210,6,10,122,45,255,156,107,95,158,192,148,213,132,84,230,196,148,225,136,37,53,230,194,56,71,53,89,244,233,120,96,228,98,202,193,200,195,43,7,35,12,172,28,149,149,131,154,178,
+178,154,178,177,3,86,145,171,8,169,171,8,169,205,21,57,162,167,52,82,63,156,106,54,254,134,179,138,11,25,9,197,5,140,132,224,197,140,132,228,98,198,66,114,49,99,131,145,139,98,94,7,140,121,108,68,162,82,231,20,148,226,147,20,
+226,147,20,226,138,96,184,208,88,193,56,122,11,24,39,14,98,198,9,193,85,106,138,114,7,96,100,28,129,216,31,129,235,47,202,34,83,7,165,211,240,148,226,144,33,56,162,246,91,243,219,65,10,134,66,42,115,98,74,112,196,18,154,243,
+97,28,35,154,172,252,245,222,24,57,3,179,12,158,38,25,90,114,86,86,14,106,202,202,106,202,202,106,202,74,106,194,43,80,97,169,78,26,148,230,142,25,138,230,196,165,172,180,240,171,243,183,156,92,52,12,19,134,27,106,41,218,171,3,
+139,144,61,166,9,200,24,177,137,227,85,142,251,94,223,156,189,217,77,98,25,106,86,25,41,171,43,41,184,101,101,39,12,172,12,167,101,109,156,191,93,172,168,28,57,3,20,14,28,161,65,196,161,192,79,42,7,186,137,72,235,63,15,211,
+152,39,12,98,198,9,212,197,170,39,141,86,6,83,144,59,3,112,228,14,203,198,39,111,211,55,13,156,145,17,18,238,18,160,121,80,60,168,30,106,7,135,1,196,80,113,5,64,225,226,99,137,3,180,224,170,177,236,253,103,231,116,172,106,
+83,133,248,146,154,178,198,26,249,150,48,36,76,127,125,86,113,146,176,115,86,86,83,86,86,83,92,129,45,74,218,148,225,169,78,104,169,205,170,237,88,18,74,243,41,54,26,203,159,166,110,194,6,45,81,60,106,218,109,57,3,22,12,30,
+53,46,83,144,104,48,114,25,43,7,190,215,213,111,1,196,81,98,225,197,1,130,238,165,170,139,135,61,166,10,112,98,213,115,85,180,198,119,233,249,66,196,26,229,53,74,194,42,106,194,43,84,51,69,77,91,16,83,107,230,196,244,207,165,
+111,123,7,141,86,25,79,19,101,97,57,6,92,131,174,75,149,74,210,53,200,113,253,197,145,40,148,186,126,19,113,20,132,120,240,6,11,186,150,170,46,28,246,152,41,193,139,85,205,86,218,167,32,98,193,131,198,171,12,167,141,91,124,42,
+196,82,233,248,77,221,193,98,225,199,3,5,220,45,84,120,158,218,162,248,199,242,159,149,162,34,37,220,37,64,240,225,198,185,242,219,126,165,56,106,90,161,170,226,5,118,172,9,15,245,219,179,134,92,131,174,75,149,75,148,199,6,4,181,
+43,8,173,75,170,7,159,74,223,243,191,156,141,91,106,158,53,109,202,120,212,172,39,32,203,144,114,25,46,79,12,149,177,221,142,111,207,77,205,116,81,22,243,41,54,26,202,4,53,213,249,229,169,114,138,212,188,203,82,234,195,85,218,202,
+90,203,249,61,29,46,163,77,70,120,81,156,79,70,113,60,92,79,26,167,141,91,104,10,189,49,217,194,112,241,14,39,33,84,241,171,108,106,219,229,180,24,45,162,168,184,170,51,181,45,77,152,243,236,171,104,168,182,238,139,212,35,59,8,
+207,144,41,242,131,228,191,191,92,161,179,130,246,20,249,65,242,135,100,50,155,37,171,37,170,106,160,85,66,35,243,159,173,159,60,106,27,77,196,119,91,187,81,242,254,72,44,120,14,232,126,154,123,184,107,171,245,22,170,51,134,176,170,51,
+159,233,234,213,80,219,83,199,118,222,49,21,14,232,142,3,184,151,128,227,55,0,247,112,68,68,68,68,166,15,250,105,187,191,76,11,251,52,111,214,108,224,195,250,112,188,249,149,166,37,214,82,138,36,196,63,131,122,213,6,40,84,188,203,
+80,254,29,220,215,69,63,93,187,193,151,178,113,148,50,135,98,238,134,80,170,17,133,75,204,167,207,158,122,255,58,241,221,180,79,170,174,206,49,134,66,124,161,216,189,144,170,25,2,27,181,223,45,88,18,34,222,101,38,195,89,64,132,124,
+162,187,135,52,13,127,135,46,105,94,119,54,26,203,55,235,27,126,202,90,161,25,198,221,209,221,250,122,181,110,219,199,85,89,14,49,94,193,62,127,42,252,59,135,46,5,253,144,122,187,173,187,83,159,233,247,16,221,250,115,212,55,90,122,
+126,215,146,246,66,168,118,46,232,20,213,46,168,24,45,122,161,175,155,19,199,79,220,118,119,20,59,3,246,67,40,118,45,83,100,190,75,25,170,233,253,148,253,52,184,254,153,127,179,194,35,249,53,115,79,183,203,155,246,159,149,68,78,23,
+79,250,104,56,227,250,98,255,77,185,126,151,245,113,221,250,121,245,110,97,199,80,253,255,22,155,176,126,254,7,55,103,243,127,93,111,45,71,251,125,197,229,250,119,212,55,14,60,223,191,238,155,247,255,247,68,68,74,96,255,198,95,228,142,
+5,254,147,230,227,111,45,71,251,125,195,203,244,255,195,221,252,157,95,158,253,70,233,255,140,63,211,72,255,102,175,225,190,223,224,149,95,199,50,31,193,177,255,72,147,248,208,254,79,233,186,191,135,199,248,58,191,110,55,115,126,209,19,244,
+210,227,252,110,173,95,201,221,252,63,210,127,21,17,63,109,55,17,251,110,173,95,201,253,47,241,145,17,63,204,63,211,78,175,243,50,34,34,127,219,171,255,232,136,137,252,104,127,39,252,214,253,113,67,200,106,145,107,230,93,124,203,20,73,
+177,221,251,233,191,127,228,158,90,165,215,15,225,167,243,183,75,253,233,251,255,36,242,230,151,248,241,253,71,234,243,183,246,72,127,60,59,75,33,252,245,57,100,63,130,165,42,191,167,15,241,221,20,73,94,101,38,195,89,126,171,243,191,158,
+205,187,248,250,191,131,199,248,125,159,201,135,255,211,249,253,188,210,255,28,220,200,183,153,73,176,214,80,32,88,249,67,248,49,187,173,127,167,43,204,164,216,107,47,214,254,115,45,255,167,237,254,62,175,224,241,254,31,103,242,97,255,249,126,
+183,246,93,165,254,126,219,127,140,255,210,95,239,124,63,254,219,147,248,58,174,255,26,223,136,212,173,134,178,134,39,175,117,248,55,248,80,255,198,63,135,155,18,147,97,172,191,159,249,198,235,237,255,191,111,95,87,255,255,131,250,143,225,241,
+254,14,175,227,246,254,159,248,123,191,147,171,249,252,101,255,254,196,237,78,176,90,198,165,214,80,205,127,231,127,125,252,244,236,254,10,110,254,28,58,240,47,227,126,113,186,191,135,199,248,58,191,143,219,250,127,225,238,254,78,175,231,241,151,
+255,211,179,248,41,187,248,112,235,254,79,234,147,133,211,240,153,196,252,20,191,146,212,61,93,214,132,84,191,139,70,68,68,166,15,194,233,248,98,189,156,49,68,68,78,11,251,105,248,127,103,134,83,135,31,166,238,167,246,75,187,80,125,67,
+113,13,223,167,171,244,226,173,163,116,127,89,252,78,58,129,234,242,182,225,250,115,253,190,226,27,181,57,234,226,197,61,59,1,248,127,29,19,10,15,235,61,7,87,242,74,127,225,159,15,226,242,73,127,219,171,171,175,183,244,251,151,104,221,
+251,115,253,63,145,110,230,26,186,191,255,12,135,243,215,151,238,255,85,252,30,190,175,255,221,255,244,133,95,216,158,239,251,117,117,117,246,255,222,175,233,235,255,183,87,87,95,111,253,251,110,235,234,255,252,223,255,73,187,87,255,29,95,255,
+95,255,165,221,169,212,137,133,37,141,37,78,83,194,147,135,28,28,78,67,134,92,54,97,75,169,46,19,175,0,225,197,7,113,83,186,33,195,196,85,149,54,71,157,120,119,10,7,15,26,119,16,55,15,26,173,57,85,180,226,123,65,144,59,
+10,136,22,63,182,215,26,182,212,15,109,81,59,3,140,246,168,131,134,56,207,216,83,254,252,56,96,208,174,250,191,79,127,33,56,156,167,19,197,103,142,231,141,95,167,42,182,141,219,69,81,176,170,51,236,166,223,202,243,144,171,104,221,180,
+84,91,119,69,234,213,59,71,142,66,126,193,251,241,216,191,149,163,174,81,159,32,211,228,50,86,25,67,178,99,105,170,154,169,28,34,195,203,91,74,168,110,133,80,137,194,32,151,86,108,127,134,25,99,13,101,95,63,134,152,213,30,33,138,
+117,200,56,236,31,191,29,144,202,77,54,232,85,38,253,117,89,46,80,236,153,174,56,121,13,211,20,218,151,80,212,57,132,97,168,16,136,212,8,70,68,151,153,73,176,214,83,106,154,40,136,144,188,202,77,134,178,254,14,179,186,165,242,90,
+164,75,204,53,13,80,138,75,26,165,185,63,198,35,172,70,26,202,81,68,66,31,195,26,179,98,10,102,195,89,74,40,147,111,234,166,15,73,56,122,76,78,30,144,50,112,244,91,25,56,122,45,140,156,61,43,123,247,181,45,121,2,83,88,
+169,171,45,74,202,112,96,199,6,13,51,6,14,172,26,114,12,26,102,12,28,17,134,14,8,195,7,4,98,193,203,19,22,55,35,91,28,77,108,100,230,54,153,56,252,167,231,57,91,54,240,193,203,19,13,57,24,218,224,140,90,168,152,177,
+130,171,105,197,197,170,46,54,48,78,28,88,193,56,113,99,5,198,134,10,113,65,25,197,23,136,164,206,41,51,242,164,185,99,117,35,141,94,22,168,167,200,226,225,148,167,200,100,225,149,160,195,40,48,104,85,148,13,114,134,224,211,84,208,
+170,70,177,21,41,2,53,230,134,168,106,150,179,152,148,215,85,75,170,26,166,32,83,71,49,148,155,13,101,2,31,211,94,188,216,148,196,216,107,41,69,18,106,244,110,13,191,48,199,147,192,215,17,57,77,69,114,154,142,30,92,158,236,121,
+61,216,135,233,199,61,228,9,78,4,166,172,74,106,208,53,96,192,213,131,3,86,12,29,88,48,117,96,211,150,44,25,72,236,24,57,29,141,131,145,216,213,200,224,78,70,44,100,228,98,199,43,24,41,235,228,95,157,181,252,152,48,112,70,
+24,56,35,12,28,17,139,7,4,98,198,224,140,88,200,17,139,25,57,24,177,147,131,181,12,184,192,157,105,99,39,15,64,100,225,232,164,225,233,7,15,73,61,36,244,186,199,225,183,192,56,96,202,225,131,41,134,12,166,24,50,156,25,77,
+73,148,214,42,107,21,53,33,19,95,225,172,69,230,66,42,203,24,107,140,209,68,7,2,129,172,101,25,70,81,75,204,164,216,107,40,86,253,59,145,48,165,212,71,149,30,84,87,20,200,22,155,40,174,83,78,64,236,111,3,180,28,142,192,
+201,202,6,78,167,99,37,35,180,29,182,114,143,47,207,99,10,60,168,174,71,9,202,20,120,29,168,174,83,60,14,198,174,71,101,45,54,91,103,62,195,177,147,134,22,153,131,3,39,152,201,88,52,29,131,41,60,141,88,52,49,174,157,130,
+162,121,19,134,13,51,6,83,118,12,166,129,131,41,130,12,166,8,48,170,48,49,252,51,4,183,153,2,4,26,98,93,122,161,16,73,133,245,64,131,77,24,24,140,13,4,96,96,177,36,152,134,37,7,253,87,114,34,75,101,26,5,75,81,
+148,142,152,211,98,236,196,82,106,47,13,136,136,212,217,38,165,168,82,198,134,75,249,229,199,98,223,166,34,131,101,248,150,34,58,10,114,93,154,41,227,113,45,54,92,66,249,126,84,116,191,249,31,156,253,55,234,51,103,184,177,187,149,46,
+196,240,37,190,93,46,252,231,242,47,255,194,34,53,54,73,169,106,20,177,161,146,254,117,113,216,185,179,226,40,54,102,196,177,17,206,41,201,118,103,83,198,226,90,108,184,134,105,126,84,79,127,242,63,57,250,95,212,102,207,113,99,119,42,
+93,137,224,75,154,83,221,249,207,228,95,255,132,133,120,86,136,136,136,136,139,94,21,162,34,75,76,52,68,68,68,194,187,171,21,202,177,93,213,162,37,218,97,162,34,34,38,21,225,90,34,34,34,34,34,34,215,133,104,151,61,207,139,201,
+241,123,157,17,17,17,46,124,29,17,17,17,21,240,116,68,76,30,231,43,156,176,116,68,68,124,29,17,17,19,7,195,23,187,23,185,209,17,17,3,220,248,188,159,23,185,209,18,109,48,209,17,17,22,188,43,68,68,68,68,90,240,173,17,
+46,123,156,158,78,79,115,135,185,241,121,62,47,115,162,34,36,171,194,180,68,73,158,231,197,228,248,189,206,137,133,119,86,117,202,179,174,234,209,17,17,18,109,48,209,17,17,17,18,103,185,241,121,62,47,115,221,197,93,120,171,171,137,195,
+171,137,195,171,135,15,7,14,30,14,29,93,92,58,186,37,99,245,67,245,67,245,67,247,67,245,75,208,126,169,107,94,130,177,90,244,21,162,45,120,87,133,120,87,53,99,164,213,142,147,116,187,162,34,39,69,172,86,58,45,98,181,253,82,
+214,52,172,235,208,31,56,208,104,63,86,63,86,188,227,245,107,252,177,254,177,255,189,7,250,198,136,136,144,112,225,224,225,195,195,249,48,254,72,172,86,43,133,98,177,92,43,94,130,177,90,244,21,143,213,14,139,250,161,209,107,194,187,186,
+65,215,164,30,21,171,205,90,188,213,193,225,92,29,18,21,225,94,21,225,94,21,225,94,21,225,93,220,227,65,206,57,198,131,156,126,173,127,182,191,187,28,240,231,28,240,253,216,255,88,255,88,209,107,253,88,209,107,28,227,73,185,198,144,
+231,28,235,95,56,231,90,198,139,164,218,46,144,208,115,195,156,115,195,253,107,253,181,208,104,63,150,52,31,251,231,95,237,175,61,220,247,115,221,207,119,61,220,248,105,134,151,116,187,164,213,142,147,86,58,77,250,169,126,170,95,186,155,247,
+73,117,98,177,209,107,21,142,144,253,80,232,191,170,29,7,69,253,80,232,191,170,65,162,254,172,115,175,234,199,246,199,250,199,234,198,131,245,99,65,160,253,88,253,218,255,109,121,215,160,233,14,131,164,58,15,213,47,65,250,165,172,116,21,
+173,99,160,173,122,47,69,232,189,52,28,227,65,206,57,198,131,247,112,254,92,57,199,246,215,251,99,245,107,253,181,253,92,221,5,115,116,21,175,234,135,69,253,80,232,181,143,221,45,99,247,75,253,165,255,80,232,28,61,99,160,112,240,172,
+113,133,99,141,99,160,227,88,232,56,162,34,34,47,65,92,221,5,120,126,170,95,170,149,98,185,86,43,151,234,165,250,169,116,187,165,220,247,115,201,213,230,117,121,156,79,51,137,250,47,17,209,120,173,106,234,226,181,117,113,61,211,224,248,
+60,184,203,140,156,60,156,60,186,44,225,250,44,225,197,106,234,226,181,117,126,139,56,126,139,56,127,213,195,249,112,231,227,46,50,112,242,112,242,227,46,55,115,174,144,231,93,23,72,126,172,105,15,213,143,221,143,245,143,237,203,245,114,208,
+105,45,6,146,231,187,158,238,123,185,209,17,46,208,115,205,160,231,155,156,105,55,56,210,110,113,164,220,227,73,191,119,55,238,208,126,174,95,171,150,131,73,104,52,151,234,229,250,180,65,160,253,218,232,63,118,52,94,113,160,209,121,198,139,
+251,177,206,63,118,57,209,63,182,191,219,95,213,142,117,253,88,231,93,23,245,107,162,254,174,95,171,151,234,229,250,185,126,174,95,171,151,234,229,250,185,126,174,95,171,151,234,210,29,23,164,10,4,181,186,214,232,189,48,43,171,116,187,166,
+5,117,110,136,189,48,43,171,116,94,139,210,5,2,90,221,107,116,94,139,210,5,2,90,221,107,113,229,188,255,56,63,90,51,75,132,51,64,161,152,102,33,251,209,155,242,163,243,178,204,139,251,209,154,31,173,25,145,115,97,152,102,95,222,
+140,208,252,236,179,34,254,232,87,15,213,10,209,107,194,177,90,254,232,87,14,146,173,23,247,66,184,126,168,87,46,16,174,5,10,197,100,63,116,43,252,168,233,42,209,115,46,97,154,89,134,105,183,195,120,204,55,175,231,6,97,190,31,157,
+57,102,61,233,133,98,139,65,189,107,90,240,222,181,225,88,174,21,239,175,125,112,174,109,233,53,123,197,5,6,248,86,43,155,124,55,138,198,245,252,224,172,111,135,74,74,186,111,76,63,56,63,56,55,162,244,192,174,173,209,23,166,4,63,
+134,245,144,255,10,72,176,36,69,59,139,252,56,246,224,88,20,197,129,34,41,29,196,120,28,10,7,2,72,127,249,19,255,201,2,192,166,41,16,205,252,236,215,162,126,254,252,175,242,21,34,64,176,36,73,24,56,126,120,193,162,41,64,160,
+80,40,22,5,129,96,95,158,152,176,36,184,148,135,235,179,126,123,53,232,159,206,204,146,44,10,111,225,195,251,168,139,255,241,254,20,53,41,141,73,72,28,138,4,8,71,243,217,175,205,127,231,114,189,175,107,197,64,193,146,148,34,165,8,
+192,176,32,80,230,4,191,237,86,189,175,236,6,55,3,152,193,224,120,26,243,2,135,235,111,205,120,205,119,255,210,168,24,221,3,95,240,169,72,175,205,252,236,201,217,123,126,121,106,6,128,166,37,41,137,75,2,145,2,145,65,191,157,152,
+83,14,23,126,154,84,217,77,146,253,172,191,107,47,218,143,223,214,213,180,198,63,162,13,79,3,129,8,130,4,9,111,205,127,243,81,175,202,246,188,24,168,99,40,130,82,184,129,36,191,218,136,136,136,136,129,191,157,154,5,35,4,10,7,
+2,129,204,74,96,148,148,255,134,183,230,191,247,183,104,54,75,159,101,220,248,105,179,15,202,221,250,89,126,214,106,126,214,5,79,218,174,194,167,237,69,54,21,63,106,41,176,191,106,66,155,7,233,65,10,108,31,149,88,211,101,255,197,160,
+211,242,184,108,210,239,213,203,247,114,253,220,191,119,47,213,242,150,159,164,151,233,46,252,166,28,182,97,249,91,180,252,172,185,255,43,43,246,13,148,26,13,144,42,105,65,178,5,179,128,217,124,54,112,26,126,120,126,86,155,6,130,241,251,
+81,164,63,106,52,135,237,69,33,179,79,202,240,135,62,193,77,144,231,95,202,195,72,126,87,15,202,225,179,65,176,104,52,26,11,246,126,237,116,191,103,234,249,13,154,95,207,250,65,179,65,167,233,47,27,52,26,126,80,126,123,102,141,167,
+40,95,167,38,231,155,78,76,52,155,78,91,6,147,105,179,65,163,67,245,99,150,67,247,99,144,97,251,177,202,31,187,28,161,160,208,105,134,136,136,136,147,104,57,13,33,167,233,57,225,250,65,207,15,202,47,60,57,67,78,88,126,83,15,
+202,15,233,83,17,254,52,150,152,104,136,165,118,159,227,207,215,134,152,105,54,152,104,136,186,21,218,22,5,13,32,80,209,33,218,137,218,144,211,13,38,210,90,10,255,131,89,162,126,200,245,159,48,138,36,52,195,68,73,16,40,84,64,145,
+23,72,105,13,33,164,52,195,76,52,195,74,166,211,13,18,237,23,65,186,186,171,52,79,224,214,146,211,13,38,254,92,63,180,136,191,242,31,227,66,93,38,37,209,116,5,45,33,160,208,115,213,89,214,125,53,158,39,137,136,130,5,162,233,
+14,117,210,28,240,211,13,6,144,253,216,209,127,212,63,101,228,146,211,13,17,18,237,33,205,162,93,166,26,34,34,105,14,109,17,16,105,134,136,152,104,57,151,68,68,150,152,104,137,135,238,215,76,52,68,150,152,104,152,121,126,174,185,191,
+86,136,137,47,213,32,242,253,210,34,13,48,209,18,239,47,221,205,251,180,68,68,155,247,95,204,207,60,54,83,24,175,37,157,121,25,58,186,114,53,117,120,16,157,77,74,27,191,43,250,98,7,179,148,197,14,88,91,146,93,183,144,43,139,
+10,26,213,67,83,186,194,168,20,219,151,108,136,31,237,212,140,110,132,119,126,151,242,128,224,114,169,109,117,133,68,54,131,133,133,64,200,84,42,37,221,24,63,73,18,189,198,30,99,6,134,144,57,143,92,138,165,201,118,134,145,163,65,129,
+146,34,34,52,25,1,146,6,13,115,76,105,117,129,221,105,140,170,129,131,214,13,12,18,64,148,171,154,53,205,166,119,229,178,141,76,30,233,229,170,111,40,127,29,127,162,63,199,167,132,252,31,6,73,118,36,63,130,131,252,121,191,133,22,
+133,80,221,2,56,106,209,99,250,188,241,231,30,3,249,113,28,240,136,212,191,168,17,231,230,231,240,213,167,130,248,62,117,221,123,10,174,57,178,93,208,41,191,69,45,72,136,183,153,73,176,214,82,140,185,161,215,45,73,43,204,164,216,107,
+254,24,137,142,101,53,188,193,76,203,24,107,33,21,140,9,19,31,207,85,159,74,195,6,14,85,6,12,28,129,134,12,29,76,48,96,83,48,104,131,86,88,131,86,88,131,67,154,42,115,71,8,221,126,37,38,195,89,102,252,230,91,55,189,
+140,16,158,135,99,4,39,35,177,130,19,145,216,193,43,145,216,193,48,114,59,26,176,114,59,30,223,3,196,185,37,48,122,93,61,46,158,147,18,20,244,134,108,78,215,158,36,129,131,7,35,86,12,28,141,88,48,112,106,193,160,106,193,137,
+78,107,255,56,214,191,108,211,208,88,193,9,232,118,48,66,114,59,24,33,57,29,140,18,185,29,140,19,7,35,177,139,120,30,37,203,98,37,48,122,93,61,46,158,147,18,189,32,219,255,43,190,186,55,244,240,191,6,194,247,68,68,73,51,
+138,209,46,121,153,212,211,97,108,166,84,228,153,176,204,136,152,111,27,238,174,27,235,222,136,136,136,146,223,94,244,68,68,69,223,134,245,223,94,244,68,68,73,111,27,250,60,43,20,140,179,108,42,230,252,238,194,174,109,6,194,174,91,246,
+21,114,223,176,171,150,253,133,190,189,235,93,54,74,151,29,199,113,220,106,112,53,57,180,7,42,105,189,119,233,113,140,211,26,156,13,78,227,184,238,52,155,96,222,187,235,223,176,171,150,253,133,92,183,236,42,229,191,97,82,91,246,21,219,
+246,21,37,155,97,127,4,102,206,63,218,187,41,154,69,135,62,105,126,117,18,95,253,255,108,182,83,52,139,14,124,210,252,234,32,204,136,136,131,101,51,72,176,231,205,12,195,243,168,136,136,54,83,52,139,14,124,220,180,217,249,202,183,162,
+34,34,103,15,117,161,158,206,136,136,136,136,136,136,137,44,225,243,189,127,168,108,226,242,199,247,230,215,151,239,159,59,94,56,174,118,189,229,157,175,121,103,107,222,89,218,251,157,165,94,143,53,106,112,173,107,133,107,90,248,126,139,245,31,
+255,255,247,82,34,38,24,224,105,113,74,51,98,75,180,17,254,157,75,104,221,141,133,80,42,129,254,236,85,178,165,166,195,194,156,171,189,140,177,59,83,107,130,48,127,164,82,199,202,98,49,100,145,216,227,2,229,177,99,54,213,44,102,253,
+57,144,199,112,219,24,84,45,251,179,21,77,178,168,100,15,101,13,135,229,40,175,182,150,60,75,244,134,12,135,150,36,182,6,73,49,216,229,179,145,67,29,136,136,136,137,45,249,247,162,34,34,34,34,36,219,210,147,126,114,128,135,231,56,
+2,95,206,126,171,138,34,38,28,145,46,216,115,126,86,43,203,100,103,27,12,167,15,178,46,39,196,131,135,26,224,227,19,117,121,18,97,176,176,217,24,58,236,50,187,150,196,72,126,86,28,182,82,63,149,154,114,27,57,43,135,137,242,24,
+241,4,124,181,147,204,245,106,145,225,99,64,114,53,228,240,171,148,219,121,75,145,34,66,155,57,67,147,34,34,34,36,159,126,116,68,68,68,68,68,153,208,230,156,195,9,234,12,179,254,163,244,232,152,90,236,246,151,234,38,253,196,63,145,
+12,227,245,16,206,45,158,217,199,135,237,243,219,63,241,243,255,159,195,250,254,27,115,254,159,63,233,243,254,156,89,237,158,217,236,175,252,133,127,212,62,113,199,193,243,142,239,212,7,217,199,63,29,157,95,201,179,217,236,246,123,103,253,62,
+125,191,168,183,134,223,236,91,245,15,254,135,253,196,249,223,247,31,201,206,249,220,243,158,115,208,244,148,110,141,209,186,55,70,232,220,67,248,120,150,184,110,150,233,110,150,233,110,150,229,230,49,253,31,217,38,21,221,89,74,178,149,106,80,
+223,2,93,252,1,67,125,123,53,152,127,3,6,28,212,193,141,192,193,173,80,48,96,193,205,80,48,112,168,84,39,216,88,150,38,55,200,161,69,166,20,27,225,193,56,34,108,167,245,65,64,151,82,148,191,134,180,90,77,69,160,254,52,41,
+55,237,165,152,102,151,231,110,252,237,223,157,187,243,183,126,118,239,206,221,152,127,54,252,223,158,134,169,106,150,169,106,150,169,106,95,222,144,143,239,42,109,247,17,225,73,94,123,238,60,15,3,192,198,107,225,126,250,25,93,68,59,229,188,
+240,59,183,158,7,117,123,239,31,158,205,92,136,247,220,123,238,61,247,30,251,142,234,166,188,84,43,205,120,191,54,250,193,149,199,129,224,120,29,212,170,84,168,95,10,247,230,5,191,53,114,170,227,192,197,36,98,139,121,84,41,53,66,147,
+84,41,191,54,35,28,223,156,165,82,160,57,80,28,168,15,10,138,249,170,186,169,191,57,249,74,243,240,145,205,109,149,233,208,94,66,171,170,155,87,232,175,142,63,148,240,155,135,76,255,171,229,179,243,138,114,233,165,123,45,53,64,175,133,
+83,126,139,82,254,83,244,81,191,133,223,204,204,72,88,28,175,44,11,2,192,176,33,249,232,95,155,121,38,6,87,200,202,227,43,140,174,50,187,126,107,199,235,183,220,88,22,5,129,96,87,70,107,196,70,111,207,15,207,102,222,101,113,149,
+198,87,25,96,88,70,232,139,225,249,219,215,53,251,229,19,145,3,145,3,145,3,91,196,65,205,16,115,68,30,107,200,21,255,157,17,192,176,44,11,8,139,230,141,209,155,243,173,201,173,157,225,225,185,114,182,206,91,5,235,27,163,134,171,
+212,191,101,55,149,45,77,252,183,254,119,119,132,57,108,229,108,166,138,223,8,205,170,90,245,45,245,93,252,223,207,108,68,186,152,58,37,212,95,227,45,127,217,190,235,238,190,235,238,190,235,238,191,15,224,254,122,180,187,150,137,51,34,39,
+45,7,149,245,157,46,189,229,125,215,221,125,215,221,125,213,255,147,245,127,148,28,232,147,114,210,102,68,68,228,59,3,67,244,147,126,237,17,135,45,18,111,202,93,250,79,231,255,211,255,104,136,137,131,162,93,155,2,68,187,50,255,52,22,
+127,233,239,185,174,107,154,230,185,174,108,63,131,150,116,186,206,147,94,136,150,113,228,217,207,53,204,82,107,154,230,185,174,107,179,255,159,142,209,58,36,214,121,175,68,68,176,253,112,190,31,167,155,185,18,241,103,73,182,221,250,127,231,127,
+223,169,17,17,43,159,195,110,116,4,12,48,100,68,17,6,25,7,59,230,223,125,141,28,142,198,83,162,35,57,29,140,157,51,31,61,123,243,26,44,65,134,68,91,240,108,72,28,53,205,152,244,206,249,183,222,129,156,142,198,72,136,193,156,
+142,198,153,246,231,60,75,146,81,17,48,122,34,37,211,209,17,36,83,209,38,109,251,55,215,62,113,170,235,204,16,53,108,53,148,162,130,40,49,252,241,231,209,243,32,96,206,71,100,68,48,193,156,141,10,175,207,31,58,93,20,69,188,202,
+77,49,46,178,129,30,57,175,60,250,32,48,193,156,145,16,129,134,12,233,149,47,207,183,58,25,79,68,68,133,140,167,162,34,41,216,202,122,34,32,35,177,148,244,78,122,247,230,60,247,164,65,134,12,136,130,32,195,34,36,34,12,50,34,
+66,32,208,115,77,204,145,6,136,146,138,34,97,20,73,94,119,54,26,200
@@ -0,0 +1,221 @@
+131,114,128,4,2,20,6,37,17,53,16,70,42,86,46,103,108,115,0,129,4,3,21,14,39,110,55,98,119,112,130,5,15,22,52,40,231,131,4,4,22,47,40,234,56,236,120,238,132,5,22,22,50,133,6,48,24,232,134,5,20,23,107,40,
+233,56,240,135,5,18,23,102,120,235,136,8,227,137,6,39,23,103,138,7,114,139,7,106,24,230,140,6,43,24,226,141,7,109,24,237,142,6,38,23,111,143,4,5,23,99,255,0,0,0,1,191,182,90,174,212,223,203,109,64,0,0,2,60,
+213,106,187,83,106,187,80,217,170,173,77,170,173,67,154,175,213,138,191,86,27,85,90,155,249,101,168,127,108,1,255,177,255,176,54,106,171,154,173,77,170,237,80,212,90,128,110,98,230,171,84,57,155,85,90,155,85,90,174,212,90,139,83,106,
+45,80,212,218,139,81,106,46,104,243,23,254,199,254,192,255,216,255,216,3,255,99,255,96,115,11,185,128,143,234,197,95,235,26,161,204,33,170,60,208,212,63,118,220,213,106,111,221,183,254,199,254,192,255,216,255,216,3,255,99,255,96,2,230,
+23,115,67,251,97,191,183,30,97,86,171,181,54,168,234,187,83,106,142,166,212,220,205,168,181,67,84,127,119,31,253,234,31,251,3,255,99,255,96,15,253,143,253,128,7,48,217,170,237,67,103,48,0,23,53,90,129,106,171,154,28,213,127,108,
+71,249,97,181,15,253,143,253,128,63,246,63,246,0,143,242,219,85,218,155,247,113,213,13,64,181,8,106,187,84,127,118,218,170,230,47,245,199,245,113,230,143,234,227,205,15,213,195,81,106,110,102,212,90,161,170,28,209,213,15,213,213,255,177,
+255,176,7,254,199,254,192,26,134,161,119,53,220,195,102,166,253,220,117,67,81,106,110,106,181,71,85,218,174,253,92,121,161,168,127,239,249,99,255,96,127,236,127,236,1,253,177,168,191,150,218,170,212,0,0,0,27,83,106,171,152,106,135,234,
+234,212,54,106,27,63,86,42,253,88,13,169,191,150,218,174,212,95,219,13,215,255,254,29,221,220,63,255,215,215,255,254,29,221,220,63,255,215,215,255,254,29,221,220,63,255,215,215,255,254,29,221,220,63,255,214,7,41,248,229,202,126,57,27,
+210,179,122,86,13,233,89,189,43,229,63,28,185,79,199,32,7,41,248,229,202,126,57,27,210,179,122,86,13,233,89,189,43,229,63,28,185,79,199,32,7,41,248,229,202,126,57,27,210,179,122,86,13,233,89,189,43,229,63,28,185,79,199,32,
+7,41,248,229,202,126,57,27,210,179,122,86,13,233,89,189,43,229,63,28,185,79,199,32,63,255,195,187,187,135,255,192,255,255,14,238,238,31,255,3,255,252,59,187,184,127,252,15,255,240,238,238,225,255,240,59,186,255,255,255,255,251,127,200,
+14,238,191,255,255,255,254,223,242,3,187,175,255,255,255,255,183,252,128,238,235,255,255,255,255,237,255,32,242,253,149,176,0,0,5,31,10,74,171,214,8,85,210,40,85,208,238,58,217,10,186,10,238,54,157,120,139,141,11,248,202,216,138,141,
+251,199,93,196,0,111,226,97,68,0,246,72,238,57,24,21,25,27,28,128,9,113,221,64,27,89,99,159,143,81,99,254,50,235,44,84,39,126,240,143,136,64,235,23,113,255,81,235,125,84,172,146,7,74,201,35,89,138,86,73,26,193,213,155,
+85,108,250,0,0,2,95,196,165,128,0,1,76,63,113,205,219,254,105,127,4,140,191,152,124,85,86,0,151,241,172,250,247,3,6,0,13,93,79,160,0,0,16,251,45,32,0,0,60,180,92,252,109,183,150,190,34,219,35,165,109,182,71,74,
+196,100,116,172,8,75,86,221,201,133,110,6,0,48,1,190,128,0,0,67,236,180,128,0,0,242,253,149,184,234,117,112,48,46,48,33,219,170,183,38,28,90,249,109,133,116,57,85,93,28,42,174,132,96,85,90,72,0,0,8,125,150,144,0,
+0,30,95,178,202,27,171,137,220,98,227,2,237,191,204,182,175,235,71,248,44,127,204,106,192,27,63,132,128,0,0,110,95,185,252,198,167,255,135,255,203,189,191,92,32,183,42,92,181,129,20,118,253,211,118,241,126,180,0,0,0,77,254,215,
+255,135,255,203,189,191,92,32,183,42,92,181,129,20,118,253,200,206,143,15,255,127,248,70,99,185,82,227,120,17,225,134,174,60,255,152,212,0,19,63,248,207,0,1,203,141,119,227,227,255,247,255,132,102,59,149,46,55,129,30,3,135,255,191,
+252,35,49,220,169,113,188,8,240,255,216,0,127,200,0,7,254,63,253,255,225,25,142,229,75,141,224,71,128,225,255,239,255,8,204,119,42,92,111,2,60,63,246,0,31,242,0,1,255,143,255,127,248,70,99,185,82,227,120,17,224,56,127,251,
+255,194,51,29,202,151,27,192,143,13,95,154,232,226,192,0,57,247,235,152,0,7,30,127,205,115,114,255,247,255,132,102,59,149,46,55,129,30,27,19,252,47,253,115,56,191,92,235,204,69,118,42,108,64,35,186,246,79,214,255,56,0,0,0,
+127,182,111,240,191,245,204,226,253,115,175,49,21,216,169,177,0,142,235,217,63,95,252,197,222,223,174,16,91,149,46,90,196,81,219,247,113,207,252,233,192,0,0,0,0,1,106,27,58,139,189,191,92,32,183,42,92,181,136,163,183,238,175,30,
+255,215,255,248,70,99,185,82,227,120,143,15,252,128,0,0,0,0,3,254,223,254,17,152,238,84,184,222,35,195,255,255,254,17,152,238,84,184,222,35,195,255,32,0,0,0,0,0,255,183,255,132,102,59,149,46,55,136,240,253,123,152,255,92,
+235,204,69,118,42,108,65,29,215,178,79,251,140,252,96,0,0,0,0,0,166,111,229,126,185,215,152,138,236,84,216,130,59,175,100,89,167,252,215,235,78,20,204,84,149,199,73,58,7,46,200,59,97,217,46,204,1,58,169,110,2,18,221,83,
+174,253,62,82,46,176,59,135,119,94,191,210,244,151,240,192,143,240,225,212,4,117,199,166,84,221,76,192,191,130,215,243,245,14,238,191,251,0,221,80,254,24,17,254,27,107,253,46,180,254,189,38,168,223,81,189,186,180,168,223,4,210,163,125,
+207,16,199,87,235,192,171,245,247,99,5,100,130,106,0,0,6,202,92,111,169,201,3,125,78,234,99,125,70,250,176,219,253,244,219,250,239,214,151,240,192,143,240,225,212,4,127,228,59,133,255,172,234,47,231,134,82,253,121,99,255,232,13,213,
+15,225,129,31,225,182,155,185,199,112,191,245,157,77,250,241,31,255,227,226,253,120,169,64,216,160,68,246,58,228,124,182,102,135,85,143,99,182,56,191,191,52,246,254,210,127,248,70,99,185,82,227,120,1,140,1,25,142,229,75,141,224,0,198,
+4,102,59,149,46,55,136,205,254,26,255,218,0,3,254,95,254,17,152,238,84,184,222,35,195,255,1,191,162,0,0,12,223,214,255,240,140,199,114,165,198,241,30,31,253,0,1,255,47,255,8,204,119,42,92,111,17,225,255,129,192,0,0,31,
+246,255,240,140,199,114,165,198,241,30,31,253,0,1,254,42,255,220,98,51,29,202,151,27,192,140,192,0,211,29,202,151,27,192,17,152,0,211,29,202,151,27,196,127,194,159,237,152,0,6,204,5,216,24,171,3,144,134,7,43,8,97,100,144,
+0,108,194,236,46,192,142,56,90,154,6,192,229,99,108,46,192,142,86,50,50,57,88,226,114,177,196,229,99,170,86,48,112,149,183,50,11,98,36,179,58,7,4,180,225,37,188,211,5,22,156,148,222,128,231,37,55,161,236,113,41,189,55,9,
+140,180,150,241,20,180,228,174,185,197,105,201,76,25,74,114,83,121,165,198,152,44,198,70,13,232,108,150,15,67,35,43,44,92,140,134,201,101,129,163,41,178,75,25,134,75,41,41,28,20,166,36,182,51,84,58,148,146,216,206,107,226,179,18,
+77,129,149,229,52,94,207,141,103,121,214,85,154,111,67,172,210,102,153,12,159,7,146,29,109,89,164,200,124,70,147,25,87,162,77,21,103,178,178,145,215,21,57,144,235,37,54,153,12,150,15,37,42,218,179,67,83,226,52,152,143,108,252,115,
+79,64,216,28,172,97,176,57,88,200,198,7,43,27,24,155,147,231,227,150,188,49,178,182,50,198,83,18,146,185,82,178,83,99,67,37,131,201,74,102,172,208,213,56,141,38,35,219,197,182,96,95,245,225,215,110,111,226,22,242,196,37,174,94,
+3,254,188,58,255,233,192,19,174,112,171,187,254,159,249,31,255,54,224,98,15,103,246,91,55,241,63,242,63,255,215,255,94,29,118,230,254,33,111,44,67,20,41,155,248,223,245,225,215,255,78,0,157,115,133,93,223,244,255,200,255,255,3,99,
+16,123,63,178,217,191,137,255,145,255,254,29,220,58,237,205,252,66,222,88,134,42,157,87,119,14,191,250,112,4,234,177,64,216,225,221,255,79,252,143,255,240,255,146,104,159,194,103,246,91,55,241,63,242,63,255,195,254,95,165,252,215,233,92,
+172,174,41,139,25,76,83,18,185,74,98,83,99,86,88,44,102,105,137,102,105,171,66,118,50,125,107,185,89,92,83,22,50,152,166,37,114,148,196,166,198,172,176,82,82,153,166,37,50,78,36,35,41,145,230,147,92,248,204,74,135,89,106,37,
+57,144,235,37,54,153,12,150,15,140,205,89,166,165,41,171,52,153,102,114,60,212,0,0,2,63,165,134,17,232,143,84,112,130,69,11,170,9,12,54,116,82,24,23,71,103,65,37,200,221,80,74,175,16,117,70,71,83,131,127,4,157,81,128,
+7,241,55,71,163,169,176,36,100,44,9,25,11,8,222,42,72,28,55,90,56,126,147,8,244,12,0,131,155,0,108,100,100,132,112,55,131,35,6,32,96,6,54,55,236,65,19,137,212,235,140,6,255,215,254,71,255,248,127,203,187,135,95,254,
+71,255,248,127,203,178,187,235,196,174,88,98,134,46,195,188,255,105,44,165,255,175,250,171,99,101,53,44,100,167,73,126,162,125,117,56,187,191,233,255,175,250,171,99,101,53,44,100,166,179,98,153,64,110,138,176,108,35,134,206,194,194,23,183,
+70,191,234,128,0,253,45,200,88,84,141,250,90,64,201,24,234,67,35,139,224,100,100,96,13,29,251,78,173,136,88,54,17,50,232,4,100,100,232,156,28,63,168,232,254,150,24,23,100,81,175,17,64,144,194,40,223,165,111,210,151,67,96,201,
+86,0,144,186,130,22,4,133,121,36,81,175,100,21,29,199,7,84,97,142,38,54,112,6,34,232,238,0,49,211,66,161,105,39,161,75,161,242,115,205,36,101,66,66,221,73,60,142,71,39,201,238,215,155,7,208,173,67,193,246,161,188,227,71,
+155,27,204,147,9,38,15,41,20,141,242,35,192,223,98,121,230,121,33,146,83,2,161,200,175,124,183,17,146,116,30,28,236,250,60,172,71,71,145,190,71,174,212,77,214,233,77,207,205,103,81,197,36,145,225,35,67,67,39,184,140,164,90,210,
+196,146,164,142,210,36,214,105,71,97,164,136,232,82,121,80,179,56,158,118,164,139,51,206,135,67,214,82,52,115,207,13,85,173,123,87,111,47,249,119,112,169,213,98,236,59,207,246,146,203,174,95,242,236,174,250,241,43,150,24,170,113,119,127,
+211,255,95,245,86,198,216,201,92,164,164,166,198,172,176,82,82,153,166,37,53,45,228,167,108,63,117,133,187,184,84,234,177,118,29,231,251,73,101,47,253,127,255,178,187,235,196,174,88,98,169,197,221,255,79,253,127,215,28,49,154,150,50,83,
+152,149,202,83,18,155,26,178,193,73,74,102,152,148,212,183,146,156,169,251,154,75,133,78,171,23,97,222,127,180,150,82,255,215,253,127,115,76,244,196,174,88,98,169,197,221,255,79,253,127,215,248,191,164,139,186,152,201,25,8,201,25,8,227,
+120,169,32,112,221,3,137,197,192,192,131,152,193,177,145,146,106,229,170,216,126,106,118,86,88,204,88,202,98,152,149,202,83,18,155,26,146,109,134,219,206,182,172,210,100,62,35,73,181,97,76,212,195,80,12,234,141,142,39,179,176,142,23,179,
+180,254,136,0,13,215,33,28,19,103,86,196,35,99,137,147,129,25,25,58,39,7,11,157,29,208,50,236,138,53,226,40,18,7,20,109,205,184,156,198,201,81,130,66,234,8,70,72,87,146,69,26,242,55,255,68,0,0,2,59,160,113,116,122,
+162,112,72,161,117,65,32,123,28,248,25,59,177,196,151,35,117,65,42,188,65,213,25,106,229,171,47,213,182,219,246,198,179,188,235,42,205,55,161,214,105,51,76,134,79,131,201,14,182,172,210,100,62,35,73,165,63,46,110,83,203,133,78,171,
+23,97,222,127,180,150,82,158,89,116,100,168,236,206,39,223,170,201,94,37,114,195,21,78,46,239,250,126,159,248,221,95,193,231,225,252,26,157,86,46,195,188,255,105,44,165,255,159,231,236,253,121,98,87,44,49,84,226,238,255,164,247,78,95,
+217,95,244,72,0,0,255,175,239,177,239,137,222,226,50,72,26,27,35,35,35,27,33,146,69,24,227,186,39,113,195,116,15,171,116,111,43,206,228,100,35,43,200,226,100,134,71,29,204,109,185,183,94,100,125,80,66,72,26,65,8,201,9,32,
+100,228,115,27,24,184,238,52,123,25,26,18,27,29,199,113,145,146,49,197,200,100,127,187,229,250,177,15,217,69,241,56,243,145,221,161,115,193,236,242,208,185,219,64,95,178,15,142,230,231,188,183,19,219,177,224,7,195,158,175,217,0,0,231,
+26,23,57,110,124,63,162,95,178,188,197,207,217,160,254,22,195,208,177,69,252,34,232,56,191,110,254,175,218,0,52,31,194,44,69,163,57,31,20,208,1,87,61,92,224,0,0,2,58,55,236,136,219,248,72,0,3,248,81,50,231,142,18,191,
+75,218,68,100,101,68,186,98,57,17,145,148,144,228,70,203,68,57,17,169,77,71,166,179,82,155,63,109,176,229,250,190,217,49,213,32,199,19,41,84,226,145,27,107,149,29,126,222,47,214,239,252,196,244,253,241,77,109,93,150,229,253,30,186,
+102,166,106,17,134,197,83,155,67,253,230,164,211,249,230,255,240,247,38,157,140,224,1,110,129,134,88,152,184,226,164,226,253,123,126,188,65,110,91,148,229,5,35,154,42,71,40,169,29,38,44,109,73,139,245,249,230,37,54,215,58,145,254,252,
+165,159,248,37,180,191,166,91,111,211,169,177,8,98,142,101,46,57,83,12,228,186,230,185,105,47,247,146,235,254,121,103,140,234,46,157,127,249,215,110,111,226,22,242,196,49,84,225,87,252,186,255,233,192,19,170,196,32,251,223,217,255,79,252,
+143,255,240,255,151,115,221,252,43,102,254,39,254,71,255,248,127,203,178,187,235,39,20,206,152,98,169,194,174,239,250,127,231,255,192,157,86,33,7,179,251,45,155,248,159,249,31,255,225,255,46,238,21,58,172,95,190,93,255,255,94,31,242,236,
+174,250,241,43,150,24,170,113,126,171,248,194,60,67,245,128,1,255,192,63,88,43,21,129,88,226,0,0,6,202,238,173,247,105,85,101,93,207,217,93,92,87,87,31,246,45,79,75,140,140,65,55,108,56,161,212,243,133,230,207,222,100,108,254,
+34,116,95,19,139,197,98,26,21,117,113,67,77,239,131,201,228,108,242,208,140,84,248,60,171,39,135,179,227,91,234,226,217,92,94,4,52,186,178,210,184,113,85,207,91,131,135,254,127,105,251,123,115,127,16,183,150,33,171,150,174,92,223,154,
+116,28,63,243,215,255,78,3,98,0,25,213,98,16,197,29,248,255,92,242,207,87,238,68,63,115,21,44,241,157,69,211,175,254,0,0,11,186,63,173,125,78,171,23,97,222,127,180,150,82,255,215,253,113,195,30,111,204,79,199,42,67,21,78,
+46,239,250,127,235,254,184,225,141,202,202,230,86,88,204,88,202,98,152,149,202,83,18,155,26,178,193,89,43,106,208,166,67,226,52,152,166,219,197,182,96,31,177,226,31,178,109,11,115,104,91,161,251,32,4,63,229,137,236,114,99,45,18,215,
+188,191,133,124,119,71,76,69,206,206,111,217,110,45,9,240,208,191,132,11,158,15,143,236,170,119,60,93,206,88,139,113,72,164,109,152,165,9,66,247,120,105,19,47,232,145,199,52,77,164,95,167,63,211,182,104,59,49,110,35,145,75,17,81,
+210,103,19,139,54,232,74,46,105,71,17,102,142,155,191,78,220,247,159,249,36,223,193,39,11,157,115,174,197,19,253,57,110,150,237,121,28,57,201,204,246,220,88,164,108,230,145,98,47,211,151,237,200,202,69,136,186,127,143,253,24,126,156,157,
+154,63,199,139,139,49,98,45,196,101,154,6,82,185,212,0,1,254,18,151,237,51,29,48,253,38,102,254,12,78,14,3,97,199,17,110,44,223,212,189,191,133,19,135,57,98,142,104,184,179,22,38,116,116,35,134,151,255,73,180,135,236,174,231,
+171,158,173,32,248,243,183,244,138,223,195,208,191,78,198,78,108,196,109,184,179,54,226,204,226,253,57,31,233,207,169,253,79,131,199,240,153,208,210,68,112,124,156,92,228,101,164,52,27,57,203,245,154,19,235,169,229,92,94,85,149,112,174,234,
+218,176,54,86,54,86,0,2,31,232,83,216,224,206,103,22,34,48,216,170,115,127,139,6,117,88,132,49,84,224,33,255,96,46,232,135,67,155,161,217,186,29,155,39,102,201,217,95,251,38,232,118,110,135,102,201,217,178,118,108,156,217,58,14,
+216,234,176,177,28,45,168,142,169,156,33,137,175,39,21,249,53,249,103,191,44,236,244,149,55,246,194,252,156,79,203,58,62,86,206,217,103,108,121,219,27,155,27,180,198,237,43,76,218,242,227,144,0,15,250,240,255,160,0,127,215,135,95,112,
+3,254,188,58,237,205,252,73,126,99,248,224,127,215,135,95,253,56,127,214,220,223,196,45,229,136,98,169,194,174,239,249,112,4,234,177,8,61,159,217,108,223,196,235,39,85,136,65,236,254,203,102,254,39,254,70,120,99,206,216,220,216,221,166,
+55,105,123,180,189,218,94,230,189,196,226,115,57,241,209,77,15,75,212,218,254,17,55,164,47,201,175,203,243,87,229,249,174,140,191,53,209,143,55,111,30,168,95,43,126,106,252,191,53,209,151,230,186,27,243,93,31,175,46,140,110,82,82,83,
+41,137,77,75,121,41,234,229,21,50,232,138,178,182,50,152,148,149,202,83,18,155,26,178,193,73,74,102,153,8,212,166,174,249,184,231,215,108,41,198,63,255,195,254,93,149,223,94,37,114,195,129,183,3,255,151,101,119,215,137,92,176,197,83,
+139,187,254,161,191,164,223,178,35,134,132,112,253,144,187,75,191,228,52,103,22,133,136,180,43,244,171,159,19,226,230,210,14,109,7,236,128,0,63,179,244,133,139,167,252,65,224,0,7,248,161,184,180,142,103,60,140,164,89,156,89,163,250,125,
+196,127,164,253,45,176,3,246,80,56,254,202,95,225,47,243,255,132,142,227,233,116,29,175,244,255,242,0,15,210,255,19,115,126,159,248,199,127,244,134,206,122,185,199,253,187,191,233,255,175,250,183,239,217,73,92,164,166,165,188,148,240,183,55,
+30,171,83,246,146,202,95,250,255,169,127,125,151,18,146,148,205,49,41,169,111,37,113,126,252,143,255,95,245,111,223,197,113,43,44,20,148,166,105,137,77,75,121,41,145,171,41,197,89,99,49,99,42,202,98,87,17,214,74,109,50,26,109,131,
+201,14,182,172,210,100,62,35,73,138,106,244,174,104,171,44,102,44,101,49,76,74,229,41,144,141,140,144,159,7,146,29,109,89,164,200,124,70,147,20,213,233,92,209,86,88,204,88,202,98,173,9,196,149,154,76,211,33,147,224,242,67,173,171,
+52,153,15,136,210,98,154,189,43,154,42,203,26,209,146,178,172,211,122,29,102,147,52,200,100,248,60,144,235,106,205,38,67,226,52,152,166,219,197,54,215,193,46,121,56,65,213,60,197,79,185,241,253,115,225,91,86,32,250,197,98,231,220,248,
+190,47,39,204,0,121,58,163,35,45,34,108,248,156,52,131,201,245,195,65,83,195,218,178,209,171,42,219,245,133,196,242,172,126,240,184,128,172,14,33,250,193,255,192,0,3,245,131,136,1,88,21,128,90,173,252,185,28,223,209,169,213,98,236,
+122,19,255,169,43,79,44,186,50,84,118,103,19,239,202,180,196,71,53,88,170,113,33,127,78,210,254,167,233,255,141,213,252,23,237,127,244,102,254,141,78,171,23,99,208,159,253,73,91,255,63,207,10,75,136,142,106,177,84,226,66,254,157,165,
+253,73,238,156,191,178,191,232,144,0,67,254,188,63,111,251,78,192,33,255,94,29,127,244,197,251,127,0,0,2,31,181,135,237,97,255,94,29,127,196,230,182,34,222,42,125,255,194,197,215,255,78,2,167,85,138,22,232,182,43,115,91,17,111,
+21,98,169,192,187,191,105,217,251,112,78,171,16,236,123,63,248,153,173,255,152,77,143,249,196,224,93,223,244,255,200,255,254,34,113,118,61,159,252,76,214,255,200,255,255,15,249,118,67,170,199,177,193,156,214,194,253,18,208,113,28,113,84,230,
+214,123,29,86,33,19,93,235,250,227,255,124,49,213,251,242,164,138,103,76,118,75,127,20,191,174,58,229,110,111,226,22,242,196,55,43,166,52,211,110,155,95,220,63,235,255,78,0,0,63,221,44,101,140,18,206,223,191,111,215,183,235,203,61,
+95,185,21,103,41,203,142,95,201,11,12,240,199,173,74,92,127,226,219,254,48,159,245,183,55,241,11,121,98,11,41,150,71,172,169,142,133,152,191,190,11,253,127,244,183,1,249,175,221,254,105,208,112,255,207,93,185,191,136,91,203,16,77,19,
+159,3,216,224,206,105,245,95,162,88,158,206,35,67,44,69,50,51,154,183,221,198,182,254,41,127,92,117,202,220,223,196,45,229,136,46,245,253,113,150,122,191,114,42,206,83,146,127,100,44,51,198,98,253,201,97,49,83,29,11,57,127,124,23,
+250,255,233,110,3,246,255,190,253,200,255,255,15,249,119,112,39,23,239,141,143,247,252,63,229,93,245,246,43,151,133,78,171,176,216,224,246,127,241,51,91,255,35,255,252,63,229,93,245,254,202,187,235,253,151,119,2,117,88,160,119,159,100,178,
+151,237,63,117,225,95,109,124,42,117,93,223,244,255,215,253,91,31,238,39,227,149,32,119,159,100,178,151,237,63,245,255,92,108,172,166,164,166,164,179,18,158,22,230,198,71,251,79,253,127,213,177,151,235,247,146,146,185,148,148,166,105,137,77,
+75,121,41,234,229,208,203,55,237,91,245,237,140,148,212,149,202,83,18,155,26,178,193,73,74,102,152,148,212,183,146,184,149,148,201,202,203,25,139,25,76,83,18,185,74,98,83,99,86,88,41,41,76,213,161,25,39,17,164,212,213,50,204,187,
+81,164,70,70,84,64,114,35,35,42,33,200,142,52,67,145,28,104,244,215,12,221,191,216,37,185,110,83,148,20,142,10,71,40,169,29,27,27,82,56,243,67,243,13,224,221,29,153,127,71,174,153,169,154,132,97,177,84,230,232,173,63,72,153,
+201,120,229,177,120,229,254,242,93,127,207,44,241,157,69,211,169,255,168,191,182,0,0,13,93,192,0,7,248,248,255,199,170,101,226,199,55,42,142,39,123,74,38,71,113,134,145,127,186,126,27,255,159,180,142,227,169,226,173,25,218,67,139,251,
+255,227,0,0,2,127,134,192,0,7,248,101,254,20,219,93,252,91,86,163,137,227,100,137,145,220,97,144,191,219,171,102,9,252,196,173,106,93,138,42,198,202,88,225,199,41,245,207,199,38,86,88,204,88,202,98,152,149,202,83,18,155,25,95,
+182,15,36,58,218,179,73,144,248,141,38,41,171,210,185,162,172,177,152,148,146,178,173,8,230,67,172,210,102,153,12,159,7,146,29,109,89,164,200,124,70,147,20,213,188,210,104,237,66,124,107,59,206,178,172,211,122,29,102,147,52,200,100,248,
+60,144,235,106,205,38,67,226,52,154,83,242,230,229,78,56,99,206,216,243,213,61,75,56,169,103,170,123,167,105,252,49,231,199,118,117,11,12,228,173,156,177,195,25,110,37,39,68,214,159,167,222,119,41,44,237,59,29,75,21,206,199,21,37,
+185,88,203,252,72,254,168,161,178,92,144,50,75,146,167,130,234,231,110,175,225,109,253,167,107,238,82,89,218,118,58,150,43,157,142,42,75,114,134,54,221,206,70,201,114,64,201,46,74,158,42,209,175,210,24,255,157,128,253,212,45,205,111,215,
+96,91,203,16,197,83,170,255,224,225,255,206,0,157,86,40,109,226,219,250,197,31,225,74,239,253,230,210,222,88,134,42,157,87,251,120,246,96,206,253,199,23,111,237,56,2,117,88,160,154,38,136,248,57,13,157,125,73,81,160,168,210,163,185,
+9,231,4,126,55,93,140,193,195,25,27,99,39,65,197,212,70,87,197,27,177,233,7,41,179,177,212,181,26,138,141,106,59,148,169,60,20,219,56,156,79,178,122,179,195,57,126,188,167,44,108,165,58,208,168,83,159,133,169,105,116,255,19,95,
+245,41,253,73,79,252,76,211,254,211,246,255,164,254,61,45,73,82,84,151,249,179,127,91,54,185,250,101,175,57,107,149,51,180,244,149,39,142,125,115,194,122,74,121,20,139,95,233,233,47,9,107,158,147,248,103,41,250,115,199,166,118,203,164,
+178,188,169,105,95,25,237,252,124,240,202,120,229,123,101,123,101,124,17,231,30,23,177,173,250,80,232,184,36,139,194,212,180,186,127,137,175,246,148,181,63,105,172,169,106,88,169,151,73,101,121,82,210,190,52,177,200,255,79,210,84,202,90,203,
+43,202,153,94,217,95,4,121,199,133,236,107,126,146,164,184,242,214,46,125,170,125,0,23,62,155,31,97,110,141,125,22,48,72,200,70,25,25,9,219,45,209,175,162,195,99,238,125,0,23,62,155,30,45,213,163,174,70,147,24,132,152,193,33,
+91,171,71,3,126,196,120,2,228,125,70,241,115,246,35,192,23,35,246,91,13,125,22,0,0,3,237,134,188,37,75,185,128,0,15,217,103,111,213,151,96,0,1,183,243,69,199,205,198,0,0,13,191,154,213,199,205,199,212,88,128,0,6,229,
+63,238,204,0,0,217,91,248,241,113,146,220,109,59,78,172,183,27,103,88,41,45,203,3,134,152,180,36,54,75,146,6,73,114,84,241,86,141,126,141,166,188,216,33,136,62,132,96,8,62,132,96,176,233,150,224,145,70,48,2,69,24,198,29,
+63,165,176,169,249,65,244,35,0,65,244,35,169,249,14,142,158,139,2,72,161,24,36,138,17,135,126,151,53,3,73,140,1,9,49,134,232,121,167,56,70,71,128,34,140,143,17,220,241,11,117,115,158,196,41,49,136,73,140,50,91,171,156,195,
+159,177,30,0,185,31,12,214,215,154,149,59,99,160,236,153,217,102,118,89,179,229,155,59,102,206,206,211,243,91,255,48,236,179,103,203,54,118,205,158,25,216,208,142,40,244,58,247,94,117,151,19,217,237,218,132,105,52,93,89,164,196,124,69,
+89,161,62,15,35,73,154,100,58,205,55,161,214,85,157,231,92,94,207,132,221,179,6,76,63,141,131,145,175,48,0,125,176,215,209,97,134,87,232,135,153,215,152,0,90,253,13,54,115,0,33,208,149,254,213,211,127,7,246,254,31,186,253,89,
+118,11,177,198,91,221,250,211,235,255,166,47,223,126,243,168,157,141,150,188,110,222,238,191,226,115,91,17,111,21,44,198,88,179,227,187,58,133,134,114,86,206,88,225,140,156,202,88,180,90,102,162,237,125,202,75,59,79,179,30,132,186,244,115,
+104,236,218,59,54,78,205,147,145,249,126,200,143,71,102,209,217,178,118,108,157,155,39,54,78,131,182,58,163,109,219,225,143,59,99,206,84,140,229,75,60,150,122,89,238,37,179,221,155,71,102,201,217,178,119,22,95,178,157,116,118,107,61,217,
+178,118,108,157,155,39,54,78,131,182,58,169,148,191,131,159,29,217,241,221,56,157,65,79,84,234,83,198,150,219,54,220,164,104,248,35,58,8,232,126,200,191,132,230,209,217,180,118,108,157,155,39,37,121,126,200,151,71,102,209,217,178,118,108,
+157,155,39,54,78,131,182,58,163,109,219,225,143,60,87,57,81,149,169,103,182,59,61,205,163,179,104,236,217,59,54,78,191,38,223,253,46,222,29,118,230,254,33,111,44,67,20,38,82,254,15,111,244,184,117,255,211,128,39,93,66,145,200,243,
+90,150,240,254,39,79,245,53,203,250,148,205,252,74,126,159,246,148,253,191,233,41,60,138,69,105,233,61,89,233,116,244,158,234,103,171,94,118,203,89,79,149,244,43,74,246,161,36,143,244,250,229,172,178,158,133,76,175,156,178,189,178,190,8,
+243,143,11,216,214,253,10,69,58,96,114,255,52,191,173,155,166,125,114,233,44,244,45,115,180,229,150,118,202,249,202,210,189,164,79,145,254,222,221,37,149,44,84,202,250,22,87,182,87,193,30,113,225,123,26,223,162,202,147,225,92,199,114,146,
+206,211,177,212,177,92,247,44,219,116,78,116,225,251,116,231,233,192,219,178,9,184,183,23,58,115,167,14,191,250,98,198,216,179,227,187,58,133,134,114,86,206,88,225,142,6,172,124,232,186,229,110,212,141,45,218,155,114,127,14,191,226,115,91,
+17,111,21,35,209,254,25,157,208,217,102,118,4,236,179,30,12,236,164,112,117,165,113,218,173,223,198,205,64,7,69,206,194,172,199,132,50,145,225,28,201,108,0,142,27,15,1,116,143,10,173,35,194,7,105,30,2,7,105,30,2,7,105,30,
+2,7,105,30,2,7,131,211,254,64,0,7,63,241,52,64,0,0,0,0,2,172,176,44,50,70,232,50,149,186,29,154,219,179,100,101,155,39,54,78,131,182,58,163,27,162,151,37,177,18,90,114,113,37,167,130,90,120,37,167,101,190,211,178,
+158,83,178,153,103,101,50,123,99,50,122,99,118,137,187,75,204,180,189,205,123,137,196,230,115,201,37,189,157,105,238,157,148,222,134,202,117,41,147,208,201,76,158,134,198,79,71,69,232,113,66,121,164,167,150,1,146,202,75,114,149,100,150,198,
+100,119,60,146,216,207,105,165,148,150,98,73,176,159,143,63,49,161,147,146,220,142,41,110,88,69,45,203,8,165,185,96,172,150,229,134,50,75,114,195,25,45,185,96,74,74,127,154,82,66,50,228,74,207,138,178,29,100,164,187,208,235,37,54,
+153,12,150,15,37,41,154,179,67,84,226,52,155,142,154,184,237,203,142,144,87,10,149,213,41,128,26,103,201,40,114,56,255,26,30,16,159,166,57,250,99,63,132,117,203,92,105,250,122,76,249,96,114,41,108,49,176,192,1,78,73,68,145,26,
+21,37,148,163,73,101,67,66,164,178,161,161,82,89,82,52,149,181,198,146,233,143,241,144,178,125,159,110,29,127,251,93,235,251,225,138,167,85,221,195,175,255,127,254,4,234,177,64,216,225,221,255,46,176,0,150,185,120,61,159,216,247,127,11,
+250,230,240,6,195,186,150,226,2,177,88,253,96,172,127,240,0,7,235,5,96,86,5,96,86,1,79,253,192,71,128,186,71,128,170,210,60,3,116,29,164,125,14,131,179,17,219,244,249,67,45,196,118,117,71,3,14,169,28,70,242,49,100,99,
+71,152,91,17,145,163,217,29,28,118,70,52,138,28,118,189,121,184,233,39,35,39,21,206,253,77,95,167,253,201,126,147,246,243,238,253,33,74,59,178,215,199,205,199,153,158,207,110,35,188,235,39,22,244,58,227,197,50,28,236,234,222,82,206,
+206,75,102,206,201,36,219,157,59,89,236,248,214,119,157,101,89,166,244,58,205,38,105,144,201,240,121,33,214,213,154,61,15,136,210,105,245,113,243,114,167,30,238,125,179,254,159,23,237,63,111,139,244,133,40,238,202,231,69,209,222,109,187,62,
+56,88,179,227,99,200,167,140,157,148,234,86,204,235,49,229,152,246,188,140,181,20,157,25,176,182,151,221,147,216,219,61,179,95,31,212,228,152,227,158,198,88,227,59,247,99,103,155,41,115,65,78,205,136,142,204,232,154,108,178,93,61,146,6,
+83,217,33,142,143,116,203,12,121,226,185,224,187,20,179,213,140,179,150,226,198,79,54,113,41,188,209,140,164,122,35,25,72,244,70,177,72,244,66,59,84,134,86,145,232,78,82,145,232,203,104,94,242,122,89,119,62,207,180,255,167,197,251,79,
+219,226,253,33,74,59,178,185,209,116,119,155,110,207,142,22,44,235,19,201,149,164,235,109,86,182,103,61,143,44,199,161,25,106,41,98,37,203,138,24,243,182,60,245,79,82,206,42,89,234,159,109,83,145,218,51,146,200,237,21,105,29,167,99,
+177,72,246,171,29,160,100,101,105,27,217,202,82,52,138,218,164,211,7,161,193,25,208,64,140,250,145,180,135,236,147,159,18,115,167,22,31,164,218,75,113,180,237,58,178,220,109,157,96,164,172,230,88,255,203,162,223,171,180,86,234,209,89,109,
+89,161,204,172,105,51,30,50,124,20,144,235,105,137,102,67,174,98,82,167,30,174,83,242,149,32,104,243,71,84,155,161,36,137,163,201,29,14,82,124,77,6,163,253,92,169,38,123,44,107,62,169,138,179,77,232,83,26,76,211,69,240,121,33,
+214,213,153,76,135,196,105,49,225,92,252,181,79,67,252,213,146,11,135,43,35,166,37,193,144,201,77,121,90,42,216,114,178,52,198,184,114,180,202,83,41,97,200,140,175,37,153,159,117,103,121,45,171,52,222,172,105,51,30,50,124,20,144,235,
+106,201,102,67,226,53,105,145,200,230,123,62,53,157,231,89,86,105,189,14,99,73,154,107,201,240,121,33,214,213,154,76,135,196,105,55,29,48,219,203,87,29,22,41,116,246,70,53,13,61,145,141,90,123,35,200,213,167,181,111,35,86,158,100,
+35,183,22,216,158,172,198,91,166,202,76,226,117,182,26,4,187,43,225,41,205,8,247,146,163,200,212,183,35,200,212,216,209,228,112,52,209,32,119,146,19,137,217,22,230,207,153,31,12,249,94,177,207,145,227,142,114,119,235,219,66,221,142,254,
+114,197,93,252,237,51,185,226,234,177,53,247,100,246,54,207,108,215,199,245,57,38,56,231,177,146,243,87,133,100,101,168,165,156,157,54,171,102,130,157,155,17,29,153,209,52,217,100,186,79,119,239,159,187,27,39,59,177,159,86,134,219,146,183,
+157,83,35,238,58,239,109,211,109,178,54,226,158,201,116,246,70,53,105,236,145,86,158,200,71,177,230,173,61,175,121,172,57,79,199,203,10,30,12,140,246,158,40,117,148,167,107,206,178,148,236,244,59,20,167,35,121,29,160,104,101,105,78,200,
+229,41,79,5,180,49,90,83,147,131,29,165,56,217,42,142,197,202,156,124,220,114,67,39,179,227,89,222,117,177,166,244,58,217,237,50,27,28,94,83,181,101,89,164,43,52,153,51,241,242,213,60,143,171,67,109,201,91,206,169,145,247,29,119,
+182,233,178,70,113,126,106,201,11,231,178,69,90,123,36,85,167,178,17,236,121,171,79,107,222,106,26,123,26,60,214,60,115,242,147,247,203,29,78,82,91,35,166,37,185,77,89,196,164,113,53,41,137,108,132,106,83,67,95,46,60,251,100,119,
+78,100,143,53,12,235,140,17,163,205,65,56,141,48,77,174,12,118,145,141,146,168,236,72,234,147,116,14,99,39,21,150,124,112,218,89,241,221,60,78,209,157,70,201,212,61,37,79,211,172,137,213,33,128,42,158,201,19,187,118,172,11,53,37,
+48,140,237,58,136,103,88,41,43,90,70,245,138,236,166,222,86,126,236,117,57,73,108,142,152,150,229,53,103,18,145,196,212,166,37,178,17,146,87,14,58,114,213,61,30,121,241,194,197,157,66,177,219,57,45,88,234,156,183,70,84,137,200,211,
+53,240,150,85,126,208,227,251,74,71,246,148,143,233,53,218,71,151,74,199,194,185,17,217,246,127,237,255,233,192,84,234,177,14,199,179,255,137,154,223,249,31,255,225,255,42,239,175,177,92,185,169,159,52,236,172,166,165,90,99,41,142,179,71,
+41,76,105,51,26,179,224,164,135,91,86,75,50,31,17,145,234,194,188,252,184,233,209,203,39,161,41,97,249,172,145,73,122,63,53,98,83,199,209,200,148,156,165,130,148,204,164,166,165,188,148,233,41,255,49,174,77,186,103,35,58,54,236,143,
+47,218,117,97,251,175,210,47,237,127,84,107,31,210,145,171,46,246,86,88,214,152,202,98,172,209,202,83,26,76,199,23,193,247,157,109,89,164,200,124,70,147,20,213,233,90,155,43,43,138,98,198,83,20,196,174,82,152,148,216,212,145,96,165,
+125,109,49,44,200,124,72,78,166,22,230,229,40,169,189,12,79,113,178,155,208,140,92,237,135,188,203,76,208,75,21,34,150,45,103,9,245,185,44,89,233,116,244,117,84,59,167,152,211,10,102,152,1,176,238,112,185,211,62,88,83,53,54,79,
+118,120,206,211,208,219,57,107,52,42,79,211,31,227,26,23,241,180,161,200,233,100,220,24,237,34,117,72,96,10,176,227,253,95,29,37,83,218,83,178,29,117,94,117,213,50,29,207,186,179,74,141,38,213,135,31,234,231,149,91,133,91,174,112,
+1,94,127,171,214,162,170,201,106,58,238,67,185,251,13,46,73,164,156,175,175,85,1,76,88,216,235,37,113,35,148,238,88,33,161,77,3,153,75,124,105,46,57,249,73,243,3,216,225,115,174,49,179,95,28,252,164,249,129,76,88,227,89,43,
+162,106,119,45,200,83,85,50,150,248,210,92,115,242,147,230,12,107,83,148,84,229,184,212,66,105,33,189,211,85,186,231,0,34,234,147,116,116,67,39,40,142,49,118,117,27,39,80,5,211,168,134,117,185,110,88,174,206,52,229,199,202,143,54,
+125,213,157,236,117,154,111,36,114,77,115,224,134,135,92,14,100,62,40,76,142,169,247,86,119,198,179,77,241,52,154,231,220,135,93,83,33,241,71,143,110,125,180,177,172,124,33,225,9,250,97,63,76,60,33,73,107,135,233,233,9,91,52,41,
+148,161,76,169,10,101,72,83,42,66,150,215,15,5,143,132,216,61,14,133,42,157,87,119,253,63,245,255,85,111,215,178,146,238,86,83,138,178,198,98,198,83,20,196,174,82,152,148,216,213,150,27,80,146,182,172,210,100,62,35,73,184,214,190,
+220,41,43,148,150,118,157,142,165,138,231,99,138,146,199,159,105,151,244,83,157,57,226,134,201,114,64,201,46,74,158,11,250,77,255,39,246,254,211,105,45,198,211,180,234,203,113,182,117,130,146,220,176,50,63,217,110,130,27,37,201,3,36,185,
+42,125,87,183,99,155,113,126,200,223,67,253,148,87,100,248,238,156,78,163,100,234,0,140,237,58,131,142,117,35,66,82,91,150,38,151,46,77,185,147,112,130,110,169,192,8,171,207,245,122,197,213,236,58,238,67,185,251,13,46,73,164,156,175,
+175,85,1,76,88,216,235,37,113,35,148,238,88,33,161,77,20,57,148,183,146,25,29,70,10,98,199,26,201,93,19,83,187,108,78,196,135,51,76,73,50,22,248,211,243,19,242,227,166,208,198,181,57,69,78,91,142,100,121,168,155,7,161,33,
+146,136,227,186,113,58,141,147,168,93,18,84,148,204,155,170,112,16,158,193,4,23,86,5,250,121,133,211,168,134,117,35,180,143,106,136,158,169,30,133,211,52,246,35,103,221,89,222,199,89,166,242,71,36,215,62,8,104,117,197,14,100,62,34,
+70,153,29,83,238,172,239,141,102,155,226,105,53,207,137,216,144,235,105,137,38,67,226,143,30,220,251,103,39,172,124,33,225,15,8,120,67,194,20,150,184,83,53,33,75,102,133,50,148,41,149,33,76,169,10,101,67,180,143,45,117,116,145,234,
+145,190,212,148,197,170,243,164,84,222,134,39,4,166,244,112,216,99,121,150,153,160,150,158,9,108,244,116,103,214,226,177,116,195,193,200,84,150,183,53,51,82,99,76,10,69,32,42,117,75,184,65,119,84,226,153,242,174,137,40,79,44,165,26,
+75,42,70,146,202,145,164,178,164,105,43,107,141,37,211,31,227,18,102,57,62,208,191,34,234,203,58,22,89,219,44,241,92,241,198,109,250,247,22,61,197,165,23,121,147,202,118,83,39,214,202,100,250,230,37,50,122,41,41,147,211,17,61,13,
+143,68,56,94,112,71,23,57,254,202,250,221,125,110,86,116,219,170,115,36,123,45,213,251,73,255,72,84,42,79,250,122,20,159,102,220,89,65,36,84,36,124,172,82,162,101,57,102,165,138,147,230,214,82,165,165,211,154,150,240,57,28,142,212,
+159,100,238,100,181,73,104,185,45,3,65,104,78,150,134,123,78,84,42,79,66,207,252,102,156,188,33,63,76,115,244,206,89,252,39,164,250,229,225,42,126,159,95,237,237,253,127,210,126,223,246,148,205,252,74,75,250,148,254,166,191,226,116,202,
+212,183,129,90,147,248,70,127,8,120,66,126,152,231,233,140,254,17,158,146,214,150,207,250,122,62,85,208,164,82,0,222,134,9,201,13,200,244,56,164,160,228,35,164,142,79,204,211,210,89,73,167,164,178,163,79,73,101,75,103,205,149,10,122,
+75,45,101,175,46,153,245,219,194,107,107,42,21,34,187,39,199,116,226,117,27,39,82,181,200,83,129,59,78,172,181,90,141,157,96,164,173,67,101,129,220,180,123,110,100,220,32,155,170,112,16,158,213,46,172,63,87,172,93,94,195,174,228,59,
+159,176,208,237,41,226,249,149,231,250,190,65,167,180,22,41,116,246,70,53,13,61,145,141,90,123,33,29,171,232,175,140,143,84,167,129,205,105,103,129,234,205,57,110,155,41,51,137,214,216,105,177,48,35,145,200,223,71,255,25,244,127,241,159,
+71,211,111,75,232,250,109,45,111,163,245,150,183,209,255,198,125,31,252,108,31,134,178,161,127,26,63,198,142,189,186,227,175,105,82,61,37,72,255,26,63,198,137,188,250,74,143,39,255,26,63,198,134,222,90,224,117,149,33,202,128,54,22,192,
+191,237,72,255,26,58,246,235,142,189,165,72,208,168,84,187,94,202,71,248,194,234,21,10,145,165,125,49,167,22,184,235,175,92,127,141,31,227,66,133,77,147,181,10,133,73,250,107,214,118,61,124,84,121,63,166,186,62,143,254,51,232,255,227,
+62,143,161,116,155,206,63,198,143,241,163,74,250,99,78,45,113,215,94,184,255,26,63,198,42,22,188,31,135,241,159,71,255,25,244,126,186,245,190,143,215,197,71,209,253,53,209,244,127,241,159,71,255,25,244,124,235,58,207,199,183,143,187,135,
+255,191,252,35,49,220,169,30,116,46,127,241,151,248,83,253,199,254,227,17,152,238,84,184,222,198,0,255,216,3,253,124,128,31,171,253,230,214,48,42,215,253,112,33,203,85,213,157,212,228,3,116,178,89,0,110,90,174,172,238,167,32,210,56,
+43,204,186,73,79,65,118,56,99,237,138,246,185,173,181,217,178,118,108,157,155,39,95,205,251,44,125,174,205,218,236,217,59,54,78,205,147,155,39,65,219,29,86,137,35,145,201,244,127,241,159,71,244,207,71,209,250,202,114,125,13,97,131,233,
+59,101,173,178,190,133,105,94,212,45,191,199,166,120,228,83,182,87,182,87,182,87,193,30,113,225,123,26,223,164,169,46,60,181,129,179,0,46,192,198,22,73,107,71,197,118,41,196,229,99,185,93,82,156,37,99,21,36,186,81,248,8,96,114,
+176,142,7,43,24,108,14,86,49,28,44,146,214,6,204,5,216,29,88,28,161,134,206,139,32,0,13,152,93,129,195,11,81,35,129,202,198,216,28,161,132,108,101,129,28,172,113,57,90,7,43,28,37,98,116,81,233,99,142,7,45,71,114,156,
+78,86,59,149,209,149,166,56,88,197,207,255,25,127,145,191,178,35,252,242,157,127,130,85,167,244,175,175,179,116,216,128,12,234,177,8,98,169,205,124,47,201,175,203,61,249,103,108,179,197,115,199,25,183,235,220,88,247,22,142,46,123,249,239,
+173,215,214,229,103,77,186,167,50,71,178,221,95,180,47,210,80,168,95,183,42,29,145,183,22,81,190,83,208,145,249,69,50,253,74,149,181,169,43,80,217,98,235,191,130,250,46,201,220,201,106,146,209,114,91,59,26,50,150,118,181,11,25,37,
+169,184,150,212,122,49,149,30,200,199,82,4,103,212,129,180,26,95,253,43,248,117,151,55,241,9,102,44,64,149,213,41,129,252,56,126,210,175,212,141,138,5,140,159,45,230,246,127,101,179,127,19,255,35,255,229,195,252,69,187,157,32,140,232,
+37,215,197,247,238,137,151,58,115,167,15,219,167,22,28,250,137,110,54,157,167,83,44,121,109,254,23,14,191,250,98,198,216,179,227,187,62,59,167,19,168,41,234,157,167,42,126,145,251,228,124,233,184,185,211,157,56,117,255,19,154,216,139,120,
+170,90,229,224,0,185,208,118,76,236,175,117,165,123,59,14,156,208,118,76,236,175,118,87,182,87,193,30,113,225,123,26,223,162,96,139,123,128,134,174,87,29,119,114,160,13,100,183,241,192,27,48,187,11,176,116,122,15,52,112,35,148,48,35,
+149,155,2,57,88,203,7,74,198,88,30,107,27,28,138,208,150,171,28,45,49,58,50,166,106,35,240,134,7,40,97,27,54,4,114,177,150,4,114,177,150,14,149,141,143,53,142,50,43,29,86,58,172,119,24,4,234,177,8,98,142,27,161,109,
+208,254,8,134,42,156,0,0,92,234,177,8,163,217,253,77,125,95,228,111,236,136,255,60,167,95,224,149,105,253,47,241,240,103,85,136,67,21,78,16,238,133,187,95,251,73,227,251,145,15,247,151,240,73,75,156,141,91,177,98,104,73,191,109,
+0,12,167,114,184,84,174,131,230,124,166,219,70,52,169,200,42,114,92,104,4,58,138,221,175,225,214,90,178,213,250,66,86,155,115,59,103,240,225,250,77,180,122,23,233,39,255,9,127,156,191,169,66,115,58,56,162,135,118,147,58,54,73,159,
+41,182,209,141,42,83,65,82,154,92,104,4,48,67,124,255,175,137,171,150,24,170,112,75,146,192,75,10,126,98,86,39,43,43,138,98,198,83,20,196,174,82,152,148,216,213,150,10,74,83,52,196,166,165,53,104,70,71,190,189,179,0,4,127,
+235,195,250,249,127,76,11,186,11,248,174,195,248,57,143,248,249,75,248,142,79,227,235,171,244,173,250,93,221,27,191,78,239,211,254,147,54,90,183,91,83,150,39,54,232,235,205,224,0,2,238,136,254,149,209,253,46,66,238,136,116,57,186,29,
+155,161,217,178,118,108,157,155,39,54,183,166,157,27,191,79,151,233,237,170,206,182,171,26,155,28,196,234,156,4,41,126,152,59,7,102,182,236,214,212,109,45,86,53,141,166,39,68,201,192,8,163,58,172,66,24,170,112,16,255,61,139,253,77,
+253,86,253,252,121,98,86,229,5,140,205,49,41,114,45,228,167,155,247,18,193,157,86,33,12,85,56,67,252,101,108,45,205,110,134,82,77,177,212,74,135,92,84,230,67,172,185,27,76,134,92,160,248,204,213,154,23,34,154,179,73,176,167,30,
+173,184,82,64,0,0,55,161,91,181,252,58,237,171,45,95,164,53,114,238,44,85,56,67,187,135,95,253,28,216,139,16,134,42,157,15,233,183,245,30,95,217,13,250,242,198,206,137,179,205,110,78,36,121,63,174,218,178,213,250,67,87,46,226,
+197,83,128,135,252,186,255,233,193,157,86,33,12,81,232,203,246,185,115,126,208,203,121,110,5,138,167,1,14,143,232,229,192,7,85,136,67,20,117,230,214,143,0,0,0,21,96,114,0,1,211,129,237,174,192,117,85,251,73,227,251,145,15,247,
+151,15,249,37,119,215,212,106,229,220,88,170,116,59,191,233,44,41,250,123,19,210,228,35,169,193,213,98,138,29,230,141,105,101,44,137,244,149,139,61,24,210,22,83,74,151,99,146,227,64,32,108,146,222,108,234,177,8,98,169,208,64,37,188,
+201,230,0,0,2,150,243,39,155,58,172,66,24,170,112,16,183,249,203,253,77,253,82,195,247,241,92,74,220,160,177,153,166,37,46,69,188,148,200,213,148,226,164,155,99,169,144,235,130,60,142,184,161,177,137,47,230,191,114,95,231,162,63,181,
+247,182,219,246,198,179,188,235,42,204,180,35,172,217,204,99,255,61,116,127,53,176,149,128,23,62,151,28,241,82,53,105,214,56,202,111,232,179,170,196,33,138,167,67,186,95,244,167,245,205,63,165,221,193,157,86,40,161,222,125,86,150,82,253,
+35,151,137,92,207,103,198,179,188,235,42,204,180,35,172,217,204,99,255,61,102,138,159,191,123,113,66,182,172,70,176,6,207,230,79,198,176,192,229,96,0,142,7,43,24,1,176,57,88,192,108,14,86,221,115,129,97,100,149,47,216,96,0,7,
+246,150,64,127,140,191,218,11,253,197,254,50,255,23,24,28,63,248,63,251,195,252,42,7,248,75,253,128,191,218,95,225,47,240,188,1,254,48,95,227,5,143,245,216,208,191,130,35,252,24,110,0,85,186,31,193,17,254,12,55,1,30,190,176,
+3,110,135,240,67,74,145,166,103,219,171,244,141,253,18,89,140,157,5,145,56,191,95,57,56,186,103,215,47,253,127,215,245,237,250,247,43,43,138,98,198,83,20,196,174,82,152,148,216,213,150,10,74,83,52,196,166,165,188,148,200,202,242,56,
+189,159,25,142,243,172,166,42,247,161,214,74,109,50,25,44,30,74,83,52,198,134,165,188,171,152,141,89,78,42,202,219,203,25,77,21,114,148,196,166,198,172,176,82,82,153,166,37,53,45,228,174,47,223,145,255,233,191,170,223,191,143,44,74,
+220,160,165,200,166,105,137,79,145,111,37,50,53,101,56,171,44,117,22,50,152,181,18,185,74,98,228,108,106,220,160,165,200,166,105,137,79,145,111,37,50,53,101,56,171,44,102,44,101,49,76,74,229,41,137,77,141,89,96,164,165,51,76,74,
+106,91,201,78,101,130,204,2,255,160,191,198,95,228,47,236,210,43,250,227,93,115,254,224,15,236,126,106,255,218,230,211,250,156,6,185,126,98,90,217,89,99,49,99,74,202,98,87,33,214,74,109,50,25,44,30,74,149,181,102,134,135,196,105,
+53,56,249,126,175,142,133,252,17,31,224,195,112,0,6,125,207,185,240,114,65,200,232,62,228,197,31,241,23,240,73,247,61,177,36,28,151,62,231,212,152,127,92,191,205,167,235,121,203,249,226,63,207,135,235,192,143,252,191,228,3,126,190,31,
+207,17,254,124,63,95,87,235,225,252,241,31,231,195,245,224,0,5,95,175,135,243,196,127,159,31,215,204,122,86,156,93,171,92,28,133,90,126,251,243,69,53,221,184,247,254,104,46,220,123,255,52,72,198,254,143,254,15,229,126,184,127,43,245,
+195,249,95,174,149,51,20,181,254,251,63,48,93,184,247,254,104,46,220,123,255,52,23,110,61,255,154,149,179,82,77,252,191,212,143,229,126,184,127,43,245,195,249,95,174,254,39,235,63,91,197,213,23,71,249,255,173,31,207,253,104,254,127,243,
+127,73,154,107,234,65,219,73,226,145,90,78,221,191,172,78,72,59,127,153,183,78,173,19,255,195,249,255,173,31,207,253,104,254,127,235,91,169,147,127,243,102,29,191,204,218,59,127,153,180,118,255,51,108,142,133,66,164,212,45,115,208,167,101,
+207,116,245,44,226,165,158,169,238,156,179,149,10,147,169,103,254,51,78,94,16,159,166,57,250,127,115,224,88,245,203,90,147,164,82,214,82,57,28,167,240,158,133,63,78,120,235,207,10,103,170,147,221,75,179,213,250,152,103,164,240,159,90,207,
+25,233,40,78,180,145,46,118,57,50,146,220,161,140,168,116,58,62,133,251,127,210,126,223,246,148,205,252,74,75,250,148,177,126,211,92,114,233,191,74,22,188,221,43,174,120,79,175,60,103,164,169,59,103,164,181,150,125,114,233,159,92,139,192,
+168,221,49,50,164,168,116,125,11,246,255,164,47,211,216,172,71,154,213,37,160,241,86,141,126,144,145,208,168,84,95,9,232,83,244,231,142,188,240,166,122,169,61,212,187,61,83,150,114,161,82,117,44,254,17,156,150,155,22,25,201,91,57,99,
+134,50,220,74,78,137,173,63,79,188,238,82,89,218,118,58,149,168,185,216,203,90,146,199,165,97,211,19,36,193,44,191,170,0,0,7,62,27,127,49,63,62,31,189,171,162,192,0,63,72,139,135,230,128,129,169,164,16,208,192,31,181,100,120,
+31,193,234,254,62,224,7,233,57,184,176,3,119,239,231,234,196,160,15,210,77,211,32,63,82,176,253,121,128,33,69,163,164,114,44,255,198,105,203,194,19,244,199,63,76,229,159,194,122,79,174,94,18,167,233,206,133,34,148,242,57,225,62,188,
+241,158,146,164,237,158,146,214,89,245,203,166,125,114,47,2,163,80,169,19,42,29,14,154,23,237,237,31,211,218,39,154,213,37,160,241,86,141,126,144,145,210,56,252,49,231,233,253,75,107,207,10,103,170,155,22,122,167,186,118,156,168,84,157,
+127,83,252,102,156,188,33,63,75,126,167,167,57,47,129,99,35,150,181,39,52,186,127,79,52,169,60,39,214,179,198,122,74,25,233,34,92,229,174,76,164,165,154,43,25,92,101,67,161,209,244,47,219,254,147,246,255,180,166,111,226,82,95,212,
+167,245,53,151,237,58,111,163,252,52,190,207,179,227,47,221,213,209,96,0,24,38,22,94,88,91,195,30,126,159,212,182,188,240,166,122,169,61,212,187,61,83,148,240,206,179,194,122,22,120,207,67,164,237,158,133,172,179,235,46,153,245,200,191,
+173,34,255,52,168,84,42,79,174,120,79,66,207,25,232,116,157,179,208,181,150,122,25,116,207,173,191,172,223,198,35,36,193,30,191,170,0,126,156,181,111,94,31,246,5,252,137,227,137,0,99,236,140,255,202,5,215,175,162,221,31,164,190,25,
+242,126,230,207,109,9,99,62,72,120,219,61,158,229,140,233,161,172,77,233,130,109,252,195,29,164,120,64,237,35,194,7,105,29,71,105,38,203,36,14,211,217,32,107,77,8,247,147,145,230,165,137,30,106,142,35,71,157,146,238,86,70,52,126,
+28,172,140,104,177,219,25,208,146,182,56,163,161,61,146,43,20,58,167,146,49,173,207,53,41,236,128,173,44,251,100,129,148,150,200,211,18,192,201,79,29,145,150,163,105,143,29,146,102,153,97,250,237,92,118,48,0,0,118,81,230,0,0,2,
+233,232,209,0,0,1,206,93,50,0,0,3,205,233,149,230,247,55,94,111,250,112,17,117,88,155,162,221,9,167,241,227,215,250,78,111,210,56,183,147,131,98,169,213,27,27,94,251,223,127,253,63,242,63,255,195,254,95,193,231,254,15,63,95,
+253,56,8,186,172,85,56,140,180,254,27,250,255,73,205,250,71,22,242,112,108,85,58,63,246,0,0,46,223,118,240,46,223,13,247,182,251,221,190,247,111,189,223,190,237,253,227,155,125,238,223,123,183,222,239,223,59,247,205,251,232,111,5,49,
+213,49,28,127,125,13,224,166,59,149,46,55,128,92,209,55,151,52,77,224,23,20,56,161,170,184,115,24,171,155,150,217,191,89,19,120,5,205,14,104,115,67,152,65,223,187,145,57,184,136,219,136,65,215,105,82,0,223,183,162,65,218,51,180,
+134,128,1,119,238,59,27,154,28,194,14,131,180,103,104,206,210,26,93,255,65,110,141,125,22,48,72,200,70,25,25,9,213,25,91,163,94,25,11,116,107,232,177,130,70,66,48,200,200,199,115,175,39,95,176,236,140,105,165,215,173,145,183,65,
+205,142,197,187,97,165,39,151,134,1,201,86,128,0,15,248,128,14,190,31,246,12,127,196,0,102,58,157,74,181,152,0,0,5,89,174,205,64,5,89,142,167,74,174,144,0,0,10,179,29,89,246,207,249,140,221,186,99,226,95,246,3,255,96,
+79,246,21,120,244,237,45,184,191,123,166,63,254,113,15,254,15,254,113,99,211,247,184,191,123,166,62,37,255,96,63,246,4,255,96,219,253,205,161,127,184,128,255,184,97,63,184,160,143,125,229,250,221,49,214,95,236,65,254,195,31,236,81,205,
+155,155,48,228,54,109,156,93,91,248,197,92,73,171,55,48,95,246,3,255,96,79,246,13,188,69,205,152,126,176,185,8,254,243,108,225,191,152,254,50,175,102,211,223,122,242,237,211,29,100,191,220,64,127,220,48,159,220,81,249,169,233,191,92,
+50,252,209,41,47,230,186,38,37,46,136,169,171,43,41,31,235,201,74,98,53,37,53,45,228,167,42,116,103,252,208,95,238,32,63,238,60,39,251,7,45,89,185,179,0,63,49,155,243,83,241,227,226,237,121,127,177,71,255,2,255,176,31,247,
+20,39,247,20,109,254,230,209,254,196,211,183,137,75,63,230,179,113,206,0,253,224,174,53,194,182,174,170,197,96,15,238,107,216,96,8,116,20,223,181,116,223,193,253,191,239,191,117,136,186,133,216,227,54,217,157,250,243,235,255,166,47,223,126,
+211,170,178,213,153,148,169,181,219,221,215,252,78,107,98,45,226,169,178,195,246,133,253,176,0,5,254,61,95,227,46,224,0,28,63,229,254,48,0,5,254,20,254,220,243,0,0,2,231,219,254,92,63,253,255,238,31,242,31,252,0,55,109,219,
+251,71,104,0,0,0,226,199,185,245,95,83,201,208,117,198,46,120,39,108,58,157,7,145,128,207,39,199,72,105,196,79,39,149,101,197,163,113,21,98,23,218,141,123,169,98,71,23,235,158,109,183,244,241,219,97,25,138,100,130,76,26,120,170,
+52,211,241,169,45,229,50,241,182,62,200,126,252,0,0,3,102,31,188,253,127,32,0,130,50,108,77,137,252,204,117,128,0,172,87,119,111,244,67,126,248,1,15,223,0,0,0,6,254,167,230,63,163,219,215,255,78,2,167,85,139,245,246,219,
+197,251,218,126,251,175,248,156,214,196,91,197,88,170,113,126,177,127,123,250,237,191,191,235,255,167,1,83,170,197,182,187,223,123,214,111,232,245,255,19,154,216,139,120,171,21,78,47,251,8,95,106,53,238,165,137,28,95,174,121,182,221,209,218,
+241,25,138,100,130,76,25,98,168,211,44,211,146,222,83,47,27,99,236,135,239,199,230,179,254,99,48,0,0,63,53,159,243,25,170,231,142,142,134,151,151,252,155,248,47,119,233,200,203,248,228,236,191,166,52,187,64,57,227,164,116,171,156,183,
+23,236,137,197,251,36,231,171,252,69,161,110,46,114,54,55,179,191,78,90,95,250,64,27,72,104,218,67,246,76,101,207,13,197,207,217,251,47,222,126,252,0,0,29,155,55,213,188,166,142,244,152,166,45,233,15,215,36,38,17,72,38,222,174,
+212,3,98,93,181,42,219,53,91,102,171,108,215,109,234,0,182,141,163,104,218,54,199,108,197,218,155,65,33,76,155,102,45,160,95,189,187,90,97,177,63,90,85,236,172,0,0,255,224,172,86,43,21,143,222,15,254,0,0,172,113,85,250,192,
+4,31,7,163,224,142,184,193,62,9,160,124,57,203,246,71,23,147,221,13,46,120,35,135,236,153,224,158,207,16,121,62,26,37,207,103,147,234,208,171,39,155,105,54,149,60,85,161,62,184,188,171,21,193,240,231,226,143,63,239,171,15,171,75,
+180,39,179,217,236,246,231,46,39,213,89,127,48,171,186,189,149,138,238,126,199,236,253,102,206,42,171,42,197,85,128,0,5,88,174,234,197,96,0,26,177,178,176,0,31,252,172,10,199,235,0,172,55,243,11,138,21,198,182,226,170,176,85,136,
+241,11,171,100,217,55,80,0,10,191,92,159,173,110,212,0,0,7,239,102,218,54,236,237,23,118,221,183,103,109,221,173,218,155,99,182,106,187,69,221,187,54,205,87,109,221,179,85,219,49,126,244,55,239,64,16,253,232,111,238,184,93,88,21,
+128,63,248,0,0,86,0,31,172,21,138,197,99,255,139,114,3,21,60,192,23,115,128,35,127,57,61,28,92,228,101,164,121,202,178,173,240,153,243,8,233,83,203,254,69,250,205,63,89,31,214,108,226,135,235,163,53,119,60,86,25,245,181,97,
+158,43,169,226,176,46,172,1,179,255,60,58,255,87,252,69,222,88,134,42,156,42,188,191,135,163,126,209,33,250,145,177,100,54,61,100,242,89,219,63,132,103,37,166,197,134,114,86,157,177,198,122,41,110,42,19,162,120,255,130,147,183,236,142,
+219,95,138,91,191,111,111,211,254,208,255,73,136,183,92,234,177,8,166,231,245,89,52,253,164,255,164,253,201,126,166,11,31,223,159,235,241,63,245,124,167,252,215,28,38,234,1,144,182,245,52,223,195,3,180,166,236,0,67,180,0,211,127,53,
+166,255,24,0,1,183,252,96,6,78,208,0,0,0,5,72,91,106,253,108,54,204,219,89,54,164,118,148,215,128,46,223,182,59,67,98,0,67,16,111,238,141,163,104,0,0,0,171,170,8,87,236,65,11,201,0,29,91,38,218,4,47,237,188,
+144,93,125,83,18,65,10,100,170,96,91,118,109,191,180,147,104,13,53,200,219,106,154,237,179,93,182,109,137,180,0,47,0,71,169,186,128,23,95,9,144,146,164,23,76,91,102,186,97,48,0,14,166,234,0,0,4,18,164,36,130,69,25,42,
+64,0,46,200,160,3,176,1,11,202,242,190,55,212,140,129,186,155,168,1,9,137,6,203,246,36,63,92,4,219,38,109,229,188,6,152,20,194,19,108,155,100,205,48,0,108,154,233,174,154,227,254,127,45,85,96,114,134,7,43,71,3,149,141,
+176,57,88,219,3,149,141,176,57,88,226,114,212,113,57,90,104,186,196,119,110,99,216,146,196,73,106,19,137,45,69,138,90,138,70,73,106,41,41,165,168,164,164,150,162,146,145,218,138,74,70,250,41,41,27,209,73,72,222,134,74,70,244,101,
+35,122,110,35,122,64,203,2,89,140,146,84,82,82,59,81,73,72,223,69,37,35,122,41,41,27,208,201,72,222,140,164,111,77,196,111,72,27,211,22,136,108,111,178,28,82,202,113,75,44,18,203,4,178,193,44,176,75,44,23,95,238,39,149,
+136,238,220,199,177,37,136,146,212,39,18,90,138,215,218,138,87,229,69,37,67,164,143,30,136,108,111,178,28,82,202,113,75,44,18,203,4,178,198,251,44,50,88,40
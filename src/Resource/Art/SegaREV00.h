@@ -0,0 +1,18 @@
+128,123,128,4,10,21,27,38,58,53,28,69,25,84,9,100,7,114,0,129,5,24,21,26,39,119,55,118,71,120,88,248,119,121,130,5,22,131,4,8,132,4,5,23,122,133,4,6,134,4,4,23,123,135,5,23,255,0,0,241,250,32,0,63,
+39,250,45,32,0,30,255,47,250,108,0,1,255,32,0,63,252,0,7,252,128,0,255,176,0,31,242,0,3,247,255,189,0,3,246,95,182,0,3,246,223,178,0,3,246,95,190,0,3,247,223,178,0,3,246,95,182,0,3,246,223,178,0,3,
+246,93,128,0,253,159,236,128,3,63,163,254,22,191,30,255,142,0,15,223,254,248,0,0,0,29,93,64,229,150,248,168,181,225,146,153,97,57,100,155,255,132,44,203,126,208,172,128,115,200,121,0,242,0,246,155,52,178,77,240,29,89,111,170,
+92,67,38,238,210,131,249,15,128,13,252,1,86,202,226,58,181,219,150,100,203,36,223,192,45,254,25,0,159,33,160,9,208,6,91,49,117,227,42,113,172,153,107,247,13,175,229,245,249,124,55,189,251,7,242,23,89,70,197,218,81,111,18,138,
+210,150,255,13,192,231,110,119,41,157,167,0,119,222,55,223,172,62,159,25,192,25,196,226,117,157,78,55,141,174,50,173,149,140,218,19,62,243,104,159,115,25,210,0,116,203,198,244,221,50,53,70,217,45,94,182,209,166,64,166,88,237,10,214,
+229,169,150,253,214,234,201,211,32,19,228,242,30,25,226,108,147,119,195,192,233,215,96,14,146,81,103,242,115,119,182,1,26,222,61,70,98,175,226,176,153,103,92,232,62,13,252,6,240,220,213,68,217,38,239,135,129,208,2,145,173,222,147,212,
+116,139,21,126,255,147,172,39,87,166,205,176,222,3,68,232,39,64,6,97,240,247,220,95,186,237,83,44,153,139,79,185,179,160,0,6,209,180,221,50,237,122,142,192,2,59,59,91,197,34,186,51,218,58,198,253,189,162,83,15,126,187,54,1,
+240,1,156,3,224,3,54,248,164,120,116,0,156,82,233,186,252,173,43,117,138,252,159,47,87,78,90,161,208,116,206,144,1,252,29,118,187,160,7,145,90,217,86,181,118,0,3,182,244,0,2,103,72,1,157,19,160,3,201,230,116,1,240,111,
+83,171,248,218,0,6,116,0,124,28,237,206,192,26,39,83,174,69,231,9,55,152,180,225,38,243,22,156,38,244,213,125,174,210,151,107,184,149,166,202,82,230,37,105,178,148,185,134,116,120,150,165,202,210,60,75,82,229,105,39,22,75,107,137,
+135,187,218,37,48,247,123,68,166,166,41,30,29,30,200,240,254,230,209,204,89,239,87,78,98,191,39,207,202,210,183,49,106,86,77,178,90,189,116,200,213,28,111,77,44,160,12,146,183,86,78,173,76,183,196,44,119,186,211,113,26,46,232,0,
+206,191,225,180,76,43,74,89,101,25,93,149,225,101,34,210,144,0,30,116,0,19,169,214,251,0,7,59,111,224,0,53,62,64,0,214,219,191,81,105,194,77,230,45,56,73,188,197,179,139,33,197,116,120,149,116,120,149,166,215,75,133,166,117,
+37,157,64,173,75,82,229,105,30,37,169,114,180,143,18,212,185,92,122,123,58,0,30,97,240,247,123,68,166,30,239,104,206,47,22,191,126,173,9,43,14,172,234,206,161,228,4,123,36,178,194,102,45,120,100,172,43,126,73,111,138,101,140,93,
+91,40,202,0,106,21,186,181,89,189,53,69,214,41,145,169,27,213,89,58,70,90,182,89,95,242,114,151,30,29,25,240,255,149,124,61,222,218,229,157,30,29,44,232,240,232,111,176,3,195,225,239,136,240,181,121,139,78,18,110,246,116,14,91,
+19,18,180,217,74,92,196,173,54,82,151,48,250,0,247,62,167,242,121,93,175,22,161,102,37,169,114,180,143,18,206,161,128,5,116,120,124,84,120,221,222,209,41,135,187,218,37,48,247,235,179,4,248,0,179,42,114,204,183,236,121,0,116,116,
+29,30,37,47,63,147,203,45,107,166,208,21,103,187,226,127,43,43,90,0,202,60,58,60,111,86,73,194,77,222,211,9,56,116,159,201,241,171,223,18,151,49,43,77,148,165,204,74,211,101,41,115,108,110,218,183,35,113,210,186,246,0,117,127,
+78,160,15,220,15,7,94,3,184,116,141,241,117,123,127,134,3,164,109,69,35,122,171,34,221,98,153,63,43,86,111,77,76,176,173,210,176,75,59,18,143,19,239,41,22,204,46,89,118,157,219,188,116,157,35,219,168,124,61,222,200,241,206,236,
+1,189,1,168,123,204,98,113,19,116,207,228,166,233,54,206,146,89,212,227,89,179,136,92,163,196,175,53,75,173,181,46,86,147,174,245,2,239,194,128,1,73,254,27,135,145,211,136,209,118,88,197,214,212,173,96,206,174,185,75,47,33,91,54,
+128,9,241,21,140,196,173,54,82,151,49,215,109,232,60,67,196,179,221,227,174,193,205,89,238,246,137,76,61,249,221,131,128,0
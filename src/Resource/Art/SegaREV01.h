@@ -0,0 +1,18 @@
+128,125,128,5,22,21,27,38,58,53,28,69,25,84,9,100,7,114,0,129,5,24,21,26,39,119,55,118,71,120,88,248,119,121,130,4,10,131,4,8,132,4,6,23,122,133,4,5,134,4,4,23,123,135,5,23,255,0,0,241,250,32,0,63,
+39,250,45,32,0,30,255,47,250,108,0,1,255,32,0,63,252,0,7,252,128,0,255,176,0,31,242,0,3,247,255,189,0,3,246,95,182,0,3,246,223,178,0,3,246,95,190,0,3,247,223,178,0,3,246,95,182,0,3,246,223,178,0,3,
+246,93,128,0,253,159,236,128,3,63,163,254,22,191,30,255,142,0,15,223,254,248,0,0,0,29,157,128,229,53,241,104,171,194,165,149,161,57,73,55,255,8,82,181,251,67,42,1,207,33,228,3,200,3,212,210,202,164,223,1,213,53,245,102,
+196,42,110,235,40,63,144,248,0,223,192,22,172,182,35,170,186,242,149,50,169,55,240,13,127,133,64,39,200,104,2,116,1,149,204,93,184,172,156,90,76,173,251,134,219,242,250,252,190,23,222,253,131,249,11,180,162,226,235,40,215,137,70,89,
+74,255,13,192,231,110,119,44,174,179,128,59,239,27,239,214,31,79,140,224,12,226,113,58,206,167,27,198,219,25,101,203,70,106,19,62,243,81,62,230,51,164,0,233,91,139,233,122,84,91,70,213,42,222,182,177,165,64,178,180,118,134,90,229,
+89,90,253,218,236,169,210,160,19,228,242,30,21,226,105,38,239,135,129,211,174,192,29,36,163,79,228,230,239,88,4,90,241,234,51,22,191,139,97,50,174,217,208,124,27,248,13,225,121,171,68,210,77,223,15,3,160,5,145,107,189,147,212,116,
+141,22,191,127,201,219,9,213,236,185,172,47,128,209,58,9,208,1,152,124,61,247,23,238,219,100,202,166,98,167,220,211,160,0,6,209,116,189,43,109,186,142,192,2,58,186,215,139,35,58,43,212,117,141,251,122,137,76,61,250,236,184,7,192,
+6,112,15,128,12,215,197,145,225,208,2,113,102,210,245,249,91,50,245,139,126,79,151,181,211,149,104,116,29,51,164,0,127,7,93,174,232,1,228,101,172,178,213,187,0,1,219,122,0,1,51,164,0,206,137,208,1,228,243,58,0,248,55,169,
+213,252,109,0,3,58,0,62,14,118,231,96,13,19,169,215,34,243,132,155,204,84,225,38,243,21,56,77,233,109,125,182,210,205,182,220,75,89,114,150,108,196,181,151,41,102,204,43,163,196,173,155,45,100,120,149,179,101,172,147,138,74,215,19,
+15,119,168,148,195,221,234,37,53,49,100,120,116,122,71,135,247,53,28,197,61,237,116,230,45,249,62,126,86,204,188,197,89,149,54,169,86,245,210,162,218,56,190,150,85,128,21,37,174,202,157,85,149,175,136,104,239,118,178,241,22,46,232,0,
+174,223,225,168,152,101,148,166,148,86,117,103,134,148,138,148,128,0,243,160,0,157,78,183,216,0,57,219,127,0,1,169,242,0,6,182,189,250,138,156,36,222,98,167,9,55,152,172,226,144,227,58,60,75,58,60,75,89,117,211,97,172,174,196,
+171,176,22,212,173,155,45,100,120,149,179,101,172,143,18,182,108,182,61,61,58,0,30,97,240,247,122,137,76,61,222,163,56,188,85,251,245,80,146,208,236,174,202,236,30,64,71,164,149,104,76,197,94,21,45,134,95,201,53,241,101,104,197,217,
+114,138,192,6,161,151,170,181,47,165,180,93,162,202,139,100,95,86,164,233,21,173,89,86,127,201,202,92,120,116,87,195,254,85,240,247,122,215,41,209,225,210,157,30,29,13,246,0,120,124,61,241,30,26,215,152,169,194,77,222,157,3,149,137,
+137,107,46,82,205,152,150,178,229,44,217,135,208,7,185,245,63,147,203,109,184,214,134,152,149,179,101,172,143,18,174,193,128,6,116,120,124,90,60,110,239,81,41,135,187,212,74,97,239,215,101,9,240,1,74,201,202,86,191,99,200,3,163,160,
+232,241,41,121,252,158,85,173,174,151,64,90,158,239,137,252,172,181,180,1,148,120,116,120,222,169,39,9,55,122,152,73,195,164,254,79,139,111,124,75,54,98,90,203,148,179,102,37,172,185,75,54,107,27,173,87,35,113,211,59,118,0,118,127,
+78,192,15,220,15,7,94,3,184,116,139,241,118,122,255,12,7,72,186,139,34,250,181,35,93,162,202,159,149,181,47,165,178,180,50,244,202,18,174,164,163,196,251,202,69,102,27,42,219,78,235,222,58,78,145,235,168,124,61,222,145,227,157,212,
+3,122,3,80,247,152,196,226,38,233,159,201,77,210,107,58,73,87,99,139,75,156,67,101,30,37,185,171,54,182,182,108,181,147,174,246,129,183,225,128,0,178,127,134,225,228,116,226,44,93,90,49,118,171,50,208,103,87,108,165,55,33,151,53,
+0,19,226,45,140,196,181,151,41,102,204,117,219,122,15,16,241,42,247,120,235,176,115,84,247,122,137,76,61,249,221,64,0,14,43,212,74,51,162,189,68,251,122,137,76,61,250,0
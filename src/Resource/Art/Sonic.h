@@ -0,0 +1,645 @@
+0,0,0,0,0,0,0,0,0,0,51,51,0,34,34,51,0,0,34,34,0,0,0,2,0,0,0,0,0,0,0,3,0,0,0,0,51,51,48,0,51,52,67,51,51,50,36,68,35,50,162,68,34,43,170,36,35,43,170,163,51,43,180,69,
+0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,32,68,51,2,32,84,68,50,32,85,84,67,32,85,85,68,48,0,0,3,51,0,3,51,50,0,51,51,50,3,50,34,50,34,34,34,34,0,0,2,34,0,0,0,2,0,0,0,51,
+0,0,51,51,0,3,51,34,0,3,34,34,0,50,34,34,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,2,35,51,68,84,35,52,68,68,35,52,68,69,35,51,68,69,34,51,68,69,34,51,51,68,34,35,51,51,34,34,59,102,
+34,34,186,170,34,34,186,170,34,34,43,170,34,33,34,187,34,34,17,34,2,42,170,163,42,171,187,59,171,178,34,59,68,69,68,48,102,84,84,67,102,101,68,69,102,97,52,65,102,97,19,65,102,97,21,17,70,97,22,24,53,102,107,129,
+102,102,170,17,170,170,170,0,170,171,189,0,187,189,208,0,61,221,0,0,186,171,208,0,170,170,176,0,170,170,176,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,
+16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,34,0,0,0,34,0,0,0,34,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,
+171,34,34,59,182,104,104,51,214,134,102,35,40,152,136,35,0,136,136,67,0,24,130,64,0,0,2,64,0,0,36,0,186,171,208,0,187,189,25,0,51,50,152,128,33,33,152,128,2,33,25,0,2,32,0,0,2,32,0,0,2,32,0,0,
+0,0,36,0,0,135,102,96,0,136,135,112,1,216,141,214,1,221,215,104,29,221,135,204,29,221,140,204,17,17,17,17,2,32,0,0,152,136,0,0,153,152,128,0,137,152,208,0,140,238,152,128,204,204,238,237,204,204,204,206,17,17,17,17,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,221,0,0,0,237,221,208,0,17,17,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,3,34,0,0,34,34,0,0,0,2,0,0,0,0,
+0,0,0,0,0,0,0,51,0,0,51,34,0,3,34,34,0,34,34,34,0,34,34,34,0,0,0,34,0,0,0,2,0,0,0,0,0,0,0,0,51,51,51,0,68,68,68,51,43,180,68,68,42,171,68,84,42,170,180,69,42,170,164,85,
+59,180,68,68,51,52,70,102,51,51,102,102,51,53,102,102,35,53,97,22,35,53,97,22,34,53,97,22,34,35,97,22,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,67,48,2,32,68,68,34,32,84,68,67,32,85,68,68,32,
+69,68,68,48,84,84,85,48,101,69,102,83,101,53,102,99,102,81,22,99,102,97,22,98,102,97,22,98,102,97,22,82,0,0,0,34,0,0,2,34,0,0,2,34,0,0,34,34,0,0,34,34,0,0,32,0,0,0,10,170,0,10,171,187,
+0,13,187,25,0,0,221,189,0,8,137,221,0,121,153,102,0,7,120,153,0,0,0,33,0,0,0,0,0,0,0,0,34,34,86,102,34,43,166,102,34,43,170,170,33,34,187,170,34,17,34,187,170,162,187,221,187,189,186,171,34,218,170,170,
+146,186,170,170,97,219,170,171,98,27,187,178,130,51,50,34,16,36,1,34,0,36,0,18,0,36,0,1,0,2,64,1,102,184,24,176,106,161,17,176,170,170,171,0,174,234,189,0,187,189,208,0,221,208,0,0,189,219,0,0,176,13,176,0,
+176,221,0,0,9,208,0,0,153,128,0,0,153,137,128,0,9,152,0,0,32,0,0,0,32,0,0,0,34,0,0,0,0,2,48,0,0,118,102,0,0,119,119,0,1,215,102,96,29,103,204,204,24,124,204,204,24,204,204,204,17,17,17,17,
+18,32,0,0,1,34,136,0,25,153,152,0,1,153,136,141,222,30,221,216,204,209,237,216,204,193,238,153,17,17,17,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,136,0,0,0,141,221,208,0,221,221,221,221,17,17,17,17,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,3,34,0,0,34,34,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,51,0,0,51,34,0,3,34,34,0,34,34,34,0,34,34,34,0,0,0,34,0,0,0,2,
+0,0,0,0,0,0,0,0,51,51,51,0,68,68,68,51,43,180,68,68,42,171,68,84,42,170,180,69,42,170,164,85,59,180,68,69,51,52,51,52,51,51,86,83,51,53,102,101,35,53,97,22,35,53,97,22,34,53,97,22,34,35,97,22,
+0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,67,48,2,32,68,68,34,32,68,68,67,32,84,68,68,32,84,68,68,48,84,68,68,48,69,68,69,67,52,68,54,83,83,68,54,99,101,51,22,98,102,81,22,98,102,97,22,82,
+0,2,48,0,0,118,102,0,0,119,119,0,1,215,102,96,29,103,204,204,24,124,204,204,24,204,204,204,17,17,17,17,18,40,128,0,17,137,136,0,25,152,221,216,1,157,221,216,222,30,221,216,204,209,237,209,204,193,225,16,17,17,16,0,
+0,0,0,0,0,0,0,0,141,221,221,208,141,221,209,16,157,17,16,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,51,68,
+0,3,52,34,0,51,66,170,3,51,50,42,3,51,51,43,51,50,34,34,50,34,34,34,34,0,2,50,32,0,3,34,0,0,3,34,0,0,50,34,0,0,50,34,0,3,34,34,0,3,34,34,0,3,34,34,0,3,34,0,0,2,0,0,
+0,0,0,0,0,0,0,0,0,0,2,0,0,0,2,32,0,3,51,50,51,51,68,68,68,68,85,85,68,68,68,85,34,52,68,68,170,52,69,102,170,52,70,102,162,52,69,102,178,51,68,102,34,35,68,69,34,35,68,68,34,34,51,51,
+34,34,51,59,34,34,35,59,34,34,34,43,34,33,34,34,34,34,17,34,34,42,170,163,42,171,187,59,171,178,34,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,84,51,0,0,84,65,0,0,
+68,68,16,1,145,21,17,145,105,17,103,17,102,145,107,16,102,102,170,176,102,102,106,189,69,102,170,189,102,106,171,208,170,170,171,208,170,170,189,0,170,171,208,0,187,189,0,0,34,45,0,0,186,171,208,0,170,170,176,0,170,170,176,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,4,0,3,68,68,3,51,51,51,0,0,34,34,0,0,0,2,0,0,0,0,0,0,0,51,0,0,51,51,0,51,51,51,3,51,51,51,51,34,34,35,34,34,34,34,0,0,34,34,0,0,0,34,
+0,0,0,0,0,0,0,0,68,68,68,0,68,68,68,68,51,68,68,68,35,51,52,75,34,35,50,42,34,51,34,186,51,51,34,170,51,51,66,162,51,52,68,68,51,52,68,68,51,52,68,68,51,51,68,68,35,51,68,68,51,51,52,68,
+0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,164,2,0,0,164,68,0,0,170,69,68,0,170,69,84,0,164,85,84,64,68,68,85,64,68,86,69,68,68,102,100,68,69,102,97,68,69,102,97,36,69,102,97,16,68,102,97,25,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,136,0,0,8,137,0,0,8,152,0,0,9,137,0,0,0,153,0,0,0,0,0,0,0,12,0,0,0,204,0,0,8,204,0,0,6,108,
+0,0,3,51,0,3,51,51,0,51,51,51,0,51,50,34,3,50,34,34,131,33,17,18,145,25,147,34,153,137,50,34,137,153,50,34,136,147,34,34,156,204,194,0,204,118,102,0,199,97,52,68,199,97,19,51,200,118,102,144,200,135,105,0,
+51,35,51,166,51,34,59,170,34,34,43,170,34,34,34,186,34,51,34,43,35,58,43,176,35,186,186,187,51,186,187,170,51,186,170,187,51,59,187,221,36,51,61,178,67,51,51,32,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+100,86,102,129,166,102,106,17,170,168,120,0,170,135,102,120,187,118,102,103,104,102,102,102,102,118,102,103,119,151,119,152,34,41,137,0,33,18,34,128,16,1,40,136,0,1,136,141,0,25,152,221,0,1,152,221,0,0,29,221,0,0,29,221,
+0,0,29,209,0,0,1,209,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,221,
+0,0,221,17,0,221,209,238,8,221,30,208,136,209,237,0,136,30,237,0,145,238,208,0,30,237,0,0,30,237,0,0,238,208,0,0,237,0,0,0,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,198,102,0,0,204,102,0,0,204,204,0,12,204,205,0,12,204,209,0,12,193,16,0,1,16,0,0,0,0,0,205,221,16,0,104,129,0,0,136,16,0,0,209,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,3,51,0,0,51,51,0,3,51,50,0,51,50,34,0,50,34,34,8,57,153,153,136,153,137,50,129,29,204,34,1,220,134,102,29,216,134,36,29,216,134,19,29,217,135,102,1,221,152,140,1,125,204,198,0,23,118,102,0,25,119,108,
+0,1,221,204,0,0,29,204,0,0,1,220,0,0,0,28,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,51,35,51,166,51,34,59,170,34,34,43,170,34,34,34,186,34,34,34,43,34,35,51,187,34,59,171,186,35,186,187,170,
+35,186,59,186,17,59,170,119,68,68,187,103,51,50,17,152,0,0,1,25,0,0,0,16,0,0,0,2,192,0,0,0,192,0,0,0,192,0,0,0,192,0,0,0,192,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+100,86,102,129,166,102,106,17,170,170,170,160,170,170,187,0,187,187,0,0,208,0,0,0,176,0,0,0,160,0,0,0,167,119,128,0,118,102,119,0,102,102,104,0,102,103,104,0,118,121,120,0,153,144,0,0,32,0,0,0,34,8,128,0,
+2,136,136,0,9,136,136,216,9,153,141,221,0,152,237,221,0,30,237,221,0,30,221,209,0,30,225,16,0,1,16,0,24,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,208,0,221,221,16,141,221,209,0,136,221,16,0,152,209,0,0,145,16,0,0,16,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,51,0,34,34,51,0,0,34,34,0,0,0,2,0,0,0,0,0,0,0,3,0,0,3,51,0,3,51,50,0,51,51,50,3,50,34,50,34,34,34,34,0,0,2,34,0,0,0,3,
+0,0,0,0,0,0,0,0,51,51,48,0,51,52,67,51,51,50,36,68,35,50,162,68,34,43,170,36,35,43,170,163,51,43,180,69,35,51,68,84,35,52,68,68,35,52,68,69,35,51,68,69,34,51,68,69,34,51,51,68,34,35,51,51,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,32,68,51,2,32,84,68,50,32,85,84,67,32,85,85,68,48,68,69,68,48,102,84,84,67,102,101,68,69,102,97,52,65,102,97,19,65,102,97,21,17,70,97,22,24,
+0,0,3,51,0,3,51,50,0,51,50,34,0,50,34,34,3,34,34,34,3,0,10,170,0,10,171,187,0,171,179,34,0,102,99,35,6,135,118,35,9,102,150,104,8,102,102,104,8,102,102,104,0,134,102,129,0,8,136,24,0,13,29,221,
+0,222,225,221,0,222,225,221,0,13,238,29,0,13,238,29,0,0,222,225,0,0,222,238,0,0,1,30,0,0,0,0,34,34,59,102,34,34,186,170,34,34,186,170,34,34,43,170,34,34,34,187,162,43,187,153,179,37,170,185,34,18,90,169,
+49,134,107,185,24,136,102,96,17,134,102,112,29,221,119,192,221,204,204,198,221,204,204,102,17,29,199,108,136,129,17,124,216,144,0,17,217,0,0,0,216,0,0,0,217,128,0,0,217,141,0,0,17,141,221,208,225,17,17,16,0,0,0,0,
+53,102,104,24,102,102,161,17,170,170,170,0,170,171,189,0,187,189,208,0,153,144,0,0,152,144,0,0,137,0,0,0,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,0,0,204,0,0,0,204,204,0,0,
+28,204,204,0,1,17,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,119,119,0,134,102,102,0,102,102,102,
+0,134,119,102,0,134,105,104,0,7,151,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,51,0,3,51,50,0,51,50,34,0,50,34,34,3,34,170,170,135,170,187,187,118,187,0,3,152,0,0,50,
+128,0,3,34,0,0,3,34,0,222,50,34,13,225,62,136,13,225,238,232,222,225,222,24,222,29,221,153,222,29,209,145,34,34,59,102,34,34,186,170,34,34,186,170,34,34,43,170,170,35,34,187,187,59,187,189,51,187,170,171,51,186,170,170,
+51,186,170,170,51,52,187,171,3,51,68,68,1,51,51,51,2,17,0,0,34,16,0,0,33,0,0,0,16,0,0,0,53,102,104,24,102,102,161,17,170,170,170,153,170,171,189,153,187,189,217,137,0,9,137,136,219,185,153,152,237,208,153,137,
+0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,0,51,64,96,6,0,51,102,134,0,6,102,204,0,135,103,204,0,8,124,204,0,1,204,204,0,1,204,204,0,0,28,193,0,0,1,16,0,0,0,0,0,0,0,0,0,0,0,0,
+128,0,0,0,16,0,0,0,0,0,0,0,128,0,0,0,128,0,0,0,128,0,0,0,144,0,0,0,0,0,0,0,0,0,0,0,0,12,193,0,0,204,193,0,204,204,16,0,204,204,16,0,102,193,0,0,198,97,0,0,200,16,0,0,
+193,0,0,0,193,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,13,0,0,0,13,0,0,0,222,0,0,0,222,0,0,0,209,0,0,0,17,0,0,0,0,
+238,29,209,16,225,152,16,0,225,137,16,0,29,209,0,0,29,16,0,0,209,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,
+0,0,0,6,0,0,0,6,0,0,0,0,0,0,0,8,0,0,13,216,0,0,221,216,0,0,221,221,0,13,221,221,0,13,221,209,0,1,17,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,3,51,0,3,51,50,0,51,50,34,0,50,34,34,3,34,34,34,6,102,102,114,6,102,102,99,134,102,102,99,119,103,118,99,104,119,151,131,125,119,130,34,221,211,136,18,221,24,130,33,141,24,129,18,137,209,130,34,209,16,17,17,
+16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,34,59,102,34,34,186,170,34,34,186,170,34,34,43,170,35,50,34,187,51,187,187,221,59,186,170,176,59,170,170,168,
+59,170,170,168,51,186,170,184,51,51,187,152,36,34,41,137,35,64,9,153,19,64,0,9,16,52,0,0,0,40,102,0,0,134,102,96,0,134,108,198,0,136,204,118,0,8,204,108,0,28,199,126,0,28,199,237,0,28,206,221,0,1,30,17,
+53,102,104,24,102,102,161,17,170,170,170,0,170,171,189,0,187,189,208,0,221,208,0,0,0,0,0,0,128,0,0,0,136,0,0,0,152,144,0,0,152,144,0,0,136,144,0,0,137,0,0,0,144,0,0,0,0,0,12,208,0,12,206,208,
+7,204,237,16,108,206,221,16,204,237,209,0,206,221,16,0,237,209,0,0,209,16,0,0,16,0,0,0,0,0,0,0,0,0,3,51,0,3,51,51,0,50,34,34,0,50,34,34,3,34,34,34,3,0,8,146,0,8,137,55,0,8,154,166,
+51,35,51,166,51,34,59,170,34,34,43,170,34,102,98,186,38,102,102,139,38,102,102,109,134,102,102,107,104,103,134,139,100,86,102,129,166,102,106,17,170,170,170,0,170,171,176,0,187,176,0,0,0,0,0,0,0,0,0,0,2,32,0,0,
+24,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,155,182,0,0,50,34,0,0,50,0,0,0,48,0,0,0,0,0,0,204,0,34,28,205,102,97,28,199,102,131,
+28,199,136,130,28,201,119,136,28,205,152,0,24,102,140,204,22,204,204,204,29,204,204,204,1,17,17,17,0,0,0,0,121,119,151,155,131,153,155,187,3,51,187,177,2,51,34,152,33,50,0,153,33,50,1,216,21,48,29,221,84,48,29,221,
+51,0,1,29,0,0,0,1,0,0,0,0,0,0,0,0,204,0,0,0,204,205,0,0,17,17,0,0,0,0,0,0,34,34,0,0,33,34,0,0,18,32,0,0,153,32,0,0,136,128,0,0,136,128,0,0,216,208,0,0,221,136,0,0,
+216,141,208,0,17,221,221,208,0,17,29,221,0,0,1,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,
+0,0,0,68,0,0,4,68,0,0,4,67,0,0,68,51,0,0,67,34,0,4,50,34,0,3,34,32,0,66,32,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,68,0,4,85,84,0,68,186,164,68,66,186,170,68,66,186,170,
+68,50,43,164,51,50,43,180,51,51,34,36,34,51,51,68,34,51,52,68,34,51,51,68,0,51,51,52,3,51,51,51,0,0,0,0,0,0,0,0,0,0,0,0,68,68,64,0,85,85,68,64,69,85,84,68,68,68,68,68,68,70,102,17,
+68,86,102,113,68,70,102,103,68,69,102,102,68,68,86,102,68,68,68,85,68,68,68,70,52,68,70,106,51,51,170,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,64,8,0,0,
+16,17,0,0,24,17,0,0,123,16,136,0,102,135,120,128,103,102,102,104,167,102,102,120,136,102,102,128,167,102,103,144,184,103,120,130,102,105,41,34,6,121,33,18,186,146,16,0,187,178,16,0,170,210,16,0,171,219,0,0,179,211,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,209,0,0,0,30,208,0,13,30,208,0,13,30,208,0,13,30,208,0,13,30,237,0,136,209,237,8,216,129,237,
+136,216,129,237,136,221,145,237,136,221,209,237,153,141,209,237,153,29,221,30,0,1,221,17,0,0,17,16,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,3,
+51,51,51,51,51,51,51,51,51,50,34,51,50,34,34,51,50,34,35,51,34,32,3,51,32,0,51,50,0,0,51,50,51,51,186,170,34,34,43,187,50,34,34,45,50,34,34,43,34,34,42,42,34,34,42,171,34,34,43,170,34,34,35,186,
+0,0,51,50,0,0,51,34,0,0,3,33,0,0,3,50,0,0,8,49,0,0,136,153,0,0,8,152,0,0,8,136,0,0,8,153,0,0,0,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+33,18,51,51,17,34,35,52,25,50,34,34,153,50,32,4,137,50,32,4,153,60,198,68,152,204,99,67,137,199,19,24,156,199,97,104,156,199,102,120,12,204,136,141,0,204,200,216,0,204,204,136,0,102,102,104,0,198,102,205,0,204,204,205,
+51,48,0,0,51,0,0,0,48,0,0,0,51,0,0,0,51,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,16,0,0,0,16,0,0,0,16,0,0,0,16,0,0,0,16,0,0,0,16,0,0,0,
+0,12,204,209,0,0,204,209,0,0,204,209,0,0,12,16,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,64,8,0,0,
+16,17,0,0,24,17,0,0,139,16,0,0,102,160,0,0,186,176,0,0,170,176,0,0,170,0,0,0,171,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,3,
+51,51,51,51,51,51,51,51,51,50,34,51,50,34,34,51,50,34,35,51,34,32,3,51,32,0,51,50,0,0,51,50,51,51,186,170,34,34,43,187,50,34,34,45,50,34,34,43,34,34,35,59,34,34,58,171,34,34,42,179,34,34,43,170,
+189,0,0,0,208,0,120,120,0,7,118,104,170,119,102,102,170,166,102,121,187,118,102,121,183,103,102,105,171,105,151,146,0,0,51,34,0,0,51,34,0,0,3,41,0,0,3,57,0,0,8,57,0,0,8,129,0,0,0,129,0,0,0,1,
+0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,146,51,187,153,34,35,20,153,38,97,68,140,102,67,67,216,102,19,96,220,134,102,204,221,136,120,134,221,217,152,198,
+29,221,220,103,17,29,119,119,0,1,17,157,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,17,18,34,65,1,16,2,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,0,0,0,108,192,0,0,
+124,204,0,0,220,204,192,0,221,221,17,0,17,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,136,0,0,13,112,0,0,141,0,0,8,136,8,136,141,217,8,136,141,221,
+40,136,141,221,41,137,142,221,9,153,238,222,0,0,30,225,0,0,17,225,0,0,0,16,0,0,0,0,0,0,0,0,13,16,0,0,221,16,0,0,221,16,0,0,221,16,0,0,221,16,0,0,145,0,0,0,145,0,0,0,145,0,0,0,
+16,0,0,0,16,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,16,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,51,0,0,0,51,0,0,3,51,0,0,3,51,0,0,51,34,0,0,50,34,0,0,32,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,51,68,0,51,68,68,51,68,68,85,52,68,68,69,52,50,35,53,51,42,170,164,51,43,170,68,34,43,187,68,34,50,179,68,2,51,51,68,0,50,51,52,3,50,35,51,
+2,0,0,0,2,32,0,0,2,34,0,0,51,51,48,0,68,68,67,48,85,84,68,65,85,85,84,68,68,68,67,67,69,102,17,21,70,102,97,17,69,102,102,17,68,86,102,102,68,68,85,102,68,68,68,102,51,51,166,170,51,51,186,170,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,17,0,0,0,81,136,0,0,104,17,0,0,97,16,0,0,106,173,0,0,106,189,0,0,170,189,0,0,170,208,0,0,171,152,0,0,
+3,51,34,51,51,50,34,34,51,34,34,34,51,34,34,34,50,34,34,50,50,34,0,50,50,0,0,50,32,0,3,50,0,0,3,34,0,0,3,34,0,0,0,34,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+51,59,170,170,51,59,170,171,34,34,187,189,34,34,34,187,34,34,51,186,34,35,51,34,34,42,163,24,34,171,178,24,42,178,35,56,42,179,35,49,42,184,130,136,11,102,102,104,6,103,150,102,0,135,118,102,0,151,102,102,0,8,102,104,
+184,137,0,0,153,153,0,0,153,153,0,0,170,153,0,0,91,176,0,0,102,103,0,0,102,102,198,102,134,103,204,108,136,220,204,108,29,204,204,198,29,204,205,17,141,209,17,0,129,24,137,0,136,216,128,0,141,221,217,141,221,221,221,152,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,204,193,0,204,204,16,0,204,193,0,0,204,16,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,221,16,0,141,209,0,0,
+0,0,136,141,0,0,0,13,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,17,221,217,238,238,17,17,238,238,238,238,221,222,238,225,0,13,222,16,0,0,0,0,0,0,0,0,0,0,0,0,
+141,16,0,0,17,0,0,0,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,
+0,0,0,51,0,0,0,51,0,0,3,51,0,0,3,51,0,0,51,34,0,0,50,34,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,51,68,0,51,68,68,51,68,68,85,52,68,68,69,
+52,50,35,53,51,42,170,164,51,43,170,68,34,43,187,68,34,50,179,68,2,51,51,68,0,50,51,52,3,50,35,51,2,0,0,0,2,32,0,0,2,34,0,0,51,51,48,0,68,68,67,48,85,84,68,65,85,85,84,68,68,68,67,67,
+69,102,17,21,70,102,97,17,69,102,102,17,68,86,102,102,68,68,85,102,68,68,68,102,51,51,166,170,51,59,170,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,17,0,0,0,
+81,136,0,0,104,17,0,0,97,25,152,0,106,168,153,128,106,184,136,137,170,185,152,137,170,152,137,128,171,233,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,193,0,0,0,193,0,0,12,204,16,0,12,204,16,0,12,204,16,3,51,34,51,51,50,34,34,51,34,34,34,51,34,34,34,50,34,34,50,50,34,0,50,50,0,0,50,32,0,3,50,
+0,0,3,34,0,0,3,34,0,0,3,42,0,0,0,123,0,0,8,118,0,0,119,120,0,7,118,104,0,119,102,102,51,59,170,170,51,59,170,171,34,34,187,189,34,34,34,187,34,34,43,186,34,42,59,186,34,171,59,170,42,179,51,186,
+171,3,51,51,171,50,35,51,176,50,34,32,0,50,34,0,128,3,32,136,0,3,46,238,0,222,62,225,0,222,30,221,190,11,0,0,224,189,0,0,221,224,0,0,170,0,0,0,170,160,0,68,170,164,68,51,171,68,51,0,68,67,0,0,
+51,48,0,0,51,16,0,0,17,16,0,0,2,16,0,0,2,16,0,0,130,16,0,0,145,16,0,0,153,0,0,0,0,12,198,16,0,102,102,129,0,6,204,129,102,108,204,193,70,103,204,193,54,102,204,193,8,119,204,193,8,1,204,193,
+0,0,17,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,103,104,0,134,119,152,0,104,102,151,0,8,135,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,222,225,221,0,13,225,221,0,13,238,29,0,0,222,25,0,0,222,225,0,0,13,225,0,0,13,225,0,0,0,222,17,0,0,0,208,0,0,0,17,0,0,0,129,0,0,0,129,0,0,0,209,0,0,0,221,0,0,0,17,0,0,0,
+0,0,0,222,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,0,16,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,17,0,0,0,81,136,0,0,104,17,0,0,97,16,0,0,106,173,0,0,106,189,0,0,170,189,0,0,170,208,0,0,171,208,0,0,
+3,51,34,51,51,50,34,34,51,34,34,34,51,34,34,34,50,34,34,50,50,34,0,50,50,0,0,50,32,0,3,50,0,0,3,50,0,0,3,38,0,0,3,38,0,0,0,38,0,0,0,0,0,0,0,8,0,0,0,6,0,0,0,0,
+51,59,170,170,51,59,170,171,34,34,187,189,34,34,34,187,34,34,43,186,34,34,59,186,34,34,59,170,34,114,51,187,102,102,51,51,102,102,99,51,102,102,104,34,102,119,114,34,102,119,130,130,119,119,120,34,118,215,56,129,103,125,24,136,
+189,0,0,0,0,0,128,0,0,136,136,144,170,136,152,137,170,168,137,137,170,169,137,137,171,187,137,153,179,178,153,144,51,32,0,0,50,64,0,96,35,68,6,102,18,51,72,102,18,16,40,102,18,16,8,136,33,16,0,136,17,0,0,0,
+0,0,0,0,0,0,0,0,0,0,206,0,0,12,237,16,0,12,237,16,0,204,237,16,0,204,237,16,0,204,237,16,0,108,237,16,6,124,237,16,198,124,237,16,198,126,209,0,204,110,209,0,204,126,209,0,204,206,209,0,140,204,17,0,
+0,221,209,16,0,141,137,16,13,216,141,16,13,221,221,16,13,221,209,0,13,221,209,0,0,221,16,0,0,209,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,204,16,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,51,51,51,51,51,51,51,51,50,34,51,50,34,34,51,50,34,35,51,34,32,3,51,32,0,51,50,0,0,51,50,
+0,0,51,34,0,0,51,34,0,0,3,32,0,0,3,48,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,51,51,186,170,34,34,59,187,50,34,102,104,50,38,102,102,34,38,102,102,34,38,102,105,34,34,102,119,34,34,136,119,
+41,55,103,153,8,58,103,131,8,170,178,0,137,59,32,0,9,147,32,0,0,3,48,0,0,0,48,2,0,0,0,6,189,0,0,0,208,2,34,0,0,2,34,0,139,34,18,32,137,178,18,40,119,177,25,136,155,187,136,136,155,178,153,141,
+51,32,13,221,51,48,29,221,35,48,29,209,33,50,1,16,33,83,0,0,17,83,0,0,99,82,0,0,136,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,13,13,216,141,221,209,216,141,209,16,
+216,221,16,0,209,17,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,102,0,0,12,118,0,0,204,199,0,0,28,204,0,0,1,204,0,0,0,28,0,0,0,1,0,0,0,0,
+104,136,0,0,135,128,221,204,119,141,204,204,153,140,204,193,198,204,204,16,134,204,193,0,136,204,16,0,17,17,0,0,209,0,0,0,193,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,68,0,0,0,69,0,0,36,85,0,0,4,68,0,0,68,170,0,4,170,170,0,4,75,170,0,4,68,43,0,68,68,34,0,68,67,50,0,68,67,51,0,68,67,35,0,68,51,34,0,68,50,34,
+0,68,50,32,0,4,50,0,0,4,50,0,0,4,50,0,0,3,48,0,0,0,48,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,68,68,9,68,68,66,17,69,84,17,17,85,70,102,102,84,102,102,102,84,86,102,102,68,68,85,84,164,68,68,68,162,68,68,68,170,68,68,68,34,68,68,68,36,68,68,67,51,68,67,51,51,51,51,51,51,51,51,51,51,51,51,35,
+51,51,50,34,51,51,34,34,3,51,34,32,3,51,34,32,0,51,34,0,0,51,34,0,0,3,50,0,0,0,50,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,13,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,17,0,0,0,17,8,118,120,129,7,102,105,106,134,102,103,102,118,102,103,102,135,102,103,86,168,118,121,70,170,184,103,106,170,182,103,
+30,0,0,0,30,208,0,0,209,237,208,0,221,30,237,0,13,209,238,221,13,221,30,238,0,136,129,238,0,8,137,17,0,141,221,221,8,136,221,221,146,136,136,221,130,40,153,17,146,17,145,0,33,0,16,0,33,0,0,0,34,16,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,0,0,0,237,0,0,0,238,224,0,0,17,16,0,0,221,16,0,0,209,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+106,170,176,186,170,171,43,186,59,178,43,171,51,34,34,187,50,34,58,170,34,34,51,187,51,34,35,51,51,34,34,35,189,32,0,0,189,178,0,0,171,211,0,0,171,51,0,0,171,51,0,0,179,51,0,0,51,67,48,0,51,36,48,0,
+51,50,34,34,51,50,33,34,51,50,33,50,3,51,33,147,3,51,33,153,0,51,50,24,0,0,51,25,0,0,8,153,0,0,8,137,0,0,0,136,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+34,0,67,0,34,0,67,144,34,38,67,105,50,198,49,102,147,198,17,103,153,199,102,120,152,204,119,136,136,156,204,204,137,144,204,204,152,144,12,198,137,0,0,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,209,0,0,0,216,16,0,0,216,129,0,0,198,141,16,0,102,205,16,0,102,204,209,0,108,204,193,0,204,204,204,16,0,12,204,16,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,17,0,0,0,17,0,0,0,129,160,0,0,106,171,0,0,102,171,0,0,102,170,176,0,86,170,176,0,70,170,176,0,106,170,189,186,
+106,170,187,170,170,171,43,186,59,178,35,187,51,34,35,171,50,34,35,186,34,34,34,59,51,34,34,35,51,34,34,34,51,34,41,34,51,50,41,50,51,50,41,156,3,51,41,140,0,51,41,157,0,3,51,145,0,0,8,129,0,0,0,136,
+0,0,0,0,0,0,0,13,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,136,128,0,135,102,112,8,118,103,144,8,118,102,121,0,118,102,105,2,167,102,121,34,
+167,120,144,32,183,105,17,0,186,177,16,0,58,177,0,0,171,66,0,0,179,67,0,0,49,67,0,0,33,67,0,12,100,54,198,108,98,22,140,102,102,103,140,103,136,136,156,119,200,137,221,121,221,221,215,17,29,221,17,0,1,17,0,0,
+0,0,0,0,16,0,0,0,209,0,0,0,221,16,0,0,221,209,0,0,221,221,16,0,13,136,16,0,8,137,145,0,8,221,209,0,13,221,221,16,136,221,221,16,136,142,237,225,136,152,238,225,136,153,17,16,41,144,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,204,204,16,0,204,204,16,0,204,209,0,0,221,16,0,0,209,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,34,34,0,0,2,35,0,0,0,52,0,0,3,68,0,0,3,69,0,0,52,69,0,0,52,85,0,3,68,67,0,3,68,42,0,3,66,170,0,52,42,170,0,52,34,187,0,51,51,34,0,51,51,35,0,51,50,34,
+0,3,50,32,0,3,50,0,0,3,34,0,0,3,34,0,0,0,32,0,0,0,32,0,0,0,0,0,0,0,0,0,0,53,17,24,51,68,68,17,68,68,67,86,68,84,49,17,85,69,17,17,84,86,102,102,84,102,102,102,84,102,102,100,
+84,69,85,67,69,68,68,67,68,68,68,51,180,68,68,51,179,68,51,51,35,51,51,50,51,51,50,34,50,34,34,34,51,34,34,35,3,51,50,32,3,51,34,32,0,51,34,0,0,51,34,0,0,3,50,0,0,0,50,0,0,0,2,0,
+129,0,0,0,17,0,0,0,129,173,0,0,106,171,208,0,102,171,208,0,102,170,185,144,86,170,185,137,54,170,185,152,106,170,185,153,106,170,185,186,186,171,43,170,59,178,43,165,34,34,43,82,34,34,34,33,34,34,34,50,34,34,42,178,
+50,34,42,178,51,34,42,178,51,34,42,179,3,50,32,171,3,50,32,171,0,51,32,10,0,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,12,0,0,0,204,144,0,6,204,
+144,0,102,204,182,124,198,103,182,103,204,113,102,103,204,193,104,109,204,209,136,141,204,24,24,29,221,24,49,17,221,24,51,136,129,141,34,102,104,29,54,102,102,141,103,150,102,129,103,102,102,141,104,102,104,0,6,152,128,0,0,0,0,0,
+0,0,0,0,0,0,0,0,193,0,0,0,193,0,0,0,193,0,0,0,193,0,0,0,193,0,0,0,16,0,0,0,16,0,0,0,16,0,13,16,0,0,13,16,0,0,13,16,0,0,221,16,144,8,136,16,137,137,145,16,221,221,209,224,
+221,221,30,224,221,17,238,16,17,238,238,16,238,238,221,0,238,221,0,0,221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,129,8,136,144,
+129,153,152,137,17,153,136,152,129,173,153,153,106,171,216,153,102,171,217,144,102,170,176,189,86,170,176,189,54,170,176,222,0,0,0,0,0,0,0,0,1,16,0,0,12,193,16,0,12,204,193,16,0,204,204,97,0,12,198,104,0,12,198,204,
+0,0,102,204,0,0,8,204,0,0,6,103,0,0,102,102,0,0,3,103,0,0,67,8,0,4,48,0,0,4,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,0,204,16,0,0,
+204,193,0,0,204,204,16,0,204,204,16,0,124,193,0,0,129,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,170,189,186,106,170,187,170,186,171,43,170,59,178,43,170,34,34,59,186,34,34,35,187,34,34,171,51,34,34,171,51,
+171,67,0,0,170,67,0,0,171,67,0,0,171,67,0,0,164,51,16,0,179,51,17,0,51,49,34,16,51,0,2,33,50,34,171,50,51,34,171,3,51,34,171,0,3,50,171,0,3,50,42,176,0,51,42,176,0,0,55,104,0,0,8,121,
+0,0,7,102,0,0,7,102,0,0,7,102,0,0,7,102,0,0,9,102,0,0,0,134,0,0,0,0,0,0,0,0,34,40,136,145,34,40,225,153,51,46,238,209,0,51,237,221,0,225,17,221,0,222,238,17,0,13,222,238,128,0,13,221,
+104,0,0,0,102,128,0,0,121,112,0,0,118,144,0,0,102,112,0,0,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,16,0,0,0,209,16,0,0,216,145,0,0,25,141,16,0,225,29,209,0,238,225,29,16,
+221,222,225,16,0,13,221,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,129,0,0,0,17,0,0,0,129,173,0,0,106,171,208,0,102,171,208,0,102,170,189,0,86,170,189,0,54,170,189,8,
+106,170,189,8,106,170,189,186,186,171,43,170,59,178,43,170,34,34,43,170,34,34,59,186,34,34,51,187,34,34,35,51,50,34,34,51,51,34,39,102,51,34,38,102,3,50,38,102,3,50,38,102,0,51,38,102,0,0,54,102,0,0,0,8,
+0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,221,0,0,0,206,0,0,0,12,0,0,0,12,9,153,0,0,136,136,144,0,137,152,137,0,
+136,137,153,0,171,152,144,0,170,185,144,6,170,178,0,6,170,50,0,72,171,50,68,50,179,52,51,0,51,50,33,16,51,34,18,33,104,33,33,33,103,40,33,33,121,136,136,129,119,115,136,16,103,125,17,209,120,221,221,145,118,125,216,141,
+102,8,136,221,0,0,221,221,0,0,221,221,0,0,13,221,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,0,221,16,0,0,237,209,0,0,206,221,16,0,204,237,209,0,124,206,209,0,6,204,237,16,
+6,108,237,209,108,118,126,209,108,204,119,238,102,204,204,193,102,136,204,193,136,128,17,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,
+16,0,0,0,209,0,0,0,209,0,0,0,209,0,0,0,209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,0,129,0,0,0,106,160,0,0,102,171,0,0,102,171,0,0,86,170,176,2,70,170,176,2,106,170,176,0,
+106,170,189,187,170,171,134,104,59,178,102,102,51,38,102,104,50,38,102,103,34,38,102,102,51,34,102,104,51,34,34,134,51,34,34,118,51,34,41,58,51,34,40,154,3,34,32,137,3,34,32,136,0,51,32,0,0,0,51,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,8,34,34,136,216,33,41,136,141,34,25,136,221,187,24,152,221,155,185,157,221,123,178,1,221,153,178,0,17,121,51,34,0,121,51,51,51,147,50,17,84,120,0,34,21,
+98,0,2,19,178,0,2,104,178,32,0,102,147,51,0,102,144,0,12,215,0,0,12,204,0,0,0,204,0,0,0,17,0,209,0,0,13,209,0,0,13,209,0,0,221,16,0,0,221,16,0,0,141,16,0,0,129,0,0,0,209,0,0,0,
+209,0,0,0,16,0,0,0,16,0,0,0,0,0,0,0,0,0,13,16,0,0,12,16,48,0,204,16,48,0,204,16,40,12,204,16,136,12,204,16,135,140,204,16,135,152,204,16,121,214,204,16,204,198,204,16,204,200,109,16,17,17,17,0,
+0,0,4,65,0,0,68,65,0,0,68,70,0,4,69,70,0,4,85,70,0,4,85,68,0,4,85,68,0,4,84,68,0,4,68,170,0,36,90,170,0,0,90,170,0,0,91,187,0,0,68,34,0,0,4,68,0,0,0,68,0,0,0,68,
+0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,102,86,170,118,102,84,106,102,102,68,106,102,101,68,74,102,84,68,67,84,68,68,67,68,68,68,67,68,68,68,51,
+68,68,68,67,171,36,68,51,187,35,67,51,34,35,51,51,34,51,51,51,51,51,51,51,67,50,34,3,67,50,34,0,68,51,34,0,68,67,34,32,4,68,50,32,0,4,67,34,0,0,4,50,0,0,0,4,0,0,0,0,0,0,0,0,
+0,0,13,221,13,221,222,238,30,238,238,17,209,17,17,216,0,221,221,136,0,0,0,141,0,0,0,8,0,0,0,0,221,221,225,0,238,238,17,16,17,17,221,16,137,221,221,16,141,221,209,0,221,216,16,0,136,137,144,0,136,137,144,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,68,0,0,136,0,0,8,103,137,0,136,102,103,0,135,102,102,17,7,102,102,17,24,102,102,8,182,119,135,17,118,106,138,
+34,32,0,0,130,16,0,0,137,16,0,0,114,33,17,0,121,146,34,179,102,121,189,221,134,106,186,179,182,11,186,171,171,219,171,170,171,34,42,171,171,34,170,179,178,34,34,34,50,34,34,34,50,34,34,34,50,34,34,34,50,51,34,34,
+51,51,51,34,51,51,51,51,51,34,51,51,51,34,32,51,51,34,32,0,51,50,34,0,51,50,34,0,51,51,50,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,51,3,48,0,51,51,51,0,
+52,36,68,56,51,32,4,65,51,32,6,51,50,34,44,97,34,34,44,199,18,51,51,204,17,153,153,137,33,25,137,152,34,18,25,136,50,35,57,152,51,51,136,136,51,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,17,17,17,136,216,136,221,103,141,134,204,22,136,198,108,102,140,198,108,119,204,198,108,204,204,198,204,204,192,0,0,153,0,0,0,
+153,0,0,0,153,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,51,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,
+17,16,0,0,221,209,16,0,204,204,0,0,204,192,0,0,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,13,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,17,16,0,221,221,209,17,13,221,217,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,16,0,0,
+0,13,216,157,0,0,136,221,0,0,8,221,0,0,0,136,0,0,0,136,0,0,0,136,0,8,0,136,0,136,112,0,221,225,16,0,221,222,225,0,222,238,16,0,136,225,16,0,137,144,0,0,136,144,0,0,137,144,0,0,34,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,0,17,26,187,0,8,182,170,171,17,134,186,170,
+8,134,153,146,7,102,119,105,8,102,102,103,7,118,102,105,0,119,102,121,0,7,167,102,208,10,171,123,189,10,171,186,171,219,187,58,171,34,58,186,171,34,58,171,178,34,35,34,50,34,34,34,50,34,34,34,50,34,34,34,50,51,34,34,
+51,51,51,34,51,51,51,51,51,34,51,51,51,34,32,51,51,34,32,0,51,50,34,0,51,50,34,0,51,51,50,32,34,0,0,0,32,0,0,0,32,0,0,0,17,0,0,0,17,0,0,0,16,0,0,12,177,0,0,204,180,48,0,102,
+180,67,12,102,177,68,108,140,51,19,54,136,50,100,22,121,34,102,102,137,146,38,104,141,153,156,140,221,41,152,221,221,34,153,145,17,34,35,56,128,51,51,136,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,16,0,0,12,16,0,0,204,209,0,0,204,209,0,0,204,209,0,0,125,209,0,0,119,209,0,0,103,145,0,0,199,16,0,0,215,16,0,0,221,16,0,0,209,0,0,0,209,0,0,0,17,0,0,0,
+16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,67,0,0,52,68,0,0,52,67,0,3,68,84,0,35,68,84,2,35,69,84,34,35,69,84,0,3,69,84,
+0,3,68,85,0,3,68,84,0,0,52,68,0,0,52,68,0,0,3,68,0,0,3,68,0,0,0,52,0,0,0,51,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+81,22,102,170,17,22,102,170,17,102,84,106,22,102,84,171,102,102,68,51,102,101,68,51,86,84,68,51,68,68,68,51,84,68,68,67,58,68,68,51,58,171,51,51,42,171,179,50,42,187,35,34,50,34,51,51,67,50,34,3,51,50,32,0,
+51,51,34,0,51,51,34,0,0,51,50,0,0,0,51,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,17,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,129,13,221,8,129,26,187,217,24,26,170,171,86,102,106,170,0,0,0,0,0,0,0,0,0,0,1,0,0,0,12,16,0,0,12,193,0,0,12,204,0,0,0,204,0,0,0,204,
+0,0,0,108,0,0,0,102,0,0,0,108,0,0,0,204,153,153,7,103,137,153,182,102,137,154,182,102,185,154,86,104,171,219,162,136,170,187,178,17,170,178,51,50,170,178,51,171,187,34,35,171,51,34,34,42,51,34,34,34,51,34,34,34,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,209,16,0,0,221,193,0,0,13,193,0,0,8,198,16,0,216,108,16,0,137,204,209,144,157,204,193,136,221,204,193,136,221,220,205,29,221,141,221,24,221,129,24,136,141,
+129,136,102,104,51,134,102,102,51,38,102,102,34,134,151,102,35,134,119,120,187,182,104,144,170,171,96,0,34,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,209,0,0,0,129,224,0,0,
+145,225,0,0,209,238,16,0,209,238,224,0,209,238,208,0,30,238,208,0,30,237,0,0,30,237,0,0,30,237,0,0,221,208,0,0,128,0,0,0,128,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+50,34,34,34,50,34,51,51,34,34,32,3,34,34,32,0,50,34,34,0,51,34,34,0,51,51,34,32,3,51,51,50,34,34,0,0,34,32,0,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,67,0,0,52,68,0,0,52,67,0,3,68,84,0,35,68,84,2,35,69,84,34,35,69,84,0,3,69,84,0,3,68,85,0,3,68,84,0,0,52,68,0,0,52,68,0,0,3,68,0,0,3,68,0,0,0,52,0,0,0,51,
+0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,22,102,170,17,22,102,170,17,102,84,106,22,102,84,170,102,102,68,59,102,101,68,51,86,84,68,51,68,68,68,51,
+84,68,68,67,58,68,68,51,58,171,51,51,42,171,179,50,42,187,35,34,50,34,51,51,67,50,34,3,51,50,32,0,51,51,34,0,51,51,34,0,0,51,50,0,0,0,51,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,17,0,1,28,204,0,12,204,204,0,0,12,204,0,0,0,0,0,0,0,0,0,0,0,0,1,17,17,17,24,140,204,204,102,204,204,204,198,204,204,204,198,108,118,113,6,6,102,112,0,6,102,136,0,6,67,0,
+0,0,0,0,16,0,0,0,16,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,17,
+0,0,153,0,0,8,136,128,0,137,136,153,0,153,137,137,129,152,137,137,129,26,187,158,24,26,170,171,86,102,106,170,0,0,67,0,0,0,67,0,0,0,4,48,0,0,4,48,189,0,4,67,11,224,170,68,224,218,170,180,190,218,170,164,
+171,219,170,170,170,187,187,171,170,178,187,179,170,178,35,51,187,34,42,179,51,34,34,171,51,34,34,42,51,34,34,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,17,17,16,51,18,34,25,51,16,8,153,
+51,0,142,29,51,32,142,237,51,34,14,238,50,34,34,49,50,34,51,238,3,51,0,221,187,0,0,0,170,176,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,17,17,209,29,24,141,209,
+221,217,17,30,221,17,238,237,17,238,237,208,238,237,208,0,237,208,0,0,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,17,16,0,0,
+237,0,0,0,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,34,34,34,50,34,51,51,34,34,32,3,34,34,32,0,50,34,34,0,51,34,34,0,51,51,34,32,3,51,51,50,
+34,171,104,134,34,39,119,102,51,48,135,102,0,0,7,118,0,0,0,119,0,0,0,7,0,0,0,0,0,0,0,0,136,112,0,0,105,153,0,0,119,103,0,0,103,104,0,0,102,136,0,0,152,96,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,129,13,221,0,129,26,187,221,24,26,170,171,86,102,106,170,
+0,0,0,0,0,1,17,17,0,237,221,221,0,206,238,238,0,12,204,204,0,0,12,204,0,0,0,0,0,0,0,0,0,9,153,144,0,152,136,153,0,136,153,153,8,137,136,137,0,136,137,178,0,136,170,187,208,10,170,179,176,10,170,171,
+171,219,170,171,170,187,187,171,170,178,187,179,170,178,35,51,187,34,34,34,51,34,34,39,51,34,34,34,51,34,34,34,0,0,0,0,17,16,0,0,221,209,17,17,238,237,221,209,204,206,238,236,103,119,103,204,6,102,204,204,0,204,204,200,
+0,102,104,128,6,102,104,128,0,104,136,0,0,4,32,0,0,67,0,0,36,67,17,16,50,50,34,17,51,33,17,33,51,34,34,24,51,34,130,136,51,130,40,136,54,103,135,49,102,103,119,125,102,103,119,215,102,102,103,103,102,102,103,118,
+0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,193,0,0,0,193,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,
+0,0,0,0,17,17,0,0,25,221,17,0,216,141,221,16,221,141,221,209,216,221,221,221,0,221,221,0,0,0,0,0,50,34,34,34,50,34,51,51,34,34,32,3,34,34,32,0,50,34,34,0,51,34,34,0,51,51,34,32,3,51,51,50,
+38,102,8,96,50,34,0,0,51,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,16,0,0,0,209,0,0,13,209,0,0,0,221,0,0,0,221,0,0,0,136,0,0,0,136,0,0,8,221,
+0,0,136,141,0,2,40,136,2,34,41,137,2,33,17,137,2,34,33,178,0,2,187,187,208,11,151,187,189,8,135,153,171,134,105,119,171,102,102,119,171,102,102,104,179,102,102,104,50,38,102,34,50,34,34,34,50,34,34,34,50,51,34,34,
+0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,209,0,0,0,209,0,0,0,129,16,0,0,221,16,0,0,221,16,0,0,221,209,0,0,221,209,0,0,1,16,0,0,0,2,51,32,35,51,85,83,51,49,17,56,51,34,33,104,
+147,0,0,38,152,0,0,0,119,32,0,0,102,178,35,48,122,171,51,0,51,163,144,0,152,137,144,0,32,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,0,220,16,0,0,
+12,193,0,0,12,204,16,0,13,204,193,0,13,204,204,16,128,220,204,193,136,136,204,193,135,121,102,129,104,121,200,129,102,124,204,16,103,204,193,0,204,204,16,0,0,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+51,51,51,34,51,51,51,51,51,34,51,51,51,34,32,51,51,34,32,0,51,50,34,0,51,50,34,0,51,51,50,32,34,0,0,0,34,35,48,0,51,51,0,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,3,51,51,2,34,34,51,0,2,34,34,0,0,0,34,0,0,0,0,0,0,0,3,0,0,51,51,0,51,51,50,34,34,51,50,0,34,34,50,0,0,34,34,0,0,0,34,0,0,0,3,
+0,0,0,0,0,0,0,0,0,0,0,0,51,51,51,48,51,51,68,67,34,34,52,68,34,186,163,52,34,43,170,163,51,43,180,69,35,51,68,84,35,52,68,68,35,52,68,69,35,51,68,69,34,51,68,69,34,51,51,68,34,35,51,51,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,2,0,68,51,2,0,84,68,50,32,85,84,67,32,85,85,68,48,68,69,68,48,102,84,84,67,102,101,68,69,102,97,52,65,102,97,19,65,102,97,21,17,70,97,22,24,
+0,0,0,0,0,0,0,0,0,0,0,59,0,0,0,11,0,0,0,0,0,0,17,0,0,1,204,195,0,28,198,98,0,26,105,72,1,202,97,52,1,203,170,19,1,203,186,172,1,204,187,193,1,204,204,192,1,172,202,160,0,26,170,189,
+0,28,187,189,0,1,204,204,0,0,28,204,0,0,1,204,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,51,51,50,186,170,162,34,171,187,138,166,173,214,121,102,186,182,135,102,59,215,135,102,34,39,152,119,34,34,40,119,
+34,35,50,187,64,19,51,59,52,51,51,59,19,51,3,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,0,0,0,221,0,0,0,221,221,208,0,221,221,221,221,221,221,221,221,0,221,221,221,0,0,0,0,0,0,0,0,
+34,34,59,102,34,34,186,170,102,34,186,170,152,98,43,170,102,125,221,187,102,121,153,153,119,137,152,153,120,176,137,136,187,160,9,152,170,178,32,0,187,34,34,0,49,17,34,170,0,0,26,170,0,1,187,173,0,1,187,173,0,0,27,189,
+0,0,1,29,0,0,0,29,0,0,0,1,221,0,0,0,0,0,0,0,221,208,0,0,0,0,0,0,0,0,0,0,53,102,104,24,102,102,161,17,170,170,170,0,170,171,189,0,187,189,208,0,204,204,0,0,140,204,192,0,128,204,209,0,
+0,205,30,0,0,221,29,0,0,209,237,0,219,209,237,0,219,30,208,0,219,30,208,0,221,30,208,0,209,237,0,0,209,237,0,0,209,237,0,0,209,224,0,0,17,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,13,0,0,13,221,0,0,221,220,0,13,221,204,0,221,221,236,0,221,221,209,13,221,221,0,13,221,208,0,13,221,0,2,13,221,0,1,13,221,0,0,13,208,0,0,0,208,0,0,
+0,208,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,51,50,186,170,162,44,171,220,204,204,220,204,204,204,204,204,204,204,204,204,204,204,204,204,204,17,204,193,17,119,
+17,19,50,187,0,19,51,59,34,33,51,59,17,16,3,51,0,0,0,1,0,0,0,0,0,11,170,2,0,11,186,162,0,219,170,170,1,221,222,234,29,221,221,222,29,221,221,219,29,221,221,189,1,17,17,17,0,0,0,0,0,0,0,0,
+34,34,59,102,204,204,202,170,204,204,26,170,204,204,27,170,204,193,221,187,193,25,153,153,23,137,152,153,120,176,137,136,187,160,9,152,170,176,0,0,187,0,0,0,49,0,0,0,18,32,0,0,18,32,0,0,34,0,0,0,32,0,0,0,
+160,0,0,0,0,0,0,238,219,205,238,238,189,221,221,221,221,221,238,30,17,17,17,0,0,0,0,0,0,0,0,0,53,102,104,24,102,102,161,17,170,170,170,0,170,171,189,0,187,189,208,0,157,208,0,0,128,0,0,0,128,0,0,0,
+0,0,0,0,0,0,14,0,0,0,14,0,0,224,14,0,0,224,238,0,0,224,238,0,14,238,238,0,14,238,224,0,238,238,224,0,238,238,0,0,238,224,0,0,238,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,59,0,0,0,11,0,0,0,0,0,0,0,0,0,0,3,51,0,0,0,34,0,0,0,0,0,0,222,208,0,13,29,218,0,13,29,210,0,222,29,209,0,209,221,219,0,225,221,209,0,17,221,209,
+0,17,221,209,0,1,221,221,0,0,29,221,0,0,1,29,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,51,51,50,186,170,162,34,171,187,138,166,173,214,121,102,186,182,135,102,59,215,135,102,34,39,152,119,34,34,40,119,
+34,35,50,187,0,19,51,59,162,33,51,52,33,18,19,51,26,33,0,0,187,0,0,0,17,0,0,0,0,0,0,0,224,0,0,0,224,0,0,0,222,224,0,0,221,238,224,0,17,238,238,238,0,238,238,238,0,0,0,0,0,0,0,0,
+34,34,59,102,34,34,186,170,102,204,202,170,152,107,204,204,102,125,219,204,102,121,153,157,119,137,152,153,120,176,137,136,187,160,9,152,170,176,0,0,68,0,0,0,51,64,0,0,0,52,6,0,0,3,70,108,0,2,102,108,0,10,170,172,
+0,0,186,204,0,0,28,204,0,0,28,204,0,0,1,204,224,0,0,17,238,238,224,0,0,0,0,0,0,0,0,0,53,102,104,24,102,102,161,17,170,170,170,0,170,171,189,0,204,189,208,0,221,208,0,0,221,221,0,0,221,221,208,0,
+13,221,193,0,13,221,193,0,13,220,193,0,6,204,193,0,108,204,16,0,108,204,16,0,172,193,0,0,172,193,0,0,202,16,0,0,202,16,0,0,193,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,12,0,0,12,204,0,0,204,204,0,12,204,204,0,204,204,204,0,204,204,0,12,204,192,0,12,204,192,0,12,204,0,2,12,204,0,1,12,204,0,0,12,192,0,0,0,192,0,0,
+0,192,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,51,50,186,170,162,34,171,187,138,166,204,214,121,102,204,198,135,102,204,199,135,102,204,39,152,119,34,34,40,119,
+2,35,50,187,0,19,51,59,2,33,51,59,33,16,3,51,16,0,3,48,0,0,3,48,0,3,51,0,0,102,102,0,0,186,102,106,1,170,166,176,28,204,202,172,28,204,204,204,17,204,204,202,0,17,17,17,0,0,0,0,0,0,0,0,
+34,34,59,102,34,34,186,170,102,34,186,170,152,98,43,170,102,125,221,187,102,121,153,153,119,137,152,153,120,176,137,136,187,160,9,152,170,176,0,0,187,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,13,0,0,221,221,198,204,221,221,106,204,204,204,172,205,225,17,17,17,16,0,0,0,0,0,0,0,0,0,53,102,104,24,102,102,161,17,170,170,170,0,170,171,189,0,187,189,208,0,157,208,0,0,128,0,0,0,128,0,0,0,
+0,0,0,0,0,0,0,0,0,0,13,0,0,0,13,0,0,208,13,0,0,208,221,0,13,208,221,0,13,221,208,0,221,221,208,0,221,221,0,0,221,208,0,0,221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,51,0,0,3,51,0,0,3,50,0,0,51,34,0,3,34,34,0,2,34,32,0,34,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,51,52,0,51,52,68,3,52,68,85,51,68,51,53,51,51,58,165,51,42,170,69,34,187,171,68,34,34,180,68,34,51,35,68,34,51,51,51,3,50,51,51,3,50,35,51,
+0,0,0,0,34,0,0,0,2,34,0,0,51,51,48,0,68,68,67,48,85,84,68,65,85,85,84,68,84,68,67,51,69,102,17,21,70,102,97,17,69,102,102,17,68,102,102,102,68,69,101,86,68,68,51,106,51,51,166,170,51,59,170,170,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,17,0,0,0,81,128,0,0,104,17,0,0,97,16,0,0,106,173,0,0,170,189,0,0,170,189,0,0,170,220,204,16,171,204,204,29,
+51,51,34,35,51,51,34,34,51,34,34,34,50,34,34,34,34,34,0,50,34,0,0,50,0,0,3,34,0,0,3,42,0,0,3,171,0,0,11,173,0,0,11,170,0,0,0,187,0,0,0,3,0,0,0,3,0,0,0,28,0,0,1,198,
+0,0,1,198,0,0,1,170,0,0,0,26,0,0,0,28,0,0,0,28,0,0,0,1,0,0,0,0,0,0,0,0,51,43,170,170,34,34,187,187,34,34,34,221,34,34,102,109,34,38,152,119,34,166,102,103,170,150,102,103,183,151,102,119,
+102,135,119,123,214,120,136,187,189,119,34,35,50,34,51,51,34,34,51,51,34,32,19,48,104,4,67,48,68,67,51,0,147,19,16,0,106,26,16,0,186,172,192,0,187,187,202,221,204,204,171,189,204,204,170,188,17,202,171,204,0,17,17,17,
+188,204,204,204,217,153,128,204,153,153,128,13,153,136,136,0,153,137,144,0,128,0,0,10,186,2,34,170,186,178,34,170,186,34,17,27,187,177,0,219,187,48,0,1,51,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,13,0,0,13,221,0,13,221,221,221,221,221,221,221,221,221,208,204,205,221,0,204,29,0,0,17,0,0,0,209,208,0,0,209,237,0,0,209,237,0,0,221,30,208,0,187,30,208,0,219,30,237,0,173,209,238,208,221,209,238,208,
+173,221,30,224,187,29,209,16,17,17,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,0,0,0,0,208,0,0,221,0,0,0,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,3,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,
+0,0,0,51,0,0,0,51,0,0,3,50,0,0,51,34,0,0,50,34,0,2,34,32,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,3,51,68,3,51,68,68,51,52,68,85,51,51,51,53,
+51,42,170,165,50,43,170,69,34,34,187,68,34,50,180,68,34,51,35,68,0,51,51,51,3,50,51,51,3,50,35,51,2,0,0,0,2,32,0,0,2,34,0,0,51,51,48,0,68,68,67,48,85,84,68,65,85,85,84,68,84,68,67,51,
+69,102,17,21,70,102,97,17,69,102,102,17,68,102,102,102,68,69,101,86,68,68,51,106,51,51,166,170,51,59,170,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,17,0,0,0,
+81,128,0,0,104,17,0,0,97,16,0,0,106,173,0,0,170,189,0,0,170,189,0,0,170,208,0,0,171,208,0,0,3,51,34,35,3,51,34,34,51,50,34,34,51,34,34,34,50,34,32,50,50,0,0,50,32,0,0,50,0,0,0,58,
+0,0,0,173,0,0,11,172,0,0,11,220,0,0,0,220,0,0,0,220,0,0,13,221,0,0,13,221,0,0,13,221,0,0,13,221,0,0,13,221,0,0,0,221,0,0,0,221,0,0,0,221,0,0,0,13,0,0,0,0,0,0,0,0,
+51,43,170,202,34,34,188,193,34,34,204,193,34,44,204,193,34,204,204,193,34,204,204,27,172,204,204,27,204,204,204,23,204,204,193,123,204,204,193,187,204,204,18,35,204,193,51,51,204,193,51,51,204,17,17,16,225,16,34,0,221,2,33,0,
+221,2,16,0,221,2,16,0,221,0,0,0,221,0,0,0,221,208,0,0,221,208,0,0,221,221,0,0,13,13,208,0,185,153,0,0,217,153,128,0,153,153,128,0,153,136,136,0,153,137,144,0,128,0,0,0,186,0,0,0,186,176,0,0,
+186,0,0,0,187,176,32,0,187,50,34,0,51,17,32,0,48,16,32,0,0,2,34,0,0,170,42,0,10,170,170,173,187,186,238,235,11,189,237,219,13,221,221,219,1,221,221,209,1,221,221,16,1,221,209,0,0,17,16,0,0,0,0,0,
+0,224,0,0,0,14,0,0,0,14,224,0,14,0,238,0,0,224,238,0,0,14,238,224,0,14,238,224,0,14,238,224,0,14,238,224,0,14,238,224,0,238,238,0,0,238,222,0,14,237,30,0,13,222,16,0,205,209,0,0,189,209,0,0,
+221,16,0,0,209,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,17,0,0,0,
+81,128,0,0,104,17,0,0,97,16,0,0,106,173,0,0,170,189,0,0,170,189,0,0,170,208,0,0,172,221,221,193,51,51,34,35,51,51,34,34,51,34,34,34,50,34,34,34,34,34,0,50,34,0,0,50,0,0,3,34,0,0,3,42,
+0,0,3,171,0,0,11,173,0,0,11,170,0,0,0,187,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+51,43,170,172,34,34,187,204,34,34,34,221,34,34,102,109,34,38,152,119,34,166,102,103,170,150,102,103,183,151,102,119,102,135,119,123,214,120,136,187,189,119,34,35,50,34,51,51,50,34,51,51,50,34,17,17,32,32,34,33,0,10,161,33,
+13,218,33,160,221,221,17,177,209,221,219,16,222,29,221,16,14,29,221,209,13,225,221,221,0,222,29,221,0,13,225,17,205,221,221,221,217,157,221,221,153,153,128,221,153,136,136,13,153,137,144,0,128,0,0,0,186,0,0,0,186,176,0,96,
+186,0,0,6,180,68,52,70,68,48,48,42,51,0,0,10,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,14,238,0,238,238,238,238,238,238,224,221,209,238,0,209,30,0,0,16,0,0,0,
+220,16,0,0,220,193,0,0,220,193,0,0,220,204,16,0,108,204,16,0,108,204,16,0,6,204,193,0,204,170,161,0,108,202,170,0,170,204,193,0,170,204,193,0,177,204,193,0,1,17,17,0,0,0,0,0,0,0,224,0,0,14,0,0,
+224,224,0,0,238,0,0,0,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,51,34,35,3,51,34,34,51,50,34,34,51,34,34,34,50,34,32,50,50,0,0,50,32,0,0,50,0,0,0,58,
+0,0,0,171,0,0,11,172,0,0,11,204,0,0,0,204,0,0,0,204,0,0,12,204,0,0,12,204,0,0,12,204,0,0,12,204,0,0,12,204,0,0,0,204,0,0,0,204,0,0,0,204,0,0,0,12,0,0,0,0,0,0,0,0,
+51,43,170,170,34,34,187,187,34,34,34,221,34,34,102,109,34,38,152,119,34,166,102,103,170,150,102,103,183,151,102,119,102,135,119,123,214,120,136,187,204,119,34,35,204,34,51,51,204,34,51,51,194,2,17,16,192,0,34,16,192,0,33,0,
+192,0,33,0,192,0,16,0,204,0,0,0,204,0,0,0,204,192,0,0,204,192,0,0,204,204,0,0,12,12,204,0,185,153,0,0,217,153,128,0,153,153,128,0,153,136,136,0,153,137,144,0,128,0,0,0,186,0,0,0,186,176,0,0,
+186,0,0,0,187,176,0,0,187,48,0,0,51,0,0,0,51,0,0,0,51,48,0,0,3,48,0,6,3,102,96,198,54,102,107,202,102,170,106,202,11,170,204,204,1,172,204,193,1,204,204,16,1,204,17,0,0,17,0,0,0,0,0,0,
+0,208,0,0,0,13,0,0,0,0,208,0,0,0,221,0,0,208,13,0,0,13,221,208,0,13,221,208,0,13,221,208,0,13,221,208,0,13,221,208,0,221,221,0,0,221,193,0,13,220,193,0,220,204,16,0,204,206,16,0,204,193,0,0,
+172,16,0,0,161,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,34,35,0,0,0,52,0,0,3,68,0,0,3,69,0,0,52,69,0,0,52,85,
+0,0,52,67,0,3,68,58,0,3,68,58,0,3,67,170,0,3,50,171,0,3,50,178,0,3,50,34,0,3,50,34,0,3,50,32,0,3,50,32,0,3,34,0,0,3,34,0,0,3,34,0,0,0,32,0,0,0,32,0,0,0,0,0,
+0,53,17,24,51,68,68,17,68,68,67,86,68,84,49,17,85,69,17,17,84,86,102,102,84,102,102,102,84,102,102,100,84,69,85,67,69,68,68,67,68,68,68,51,180,68,68,51,179,68,51,51,35,51,51,50,51,51,50,34,50,34,34,34,
+51,34,34,35,3,51,50,32,3,51,34,0,3,51,34,0,0,50,32,0,0,50,32,0,0,2,0,0,0,2,0,0,129,0,0,0,17,0,0,0,129,173,0,1,106,171,208,205,102,171,220,204,102,170,188,204,86,170,188,192,54,170,188,136,
+106,170,185,152,106,170,185,152,186,171,217,137,59,178,217,152,34,34,217,144,34,38,119,139,34,104,102,120,34,105,102,119,34,102,102,119,50,166,102,119,50,169,119,136,58,135,136,146,58,182,103,114,58,189,189,34,10,189,171,34,11,170,179,34,
+0,187,0,50,0,48,0,198,0,0,1,198,0,0,1,204,0,0,0,28,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,237,221,0,0,17,238,221,208,221,17,238,237,205,221,17,30,0,11,187,209,0,13,221,221,
+128,10,173,221,144,10,170,171,144,34,171,187,2,34,27,177,2,33,1,16,171,33,0,0,186,177,0,0,186,179,0,0,187,179,0,0,179,51,0,0,35,51,0,0,51,48,0,0,51,51,0,0,33,51,0,0,32,67,0,0,36,49,0,0,
+132,60,16,13,67,26,204,171,145,170,188,170,102,171,188,202,170,187,204,202,28,204,204,161,1,17,17,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,221,0,0,0,238,238,0,0,17,17,0,0,221,209,0,0,
+221,16,0,0,17,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,13,13,0,0,13,13,0,0,13,221,0,0,13,221,0,0,13,221,0,0,221,221,0,0,221,221,0,0,221,221,0,13,221,208,0,221,221,208,0,
+220,204,16,0,188,204,16,0,188,193,0,0,188,16,0,0,193,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,129,0,0,0,17,0,0,0,129,173,0,0,106,171,208,0,102,171,208,0,102,170,189,0,86,170,189,0,54,170,185,136,
+106,170,185,152,106,170,185,152,186,171,217,137,60,17,217,152,44,204,25,144,44,204,193,139,44,204,193,120,44,204,204,23,44,204,204,23,50,204,204,23,50,204,204,193,58,204,204,193,58,204,204,193,10,220,204,204,10,188,204,204,11,173,204,204,
+0,189,220,204,0,0,221,206,0,0,221,221,0,0,13,221,0,0,0,221,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,238,238,224,0,0,238,238,0,0,0,238,0,14,238,238,0,0,0,238,0,0,0,0,
+128,0,0,0,144,0,0,0,144,0,0,0,0,0,0,0,0,0,0,0,171,0,34,0,186,177,34,32,186,179,17,34,187,179,16,34,179,51,0,10,35,51,0,170,51,48,0,171,51,16,0,187,17,33,0,0,16,33,0,0,16,33,0,0,
+16,2,16,0,208,0,0,0,221,0,0,0,221,208,0,0,221,221,221,0,221,221,221,221,13,221,221,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,224,0,0,0,238,0,0,0,238,224,0,0,238,238,0,0,238,238,0,0,
+14,237,224,0,14,237,16,0,0,237,225,0,0,237,225,0,0,221,209,0,0,205,209,0,0,189,209,0,160,219,209,0,170,235,209,0,174,221,177,0,174,221,209,0,173,221,209,0,189,221,209,0,221,221,209,0,1,221,209,0,0,17,16,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,208,0,0,0,0,0,0,0,0,0,0,0,129,0,0,0,17,0,0,0,129,173,0,0,106,171,208,13,102,171,208,221,102,170,189,221,86,170,205,221,54,170,205,221,
+106,172,205,152,106,172,201,152,186,172,185,137,59,204,217,152,34,203,217,144,34,198,119,139,34,104,102,120,34,105,102,119,34,102,102,119,50,166,102,119,50,169,119,136,58,135,136,146,58,182,103,114,58,189,189,34,10,189,171,34,11,170,179,34,
+0,187,0,50,0,48,0,50,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,17,0,0,204,204,17,0,221,204,204,17,221,220,204,204,221,214,204,204,0,0,102,170,
+128,0,12,204,144,0,6,106,144,0,102,106,0,0,4,106,0,0,67,42,171,4,48,0,186,67,0,0,186,67,0,0,187,67,0,0,179,51,0,0,35,51,0,0,51,49,0,0,51,18,16,0,33,33,32,0,32,33,171,16,32,162,27,16,
+0,162,27,17,13,221,221,221,14,221,221,221,13,17,29,221,0,221,225,17,0,0,221,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,0,170,16,0,0,204,193,0,0,
+204,204,16,0,204,204,16,0,172,193,0,0,177,16,14,0,0,0,14,0,0,0,14,0,0,0,14,0,0,0,238,0,0,0,238,0,0,0,238,0,0,0,238,0,0,14,238,0,0,14,238,0,0,238,238,0,0,237,16,0,238,221,16,0,
+29,221,16,0,221,209,0,0,221,209,0,0,221,16,0,0,17,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,129,0,0,0,17,0,0,0,129,173,0,0,106,171,208,0,102,171,208,0,102,170,189,0,86,170,189,0,54,170,185,136,
+106,170,185,152,106,170,185,152,186,171,217,137,59,178,217,152,34,34,217,144,34,38,119,139,34,104,102,120,34,105,102,119,34,102,102,119,50,166,102,119,50,169,119,136,58,135,136,146,58,182,103,114,10,189,204,34,10,188,204,194,11,172,204,194,
+0,188,204,204,0,0,204,204,0,0,204,204,0,0,12,204,0,0,0,204,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,221,221,208,0,0,13,221,0,0,0,13,0,0,221,221,0,0,0,221,0,0,0,0,
+128,0,0,0,144,0,0,0,144,0,0,0,0,0,0,0,0,0,0,0,171,0,0,0,186,176,0,0,186,179,0,0,187,179,0,0,179,51,51,0,35,51,51,54,51,48,0,54,51,16,0,54,33,33,0,6,32,33,0,0,0,2,16,0,
+0,2,16,0,0,0,0,0,192,0,0,0,204,192,0,0,204,204,204,0,204,204,204,204,12,204,204,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,0,0,0,221,0,0,0,221,208,0,0,221,221,0,0,221,221,0,0,
+221,220,16,0,13,220,16,0,13,220,16,0,13,220,225,0,0,204,209,0,0,204,193,0,0,106,193,0,0,198,161,0,160,204,161,0,107,172,193,0,102,172,193,0,106,204,193,0,170,204,193,0,186,204,193,0,1,204,16,0,0,17,16,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,192,0,0,0,0,0,0,0,0,0,0,0,0,0,1,67,0,0,52,67,0,0,52,67,0,3,68,84,0,35,68,84,0,35,69,84,2,35,69,84,2,3,69,85,
+0,3,68,85,0,0,52,83,0,0,52,67,0,0,51,67,0,0,3,68,0,0,3,52,0,0,0,51,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+81,22,106,170,17,22,86,170,17,102,83,106,22,102,99,170,102,102,84,59,102,102,68,51,86,84,68,51,68,68,68,51,85,68,67,51,164,68,67,51,170,180,51,51,58,171,35,50,58,178,51,34,50,178,51,51,51,34,34,51,51,34,34,0,
+51,50,34,0,3,51,34,32,0,51,50,32,0,0,50,32,0,0,3,34,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,17,
+0,0,0,13,0,0,0,17,0,0,0,204,0,0,0,204,1,13,221,204,129,26,187,220,24,26,170,171,86,102,170,170,0,0,0,0,0,0,0,221,0,0,13,238,0,13,222,238,13,222,238,17,222,225,17,221,17,29,187,221,221,221,189,173,
+204,208,10,170,204,0,0,170,192,8,0,34,200,136,144,34,201,152,144,34,201,152,128,11,201,153,144,170,189,153,152,187,171,221,119,119,171,214,118,103,171,38,134,102,171,38,150,102,178,34,102,103,34,34,42,153,50,34,34,167,50,34,34,171,
+50,34,34,42,34,34,51,34,34,34,0,51,34,34,0,0,51,34,32,0,51,34,32,0,51,50,34,0,51,51,34,0,0,0,0,0,225,0,0,0,225,16,0,0,29,16,0,0,221,16,0,0,209,16,0,0,219,16,0,0,171,16,0,13,
+187,16,0,0,29,0,0,0,16,0,0,0,16,0,0,0,33,0,0,0,43,48,0,0,171,179,0,0,187,179,48,0,187,51,48,0,123,35,51,48,120,35,51,51,120,35,49,67,120,114,32,67,135,114,34,4,102,210,34,132,109,179,34,100,
+189,171,51,198,170,171,0,28,59,176,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,0,0,0,13,0,0,0,13,208,0,0,
+221,221,0,0,13,221,208,0,13,221,221,0,0,221,221,0,0,221,221,208,0,13,220,16,0,13,220,193,0,13,220,193,0,13,220,193,0,13,187,193,0,10,186,177,17,204,170,161,58,203,204,161,17,171,204,193,58,171,204,16,150,187,204,16,
+106,172,193,0,202,17,16,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,50,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,17,0,0,1,67,0,0,52,67,0,0,52,67,0,3,68,84,0,35,68,84,2,35,69,84,34,35,69,84,0,3,69,85,
+0,3,68,85,0,3,68,83,0,0,52,67,0,0,52,67,0,0,51,67,0,0,3,51,0,0,3,51,0,0,0,51,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,13,221,0,129,26,187,221,24,26,170,171,86,102,170,170,81,22,106,170,17,22,86,170,17,102,83,106,22,102,99,170,102,102,84,59,102,102,68,51,86,84,68,51,68,68,68,51,
+85,68,67,51,164,68,67,51,170,180,51,51,170,187,35,50,171,34,51,34,34,35,51,51,50,34,32,51,51,34,32,0,51,34,32,0,51,50,34,0,0,51,34,0,0,3,50,0,0,0,2,32,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,14,238,0,14,238,238,0,238,238,238,14,224,14,238,224,0,224,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,8,136,144,0,153,152,144,0,153,152,128,11,153,153,144,170,189,153,152,187,
+161,17,27,183,204,204,193,17,172,204,204,204,171,204,204,204,178,44,204,204,34,34,204,204,50,34,34,204,50,34,34,172,50,34,34,42,34,34,51,51,34,34,0,0,34,34,32,0,51,34,32,0,51,50,32,0,51,51,34,0,0,51,51,32,
+0,0,0,0,238,0,0,0,238,238,224,0,238,237,17,0,238,238,222,17,0,238,237,221,0,0,237,221,0,0,0,203,0,0,0,13,0,0,0,10,0,32,2,170,2,34,34,42,0,33,2,170,11,49,16,170,171,179,0,10,187,179,48,0,
+187,51,48,0,123,35,49,0,17,35,49,33,204,19,49,34,204,193,17,2,204,204,193,16,204,204,204,29,204,204,204,237,220,204,205,221,170,221,221,221,11,176,13,221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,209,0,0,0,221,16,0,0,187,177,0,0,237,221,16,0,237,221,209,0,238,221,221,16,173,221,221,16,187,221,221,16,187,209,17,0,176,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,13,34,0,0,221,0,0,221,208,221,221,221,221,221,221,221,208,221,221,221,0,221,221,208,0,221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,17,0,0,0,1,0,0,0,12,0,0,0,13,0,0,0,13,1,13,221,13,129,26,187,221,24,26,170,172,86,102,170,170,
+0,0,0,0,0,0,0,0,0,0,0,17,0,1,17,202,1,28,204,202,28,204,204,202,204,204,204,108,221,221,102,12,221,221,0,0,221,208,0,6,221,8,0,0,221,136,144,0,221,152,144,0,217,152,128,11,217,153,144,170,205,153,152,187,
+204,221,119,119,172,214,118,103,171,38,134,102,171,38,150,102,178,34,102,103,34,34,42,153,50,34,34,167,50,34,34,171,50,34,34,42,34,34,51,34,34,34,0,51,34,34,0,0,51,34,32,0,51,34,32,0,51,50,34,0,51,51,34,0,
+0,0,0,0,0,0,0,0,161,17,16,0,172,204,16,224,172,204,16,14,204,204,16,0,202,161,16,0,106,171,0,0,102,170,0,0,4,32,0,0,4,0,0,0,3,48,0,0,4,0,0,0,4,48,0,0,164,67,0,0,187,67,48,0,
+187,51,49,17,123,35,49,34,120,35,49,33,120,35,49,42,120,114,34,10,135,114,34,32,102,210,34,0,109,179,51,32,189,171,0,48,170,171,0,0,59,176,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,224,0,0,0,14,0,0,0,238,224,0,0,14,238,0,0,0,238,224,0,0,238,238,0,0,14,238,0,0,14,225,224,0,14,237,16,0,0,237,16,0,0,237,209,
+1,0,29,209,171,17,221,209,17,189,221,209,33,221,221,30,173,221,209,237,221,209,30,208,221,30,237,0,13,221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,13,221,0,13,221,221,0,221,13,221,13,0,13,221,208,0,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,8,136,144,0,153,152,144,0,153,152,128,11,153,153,144,170,189,153,152,187,
+171,221,119,119,171,214,118,103,171,38,134,102,171,38,150,102,178,34,102,103,34,34,42,153,50,34,34,167,50,34,34,171,50,34,34,42,34,34,51,51,34,34,0,0,34,34,32,0,51,34,32,0,51,50,32,0,51,51,34,0,0,51,51,32,
+0,0,0,0,221,0,0,0,221,209,16,0,221,220,193,16,221,221,204,225,0,221,220,204,0,0,220,204,0,0,13,204,0,0,0,102,0,0,0,12,0,0,0,0,0,0,0,6,0,0,0,6,11,48,3,54,171,179,51,51,187,179,51,0,
+187,51,48,0,123,35,49,16,120,35,49,33,120,35,49,34,120,114,34,0,135,114,32,0,102,204,194,0,109,204,204,204,188,204,204,204,170,204,204,204,11,176,12,204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,193,0,0,0,170,16,0,0,170,193,0,0,204,204,16,0,186,204,193,0,102,204,193,0,106,172,204,16,106,170,204,16,102,177,17,0,54,0,0,0,
+0,0,0,0,0,0,0,0,16,0,0,12,33,0,0,12,0,0,0,204,0,0,204,192,0,204,204,204,204,204,204,192,204,204,204,0,204,204,192,0,204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,4,51,0,0,48,2,0,0,0,0,0,0,0,0,0,0,0,51,0,0,51,51,0,3,51,50,0,51,34,34,0,50,34,34,3,50,34,34,3,34,0,0,3,0,0,51,
+2,0,3,34,0,0,50,34,0,0,34,34,0,2,34,34,0,2,34,0,0,2,32,0,0,2,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,4,68,68,68,68,68,68,51,51,52,68,34,34,51,51,34,34,34,51,34,34,35,50,2,35,51,50,51,51,51,51,51,51,51,51,34,35,51,51,34,35,51,51,34,35,51,51,34,35,51,51,34,35,51,51,34,34,51,51,
+34,34,51,51,34,34,35,51,34,34,34,51,34,34,34,34,0,34,35,51,2,34,51,34,34,35,51,59,34,35,51,59,34,35,51,152,32,2,51,153,0,34,34,152,0,34,34,45,0,34,34,34,0,2,34,45,0,0,0,34,0,0,0,0,
+0,0,0,0,48,0,0,0,68,85,0,0,69,74,80,32,51,42,69,64,34,37,68,85,34,37,68,68,34,37,68,68,34,35,51,68,51,51,53,101,51,51,70,102,51,51,86,102,51,51,86,102,51,51,86,102,51,51,54,102,59,187,53,102,
+187,170,179,182,187,182,107,170,59,185,118,102,51,187,153,118,51,119,119,119,34,152,135,120,179,57,136,153,49,24,153,153,130,57,153,0,136,136,144,221,136,153,141,221,221,216,141,221,45,221,153,209,221,221,17,16,17,17,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,80,0,0,0,69,0,0,0,69,0,0,0,68,80,0,0,84,80,0,0,101,64,0,0,117,48,0,0,136,0,0,0,145,144,0,0,184,17,128,0,
+161,17,0,0,176,0,0,0,128,0,0,0,104,144,12,0,120,144,12,0,137,0,205,0,144,0,205,0,0,12,208,0,12,221,0,0,221,221,0,0,221,16,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,51,0,0,0,34,0,0,0,2,0,2,34,2,0,34,34,35,0,34,34,51,0,51,34,51,3,51,57,153,3,211,216,152,
+1,211,216,136,1,221,216,130,1,221,217,131,1,221,137,137,0,25,136,145,0,25,221,1,0,29,221,208,0,1,221,208,0,0,29,208,0,0,29,221,0,0,1,221,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,4,0,0,0,0,35,68,64,0,0,51,68,64,0,3,51,52,0,0,35,51,0,0,35,51,51,0,34,51,34,48,34,51,34,34,34,35,68,34,34,35,51,66,34,35,51,52,34,52,51,36,35,67,187,35,35,51,
+58,35,51,187,19,35,59,170,19,151,186,187,121,119,185,107,135,119,151,123,152,119,151,179,25,135,119,187,25,136,120,181,1,153,137,187,0,25,145,1,0,1,16,1,208,0,0,1,29,208,0,0,1,29,208,0,0,0,0,0,0,0,0,0,
+0,0,0,0,68,64,0,0,3,53,80,0,3,51,53,0,0,51,68,80,0,51,68,80,64,51,52,69,52,51,52,69,52,51,52,68,52,67,52,68,51,67,68,85,51,51,69,102,52,51,86,102,67,51,86,102,51,51,69,102,51,51,52,85,
+51,51,51,52,179,51,51,52,179,51,51,52,179,51,51,51,51,68,67,51,69,85,85,67,85,85,85,83,85,85,85,51,177,17,67,51,129,20,51,51,25,3,51,48,16,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,5,0,0,0,4,80,0,0,52,80,0,83,52,69,0,83,52,69,0,67,68,69,0,84,68,68,80,101,68,68,80,101,68,68,80,84,68,68,80,69,52,68,64,
+69,83,68,48,68,84,84,0,68,69,85,0,85,90,165,0,51,51,48,0,51,51,0,0,51,51,32,0,51,48,0,0,51,48,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,221,0,0,13,221,0,0,221,209,0,0,209,16,0,13,16,0,0,209,0,9,0,209,0,152,0,16,9,135,0,16,9,135,0,0,0,8,0,0,0,11,0,0,17,27,
+0,8,17,139,0,0,9,17,0,0,0,17,0,0,2,65,0,0,2,52,0,0,2,35,0,0,2,35,0,0,0,34,0,0,0,34,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,204,204,12,204,204,204,221,102,221,195,221,214,109,221,221,22,136,102,17,8,102,102,0,153,147,38,153,136,97,19,136,102,147,58,119,119,121,34,119,118,102,51,119,153,187,51,119,119,154,179,187,183,123,171,91,59,187,187,
+85,67,187,179,85,83,51,51,85,84,51,51,85,84,51,51,85,84,51,51,85,83,51,51,53,67,51,51,51,51,50,34,34,34,50,34,34,34,50,34,34,34,50,34,2,34,178,34,2,2,178,34,0,0,34,34,0,0,0,2,0,0,0,0,
+0,0,0,0,68,0,0,0,196,68,64,0,51,52,68,0,211,51,68,0,104,51,52,0,136,85,64,4,104,53,84,68,179,51,84,68,179,51,52,68,34,51,68,85,51,51,69,102,35,51,86,102,51,51,86,102,53,83,69,102,51,85,52,85,
+51,69,51,51,51,52,83,35,51,52,83,51,51,52,83,68,51,52,51,51,51,51,50,34,51,51,50,34,51,51,35,34,35,51,35,48,35,50,51,51,34,51,51,51,34,34,51,51,34,34,34,34,34,34,34,34,34,34,32,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,64,0,0,0,68,0,0,0,68,0,0,0,68,0,64,0,64,4,64,0,64,68,64,0,84,68,48,0,101,68,48,0,101,67,0,0,84,51,0,0,67,32,0,64,
+50,0,4,48,32,0,68,32,52,68,51,32,67,51,34,0,50,34,34,0,34,34,32,0,34,34,0,0,34,0,0,0,0,0,0,0,0,0,0,0,48,2,0,0,34,32,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,3,51,0,0,3,51,0,2,51,51,0,0,51,51,0,3,51,51,0,52,68,90,0,51,34,34,0,51,50,34,3,51,50,34,
+3,51,51,34,3,50,35,51,3,50,34,51,3,50,34,35,3,50,34,34,0,50,34,34,0,50,34,34,0,50,34,32,0,2,34,0,0,2,32,0,0,0,32,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,1,3,51,48,145,51,51,65,24,51,53,17,27,51,86,102,102,53,86,102,102,52,85,86,101,51,52,68,51,51,51,51,59,35,51,51,59,35,51,51,59,35,51,51,51,
+51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,35,51,51,50,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,2,34,34,34,2,2,34,34,0,2,34,34,0,0,34,34,32,0,2,34,32,0,0,2,34,0,0,0,0,
+0,0,0,0,0,0,0,0,0,13,220,192,0,0,13,220,16,0,0,13,16,9,144,0,16,8,137,0,170,134,104,144,106,102,102,137,186,102,102,137,59,105,102,104,182,105,103,102,182,154,102,102,187,186,102,102,187,179,69,102,187,51,52,165,
+51,50,50,170,51,50,50,51,51,34,51,51,50,34,35,51,34,34,34,51,34,34,34,34,34,34,2,34,34,34,0,34,34,34,0,0,34,34,0,0,34,34,32,0,2,34,34,0,0,2,34,34,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,204,0,0,0,220,192,0,0,220,204,0,0,13,204,0,0,13,204,192,0,13,220,204,0,144,221,108,0,152,102,108,0,102,134,204,192,102,141,204,192,86,109,220,192,102,109,61,192,
+104,109,61,48,136,131,51,48,51,51,51,0,51,51,50,0,50,35,50,0,32,34,32,0,32,0,0,0,34,0,0,0,34,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,51,0,0,3,51,0,0,35,35,0,0,35,51,0,2,35,35,0,34,50,51,0,35,35,51,0,34,35,35,2,34,51,51,2,34,35,35,2,34,50,51,2,34,35,35,
+2,34,35,51,3,34,34,50,3,34,35,35,3,34,34,51,0,50,34,34,0,66,34,51,0,50,34,34,0,3,34,34,0,0,50,34,0,0,66,34,0,0,4,34,0,0,0,66,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,51,51,3,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+51,51,51,51,51,51,51,51,51,51,51,51,35,51,51,51,51,51,51,51,35,35,51,51,50,51,51,51,34,50,51,51,34,50,51,35,34,50,50,51,34,34,35,35,34,34,34,34,50,34,34,34,3,67,34,34,0,0,51,50,0,0,0,0,
+0,0,0,0,51,51,0,0,51,51,51,48,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,69,84,51,52,86,101,51,53,102,102,51,53,102,102,51,52,86,101,51,51,69,84,51,51,51,51,
+51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,35,35,35,51,50,51,51,35,35,35,34,51,34,34,35,34,34,34,34,32,34,34,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,51,48,0,0,51,51,0,0,51,51,0,0,51,51,48,0,51,51,51,0,67,51,51,0,83,51,51,0,83,51,51,48,67,51,51,48,51,51,51,48,51,51,51,48,
+51,51,51,48,51,51,51,48,51,51,51,48,51,51,51,48,51,51,51,0,51,51,51,0,51,51,51,0,51,51,48,0,51,51,48,0,50,51,0,0,35,32,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,2,51,0,0,35,50,0,34,35,51,0,34,50,51,2,34,35,50,2,34,51,35,34,34,34,50,34,34,35,35,50,34,34,51,34,34,34,50,3,34,34,35,2,34,34,34,
+0,50,34,34,0,35,34,34,0,0,50,34,0,0,2,50,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,35,51,51,51,51,51,51,51,50,51,51,51,35,35,51,51,35,50,35,51,34,34,51,35,34,34,50,51,34,34,34,34,51,34,34,34,0,35,51,34,0,0,0,35,0,0,0,0,
+0,0,0,0,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+51,51,51,51,51,51,51,51,35,35,51,51,50,35,50,35,34,34,35,50,34,34,34,34,51,50,34,34,0,0,0,0,0,0,0,0,51,0,0,0,51,51,51,0,51,51,51,51,51,51,51,51,51,52,68,51,51,69,85,67,52,86,102,84,
+69,102,102,101,69,102,102,101,52,86,102,84,51,69,85,67,51,52,68,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,35,51,35,50,51,34,51,35,34,34,34,0,34,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,51,48,0,0,51,51,0,0,51,51,50,0,51,51,51,0,67,51,51,48,67,51,51,48,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,48,51,51,51,48,
+51,51,51,0,51,51,50,0,51,51,0,0,51,32,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,3,0,0,0,51,0,0,3,51,0,0,51,51,0,0,51,51,0,3,51,51,0,51,51,51,0,51,51,51,0,51,51,51,3,51,51,51,3,51,51,51,35,35,51,51,35,51,51,51,34,35,35,51,35,51,35,35,
+34,35,51,51,34,35,35,51,34,34,34,35,34,34,34,34,2,34,34,34,2,34,34,34,0,35,34,34,0,0,34,51,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,51,0,0,51,51,0,3,51,51,0,51,51,51,3,51,51,51,
+51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+35,35,50,35,35,35,50,51,51,35,50,34,34,34,34,34,34,34,34,34,34,34,34,51,34,34,50,0,35,50,0,0,0,0,51,51,0,51,51,51,51,51,51,51,51,51,51,51,51,68,68,67,52,85,85,84,69,86,102,84,69,102,102,84,
+69,102,102,84,69,102,101,84,68,85,85,67,52,68,68,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,34,51,51,51,35,51,50,51,34,51,34,34,34,35,51,34,34,
+50,34,34,48,34,34,35,0,34,34,48,0,34,50,0,0,35,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,51,51,0,0,51,51,51,0,51,51,51,48,51,51,51,48,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+51,51,51,51,51,51,51,51,51,51,51,50,51,51,51,51,51,51,50,48,51,51,50,48,51,50,50,0,51,50,50,0,51,50,34,0,35,34,32,0,35,34,0,0,34,34,0,0,34,32,0,0,34,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,51,0,0,3,51,0,0,35,51,0,0,51,51,0,2,51,51,
+0,3,35,51,0,2,51,51,0,35,51,51,0,35,35,51,0,34,51,51,0,34,51,51,2,35,51,51,2,35,35,51,2,34,51,51,2,35,35,51,2,35,35,51,2,34,51,51,2,34,51,51,3,34,34,51,3,34,35,51,3,34,50,51,
+3,34,35,51,2,34,35,35,0,50,34,51,0,50,35,50,0,50,34,34,0,34,34,35,0,3,34,35,0,3,34,34,0,51,51,0,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,68,
+51,51,52,85,51,51,69,102,51,52,86,102,51,52,86,102,51,52,86,102,51,51,69,102,51,51,52,85,51,51,51,68,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,35,51,51,51,50,51,51,51,35,50,51,51,0,0,0,0,0,0,0,0,50,0,0,0,51,0,0,0,51,48,0,0,51,51,0,0,51,51,0,0,51,51,48,0,
+67,51,48,0,84,51,48,0,101,67,51,0,101,67,51,0,101,67,51,0,84,51,51,0,67,51,51,48,51,51,51,48,51,51,51,48,51,51,51,48,51,51,51,48,51,51,51,48,51,51,51,48,51,51,51,48,51,51,51,48,51,51,51,48,
+51,51,51,48,51,51,51,48,51,51,51,0,51,51,51,0,51,51,51,0,51,51,51,0,51,51,48,0,51,51,48,0,0,2,34,34,0,0,50,34,0,0,34,34,0,0,3,34,0,0,0,50,0,0,0,35,0,0,0,0,0,0,0,0,
+35,35,50,50,34,51,35,35,34,34,50,51,34,34,34,50,34,34,34,34,34,34,34,34,35,34,34,34,0,35,34,0,51,35,48,0,51,51,0,0,35,50,0,0,50,32,0,0,34,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,
+0,0,34,34,0,34,34,34,2,34,34,34,3,34,34,51,34,34,34,35,34,34,34,51,50,34,34,51,50,34,35,51,34,34,35,34,50,34,35,51,50,34,34,34,34,34,35,51,3,34,35,51,2,34,34,34,0,50,34,50,0,50,34,51,
+0,34,34,35,0,3,34,34,0,0,50,34,0,0,34,34,0,0,3,34,0,0,0,50,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+34,34,0,0,50,51,51,0,50,50,51,51,51,51,51,51,34,51,51,51,51,51,51,51,35,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+35,51,51,51,51,51,51,51,50,51,51,51,50,35,51,51,34,51,51,51,34,51,51,51,34,34,35,51,34,35,35,51,2,34,34,35,0,34,35,51,0,2,34,35,0,0,34,34,0,0,0,34,0,0,0,2,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,48,0,0,0,51,0,0,0,51,51,0,0,51,51,48,0,51,51,51,0,51,51,51,48,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+51,51,52,68,51,51,68,85,51,51,69,102,51,51,69,102,51,51,69,102,51,51,69,86,51,51,52,85,51,51,51,68,51,51,51,51,51,51,51,51,51,51,51,51,34,51,51,51,51,51,51,51,34,34,51,51,0,51,51,51,0,0,50,51,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,51,0,0,0,51,48,0,0,51,51,0,0,51,51,0,0,51,51,48,0,51,51,51,0,
+68,51,51,0,85,67,51,0,101,84,51,48,102,84,51,48,102,84,51,51,102,84,51,51,85,84,51,51,68,67,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,48,51,51,51,48,51,51,51,0,51,51,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,0,2,34,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,51,0,0,51,34,0,3,34,34,0,34,34,34,0,34,34,34,0,0,0,34,
+0,0,0,0,0,0,0,0,0,0,0,0,0,51,51,0,51,68,68,51,43,180,68,68,42,171,68,84,42,170,180,69,42,170,164,85,59,180,68,68,51,52,70,102,51,51,102,102,51,53,102,102,35,53,97,22,35,53,97,22,34,53,97,22,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,67,48,2,32,68,68,34,32,84,68,67,32,85,68,68,32,69,68,68,48,84,84,85,48,101,69,102,83,101,53,102,99,102,81,22,99,102,97,22,98,102,97,22,98,
+0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,34,0,0,0,34,0,0,0,34,0,0,0,34,0,0,0,32,0,0,0,11,0,0,0,189,0,0,10,208,0,0,102,96,0,6,103,118,0,118,104,137,0,119,104,144,0,119,105,0,
+0,121,96,0,0,9,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,35,97,22,34,34,86,102,34,43,166,102,34,43,170,170,33,34,187,173,34,17,34,187,32,43,178,221,11,190,226,43,
+190,226,34,43,224,34,34,43,0,34,34,18,0,34,32,1,96,32,0,0,144,0,0,0,0,0,0,0,0,0,0,2,0,0,2,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+102,97,22,82,102,184,24,176,106,161,17,176,170,170,171,0,218,170,189,0,187,189,208,0,221,219,176,35,187,170,178,24,170,170,178,24,186,171,33,8,187,179,33,1,35,49,16,0,34,48,0,0,33,35,0,0,33,2,51,6,16,0,34,38,
+0,0,2,39,0,0,0,119,0,0,0,136,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,224,0,0,209,224,0,13,30,224,0,13,30,0,0,209,237,0,7,129,237,0,141,30,237,0,
+221,30,224,0,209,238,208,0,209,237,0,0,30,237,0,193,1,16,204,193,0,6,204,193,96,108,204,193,104,108,204,16,108,108,204,16,140,108,204,16,204,120,193,0,220,199,193,0,29,216,16,0,1,221,16,0,0,17,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,3,34,0,0,34,34,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,3,0,0,3,50,0,0,50,34,0,2,34,34,0,2,34,34,0,0,0,34,
+0,0,0,0,0,0,0,0,0,0,0,0,51,51,51,0,68,68,68,51,43,180,68,68,42,171,68,84,42,170,180,69,42,170,164,85,59,180,68,68,51,52,70,102,51,51,102,102,51,53,102,102,35,53,97,22,35,53,97,22,34,53,97,22,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,67,48,2,32,68,68,34,32,84,68,67,32,85,68,68,32,69,68,68,48,84,84,85,48,101,69,102,83,101,53,102,99,102,81,22,99,102,97,22,98,102,97,22,98,
+0,0,0,2,0,0,0,34,0,0,0,34,0,0,2,34,0,0,2,34,0,0,2,34,0,0,2,34,0,0,10,171,0,102,171,189,102,102,123,0,102,134,96,0,136,152,112,0,144,9,112,0,0,0,0,0,0,0,0,0,0,0,0,0,
+34,35,97,22,34,34,86,102,34,43,166,102,34,43,170,170,33,34,187,173,34,17,34,187,187,187,178,221,221,222,226,43,0,2,34,43,0,2,34,43,0,2,34,18,0,2,34,1,0,2,0,0,0,0,0,0,0,0,0,2,0,0,2,33,
+102,97,22,82,102,184,24,176,106,161,17,176,170,170,171,0,218,170,189,0,187,189,208,0,221,219,176,35,187,170,178,24,170,170,178,24,186,171,33,8,187,179,33,1,35,49,16,0,34,48,0,0,33,35,0,0,16,2,51,6,0,0,34,38,
+0,0,0,0,0,0,1,224,0,0,209,224,0,13,30,224,0,13,30,0,0,209,237,0,7,129,237,0,141,30,237,0,221,30,224,0,209,238,208,0,209,237,0,0,30,237,0,193,1,16,204,193,0,6,204,193,96,108,204,193,104,108,204,16,
+0,0,2,39,0,0,0,119,0,0,0,136,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,108,204,16,140,108,204,16,204,120,193,0,220,199,193,0,29,216,16,0,1,221,16,0,0,17,0,0,0,0,0,0,
+0,0,0,0,0,0,0,7,0,0,0,118,0,0,0,150,0,0,0,104,0,0,0,121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,68,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,3,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,68,68,34,34,51,51,0,2,34,35,0,0,34,34,
+0,0,34,34,68,68,66,51,34,51,50,35,35,50,34,35,35,34,186,34,35,34,219,162,19,49,29,186,18,52,68,27,4,69,68,0,0,68,85,64,0,36,53,84,0,34,52,85,0,2,52,85,68,34,38,69,51,66,98,38,54,55,98,98,
+38,54,102,38,55,118,102,120,50,118,103,119,70,150,119,130,54,121,130,37,173,119,36,74,187,34,51,66,178,51,51,34,0,3,84,0,0,3,84,0,0,51,69,64,64,51,69,64,64,51,69,67,84,51,69,67,100,52,85,70,36,52,69,67,
+119,68,68,67,34,68,68,67,119,68,68,51,34,68,68,51,85,84,68,51,181,84,67,50,170,181,67,50,170,170,67,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,0,0,0,103,0,0,0,
+103,0,0,0,55,0,0,0,56,0,0,0,57,0,0,0,48,0,0,0,0,0,0,0,32,0,0,0,34,0,0,0,1,17,36,29,0,7,102,120,0,8,136,136,0,29,136,221,1,221,216,118,1,221,135,124,29,221,140,204,17,17,17,17,
+37,102,83,50,23,118,101,34,23,119,117,35,137,145,146,34,141,17,50,34,204,205,17,19,204,204,204,205,17,17,17,17,42,163,51,34,34,51,51,0,51,50,35,0,34,35,48,0,35,48,0,0,48,0,0,0,17,237,208,0,17,17,16,0,
+0,0,0,0,0,0,0,0,0,0,0,68,0,0,3,34,0,0,0,2,0,0,0,0,0,0,0,2,0,0,2,32,0,0,0,0,0,0,0,51,34,0,51,68,34,36,68,68,35,68,68,69,36,68,68,85,52,68,68,85,52,68,68,84,
+3,51,51,48,52,68,68,67,68,68,187,34,84,75,170,34,68,186,170,34,84,170,170,32,68,68,187,48,51,52,51,51,0,0,0,0,48,0,0,0,35,0,0,0,34,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,
+0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,7,119,120,
+0,0,151,137,0,7,137,152,0,120,120,136,0,7,136,137,0,0,152,144,0,0,0,0,0,0,0,0,0,0,0,0,69,68,69,67,86,52,68,53,102,52,67,86,102,99,53,102,102,17,81,22,86,17,97,22,184,24,177,22,177,17,170,102,
+11,170,170,170,13,186,161,170,0,221,174,171,0,0,218,221,0,0,0,13,0,0,11,219,0,187,189,219,123,221,208,11,125,0,0,0,144,0,0,0,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,204,0,0,204,204,0,0,17,17,86,83,51,50,102,101,51,50,102,101,51,34,102,101,51,34,102,101,50,34,102,99,34,34,102,82,34,34,102,171,34,34,
+170,171,34,34,171,178,33,34,178,33,18,186,221,187,180,43,187,170,187,66,170,170,171,66,170,170,171,66,186,170,187,52,187,187,178,51,2,51,33,17,0,34,0,0,0,66,0,0,0,4,32,0,0,4,41,0,0,148,103,144,7,102,120,16,
+9,119,141,209,0,205,221,221,6,108,205,221,124,118,104,209,204,204,136,16,204,204,209,0,204,209,16,0,17,16,0,0,35,48,0,0,34,35,0,0,34,34,48,0,34,34,32,0,34,0,0,0,0,0,0,0,32,0,0,0,34,0,0,0,
+34,32,0,6,34,32,0,118,170,170,182,134,187,187,215,152,0,0,9,135,32,0,0,153,34,0,0,0,0,0,0,0,68,0,0,0,35,68,0,0,0,51,102,0,0,6,134,96,0,120,118,204,0,7,204,198,0,1,220,102,0,1,221,108,
+0,0,17,29,16,0,0,1,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,0,0,0,
+144,0,0,0,118,102,0,0,135,121,0,0,135,102,0,0,119,153,0,0,151,112,0,0,9,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,0,0,0,204,204,0,0,204,204,204,0,204,204,204,208,
+221,204,204,205,17,17,17,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,34,0,0,0,35,0,0,0,36,0,0,0,52,
+0,0,0,53,0,0,3,86,0,0,3,102,0,0,3,102,0,0,2,102,0,0,2,102,0,0,2,86,0,0,0,184,0,0,0,177,0,0,0,11,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,3,0,0,51,52,0,51,68,68,36,68,68,84,68,68,85,68,68,69,85,84,68,69,68,68,84,84,69,86,83,68,86,102,101,53,102,102,102,86,102,102,102,102,102,102,17,97,22,102,17,97,22,102,24,177,22,102,
+17,170,102,102,170,170,170,170,186,161,170,171,221,174,171,178,0,218,221,221,0,0,0,219,0,0,13,186,0,0,221,187,0,0,0,0,51,51,48,0,68,68,67,48,68,187,34,35,75,170,34,34,186,170,34,0,170,170,32,105,68,187,48,105,
+68,51,51,102,99,51,50,103,101,51,50,136,101,51,34,104,101,51,34,166,101,50,34,171,99,34,42,176,82,34,42,178,171,34,171,34,171,34,171,34,178,42,178,34,33,20,176,2,187,187,68,32,186,170,180,34,170,170,179,68,170,171,50,34,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,105,0,0,6,134,144,0,152,103,144,0,136,120,105,0,135,118,144,0,119,121,0,0,152,48,0,0,98,32,0,0,144,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,32,0,0,0,34,0,0,0,34,0,0,0,2,0,0,0,0,0,0,0,68,0,0,0,36,64,0,0,0,0,189,27,0,0,189,0,0,0,176,0,0,11,208,0,0,11,208,0,0,119,121,0,0,137,144,0,135,152,137,0,
+120,152,137,0,9,119,137,0,7,120,137,0,9,121,144,7,0,0,0,12,0,0,0,204,0,0,204,204,0,1,17,17,187,187,33,17,35,50,16,0,0,34,0,0,0,66,0,0,0,66,0,0,0,66,0,0,9,70,121,0,118,103,129,0,
+151,120,221,16,12,221,221,209,102,204,221,209,199,102,141,16,204,200,129,0,204,205,16,0,204,209,0,0,17,16,0,0,18,54,96,0,2,104,102,0,7,135,108,192,0,124,204,102,1,220,198,108,1,221,102,204,0,17,109,204,0,0,17,221,
+0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,0,0,204,0,0,0,204,192,0,0,204,204,208,0,204,204,205,0,
+17,17,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,51,0,34,34,51,0,0,34,34,0,0,0,2,0,35,48,0,0,2,35,35,0,2,35,51,
+0,3,50,54,0,51,38,104,68,50,40,136,35,68,66,168,18,35,74,189,209,34,42,178,51,34,42,178,34,34,50,187,51,51,48,0,51,52,67,51,51,50,36,68,35,50,162,68,34,43,170,36,35,43,170,163,51,107,179,69,102,102,52,84,
+102,119,100,68,118,114,36,69,119,35,68,69,130,51,68,69,34,51,51,68,34,35,51,51,34,34,59,102,34,34,186,170,0,0,0,0,0,0,0,0,51,0,0,32,68,51,2,32,84,68,50,32,85,84,67,32,85,85,68,48,68,69,68,48,
+102,84,84,67,102,101,68,69,102,97,52,65,102,97,19,65,102,97,21,17,70,97,22,24,53,102,107,129,102,102,170,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,0,0,119,152,0,119,121,137,
+135,120,152,119,135,120,153,153,151,119,0,0,9,151,112,0,0,9,144,0,0,0,0,0,128,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,28,0,0,1,204,0,0,1,204,
+0,0,28,204,0,0,28,204,0,1,204,221,0,1,221,17,0,1,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,204,0,0,28,204,192,0,204,198,102,0,204,102,99,97,204,104,98,51,204,136,135,34,205,216,120,17,
+205,209,0,29,221,16,0,29,17,0,0,29,0,0,0,29,0,0,0,29,0,0,0,17,0,0,0,0,0,0,0,0,17,35,51,34,209,35,51,187,209,43,187,170,209,219,187,186,16,13,187,187,0,0,13,208,0,0,0,0,0,0,0,0,
+34,34,186,170,178,34,43,170,162,1,45,187,189,0,17,221,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,170,170,170,0,170,171,189,0,187,189,208,0,221,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,96,0,6,103,102,0,7,102,118,0,103,118,136,0,150,136,153,0,9,137,137,0,0,152,136,0,0,9,136,0,0,0,153,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,4,0,0,0,4,0,0,0,4,0,0,0,4,137,102,0,33,
+102,121,0,33,119,144,2,33,120,144,2,34,136,0,2,216,137,128,1,216,152,218,1,216,9,11,170,221,0,0,187,170,0,0,30,187,0,0,29,238,0,0,29,209,0,0,29,209,0,0,1,16,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,51,0,0,3,69,80,0,52,85,165,83,52,85,170,83,68,85,170,164,68,85,170,52,68,69,51,52,68,69,51,54,68,68,51,102,100,68,51,102,97,52,51,102,97,19,51,102,97,21,51,54,97,22,131,166,102,161,211,170,170,161,
+221,186,170,170,16,219,186,170,0,14,235,187,0,0,222,225,0,0,13,187,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,112,0,0,151,118,151,9,119,102,103,
+0,151,102,102,0,9,119,102,0,0,151,120,0,0,9,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,165,80,69,0,10,85,69,0,10,181,84,96,11,181,68,96,4,68,69,
+96,69,68,68,128,86,84,68,118,86,84,68,107,68,84,68,157,170,68,68,0,187,170,68,129,221,187,170,17,219,221,187,0,0,68,68,4,68,85,85,69,85,68,68,85,68,66,34,84,66,34,34,84,34,34,34,69,85,34,34,85,85,85,34,
+68,69,85,81,68,68,68,28,68,68,68,28,68,68,68,29,68,66,34,29,68,66,36,29,162,34,68,29,186,171,68,65,64,0,0,0,84,68,64,0,68,68,68,64,34,34,0,0,34,0,0,0,32,0,0,0,34,32,0,0,34,36,64,0,
+204,68,34,0,204,196,34,32,221,196,32,0,221,204,32,0,221,220,18,0,221,220,16,2,221,220,18,34,221,221,193,32,0,0,0,0,0,13,208,0,0,29,221,0,7,29,221,16,119,29,221,16,119,209,221,209,39,209,221,209,0,209,221,209,
+0,13,187,34,0,0,219,178,0,0,0,221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,187,36,65,34,34,75,177,34,34,43,171,0,0,13,187,0,0,0,219,0,0,0,0,0,0,0,0,0,0,0,0,
+221,221,193,0,221,221,193,0,29,221,193,0,29,221,193,0,177,221,193,0,221,29,193,0,0,1,16,0,0,0,0,0,0,13,29,209,0,13,29,209,0,0,29,209,0,0,1,209,0,0,1,209,0,0,0,16,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,51,51,0,34,34,34,0,0,34,34,0,0,0,2,0,2,51,0,0,0,35,54,0,0,54,104,0,0,56,136,0,3,34,168,36,66,42,189,210,35,74,178,221,34,42,178,51,34,34,171,34,34,50,187,
+0,0,0,0,3,51,51,48,51,50,68,67,35,42,36,68,34,186,171,68,35,107,170,164,102,102,179,69,102,119,100,84,118,114,36,68,119,36,68,69,130,67,68,69,34,51,68,69,34,51,51,68,34,35,51,51,34,34,59,102,34,34,186,170,
+0,0,0,0,0,0,0,0,51,0,2,0,68,51,34,0,84,68,50,32,85,84,67,32,85,85,68,48,68,69,68,48,102,84,84,67,102,101,68,69,102,97,52,65,102,97,19,65,102,97,21,17,70,97,22,24,53,102,107,129,102,102,170,17,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,0,0,119,152,0,119,121,137,7,120,152,119,119,120,153,153,135,119,0,0,153,151,112,0,0,9,144,0,128,0,0,0,16,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,28,0,0,0,28,0,0,1,204,0,0,1,204,0,0,1,204,0,0,28,205,0,0,29,221,0,0,29,209,0,0,17,16,0,0,0,0,
+0,0,0,0,0,0,0,0,29,204,0,0,28,204,192,1,204,198,102,29,204,102,99,61,204,104,98,35,204,136,135,18,205,216,120,29,205,209,0,29,221,16,0,29,209,0,0,29,16,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,
+17,35,51,34,209,35,51,187,209,43,187,170,16,219,187,186,0,13,187,187,0,0,13,208,0,0,0,0,0,0,0,0,34,34,186,170,178,34,43,170,162,1,45,187,189,0,17,221,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+170,170,170,0,170,171,189,0,187,189,208,0,221,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,51,68,
+0,3,52,34,0,51,66,170,3,51,50,42,3,51,51,43,51,50,34,34,50,34,34,34,34,0,2,50,32,0,3,34,0,0,3,34,0,0,50,34,0,0,50,34,0,3,34,34,0,3,34,34,0,3,34,34,0,3,34,0,0,2,0,0,
+0,0,0,2,0,0,0,34,0,0,0,34,0,0,0,34,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,2,32,0,3,51,50,51,51,68,68,68,68,85,85,68,68,68,85,
+34,52,68,68,170,52,69,102,170,52,70,102,162,52,69,102,178,51,68,102,34,35,68,69,34,35,68,68,34,34,51,51,34,34,51,59,34,34,35,59,34,34,34,43,34,33,34,34,34,34,17,34,34,42,170,163,42,171,187,59,171,178,34,59,
+171,34,34,59,182,104,104,51,214,134,102,35,40,152,136,35,0,136,136,36,0,24,128,36,0,0,0,36,0,17,6,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,84,51,0,0,84,65,0,0,
+68,68,16,1,145,21,17,145,105,17,103,17,102,145,107,16,102,102,170,176,102,102,106,189,69,102,170,189,102,106,171,208,170,170,171,208,170,170,189,0,170,171,208,0,187,189,0,0,34,45,0,0,186,171,208,0,170,170,176,0,170,170,176,0,
+186,171,208,0,187,189,25,0,51,50,152,128,33,33,152,128,34,1,25,0,34,0,0,0,32,0,0,0,32,0,0,0,1,204,102,66,1,204,120,119,1,204,199,135,1,220,199,113,1,220,204,193,1,220,204,29,0,29,204,29,0,29,220,29,
+41,0,0,0,153,0,0,0,153,0,0,0,208,0,0,0,208,0,0,0,208,0,0,0,208,0,0,0,208,0,0,0,0,29,220,29,0,29,221,29,0,29,221,29,0,1,209,208,0,1,209,0,0,1,209,0,0,0,16,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,153,0,0,150,102,144,9,102,102,105,150,102,102,104,150,119,102,105,151,136,119,121,8,17,17,137,9,0,0,144,0,0,0,0,0,9,153,144,0,150,102,105,
+9,102,102,102,150,102,102,103,150,119,119,119,151,137,153,136,151,17,17,153,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,51,0,0,2,38,0,0,34,102,144,0,213,102,105,189,219,97,
+123,221,177,17,125,13,177,24,144,13,186,27,0,13,186,170,0,13,186,170,0,0,218,170,0,0,219,170,0,0,13,187,134,0,0,221,134,170,0,0,134,187,170,170,153,144,187,187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2,34,0,0,50,68,51,51,52,68,68,52,68,68,68,83,68,68,68,52,68,68,69,52,68,68,85,52,68,68,68,52,68,51,51,83,51,85,83,177,17,102,101,17,22,102,101,97,102,102,101,166,102,102,83,170,102,179,51,170,170,178,34,
+187,187,34,33,221,218,170,189,170,171,187,210,187,176,1,34,0,0,0,18,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,51,48,0,0,68,67,51,0,68,68,68,51,68,68,68,68,85,84,68,68,85,68,67,51,68,75,187,178,
+52,170,170,178,51,74,170,51,51,59,163,17,51,51,49,34,51,51,51,49,51,50,34,35,34,34,34,34,34,34,34,34,18,34,34,17,34,34,17,34,34,34,34,34,34,34,34,17,34,33,17,0,17,16,0,0,0,0,0,0,0,0,0,0,
+35,49,17,17,17,30,238,238,18,46,238,238,33,222,238,238,17,17,238,238,51,17,17,17,34,33,0,0,33,17,17,0,17,205,221,17,28,221,221,221,28,221,221,221,1,204,221,221,0,17,204,205,0,0,17,28,0,0,0,1,0,0,0,0,
+16,0,0,0,225,17,16,0,238,238,225,16,238,238,238,225,238,238,17,16,17,17,0,0,0,0,0,0,0,0,0,0,17,0,0,0,221,17,0,0,221,221,17,0,221,221,221,16,221,221,221,209,204,205,209,16,17,17,16,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,51,48,0,0,34,35,0,0,34,34,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,2,32,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,153,144,0,9,102,105,9,150,102,102,150,150,102,102,135,151,118,102,151,151,136,119,153,8,17,24,144,9,0,9,0,0,0,0,0,0,153,153,0,9,102,102,144,
+150,102,102,104,150,102,102,104,150,119,118,104,150,153,151,105,151,17,25,144,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,3,51,0,0,34,101,0,2,38,99,0,13,86,99,155,221,182,19,
+189,219,17,19,208,219,17,133,0,219,161,187,0,219,170,161,0,219,170,166,0,13,170,170,0,13,186,170,0,0,219,186,144,0,13,219,106,160,0,13,107,186,170,170,105,11,187,187,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,34,32,0,3,36,67,51,51,68,68,67,68,68,68,68,52,68,68,68,68,68,68,85,68,68,69,85,68,68,68,68,68,67,51,51,51,53,85,51,17,22,102,83,17,102,102,83,22,102,102,83,102,102,101,51,166,107,51,50,170,171,34,34,
+187,178,34,17,221,170,171,210,170,187,189,34,187,0,18,34,0,0,1,34,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,51,0,0,68,51,51,0,68,68,67,51,85,68,68,67,84,68,51,51,68,187,178,34,
+74,170,187,178,52,170,171,51,51,186,49,17,51,51,18,34,51,51,51,48,51,34,34,35,34,34,34,34,34,34,34,33,34,34,33,17,34,34,17,0,34,34,34,33,34,34,34,33,34,17,17,17,17,0,0,0,0,0,0,0,0,0,0,0,
+51,51,0,0,17,17,0,0,34,33,17,17,33,238,238,238,30,238,238,238,29,238,238,238,33,221,221,221,16,17,17,17,0,0,0,0,1,17,17,16,29,238,238,225,205,221,221,222,205,221,221,221,28,205,221,221,1,28,204,204,0,1,17,17,
+0,0,0,0,0,0,0,0,17,16,0,0,238,225,17,0,238,238,237,16,237,221,209,0,209,17,16,0,16,0,0,0,0,0,0,0,0,0,0,0,17,16,0,0,238,225,16,0,221,221,225,0,221,221,221,16,204,193,17,0,17,16,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,51,0,0,0,34,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,2,32,0,
+0,0,0,0,0,0,0,51,0,0,51,52,0,3,34,35,0,34,34,34,0,0,2,34,0,0,0,34,0,0,0,51,0,0,51,35,0,51,34,35,3,34,34,35,34,34,34,34,34,34,34,34,0,0,34,34,0,0,2,34,0,0,34,34,
+0,2,34,34,0,2,34,34,0,34,34,34,0,34,34,34,0,32,0,34,0,0,0,42,0,0,10,171,0,7,171,178,0,0,0,0,51,51,48,0,68,68,67,51,187,68,68,68,170,180,69,68,170,171,68,85,170,164,69,85,180,68,68,68,
+51,68,102,101,51,54,102,102,51,86,102,97,51,86,102,97,51,86,102,97,35,85,102,97,34,53,86,102,34,186,170,170,34,170,190,235,34,186,174,204,18,43,170,238,33,18,187,187,34,34,221,221,170,35,187,187,187,59,186,170,35,59,170,170,
+0,0,0,0,0,0,0,0,0,0,0,0,51,0,34,0,68,66,34,0,68,68,50,0,84,68,66,0,84,68,67,0,69,69,83,0,84,86,101,48,19,81,22,48,21,97,22,57,22,97,22,41,22,97,21,40,171,129,139,38,170,17,27,102,
+170,170,171,152,238,170,176,152,170,171,208,9,187,221,0,152,221,0,0,155,221,176,11,189,189,219,187,208,171,13,51,0,0,0,0,0,0,0,0,0,0,0,0,0,153,0,0,0,102,144,0,0,102,105,0,0,134,102,144,0,134,102,144,0,
+121,150,144,0,121,135,144,0,136,121,0,0,152,144,0,0,137,0,0,0,144,0,0,0,0,0,0,0,0,0,0,0,119,134,178,34,102,120,2,32,102,144,2,0,102,128,0,0,104,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,17,0,0,1,221,0,0,1,220,0,0,1,220,0,0,1,221,0,0,0,29,0,0,0,24,0,0,0,1,35,59,170,170,35,51,186,170,2,51,59,187,0,35,51,50,34,2,48,1,0,2,48,30,0,2,48,30,8,98,48,1,
+134,35,48,1,134,51,96,0,136,102,96,0,136,118,112,0,204,119,192,0,204,204,96,0,134,102,96,0,136,108,205,0,171,51,51,0,177,34,50,0,49,19,32,0,25,50,128,0,233,135,112,0,233,136,0,0,237,221,144,0,238,216,136,0,
+153,152,221,0,25,237,221,208,1,238,221,208,0,17,237,221,0,0,17,221,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+221,204,204,0,29,204,204,0,1,220,204,0,0,29,204,0,0,1,220,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,119,0,0,134,102,0,0,102,102,0,0,134,119,0,0,134,105,0,0,7,151,0,0,0,0,
+0,0,0,0,0,0,0,51,0,0,51,52,0,3,34,35,0,34,34,34,0,0,2,34,0,0,0,34,0,0,0,51,0,0,51,35,0,51,34,35,3,34,34,35,34,34,34,34,34,34,34,34,0,0,34,34,0,0,2,34,0,0,34,34,
+0,2,34,34,0,2,34,34,0,34,34,34,0,34,34,34,0,32,0,34,0,0,0,42,0,0,10,171,0,7,171,178,0,0,0,0,51,51,48,0,68,68,67,51,187,68,68,68,170,180,69,68,170,171,68,85,170,164,69,85,180,68,68,68,
+51,68,102,101,51,54,102,97,51,86,102,97,51,86,102,97,51,86,102,97,35,85,102,102,34,53,86,102,34,186,170,170,34,170,190,235,34,186,174,204,18,43,170,238,33,18,187,187,34,34,221,221,170,35,187,187,187,59,186,170,35,59,170,170,
+0,0,0,0,0,0,0,0,0,0,0,0,51,0,34,9,68,66,34,9,68,68,50,0,84,68,66,0,84,68,67,0,69,69,83,0,20,81,21,48,19,81,22,48,21,97,22,59,22,97,22,45,102,102,101,32,171,129,139,32,170,17,27,0,
+170,170,171,0,238,170,176,0,170,171,208,0,187,221,0,0,221,0,0,0,208,0,0,0,189,0,0,0,171,0,51,0,9,153,0,0,9,102,144,0,152,102,105,0,102,134,102,144,102,134,102,144,152,121,150,144,152,121,135,144,9,136,121,0,
+152,152,144,0,155,137,0,0,189,144,0,0,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,34,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,51,0,0,51,34,0,3,34,34,0,2,34,34,0,0,2,34,0,0,0,34,0,0,0,34,0,0,2,34,0,0,34,34,0,2,34,34,0,2,34,34,0,34,34,34,0,32,0,2,0,0,0,34,0,0,2,34,
+0,0,0,0,0,0,0,0,0,0,0,0,3,51,51,0,50,52,68,51,34,34,180,68,2,42,164,68,2,42,171,68,35,58,170,180,51,59,186,164,35,51,68,68,35,51,51,51,34,51,53,101,34,51,86,102,34,53,102,102,34,53,102,104,
+34,35,102,105,34,34,102,97,34,186,102,97,34,186,166,102,18,42,170,170,33,43,170,238,43,173,187,170,45,186,173,187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,67,48,0,0,68,67,0,0,84,68,48,2,
+68,68,67,34,85,68,68,50,69,84,68,50,85,68,68,66,69,68,68,67,52,84,68,68,83,68,67,84,19,68,54,83,21,52,49,82,150,83,145,82,134,102,25,82,107,129,133,32,170,17,27,40,170,170,171,217,170,170,189,135,187,189,216,150,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,192,0,1,204,214,0,1,204,118,0,1,204,120,0,1,204,151,0,1,204,217,0,1,134,104,0,1,108,204,0,1,220,204,0,0,17,17,0,0,0,0,
+0,0,34,35,0,2,34,35,0,2,0,36,0,0,0,4,0,0,34,67,0,0,0,67,102,0,84,48,104,85,51,0,136,34,0,0,120,128,0,0,128,0,0,0,204,192,0,0,204,204,192,0,204,204,204,0,17,17,17,0,0,0,0,0,
+43,219,186,173,59,173,219,186,59,170,173,11,51,187,178,51,50,34,34,34,17,17,17,17,0,29,216,18,0,29,216,136,0,29,221,152,0,1,221,217,0,1,221,136,0,0,24,136,0,0,25,221,0,0,1,221,0,0,1,17,0,0,0,0,
+221,217,137,103,170,150,150,104,187,135,134,105,9,121,102,121,51,144,152,136,34,144,9,152,32,0,0,9,128,0,0,0,137,0,0,0,144,0,0,0,0,0,0,0,0,0,0,0,221,0,0,0,221,221,208,0,17,17,16,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,51,34,0,3,34,34,0,2,34,34,0,0,2,34,0,0,0,34,0,0,0,34,
+0,0,2,34,0,0,34,34,0,2,34,34,0,2,34,34,0,34,34,34,0,32,0,2,0,0,0,34,0,0,2,34,0,0,0,0,0,0,0,0,0,0,0,0,3,51,51,0,50,52,68,51,34,34,180,68,2,42,164,68,2,42,171,68,
+35,58,170,180,51,59,186,164,35,51,68,68,35,51,51,51,34,51,53,101,34,51,86,102,34,53,102,102,34,53,102,104,34,35,102,105,34,34,102,97,34,186,102,97,34,186,166,102,18,42,170,170,33,43,170,238,43,173,187,170,45,186,173,187,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,67,48,0,0,68,67,0,0,84,68,48,2,68,68,67,34,85,68,68,50,69,84,68,50,85,68,68,66,69,68,68,67,52,84,68,68,83,68,67,84,19,68,54,83,
+21,52,49,82,150,83,145,82,134,102,25,82,107,129,133,32,170,17,27,32,170,170,171,216,170,170,189,9,187,189,208,135,0,0,2,34,0,0,34,34,0,0,32,2,0,0,0,33,0,0,34,2,0,0,8,1,0,29,102,99,1,220,102,134,
+34,219,186,221,50,189,219,170,52,186,173,187,34,68,176,0,17,34,68,0,52,67,48,0,51,0,0,0,128,0,0,0,221,216,8,150,187,137,137,104,170,150,150,104,187,135,134,105,9,121,102,121,0,144,152,136,0,0,9,152,0,0,0,9,
+1,204,198,136,29,204,204,204,1,28,204,198,1,17,28,136,29,209,17,24,17,221,221,209,0,17,221,221,0,0,17,17,0,0,0,0,96,0,0,0,102,0,0,0,108,204,0,0,204,204,192,0,17,28,204,192,221,209,17,16,17,17,17,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,51,34,0,3,34,34,0,2,34,34,0,0,2,34,0,0,0,34,0,0,0,34,
+0,0,2,34,0,0,34,34,0,2,34,34,0,2,34,34,0,34,34,34,0,32,0,2,0,0,0,34,0,0,2,34,0,0,0,0,0,0,0,0,0,0,0,0,3,51,51,0,50,52,68,51,34,34,180,68,2,42,164,68,2,42,171,68,
+35,58,170,180,51,59,186,164,35,51,68,68,35,51,51,51,34,51,53,101,34,51,86,102,34,53,102,102,34,53,102,104,34,35,102,105,34,34,102,97,34,186,102,97,34,186,166,102,18,42,170,170,33,43,170,238,43,173,187,170,34,186,173,187,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,67,48,0,0,68,67,0,0,84,68,48,2,68,68,67,34,85,68,68,50,69,84,68,50,85,68,68,66,69,68,68,67,52,84,68,68,83,68,67,84,19,68,54,83,
+21,52,49,82,150,83,145,82,134,102,25,82,107,129,133,32,170,17,27,40,170,170,171,217,170,170,189,135,187,189,216,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,221,0,0,1,221,
+0,0,1,221,0,0,1,221,0,0,29,221,0,0,29,216,0,0,24,141,0,0,29,221,0,0,1,17,0,0,0,0,0,0,2,34,0,0,2,34,0,0,2,1,0,0,0,34,0,0,34,17,0,0,1,34,0,136,50,16,136,131,33,1,
+136,130,16,28,136,136,0,28,216,128,0,1,140,192,0,0,205,220,192,0,221,221,220,0,17,17,17,0,0,0,0,0,34,43,186,173,35,45,219,186,35,59,189,11,34,51,64,0,34,34,51,64,0,0,34,52,0,6,131,48,28,102,102,0,
+204,200,104,128,204,204,136,0,204,204,192,0,28,200,102,0,1,102,108,204,0,28,204,204,0,1,17,17,0,0,0,0,221,217,137,103,170,150,150,104,187,135,134,105,9,121,102,121,0,144,152,136,0,0,9,152,0,0,0,9,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,204,0,0,0,204,204,0,0,17,17,0,0,0,0,0,0,0,0,34,34,0,0,34,34,0,0,32,2,0,0,0,33,0,0,34,0,0,0,0,0,0,0,214,130,1,204,102,100,
+34,219,186,221,50,189,219,170,51,186,173,187,36,43,176,0,19,66,0,0,33,51,0,0,68,32,0,0,34,0,0,0,221,216,8,150,187,137,137,104,170,150,150,104,187,135,134,105,9,121,102,121,0,144,152,136,0,0,9,152,0,0,0,9,
+28,204,102,98,28,205,134,136,28,204,216,129,1,204,205,193,0,28,200,102,0,1,102,108,0,0,28,204,0,0,1,17,208,0,0,0,221,0,0,0,221,208,0,0,17,221,208,0,96,17,17,0,204,204,0,0,204,204,204,0,17,17,17,0,
+0,0,0,0,0,0,0,0,0,0,51,51,0,34,34,51,0,0,34,34,0,0,0,2,0,0,0,0,0,0,0,3,0,0,3,51,0,3,51,50,0,51,51,50,3,50,34,50,34,34,34,34,0,0,2,34,0,0,0,3,0,0,3,51,
+0,0,0,0,51,51,48,0,51,52,67,51,51,50,36,68,35,50,162,68,34,43,170,36,35,43,170,163,51,43,180,69,35,51,68,84,35,52,68,68,35,52,68,69,35,51,68,69,34,51,68,69,34,51,51,68,34,35,51,51,34,34,59,102,
+0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,32,68,51,2,32,84,68,50,32,85,84,67,32,85,85,68,48,68,69,68,48,102,84,84,67,102,101,68,69,102,97,52,65,102,97,19,65,102,97,21,17,70,97,22,24,53,102,104,24,
+0,3,51,50,0,51,50,34,0,50,34,34,3,34,34,34,2,0,0,0,0,0,0,10,0,0,0,189,0,0,11,102,0,0,151,102,0,9,120,118,0,9,120,120,0,0,152,121,0,0,9,114,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,13,221,0,13,221,221,0,1,17,17,0,0,0,0,34,34,186,170,34,34,186,170,34,34,43,170,34,34,34,187,42,170,178,221,171,187,43,187,178,51,187,170,121,51,186,170,
+102,103,59,170,105,146,51,187,105,2,67,34,98,68,34,0,144,66,0,0,0,66,0,0,0,34,32,0,0,0,34,96,0,8,118,102,0,8,136,118,13,221,135,108,221,221,221,220,221,221,221,204,17,17,17,17,0,0,0,0,0,0,0,0,
+102,102,161,17,170,170,170,0,170,171,189,11,187,189,219,189,221,219,221,208,178,221,0,0,171,32,0,0,171,32,0,0,171,32,0,0,178,52,64,0,34,34,36,0,0,0,2,48,0,0,0,35,0,0,7,118,0,0,8,135,0,0,9,141,
+0,0,1,215,192,0,29,120,192,0,24,141,204,0,24,221,17,0,1,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,152,119,112,183,135,119,119,221,121,120,153,152,152,135,121,9,9,153,144,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,0,0,103,0,0,0,118,192,0,0,214,102,192,0,120,204,102,0,221,204,204,128,221,221,220,204,17,17,17,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,3,0,0,10,170,0,0,11,170,0,0,51,186,0,0,50,43,0,3,34,34,0,3,34,34,0,51,34,34,0,50,34,34,0,50,34,50,0,34,0,50,0,32,3,34,0,0,3,34,0,0,3,34,0,0,50,34,
+0,0,50,34,0,0,50,0,0,0,32,0,0,0,0,2,0,0,0,34,0,0,0,34,0,0,0,34,0,0,0,32,3,52,86,149,51,69,102,145,163,51,54,97,162,51,170,170,34,59,170,173,34,186,170,222,34,186,170,209,34,186,170,222,
+34,186,170,189,34,186,170,171,34,187,170,170,34,43,170,170,34,34,186,170,34,34,43,187,34,33,34,34,34,34,17,34,34,42,170,163,42,171,187,59,171,178,34,59,171,34,34,59,182,104,104,51,214,134,102,35,40,152,136,35,0,136,136,67,
+51,56,16,0,19,145,16,0,170,17,189,0,171,187,187,208,225,30,219,208,17,17,237,189,17,17,29,189,204,17,237,189,204,193,235,189,189,221,219,189,170,170,170,208,170,170,171,208,170,170,189,0,171,187,208,0,187,189,0,0,34,221,0,0,
+186,171,208,0,170,170,176,0,170,170,176,0,186,171,208,0,187,189,25,0,51,50,152,128,33,33,152,128,2,33,25,0,0,24,130,64,0,0,2,64,0,0,36,0,0,0,36,0,0,135,102,96,0,136,135,112,1,216,141,17,1,221,220,193,
+29,221,135,97,29,216,135,97,29,136,204,205,1,156,204,204,1,157,204,204,0,29,220,204,0,1,221,220,0,0,17,17,2,32,0,0,2,32,0,0,2,32,0,0,2,32,0,0,152,136,0,0,153,152,128,0,233,152,0,0,238,238,0,0,
+238,152,128,0,25,153,128,0,25,238,208,0,17,237,208,0,225,237,208,0,193,30,221,0,204,193,30,221,17,17,17,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,51,51,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,151,0,0,0,113,0,0,0,23,0,0,0,121,0,0,0,23,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,153,0,0,9,17,0,0,17,17,0,0,0,17,113,1,144,1,23,17,112,1,121,121,112,153,153,151,121,17,119,151,113,17,119,121,113,17,23,113,145,17,1,153,17,17,0,144,24,1,0,0,9,129,0,0,1,152,
+153,153,153,0,17,153,153,153,153,25,153,153,136,145,25,137,136,137,153,152,136,150,102,137,153,102,102,104,25,102,102,104,24,102,102,102,24,102,102,102,24,102,97,134,24,102,97,134,24,102,102,102,25,134,102,102,25,152,102,137,25,136,136,136,
+0,0,0,0,144,0,0,16,153,144,1,16,153,153,17,16,137,153,153,16,137,134,104,16,152,102,102,144,152,102,102,144,134,102,102,137,102,102,102,137,102,129,102,137,102,129,102,129,102,102,102,129,102,102,104,145,129,134,137,145,17,24,136,145,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,16,23,144,7,17,113,121,7,151,151,23,7,121,153,113,7,121,119,151,7,151,119,113,9,23,113,16,1,153,16,0,145,9,0,0,16,0,0,0,0,0,0,0,
+0,0,1,25,0,0,17,17,0,0,17,17,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,25,
+0,0,0,25,0,0,1,153,0,0,1,152,0,0,17,153,0,0,17,153,0,0,17,153,0,0,17,153,0,0,17,25,0,0,17,17,0,0,17,17,0,0,1,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+137,152,136,136,152,25,152,136,25,129,25,136,1,152,17,25,0,25,153,17,1,17,153,153,17,17,17,152,17,17,25,136,16,1,25,152,0,1,17,153,1,16,1,145,0,0,9,17,1,119,145,0,151,105,17,0,151,105,22,0,151,102,97,1,
+145,113,17,1,129,17,17,1,136,153,16,1,136,153,16,0,153,145,0,0,153,17,0,0,145,16,0,0,17,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+136,136,137,16,24,136,145,0,24,145,16,0,129,16,0,0,17,16,0,0,153,145,0,0,136,137,0,0,136,137,0,0,136,145,0,0,153,144,0,0,25,16,0,0,17,144,0,0,1,144,0,0,1,144,0,0,145,144,0,0,113,150,0,0,
+118,103,0,0,23,118,144,0,17,17,153,0,17,152,137,0,17,153,153,144,1,25,153,144,1,25,153,145,0,17,153,153,0,1,17,153,0,0,1,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,105,0,0,0,150,0,0,0,104,0,0,0,150,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,9,112,0,150,153,96,2,104,104,96,2,135,118,96,35,102,118,96,34,102,103,96,34,150,105,128,34,9,135,178,34,0,112,218,34,0,0,11,162,0,0,2,186,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,51,0,51,51,51,35,54,102,170,51,102,170,170,53,170,170,173,58,170,170,209,58,170,173,17,186,170,173,28,186,170,173,28,186,170,173,28,186,170,170,221,43,170,170,170,43,170,170,170,
+0,0,0,0,0,0,0,0,0,0,0,0,56,16,0,0,129,19,48,0,17,170,51,0,170,170,163,48,221,218,170,48,17,29,170,179,17,17,218,171,17,17,218,171,204,17,218,171,204,17,218,171,221,221,170,171,170,170,170,189,170,170,170,189,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,144,150,0,6,153,105,96,6,134,134,150,6,103,120,105,6,103,102,134,6,118,102,105,8,150,105,144,11,120,144,0,189,7,0,0,208,0,0,0,0,0,0,0,
+0,0,2,43,0,0,2,2,0,0,0,2,0,0,0,34,0,0,0,34,0,0,0,32,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,220,0,0,14,204,
+171,186,170,170,186,219,186,170,43,161,219,187,34,186,45,221,0,43,179,187,2,34,59,187,34,34,59,186,34,34,59,170,32,1,59,186,0,2,19,187,2,32,3,50,0,0,50,17,215,115,33,0,118,50,16,0,118,38,0,0,118,102,16,0,
+170,170,171,208,170,171,189,0,187,189,208,0,221,208,0,0,187,32,0,0,187,178,0,0,170,163,0,0,170,163,0,0,170,178,0,0,187,48,0,0,35,32,0,0,17,35,0,0,0,3,0,0,0,2,55,0,1,215,35,96,29,215,102,112,
+0,0,14,204,0,0,24,118,0,0,24,102,0,1,220,204,0,1,220,204,0,1,220,204,0,1,220,204,0,1,221,205,215,125,16,0,205,221,16,0,104,193,0,0,103,145,0,0,199,16,0,0,205,16,0,0,209,0,0,0,16,0,0,0,
+29,221,119,108,29,220,221,220,1,221,204,102,0,29,215,204,0,1,23,220,0,0,1,29,0,0,0,1,0,0,0,0,0,0,0,0,112,0,0,0,204,0,0,0,204,192,0,0,204,205,0,0,220,204,0,0,29,221,192,0,1,17,16,0,
+0,1,221,209,0,1,221,16,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,105,
+0,0,0,150,0,0,0,104,0,0,0,150,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,3,34,0,0,34,34,0,0,0,34,105,9,112,2,150,153,96,2,104,104,96,51,
+135,118,99,34,102,118,98,34,102,103,98,34,150,105,130,34,9,135,178,34,0,112,218,2,0,0,11,162,0,0,2,186,51,51,51,0,187,68,68,51,170,180,68,68,170,171,68,84,170,68,68,69,180,70,102,84,51,102,102,100,53,102,102,101,
+53,102,102,102,53,102,102,102,37,102,97,134,37,102,97,134,37,102,102,102,35,86,102,102,43,186,102,171,43,170,170,170,0,0,0,0,48,0,0,32,67,48,2,32,68,68,34,32,84,68,67,32,84,86,101,32,69,102,102,48,53,102,102,48,
+86,102,102,83,102,102,102,83,102,129,102,83,102,129,102,82,102,102,102,82,102,102,101,50,129,134,171,189,17,26,170,189,0,0,2,43,0,0,34,34,0,0,34,34,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,220,0,0,14,204,171,186,170,170,186,219,186,170,43,161,219,170,2,186,45,219,0,43,179,221,2,34,59,187,34,34,59,186,34,34,59,170,
+32,1,59,186,0,2,19,187,2,32,3,50,0,0,50,17,215,115,33,0,118,50,16,0,118,38,0,0,118,102,16,0,170,170,171,208,26,170,189,0,26,189,208,0,173,208,0,0,221,32,0,0,187,178,0,0,170,163,0,0,170,163,0,0,
+170,178,0,0,187,48,0,0,35,32,0,0,17,35,0,0,0,3,0,0,0,2,55,0,1,215,35,96,29,215,102,112,0,0,0,0,0,0,0,51,0,0,3,34,0,0,34,34,0,0,0,34,0,0,0,2,0,0,0,2,0,0,0,51,
+51,51,51,0,187,68,68,51,170,180,68,68,170,171,68,84,170,68,68,69,180,70,102,84,51,102,102,100,53,102,102,101,0,0,0,0,48,0,0,32,67,48,2,32,68,68,34,32,84,68,67,32,84,86,101,32,69,102,102,48,53,102,102,48,
+0,0,3,34,0,0,50,34,0,0,50,34,0,3,34,34,0,2,34,34,0,96,0,2,6,118,0,34,6,103,150,98,102,118,135,114,103,105,137,146,102,152,154,162,7,136,155,186,0,153,0,11,0,0,0,0,0,0,0,0,0,0,0,2,
+0,0,0,0,0,0,0,0,0,0,1,221,0,0,1,238,0,0,1,238,0,0,1,238,0,0,0,30,0,0,0,30,0,0,0,30,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+53,102,102,102,53,102,102,102,37,102,97,134,37,102,97,134,37,102,102,102,35,86,102,102,43,186,102,171,43,170,170,170,43,186,170,170,34,187,170,170,34,34,187,170,170,162,45,219,187,187,35,221,2,34,59,187,34,34,59,186,34,34,59,170,
+0,1,59,186,0,34,19,187,0,0,3,50,221,0,50,17,238,208,33,0,238,237,32,0,238,237,208,0,238,238,208,0,238,238,237,0,238,238,237,16,238,238,237,16,30,238,237,16,30,238,237,16,1,30,209,0,0,1,16,0,0,0,0,0,
+86,102,102,83,102,102,102,83,102,129,102,83,102,129,102,82,102,102,102,82,102,102,101,50,129,134,171,189,17,26,170,176,170,170,171,208,26,170,189,0,26,189,208,11,173,221,187,189,221,45,221,208,187,178,0,0,170,163,0,0,170,163,0,0,
+170,178,0,0,187,48,0,0,35,32,0,0,17,35,0,0,0,2,48,0,0,0,38,96,0,0,118,204,0,0,124,193,0,1,220,30,0,1,204,30,0,1,193,238,0,1,193,238,0,0,17,221,0,0,1,17,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,102,0,0,150,118,96,6,105,103,102,7,120,150,103,9,137,137,121,189,152,136,144,221,9,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,13,209,16,0,12,30,209,12,193,237,16,193,30,237,16,30,238,209,0,238,237,16,0,238,237,16,0,238,209,0,0,237,16,0,0,209,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,2,34,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,68,68,51,42,180,68,68,42,171,68,84,42,164,68,69,43,69,102,84,35,86,102,100,
+0,0,0,0,0,0,0,0,48,0,2,0,67,48,34,0,68,68,34,0,84,68,50,0,84,86,82,0,69,102,99,0,0,0,0,3,0,0,0,50,0,0,3,34,0,0,50,34,0,0,34,34,0,6,0,0,0,103,96,2,0,102,121,102,
+0,103,104,119,0,118,152,153,0,105,137,170,0,120,137,187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,30,0,0,0,30,0,0,0,30,0,0,0,1,0,0,0,1,0,0,0,0,
+51,102,102,101,35,102,102,102,35,102,102,102,35,102,97,134,35,102,102,102,35,86,102,102,35,186,102,171,34,186,170,170,34,186,170,170,34,43,170,170,34,34,187,186,170,162,45,219,0,34,59,187,2,34,59,186,34,34,59,170,0,1,59,186,
+0,2,19,187,208,0,3,50,237,208,50,17,238,224,33,0,238,237,32,0,238,238,208,0,238,238,237,0,30,238,237,16,53,102,101,48,86,102,102,48,102,102,102,48,102,129,102,32,102,102,102,32,102,102,101,32,129,134,187,208,17,26,171,0,
+170,170,189,0,26,170,208,0,26,189,0,187,173,221,187,221,187,178,0,0,170,163,0,0,170,163,0,0,170,178,0,0,187,48,0,0,35,32,0,0,17,35,0,0,0,2,0,0,0,0,102,12,0,0,204,30,0,1,193,238,0,1,193,238,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,96,0,9,103,96,0,102,150,118,0,119,137,103,0,152,152,153,0,217,136,128,0,208,153,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,221,16,0,0,193,225,0,204,30,209,0,17,238,16,0,238,237,16,0,238,209,0,0,237,16,0,0,30,238,237,16,1,238,237,16,1,238,237,16,0,30,209,0,0,1,16,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,30,238,0,1,30,237,0,0,29,209,0,0,17,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,209,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,3,171,0,2,34,170,0,0,2,170,0,0,2,180,0,0,3,53,0,0,50,54,0,3,34,54,0,50,34,38,6,0,3,37,7,96,50,43,6,121,98,43,7,104,114,43,9,137,162,34,8,137,186,170,
+0,0,0,2,0,0,0,34,0,0,0,0,0,0,0,0,0,0,29,0,0,0,30,221,0,0,30,238,0,0,14,238,0,0,14,238,0,0,1,238,0,0,0,30,0,0,0,30,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,68,67,50,0,180,84,68,66,68,69,84,67,102,84,85,101,102,101,54,102,102,102,86,102,102,102,102,102,97,134,104,22,102,102,102,101,166,171,136,107,170,170,17,170,170,170,170,171,187,170,27,208,45,219,173,219,
+43,187,187,32,43,186,170,48,27,186,171,32,35,187,179,0,3,50,34,0,2,17,18,48,208,0,0,6,224,0,0,12,237,0,0,28,237,16,0,28,237,16,0,17,237,16,0,1,225,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,32,0,0,0,32,0,0,0,32,0,0,0,48,0,0,0,80,0,0,0,80,0,0,0,80,0,0,0,48,0,102,0,176,9,102,0,176,102,151,96,208,119,134,112,11,217,136,0,189,208,153,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,13,238,16,108,30,237,0,206,238,221,0,30,238,16,0,30,237,0,0,237,16,0,0,209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,34,171,68,0,2,164,68,0,3,54,102,0,2,86,102,3,34,86,24,0,2,38,102,6,2,186,106,6,130,186,170,8,146,34,186,0,0,2,187,0,0,34,187,0,0,2,59,0,13,0,51,
+0,14,208,33,0,14,238,0,0,14,238,208,0,0,30,209,0,0,30,209,0,0,1,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,2,0,0,84,50,0,0,54,99,0,0,86,101,0,0,104,101,0,0,
+102,83,0,96,136,187,9,96,170,189,119,135,27,0,217,128,187,0,0,0,170,0,0,0,179,0,0,0,34,0,0,208,18,0,13,193,0,204,238,208,0,193,238,0,0,30,224,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,10,68,67,0,3,102,102,0,34,104,134,0,2,170,139,6,146,42,176,216,0,43,176,0,0,43,48,0,13,1,32,12,14,224,12,237,1,225,1,16,0,16,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,0,6,150,144,151,105,105,105,150,150,150,134,134,105,104,119,102,150,134,103,102,9,102,102,118,0,153,102,152,0,34,153,134,
+0,32,0,152,0,0,0,9,0,0,0,3,0,0,0,50,0,0,0,50,0,0,0,34,0,0,0,34,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,51,51,51,52,68,68,
+51,68,69,85,187,187,68,86,186,170,180,102,43,170,164,102,34,187,68,102,34,51,68,102,130,51,51,102,104,35,51,86,154,34,51,70,43,163,34,53,34,186,162,43,34,43,186,43,34,34,43,171,34,34,34,186,32,34,34,43,0,34,34,34,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,34,32,52,68,50,32,85,85,68,50,85,85,84,67,102,85,85,102,102,101,85,102,102,102,68,102,102,145,52,25,102,129,148,145,102,97,22,129,102,97,26,177,
+102,106,171,187,186,170,190,238,170,170,236,206,170,170,236,206,170,170,238,234,187,170,170,173,162,187,189,219,186,45,219,187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,151,0,0,0,151,112,0,0,152,112,0,0,
+9,119,7,144,57,135,151,144,48,151,120,144,98,152,137,193,98,152,121,205,101,41,144,29,129,43,208,30,26,189,12,30,170,189,12,30,170,189,12,30,170,176,12,30,171,0,140,30,189,0,108,30,208,0,124,238,0,0,214,158,176,6,23,113,
+0,0,0,0,0,0,0,0,0,0,16,0,0,13,16,0,16,1,209,0,16,1,209,0,209,1,209,0,209,1,237,16,209,1,237,16,237,30,237,16,237,30,237,16,237,30,237,16,237,30,238,209,238,209,238,209,238,209,238,209,238,209,238,209,
+0,34,34,34,0,34,34,32,0,34,32,0,0,34,0,2,0,2,0,2,0,0,0,2,0,0,0,0,0,0,0,0,43,45,186,170,34,45,186,170,34,45,187,170,34,34,219,178,33,17,34,34,16,2,17,17,2,33,0,0,33,16,0,0,
+171,6,156,193,171,38,109,193,34,40,97,209,33,25,136,29,16,0,153,1,0,0,0,0,0,0,0,0,0,0,0,0,238,209,238,209,238,209,29,209,238,209,1,16,29,225,0,0,17,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,42,0,0,0,42,0,0,0,42,0,0,3,51,0,0,51,51,0,51,51,50,0,51,50,34,3,51,34,34,3,50,34,34,51,34,34,34,50,34,0,34,50,0,3,34,
+0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,2,163,0,0,2,170,51,51,51,51,51,86,102,51,51,102,97,51,51,102,102,51,51,86,102,51,51,53,102,51,51,51,53,51,51,102,102,35,54,170,170,34,186,170,170,34,186,170,170,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,51,48,0,0,98,98,8,16,17,97,145,16,17,22,17,0,97,22,22,32,102,106,170,32,106,170,170,171,170,173,221,187,170,177,17,219,170,209,17,219,170,220,193,219,
+0,0,0,0,0,0,0,0,0,0,150,112,0,0,150,96,0,0,8,102,0,102,103,102,0,137,134,118,0,102,102,102,0,0,102,120,0,6,136,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,13,0,0,0,13,0,0,0,13,0,0,0,222,0,0,0,222,0,0,0,209,0,0,0,17,0,0,0,0,32,0,3,34,0,0,51,50,0,3,51,34,0,3,50,34,0,51,34,34,6,98,32,170,102,106,170,187,134,107,187,50,
+152,128,3,34,0,0,3,34,0,222,50,34,13,225,62,136,13,225,238,232,222,225,222,24,222,29,221,153,222,29,209,145,238,29,209,16,225,152,16,0,225,137,16,0,29,209,0,0,29,16,0,0,209,0,0,0,16,0,0,0,0,0,0,0,
+34,186,170,170,34,43,170,170,34,43,170,170,34,34,187,170,170,34,34,187,187,59,187,189,51,187,170,171,51,186,170,170,51,186,170,170,51,52,187,171,3,51,68,68,1,51,51,51,2,17,0,0,34,16,0,0,33,0,0,0,16,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,170,220,205,176,170,189,219,176,170,170,171,0,170,171,189,0,187,189,208,0,221,217,0,0,217,152,136,0,216,136,144,0,
+0,152,136,0,0,0,0,0,0,0,0,0,68,0,0,0,51,64,96,6,0,51,102,134,0,6,102,204,0,135,103,204,0,8,124,204,0,1,204,204,0,1,204,204,0,0,28,193,0,0,1,16,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,96,0,151,105,96,0,150,121,99,9,105,104,104,9,118,135,118,34,150,102,118,2,152,102,103,0,41,150,105,0,2,41,152,0,0,2,41,
+0,0,0,34,0,0,0,2,0,0,3,50,0,3,50,34,0,34,34,34,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,51,51,51,52,68,68,118,180,85,85,102,171,68,86,107,170,180,102,107,170,164,102,98,187,68,102,136,51,68,102,102,131,51,102,137,163,51,86,
+146,186,51,70,34,43,162,53,34,34,186,43,34,34,43,171,34,34,34,186,34,34,34,43,0,34,34,43,2,34,34,34,34,34,34,34,34,34,32,0,0,0,0,2,0,0,2,34,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,2,34,0,52,68,50,32,85,85,68,50,85,85,84,67,102,85,85,102,102,101,85,102,102,102,68,102,102,137,52,152,102,113,148,145,102,97,22,137,102,105,154,177,
+102,106,171,187,186,170,238,238,170,174,204,206,170,174,204,206,186,171,238,235,171,170,170,173,162,187,189,219,186,45,219,187,43,45,186,170,34,45,187,170,34,34,219,178,34,34,34,34,17,17,34,17,34,34,17,0,17,17,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,121,112,0,0,151,151,0,0,152,120,112,0,9,119,119,48,9,140,23,48,0,156,209,98,0,145,209,98,0,209,237,101,32,193,237,129,32,193,237,26,189,193,238,
+186,189,193,238,234,185,193,238,234,182,193,238,187,215,206,238,189,13,105,238,208,1,119,30,0,105,204,30,176,102,220,30,162,102,29,30,34,134,129,209,33,152,137,17,16,9,144,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+121,0,0,0,144,0,0,0,144,0,0,0,0,0,0,0,16,1,0,0,16,209,0,0,16,29,16,0,209,29,16,0,209,29,16,0,209,238,209,0,209,238,209,0,237,30,209,0,237,30,209,0,237,30,209,0,237,30,237,16,237,30,237,16,
+237,30,237,16,222,30,237,16,17,238,237,16,144,30,221,16,0,1,17,0,0,0,0,0,0,0,0,0,0,0,0,0
@@ -0,0 +1,2 @@
+128,8,128,4,11,20,10,37,26,53,30,68,14,114,0,129,2,1,136,21,27,137,3,4,143,4,12,22,62,255,14,253,77,254,219,245,247,254,96,3,247,63,184,253,255,239,190,254,247,230,127,17,252,29,127,36,63,83,191,211,191,158,250,255,
+35,248,239,224,215,248,111,253,255,142,223,244,107,255,51,127,167,253,119,213,255,16,191,223,126,199,223,191,253,71,232,123,63,51,179,208,63,192,244,2,160,121,164,13,74,203,154,192,172,210,30,75,129,157,1,254,131,73,192,0
@@ -0,0 +1,5 @@
+0,16,128,6,58,19,1,38,44,69,17,88,251,101,20,115,0,129,118,45,134,5,10,21,23,37,19,135,4,4,22,54,37,26,54,56,136,4,6,21,25,37,18,137,5,16,22,59,38,48,140,5,14,22,60,38,49,53,11,141,5,21,21,15,
+38,61,55,124,72,250,142,38,55,54,57,255,43,83,139,214,95,138,139,214,95,138,139,214,95,138,139,215,253,103,126,217,202,92,215,55,41,115,92,220,165,205,115,114,191,217,87,85,127,94,85,223,49,250,242,174,249,143,215,149,119,204,127,186,
+234,238,95,201,247,114,254,79,187,151,242,125,220,191,144,0,2,146,140,187,254,197,176,109,191,109,108,27,83,183,87,214,120,253,199,246,109,227,61,219,195,97,111,250,33,47,228,128,0,24,71,0,101,102,98,223,105,68,179,48,59,52,97,183,
+236,33,98,43,166,251,82,81,2,89,35,179,70,29,39,236,33,98,93,168,192,10,126,228,118,193,168,202,254,184,29,126,228,96,26,137,127,227,128,0,31,114,140,144,32,65,113,116,26,190,179,198,64,0,106,63,232,132,191,146,0,0,97,28,
+34,0
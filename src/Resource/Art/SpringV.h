@@ -0,0 +1,4 @@
+128,14,128,2,0,20,8,37,25,55,125,69,26,86,60,101,27,115,2,129,3,3,131,5,28,134,4,9,135,6,58,21,24,136,6,61,22,59,137,5,23,23,124,140,4,10,143,5,22,255,73,37,218,91,179,187,187,190,88,226,209,98,195,26,
+203,203,31,219,37,97,141,35,242,42,44,91,77,15,45,59,187,187,165,241,36,146,243,253,181,254,25,220,239,242,196,146,77,18,73,39,231,10,40,252,225,69,20,148,81,69,21,20,81,74,36,146,73,162,73,37,36,78,231,114,49,142,63,195,
+12,99,30,222,223,14,28,57,28,56,112,226,255,242,247,173,117,230,45,247,16,226,122,89,103,229,179,101,15,86,194,95,89,210,75,199,227,190,113,221,227,244,254,159,49,171,239,171,107,29,253,107,95,166,134,163,242,41,71,196,179,143,111,158,
+142,189,58,246,47,24,236,249,136,236,252,118,156,91,88,239,55,123,152,105,37,231,197,227,215,234,52,0
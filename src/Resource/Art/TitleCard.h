@@ -0,0 +1,25 @@
+128,128,128,4,9,20,7,36,8,53,22,69,23,85,25,101,24,115,1,129,3,0,22,52,38,57,131,6,54,134,4,6,23,118,39,122,135,3,2,22,58,39,119,55,120,71,121,136,6,55,137,6,53,138,8,247,142,4,10,24,246,143,6,56,
+255,186,101,113,34,203,1,12,43,33,144,194,70,19,172,9,94,163,204,161,63,177,144,192,217,165,11,119,207,38,204,50,11,12,130,88,100,27,167,97,1,197,198,19,176,134,112,131,249,118,254,191,104,241,126,73,38,203,213,188,95,146,73,104,
+94,191,239,222,127,99,78,132,110,157,8,20,113,87,221,157,7,167,66,21,74,96,227,84,232,62,148,113,87,221,157,9,106,158,131,247,210,57,127,81,218,186,118,154,215,73,103,212,94,172,207,168,36,152,79,168,128,245,116,250,136,10,107,91,
+14,171,180,105,223,180,41,10,187,88,107,82,214,27,154,198,253,103,146,77,247,97,122,206,242,131,238,212,131,181,116,35,173,45,215,245,148,120,22,228,146,73,36,146,208,189,127,221,127,134,187,95,90,150,176,213,218,194,177,171,176,128,73,198,
+238,132,86,119,116,31,122,148,34,186,22,90,93,127,153,71,129,110,73,38,203,213,188,95,146,73,104,94,191,239,230,116,239,86,231,92,2,172,194,116,118,39,11,1,99,73,96,111,189,189,85,188,199,245,251,40,240,45,201,36,217,122,183,139,
+242,73,45,8,63,152,243,29,234,220,235,128,85,152,78,143,190,43,21,141,112,22,52,36,146,254,163,181,116,237,53,174,146,207,168,189,89,159,80,73,48,159,81,1,234,233,245,16,20,214,182,29,87,104,211,191,104,82,21,118,176,214,165,172,
+53,172,141,207,89,228,153,255,48,239,11,246,56,223,59,213,218,149,250,29,223,166,234,68,168,80,44,9,39,43,213,188,95,146,73,104,65,252,192,242,29,161,16,73,51,219,61,103,66,73,195,66,15,230,60,195,66,32,146,73,36,146,237,8,
+63,151,111,18,37,161,16,76,239,157,234,251,213,245,172,210,202,11,1,28,2,208,131,249,129,228,58,169,234,53,165,204,239,72,90,144,186,25,24,98,176,11,92,58,179,56,176,78,214,81,216,79,245,229,188,78,138,20,11,2,73,36,146,75,
+180,47,95,247,255,137,36,146,73,55,96,110,209,251,107,127,93,252,107,164,180,81,186,125,241,87,24,103,223,21,112,251,192,103,163,113,144,211,88,213,165,11,119,112,167,77,87,101,21,8,137,67,33,141,208,200,96,110,48,192,156,131,45,8,
+63,153,237,215,236,90,22,5,211,181,195,181,154,20,4,226,193,17,144,216,11,0,150,148,45,222,252,174,194,205,40,130,73,150,44,86,5,211,181,198,67,96,44,14,179,162,237,29,171,167,105,173,116,150,125,69,234,204,250,130,73,132,250,136,
+15,87,79,168,128,166,181,176,234,187,70,157,251,71,42,187,88,107,82,214,27,187,94,177,187,176,36,152,221,208,138,206,238,131,239,82,131,181,116,35,173,45,215,245,148,120,22,228,146,108,189,91,197,249,36,150,132,31,204,116,220,186,160,202,
+6,181,33,7,27,184,54,221,196,111,82,24,75,80,76,31,166,210,57,36,146,111,255,101,30,5,185,36,155,47,86,241,126,73,37,161,7,243,9,191,98,244,25,91,90,144,131,141,220,27,110,226,55,169,12,30,130,97,96,133,147,161,1,193,
+189,99,87,109,217,194,210,148,6,232,89,186,237,41,132,247,144,235,146,100,58,179,7,100,225,144,144,207,163,119,150,127,216,151,88,13,148,25,93,144,237,43,158,253,161,72,82,202,193,148,181,180,97,144,216,5,63,100,250,72,144,202,25,56,
+66,116,78,44,14,25,195,246,144,152,79,118,209,252,126,218,71,123,55,38,16,200,36,146,73,48,216,241,251,101,58,119,23,209,176,10,198,132,146,73,46,134,86,58,244,29,66,129,96,73,36,156,161,11,2,21,148,118,113,214,116,239,29,148,
+136,82,174,28,18,73,38,204,80,179,95,180,161,110,133,150,151,95,198,18,214,80,208,214,14,44,161,8,104,107,7,22,69,137,36,225,177,222,59,41,16,165,93,9,23,97,102,22,12,24,93,133,144,195,2,73,57,66,253,100,117,252,104,242,
+235,248,38,80,200,187,101,178,176,50,206,33,161,157,66,14,29,7,103,16,208,23,111,251,255,94,71,80,28,40,97,42,16,112,232,92,97,133,208,186,7,32,217,129,187,71,237,173,253,119,255,9,36,191,96,111,214,121,143,124,251,231,223,62,
+243,248,187,123,207,226,237,238,255,155,127,119,253,92,143,213,243,248,185,209,191,116,235,241,191,130,252,95,224,131,254,54,117,26,254,47,58,23,252,108,235,59,251,187,126,55,240,94,255,130,14,27,245,126,227,243,95,187,145,249,167,252,222,57,
+56,7,1,255,55,158,73,36,147,127,215,136,227,60,103,130,113,237,157,9,36,146,73,36,146,127,125,110,125,184,143,207,223,131,158,45,237,122,208,153,253,245,191,130,73,158,51,198,120,207,25,227,60,90,140,241,122,36,207,251,184,175,232,191,
+231,207,4,61,90,132,142,9,56,224,197,9,224,197,11,208,189,11,208,189,12,131,143,239,130,76,255,121,255,131,237,196,126,126,252,28,241,111,107,214,132,207,239,173,252,31,207,146,115,237,157,39,247,224,156,80,122,181,112,100,86,7,182,116,
+253,119,231,227,151,252,249,224,135,171,80,145,193,56,226,40,79,6,40,28,208,122,192,168,160,224,156,113,158,45,64,222,133,189,132,123,105,109,51,252,241,138,17,237,129,154,226,104,24,246,154,22,25,174,12,211,255,58,68,255,68,146,99,247,
+225,248,181,8,246,192,36,156,215,22,226,212,31,247,194,63,98,73,49,249,240,255,159,15,68,241,154,51,198,104,224,81,143,103,30,211,203,242,73,51,249,241,63,159,4,146,73,138,226,220,90,131,254,248,71,236,73,36,233,113,190,214,27,123,
+136,27,11,13,133,134,227,63,139,184,157,191,37,250,61,246,252,150,218,79,184,113,248,35,176,200,56,24,252,92,255,79,80,73,192,190,155,70,155,126,21,56,219,240,168,64,252,23,225,63,75,157,35,157,191,11,58,109,248,95,194,45,54,252,
+42,17,248,84,46,14,63,43,253,77,54,252,23,225,127,136,152,18,73,143,218,126,215,240,159,133,252,22,223,177,144,203,240,159,133,252,22,215,12,137,39,254,167,76,254,23,97,112,219,11,134,216,92,54,194,225,176,54,25,24,88,7,97,145,
+133,128,73,192,194,192,198,192,255,84,17,145,181,198,205,97,179,8,27,48,129,179,8,27,48,48,54,97,111,194,176,190,132,147,159,250,156,12,141,176,215,27,12,181,198,195,45,113,176,203,92,108,50,216,23,27,97,141,198,194,251,54,88,100,
+18,73,36,146,73,36,146,73,36,146,73,36,146,112
@@ -0,0 +1,65 @@
+128,254,128,4,2,21,10,37,14,53,22,69,20,86,42,102,47,115,0,129,4,3,22,48,40,237,120,236,130,6,43,24,226,131,5,11,23,108,132,5,16,24,234,133,7,102,24,229,134,5,12,24,227,135,5,17,23,106,40,230,136,5,18,23,
+109,137,5,13,22,50,39,110,56,232,72,233,138,6,38,23,111,40,235,139,6,39,24,228,140,6,49,23,107,141,5,15,23,103,39,112,142,6,46,143,4,4,22,52,40,231,120,238,255,0,0,0,2,184,86,118,95,28,211,194,179,162,54,99,
+91,16,184,81,225,199,92,57,56,192,16,172,232,141,154,21,154,184,35,102,133,110,224,141,254,183,32,0,3,190,104,86,118,158,21,152,0,0,85,193,142,175,170,188,206,174,28,107,2,250,221,92,56,225,92,25,10,255,75,10,255,75,205,203,
+205,219,179,244,159,165,22,174,28,112,253,52,43,229,175,248,186,179,126,221,152,51,246,44,212,207,227,239,95,236,161,180,127,219,254,191,247,236,255,191,254,182,182,108,118,92,20,107,98,19,195,141,108,74,26,216,130,134,191,243,70,0,7,128,
+250,144,159,74,212,250,225,22,23,4,108,208,183,4,189,224,1,255,106,206,166,205,10,205,217,209,179,66,179,87,4,108,212,224,7,253,128,0,95,93,85,178,170,225,125,116,175,169,213,245,38,101,86,196,205,40,215,6,215,45,68,196,150,104,
+168,210,90,139,8,206,101,197,250,110,170,249,117,21,124,186,139,12,218,139,6,106,44,25,170,108,25,170,108,73,154,166,197,209,155,23,104,88,240,159,151,6,115,111,102,173,248,170,51,99,76,105,163,185,222,194,211,129,78,153,232,191,241,98,
+20,245,104,72,246,61,51,163,216,76,122,171,70,19,52,158,17,97,50,48,228,137,86,81,156,171,124,237,157,252,67,187,255,160,1,254,169,239,48,0,2,184,114,126,217,108,66,120,113,173,136,79,113,173,136,79,113,173,136,79,113,173,137,67,
+91,19,248,209,133,96,0,30,31,86,112,0,0,95,251,218,225,18,253,234,54,106,112,0,1,255,105,225,89,217,232,217,167,133,102,95,189,70,205,78,0,15,251,1,60,43,59,61,27,52,240,172,203,247,168,217,169,192,127,216,0,39,133,103,
+103,163,102,228,133,101,252,212,111,245,185,0,2,250,206,149,178,110,72,113,49,63,87,2,98,90,182,38,213,86,196,150,162,173,137,40,170,182,36,162,163,98,74,37,132,82,81,35,100,102,148,72,216,115,88,216,115,20,75,13,83,40,217,25,
+177,81,234,153,201,25,177,114,87,51,180,173,142,76,236,114,51,70,57,27,196,141,114,103,118,143,178,103,163,239,75,217,123,52,158,220,243,128,0,2,218,78,83,232,168,78,83,193,80,157,211,192,167,164,224,98,239,222,102,253,103,237,99,250,
+206,139,128,3,255,159,245,255,191,245,51,50,163,93,230,0,2,28,159,214,66,125,150,196,39,184,214,196,44,234,53,177,20,245,26,217,165,141,124,105,99,217,253,109,80,0,7,140,244,69,62,213,231,46,25,157,156,165,27,62,81,22,124,162,
+70,167,202,36,113,39,202,42,140,207,148,84,106,72,156,88,249,148,108,57,148,134,195,153,72,242,57,148,143,40,204,164,122,166,82,62,136,250,35,232,142,158,89,103,84,241,42,236,133,92,244,132,244,132,245,78,3,155,41,234,140,244,172,146,
+147,194,152,148,240,118,57,149,57,107,205,23,31,44,92,114,212,70,163,109,220,75,118,191,210,150,190,94,108,121,117,22,25,181,22,17,132,75,8,193,247,97,24,62,229,70,11,186,199,197,252,190,111,224,150,17,253,161,198,11,253,244,31,249,
+235,92,5,255,250,143,249,31,254,224,0,31,239,186,243,2,184,86,118,95,28,220,144,174,143,70,154,216,133,194,188,204,75,47,141,20,242,61,140,208,158,88,47,141,44,123,24,134,236,22,201,167,133,102,70,188,232,217,185,51,43,249,181,135,
+140,244,69,103,115,52,86,114,95,30,138,127,232,248,244,40,106,234,226,120,0,7,140,244,224,44,241,83,228,40,249,68,89,242,137,63,55,21,199,174,81,84,102,161,185,34,71,25,137,30,168,204,72,245,27,158,72,81,152,145,76,53,35,52,
+101,114,173,243,243,188,11,210,246,37,236,189,154,78,230,243,206,20,117,28,168,114,141,142,81,22,57,68,141,71,40,145,199,9,68,141,91,98,71,24,63,81,28,87,115,142,43,185,199,21,220,227,138,238,180,87,117,23,112,170,224,0,0,0,
+0,2,244,185,243,245,100,70,182,33,60,56,214,196,39,184,214,196,20,53,177,40,107,255,52,91,123,192,120,15,169,9,244,69,106,234,175,134,174,170,192,0,10,255,122,234,255,122,0,0,94,252,220,78,124,162,9,138,124,162,1,50,98,124,
+162,9,147,20,23,63,231,151,52,234,69,79,18,152,158,164,42,201,45,9,201,238,132,228,150,157,79,23,229,41,237,89,70,123,79,89,37,39,133,141,83,194,249,212,114,20,57,68,141,191,174,60,214,56,174,227,148,84,187,138,81,35,141,212,
+138,221,21,46,234,50,245,221,68,155,165,136,79,178,216,132,247,26,216,132,250,174,39,168,214,195,184,158,163,91,14,235,26,216,119,126,218,48,173,96,1,123,197,247,19,243,113,66,234,223,40,147,38,39,212,151,190,164,84,162,76,153,224,41,
+191,158,149,102,219,172,114,136,22,57,68,19,47,90,142,81,38,21,210,134,60,143,184,151,83,46,169,98,251,128,191,249,247,62,122,26,217,81,174,243,0,12,220,159,198,59,137,246,97,220,79,114,216,104,79,81,175,141,11,57,30,198,37,176,
+91,52,177,175,252,209,132,69,75,96,0,12,220,80,60,81,162,36,201,158,0,41,209,200,169,225,124,255,158,147,197,73,82,49,40,194,101,145,132,205,39,40,176,153,24,78,81,42,202,51,169,27,49,29,211,230,0,142,81,4,193,117,75,10,
+154,117,245,31,231,170,192,87,14,72,86,100,182,33,35,102,156,214,196,86,112,70,182,33,60,171,134,102,161,60,151,199,161,60,143,103,26,19,203,13,140,210,120,86,87,47,141,232,217,161,54,194,254,110,160,3,198,122,104,89,221,199,161,103,
+46,174,46,2,245,230,0,0,7,20,15,90,48,95,11,231,0,3,205,38,104,168,78,83,193,211,186,120,95,56,0,56,219,249,233,249,64,0,1,52,235,204,204,221,78,53,177,40,107,98,80,214,202,141,119,152,31,246,120,125,72,79,163,16,
+159,101,177,11,58,141,108,208,158,163,95,26,19,248,227,213,94,112,0,20,235,122,183,185,234,235,106,0,45,189,169,251,160,11,175,109,211,179,245,128,42,233,255,109,180,85,255,175,250,255,228,59,254,192,83,174,159,165,235,83,100,92,81,216,
+236,177,226,100,83,248,32,0,63,231,95,248,204,0,239,221,43,127,237,74,110,91,45,191,204,187,252,102,7,250,139,252,179,95,152,127,251,176,1,215,79,210,239,171,150,101,93,251,249,148,96,0,0,0,95,255,166,255,148,23,249,215,254,128,
+6,250,185,87,126,43,183,53,63,80,183,29,230,3,191,148,230,254,213,75,169,106,253,185,254,139,163,176,15,229,59,246,173,14,253,189,155,250,178,253,25,255,140,10,117,217,109,229,114,194,181,126,141,220,159,227,174,243,31,250,255,168,255,191,
+38,101,69,46,226,199,39,127,5,34,193,53,237,2,252,223,230,31,198,31,166,0,95,55,237,167,186,85,129,251,105,238,27,67,191,245,253,85,151,241,64,8,221,227,251,85,114,255,107,99,53,66,183,187,5,177,40,107,101,70,187,204,1,201,
+139,255,120,145,58,50,251,140,0,47,237,95,59,151,141,23,63,237,201,115,138,46,111,232,129,143,249,135,253,192,253,143,238,221,48,183,233,191,88,75,189,127,215,190,112,175,229,128,239,249,133,212,186,151,48,162,230,191,243,197,251,167,55,246,
+83,232,219,231,191,176,15,255,95,15,247,206,7,99,191,148,91,233,48,119,71,238,248,138,106,171,88,255,12,194,97,55,247,155,124,203,254,184,88,88,93,38,87,242,174,83,69,161,250,191,217,2,255,8,5,254,224,39,231,135,53,167,90,191,
+130,38,93,243,47,253,194,3,246,159,191,22,253,136,22,253,240,133,233,250,184,115,15,216,129,111,223,2,235,28,208,38,241,10,176,2,175,207,117,138,126,139,245,122,14,192,63,252,4,63,206,0,2,245,151,246,137,127,186,86,54,154,188,214,
+93,101,169,75,158,139,169,101,55,240,65,77,86,63,230,31,247,3,178,173,246,222,175,219,126,176,23,249,197,243,175,250,42,253,208,222,178,95,232,182,83,17,112,45,244,75,26,141,249,136,222,230,153,66,173,155,250,2,225,84,196,250,178,253,
+233,117,61,174,123,183,104,168,19,75,143,39,228,166,186,14,109,191,104,29,251,210,225,103,254,187,158,227,230,227,35,187,167,159,42,186,183,83,244,153,84,210,111,243,73,181,29,197,252,251,142,63,191,103,18,197,30,51,180,53,218,93,102,176,
+140,117,112,135,24,164,42,123,191,123,99,81,220,235,180,184,195,21,199,251,252,137,162,166,129,83,106,107,45,147,20,220,253,92,64,100,241,252,214,92,117,29,223,207,28,95,166,231,3,61,71,112,170,232,138,153,251,78,0,158,63,186,87,29,
+140,142,239,223,220,8,234,130,255,164,30,92,45,7,112,184,154,151,26,141,199,118,142,101,141,204,53,45,208,95,17,64,65,95,221,107,239,59,191,191,113,138,127,7,244,75,143,235,156,251,112,23,91,156,239,49,110,218,126,186,36,220,226,167,
+135,213,113,212,119,10,140,184,126,145,117,138,191,251,121,221,253,251,140,95,131,63,159,168,81,160,0,29,251,223,210,8,1,126,122,61,95,205,36,184,233,90,241,221,189,80,44,183,148,9,181,54,144,13,2,165,205,209,251,165,169,118,155,41,
+134,247,67,51,233,12,91,212,230,212,216,148,21,55,231,154,248,42,118,208,196,42,50,109,80,22,109,22,111,131,97,116,97,152,155,12,212,107,186,75,50,191,144,121,175,198,66,134,93,174,196,183,75,243,213,29,82,35,254,65,32,64,7,247,
+180,182,10,253,139,146,154,23,243,213,42,142,163,107,187,90,173,173,118,170,54,33,42,108,175,104,82,255,148,56,255,75,212,191,224,170,58,84,101,253,246,157,237,194,203,44,191,98,75,87,70,197,115,51,246,238,49,220,5,253,141,255,123,59,
+42,238,41,80,229,108,26,174,220,157,186,145,182,232,185,160,84,219,255,148,165,212,187,255,200,72,63,190,8,192,254,137,127,166,54,230,75,71,65,84,136,234,144,178,220,219,45,95,183,234,213,110,225,99,23,183,252,37,254,158,105,22,238,112,
+1,130,235,237,167,69,183,41,125,85,32,65,81,151,88,177,213,151,233,63,143,87,112,4,99,252,37,255,146,232,0,52,7,127,41,97,95,213,96,46,218,69,95,177,87,61,36,101,206,230,157,237,193,93,10,54,54,141,56,244,197,95,199,5,
+220,1,203,243,210,194,13,98,152,210,205,19,29,170,204,95,191,81,165,164,218,140,17,255,29,136,176,0,2,159,172,167,235,0,21,107,119,235,21,250,193,79,254,85,174,218,240,47,214,96,172,72,239,194,172,42,194,211,193,248,179,245,118,120,
+235,180,213,98,41,155,26,79,124,204,226,95,238,162,181,110,114,199,232,194,192,31,250,255,200,31,243,0,111,254,158,84,93,75,183,232,213,250,48,5,23,122,192,0,0,175,225,187,96,253,24,254,210,230,25,43,37,46,203,82,203,34,89,52,
+15,249,205,179,122,247,130,200,83,164,155,53,54,59,244,110,217,87,90,237,186,153,18,237,149,95,163,0,84,189,251,55,139,100,45,253,146,88,254,152,95,242,151,51,183,83,42,178,182,69,176,155,82,203,246,110,88,253,215,232,230,44,137,164,
+208,9,170,200,178,31,243,31,186,95,95,67,154,91,156,210,109,26,172,151,189,110,93,191,70,41,189,123,246,77,149,77,182,68,219,255,71,210,29,252,49,54,207,221,45,77,44,137,160,52,178,86,87,255,204,22,207,229,44,154,93,20,221,70,
+185,123,246,111,88,0,0,63,199,50,234,105,108,27,7,232,192,29,127,203,221,252,23,116,129,255,48,57,63,116,185,176,232,92,217,57,116,216,239,209,128,41,255,202,126,177,95,172,166,35,17,136,196,98,175,238,22,32,0,0,0,1,77,238,
+235,87,93,55,207,55,238,213,133,88,58,101,96,91,208,166,228,152,180,152,176,86,138,193,90,43,5,105,55,36,223,171,128,16,53,24,0,58,5,218,0,0,43,21,87,202,88,186,190,82,214,0,3,255,131,255,128,1,255,192,63,248,0,189,
+63,120,249,37,15,54,170,31,46,41,198,152,221,16,172,156,210,253,153,108,185,191,213,56,235,161,234,196,176,137,97,28,94,85,235,205,9,151,112,106,178,44,191,231,255,85,118,85,221,219,47,221,141,212,253,157,191,235,216,59,167,150,27,112,
+10,201,89,23,248,255,235,216,59,165,252,25,24,46,146,111,252,255,235,216,59,191,131,44,44,210,105,116,18,201,191,195,45,159,245,236,29,223,177,150,18,191,164,183,127,207,254,189,131,187,245,24,109,60,170,200,178,83,127,231,255,94,193,220,
+114,254,138,155,108,149,208,95,243,255,175,244,70,29,210,254,140,137,181,44,186,85,254,63,234,182,235,107,143,105,99,168,212,252,99,129,70,25,92,156,181,226,93,118,198,107,241,154,252,102,2,172,102,119,28,102,194,227,86,10,209,88,43,69,
+96,173,21,130,180,86,10,209,88,43,69,96,173,46,154,121,185,36,194,129,30,195,113,172,140,90,11,190,181,241,83,246,69,203,106,217,179,85,127,158,0,1,250,61,78,95,22,199,39,39,235,171,204,121,181,22,17,35,175,152,141,71,94,104,
+241,187,10,224,202,97,93,230,53,127,107,138,173,90,91,246,216,40,203,86,220,35,129,106,219,92,35,129,106,35,174,17,192,186,231,151,61,71,42,28,175,57,14,218,126,163,2,57,115,109,41,31,62,210,63,236,145,203,164,164,82,232,35,145,
+244,56,247,90,89,27,93,150,219,101,34,105,52,255,178,71,253,146,219,210,88,116,187,161,221,46,233,119,74,155,47,236,171,251,37,183,165,71,211,110,138,101,83,92,114,57,52,164,110,61,166,227,150,18,50,57,30,71,37,27,118,180,237,130,
+142,71,99,35,218,173,167,35,110,214,152,6,5,187,100,101,135,234,12,143,111,53,124,155,63,72,0,0,95,139,177,253,52,202,198,97,76,102,20,198,106,76,239,221,43,125,63,244,5,91,221,214,174,176,41,190,121,185,32,106,195,126,101,77,
+201,105,139,10,176,171,10,176,171,11,118,255,12,0,5,245,211,139,29,149,224,88,184,193,47,17,69,227,110,44,109,94,186,98,29,133,121,173,133,112,188,192,0,114,254,147,245,112,143,105,100,117,245,68,178,86,11,44,170,202,157,118,253,136,
+228,174,122,231,174,124,142,153,109,50,57,110,41,36,139,116,145,137,47,221,102,94,105,187,5,127,219,172,250,85,46,146,63,236,148,191,178,77,255,82,251,4,245,242,87,61,115,145,229,109,187,173,210,169,127,100,191,245,216,23,92,245,242,87,
+62,10,201,219,79,117,182,244,20,138,91,191,245,216,43,157,127,164,229,45,189,177,129,25,71,170,179,114,240,86,85,117,211,246,32,59,26,177,21,98,42,196,85,141,191,88,0,0,23,255,45,173,248,254,245,88,85,130,176,81,150,26,221,250,
+197,126,176,10,112,215,108,53,184,245,211,16,0,10,254,98,177,182,42,254,96,0,2,253,229,191,120,0,0,85,250,100,115,58,16,152,217,186,17,75,202,139,201,217,77,209,167,74,41,55,37,183,49,20,194,216,77,71,111,38,161,52,183,34,
+183,19,80,152,91,236,210,216,77,66,78,132,118,59,184,208,153,103,170,229,101,2,91,212,216,18,49,89,65,87,43,34,66,123,158,238,136,57,49,154,25,65,9,139,122,171,102,194,203,148,152,77,38,242,178,231,33,61,217,35,224,144,86,120,
+33,38,93,72,237,38,110,100,36,45,133,117,152,167,169,54,35,75,20,38,18,52,152,91,45,113,48,183,19,202,102,187,34,255,124,47,125,239,169,111,169,151,221,123,239,203,141,20,204,137,234,97,45,87,90,101,49,89,137,164,252,83,49,53,
+10,229,47,51,16,152,166,146,22,108,80,147,118,51,34,183,76,181,48,150,75,164,202,122,179,19,73,247,22,98,106,21,211,34,243,49,10,101,52,144,179,18,18,110,199,69,67,42,60,159,71,149,214,91,201,150,97,63,20,36,43,138,234,60,
+153,76,177,69,109,230,146,23,247,228,153,255,81,156,181,238,214,95,220,106,103,253,170,22,133,206,173,85,115,126,161,11,251,242,76,255,168,206,90,247,107,47,238,53,51,242,231,151,57,36,180,45,74,77,69,205,183,81,127,188,179,255,32,181,
+244,150,190,146,207,252,130,255,121,127,156,147,250,229,31,239,151,15,220,22,109,123,139,77,218,243,36,127,81,192,191,191,36,254,186,23,245,229,220,91,115,254,160,180,214,92,234,215,86,122,180,171,85,92,200,232,243,201,21,158,89,212,205,109,
+214,212,255,97,103,253,46,114,208,191,127,204,239,235,237,137,127,190,73,159,245,25,203,94,237,101,253,198,166,126,92,242,231,36,150,133,169,73,168,185,182,234,47,247,150,220,255,168,45,53,151,58,181,213,158,173,42,213,109,188,210,66,254,252,
+147,63,234,51,150,189,216,230,77,123,177,204,153,255,81,156,191,191,36,254,186,22,162,210,50,231,118,133,157,217,203,91,181,150,183,107,44,242,213,156,165,252,249,105,252,116,41,127,30,93,197,183,63,234,11,77,101,206,173,117,103,171,74,181,
+91,111,54,222,226,219,159,245,5,166,178,231,86,186,179,213,165,90,169,46,105,33,71,249,242,76,255,168,206,90,203,77,101,173,218,203,60,181,103,41,127,62,90,127,29,10,81,45,35,46,121,33,104,92,51,38,114,253,227,117,150,182,254,240,
+179,150,110,5,161,36,180,45,74,77,68,0
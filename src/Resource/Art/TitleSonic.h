@@ -0,0 +1,104 @@
+130,13,128,4,4,20,5,36,6,53,16,69,15,85,17,101,23,115,0,129,3,1,21,20,39,106,56,238,130,5,21,23,114,131,5,14,23,107,40,241,132,7,113,133,6,52,24,240,134,5,19,23,110,40,242,135,5,18,23,115,40,244,136,7,
+117,137,6,54,138,6,50,24,236,139,6,51,24,239,140,7,111,24,246,141,7,112,24,243,142,5,24,23,116,143,5,22,24,237,255,0,0,5,220,218,213,202,238,122,213,201,251,119,62,73,39,47,36,147,247,242,146,215,122,123,86,251,245,159,
+230,128,235,201,215,147,159,36,147,161,89,36,156,197,223,148,114,184,69,192,1,23,0,12,72,47,168,141,80,136,84,6,163,205,176,149,93,172,97,180,204,54,152,1,8,0,128,142,57,37,16,165,119,181,24,133,232,252,23,226,146,91,96,171,
+145,212,67,37,48,115,204,174,224,0,23,116,76,155,185,28,135,249,221,115,195,232,159,202,92,159,146,100,252,151,249,64,0,0,94,31,207,253,103,240,117,217,125,55,39,52,253,156,147,92,53,128,31,136,226,111,196,227,56,226,243,142,47,81,
+126,45,54,154,113,158,27,19,150,159,203,211,254,32,0,0,0,37,83,251,252,55,175,241,221,187,209,100,228,220,158,137,227,59,186,100,69,210,54,49,150,32,233,35,175,197,238,78,55,173,241,25,183,235,19,9,251,206,27,211,127,229,55,209,
+120,175,29,183,241,205,252,80,128,28,247,43,151,92,53,192,131,2,221,192,4,255,231,236,225,251,127,217,250,39,237,219,246,226,81,220,199,118,180,164,181,169,230,232,113,214,3,116,126,43,56,98,124,95,56,226,27,214,183,227,14,41,136,77,
+107,12,113,78,45,52,150,115,89,225,78,142,235,136,23,149,61,241,167,124,105,124,133,242,31,252,3,92,121,185,254,142,93,123,164,154,249,235,242,78,107,227,59,186,119,116,197,221,139,212,11,214,248,17,117,229,23,94,69,252,76,29,196,193,
+210,45,223,39,211,165,23,177,122,81,123,23,22,134,74,123,35,237,229,250,192,2,255,207,254,235,47,41,121,31,19,251,63,214,39,239,24,217,105,10,60,226,22,156,12,14,22,197,10,145,98,146,40,108,66,86,5,10,24,29,98,7,88,2,
+4,8,16,133,156,150,42,229,119,15,209,119,0,63,103,15,68,115,77,100,149,87,78,79,222,178,53,11,98,134,161,136,67,80,243,87,154,197,194,238,172,105,87,144,134,175,33,13,94,64,67,87,144,16,213,229,185,38,214,197,184,0,22,185,
+76,8,156,166,38,243,144,73,188,229,115,149,204,123,225,223,185,179,156,169,2,252,231,114,196,38,115,99,189,74,159,103,251,29,242,110,4,4,32,130,8,34,128,137,137,199,36,155,251,19,115,244,93,201,60,173,224,179,107,39,131,251,83,68,
+201,52,246,215,250,205,161,188,196,132,160,163,175,174,37,215,32,0,1,26,135,112,3,112,253,178,248,67,118,191,218,195,197,60,30,225,172,127,5,53,53,89,223,162,113,94,90,203,232,0,0,1,15,248,128,31,255,96,179,254,42,76,246,174,
+147,91,37,180,154,20,117,207,156,168,0,0,0,2,24,106,78,224,2,121,47,147,110,135,103,53,236,108,164,252,128,25,71,37,151,239,64,185,17,49,49,49,45,52,163,203,231,147,231,147,231,148,55,100,219,147,40,228,254,192,0,0,71,127,
+139,246,1,29,23,7,207,33,28,128,12,226,8,131,152,129,10,189,192,85,238,2,175,114,126,137,213,71,0,230,165,64,10,224,3,24,57,170,0,4,3,10,134,32,20,168,141,64,0,0,185,128,0,0,38,126,199,142,249,63,101,206,105,195,
+75,236,68,13,247,233,9,174,192,4,33,251,41,134,130,106,69,60,228,40,8,0,0,0,0,138,15,224,143,224,141,66,29,143,201,114,134,75,147,251,0,0,4,49,41,78,31,193,121,134,155,227,179,200,42,64,1,251,68,248,95,102,145,218,
+254,12,115,154,108,133,38,158,102,123,248,100,114,1,37,144,71,69,213,105,108,234,191,144,132,179,1,138,230,4,93,23,87,248,40,226,0,187,132,93,87,186,161,238,171,221,87,186,161,238,171,221,88,214,230,177,112,168,141,64,23,207,206,153,
+249,198,113,201,38,147,77,235,144,200,102,147,77,241,156,56,121,39,235,95,168,110,31,214,236,31,218,31,173,253,230,90,154,111,220,153,39,146,228,147,110,196,201,63,84,185,38,80,202,57,63,218,105,222,154,95,101,158,107,188,44,243,124,223,
+185,51,142,111,239,106,222,160,0,0,8,68,72,2,36,1,18,2,186,46,139,159,87,45,163,98,181,91,23,216,161,74,132,177,74,84,95,199,135,183,13,238,229,72,83,149,33,78,69,244,173,200,112,126,180,114,254,205,127,103,69,215,69,214,
+133,244,17,49,237,164,10,89,250,172,88,169,177,23,216,192,177,189,191,89,231,157,120,0,13,221,72,235,45,86,119,232,139,119,38,160,0,0,0,186,154,159,174,74,91,12,123,75,27,62,138,86,137,231,250,206,30,192,0,223,242,255,136,0,
+0,0,127,248,83,167,111,235,138,106,108,82,38,38,36,39,247,60,192,189,83,250,70,191,209,66,0,137,125,38,253,209,244,0,0,111,138,55,51,218,88,190,69,205,98,36,93,251,218,187,142,128,127,203,254,32,8,127,199,119,63,219,45,33,
+255,118,170,255,11,37,118,95,172,154,157,140,78,45,72,83,9,205,248,167,53,41,172,192,171,140,131,220,100,219,180,227,251,48,43,115,252,38,254,15,40,208,127,199,254,255,241,255,191,240,168,153,126,241,166,242,19,80,9,96,87,8,97,86,
+177,99,129,98,181,71,114,241,160,0,86,231,244,79,213,201,104,180,229,52,45,220,154,148,214,20,18,23,170,126,204,107,0,11,152,106,106,66,145,173,207,40,210,176,162,26,188,161,171,202,26,188,161,174,182,48,241,74,63,93,95,169,117,53,
+0,1,245,0,70,160,0,0,2,245,0,84,0,7,46,30,220,61,163,70,50,241,89,187,79,213,174,157,236,237,249,199,54,241,95,22,214,0,23,226,0,28,71,31,214,230,159,169,242,74,254,151,90,28,113,253,70,206,170,113,223,109,231,243,
+11,198,92,127,89,136,126,145,58,12,126,214,25,140,198,99,49,237,250,222,254,20,132,211,90,205,41,223,172,105,36,41,189,140,181,201,157,166,111,239,118,33,173,11,73,164,198,248,140,161,37,180,45,43,219,168,15,253,92,105,250,181,43,171,
+52,171,206,124,121,64,241,90,136,232,232,104,233,24,77,8,48,155,106,93,208,57,174,230,225,251,116,164,40,165,140,63,195,41,255,79,195,255,113,254,24,241,0,0,0,0,1,222,254,52,253,223,28,47,118,0,0,37,7,240,83,248,42,96,
+68,76,43,71,231,226,254,244,215,13,236,230,147,103,175,123,243,73,68,223,16,147,163,101,147,73,101,11,52,214,75,196,227,157,159,218,188,75,248,151,241,47,226,88,254,81,59,191,252,255,221,54,87,200,126,232,1,31,232,226,223,153,143,48,
+0,107,16,25,201,98,33,103,17,30,17,168,0,1,126,232,126,250,145,233,76,134,80,178,228,197,114,124,222,98,82,123,45,32,226,187,178,114,126,99,107,117,253,21,57,195,152,0,0,0,0,0,243,18,34,98,98,95,71,145,23,69,209,116,
+93,23,63,91,220,47,201,223,162,189,80,169,66,142,129,214,149,131,181,53,0,0,1,14,230,48,212,0,0,39,140,28,218,192,112,112,0,1,255,16,42,57,63,87,40,210,183,53,185,173,200,0,17,168,80,80,0,19,246,112,238,241,126,164,
+168,139,146,177,112,9,88,185,250,171,10,220,214,230,162,230,162,230,162,230,170,65,5,77,96,65,103,66,149,62,47,213,172,190,154,227,64,0,111,229,183,120,239,26,71,61,31,152,152,126,115,185,126,115,185,126,115,185,126,115,134,138,95,156,
+216,137,177,66,218,77,10,78,30,75,160,198,130,60,29,255,109,195,246,223,245,95,234,166,129,243,209,63,140,179,11,221,52,160,121,140,193,17,206,100,71,57,210,51,74,54,105,53,45,154,121,102,221,227,190,127,237,143,253,191,235,163,191,138,
+233,195,115,121,6,163,106,93,64,0,0,0,39,252,71,253,161,159,250,184,118,62,125,137,189,53,233,250,200,57,143,7,64,196,190,130,27,220,157,143,201,114,134,75,146,22,236,105,135,148,202,51,71,49,19,202,5,156,148,73,228,249,171,151,
+114,101,28,145,203,94,198,228,212,171,255,163,91,154,179,168,247,85,75,131,58,173,80,25,192,0,180,6,20,172,29,87,80,49,20,20,20,4,84,0,0,23,117,42,43,23,0,4,10,186,176,32,138,128,0,133,93,86,238,168,98,227,88,214,
+53,0,84,94,160,0,7,240,84,255,10,137,212,214,156,146,219,120,209,182,114,56,57,167,179,163,53,116,92,135,75,38,245,147,111,112,73,57,116,112,87,51,150,65,156,188,92,0,11,80,3,113,0,113,190,221,237,249,153,195,100,152,110,93,
+255,189,164,121,119,37,105,203,93,74,209,40,154,219,86,180,254,58,115,79,22,214,206,147,162,224,4,109,121,70,215,144,0,94,87,179,126,227,55,39,94,63,168,214,188,125,177,250,133,252,164,253,186,191,242,153,186,231,150,140,90,126,44,97,
+250,207,214,246,175,236,169,203,185,104,30,98,100,96,100,233,21,50,116,12,156,174,145,147,160,233,56,69,207,181,229,107,200,0,5,229,123,69,223,171,135,119,122,206,171,78,254,41,86,48,171,16,206,135,136,127,239,255,125,252,23,234,244,167,
+163,115,95,217,167,140,28,0,0,70,209,50,142,47,32,0,188,175,139,153,94,192,103,115,223,12,210,159,187,45,220,2,127,240,0,4,117,195,95,56,107,252,160,15,241,95,31,77,126,137,251,116,244,229,233,250,47,111,29,94,97,60,106,206,
+244,132,175,232,254,73,40,111,189,139,146,124,117,167,35,57,44,151,248,41,204,165,17,203,34,165,53,164,139,220,146,47,112,9,34,247,47,108,121,155,226,242,132,197,230,35,34,22,87,194,241,43,34,249,89,120,148,54,94,41,76,46,127,190,
+205,51,48,182,101,243,49,171,255,68,250,184,37,188,245,35,171,236,180,77,235,69,54,66,243,108,70,152,185,197,206,46,113,115,139,149,231,14,116,230,199,89,98,229,116,191,41,13,56,234,114,105,196,177,211,137,110,124,96,97,169,120,191,17,
+193,227,12,25,136,96,207,128,79,215,25,218,182,213,58,249,254,218,173,251,40,84,198,174,137,253,126,63,88,0,16,53,26,226,65,123,150,207,214,92,222,75,250,77,92,116,212,212,11,71,148,45,75,64,227,182,24,162,255,7,15,156,113,44,
+67,163,250,0,254,139,43,215,101,148,43,249,148,196,43,174,81,223,111,204,254,179,133,58,0,0,26,195,159,68,116,74,57,191,75,249,70,254,15,163,245,0,5,46,99,135,211,5,138,21,212,48,134,29,31,208,63,160,108,38,11,96,164,138,
+217,118,178,116,164,240,127,115,215,0,9,92,250,63,87,56,210,87,50,185,0,60,196,190,138,82,144,193,126,26,223,238,238,194,56,202,124,157,193,211,237,74,187,134,27,42,158,150,108,171,71,157,113,221,12,230,165,115,156,14,83,126,115,162,
+205,75,79,76,230,166,122,99,62,30,220,51,194,74,231,210,52,148,13,144,200,92,200,41,137,197,221,130,134,73,193,202,89,216,108,46,2,126,187,101,233,202,77,201,52,195,76,38,152,132,198,152,126,152,142,5,255,121,195,60,64,207,76,49,
+158,152,99,61,48,198,122,98,19,211,15,211,17,192,174,127,205,77,128,190,105,48,35,154,76,71,52,156,115,73,199,52,156,115,25,129,250,207,230,177,129,13,220,16,128,65,4,16,82,113,41,56,230,147,142,105,185,188,231,207,82,151,208,0,
+0,0,8,208,80,106,79,240,128,4,127,68,255,209,0,0,0,8,212,188,161,129,214,198,186,202,26,235,169,93,117,48,169,0,0,0,133,19,248,42,95,185,188,187,60,191,84,191,170,15,202,243,246,134,77,236,153,79,248,60,36,64,0,1,
+115,18,55,188,206,20,158,75,77,217,41,73,246,54,236,159,216,0,126,79,236,154,254,171,113,236,242,66,155,161,252,20,253,224,83,188,60,141,239,35,120,142,241,119,81,238,170,80,16,85,213,108,242,135,124,228,217,206,69,114,218,101,178,156,
+139,25,150,164,202,211,118,137,77,222,24,150,239,14,137,217,167,61,176,81,216,244,196,63,92,133,29,80,0,16,206,57,205,249,204,195,57,152,103,50,217,109,50,167,41,200,169,220,88,207,66,180,158,152,83,187,76,37,39,225,133,221,167,70,
+240,195,250,0,19,247,124,27,189,102,254,241,157,243,142,115,126,114,34,25,200,63,57,41,11,156,130,153,166,114,126,114,140,224,102,134,57,64,137,232,212,133,22,105,165,175,163,77,251,159,49,127,8,244,240,143,79,210,191,245,218,95,31,253,
+221,31,15,38,254,47,237,147,69,253,42,78,30,11,162,120,67,193,60,146,105,185,243,74,46,228,43,64,165,243,0,128,35,50,35,148,200,49,154,106,92,146,108,114,109,205,216,219,155,177,249,47,100,50,108,188,23,38,233,250,94,212,243,254,
+30,241,127,251,101,254,84,255,46,80,255,176,13,255,16,0,0,0,0,9,255,17,127,251,15,253,0,158,223,173,79,106,55,9,223,41,199,126,137,217,11,100,185,67,37,201,178,78,199,255,70,112,242,240,242,253,47,111,233,109,191,11,250,246,
+164,29,80,23,245,238,53,95,215,129,119,86,4,17,81,12,196,115,144,126,115,32,7,233,56,227,73,199,26,95,0,1,253,206,25,188,137,140,160,68,225,69,201,40,179,83,251,204,182,32,61,213,82,8,46,168,111,214,237,157,26,111,220,185,
+33,110,200,118,49,137,125,33,64,0,13,170,5,57,62,180,142,195,97,121,136,204,98,230,56,185,121,168,187,163,80,4,106,0,1,172,35,104,126,139,204,1,221,15,217,127,199,246,94,41,220,229,114,243,217,200,238,122,230,142,150,181,194,73,
+194,6,78,15,147,128,139,128,9,253,132,235,47,220,75,138,75,243,22,197,159,41,245,77,227,125,236,234,232,214,66,146,215,100,42,98,67,121,251,126,244,1,15,217,47,46,238,84,121,140,169,2,238,50,162,30,42,239,202,30,49,227,14,215,
+158,102,24,92,49,146,201,177,121,1,121,94,205,38,234,214,78,249,43,187,233,37,117,35,81,122,183,236,200,185,137,135,235,127,152,7,252,191,131,26,122,37,57,248,153,113,214,220,92,0,0,0,0,2,63,251,255,136,0,0,7,255,0,253,
+147,87,246,255,162,62,41,232,91,197,37,23,7,5,183,230,31,37,44,91,13,134,147,72,0,26,87,195,73,100,90,203,102,239,215,14,239,213,241,134,172,0,0,3,255,144,253,146,126,139,186,186,154,165,191,69,190,156,191,88,167,92,105,218,
+134,69,105,100,115,206,18,70,4,35,131,115,135,58,74,7,89,98,229,112,78,52,114,186,7,89,110,116,151,18,220,194,27,247,67,247,212,111,213,116,166,77,217,211,39,228,189,141,146,114,79,213,45,93,87,226,219,255,93,237,253,26,132,253,
+148,63,88,35,71,144,47,136,184,226,231,21,141,24,201,238,133,24,201,170,142,129,99,32,213,89,0,31,80,2,27,224,190,105,98,159,164,135,22,43,148,14,254,29,127,142,3,134,183,149,115,232,142,137,110,174,98,230,214,167,173,153,193,195,
+43,0,31,177,176,15,43,111,219,116,255,143,72,208,127,216,6,244,110,178,213,36,235,100,42,100,44,2,149,50,15,50,98,16,201,136,67,32,243,56,16,174,48,58,63,23,181,233,163,255,87,143,222,169,93,64,6,32,2,1,89,188,172,222,
+70,105,56,230,147,142,105,185,249,172,223,222,147,142,113,239,126,123,161,156,202,77,115,145,111,57,55,112,1,53,60,235,229,14,78,185,117,200,0,16,69,1,5,102,250,38,232,248,121,54,137,224,155,159,250,84,255,44,171,253,112,4,76,191,
+164,237,0,14,185,137,74,192,136,152,84,33,17,169,13,73,37,105,2,149,113,220,147,40,107,251,89,209,60,23,77,199,159,232,185,155,151,153,57,76,170,237,19,147,180,0,45,33,64,165,72,129,66,0,133,3,203,144,177,113,106,56,166,167,
+84,161,253,17,74,54,164,158,250,38,237,249,33,215,164,191,91,85,210,177,144,168,93,35,166,31,60,33,8,235,149,159,1,121,112,46,98,133,12,39,88,25,228,142,185,83,60,160,98,82,121,47,82,147,201,243,201,243,201,253,114,127,92,13,
+251,126,219,23,182,33,218,112,189,168,112,156,111,138,173,112,167,133,98,120,86,39,130,244,48,253,114,81,56,95,134,23,206,60,188,225,108,126,139,132,48,149,143,232,176,165,28,150,253,114,88,217,112,214,98,228,115,20,243,191,235,66,149,232,
+238,133,58,127,188,195,180,17,168,106,79,247,39,235,191,126,198,228,119,54,32,83,9,250,230,194,83,8,91,182,29,24,167,70,43,133,162,219,83,91,103,219,103,219,96,251,109,28,84,128,243,152,0,128,251,108,3,237,176,15,182,193,246,218,
+59,0,0,11,250,47,48,213,77,128,17,170,76,8,230,147,17,204,102,0,0,1,124,227,156,161,223,40,103,206,25,205,249,204,22,57,205,10,151,209,166,31,61,19,114,205,251,151,26,11,227,75,227,75,227,194,61,60,23,63,214,59,68,206,
+74,102,243,186,89,201,119,24,24,73,14,226,24,238,49,48,59,128,124,212,220,129,115,25,161,108,132,11,230,180,76,130,205,249,46,228,253,87,237,147,200,63,80,254,8,0,0,0,0,0,6,161,252,16,191,214,95,227,9,183,252,64,9,216,
+252,151,40,100,185,63,176,0,0,0,33,137,110,228,223,72,77,251,178,62,91,251,16,254,169,251,226,227,188,92,189,203,188,0,19,32,50,188,251,35,185,14,252,152,135,205,41,188,232,187,155,30,11,188,175,79,2,254,128,127,71,105,8,245,
+193,20,108,185,41,7,41,137,186,171,156,232,27,57,152,103,50,217,109,50,199,113,98,148,98,147,129,73,232,180,73,233,138,44,244,195,110,211,11,187,195,13,225,210,29,0,143,237,251,57,195,247,177,225,189,244,76,14,138,87,244,95,174,237,
+154,215,159,230,115,53,207,162,239,225,109,161,188,139,108,33,219,179,255,50,35,191,135,126,35,166,24,204,105,136,79,76,7,233,136,224,106,253,220,50,25,49,135,96,82,40,53,119,255,117,127,172,7,254,132,127,226,190,127,171,162,110,92,144,
+183,98,21,236,83,18,250,60,128,0,0,70,175,228,97,90,38,170,150,228,227,13,81,49,32,0,5,245,63,210,141,227,204,191,92,168,30,233,93,220,64,125,163,105,89,242,73,91,246,223,174,206,53,48,228,97,90,55,35,10,209,228,0,0,
+0,68,190,146,129,230,230,50,214,198,78,129,147,160,100,28,249,7,1,23,0,5,248,255,148,136,152,153,190,146,121,0,0,0,135,240,82,159,199,60,255,102,146,215,13,96,0,0,189,163,105,70,64,0,154,126,83,150,158,103,114,73,107,52,
+230,156,178,73,45,123,18,75,92,147,114,215,45,208,118,204,86,159,175,126,172,92,128,0,55,145,188,139,220,146,47,114,72,189,193,36,94,224,29,34,150,188,133,175,32,111,139,201,255,174,221,165,92,0,143,40,114,162,242,163,86,143,175,240,
+204,63,68,87,150,164,229,72,80,66,144,166,230,59,146,94,53,253,35,128,0,6,255,151,252,67,81,181,110,213,228,190,77,205,189,57,122,126,139,179,244,95,170,73,254,169,60,151,202,19,134,165,212,212,2,56,185,233,2,148,233,26,98,231,
+23,54,135,52,43,206,156,245,254,83,195,242,128,0,23,254,95,241,31,241,143,237,156,27,246,240,228,181,114,59,39,185,38,0,0,1,18,6,250,173,66,58,162,176,115,234,180,241,165,117,128,0,253,19,245,126,137,250,185,127,5,40,253,81,
+214,222,52,241,83,19,19,18,34,64,137,0,0,47,250,43,159,217,165,30,225,255,58,138,199,144,0,0,0,17,112,116,117,182,168,20,229,26,8,184,58,4,0,64,4,2,63,227,254,39,127,198,228,1,173,156,133,127,102,11,220,34,228,40,
+98,100,243,36,48,146,57,11,153,207,144,112,0,1,10,132,147,128,125,82,78,23,147,161,80,178,125,64,168,173,240,63,109,250,233,94,64,66,87,197,200,149,237,36,115,237,205,207,178,75,139,235,237,252,140,36,191,113,37,151,239,228,223,183,
+9,129,250,230,210,31,174,25,223,49,28,196,223,156,193,134,115,34,25,204,195,57,152,103,51,9,240,207,249,68,95,23,144,34,246,189,163,35,28,39,242,211,44,211,187,53,48,58,234,42,43,125,12,52,116,219,194,109,69,152,220,222,13,229,
+252,87,232,191,165,135,110,137,53,183,98,104,23,176,39,148,38,91,177,168,51,151,158,121,114,140,175,139,145,43,216,0,47,223,14,250,126,238,139,220,0,12,70,161,220,63,236,63,235,255,91,255,216,4,255,136,253,23,102,216,179,228,67,221,
+121,106,146,73,79,75,74,220,83,13,101,195,243,195,243,47,204,196,128,34,94,106,232,87,93,97,200,136,255,197,102,223,182,79,38,240,111,218,187,248,174,154,126,151,115,121,64,196,190,141,171,177,74,228,185,67,37,201,59,122,236,187,117,73,
+23,43,136,73,23,43,139,29,101,185,211,156,57,128,0,0,7,212,180,149,198,38,18,0,8,106,121,0,0,0,160,0,1,220,59,128,0,93,207,215,252,26,209,238,14,14,14,0,14,225,168,16,191,243,255,136,0,8,184,56,56,7,8,17,
+68,115,107,67,10,58,231,147,126,206,190,33,191,227,255,239,229,46,87,200,127,43,251,253,0,163,29,120,177,126,70,198,25,6,46,94,150,215,169,93,71,155,213,238,90,189,203,87,184,57,42,191,189,233,237,251,40,107,71,85,138,151,67,90,
+22,40,95,174,46,47,164,41,54,166,236,146,155,147,36,59,147,177,102,185,43,142,157,140,234,233,23,79,40,153,220,239,1,50,1,169,189,114,11,77,238,219,33,23,64,216,58,6,206,15,222,224,0,143,244,69,42,43,23,54,122,150,171,191,
+205,28,2,86,46,27,76,23,229,191,166,240,247,37,64,139,128,14,0,10,13,66,137,171,54,62,123,192,188,226,66,102,249,232,253,249,224,0,31,80,0,168,17,112,0,92,138,128,0,1,249,136,231,48,252,1,124,105,49,28,105,124,0,6,
+124,63,185,50,243,18,4,222,88,169,73,181,18,111,220,222,79,210,248,253,43,255,93,251,88,126,248,14,7,191,135,235,39,2,1,91,100,147,82,60,35,162,228,147,134,77,186,25,71,36,236,126,75,150,144,201,113,252,94,212,255,112,255,224,
+0,80,106,26,134,225,253,110,193,253,161,255,17,255,192,46,68,75,232,147,238,89,228,187,252,178,185,93,235,187,60,151,41,175,148,78,79,42,116,154,148,45,53,213,166,237,73,148,208,169,202,104,97,52,48,157,26,144,162,79,68,162,110,211,
+5,55,120,97,103,166,125,22,122,96,63,76,8,224,11,254,247,190,137,228,153,33,155,100,133,127,84,133,114,99,13,80,32,47,79,213,183,79,210,191,245,192,0,59,250,67,195,164,58,0,0,9,251,46,17,177,90,173,139,236,80,165,66,88,
+165,42,2,88,165,46,110,64,91,20,160,0,0,133,169,11,17,29,243,126,244,209,210,162,123,46,158,43,191,72,126,166,95,178,207,195,244,69,49,199,245,27,58,169,199,125,183,159,204,47,25,113,253,102,191,110,31,169,41,103,234,177,98,166,
+196,95,99,2,198,246,82,219,94,111,156,8,105,161,5,102,38,16,128,211,19,66,3,78,51,89,195,194,63,181,153,109,23,71,82,90,67,93,101,203,70,227,201,37,203,78,43,86,151,239,127,126,31,169,169,250,228,165,176,199,180,177,179,232,
+165,104,164,45,20,133,160,15,160,15,160,2,4,80,64,128,2,58,93,201,52,211,248,122,10,248,54,250,219,243,31,173,54,255,10,116,237,253,113,77,77,138,68,196,196,136,152,145,18,34,68,72,137,0,1,27,8,216,136,77,208,155,180,222,
+83,94,137,188,191,121,82,158,201,171,21,254,242,127,252,27,226,141,204,246,150,47,145,115,88,137,23,92,199,152,0,53,136,15,177,15,177,15,177,137,0,0,47,221,15,223,82,61,10,127,114,174,0,11,202,50,47,145,124,139,228,67,228,88,
+196,224,36,138,155,58,6,213,106,89,165,28,128,3,11,100,174,72,235,229,207,243,25,115,135,58,47,58,52,169,9,24,144,0,98,198,248,83,134,196,74,81,105,11,66,208,179,237,69,172,29,101,178,219,149,178,171,234,182,90,246,38,85,243,
+202,31,170,13,47,243,16,0,0,68,161,16,40,82,218,128,9,101,56,141,157,122,240,237,171,249,101,250,250,254,169,63,69,148,63,84,3,231,233,180,183,37,19,161,129,98,254,145,178,89,138,185,138,90,185,106,90,228,155,53,163,106,228,214,
+225,92,161,94,192,3,221,119,95,32,0,0,0,0,2,57,199,57,195,190,105,251,127,109,223,209,246,141,7,108,122,118,195,159,230,127,108,0,3,247,112,156,183,102,197,41,60,194,149,51,105,210,105,154,239,220,153,177,222,153,199,56,153,63,
+116,128,13,205,242,160,132,147,162,122,83,22,153,73,121,73,12,74,90,54,47,176,59,60,237,29,175,151,63,204,100,185,112,178,87,38,203,150,79,236,0,8,127,199,252,78,255,141,200,3,91,57,10,254,204,135,184,220,195,94,165,113,159,58,
+56,201,57,161,79,71,201,104,242,165,74,243,90,190,69,72,93,114,74,189,192,5,170,73,192,62,169,39,11,201,207,164,245,84,183,39,24,106,137,137,0,0,0,0,0,3,85,141,228,88,171,164,82,174,132,168,133,92,146,223,172,171,151,125,
+156,206,107,66,87,197,200,146,255,23,47,48,0,0,0,0,185,137,144,121,144,121,144,71,6,50,71,6,50,71,8,185,185,73,253,120,163,161,45,113,34,246,143,12,255,170,253,77,252,21,213,232,148,230,212,146,126,220,167,48,154,154,158,138,
+121,192,201,230,65,188,100,186,222,232,184,69,209,180,109,40,200,0,5,229,124,92,137,94,192,127,151,141,31,220,254,116,140,140,63,111,121,64,222,70,242,55,145,188,139,56,107,73,16,247,4,145,75,94,76,232,90,242,6,248,188,128,89,16,
+247,94,90,164,146,83,210,210,183,20,195,89,112,222,85,253,224,2,253,99,214,192,94,208,252,203,246,233,86,203,8,120,86,39,133,202,229,193,8,163,101,194,249,121,191,110,92,31,108,86,248,17,47,219,9,103,237,45,161,251,116,244,77,82,
+99,114,15,107,91,245,214,78,211,139,20,178,28,4,45,82,212,127,235,234,189,186,184,45,63,92,167,162,148,224,242,156,48,26,216,224,242,156,184,45,138,214,53,243,197,146,142,92,106,182,27,165,146,86,199,109,45,43,98,137,142,186,191,92,
+250,90,231,29,127,95,12,127,62,61,160,49,189,181,64,254,186,31,191,2,29,208,253,122,21,182,167,211,8,97,104,91,107,41,137,91,108,148,91,108,191,182,216,0,27,168,23,198,192,0,35,109,128,142,192,0,0,15,252,195,250,246,136,117,
+176,127,80,35,213,44,164,68,133,234,68,48,242,189,80,245,150,238,191,174,235,2,184,234,0,98,184,234,31,142,161,248,234,31,142,162,61,64,134,210,218,27,57,28,219,26,240,109,138,242,127,104,176,93,138,89,125,63,93,70,34,28,2,152,
+87,205,10,111,237,253,238,254,22,110,30,197,53,99,246,203,109,159,109,131,237,180,118,190,194,251,46,223,152,230,219,20,179,246,166,31,250,144,0,231,252,109,130,149,237,219,245,221,191,153,79,228,128,47,250,134,252,199,235,186,181,138,225,58,
+217,72,11,214,194,61,127,143,184,117,0,0,63,143,62,169,96,35,213,45,115,96,45,14,187,126,98,83,234,5,250,199,174,31,215,1,253,108,87,175,230,77,142,26,137,134,63,190,78,189,33,208,63,182,31,191,83,250,245,221,45,191,108,63,
+49,30,159,152,143,78,183,199,81,124,108,159,182,193,196,128,189,161,215,182,39,148,54,199,155,101,132,160,137,134,92,20,136,101,231,30,206,23,200,115,218,95,182,75,33,133,142,34,228,43,69,178,82,216,228,214,54,74,167,105,194,121,213,229,
+56,84,225,10,21,116,120,37,150,130,29,188,33,85,203,245,181,74,148,119,37,169,83,209,108,155,33,142,220,15,10,193,222,112,216,254,139,131,251,120,43,175,145,9,103,237,72,254,103,164,127,50,0,31,214,218,246,217,40,243,208,181,177,218,
+97,96,19,185,105,2,184,75,116,134,41,133,178,82,209,178,148,165,148,169,178,150,178,152,152,88,5,45,219,193,105,189,107,251,221,246,75,126,183,124,76,72,133,148,175,110,223,174,237,252,202,127,36,0,0,109,128,189,182,0,1,27,108,0,
+142,194,251,94,219,11,184,70,217,8,236,0,0,92
@@ -0,0 +1 @@
+0,2,128,4,12,85,30,116,14,134,1,0,138,2,2,20,13,255,236,254,53,249,13,126,171,246,11,203,203,219,221,250,7,240,23,229,191,65,249,105,49,38,172,75,47,200,63,85,251,13,224,0
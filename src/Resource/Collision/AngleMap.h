@@ -0,0 +1,4 @@
+255,0,136,144,160,176,184,196,0,0,0,0,208,0,0,0,252,252,252,252,252,252,252,252,248,248,248,248,240,240,208,208,212,224,224,200,252,248,240,234,230,224,224,236,204,240,200,200,218,214,200,208,216,232,4,240,208,196,122,108,106,244,84,0,
+16,20,22,24,24,24,28,28,32,36,44,40,88,88,255,255,224,34,96,84,32,255,32,0,248,248,248,248,28,20,8,8,6,4,2,255,252,252,252,248,244,240,236,232,224,188,180,172,160,148,140,132,16,255,255,255,4,4,212,212,4,6,8,12,
+14,12,20,16,12,12,8,6,4,4,120,108,96,84,72,255,255,68,112,88,255,228,208,208,4,208,16,36,56,255,255,16,32,48,12,20,32,44,52,124,112,88,72,132,136,144,152,156,160,176,184,188,40,24,32,232,244,32,24,128,128,132,136,136,
+140,144,148,148,140,140,136,132,132,128,128,140,144,152,168,168,176,184,192,8,24,48,132,136,144,152,168,176,180,184,188,16,32,48,8,10,12,16,228,236,228,232,232,232,244,216,236,244,250,252,56,56,56,56,228,0,0,0,0,224,32,160,96,255
@@ -0,0 +1,64 @@
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,254,254,254,254,253,253,253,253,252,252,252,251,251,251,250,250,249,249,248,248,247,247,246,246,245,245,244,244,243,242,242,241,
+0,255,255,254,253,252,251,250,249,248,247,246,245,244,243,241,0,255,253,252,250,248,246,244,242,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,0,254,251,248,244,16,16,0,0,0,0,0,0,0,0,0,0,0,0,0,1,5,9,
+8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+0,0,0,0,0,0,0,1,3,6,8,11,14,16,16,16,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,8,8,8,8,8,8,8,8,
+9,9,9,9,9,9,9,9,10,10,10,10,10,10,10,10,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,13,13,13,13,13,13,13,13,14,14,14,14,14,14,14,14,15,15,15,15,15,15,15,15,16,16,16,16,16,16,16,16,
+1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,6,6,6,6,7,7,7,7,8,8,8,8,9,9,9,9,10,10,10,10,11,11,11,11,12,12,12,12,13,13,13,13,14,14,14,14,15,15,15,15,16,16,16,16,
+1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13,14,14,15,15,16,16,2,4,6,8,10,12,14,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,2,4,6,8,10,12,14,16,
+4,5,7,9,11,13,15,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,1,3,4,5,6,8,9,10,12,13,15,16,16,0,0,0,0,0,0,0,0,0,0,0,0,4,8,12,16,
+1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,3,3,3,3,3,4,4,4,4,5,5,5,6,6,6,7,7,7,8,8,8,9,9,10,10,11,11,12,12,13,13,14,15,15,16,16,16,16,16,16,16,16,16,16,16,16,16,
+0,0,0,0,0,1,2,2,3,4,5,5,6,7,8,9,10,11,11,12,13,15,16,16,16,16,16,16,16,16,16,16,0,0,1,1,2,3,4,5,6,7,8,9,10,11,12,13,4,5,5,6,6,7,8,8,9,10,10,11,12,13,13,14,
+0,0,0,0,0,0,2,5,7,10,13,16,16,16,16,16,12,13,13,13,14,14,15,15,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,0,0,2,6,12,16,16,0,0,0,0,0,0,0,2,5,9,13,16,16,16,16,16,
+0,0,0,0,0,0,0,1,2,3,4,6,7,8,10,11,13,15,16,16,16,16,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,0,3,6,10,15,16,16,7,8,10,12,14,16,16,16,16,16,16,16,16,16,16,16,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,3,5,0,0,0,0,0,0,0,0,0,0,0,1,1,2,3,3,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,11,11,12,12,13,13,14,14,15,16,16,16,16,16,16,16,
+0,0,0,2,4,6,8,10,13,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,16,16,16,16,16,16,16,16,16,241,241,241,241,241,241,242,242,242,242,243,243,243,244,244,244,245,245,246,246,247,247,248,248,
+249,249,250,251,251,252,253,253,254,255,0,0,0,0,0,0,5,5,5,6,6,6,7,7,7,8,8,9,9,9,10,10,16,16,16,16,16,16,16,16,242,244,246,248,251,254,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+12,11,11,11,10,10,9,9,8,8,8,7,7,6,6,6,5,4,4,3,3,2,2,1,1,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,15,15,14,14,13,13,12,11,11,10,10,9,8,8,7,7,6,5,5,4,3,
+3,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,16,15,15,14,13,13,12,11,10,10,9,8,7,7,6,5,4,3,3,2,1,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,15,14,13,13,12,11,
+10,9,8,7,6,5,4,3,2,1,0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,15,13,12,11,10,8,16,14,12,10,8,6,5,3,1,0,0,0,0,0,0,0,7,6,4,3,2,1,0,0,0,0,0,0,0,0,0,0,
+16,16,16,16,16,16,16,16,16,16,16,16,16,16,241,242,243,245,246,247,248,249,250,251,253,254,255,0,0,0,0,0,16,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,16,16,16,16,16,16,16,15,14,13,12,11,9,8,7,6,16,16,16,16,16,16,16,16,16,16,16,241,242,243,244,245,246,247,248,250,252,253,254,0,0,0,0,0,0,0,0,0,
+5,4,3,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,10,14,14,15,15,15,15,16,16,16,16,16,16,15,14,13,12,11,10,9,8,7,6,15,15,15,15,16,16,16,16,16,16,16,16,16,16,16,16,
+0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,6,6,6,6,7,7,7,7,8,8,8,8,9,9,9,9,10,10,10,10,11,11,11,11,12,12,12,12,13,13,13,13,14,14,14,14,
+5,4,3,3,2,1,0,0,0,0,0,0,0,0,0,0,13,12,11,11,10,9,9,8,8,7,6,6,5,5,4,4,14,14,14,13,13,13,12,12,12,12,11,11,11,10,10,10,10,9,9,9,9,9,8,8,8,8,7,7,7,7,7,6,
+6,6,6,6,6,5,5,5,5,5,5,4,4,4,4,4,4,4,4,4,3,3,3,3,3,3,3,3,3,3,3,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,
+0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,4,4,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,6,7,7,7,7,7,8,8,8,8,8,9,9,9,9,
+10,10,10,10,11,11,11,11,12,12,12,13,13,13,14,14,14,15,15,15,16,16,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,8,8,9,10,10,11,12,13,13,14,15,16,
+0,1,2,3,4,5,6,7,8,9,10,11,13,14,15,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,249,16,0,0,0,0,0,0,0,0,0,254,251,248,244,16,16,16,254,253,251,250,248,246,244,242,16,16,16,16,16,16,16,16,
+255,254,253,252,252,251,250,249,248,247,246,245,243,242,241,16,248,248,247,247,246,246,245,245,244,244,243,242,242,241,16,16,253,253,253,253,252,252,252,252,251,251,251,250,250,250,249,249,255,255,255,255,255,255,255,255,255,254,254,254,254,254,254,254,
+4,3,3,3,2,2,2,1,1,1,0,0,0,0,0,0,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,251,250,249,16,16,16,16,0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,
+16,16,16,16,16,16,16,16,16,16,16,16,16,16,15,15,15,15,15,15,15,15,14,14,14,14,14,14,14,14,14,13,0,0,0,0,0,0,0,0,0,0,0,2,3,5,6,8,1,3,4,6,7,9,10,12,13,15,16,16,16,16,16,16,
+16,16,15,15,15,15,15,15,15,15,15,15,15,15,14,14,14,14,14,14,14,14,14,13,13,13,13,13,13,13,13,12,12,12,12,12,12,11,11,11,11,11,11,11,10,10,10,10,9,9,9,9,9,8,8,8,8,8,7,7,7,7,6,6,
+6,6,5,5,5,4,4,4,4,3,3,3,2,2,2,1,16,16,16,16,16,15,15,14,14,14,13,13,12,12,11,11,10,10,9,8,8,7,7,6,5,4,4,3,2,2,1,0,16,15,14,14,13,12,12,11,10,10,9,9,8,8,7,7,
+6,6,5,5,4,4,3,3,3,2,2,1,1,1,0,0,16,15,15,15,14,14,14,13,13,13,13,12,12,12,11,11,11,11,10,10,10,10,9,9,9,9,9,8,8,8,8,8,7,7,7,7,6,6,6,6,6,6,6,5,5,5,5,5,
+5,4,4,4,4,4,4,4,4,3,3,3,3,3,3,3,3,3,2,2,2,2,2,2,2,2,2,2,2,2,1,1,248,248,248,248,248,248,248,249,249,249,249,250,250,250,251,251,251,252,252,253,253,254,255,255,0,0,0,0,0,0,0,0,
+16,16,16,16,16,16,16,16,16,241,242,243,244,245,246,247,248,250,251,253,255,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,16,242,245,249,0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,
+16,16,16,16,16,16,16,16,16,16,16,248,252,254,255,255,16,16,16,16,16,16,16,16,242,244,249,0,0,0,0,0,16,16,16,241,241,241,241,242,242,243,243,244,244,245,246,246,247,248,249,250,252,253,254,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,12,13,14,15,15,16,16,16,16,16,16,16,16,16,16,16,0,2,4,6,8,10,12,14,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,2,4,6,8,10,12,14,
+13,13,13,13,13,13,13,12,12,12,12,12,12,11,11,11,0,0,0,0,0,0,0,1,2,3,5,6,8,10,12,14,15,15,15,14,14,14,14,13,13,12,12,11,11,10,9,9,8,7,6,5,3,2,0,0,0,0,0,0,0,0,0,0,
+16,16,16,16,16,16,16,14,12,8,2,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,3,1,0,0,0,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,16,16,16,16,16,16,15,15,15,15,14,14,14,13,13,12,
+12,11,10,10,9,8,7,6,5,4,2,1,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,16,15,13,10,6,16,16,16,16,16,16,16,15,15,15,15,15,14,14,14,14,13,13,12,12,12,11,11,10,9,9,8,8,7,6,5,4,
+4,3,2,0,0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,15,14,13,12,10,8,7,5,2,0,0,0,16,16,16,16,16,16,16,16,16,16,16,16,16,16,12,7,248,248,248,248,248,248,248,248,248,248,248,249,249,249,249,249,
+249,249,249,250,250,250,251,251,251,252,252,253,253,254,255,255,16,241,242,243,244,245,246,247,248,250,251,253,255,0,0,0,16,16,16,16,16,16,16,16,16,16,16,16,16,242,245,249,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,
+255,254,254,254,254,254,254,254,253,253,253,253,252,252,252,252,251,251,251,250,250,250,249,249,248,248,247,247,246,246,245,245,244,244,243,242,242,241,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,255,254,253,252,252,251,250,249,
+248,247,246,245,243,242,241,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,254,253,251,250,248,246,244,242,0,254,251,248,244,16,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,249,16,16,16,16,16,16,16,16,16,
+12,10,9,8,6,4,2,0,0,0,0,0,0,0,0,0,8,8,7,7,6,6,5,4,3,3,2,1,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,16,16,15,14,13,13,13,14,14,15,16,16,16,16,16,16,16,16,16,16,16,
+9,9,10,10,11,11,12,12,13,13,14,14,15,15,15,15,15,15,15,15,15,14,14,13,13,12,11,10,9,7,5,0,16,16,15,15,14,14,13,13,13,12,11,10,9,7,5,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,254,254,254,254,254,254,254,254,254,254,254,254,253,253,253,253,253,253,253,253,253,252,252,252,252,252,252,252,252,251,251,251,251,251,251,250,250,250,250,250,250,250,249,249,249,249,248,248,248,248,248,247,247,247,247,247,246,246,246,246,245,245,
+245,245,244,244,244,243,243,243,243,242,242,242,241,241,241,16,0,0,255,255,255,254,254,253,253,253,252,252,251,251,250,250,249,249,248,248,247,247,246,246,245,244,244,243,242,242,241,16,0,255,254,254,253,252,252,251,250,249,249,248,248,247,246,246,
+245,245,244,244,243,243,242,242,242,241,241,16,16,16,16,16,255,254,254,254,253,253,253,252,252,252,252,251,251,251,250,250,250,250,249,249,249,249,248,248,248,248,248,247,247,247,247,247,246,246,246,246,245,245,245,245,245,245,245,244,244,244,244,244,
+244,243,243,243,243,243,243,243,243,242,242,242,242,242,242,242,242,242,241,241,241,241,241,241,241,241,241,241,241,241,16,16,248,248,248,248,248,248,248,248,247,247,247,247,247,247,247,247,245,245,245,245,244,244,244,244,243,243,243,242,242,242,241,241,
+0,0,255,255,254,254,253,253,252,252,251,250,250,249,248,248,247,246,245,244,244,243,242,241,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,255,254,253,251,250,249,248,246,245,243,242,16,16,16,16,16,16,16,16,16,16,16,16,
+0,0,0,0,0,254,252,250,248,246,243,16,16,16,16,16,0,0,0,0,0,0,0,0,0,0,0,0,252,248,241,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,16,16,16,16,16,16,16,15,15,15,15,14,14,14,13,13,
+13,12,12,11,11,10,9,9,8,7,6,5,4,3,2,1,16,14,13,11,9,6,3,0,0,0,0,0,0,0,0,0,247,246,246,246,246,246,246,246,245,245,245,245,244,244,244,244,243,243,243,242,242,242,241,241,16,16,16,16,16,16,16,16,
+0,0,0,0,0,0,0,0,0,0,255,255,254,254,253,253,252,252,251,250,250,249,248,248,247,246,245,244,244,243,242,241,0,255,254,253,251,250,249,248,246,245,243,242,16,16,16,16,0,0,0,0,0,0,0,0,0,0,0,0,0,254,252,250,
+248,246,243,16,16,16,16,16,16,16,16,16,16,16,16,16,0,0,0,0,252,248,241,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,248,16,16,16,16,16,16,16,16,15,15,15,14,14,14,13,13,13,12,12,11,11,10,9,9,
+8,7,6,5,4,3,2,1,0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,14,13,11,9,6,3,0,11,11,11,10,10,10,10,10,9,9,9,9,9,8,8,8,8,8,7,7,7,7,6,6,6,6,5,5,5,5,4,4,
+4,4,3,3,3,2,2,2,1,1,1,0,0,0,0,0,15,14,14,14,13,13,13,12,12,12,11,11,10,10,9,9,6,7,7,8,9,10,10,11,12,13,13,14,15,16,16,16,0,0,0,0,0,0,0,0,0,1,1,2,3,4,4,5,
+10,11,11,12,13,14,14,15,16,16,16,16,16,16,16,16,0,0,0,0,1,2,2,3,4,5,5,6,7,8,8,9,14,15,15,16,16,16,16,16,16,16,16,16,16,16,16,16,2,3,3,4,5,6,6,7,8,9,9,10,11,12,12,13,
+7,7,7,8,8,8,9,9,9,10,10,10,11,11,12,12,3,4,6,7,9,10,12,13,15,16,16,16,16,16,16,16,5,6,7,7,8,8,9,10,10,11,12,12,13,13,14,15,6,7,7,7,8,8,8,9,9,9,10,10,10,10,11,11,
+11,12,12,12,12,12,12,13,13,13,13,13,13,14,14,14,14,14,14,14,14,14,15,15,15,15,15,15,15,15,15,15,14,10,6,2,0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,14,10,6,2,0,0,0,0,0,0,0,0,
+16,16,16,16,16,16,16,16,14,10,6,2,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,16,14,10,6,2,11,12,13,14,15,15,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16
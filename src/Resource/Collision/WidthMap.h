@@ -0,0 +1,64 @@
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,12,8,5,2,0,0,0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,14,12,10,8,6,4,3,1,0,
+15,13,12,11,10,9,8,7,6,5,4,3,2,1,1,0,15,14,14,13,12,12,11,11,10,10,9,9,8,8,7,7,6,6,5,5,5,4,4,4,3,3,3,3,2,2,2,2,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,
+0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,
+3,3,4,4,4,5,5,5,6,6,7,7,7,8,8,9,0,0,0,16,16,16,16,16,16,16,16,16,16,16,16,16,0,0,16,16,16,16,16,16,16,16,16,16,16,16,16,16,0,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,16,0,0,0,0,0,0,0,0,0,0,0,0,8,16,16,16,0,0,0,0,0,0,0,0,0,0,8,16,16,16,16,16,0,0,0,0,0,0,0,0,8,16,16,16,16,16,16,16,
+0,0,0,0,0,0,8,16,16,16,16,16,16,16,16,16,0,0,0,0,8,16,16,16,16,16,16,16,16,16,16,16,0,0,8,16,16,16,16,16,16,16,16,16,16,16,16,16,8,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+0,0,0,0,0,0,0,0,0,0,0,0,4,8,12,16,0,0,0,0,0,0,0,0,4,8,12,16,16,16,16,16,0,0,0,0,4,8,12,16,16,16,16,16,16,16,16,16,4,8,12,16,16,16,16,16,16,16,16,16,16,16,16,16,
+0,0,0,0,0,0,0,0,2,4,6,8,10,12,14,16,2,4,6,8,10,12,14,16,16,16,16,16,16,16,16,16,9,9,10,10,11,11,12,12,13,13,14,14,15,15,16,16,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,
+9,10,10,11,11,12,12,13,13,14,14,15,16,16,16,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,2,3,3,4,5,5,6,7,8,8,9,10,11,12,12,13,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,16,0,0,0,0,0,0,0,0,0,0,3,6,10,15,16,16,0,0,0,2,4,6,8,10,13,16,16,16,16,16,16,16,13,15,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+0,0,0,0,0,0,0,1,2,3,4,6,7,8,10,11,10,11,11,12,13,15,16,16,16,16,16,16,16,16,16,16,0,0,0,1,2,3,4,5,6,7,8,9,10,11,12,14,0,0,1,3,4,5,7,8,10,11,13,15,16,16,16,16,
+5,5,5,6,6,6,7,7,7,8,8,9,9,9,10,10,8,10,12,15,16,16,16,16,16,16,16,16,16,16,16,16,2,2,2,2,3,3,3,3,3,3,4,4,4,4,5,5,5,5,5,6,6,6,6,7,7,7,7,8,8,8,9,9,
+0,0,0,0,0,1,2,2,3,4,5,5,6,7,8,9,14,15,15,16,16,16,16,16,16,16,16,16,16,16,16,16,2,3,3,3,3,3,4,4,4,4,5,5,5,6,6,6,11,11,12,12,13,13,14,14,15,16,16,16,16,16,16,16,
+0,0,0,0,0,0,0,0,0,0,0,1,1,2,2,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,7,8,10,12,14,16,16,16,16,16,16,16,16,16,16,16,
+7,7,7,8,8,8,9,9,10,10,11,11,12,12,13,13,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,16,16,16,16,16,16,16,16,16,16,16,16,16,16,242,248,16,16,16,16,16,16,16,16,242,244,246,248,251,254,0,0,
+246,247,248,250,251,253,254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,5,7,10,13,16,16,16,16,16,242,242,243,243,243,244,244,244,245,245,246,246,247,247,248,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,254,
+0,0,0,0,255,252,250,248,245,243,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,0,0,255,253,251,249,247,245,243,241,16,16,16,16,16,16,16,16,16,16,16,16,16,0,0,0,255,254,252,250,249,247,245,244,242,241,16,16,16,
+0,0,0,0,0,0,0,0,0,0,0,0,0,255,254,252,251,249,248,246,245,244,242,241,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,254,253,252,251,249,248,247,246,245,244,242,241,16,16,16,16,16,16,16,16,16,16,16,
+0,0,0,0,0,0,255,254,253,252,251,250,249,248,247,246,246,245,245,244,243,242,241,241,16,16,16,16,16,16,16,16,255,255,254,254,253,253,252,252,251,251,250,249,249,248,248,247,0,0,0,0,0,0,0,0,0,255,254,254,253,252,251,250,
+16,16,16,16,16,16,16,16,16,16,16,16,16,16,241,242,245,246,247,248,248,249,250,251,252,253,254,255,255,0,0,0,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,249,248,247,246,245,244,244,243,242,241,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,241,242,243,244,245,249,249,250,251,252,252,253,253,254,255,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,255,254,253,252,251,0,4,8,8,8,8,8,8,7,7,7,7,6,6,6,6,250,249,248,247,246,245,244,243,242,241,16,16,16,16,16,16,12,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,8,0,0,0,0,0,0,0,0,0,0,4,8,12,16,16,16,0,0,0,0,0,0,4,8,12,16,16,16,16,16,16,16,0,0,4,8,12,16,16,16,16,16,16,16,16,16,16,16,
+0,0,0,0,0,0,0,0,0,0,0,255,254,252,251,250,0,0,0,255,254,252,251,249,247,246,244,242,16,16,16,16,0,0,253,250,246,243,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,255,250,246,241,16,16,16,16,16,16,
+0,0,0,0,0,0,0,0,0,0,251,245,16,16,16,16,0,0,0,0,0,0,0,0,0,0,0,0,252,241,16,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,16,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,7,16,16,0,0,0,0,0,0,0,0,0,0,3,9,16,16,16,16,0,0,0,0,0,0,0,4,9,14,16,16,16,16,16,16,
+0,0,2,5,8,12,16,16,16,16,16,16,16,16,16,16,12,15,16,16,16,16,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,0,0,1,3,5,7,9,1,2,3,5,6,7,9,10,12,13,15,16,16,16,16,16,
+1,2,3,4,4,5,6,7,8,9,10,11,12,13,14,15,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,7,7,6,6,6,5,5,5,4,4,4,4,3,3,3,3,16,16,15,14,14,13,12,12,11,11,10,10,9,9,8,8,
+16,15,14,13,11,10,9,8,7,6,5,4,4,3,2,1,16,16,16,16,16,16,16,16,14,12,10,8,6,5,3,2,16,16,16,12,8,5,2,0,0,0,0,0,0,0,0,0,16,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,255,252,249,246,16,16,16,16,0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,7,6,5,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+242,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,0,250,241,16,16,16,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,1,1,2,3,3,4,5,5,6,7,7,8,9,9,10,11,11,12,13,13,14,15,15,16,
+254,242,16,16,16,16,16,16,16,16,16,16,16,16,16,16,0,0,249,241,16,16,16,16,16,16,16,16,16,16,16,16,0,0,0,0,251,244,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,251,246,242,16,16,16,16,16,16,
+0,0,0,0,0,0,0,0,0,0,254,251,247,244,241,16,251,249,246,244,242,16,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,254,253,251,249,248,247,245,244,242,241,255,254,252,251,249,248,246,244,242,16,16,16,16,16,16,16,
+0,0,0,0,0,0,0,0,0,0,254,252,250,247,245,242,255,252,249,245,242,16,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,254,250,245,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,252,245,16,16,16,16,16,
+0,0,0,0,0,0,0,0,0,0,0,255,247,16,16,16,0,0,0,0,0,0,0,0,0,0,0,0,0,254,242,16,16,16,16,16,16,242,245,249,0,0,0,0,0,0,0,0,248,250,251,253,255,0,0,0,0,0,0,0,0,0,0,0,
+16,16,16,16,16,16,16,16,16,241,242,243,244,245,246,247,251,252,252,253,253,254,255,255,0,0,0,0,0,0,0,0,248,248,248,248,248,248,248,249,249,249,249,250,250,250,251,251,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,
+16,242,243,243,244,244,244,244,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,246,246,246,246,246,247,247,248,248,16,16,16,16,16,16,16,16,16,16,242,243,245,247,249,253,249,249,250,251,252,252,253,254,255,0,0,0,0,0,0,0,
+0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,11,13,14,15,16,16,16,16,16,16,16,16,16,16,16,16,8,8,9,9,10,10,11,11,12,12,13,13,14,14,15,15,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,
+0,0,0,249,243,16,16,16,16,16,16,16,16,16,16,16,0,0,1,1,2,2,3,3,4,4,5,6,6,7,8,9,0,253,249,247,245,243,242,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,255,254,253,252,252,251,250,250,
+249,249,248,248,247,247,247,247,246,246,246,246,246,246,245,245,245,245,245,245,245,245,245,245,245,245,245,245,245,244,244,243,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,250,246,243,241,16,16,16,16,16,16,16,16,16,16,16,16,
+0,0,0,0,255,254,252,251,250,249,248,247,246,246,245,244,244,243,243,242,242,242,241,241,241,241,16,16,16,16,16,16,249,244,16,16,16,16,16,16,16,16,16,16,16,16,16,16,0,0,0,254,251,249,248,246,244,243,242,241,16,16,16,16,
+0,0,0,0,0,0,0,0,0,0,0,0,255,254,253,253,252,251,250,249,248,248,247,247,246,245,245,244,244,244,243,243,242,242,242,242,241,241,241,241,241,16,16,16,16,16,16,16,16,16,16,16,16,16,16,245,0,0,0,0,0,0,0,0,
+16,242,243,245,247,250,253,0,0,0,0,0,0,0,0,0,243,244,244,245,245,246,247,247,248,249,250,251,252,253,254,255,16,16,16,16,16,16,16,241,241,241,241,242,242,242,243,243,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+16,15,8,4,0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,16,13,10,8,6,4,2,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,16,14,13,11,10,8,7,6,5,3,2,1,0,0,0,0,0,0,0,0,0,
+16,16,16,16,16,16,16,16,15,14,13,12,12,11,10,9,8,8,7,6,6,5,4,4,3,3,2,2,1,1,0,0,15,15,14,14,14,13,13,13,12,12,12,12,11,11,11,11,10,10,10,10,10,10,10,9,9,9,9,9,9,9,9,9,
+0,0,0,0,255,255,254,253,252,252,251,251,250,250,249,249,0,0,0,0,0,0,0,0,254,252,250,249,248,246,245,244,243,242,241,16,16,16,16,16,16,16,16,16,16,16,16,16,11,12,14,16,16,16,16,16,16,16,16,16,16,16,16,16,
+0,4,6,8,10,12,14,16,16,16,16,16,16,16,16,16,0,251,249,247,246,245,244,243,243,242,242,241,241,241,241,241,254,252,250,247,246,245,244,243,243,242,242,241,241,241,241,241,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+16,14,2,0,0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,9,1,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,16,11,4,0,0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,11,6,2,0,0,0,0,0,
+16,16,16,16,16,16,16,16,16,16,16,14,11,7,4,1,14,11,9,6,4,2,0,0,0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,14,12,10,8,7,5,4,2,1,15,14,12,11,9,8,7,5,3,2,0,0,0,0,0,0,
+16,16,16,16,16,16,16,16,16,16,16,14,12,10,7,5,16,15,12,9,5,2,0,0,0,0,0,0,0,0,0,0,16,16,16,16,16,16,14,10,5,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,12,5,0,0,0,0,
+16,16,16,16,16,16,16,16,16,16,16,16,15,7,0,0,16,16,16,16,16,16,16,16,16,16,16,16,16,16,14,2,16,16,16,16,16,16,16,16,8,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,12,8,5,2,0,
+14,12,10,8,6,5,3,2,0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,15,14,13,11,10,9,8,7,6,5,4,4,3,2,1,0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,15,14,14,13,12,12,
+11,11,10,10,9,9,8,8,7,7,6,6,6,5,5,5,4,4,4,4,3,3,3,3,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,249,245,242,16,16,16,16,16,16,16,16,16,16,16,16,16,
+0,0,0,255,253,251,250,248,247,246,245,244,243,242,241,16,255,255,254,253,253,252,252,251,251,251,250,250,250,249,249,249,16,16,16,16,16,16,16,16,16,15,8,4,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,16,16,13,10,8,
+6,4,2,0,0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,14,13,11,10,8,7,6,5,3,2,1,0,15,14,13,12,12,11,10,9,8,8,7,6,6,5,4,4,3,3,2,2,1,1,0,0,0,0,0,0,0,0,0,0,
+16,16,16,16,16,16,16,16,15,15,14,14,14,13,13,13,12,12,12,12,11,11,11,11,10,10,10,10,10,10,10,9,9,9,9,9,9,9,9,9,8,8,8,8,8,8,8,8,0,253,250,247,245,243,242,16,16,16,16,16,16,16,16,16,
+0,0,0,0,0,0,0,0,255,254,253,252,251,250,249,248,247,247,246,245,245,244,244,243,243,243,242,242,242,241,241,241,0,0,0,0,0,253,248,243,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,254,250,246,242,16,16,16,16,
+0,0,0,0,0,0,0,0,0,0,0,0,254,251,248,245,0,255,252,249,246,244,242,16,16,16,16,16,16,16,16,16,3,4,5,7,8,9,11,12,13,15,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,0,0,1,3,4,5,7,
+8,9,11,12,13,15,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,1,3,4,5,7,8,9,11,12,13,15,16,16,16,16,16,16,16,16,16,16,16,16,16,16,0,0,0,1,3,4,5,7,8,9,11,12,13,15,16,16,
+0,0,0,0,2,4,7,10,13,16,16,16,16,16,16,16,7,8,8,9,10,10,11,12,12,13,14,14,15,16,16,16,0,1,2,4,6,7,9,10,12,14,15,16,16,16,16,16,0,0,0,0,0,2,6,9,12,15,16,16,16,16,16,16,
+0,0,3,9,15,16,16,16,16,16,16,16,16,16,16,16,0,10,16,16,16,16,16,16,16,16,16,16,16,16,16,16,0,0,255,255,255,255,254,254,254,254,253,253,253,253,252,252,252,252,251,251,251,251,250,250,250,250,249,249,249,249,248,248,
+248,248,247,247,247,247,246,246,246,246,245,245,245,245,244,244,244,244,243,243,243,243,242,242,242,242,241,241,241,241,16,16,10,12,13,14,15,16,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16
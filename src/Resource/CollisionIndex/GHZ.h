@@ -0,0 +1,7 @@
+0,255,26,0,0,0,26,0,29,28,255,255,9,20,11,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,16,17,18,19,20,21,22,24,25,26,27,255,255,255,255,255,255,0,28,29,255,255,255,
+255,0,19,9,255,10,255,255,255,20,21,22,22,24,25,26,27,255,28,29,111,10,26,117,118,119,0,0,255,0,255,255,0,0,0,0,0,0,20,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,255,0,0,255,255,
+255,255,255,0,255,0,26,26,0,26,20,0,255,255,255,255,0,36,37,38,39,255,255,0,0,40,41,255,255,58,59,60,48,49,255,255,82,83,56,255,62,50,255,78,79,255,255,82,83,76,77,0,0,20,255,0,255,21,0,0,0,255,255,0,
+20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,14,29,28,0,24,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,255,255,255,255,255,255,255,255,255,0,111,110,109,255,112,110,255,255,109,106,107,108,105,255,0,0,0,0,0,0,0,104,0,0,0,0,0,0,0,0,102,103,0,0,0,0,0,0,0,100,101,102,103,104,105,106,107,108,109,110,111,112,113,
+114,115,100,101,26,0,0,26,0,251,251,253,252,252,0,0,21,255,255,9,10,0,0,255,255,0
@@ -0,0 +1,4 @@
+0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,124,125,126,127,128,0,129,130,131,132,133,134,135,136,137,1,187,188,189,190,191,192,193,194,195,196,0,197,198,199,200,201,80,28,29,31,30,0,0,
+0,0,0,0,0,0,0,0,0,0,0,28,29,0,80,0,31,0,30,0,0,36,37,38,255,255,255,255,255,0,117,117,255,255,255,255,0,0,0,0,0,0,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0
@@ -0,0 +1,10 @@
+0,25,26,27,255,255,255,27,255,255,255,255,255,255,0,24,25,26,27,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,142,162,163,164,255,159,160,8,255,255,255,255,255,165,255,255,161,8,8,8,255,255,255,166,255,255,160,255,
+255,255,255,255,138,164,255,159,161,158,255,255,158,157,255,165,255,255,111,255,170,140,141,162,163,166,167,168,110,109,255,139,115,114,113,112,255,255,255,255,169,178,255,0,0,255,171,172,173,174,255,179,255,0,0,255,175,176,255,0,0,255,255,255,
+255,255,255,177,255,255,0,158,255,255,255,255,255,255,255,255,158,0,255,255,255,255,0,255,255,255,24,158,255,255,0,0,255,255,255,0,255,158,8,255,255,255,158,158,255,255,0,0,0,255,255,255,255,255,8,8,0,158,255,158,255,255,255,255,
+0,0,0,0,0,0,0,255,0,0,255,255,0,0,0,0,255,255,0,0,0,0,255,0,0,0,255,255,0,0,0,0,255,0,255,255,255,255,0,0,0,0,0,0,255,255,255,255,255,255,255,255,8,255,158,255,255,255,255,255,255,255,28,0,
+15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,15,15,15,15,15,15,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,255,255,204,205,255,206,207,255,208,20,203,255,255,211,212,255,255,213,209,255,255,158,210,255,255,255,255,255,216,217,255,255,255,223,224,202,214,215,255,255,218,255,255,255,225,255,255,219,220,255,221,255,222,255,0,255,255,
+255,255,255,0,0,255,255,255,255,255,255,202,255,0,0,255,255,255,255,255,255,0,255,255,0,0,255,255,0,0,255,255,255,8,0,0,0,0,0,0,0,0,0,115,114,113,112,111,110,109,0,0,0,0,0,0,255,255,255,255,255,255,255,158,
+255,158,255,158,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
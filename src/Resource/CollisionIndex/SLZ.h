@@ -0,0 +1,8 @@
+0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,255,30,255,31,255,24,25,26,27,255,255,255,255,33,231,230,233,232,255,238,234,255,255,255,87,121,152,226,227,228,255,255,255,255,120,229,28,255,255,210,255,35,255,44,255,
+52,51,255,218,251,53,217,251,255,24,61,55,251,57,255,46,255,47,255,33,32,255,34,251,42,76,255,216,43,251,255,36,37,236,45,255,255,255,255,255,255,255,255,255,255,171,2,3,253,255,4,253,255,5,255,6,255,210,255,7,255,12,255,32,
+255,255,36,37,236,45,255,45,236,37,124,125,126,127,128,63,255,255,255,252,159,64,65,255,255,66,67,68,255,255,69,70,255,71,72,255,246,72,255,73,141,255,123,255,252,74,73,75,255,86,92,255,205,40,255,182,93,53,255,255,55,173,116,255,
+255,120,94,95,96,97,98,1,255,255,255,255,255,255,132,239,240,241,231,238,251,255,255,255,224,140,255,255,206,140,255,237,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+158,158,255,255,255,255,81,84,46,0,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,242,255,243,255,244,255,245,255,255,171,2,3,253,255,4,253,255,5,255,6,255,
+210,255,7,255,12,255,32,255,255,45,255,36,33,32,255,34,251,42,76,255,216,43,251,255,255,36,37,45,236,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
@@ -0,0 +1,8 @@
+0,153,255,255,151,255,13,14,15,255,0,0,255,0,0,0,255,255,255,255,255,0,255,0,0,0,255,255,255,255,0,0,0,0,0,0,0,255,255,255,255,0,0,255,0,255,0,255,255,0,255,0,0,0,0,255,0,255,28,29,0,16,17,0,
+0,20,21,22,255,255,23,255,255,0,0,255,255,255,255,255,255,255,255,0,0,255,255,255,255,255,24,25,26,27,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,255,255,255,255,28,29,0,0,0,0,0,0,
+0,0,255,255,0,0,24,25,28,29,28,29,255,14,0,0,28,29,24,25,181,180,143,183,255,143,15,0,183,255,255,255,154,155,154,155,54,255,255,255,255,255,252,156,252,156,255,255,255,255,144,255,255,143,255,143,255,54,0,0,143,255,255,157,
+255,157,144,146,147,145,145,255,0,0,15,28,29,56,48,49,146,147,15,24,25,28,0,40,41,255,255,15,255,255,36,37,38,39,255,255,255,255,15,255,255,255,255,99,255,57,255,255,255,255,255,255,255,255,0,50,148,255,255,255,255,255,255,255,
+251,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,255,255,255,255,0,0,0,0,255,0,255,255,255,255,0,255,15,182,255,150,255,255,15,15,0,0,0,29,255,255,143,0,0,255,28,29,255,143,143,143,0,0,0,0,
+0,0,0,0,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,25,255,255,0,0,0,0,0,0,0,0,255,255,0,0,0,0,15,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+15,255,255,255,255,255,0,15,255,255,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,251,251,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
@@ -0,0 +1 @@
+8,100,40,9,8,79,40,40,8,19,40,9,8,131,40,16,8,67,40,22,8,19,40,21,8,25,40,6,8,50,40,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0
@@ -0,0 +1 @@
+0,7,8,255,8,71,0,194,4,62,0,18,8,26,9,0,8,14,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
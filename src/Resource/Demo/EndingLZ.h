@@ -0,0 +1 @@
+0,4,8,131,0,146,2,9,0,5,2,8,0,4,2,2,0,15,32,6,0,94,32,6,0,37,2,10,0,6,2,8,0,7,2,5,0,16,32,6,0,111,0,0,0,0,0,0
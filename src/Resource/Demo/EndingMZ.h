@@ -0,0 +1 @@
+0,8,4,31,0,10,8,21,40,31,41,2,40,4,32,1,0,4,4,34,0,20,4,25,0,8,4,0,36,7,4,3,0,29,4,83,0,7,8,7,0,104,4,7,0,124,4,8,36,14,4,10,0,28,0,0,0,0,0,0,0,0,0,0
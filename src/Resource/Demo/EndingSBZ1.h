@@ -0,0 +1 @@
+0,37,4,82,0,37,4,35,0,231,4,104,0,13,8,110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
@@ -0,0 +1 @@
+0,6,8,16,0,116,8,47,40,27,8,84,10,6,2,32,0,96,32,29,40,20,8,17,0,9,8,31,0,3,8,6,10,7,2,38,0,48,0,0,0,0,0,0,0,0,0,0
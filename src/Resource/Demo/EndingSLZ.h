@@ -0,0 +1 @@
+0,8,8,237,0,12,2,33,0,164,4,38,36,6,4,66,36,1,4,82,0,0,0,0,0,0,0,0,0,0,0,0
@@ -0,0 +1 @@
+0,23,8,47,0,26,8,28,10,2,2,9,0,7,4,27,0,41,2,75,0,98,2,74,0,74,32,8,40,7,41,34,40,2,32,1,0,55,0,0,0,0,0,0,0,0,0,0
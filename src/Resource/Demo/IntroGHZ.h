@@ -0,0 +1,2 @@
+0,74,8,97,40,11,8,71,40,7,8,59,40,8,8,209,40,16,8,10,0,14,32,18,40,4,8,31,0,11,6,5,4,5,0,4,32,11,40,14,8,32,0,5,32,2,40,18,8,15,0,15,8,11,0,0,32,14,40,4,8,11,0,26,
+8,12,0,6,32,18,40,7,8,119,40,0,32,12,36,4,32,7,40,6,8,4,0,15,8,57,0,17,8,13,40,10,8,80,40,15,8,5,0,20,8,255,8,86,0,255,0,63,8,0,40,14,8,23,0,23,8,5,0,0,0,0,0,0
@@ -0,0 +1,5 @@
+0,9,8,120,0,6,8,6,0,3,32,5,40,17,8,13,0,43,8,2,41,7,9,2,0,7,5,15,0,8,8,13,40,7,8,11,0,40,8,0,9,2,41,2,40,4,8,18,0,9,8,0,41,2,40,4,8,9,0,15,8,12,0,14,
+9,0,41,8,9,2,8,24,0,9,40,0,41,10,9,18,8,0,0,24,41,16,9,16,8,3,0,47,5,6,0,9,8,0,9,1,41,18,9,0,8,5,0,36,8,0,9,0,41,9,40,6,8,10,0,42,8,27,0,23,4,5,0,12,
+8,32,0,4,32,3,0,14,9,4,1,0,0,30,8,5,0,1,32,6,41,1,5,7,0,19,8,5,0,21,32,1,40,2,41,4,9,1,8,0,0,7,8,11,0,25,8,11,40,6,8,5,0,18,8,17,0,12,32,2,40,4,8,4,
+0,21,8,12,0,20,32,4,40,0,8,2,0,24,8,3,0,44,32,2,40,7,8,4,0,36,6,72,4,71,0,10,4,7,0,20,4,68,5,0,4,0,0,21,8,21,10,1,0,8,4,2,5,20,0,1,5,1,37,13,5,27,0,7,
+8,35,9,0,0,7,5,34,37,11,5,82,0,6,8,38,9,1,1,0,0,0,1,0,5,23,37,8,5,26,0,12,8,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0
@@ -0,0 +1,4 @@
+0,38,4,5,0,42,8,27,0,6,4,9,0,6,32,1,40,1,41,2,9,0,8,8,0,6,8,7,0,73,8,11,0,2,32,3,0,13,8,29,0,19,8,6,0,33,8,33,0,6,8,54,0,30,8,26,0,6,32,0,40,4,8,25,
+0,4,4,17,0,31,4,13,0,12,4,30,5,1,4,0,0,9,8,12,0,6,4,5,5,1,4,135,36,7,4,4,0,4,8,13,9,20,8,4,0,3,4,23,36,19,4,10,0,4,9,9,8,2,0,6,4,24,36,11,32,4,0,2,
+4,46,5,1,4,0,0,19,32,20,0,4,8,25,0,16,32,29,36,7,4,14,0,11,32,27,36,5,4,23,36,0,32,24,36,5,4,11,0,8,32,31,36,1,4,8,0,11,32,18,40,7,41,12,32,0,4,24,0,26,8,0,9,7,
+8,9,9,49,8,0,0,7,32,8,36,21,4,8,0,39,32,9,36,18,4,14,36,14,4,10,0,9,8,22,40,0,32,15,40,4,41,27,9,5,41,12,9,0,8,7,0,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
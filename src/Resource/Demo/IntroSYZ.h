@@ -0,0 +1,2 @@
+0,17,8,55,40,4,8,10,0,18,8,11,0,31,8,27,0,9,8,32,0,20,4,22,36,0,32,15,0,19,4,23,6,4,2,0,0,36,8,13,0,70,8,119,0,96,8,23,0,22,4,3,0,34,8,25,40,2,32,1,0,38,32,9,
+0,58,32,35,0,3,8,1,0,41,4,19,0,25,4,27,0,145,8,33,0,25,4,4,0,103,4,35,0,10,8,5,0,135,8,33,0,44,8,39,0,15,8,53,40,8,8,69,40,9,8,49,0,153,0,0,0,0,0,0,0,0,0,0
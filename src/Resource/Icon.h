@@ -0,0 +1,12 @@
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,52,52,144,87,87,172,87,87,172,116,116,206,116,116,206,87,87,172,87,87,172,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,52,52,144,52,52,144,172,116,87,172,116,87,116,116,206,116,116,206,87,87,172,87,87,172,255,255,255,255,255,255,52,52,144,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,52,52,144,172,116,87,255,172,144,172,116,87,116,116,206,144,144,255,116,116,206,87,87,172,87,87,172,52,52,144,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,144,144,255,172,
+116,87,255,172,144,255,172,144,144,144,255,144,144,255,116,116,206,116,116,206,87,87,172,52,52,144,255,255,255,255,255,255,255,255,255,255,255,255,144,144,255,116,116,206,87,87,172,87,87,172,116,116,206,87,87,172,87,87,172,116,116,206,116,116,
+206,116,116,206,116,116,206,87,87,172,255,255,255,255,255,255,255,255,255,144,144,255,52,52,144,52,52,144,52,52,144,87,87,172,116,116,206,144,144,255,255,255,255,255,255,255,116,116,206,116,116,206,87,87,172,144,144,255,52,52,144,255,255,255,
+255,255,255,52,52,144,52,52,144,52,52,144,52,52,144,87,87,172,87,87,172,255,255,255,0,0,0,0,0,0,255,255,255,116,116,206,0,0,0,255,255,255,52,52,144,255,255,255,52,52,144,52,52,144,52,52,144,52,52,144,52,52,144,52,
+52,144,87,87,172,255,255,255,0,0,0,0,0,0,255,255,255,116,116,206,0,0,0,255,255,255,52,52,144,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,52,52,144,52,52,144,87,87,172,255,255,255,0,0,0,0,0,0,255,255,
+255,52,52,144,172,172,172,255,255,255,52,52,144,255,255,255,255,255,255,255,255,255,144,144,255,52,52,144,52,52,144,52,52,144,172,116,87,255,172,144,255,255,255,255,255,255,255,172,144,0,0,0,0,0,0,172,116,87,255,255,255,255,255,255,
+255,255,255,144,144,255,52,52,144,52,52,144,52,52,144,0,0,0,172,116,87,255,172,144,255,172,144,255,172,144,255,172,144,255,172,144,255,172,144,172,116,87,255,255,255,255,255,255,255,255,255,144,144,255,52,52,144,52,52,144,52,52,144,52,
+52,144,0,0,0,172,116,87,172,116,87,255,172,144,255,172,144,255,172,144,172,116,87,255,255,255,255,255,255,255,255,255,255,255,255,144,144,255,255,255,255,255,255,255,144,144,255,52,52,144,52,52,144,172,116,87,144,0,0,144,0,0,144,0,
+0,144,0,0,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
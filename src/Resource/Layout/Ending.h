@@ -0,0 +1 @@
+14,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,41,42,45,49,39,2,49,34,37,3,49,2,49,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
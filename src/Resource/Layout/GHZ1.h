@@ -0,0 +1,4 @@
+47,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,1,1,1,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,56,36,0,0,33,38,17,17,31,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,49,36,20,56,4,35,37,45,181,38,17,31,30,32,15,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,45,3,49,36,16,2,7,4,5,43,14,30,17,37,26,38,17,8,9,10,23,30,30,32,17,31,15,0,16,5,43,22,2,3,55,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,30,30,32,37,7,34,12,13,21,25,17,37,45,45,45,45,0,0,0,0,0,0,0,0
@@ -0,0 +1,4 @@
+32,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,43,22,28,5,43,22,2,55,0,0,0,0,0,0,0,0,0,0,0,0,33,3,0,0,0,0,33,49,
+36,0,0,0,12,13,6,12,30,13,21,17,37,50,43,11,45,181,45,7,36,18,56,36,45,38,8,5,43,11,33,38,31,15,0,0,0,30,30,30,30,10,23,30,30,12,12,13,25,17,8,23,30,30,30,30,30,30,30,30,24,13,8,35,
+17,32,37,45,45,45,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,0,0,0,0,30,30,10,23,30,17,8,29,9,30,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,30,30,
+30,30,30,30,30,30,30,0
@@ -0,0 +1,5 @@
+47,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,56,
+24,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,56,36,20,0,19,56,39,2,26,38,31,15,0,0,20,33,45,0,0,0,19,51,51,16,36,44,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,55,22,27,35,37,26,3,6,38,31,30,30,30,32,37,181,49,27,35,17,51,51,2,26,52,52,25,37,6,49,39,0,22,2,7,2,55,45,45,45,60,60,45,45,0,
+0,0,30,15,21,30,30,30,30,30,30,30,32,31,30,30,30,30,30,30,12,17,9,52,52,17,30,30,30,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,30,32,17,8,
+9,10,29,9,30,30,30,30,30,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
@@ -0,0 +1 @@
+31,0,61,62,58,63,48,57,59,61,58,48,62,57,61,59,59,61,62,58,63,62,58,63,48,57,59,61,58,48,62,57,61,59
@@ -0,0 +1,5 @@
+31,7,25,42,39,41,26,23,14,33,23,0,0,0,39,29,36,13,14,14,14,14,14,14,33,23,23,23,23,0,0,0,0,0,14,14,14,14,14,37,12,34,14,20,0,0,14,14,14,2,10,9,10,9,21,12,34,31,1,14,14,14,0,0,
+0,0,0,0,0,0,14,14,14,14,14,12,45,14,14,14,14,11,58,14,60,25,29,29,29,30,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,14,24,9,45,14,17,15,59,14,61,17,27,14,14,14,14,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,14,14,14,46,12,15,17,15,14,62,15,16,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,14,14,14,25,26,12,11,11,15,14,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,14,14,14,14,14,14,14,0,0,0,0,0,0,0,0,0,0,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+14,14
@@ -0,0 +1,3 @@
+18,7,23,11,23,13,14,14,14,14,14,14,14,14,0,0,0,0,0,0,0,1,1,1,2,3,11,14,17,0,11,23,14,0,0,0,0,0,0,0,14,14,14,11,76,5,20,46,45,14,19,14,14,0,0,0,0,0,0,33,23,12,46,14,
+14,14,45,46,14,15,14,14,63,28,0,0,0,0,47,21,12,23,34,9,10,46,15,14,19,14,14,64,14,1,14,14,14,14,14,14,14,14,14,14,14,17,11,15,11,12,65,14,0,0,0,0,0,0,0,0,0,0,0,14,21,12,11,15,
+14,14,14,0,0,0,0,0,0,0,0,0,0,0,14,14,14,14,14,14,0,0,0,0,0,0
@@ -0,0 +1,5 @@
+34,7,0,0,0,0,0,14,14,33,77,14,14,14,14,14,0,0,0,14,14,14,14,14,14,14,14,14,14,16,14,14,0,0,0,0,0,14,14,14,14,14,14,32,75,14,17,11,11,11,14,14,14,0,14,17,33,0,13,14,14,14,14,23,
+15,14,14,49,1,14,14,14,11,11,13,14,12,17,75,14,17,0,46,39,66,68,39,14,0,14,70,71,14,2,3,18,14,14,16,14,14,14,49,14,0,0,0,14,14,2,3,18,8,20,35,36,11,23,40,67,69,34,14,14,14,20,45,23,
+12,23,4,18,33,15,14,0,14,49,14,0,0,0,0,14,14,14,4,74,12,37,14,17,22,14,36,12,34,9,10,36,12,45,45,11,22,14,72,0,14,14,14,14,49,14,0,0,0,0,0,0,14,14,4,18,36,23,15,14,14,14,14,14,
+14,14,14,14,43,43,44,14,14,16,14,14,14,23,23,15,14,0,0,0,0,0,0,0,14,14,4,18,43,34,38,10,9,10,9,41,29,41,42,29,41,42,0,11,37,14,35,14,16,14,14,14,0,0,0,0,0,0,0,0,14,14,4,18,
+14,14,14,14,14,14,14,14,14,14,14,14,14,46,15,14,14,15,33,15,14,14,14,0,0,0
@@ -0,0 +1,3 @@
+25,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,11,8,9,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,1,52,2,2,3,5,18,18,10,8,
+11,7,7,7,9,12,32,12,11,8,3,8,11,16,16,16,0,0,0,0,0,0,0,0,0,51,15,15,14,14,73,13,24,22,32,32,18,18,18,18,18,0,0,0,0,0,0,0,0,0,0,51,39,40,32,32,31,49,25,32,18,18,18,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,32,17,33,20,20,20,69,22,32,0,0,0,0,0,0,0,0
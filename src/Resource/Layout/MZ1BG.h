@@ -0,0 +1,2 @@
+19,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,56,55,56,54,55,55,56,54,55,56,54,55,56,56,54,55,54,56,54,61,61,
+61,59,60,61,60,66,64,65,66,61,62,60,61,61,61,61,61,61,61,61,62,62,63,64,61,65,65,60,61,66,61,61,63,61,61,61,61,61,61,61,67,65,66,67,61,61,59,64,65,62,59,59,62,61,61,61,61,61
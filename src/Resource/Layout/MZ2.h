@@ -0,0 +1,3 @@
+26,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,32,0,0,0,0,6,8,53,16,9,0,0,32,32,32,32,32,32,0,0,0,52,8,53,7,9,32,32,16,
+9,11,2,5,18,18,32,10,8,9,32,32,32,32,32,12,53,53,53,18,51,32,43,73,17,21,18,46,30,29,42,42,42,42,32,18,46,40,32,32,42,25,22,32,32,0,0,18,26,44,20,23,22,42,42,31,49,48,47,47,45,32,68,30,
+22,32,25,22,32,32,32,0,0,0,18,41,27,27,27,30,17,38,36,36,36,23,17,22,32,44,20,20,23,22,32,32,0,0,0,0
@@ -0,0 +1,3 @@
+23,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,56,56,54,55,56,55,55,56,54,54,56,55,56,
+54,56,54,54,55,56,55,56,54,56,61,61,59,63,66,61,64,62,67,59,61,60,61,62,60,62,62,62,64,59,64,67,59,61,61,60,60,63,62,60,66,59,60,61,67,64,62,60,67,60,66,61,62,60,61,61,61,61,61,60,59,61,62,62,
+64,62,62,62,61,61,62,62,62,62,61,59,64,64,61,61,61,61
@@ -0,0 +1,4 @@
+27,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,8,53,16,53,9,0,0,32,32,32,32,32,32,32,32,32,32,32,0,0,0,0,0,0,0,0,0,32,32,32,32,70,73,
+8,12,32,32,32,32,32,32,32,32,32,32,32,12,11,3,71,11,72,74,53,53,26,33,25,17,22,32,26,22,32,32,32,32,32,32,26,69,25,25,0,22,32,32,18,32,0,0,0,0,21,14,15,30,36,36,22,18,32,32,32,32,32,32,
+39,42,0,0,0,0,42,32,32,32,0,0,0,0,28,34,69,22,32,37,29,14,30,37,49,31,49,49,49,22,47,47,47,22,39,42,32,0,0,0,0,0,32,35,30,20,20,36,13,32,26,22,32,32,32,42,42,14,14,40,43,40,29,25,
+32,0,0,0,0,0,32,32,32,32,32,32,32,32,39,30,38,20,20,23,22,32,32,33,44,44,17,22,32,0,0,0,0,0
@@ -0,0 +1,3 @@
+22,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,54,55,56,54,54,55,56,54,56,55,56,54,55,54,56,
+54,55,56,56,54,55,54,61,60,59,65,60,61,62,61,61,59,65,61,64,62,65,63,62,62,63,61,61,61,61,63,61,62,63,67,60,61,62,64,65,64,65,66,64,61,62,64,61,61,61,61,61,61,60,65,59,67,63,64,65,61,64,64,62,
+62,60,61,62,61,60,62,61,61,61,61,61,62,62,62,62,62,61,61,62,63,62,59,61,62,60,64,63,60,61,61,61,61,61,61,0
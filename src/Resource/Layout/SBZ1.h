@@ -0,0 +1,5 @@
+35,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,22,1,14,16,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,34,2,34,0,17,16,12,
+3,16,16,16,0,0,16,16,16,0,0,0,0,0,0,0,0,0,0,22,34,0,0,0,0,46,45,16,0,16,44,16,13,3,16,16,5,16,16,16,30,15,0,0,0,0,0,0,0,0,0,6,0,18,19,17,16,0,0,9,45,29,0,15,
+0,16,12,7,8,5,16,16,4,75,47,26,42,43,24,20,18,18,1,9,22,22,34,2,1,7,3,16,16,0,0,15,0,0,0,22,22,1,14,16,16,4,75,31,47,33,33,26,42,43,16,16,16,0,16,16,17,17,16,12,3,16,5,16,
+16,27,24,20,18,45,0,17,17,16,12,7,9,33,33,28,16,0,46,0,32,43,16,16,16,0,16,16,17,17,16,16,5,16,4,75,47,28,16,16,16,17,16,16,30,33,1,21,21,9,34,18,18,45,29,0,0,0,0,0,0,0,0,0,
+0,0,0,16,4,75,7,21,21,21,9,75,47,75,47,34,25,17,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,0
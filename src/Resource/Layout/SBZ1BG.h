@@ -0,0 +1 @@
+29,1,52,53,54,55,56,52,53,54,55,56,52,53,54,55,56,52,53,54,55,56,52,53,54,55,56,52,53,54,55,56,57,58,59,60,61,57,58,59,60,61,57,58,59,60,61,57,58,59,60,61,57,58,59,60,61,57,58,59,60,61
@@ -0,0 +1,6 @@
+39,7,16,16,16,16,30,30,30,44,11,1,47,33,33,33,33,33,75,50,36,50,9,10,16,30,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,1,36,47,34,0,0,10,11,75,31,47,34,49,48,48,15,30,16,0,33,26,
+42,43,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,16,16,16,16,16,16,13,8,16,28,30,16,9,1,23,24,20,18,19,17,26,42,43,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,1,36,36,47,33,
+33,10,16,30,15,41,75,36,50,36,47,10,16,16,16,26,42,43,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,16,16,16,15,15,33,33,34,18,19,40,40,16,16,16,13,7,8,11,1,47,26,42,43,15,15,15,15,30,30,
+30,16,16,0,0,0,0,0,0,0,16,15,0,41,41,17,17,16,11,75,47,75,36,36,9,10,16,16,44,16,11,34,32,43,24,20,37,38,1,9,1,68,69,70,68,68,71,72,73,74,16,0,0,40,22,1,9,10,11,1,9,0,0,1,
+36,50,36,47,10,16,44,16,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,0,0,18,19,39,40,17,16,16,44,16,16,16,0,0,16,16,15,15,15,16,16,12,14,16,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,
+0,0
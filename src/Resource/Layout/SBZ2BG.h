@@ -0,0 +1,6 @@
+59,5,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,65,66,
+67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,62,63,64,62,63,64,
+62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,65,66,67,65,66,67,65,66,67,65,
+66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,62,63,64,62,63,64,62,63,64,62,63,64,62,63,
+64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,62,63,64,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,
+65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67,65,66,67
@@ -0,0 +1,3 @@
+22,7,14,14,14,14,14,17,39,41,26,17,6,73,14,14,48,14,14,14,14,14,14,14,14,14,33,11,18,14,22,14,11,6,5,11,17,23,18,16,14,14,14,14,14,14,14,14,14,31,14,47,27,35,14,20,11,12,15,1,35,43,15,14,
+14,14,14,14,14,14,14,14,43,11,14,46,15,14,14,1,43,18,14,37,14,19,14,11,11,14,14,14,14,14,14,45,0,17,44,19,14,12,35,17,43,14,43,34,25,18,37,24,38,41,42,23,14,33,45,0,46,12,46,14,12,38,31,23,
+12,11,14,14,47,30,14,14,14,14,16,14,14,45,12,34,14,43,11,11,11,23,44,14,47,10,9,10,9,10,9,27,12,15,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14
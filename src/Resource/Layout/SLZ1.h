@@ -0,0 +1,5 @@
+33,7,0,0,0,0,0,0,0,0,0,0,0,0,0,1,8,10,0,0,0,0,1,24,5,1,8,0,0,0,0,51,0,0,0,0,0,0,0,1,10,51,51,51,51,0,0,0,15,51,6,7,24,0,0,0,0,0,0,0,6,7,170,15,
+24,51,0,0,0,0,1,1,38,51,12,5,8,63,47,5,24,3,12,4,1,51,51,1,1,14,24,4,18,5,8,51,47,3,12,18,4,18,18,18,51,51,29,51,0,0,6,7,46,51,51,4,3,1,1,51,51,51,35,20,51,35,20,32,
+6,7,46,51,32,24,0,0,0,0,0,51,51,51,0,0,51,51,11,51,51,0,51,51,0,1,40,3,12,19,1,24,19,31,3,12,18,24,31,18,0,0,0,0,0,0,0,0,0,0,0,51,41,8,51,0,3,12,3,12,5,40,5,0,
+51,0,4,0,0,0,51,51,0,4,0,0,0,0,0,0,0,0,0,0,0,51,51,6,7,1,170,40,0,3,0,12,5,24,3,0,0,0,4,3,4,5,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,51,51,0,0,0,0,0,0,0,0,0,0,0,0,0
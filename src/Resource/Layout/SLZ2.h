@@ -0,0 +1,4 @@
+33,6,0,0,20,1,8,0,0,0,0,0,0,0,0,0,1,40,5,40,5,40,5,40,4,51,51,0,51,0,1,51,0,0,0,0,21,21,19,51,6,7,180,0,0,0,20,1,38,3,51,20,21,5,170,170,1,24,5,15,51,0,3,0,
+51,51,0,0,0,0,0,0,0,51,51,51,41,170,40,36,37,8,21,3,12,19,0,1,40,3,0,1,4,3,12,0,51,0,5,32,1,1,1,1,0,0,0,0,0,51,51,51,0,0,0,6,7,180,51,0,0,51,0,51,0,51,0,51,
+0,0,15,0,15,39,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,51,11,0,18,40,21,5,180,51,51,20,51,0,4,29,15,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,51,41,24,51,51,51,51,41,
+8,24,19,0,4,0,15,29,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,51,51,51,0,0,0,51,6,7,170,24,21,0,29,29,29,0,0,0,0,0
@@ -0,0 +1,5 @@
+34,7,0,0,0,0,0,1,24,5,9,5,1,24,5,20,180,51,51,0,0,14,8,0,51,29,14,24,5,8,0,51,0,0,0,0,0,21,21,25,23,0,18,0,0,6,7,180,51,47,19,41,180,51,35,18,10,6,7,180,29,14,10,51,
+6,7,180,0,0,0,0,0,0,0,51,26,22,0,4,14,32,51,41,1,46,51,51,41,170,40,21,10,51,51,41,24,10,4,5,10,51,41,20,1,1,1,1,0,0,51,2,27,0,0,0,31,5,20,51,41,40,13,22,0,0,3,12,5,
+14,24,5,20,38,3,12,35,18,19,51,0,0,0,0,0,0,51,28,0,20,14,24,18,19,0,0,0,2,27,0,0,51,0,14,0,3,12,19,3,12,18,24,3,12,51,0,0,0,0,0,0,51,30,21,19,10,51,51,14,0,0,15,63,
+28,20,33,51,1,10,21,51,1,0,0,0,1,20,51,0,0,0,0,0,0,0,0,51,0,0,4,3,12,3,10,0,0,29,10,30,19,10,0,20,14,0,5,24,3,12,4,4,19,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+51,10,0,0,29,21,4,3,12,4,19,10,0,0,51,51,0,0,0,0,0,0,0,0,0,0
@@ -0,0 +1,2 @@
+23,4,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,16,45,17,48,17,48,17,48,17,48,17,48,17,48,17,48,
+17,48,17,48,17,48,17,48,17,48,34,49,34,49,34,49,34,49,34,49,34,49,34,49,34,49,34,49,34,49,34,49,34,49,44,50,44,50,44,50,44,50,44,50,44,50,44,50,44,50,44,50,44,50,44,50,44,50
@@ -0,0 +1,3 @@
+36,4,36,47,36,66,12,36,56,71,1,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,2,36,2,71,1,36,0,36,36,36,66,10,73,1,71,1,1,43,36,36,4,14,19,30,55,25,28,6,36,2,4,36,
+36,28,73,36,36,1,36,1,71,1,36,0,36,36,36,8,9,45,1,14,15,17,1,36,36,1,1,20,22,23,23,29,1,36,1,1,71,74,29,43,43,2,1,2,11,2,2,2,2,6,2,7,1,1,1,1,1,16,18,5,33,2,15,17,
+1,1,1,1,1,1,2,34,37,70,57,67,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,16,18,21,27,21,24,21,27,21,35,38,1,1,1,1,1,1,1,1,1,1,1,1,0,0
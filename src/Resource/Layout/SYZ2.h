@@ -0,0 +1,5 @@
+42,5,36,36,38,36,36,40,47,47,36,36,56,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,44,36,36,36,36,36,36,36,1,71,1,36,49,3,50,48,36,
+36,36,36,36,2,6,36,36,1,36,36,36,36,36,0,0,0,0,0,0,0,0,0,0,1,1,1,36,36,36,28,73,36,56,1,71,1,56,40,1,52,51,50,48,36,36,28,15,17,4,13,4,36,36,25,36,36,36,36,38,36,36,1,36,
+0,0,0,1,1,1,36,2,26,29,43,43,1,1,71,1,1,1,1,1,1,52,31,36,4,29,16,18,21,41,5,33,26,23,14,6,73,32,44,36,36,1,36,36,36,0,1,1,1,36,46,17,1,1,1,1,1,71,1,1,1,1,1,1,
+1,1,56,1,1,1,1,1,1,1,1,1,1,1,40,45,1,1,36,36,58,32,33,2,2,1,1,1,45,16,18,21,27,21,24,5,70,57,67,57,68,68,68,68,68,69,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,53,2,54,
+32,33,2,2
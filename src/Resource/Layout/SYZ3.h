@@ -0,0 +1,6 @@
+48,6,56,36,36,36,36,36,36,0,0,0,0,1,36,36,25,36,2,36,36,36,36,6,6,44,36,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,49,3,50,48,36,36,36,36,36,36,1,36,
+36,23,4,1,36,36,36,4,71,68,1,36,1,1,1,1,36,36,36,36,36,36,71,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,52,51,50,48,36,36,2,6,1,36,6,42,21,5,33,73,36,54,71,1,1,36,1,1,1,
+1,36,36,56,36,36,36,71,1,1,36,36,47,47,40,0,0,0,0,0,0,0,0,0,1,1,52,31,36,2,15,17,1,4,71,1,1,1,1,43,43,1,70,40,1,36,40,1,1,1,36,36,1,43,43,43,71,1,12,36,36,36,36,11,
+36,36,0,0,0,0,0,0,0,0,0,1,1,36,1,16,18,27,5,71,1,1,1,1,1,1,1,1,1,1,36,46,17,1,1,4,13,1,1,1,1,71,1,10,36,56,36,36,36,36,36,36,36,36,0,0,0,0,0,0,0,1,4,1,
+1,1,1,1,4,57,67,11,1,1,1,1,1,1,1,36,16,18,24,39,39,41,24,21,27,5,72,8,9,36,1,36,36,36,4,36,64,4,4,4,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
+45,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,36,36,36,1,36,66,1,1,0,0
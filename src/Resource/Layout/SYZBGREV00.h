@@ -0,0 +1 @@
+27,1,63,61,62,63,61,61,62,63,61,62,63,61,61,62,63,61,62,63,61,61,62,63,61,62,63,61,61,62,59,65,60,65,59,60,60,59,65,60,65,59,60,60,59,65,60,65,59,60,60,59,65,60,65,59,60,60
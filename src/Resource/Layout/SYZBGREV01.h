@@ -0,0 +1 @@
+27,1,63,62,63,62,63,62,63,62,63,62,63,62,63,62,63,62,63,62,63,62,63,62,63,62,63,62,63,62,65,59,65,59,65,59,65,59,65,59,65,59,65,59,65,59,65,59,65,59,65,59,65,59,65,59,65,59
@@ -0,0 +1,55 @@
+64,0,64,0,64,0,64,0,64,84,72,84,72,84,64,84,65,205,65,206,65,207,64,76,64,0,64,0,64,75,64,79,65,208,65,209,65,210,65,211,64,235,64,236,65,212,65,213,65,214,65,215,65,207,64,76,65,216,65,217,65,218,65,219,
+65,220,65,221,65,222,65,223,64,78,65,224,65,225,65,226,64,235,64,236,64,239,72,239,64,78,64,183,64,239,72,239,65,227,65,228,64,80,65,229,65,230,65,231,64,104,65,232,65,233,65,233,64,89,65,234,64,0,64,0,64,129,64,79,
+64,130,64,80,64,131,64,134,64,155,64,157,64,156,64,158,72,80,72,130,72,81,72,189,64,76,64,80,64,77,64,81,65,229,64,104,65,235,64,128,64,84,65,236,65,237,65,238,64,89,64,89,65,239,64,107,65,234,65,240,65,241,65,242,
+65,243,64,206,65,244,64,207,64,76,64,80,65,245,65,246,65,247,64,125,65,248,64,151,64,119,64,77,64,120,64,78,64,81,65,235,72,78,64,78,64,128,64,116,72,78,64,78,64,107,65,241,72,78,64,78,65,216,65,217,73,216,81,217,
+65,249,65,250,65,251,65,252,64,118,65,248,72,78,64,78,64,151,64,120,64,83,64,85,64,78,72,78,64,83,64,85,64,78,72,78,64,144,64,135,64,85,64,83,72,84,64,84,64,135,65,253,72,84,64,84,64,0,64,0,64,0,64,90,
+64,0,64,0,64,75,65,227,64,0,64,0,65,230,65,233,64,0,64,0,65,254,64,205,64,0,64,90,65,255,66,0,64,75,65,227,65,207,64,80,65,230,65,233,64,104,64,89,65,254,64,205,65,240,64,206,65,255,66,0,64,125,64,119,
+64,0,64,0,64,103,64,105,64,0,64,90,64,88,64,91,64,103,64,105,64,104,64,89,64,88,64,91,64,89,64,92,64,104,64,89,64,125,64,128,64,89,64,117,64,116,64,118,64,119,64,116,64,120,64,78,64,107,64,109,72,78,64,85,
+64,151,72,78,64,83,64,135,64,135,72,84,72,84,64,84,64,0,64,0,64,0,66,1,64,0,66,1,66,2,66,3,66,2,66,3,65,222,65,223,65,222,65,223,66,4,66,5,66,6,66,7,72,78,64,78,64,78,72,78,66,8,66,9,
+66,10,66,11,72,84,64,84,64,84,72,84,66,12,66,13,66,14,66,15,65,207,64,76,66,16,66,17,64,80,65,229,81,251,66,18,65,251,82,18,66,19,66,20,64,104,65,232,72,80,72,76,72,81,66,21,64,84,72,84,72,84,66,22,
+65,208,65,209,81,208,66,23,66,19,66,24,64,104,64,89,66,25,66,26,65,240,64,206,66,27,66,28,64,125,64,119,66,29,66,30,64,125,64,119,64,84,72,84,66,31,66,32,64,84,66,33,66,34,66,35,66,36,66,37,64,104,64,89,
+66,38,66,39,64,89,64,92,66,40,72,84,66,41,66,42,64,84,66,43,66,44,66,45,66,46,66,47,65,222,65,223,66,48,64,157,66,49,72,157,66,50,66,51,64,104,65,232,66,52,66,53,65,207,64,76,66,54,66,55,64,0,64,0,
+74,55,66,56,64,0,66,57,64,0,82,57,64,0,66,57,64,0,66,58,66,59,66,60,66,61,66,62,66,63,66,64,64,84,66,65,65,237,64,78,66,66,66,67,66,68,66,69,66,70,72,84,81,208,66,71,65,208,65,209,81,208,81,209,
+64,244,64,244,64,245,64,245,64,246,64,247,64,248,64,249,64,250,64,251,64,252,64,253,194,72,194,73,194,74,194,75,194,76,194,77,194,78,194,79,66,80,66,81,66,82,66,83,66,84,66,85,64,104,65,232,64,0,66,86,66,87,66,88,
+64,76,64,80,66,89,66,90,66,91,66,92,66,93,66,94,64,84,72,84,74,94,66,95,64,84,72,84,74,94,66,94,64,78,72,78,66,96,66,97,64,78,72,78,72,84,64,84,64,78,64,183,72,78,80,183,64,78,72,78,64,157,72,157,
+64,84,72,84,66,98,66,99,64,155,64,157,80,235,72,236,64,235,64,236,80,235,72,236,64,179,64,181,66,100,64,182,64,84,72,84,74,94,66,94,72,157,64,157,66,101,74,101,64,78,72,78,64,172,72,172,64,78,64,183,64,172,66,102,
+64,84,74,42,74,42,72,157,74,88,74,87,74,86,64,0,66,103,66,104,66,105,64,0,74,92,72,80,74,94,66,106,194,72,194,73,194,107,194,108,194,76,194,77,194,109,194,110,194,111,194,112,194,113,194,114,194,115,194,116,194,117,194,118,
+194,119,194,120,194,121,194,122,194,123,194,124,194,125,194,126,64,78,72,78,72,84,66,127,64,0,66,86,64,75,66,128,64,78,64,183,66,129,66,130,74,88,74,87,74,128,72,75,64,103,66,131,64,104,64,89,66,132,64,79,65,207,64,76,
+64,0,72,44,64,0,66,133,64,103,194,131,64,104,64,89,194,132,64,79,65,207,64,76,192,0,200,44,192,0,194,133,64,242,72,242,64,239,72,239,64,242,72,242,66,134,66,135,64,84,72,84,66,136,66,137,64,84,72,84,66,138,66,139,
+66,140,66,140,66,141,66,141,66,140,66,140,66,142,66,143,66,140,66,140,66,144,66,145,66,146,66,147,66,148,66,149,66,150,66,151,66,152,66,153,66,154,72,84,72,84,64,84,66,155,72,84,72,78,66,156,66,140,66,140,66,141,66,157,
+66,140,66,140,66,140,66,140,66,140,66,158,66,159,66,160,66,161,66,162,66,163,66,164,66,165,72,84,72,84,64,84,64,235,66,166,66,167,66,168,64,242,66,169,64,239,66,170,66,171,66,172,66,173,66,174,66,175,66,176,66,140,66,140,
+66,140,66,177,66,158,66,178,66,179,66,180,66,181,66,182,66,183,64,236,80,235,72,236,64,84,72,84,72,84,66,184,66,185,66,186,66,186,66,187,66,188,66,140,66,176,66,140,66,189,66,190,66,191,66,192,66,193,72,84,66,194,64,84,
+66,195,66,196,66,197,66,198,66,140,66,199,66,140,66,200,66,201,72,84,66,202,64,84,66,203,74,140,82,203,74,140,66,204,66,205,82,204,82,205,66,206,72,84,82,206,64,84,64,84,72,84,72,84,66,185,66,185,66,186,66,186,66,187,
+66,188,66,140,66,176,66,140,66,185,66,207,66,208,66,209,66,210,66,211,66,212,74,140,66,213,66,214,64,0,66,215,66,216,66,217,66,218,64,0,65,230,66,219,64,104,65,232,66,220,74,220,64,236,72,236,74,140,74,140,66,221,66,221,
+66,222,74,220,80,235,72,236,66,223,64,205,65,240,64,206,192,0,194,58,194,59,194,60,194,61,194,62,194,63,194,64,194,66,194,67,194,68,194,69,66,224,72,84,66,225,64,84,66,226,72,84,66,227,64,84,194,80,194,81,194,82,194,83,
+194,84,194,85,64,104,65,232,64,0,64,0,64,0,64,4,64,0,64,0,64,8,64,12,64,16,64,20,64,17,64,21,64,24,64,28,64,25,64,29,64,32,64,0,64,0,64,0,64,1,64,5,64,2,64,6,64,9,64,13,64,10,64,14,
+64,18,64,22,64,19,64,23,64,26,64,30,64,27,64,31,64,0,64,0,64,53,64,0,64,3,64,7,64,33,64,35,64,11,64,15,64,37,64,39,64,41,64,45,64,42,64,46,64,49,64,0,64,50,64,0,64,54,64,0,64,55,64,0,
+64,0,64,36,64,0,64,0,64,38,64,40,64,56,64,0,64,43,64,47,64,44,64,0,64,51,64,0,64,52,64,0,64,44,64,0,64,44,64,0,64,44,64,0,66,228,64,79,192,0,192,0,192,0,192,4,192,0,192,0,192,8,192,12,
+192,16,192,20,192,17,192,21,192,24,192,28,192,25,192,29,192,32,192,0,192,0,192,0,192,1,192,5,192,2,192,6,192,9,192,13,192,10,192,14,192,18,192,22,192,19,192,23,192,26,192,30,192,27,192,31,192,0,192,0,192,53,192,0,
+192,3,192,7,192,33,192,35,192,11,192,15,192,37,192,39,192,41,192,45,192,42,192,46,192,49,192,0,192,50,192,0,192,54,192,0,192,55,192,0,192,0,192,36,192,0,192,0,192,38,192,40,192,56,192,0,192,43,192,47,192,44,192,0,
+192,51,192,0,192,52,192,0,192,44,192,0,192,44,192,0,192,44,64,0,194,228,64,79,66,87,66,88,64,75,66,128,74,86,66,1,66,229,66,3,64,0,66,86,64,129,66,128,74,88,74,87,74,128,72,129,66,72,66,73,66,230,66,231,
+66,76,66,77,66,232,66,233,66,72,66,73,66,107,66,108,66,76,66,77,66,109,66,110,66,234,66,234,66,235,66,235,65,220,65,221,65,222,65,223,64,78,65,224,65,225,65,226,74,88,74,87,66,236,64,0,74,88,74,87,66,237,64,105,
+65,197,65,198,64,0,65,199,65,200,65,201,65,202,65,203,65,204,64,0,64,0,64,0,96,244,96,244,96,244,96,244,96,244,96,244,96,254,96,255,97,0,97,1,97,2,97,3,97,4,97,5,97,6,97,7,96,244,96,244,97,8,97,9,
+97,10,97,11,96,244,97,12,97,13,97,14,97,15,97,16,97,17,97,18,96,244,96,244,97,19,97,20,96,244,97,21,96,244,96,244,97,22,96,244,97,0,97,1,97,10,97,17,97,4,105,4,97,19,112,255,97,8,97,9,97,19,97,20,
+97,21,97,22,96,244,96,244,66,238,66,239,66,240,66,241,66,242,66,243,66,244,66,245,66,246,66,247,66,248,66,249,64,244,64,244,65,23,65,24,65,25,65,26,65,27,65,28,65,29,65,30,65,31,65,32,64,244,64,244,65,33,65,34,
+64,244,64,244,65,29,65,30,65,25,65,26,65,35,65,36,65,27,65,28,65,37,65,38,65,35,65,36,65,39,65,40,65,41,65,42,65,37,65,38,65,43,65,44,65,45,65,46,65,31,65,32,65,41,65,42,65,27,65,28,65,35,65,36,
+65,37,65,38,65,47,65,48,65,39,65,40,65,49,65,50,65,41,65,42,65,47,65,48,64,244,65,51,65,52,65,53,65,54,65,55,65,56,65,57,64,244,65,58,65,59,65,60,65,61,65,62,65,63,65,64,65,65,65,66,65,67,65,68,
+65,69,65,70,65,71,65,72,65,73,65,74,65,75,65,76,65,77,65,78,65,79,65,80,65,81,65,82,65,47,65,48,65,83,65,84,65,49,65,50,65,85,65,86,65,47,65,48,65,87,65,88,65,89,65,90,65,91,65,92,65,93,65,94,
+64,244,64,244,65,95,65,96,64,244,65,97,65,98,65,99,65,100,65,101,65,102,65,103,65,104,65,105,65,106,65,107,65,108,65,109,65,110,64,249,65,111,65,112,64,248,65,113,65,114,65,115,65,116,65,117,65,118,65,119,65,120,65,121,
+65,122,64,251,65,123,64,253,64,250,65,124,64,252,65,121,65,125,65,126,65,123,65,127,65,128,65,129,65,130,65,131,89,131,65,132,89,129,89,128,65,133,73,132,73,90,73,89,97,134,96,244,97,135,97,136,96,244,96,244,97,137,97,138,
+97,139,97,140,97,141,97,142,96,244,96,244,97,143,97,144,97,145,97,146,65,147,65,148,65,149,65,150,65,151,65,152,97,153,97,154,65,155,65,156,97,157,97,158,65,159,65,160,97,161,97,162,65,163,65,164,97,165,97,166,65,167,65,168,
+66,250,66,251,66,252,66,253,66,254,64,236,64,236,72,236,72,169,72,78,72,78,72,168,64,78,66,255,67,0,72,236,64,78,67,0,67,1,72,236,72,157,64,157,64,157,72,157,64,78,72,78,72,78,64,78,192,78,192,183,200,78,208,183,
+64,76,64,80,64,77,64,81,192,84,200,84,200,84,192,84,194,103,194,104,194,105,192,0,195,2,200,84,195,3,192,84,192,0,195,4,192,0,195,5,192,0,195,6,192,0,195,7,194,42,200,84,192,157,194,42,195,8,200,84,192,0,195,9,
+64,0,67,10,64,0,67,11,64,244,72,78,64,244,67,12,67,13,72,84,67,14,67,15,64,0,67,16,64,0,67,17,64,0,64,0,67,18,67,19,67,20,67,21,67,22,64,78,64,0,67,23,67,24,64,78,67,25,72,78,67,26,67,27,
+64,78,72,78,67,28,67,29,131,30,131,31,131,32,131,33,131,34,131,35,131,36,131,37,131,38,131,39,128,0,131,40,97,169,96,244,97,170,97,171,96,244,96,244,97,172,97,173,64,244,64,244,65,52,65,174,64,244,64,244,64,244,64,244,
+67,41,67,42,72,84,67,43,65,48,65,133,65,175,65,176,65,177,65,178,65,175,65,176,64,244,64,244,65,179,64,244,65,180,65,181,65,75,65,182,64,244,64,244,65,183,65,101,194,238,194,239,194,240,194,241,194,242,194,243,194,244,194,245,
+194,246,194,247,194,248,194,249,192,84,195,44,200,84,192,84,195,45,195,46,200,84,192,84,3,38,3,39,0,0,3,40,64,244,64,244,65,184,64,244,65,185,65,186,65,47,65,48,65,187,65,188,65,47,65,48,65,189,65,190,65,175,65,176,
+65,114,65,191,65,192,65,193,65,194,65,195,65,196,65,176,64,78,72,78,67,47,67,48,64,78,72,78,75,29,75,28,64,78,75,25,75,27,75,26,75,42,75,41,75,43,64,84,203,46,203,45,200,84,192,84,203,44,200,84,200,84,192,84,
+192,0,192,0,195,49,195,50,195,51,195,52,195,53,192,84,72,157,67,54,67,55,75,14,64,0,67,6,64,0,67,7,64,0,67,4,64,0,67,5,67,2,72,84,67,3,64,84,67,8,72,84,64,0,67,9,64,84,72,84,67,56,67,57,
+67,58,67,59,64,0,64,0,67,60,67,61,64,0,64,0,203,54,192,157,195,14,203,55,194,42,200,84,192,157,194,42,65,205,65,206,65,207,64,76,65,208,65,209,65,210,65,211,64,235,64,236,65,212,65,213,65,214,65,215,65,207,64,76,
+65,216,65,217,65,218,65,219,64,84,72,84,72,84,64,84,192,84,202,42,202,42,200,157,192,84,200,84,200,84,192,84,72,157,64,157,64,157,72,157,64,78,72,78,72,78,64,78,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,
+67,161,67,162,67,163,67,164,67,165,67,166,67,167,67,168,67,169,67,170,67,171,67,172,67,173,67,174,67,175,67,176,67,177,67,178,67,179,67,180,67,181,67,182,67,183,67,184,67,185,67,186,67,187,67,188,67,189,67,190,67,191,67,192,
+67,193,67,194,67,195,67,196,99,160,99,160,99,160,99,160,99,160,99,160,99,160,99,160,0,0,0,0,35,64,35,68,0,0,0,0,35,72,35,76,35,65,35,69,35,66,35,70,35,73,35,77,35,74,35,78,35,67,35,71,67,88,67,89,
+35,75,35,79,67,90,67,91,99,128,99,132,99,129,99,133,99,136,99,140,99,137,99,141,99,130,99,134,99,131,99,135,99,138,99,142,99,139,99,143,99,144,99,148,99,145,99,149,99,152,99,156,99,153,99,157,99,146,99,150,99,147,99,151,
+99,154,99,158,99,155,99,159,67,120,67,121,67,122,67,123,67,124,67,125,67,126,67,127,35,92,35,93,35,94,35,95,35,96,35,97,35,98,35,99,35,100,35,101,35,102,35,103,35,104,35,105,35,106,35,107,0,0,0,0,99,108,99,109,
+0,0,0,0,99,110,0,0,99,111,99,112,99,113,99,114,99,115,0,0,99,116,0,0,99,117,99,118,67,88,67,89,99,119,0,0,67,90,67,91,195,120,195,121,195,122,195,123,195,124,195,125,195,126,195,127
@@ -0,0 +1,25 @@
+64,0,64,0,64,0,64,0,192,1,192,2,192,3,192,4,192,5,192,6,192,7,192,8,192,9,192,10,192,11,192,12,192,13,192,14,192,15,192,16,192,17,192,18,192,19,192,20,192,21,192,22,192,23,192,24,192,25,192,26,192,27,192,28,
+192,29,192,30,192,31,192,32,192,33,192,34,192,35,192,36,192,37,192,38,192,39,192,40,192,41,192,42,192,40,192,43,192,44,192,40,192,45,192,46,192,40,192,47,192,48,192,49,192,50,192,51,192,52,192,40,192,51,192,53,192,40,192,54,
+192,55,192,40,192,56,192,57,192,40,192,54,192,58,192,59,192,60,192,61,192,62,192,63,192,64,192,65,192,40,192,66,192,67,192,40,192,68,192,69,192,70,192,71,192,72,192,73,192,74,192,75,192,76,192,77,192,78,192,79,192,80,192,81,
+192,82,200,82,192,83,200,83,192,84,192,85,192,83,200,83,192,86,192,87,192,83,200,83,192,88,192,89,192,83,200,83,192,90,192,0,192,83,192,91,192,0,192,0,192,92,192,93,192,0,192,0,192,94,192,0,192,95,192,96,192,83,200,83,
+192,97,192,0,192,98,192,99,192,100,192,101,192,83,192,102,192,0,192,0,192,103,192,104,192,105,192,106,192,83,200,83,192,107,192,108,192,83,200,83,192,0,192,0,192,109,192,110,192,0,192,0,192,111,192,112,192,0,192,0,192,113,192,114,
+192,0,192,0,192,115,192,115,192,116,192,116,192,0,192,0,192,117,192,118,192,0,192,0,192,119,192,120,192,0,192,0,192,121,192,122,192,0,192,0,192,82,200,82,192,123,192,124,192,82,200,82,192,125,192,126,192,127,192,128,192,0,192,0,
+192,129,200,82,192,130,192,131,192,132,192,133,192,0,192,134,192,82,200,82,192,135,192,136,192,0,192,137,192,0,192,0,192,138,192,139,192,0,192,0,192,140,200,82,192,0,192,141,192,82,200,82,192,142,192,143,192,82,200,82,192,144,192,145,
+192,82,200,82,192,146,192,147,192,0,192,148,192,149,200,83,192,0,192,0,192,150,192,151,192,152,192,153,192,154,200,83,192,0,192,155,192,0,192,156,192,157,192,47,192,158,192,49,96,159,96,0,96,159,96,0,96,160,96,160,96,0,96,0,
+96,0,96,0,96,161,96,162,96,161,96,162,96,163,96,0,96,163,96,0,96,0,96,0,96,0,96,164,96,164,96,165,96,165,96,0,96,0,96,0,96,0,96,166,96,167,96,168,96,169,104,160,96,159,96,0,192,170,192,171,192,172,192,173,
+192,174,192,175,192,176,192,177,192,178,192,179,192,180,192,181,192,0,192,182,192,183,192,184,192,185,192,186,192,187,192,188,192,189,192,190,192,154,200,83,192,0,192,191,192,192,192,193,192,194,192,195,192,196,200,83,192,0,192,197,192,0,192,198,
+192,199,192,200,192,201,192,202,192,0,192,203,192,204,192,205,192,206,192,47,192,207,192,49,192,208,192,209,192,210,192,211,192,0,192,0,192,0,192,212,192,0,192,213,192,0,192,214,192,215,192,216,192,217,192,218,192,219,192,220,192,221,192,222,
+192,223,192,224,192,225,192,226,192,227,192,228,192,229,192,230,192,231,192,232,192,233,192,234,192,0,192,235,192,236,192,237,192,238,192,239,192,240,192,241,192,242,192,243,192,244,192,245,192,246,192,247,192,248,192,249,192,250,192,251,192,252,192,253,
+192,37,192,38,192,254,192,255,193,0,192,42,193,1,193,2,193,3,193,4,193,5,193,6,193,7,193,8,193,9,193,10,193,11,193,12,193,13,193,14,193,15,193,16,193,17,193,18,193,19,193,20,192,0,193,21,193,22,193,23,193,24,193,25,
+193,26,193,27,192,0,193,28,193,29,192,0,192,0,192,0,192,37,192,42,192,39,192,43,192,44,192,47,192,45,192,49,193,30,192,0,193,31,192,0,193,31,192,0,193,31,192,0,193,31,192,0,193,32,192,0,65,33,64,0,65,34,64,0,
+65,34,64,0,65,34,64,0,65,34,64,0,65,33,64,0,97,35,97,36,97,37,97,38,97,39,97,40,97,41,97,42,97,35,97,40,97,37,97,42,97,43,97,44,97,45,97,46,97,47,97,44,97,48,97,46,97,47,97,49,97,48,97,50,
+97,45,97,51,97,45,97,46,97,52,97,51,97,48,97,46,97,52,97,50,97,48,97,50,97,45,97,51,97,53,97,54,97,52,97,51,97,54,97,54,97,52,97,50,97,54,97,55,97,56,97,57,97,58,97,59,97,57,97,57,97,60,97,59,
+97,57,97,61,97,60,97,62,97,58,97,63,97,58,97,59,97,64,97,63,97,60,97,59,97,64,97,62,97,60,97,62,97,58,97,63,97,65,97,66,97,64,97,63,97,67,97,66,97,64,97,62,97,67,97,68,97,43,97,44,97,45,97,69,
+97,47,97,44,97,70,97,71,97,47,97,49,105,69,97,50,97,45,97,72,97,45,97,73,97,74,97,75,97,76,97,77,105,72,97,50,105,73,97,50,97,45,97,78,97,45,97,79,97,80,97,81,97,82,97,83,105,78,97,50,105,79,97,50,
+97,45,97,84,97,53,97,54,97,85,97,86,97,54,97,54,105,84,97,50,97,54,97,55,97,43,97,44,97,45,97,87,97,47,97,44,97,88,97,89,97,47,97,49,105,87,97,50,97,45,97,90,97,45,97,91,97,92,97,93,97,94,97,95,
+105,91,97,50,97,96,97,50,97,45,105,96,97,45,97,97,97,98,97,99,97,100,97,101,97,96,97,50,105,97,97,50,97,45,97,102,97,53,97,54,97,103,97,104,97,54,97,54,105,102,97,50,97,54,97,55,96,0,97,105,96,0,97,106,
+97,107,97,108,97,109,97,110,96,0,96,0,97,111,97,112,96,0,97,113,97,114,97,115,97,116,97,117,97,118,97,119,97,120,97,121,97,122,97,123,97,124,97,125,97,126,97,127,97,128,96,0,97,129,105,114,97,130,97,131,97,132,97,133,
+97,134,97,135,97,136,97,137,97,138,97,139,97,140,105,140,97,141,97,142,97,143,97,136,97,144,105,130,105,133,97,145,96,0,97,146,96,0,97,147,192,37,192,42,192,45,193,148,97,149,97,150,97,151,97,152,96,0,96,0,97,153,97,154,
+96,0,97,155,97,156,97,157,97,158,97,159,97,160,97,161,97,162,97,163,97,164,97,165,97,166,97,167,97,168,97,169,97,170,96,0,97,171,105,156,97,172,97,173,97,174,97,175,97,176,97,177,97,178,97,179,97,180,97,181,97,182,105,182,
+97,183,97,184,97,185,97,178,97,186,105,172,105,175,97,187,193,188,193,189,193,190,193,191,192,0,192,191,192,0,193,192,96,0,96,166,96,0,96,166,96,0,96,0,96,167,96,167,96,0,97,193,96,0,96,0,97,194,96,0,97,193,97,194,
+97,195,97,196,96,0,96,0,97,197,96,0,97,195,97,196,96,0,96,0,97,197,96,0,96,0,96,0,96,160,96,160
@@ -0,0 +1,47 @@
+192,0,192,0,192,0,192,0,192,1,200,35,192,2,200,36,200,35,192,5,200,36,192,6,192,1,192,5,192,2,192,6,64,0,64,0,64,117,64,118,64,0,64,0,72,67,72,63,64,0,64,119,64,120,64,121,72,118,72,117,64,122,64,123,
+64,123,64,124,64,125,64,126,72,68,72,64,64,18,64,127,72,64,64,128,64,129,64,130,64,131,64,132,64,133,64,54,64,55,64,57,64,134,64,135,64,19,64,57,64,136,64,137,64,55,64,57,64,138,64,139,64,140,64,141,64,142,72,36,
+64,143,64,64,64,144,64,145,64,146,64,147,64,148,64,149,64,55,64,150,64,151,64,24,64,152,64,0,64,0,64,0,64,0,64,0,64,0,64,119,72,67,72,63,72,68,72,64,64,17,64,153,64,18,64,154,64,131,64,155,64,156,64,54,
+64,19,64,23,64,157,64,158,64,159,64,160,64,161,64,162,64,65,64,69,64,66,64,70,64,140,64,163,64,142,72,36,64,164,64,165,72,36,64,6,64,166,64,167,64,2,64,6,64,79,64,81,64,2,64,82,64,0,64,0,64,168,64,169,
+64,170,64,171,64,172,64,173,64,55,64,146,64,174,64,175,64,146,64,57,64,176,64,177,64,0,64,43,64,40,64,44,64,0,64,0,64,178,64,0,72,45,72,41,64,74,64,78,64,179,64,180,64,180,64,181,64,146,64,57,64,182,64,183,
+64,184,72,181,64,185,64,186,64,187,64,188,64,189,64,190,64,0,64,0,72,179,64,0,64,0,64,191,64,192,64,181,64,193,72,184,64,194,72,185,64,0,64,0,64,195,64,0,64,40,64,44,64,41,64,45,64,196,64,197,64,50,64,54,
+64,198,64,199,64,2,64,6,64,200,64,201,64,202,64,203,64,204,64,205,64,206,64,207,96,208,96,209,96,210,96,211,96,212,96,213,96,214,72,122,64,215,64,216,64,217,72,122,64,218,64,219,72,68,72,64,64,220,64,0,64,221,64,119,
+64,0,64,222,72,67,72,63,64,223,64,224,64,225,72,122,64,226,64,227,64,122,64,123,64,228,64,229,64,230,72,122,64,0,64,231,64,232,72,200,64,233,64,153,64,18,64,154,64,234,64,235,72,68,72,64,64,0,64,236,72,118,64,237,
+64,238,64,238,64,239,64,240,64,241,64,242,64,243,72,122,64,244,64,245,72,68,72,64,64,246,64,247,64,248,64,249,64,250,64,247,72,249,64,248,64,251,72,122,64,18,64,154,64,252,64,245,72,68,72,64,72,238,64,253,64,254,64,122,
+72,241,72,241,64,255,65,0,64,0,65,1,64,117,65,2,64,250,64,247,65,3,65,4,64,250,64,0,65,3,65,4,64,0,64,247,65,3,65,4,64,250,64,0,73,4,73,3,64,0,64,247,72,249,64,248,64,0,64,0,64,0,64,0,
+64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,65,5,65,6,65,7,65,8,65,9,65,5,65,10,65,7,65,6,65,9,65,8,65,10,65,11,65,12,65,13,65,14,64,0,65,15,64,0,65,13,65,16,64,220,65,17,64,221,
+64,0,64,0,65,18,65,19,65,20,65,21,65,21,65,22,65,22,65,23,65,23,64,0,64,0,64,0,64,0,65,20,65,15,65,16,65,13,65,17,64,220,192,0,64,221,192,0,64,0,65,24,64,0,64,0,65,25,65,26,65,27,65,28,
+65,29,65,30,65,31,65,32,65,33,64,0,64,0,64,0,64,0,64,0,64,0,64,228,65,34,65,35,65,36,65,37,65,38,64,0,65,39,65,40,64,0,65,41,64,0,64,231,64,228,65,42,65,42,65,43,65,44,65,45,65,46,65,47,
+65,48,65,49,65,50,65,51,65,52,65,53,65,54,65,55,65,43,65,46,65,56,65,57,65,58,72,223,65,59,72,222,72,222,64,0,64,0,64,0,1,60,1,60,1,61,1,61,65,62,65,63,65,62,65,63,64,0,64,0,65,64,65,65,
+65,64,65,65,65,66,65,67,65,68,73,68,65,69,73,69,65,70,65,71,65,72,65,73,65,74,65,75,65,76,65,77,97,78,97,79,97,80,97,81,65,82,65,83,65,84,65,85,65,86,65,87,65,88,65,89,65,90,65,83,65,91,65,85,
+65,92,65,93,65,94,65,95,65,96,65,97,65,98,65,99,65,100,65,100,65,101,65,101,73,97,65,102,65,103,65,104,65,105,65,106,65,107,65,108,65,109,65,110,65,94,65,95,65,111,65,112,65,107,65,108,64,0,64,0,72,246,64,246,
+64,0,64,152,64,247,64,250,65,113,64,0,72,246,64,246,64,0,64,247,64,0,64,0,64,250,64,247,64,247,64,250,64,0,64,0,64,0,65,114,65,115,81,104,65,116,65,116,81,98,65,117,65,118,65,118,65,113,65,119,65,120,65,121,
+64,250,64,247,64,248,65,122,64,0,64,0,65,123,64,0,64,0,64,236,64,0,64,236,64,0,65,119,64,0,64,0,64,246,64,247,65,119,64,250,64,250,64,0,64,247,64,250,64,0,64,0,64,0,64,0,65,113,65,119,72,246,64,246,
+64,246,64,0,64,0,64,0,64,0,64,0,64,0,64,152,64,0,64,247,64,247,64,250,64,246,64,0,65,119,64,250,64,0,64,0,64,247,64,250,64,152,64,152,64,0,64,0,64,152,64,247,64,0,64,0,65,20,65,124,65,21,65,125,
+64,246,64,247,65,119,64,246,64,250,64,152,64,247,64,250,64,0,64,0,64,152,64,0,64,0,64,0,64,0,64,247,64,0,65,119,65,126,65,121,64,246,64,247,64,248,64,248,64,250,64,0,64,248,64,248,65,127,65,128,65,129,65,130,
+65,131,65,132,65,133,65,134,64,0,65,135,64,0,65,135,72,231,64,0,72,231,64,0,65,136,65,137,65,138,65,139,65,140,65,141,65,142,65,143,65,144,65,145,88,205,88,204,65,146,65,147,80,200,80,201,88,205,88,204,64,0,65,135,
+80,200,80,201,72,231,64,0,64,0,65,135,65,148,65,149,72,231,64,0,65,150,65,151,64,0,65,152,64,0,65,153,65,154,64,0,65,155,64,0,64,0,64,0,64,0,65,15,65,13,65,17,65,16,64,220,64,221,64,0,64,0,64,0,
+64,0,65,13,65,15,65,16,65,17,64,221,64,220,64,0,64,0,64,0,65,156,65,157,65,13,65,17,65,158,65,159,64,0,64,0,64,0,65,11,64,0,64,0,65,12,64,0,65,14,64,0,64,220,64,0,64,0,65,18,65,160,65,161,
+65,19,65,21,65,162,65,163,64,0,65,164,64,0,65,165,65,166,64,0,65,167,65,168,65,20,65,169,65,21,65,22,65,170,65,171,65,172,65,173,193,174,193,175,192,0,192,0,193,176,193,177,192,0,192,0,193,178,192,0,193,179,192,0,
+193,180,192,0,193,181,192,0,192,0,193,182,192,0,193,183,193,184,193,185,193,186,193,187,193,188,192,0,193,189,192,0,193,190,193,191,193,192,193,193,193,194,193,195,193,196,193,196,193,197,193,198,193,199,193,200,1,61,1,61,1,61,1,61,
+65,201,65,202,65,203,65,204,65,205,65,205,65,204,65,204,65,203,65,204,65,206,65,207,65,204,65,204,65,207,65,207,65,208,65,209,64,110,64,114,65,210,65,211,64,102,64,106,65,207,65,207,65,207,65,212,65,207,65,206,65,213,65,214,
+65,215,65,216,64,102,64,106,65,203,65,204,65,217,65,218,65,204,65,204,65,219,65,220,65,221,65,222,64,110,64,114,65,215,65,223,64,102,64,106,65,224,65,225,65,226,65,227,65,213,65,228,65,229,65,223,65,207,65,230,65,207,65,231,
+65,232,65,207,65,233,65,234,65,224,65,235,65,226,65,236,65,237,65,238,65,239,65,240,65,207,65,207,65,224,65,224,65,207,65,207,65,213,65,228,65,226,65,226,64,110,64,114,65,241,65,204,65,242,65,243,65,204,65,204,65,219,73,219,
+65,244,65,245,65,246,65,247,65,237,65,238,65,248,65,249,65,250,65,251,65,252,65,253,65,254,65,255,65,248,65,249,65,207,65,207,66,0,65,207,66,1,65,228,66,2,65,223,65,207,65,207,65,201,65,202,65,207,65,230,65,205,66,3,
+65,232,65,207,66,4,66,5,66,6,66,7,66,2,65,223,66,8,66,9,65,226,65,236,66,10,66,11,65,239,65,216,65,206,65,207,66,12,65,207,66,13,65,225,66,14,65,227,65,212,65,207,65,206,65,207,64,101,64,105,64,102,64,106,
+64,109,64,113,64,110,64,114,64,103,64,107,64,104,64,108,64,111,64,115,64,112,64,116,64,0,64,0,66,15,66,16,64,0,64,0,64,0,66,17,66,18,66,19,66,20,66,21,64,0,66,22,66,23,66,24,66,25,66,26,65,207,65,207,
+66,27,66,28,66,29,65,207,65,207,65,207,65,207,65,207,64,0,64,0,66,30,66,31,66,32,66,33,65,207,65,207,66,34,66,35,66,36,66,37,66,19,66,38,66,21,65,207,64,0,64,0,64,0,66,22,66,23,66,24,66,21,65,207,
+66,39,66,40,66,41,66,42,66,43,66,39,66,44,66,41,66,40,66,43,66,42,66,44,66,45,66,46,66,39,66,40,66,47,66,45,66,43,66,39,66,46,66,47,66,40,66,43,66,41,66,42,66,45,66,46,66,44,66,41,66,47,66,45,
+66,42,66,44,66,46,66,47,66,48,66,49,66,50,66,51,66,49,66,49,66,52,66,52,66,49,66,53,66,54,66,50,66,50,66,55,66,50,66,55,66,56,66,57,66,58,66,56,66,59,66,50,66,59,66,50,66,60,66,61,66,62,66,63,
+66,64,66,65,66,66,66,67,66,50,66,68,66,69,66,49,66,70,66,70,66,49,66,49,66,71,66,50,66,49,66,72,66,73,66,74,65,5,65,6,66,75,66,73,65,9,65,5,66,74,66,75,65,6,65,9,65,7,65,8,66,73,66,74,
+65,10,65,7,66,75,66,73,65,8,65,10,66,74,66,75,65,63,65,63,66,42,66,44,65,63,65,63,66,41,66,42,66,76,66,77,66,76,66,77,66,78,66,77,66,79,66,78,66,78,66,77,66,77,66,78,66,78,66,77,66,77,66,79,
+98,80,98,81,98,82,98,83,98,84,65,63,98,85,65,63,98,86,98,87,98,86,98,87,98,88,65,63,98,88,65,63,114,85,65,63,114,84,65,63,66,89,66,90,66,91,66,92,66,93,65,63,66,94,65,63,66,95,66,96,66,95,66,96,
+66,97,65,63,66,97,65,63,82,94,65,63,82,93,65,63,98,98,98,99,98,100,98,101,98,102,98,103,98,104,98,105,98,106,98,107,98,108,104,212,98,109,98,110,104,209,104,208,98,108,104,212,98,108,104,212,104,209,104,208,104,209,104,208,
+66,111,64,0,66,112,64,0,98,88,65,63,98,88,65,63,66,97,65,63,66,97,65,63,65,63,66,45,65,63,66,39,65,63,65,63,66,47,66,45,65,63,65,63,66,46,66,47,65,63,65,63,66,45,66,46,65,63,66,41,66,47,66,45,
+66,39,66,40,66,41,66,113,72,35,64,5,72,36,64,6,66,40,66,43,66,114,66,44,66,45,66,115,66,39,66,116,64,1,64,5,64,2,64,6,66,117,66,47,65,6,66,43,66,41,66,118,66,45,66,46,66,119,66,120,66,121,66,122,
+66,123,66,44,66,46,66,47,65,63,66,47,65,63,66,43,65,63,66,44,66,46,66,47,65,63,66,43,65,63,66,44,65,63,66,47,66,40,66,43,65,63,65,63,66,43,66,39,65,63,65,63,66,40,66,43,65,63,65,63,66,39,66,40,
+66,43,66,40,66,45,66,47,65,63,65,63,65,63,65,63,65,63,66,44,65,63,66,47,65,63,66,43,66,42,66,44,65,63,65,63,66,44,66,41,98,124,98,125,98,126,98,127,98,128,98,129,98,130,98,131,98,132,98,133,98,134,98,135,
+98,136,98,137,98,138,98,139,98,128,98,129,98,140,98,141,98,132,98,133,98,142,98,143,98,136,98,137,98,144,98,145,98,124,98,125,98,146,98,147,98,146,98,147,98,148,96,0,98,144,98,145,96,0,96,0,98,146,98,147,96,0,96,0,
+98,144,98,145,96,0,106,148,98,149,98,150,98,146,98,147,64,0,106,148,98,148,64,0,64,0,106,148,64,0,66,17,64,0,106,148,64,0,64,0,64,1,72,35,64,2,72,36,72,45,72,41,64,74,64,78,72,35,64,5,72,36,64,6,
+64,1,64,5,64,2,64,6,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,
+66,43,66,39,98,242,98,245,98,243,98,246,98,244,98,247,226,210,226,214,226,211,226,215,226,218,226,222,226,219,226,223,226,212,226,216,226,213,226,217,226,220,226,224,226,221,226,225,226,226,226,228,226,227,226,229,226,230,226,232,226,231,226,233,
+98,234,98,238,98,235,98,239,106,238,106,234,106,239,106,235,98,236,98,240,98,237,98,241,106,240,106,236,106,241,106,237
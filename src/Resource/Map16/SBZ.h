@@ -0,0 +1,76 @@
+64,0,64,0,64,0,64,0,192,0,192,0,192,1,192,2,192,3,192,4,192,5,192,6,192,1,192,2,192,7,192,8,192,9,192,9,192,10,192,11,192,9,192,9,192,11,192,11,192,9,192,9,192,11,192,12,192,1,192,2,192,7,192,13,
+192,9,192,9,192,14,200,14,160,15,160,16,208,9,208,9,192,5,192,6,192,17,192,18,192,7,192,8,192,19,192,20,192,17,192,18,192,20,192,20,192,19,192,20,192,20,192,20,64,21,64,21,64,21,64,21,64,21,64,21,64,22,64,23,
+64,21,64,21,64,24,64,25,64,22,64,23,192,5,192,6,64,24,64,25,192,7,192,8,192,26,192,27,192,17,192,18,192,5,192,6,192,28,192,29,192,30,192,31,192,32,192,33,192,34,192,35,192,36,192,37,192,38,192,39,192,40,192,41,
+192,42,192,43,192,44,192,45,192,46,192,47,192,46,192,47,192,20,200,19,192,20,216,19,200,18,200,17,216,18,216,17,200,8,200,7,216,8,216,7,200,6,192,48,216,6,208,48,192,49,192,48,192,46,192,47,192,9,192,9,184,16,184,15,
+192,9,192,9,184,16,160,50,192,9,192,9,160,51,160,50,192,9,192,9,160,51,184,15,192,52,192,53,192,54,192,55,64,56,64,21,64,57,64,21,192,58,192,59,192,60,192,61,192,62,192,63,192,64,192,65,192,0,192,0,192,66,192,0,
+192,67,192,47,208,9,192,68,192,69,192,70,192,71,192,72,192,73,192,0,192,74,192,75,64,76,64,76,192,77,192,78,208,11,192,79,192,80,192,81,192,82,192,83,192,84,192,85,192,86,192,20,192,87,192,88,192,89,192,89,192,89,192,89,
+192,90,192,91,192,89,192,92,192,93,192,94,192,95,192,96,192,89,192,89,192,89,192,97,192,89,192,89,192,98,192,89,192,99,192,100,192,101,192,102,64,76,64,76,192,103,192,77,64,104,64,104,192,105,192,106,64,104,64,104,192,106,192,106,
+192,20,192,20,192,107,192,20,192,20,192,20,192,108,192,20,192,109,192,110,192,111,192,112,192,113,192,114,192,115,192,116,192,89,192,117,192,89,192,89,192,118,192,89,192,89,192,89,192,119,192,0,192,120,192,121,192,122,192,123,192,124,192,125,
+192,20,192,20,192,126,192,20,192,9,192,9,192,11,208,67,192,127,192,128,192,129,192,130,192,131,192,132,192,133,192,134,64,135,64,136,64,21,64,21,192,0,192,0,192,137,192,0,192,20,192,20,192,138,192,20,192,139,192,140,192,71,192,72,
+192,99,192,141,192,101,192,142,192,47,64,104,192,47,64,104,192,143,192,20,192,144,192,145,192,20,192,46,192,20,192,146,208,68,64,104,208,47,64,104,192,147,64,104,192,148,64,149,192,89,208,92,208,90,192,150,192,151,192,152,192,153,192,154,
+192,20,192,109,208,11,192,111,192,110,192,155,192,112,192,156,64,157,192,158,64,159,192,160,192,20,192,52,192,20,192,54,192,53,64,56,192,55,64,57,192,155,192,161,192,156,64,162,64,163,64,21,64,21,64,21,192,164,192,165,192,60,192,166,
+192,167,192,168,192,169,192,170,192,171,192,172,192,115,192,173,192,174,64,135,64,21,64,21,64,136,64,175,64,21,64,21,64,21,64,176,64,21,64,177,64,21,64,178,64,21,64,179,192,180,192,181,192,182,200,46,64,175,64,21,64,21,64,21,
+64,183,64,184,64,21,64,21,64,185,64,186,64,21,64,21,192,187,192,188,64,189,64,190,64,191,192,192,64,21,64,193,208,11,208,11,208,9,192,80,192,79,192,82,192,81,192,84,192,83,192,86,192,85,192,87,192,20,192,20,192,88,192,108,
+192,161,64,163,64,162,64,21,64,176,192,127,64,177,192,129,192,128,192,20,192,130,192,20,64,194,64,195,64,196,64,197,64,198,64,199,64,200,64,201,216,41,216,40,192,202,192,203,64,21,64,183,64,21,64,21,64,184,64,185,64,21,64,21,
+64,186,192,187,64,21,64,189,192,188,192,131,64,190,192,133,192,132,192,20,192,134,192,138,64,178,192,180,64,179,192,182,192,181,192,20,200,46,192,20,64,204,64,205,64,21,64,206,64,21,64,207,64,208,64,209,192,210,200,33,192,211,192,212,
+64,21,64,191,64,21,64,21,192,192,192,122,64,193,192,124,192,123,192,20,192,125,192,126,192,213,192,214,192,215,192,216,192,217,192,218,192,219,192,220,192,221,192,222,160,223,160,224,192,225,192,226,160,227,160,228,192,229,192,230,160,231,160,232,
+192,233,192,234,160,235,192,234,208,36,208,37,192,236,192,237,64,238,64,239,64,240,64,241,64,21,64,157,64,21,64,159,192,158,192,143,192,160,192,144,192,20,192,20,192,145,192,20,192,242,192,242,192,0,192,0,192,243,192,0,192,243,192,0,
+192,244,192,245,192,244,192,245,192,246,192,247,192,246,192,247,192,248,192,234,192,248,192,234,192,249,192,250,192,39,192,251,192,0,200,234,192,0,200,234,200,233,200,230,168,235,168,232,200,229,200,226,168,231,168,228,200,225,200,222,168,227,168,224,
+200,221,192,0,168,223,192,0,192,0,64,252,32,223,64,252,192,246,192,253,192,246,192,253,192,246,192,254,192,246,192,255,193,0,193,1,193,2,192,0,193,3,201,3,193,4,201,4,192,0,192,0,40,223,192,0,192,248,200,247,192,248,200,247,
+200,246,200,245,200,246,200,245,200,244,192,243,200,244,192,243,192,0,192,0,192,3,192,4,192,243,192,0,168,224,192,0,192,244,192,245,160,227,160,228,192,246,192,253,160,231,160,232,65,5,65,6,65,7,65,8,65,9,65,10,65,11,65,12,
+192,0,201,1,192,0,192,0,201,0,200,254,201,2,200,255,192,248,200,247,193,13,193,14,193,15,64,21,193,16,64,21,193,17,193,18,168,235,168,232,65,19,192,0,193,20,192,0,64,21,65,21,193,22,193,23,192,246,192,253,192,246,208,255,
+192,0,192,0,209,2,192,0,161,24,185,24,161,24,185,24,192,253,192,0,192,253,192,0,192,253,192,0,160,232,192,0,200,246,200,245,168,231,168,228,200,244,192,243,168,227,168,224,193,25,64,21,168,231,64,21,192,0,64,252,192,0,64,252,
+64,21,64,21,64,21,64,21,192,246,208,254,193,26,192,247,209,0,209,1,192,248,192,234,161,27,185,24,161,27,185,24,193,28,201,28,193,29,201,29,192,0,200,253,217,2,216,255,217,26,73,21,200,246,201,23,64,21,65,19,201,22,193,20,
+65,30,65,31,64,21,64,21,193,18,193,25,168,232,168,231,201,17,192,234,160,235,192,234,200,247,193,15,193,14,193,16,192,248,192,234,201,13,192,234,161,24,161,32,161,24,161,32,192,0,217,1,192,0,200,234,217,0,216,254,192,248,200,247,
+193,15,64,21,193,15,64,21,64,21,72,252,64,21,72,252,65,33,65,31,65,34,64,21,192,0,65,35,192,0,65,35,64,104,65,36,64,104,65,36,65,31,65,31,64,21,64,21,65,31,65,37,64,21,64,21,161,27,161,32,161,27,161,32,
+65,38,65,39,64,104,64,104,64,104,65,36,64,104,65,36,65,40,65,41,65,42,65,43,65,44,65,45,65,46,65,47,65,38,65,39,64,104,65,48,65,49,65,50,65,51,65,52,65,39,65,39,64,104,65,48,65,53,65,53,65,54,65,55,
+193,56,193,57,193,58,193,59,193,60,193,61,193,62,193,63,65,39,65,39,64,104,64,104,65,35,64,104,65,35,64,104,65,64,65,65,65,66,65,67,65,68,65,69,65,70,65,71,193,72,193,73,192,107,192,20,65,66,65,74,65,66,65,74,
+64,104,64,104,65,48,81,53,65,35,64,104,65,35,64,104,193,75,193,76,192,20,193,77,193,78,193,79,193,80,193,81,64,104,64,104,81,53,81,53,64,104,64,104,64,104,64,104,65,82,65,83,65,66,65,67,65,84,65,85,65,70,65,71,
+192,107,192,20,192,107,192,20,65,86,65,87,65,86,65,87,193,73,193,88,192,20,193,89,192,20,193,89,208,106,193,90,192,107,192,20,208,105,208,106,193,91,193,92,193,93,193,94,65,95,64,104,65,95,64,104,65,39,65,39,81,53,81,53,
+65,49,65,50,81,53,65,96,65,97,65,98,65,99,65,54,65,53,65,53,65,54,65,54,65,100,65,101,65,100,65,101,192,20,193,89,192,20,193,89,193,102,193,103,193,104,193,105,192,20,192,20,192,20,192,20,193,93,193,94,193,106,193,107,
+193,108,193,109,193,110,193,111,193,103,193,103,193,105,193,105,193,103,193,112,193,105,193,113,193,114,193,115,193,116,193,117,64,21,64,21,208,174,208,174,192,20,192,46,192,20,192,46,192,47,64,21,192,47,64,21,193,118,193,119,193,120,193,121,
+193,122,201,122,193,123,201,123,192,11,192,11,192,20,192,20,193,93,193,94,193,93,193,94,193,124,193,124,193,125,193,125,193,73,193,73,192,20,192,20,192,20,192,20,208,106,208,106,64,0,64,0,65,126,65,127,64,0,64,0,65,128,65,129,
+65,130,65,131,65,132,65,133,65,134,64,0,64,0,64,0,65,135,81,134,65,136,65,137,65,138,65,139,65,140,65,141,64,0,64,0,65,142,65,143,65,144,65,145,65,146,64,0,65,142,65,143,65,147,64,0,65,146,64,0,64,0,64,0,
+65,148,65,149,65,150,65,151,65,152,64,0,64,0,64,0,65,153,64,0,65,154,65,155,64,0,64,0,65,156,89,146,65,157,65,158,64,0,65,159,65,160,65,161,64,0,64,0,64,0,64,0,65,144,65,145,65,128,65,129,65,134,64,0,
+65,147,64,0,64,0,64,0,64,0,64,0,64,0,89,134,65,162,64,0,65,163,64,0,64,0,89,146,89,145,89,144,65,164,65,165,64,0,65,166,65,167,89,144,64,0,64,0,64,0,65,168,64,0,65,169,65,170,65,171,65,172,65,173,
+65,174,65,175,65,176,65,177,65,178,65,179,65,180,65,181,65,182,65,183,64,0,64,0,65,184,65,182,64,0,64,0,65,183,65,184,64,0,64,0,65,185,65,186,65,187,65,188,65,189,65,190,65,191,65,192,65,193,73,170,65,194,65,195,
+65,189,65,196,65,197,65,198,89,129,89,128,64,0,64,0,96,0,97,199,96,0,96,0,97,200,97,201,96,0,96,0,97,202,97,203,97,204,97,205,97,206,97,207,97,208,97,209,97,210,97,211,96,0,97,212,97,213,97,214,97,215,97,216,
+96,21,97,217,96,21,97,217,96,21,96,21,97,218,97,218,97,219,97,220,96,21,96,21,97,220,97,220,96,21,96,21,96,0,96,0,96,0,97,221,96,0,96,0,96,21,96,21,96,0,96,0,96,0,97,222,96,0,96,0,97,223,105,223,
+105,223,105,222,97,224,96,0,96,21,96,21,97,225,97,225,96,21,97,217,96,21,97,226,96,21,96,0,97,225,96,0,96,21,97,227,96,21,97,228,97,229,97,230,97,228,97,228,96,0,97,231,96,0,96,21,97,232,97,232,96,21,96,21,
+96,0,96,0,96,0,97,233,97,234,105,234,105,217,97,217,97,217,96,0,97,217,97,235,97,225,97,225,96,21,96,21,97,220,97,236,96,21,97,237,97,225,96,21,96,21,96,21,96,21,96,21,96,21,96,21,96,21,96,21,97,238,97,239,
+96,0,96,21,97,240,105,218,96,21,96,21,105,218,97,218,96,0,97,241,96,0,97,242,105,217,97,217,105,217,97,217,97,243,96,0,97,244,97,233,96,21,96,21,97,245,97,220,96,21,96,21,97,220,97,220,96,21,96,21,97,246,96,21,
+97,217,96,104,97,247,97,248,105,226,96,21,97,249,96,21,96,0,96,0,97,250,105,250,97,250,105,250,97,251,97,252,105,235,96,104,96,21,96,21,105,247,97,247,96,21,96,21,97,244,97,241,96,21,96,21,105,217,96,21,105,217,96,21,
+96,21,96,21,97,253,97,254,96,21,96,21,97,255,98,0,97,253,97,254,98,1,98,2,97,255,98,0,97,228,98,3,96,0,97,233,96,0,97,241,98,4,105,251,98,5,105,251,96,0,96,0,97,233,96,0,97,251,97,252,98,4,105,251,
+98,6,106,6,98,6,106,6,97,228,98,7,97,228,97,228,98,1,98,2,98,8,98,9,97,228,98,3,98,9,98,9,98,8,98,9,98,10,97,228,98,9,98,9,97,228,97,228,96,0,97,242,105,235,96,104,114,4,122,4,98,11,96,21,
+97,241,96,0,97,241,105,235,98,5,105,251,114,4,122,4,98,12,106,12,98,13,106,13,98,14,98,15,98,16,98,2,98,10,97,228,98,10,97,228,97,228,97,228,97,228,97,228,98,10,97,228,97,228,97,228,97,220,97,246,96,21,96,21,
+96,104,98,17,105,248,97,248,98,18,98,18,96,21,96,21,106,17,96,104,105,248,97,248,98,11,96,21,96,21,96,21,98,19,97,220,105,219,96,21,96,21,96,21,97,219,97,220,96,21,97,228,96,21,97,228,96,21,96,21,96,21,98,20,
+96,21,96,21,105,218,105,218,96,21,98,21,96,21,98,22,97,246,96,21,96,21,96,21,98,7,98,23,97,228,97,228,98,23,97,228,105,230,97,228,97,228,97,228,98,14,98,15,98,24,98,25,97,230,97,228,98,25,98,25,97,228,97,228,
+98,6,106,6,98,12,106,12,96,21,98,26,96,21,96,21,105,218,105,218,96,21,96,21,96,21,98,27,96,21,98,28,97,228,98,29,97,228,97,228,97,228,97,228,98,24,98,25,97,228,97,228,98,25,98,25,98,16,98,2,98,8,98,9,
+97,228,97,228,98,9,98,9,97,230,97,228,97,228,97,228,98,13,106,13,97,228,97,228,97,228,98,7,97,228,97,230,98,23,98,23,97,228,97,228,105,227,97,228,97,228,97,228,98,30,98,31,97,228,97,228,98,32,98,32,97,228,97,228,
+96,21,98,33,96,21,97,218,98,34,97,220,98,35,96,21,96,20,96,20,112,106,112,106,96,38,96,39,96,40,96,41,96,42,96,43,96,44,96,45,96,238,96,239,96,240,96,241,97,5,97,6,97,7,97,8,97,9,97,10,97,11,97,12,
+97,28,105,28,97,29,105,29,120,41,120,40,96,202,96,203,97,40,97,41,97,42,97,43,97,44,97,45,97,46,97,47,97,38,97,39,96,104,97,48,97,49,97,50,97,51,97,52,97,3,105,3,97,4,105,4,97,53,97,53,97,54,97,55,
+97,56,97,57,97,58,97,59,97,60,97,61,97,62,97,63,112,36,112,37,96,236,96,237,96,210,104,33,96,211,96,212,97,64,97,65,97,66,97,67,97,68,97,69,97,70,97,71,97,72,97,73,96,107,96,20,97,66,97,74,97,66,97,74,
+96,104,96,104,97,48,113,53,97,73,97,73,96,20,96,20,97,75,97,76,96,20,97,77,97,78,97,79,97,80,97,81,96,249,96,250,96,39,96,251,96,104,96,104,96,104,96,104,97,82,97,83,97,66,97,67,97,84,97,85,97,70,97,71,
+96,107,96,20,96,107,96,20,97,86,97,87,97,86,97,87,97,73,97,88,96,20,97,89,96,20,97,89,112,106,97,90,96,107,96,20,112,105,112,106,97,91,97,92,97,93,97,94,97,95,96,104,97,95,96,104,97,39,97,39,113,53,113,53,
+97,49,97,50,113,53,97,96,97,97,97,98,97,99,97,54,97,53,97,53,97,54,97,54,97,39,97,39,96,104,97,48,96,20,97,89,96,20,97,89,97,102,97,103,97,104,97,105,96,20,96,20,96,20,96,20,97,93,97,94,97,106,97,107,
+97,108,97,109,97,110,97,111,97,103,97,103,97,105,97,105,97,103,97,112,97,105,97,113,97,114,97,115,97,116,97,117,97,124,97,124,97,125,97,125,97,31,97,31,96,21,96,21,98,36,98,37,98,38,98,39,97,118,97,119,97,120,97,121,
+97,122,105,122,97,123,105,123,98,40,98,41,98,42,98,43,97,93,97,94,97,93,97,94,98,44,98,45,98,46,98,47,98,48,98,49,98,50,98,51,98,52,98,53,98,54,98,55,192,20,192,20,208,11,192,79,192,20,192,20,192,82,192,83,
+192,20,192,20,192,86,192,20,64,189,64,190,64,21,64,21,192,133,192,134,64,191,192,192,192,138,192,20,192,122,192,123,64,21,64,193,64,21,64,21,192,124,192,125,64,157,192,158,192,126,192,20,192,143,192,20,64,159,64,160,64,21,64,176,
+80,183,80,184,208,80,208,81,192,84,192,85,64,185,64,186,192,87,192,88,192,187,192,188,192,108,192,20,192,131,192,132,80,135,80,136,208,111,208,112,80,175,64,21,208,156,80,162,208,109,208,110,192,20,192,20,208,155,208,161,208,54,208,55,
+80,163,64,21,80,57,64,21,64,21,64,177,64,21,64,178,192,129,192,130,192,180,192,181,208,52,208,53,192,20,192,46,208,56,64,21,192,47,64,21,64,21,64,179,64,21,64,21,192,182,200,46,200,47,200,46,192,144,192,145,192,127,192,128,
+192,20,192,20,208,11,208,11,192,20,192,20,192,79,192,82,192,20,192,20,192,83,192,86,64,21,64,189,64,21,64,21,64,190,192,133,64,21,64,191,192,134,192,138,192,192,192,122,192,20,192,20,192,123,192,20,208,174,80,135,192,11,208,111,
+80,136,80,175,208,112,208,156,64,21,64,21,80,162,64,21,192,174,192,80,64,21,64,183,192,81,192,84,64,184,64,185,192,85,192,87,64,186,192,187,192,88,192,108,192,188,192,131,192,20,192,20,192,132,192,20,64,193,192,124,64,21,64,157,
+192,125,192,126,192,158,192,143,192,20,208,109,192,20,192,20,208,110,208,155,192,20,208,54,208,161,80,163,208,55,80,57,192,20,208,52,192,20,192,20,208,53,80,56,192,46,208,47,64,21,64,159,64,21,64,21,192,160,192,144,64,176,192,127,
+192,145,192,20,192,128,192,20,64,177,192,129,64,178,192,180,192,130,192,20,192,181,192,20,64,179,192,182,64,21,216,47,200,46,192,20,200,46,192,20,98,56,98,57,98,58,98,59,192,46,194,60,194,61,192,11,192,233,194,62,192,233,194,62,
+192,248,192,234,192,248,192,234,194,63,194,64,194,65,194,66,194,67,194,68,194,69,194,69,64,104,64,104,162,70,162,71,64,104,64,104,162,72,162,73,192,221,192,222,192,221,192,222,192,225,192,226,192,225,192,226,192,233,194,74,34,75,32,235,
+192,233,194,74,192,233,194,74,192,233,194,76,192,233,194,77,194,78,194,79,194,80,64,104,194,81,194,82,64,104,64,104,194,83,194,84,194,85,194,86,162,87,162,88,162,89,162,90,162,91,162,92,162,93,162,94,192,229,192,230,192,229,192,230,
+66,95,66,96,66,97,66,98,66,99,66,97,66,98,66,99,66,97,66,98,66,99,66,97,66,98,66,99,66,97,66,98,66,98,66,99,82,95,82,96,66,100,66,101,64,89,66,102,192,20,194,103,192,20,194,104,194,105,66,106,194,107,66,108,
+64,89,66,109,64,89,64,89,66,110,64,104,66,111,66,112,194,113,194,114,194,115,194,116,66,117,66,118,194,119,66,120,66,121,66,122,64,89,66,123,66,124,64,104,66,125,66,126,192,20,194,127,192,20,192,20,194,128,194,129,194,130,194,131,
+66,132,66,133,194,134,194,135,64,76,64,76,192,77,192,77,66,110,66,136,66,111,66,112,66,124,66,136,66,125,66,126,64,0,64,0,90,118,64,0,64,89,64,89,64,89,64,89,64,89,64,89,64,89,64,97,64,89,64,89,64,98,64,89,
+64,89,64,117,64,89,64,89,64,118,64,89,64,89,64,89,74,118,64,104,64,104,64,104,66,137,66,138,64,0,64,0,66,139,66,140,64,0,64,0,192,187,192,188,66,141,66,142,66,143,192,192,64,0,66,144,66,145,192,158,66,146,192,160,
+64,0,66,147,64,0,66,148,64,0,66,149,64,0,66,150,64,0,64,0,64,0,89,146,64,0,89,147,89,143,89,142,64,0,64,0,64,0,89,147,64,0,89,134,89,129,89,128,89,145,89,144,64,0,64,0,89,143,89,142,64,0,64,0,
+64,9,64,9,56,16,32,50,64,9,64,9,32,51,32,50,64,9,64,9,32,51,56,15,33,27,57,24,33,27,57,24,33,24,57,24,33,24,57,24,33,24,33,32,33,24,33,32,194,151,194,152,194,151,194,153,194,154,64,21,194,155,64,21,
+194,151,194,153,194,151,194,153,194,155,64,21,194,155,64,21,194,151,194,153,194,156,194,157,194,155,64,21,194,158,64,21,194,159,194,160,200,47,200,46,192,20,192,20,208,11,218,61,218,60,200,46,200,47,200,46,98,161,98,162,98,163,98,164,
+96,0,97,202,96,0,97,204,97,203,98,165,97,205,98,166,98,167,97,206,98,168,97,208,97,207,96,0,97,209,96,0,98,165,98,167,98,166,98,168,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,
+64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,100,72,100,73,100,74,100,75,100,76,100,77,100,78,100,79,100,80,100,81,100,82,100,83,100,84,100,85,100,86,100,87,
+100,88,100,89,100,90,100,91,100,92,100,93,100,94,100,95
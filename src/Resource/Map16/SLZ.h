@@ -0,0 +1,52 @@
+64,0,64,0,64,0,64,0,64,21,64,21,64,87,72,87,64,88,64,15,64,88,64,15,64,89,64,15,80,89,64,15,64,90,64,91,64,92,64,93,80,10,80,12,80,9,80,11,72,7,64,94,72,8,64,95,64,96,64,97,64,98,64,99,
+64,97,64,97,64,99,64,99,64,97,64,100,64,99,64,101,64,98,64,99,64,98,64,99,64,99,64,99,64,99,64,99,64,99,64,101,64,99,64,101,64,98,64,99,64,102,64,103,64,99,64,99,64,103,64,103,64,99,64,101,64,103,64,104,
+64,88,64,15,64,105,64,106,64,21,64,107,64,22,64,108,64,0,64,109,64,109,64,110,64,110,64,111,64,112,64,113,64,114,64,115,64,116,64,117,64,118,64,94,64,119,64,95,64,0,64,114,64,0,64,116,64,115,64,120,64,117,64,121,
+64,0,64,0,64,122,64,123,64,0,64,0,64,124,64,125,64,122,64,123,64,126,64,127,64,124,64,125,64,128,64,129,64,126,64,127,64,130,64,131,64,128,64,129,64,132,64,133,64,134,64,135,72,8,64,95,64,136,64,94,72,8,64,95,
+64,0,64,0,64,0,64,137,64,0,64,0,64,0,64,138,64,139,64,140,64,141,64,142,64,0,64,137,64,139,64,140,64,143,64,144,64,145,64,146,64,147,64,148,64,149,64,95,64,0,64,138,64,143,64,150,64,141,64,142,64,147,64,151,
+64,152,64,153,72,8,64,95,64,154,64,155,64,156,64,157,64,158,64,94,72,8,64,95,64,159,64,21,64,160,64,22,64,161,64,162,64,163,64,164,64,165,64,166,64,167,64,168,64,169,64,170,64,171,64,172,64,0,64,0,64,173,64,174,
+64,0,64,0,64,175,64,176,64,177,64,178,72,8,64,95,64,179,64,180,72,8,64,95,64,181,64,182,72,8,64,95,64,183,64,184,64,185,64,186,64,187,64,188,64,189,64,190,64,191,64,192,64,193,64,194,64,0,64,0,64,195,64,196,
+64,197,64,198,72,8,64,199,64,200,64,201,64,202,64,203,64,0,64,204,64,0,64,0,72,15,72,88,64,205,64,206,64,0,64,207,64,0,64,208,64,209,64,210,64,211,64,212,64,0,64,213,64,214,64,215,64,216,64,217,64,218,64,219,
+64,0,64,0,64,0,64,220,64,221,64,222,64,223,64,224,64,225,80,95,64,226,80,94,64,227,64,228,64,0,64,229,64,230,64,231,64,232,64,233,64,0,64,0,64,0,64,234,64,235,64,236,64,0,64,237,64,238,64,239,64,240,64,241,
+64,242,80,95,88,7,80,94,64,0,64,0,64,122,64,243,64,0,64,244,64,245,64,246,64,247,64,248,64,249,64,250,64,251,64,252,64,253,64,233,64,0,64,204,64,0,64,254,64,255,65,0,65,1,65,2,64,0,65,3,64,0,65,4,
+65,5,65,6,65,7,65,8,64,0,65,9,65,10,65,11,65,12,65,13,65,14,65,15,64,0,64,0,64,0,65,10,65,16,65,17,65,18,65,19,65,20,64,94,65,21,64,95,64,0,65,22,65,23,65,24,65,25,65,26,65,27,65,28,
+64,0,65,29,65,30,65,31,65,32,65,33,65,34,65,35,65,36,64,94,72,8,64,95,64,0,65,37,64,0,64,0,64,0,65,38,65,39,65,40,65,41,65,42,65,43,65,44,65,45,64,94,72,8,64,95,64,0,64,0,65,46,65,47,
+64,0,64,0,65,48,65,49,65,50,65,51,65,52,65,53,65,54,65,55,65,56,65,57,65,58,65,59,65,60,65,61,65,62,64,94,72,8,64,95,65,63,65,64,65,65,65,66,65,67,65,68,65,69,65,70,65,71,65,72,65,73,65,74,
+65,75,65,76,72,8,64,95,80,22,65,77,65,78,65,79,65,80,65,81,65,82,65,83,65,84,64,7,65,85,65,86,72,94,64,7,65,87,64,8,64,0,65,88,64,0,64,0,65,89,65,90,64,0,64,0,65,91,65,92,65,93,65,94,
+65,95,65,96,65,97,65,98,72,94,64,7,65,99,64,8,65,100,65,101,64,0,65,102,65,103,65,104,65,105,65,106,65,107,65,108,65,109,64,8,65,110,65,111,65,112,65,113,65,114,64,7,65,115,65,116,64,0,65,117,64,0,65,118,
+65,119,65,120,65,121,65,122,64,0,65,123,64,0,64,0,65,124,65,125,72,15,72,88,64,0,64,137,64,0,65,126,65,127,72,88,65,128,65,129,64,0,65,130,64,137,65,131,65,132,65,133,65,134,65,135,65,16,65,136,65,18,65,19,
+65,137,64,94,65,138,64,95,65,139,65,42,65,43,65,44,64,0,65,140,65,46,65,47,65,141,73,58,65,142,65,143,65,144,65,145,65,146,65,53,65,54,65,55,65,56,65,147,65,58,73,141,65,148,73,142,73,145,73,144,73,53,73,146,
+73,55,73,54,73,147,73,56,65,141,73,58,65,142,73,148,65,149,65,150,72,160,65,151,65,152,65,153,65,154,65,155,65,156,65,157,72,127,65,158,65,159,64,0,65,160,65,161,64,0,64,0,65,162,65,163,64,0,64,0,73,50,64,0,
+65,164,65,165,72,8,64,95,65,166,65,167,72,8,64,95,65,168,65,169,72,8,65,170,65,171,65,172,65,173,65,174,65,175,65,176,65,177,65,178,65,179,64,0,65,180,65,181,64,0,64,0,65,182,72,137,65,183,65,184,72,8,64,95,
+65,185,65,186,72,113,65,187,65,188,65,189,65,190,65,191,65,192,64,0,65,193,65,194,64,0,64,0,65,195,64,0,72,7,65,196,72,8,64,95,65,197,65,198,65,199,65,200,65,201,65,202,65,203,65,204,64,0,64,0,65,205,72,137,
+65,206,65,207,72,8,65,208,65,209,65,210,65,211,65,212,65,213,64,0,65,214,65,213,65,215,65,216,72,8,65,217,65,218,65,219,65,220,65,221,65,213,64,0,65,214,65,222,65,215,65,223,72,8,65,224,65,225,65,226,65,227,65,228,
+65,229,64,0,64,0,64,0,65,230,65,231,72,8,65,232,65,233,65,234,65,235,65,236,72,7,65,237,72,8,64,95,65,238,65,239,65,240,65,241,65,242,64,0,65,243,65,244,65,245,65,246,65,247,65,248,64,0,64,0,65,249,64,0,
+65,250,65,251,72,8,65,252,65,253,65,254,65,251,65,255,64,0,64,0,66,0,64,0,66,1,66,2,72,8,66,3,66,4,66,5,66,6,66,7,64,0,64,137,66,8,66,9,66,10,66,11,72,8,66,12,66,13,66,14,66,15,66,16,
+66,17,64,0,66,18,66,19,64,0,64,0,64,0,66,20,72,7,66,21,72,8,64,95,66,22,66,23,66,24,66,25,66,26,66,27,66,28,66,29,66,30,66,31,64,0,66,32,64,0,64,0,66,33,73,50,66,34,66,35,72,8,64,95,
+66,36,66,37,66,38,66,39,66,40,66,41,66,42,66,43,66,44,66,45,66,46,66,47,66,48,64,0,66,49,66,50,64,0,64,0,66,51,66,52,64,0,64,0,66,53,66,54,64,0,64,0,66,55,66,56,64,0,64,0,65,46,65,46,
+66,57,66,58,72,8,64,95,66,59,66,60,72,8,66,61,72,128,66,62,66,63,66,64,66,65,66,66,66,67,66,68,66,69,66,70,66,71,66,72,65,63,66,73,65,65,66,74,64,0,64,0,66,75,66,76,64,137,66,77,66,78,66,79,
+66,80,66,81,66,82,66,83,66,84,66,85,66,86,66,87,64,0,64,0,64,0,66,88,73,213,66,89,66,90,66,91,66,92,66,93,66,94,66,95,66,96,66,97,66,98,66,99,66,100,66,101,72,8,64,95,66,102,64,94,72,8,64,95,
+64,0,64,0,66,103,64,0,66,104,66,105,66,106,66,107,66,108,66,109,66,110,64,95,66,111,64,94,72,8,64,95,64,0,66,112,64,0,64,0,66,113,66,114,66,115,66,116,66,117,66,118,66,119,64,95,66,120,66,121,66,122,66,123,
+66,124,66,125,66,126,64,95,66,127,66,128,66,129,66,130,66,127,66,131,66,132,66,133,96,0,96,0,98,134,96,0,98,135,96,0,96,0,106,135,96,0,98,136,98,137,96,0,96,0,106,136,98,138,98,139,96,0,96,0,98,140,96,0,
+96,0,96,0,96,0,98,141,96,0,98,142,96,0,96,0,96,0,98,143,98,144,98,145,98,146,96,0,96,0,98,139,96,0,96,0,98,147,96,0,98,148,96,0,98,149,114,134,96,0,98,150,122,147,114,136,98,151,96,0,98,152,96,0,
+96,0,96,0,96,0,98,153,96,0,98,154,98,155,96,0,98,156,106,155,96,0,96,0,96,0,96,0,96,0,98,157,96,0,96,0,96,0,98,158,96,0,96,0,98,159,98,160,96,0,96,0,98,161,96,0,96,0,96,0,98,162,96,0,
+98,163,98,164,98,165,96,0,98,166,98,167,98,168,98,169,98,170,98,171,96,0,96,0,98,172,98,173,98,174,98,175,98,176,98,177,96,0,98,178,98,179,98,180,98,181,98,182,98,183,98,184,96,0,96,0,98,185,96,0,96,0,96,0,
+96,0,98,186,96,0,96,0,98,187,98,188,96,0,98,189,96,0,96,0,96,0,98,160,96,0,98,171,96,0,96,0,98,190,98,191,98,190,98,191,96,0,98,190,96,0,98,192,98,191,98,192,98,193,98,194,96,0,96,0,98,193,98,193,
+96,0,96,0,98,194,98,194,96,0,96,0,98,193,98,194,96,0,98,191,96,0,98,191,98,191,98,192,98,191,98,192,98,191,96,0,98,190,96,0,96,0,98,192,96,0,98,190,98,191,96,0,98,195,98,196,96,0,98,190,98,196,98,195,
+98,192,98,192,98,195,98,196,98,191,98,192,98,195,98,195,96,0,96,0,98,196,98,195,98,191,98,192,98,196,98,192,98,191,96,0,98,191,96,0,98,192,98,192,98,196,98,196,98,192,98,191,98,196,98,195,98,192,98,190,98,195,98,196,
+98,193,98,193,98,195,98,196,98,193,98,193,98,197,98,197,98,193,98,194,98,197,98,197,98,194,98,193,98,197,98,197,98,192,98,190,98,191,98,190,98,190,98,192,98,193,98,193,98,191,96,0,98,193,98,194,98,191,98,192,98,193,98,193,
+98,196,98,196,98,194,98,194,98,195,98,196,98,193,98,194,98,195,98,196,98,198,98,199,98,196,98,196,98,198,98,199,98,196,98,195,98,198,98,199,98,195,98,190,98,198,98,200,98,192,98,191,98,195,98,195,98,192,98,190,98,195,98,195,
+98,191,96,0,98,196,98,195,98,195,98,195,98,198,98,199,98,201,98,202,98,203,98,204,98,205,98,206,98,207,98,208,98,209,98,210,98,210,98,209,98,211,98,212,98,213,98,214,98,215,98,216,98,217,98,213,98,218,98,219,98,213,98,220,
+98,221,98,218,98,222,98,213,98,218,98,223,98,213,98,224,98,225,98,218,98,226,98,213,98,218,98,227,98,211,98,212,98,228,98,218,98,215,98,216,98,229,98,230,98,231,98,232,98,233,98,234,98,235,98,236,98,237,98,238,98,238,98,237,
+98,239,98,240,98,241,98,242,98,243,98,244,98,245,98,246,98,237,98,238,98,238,98,237,64,0,64,0,64,0,66,247,64,0,64,0,66,248,64,0,64,0,66,249,64,0,64,0,66,250,64,0,64,0,64,0,64,21,64,21,64,22,64,22,
+194,251,192,0,194,252,192,0,194,253,192,0,194,254,192,0,64,21,64,25,64,24,64,15,64,88,66,255,67,0,64,22,67,1,67,2,67,3,67,4,67,5,67,6,72,8,67,7,67,8,67,9,67,10,67,11,64,0,64,0,67,12,64,0,
+72,7,67,13,72,8,67,14,67,15,67,16,67,17,67,18,67,19,67,20,67,21,67,22,67,23,67,24,67,25,67,26,67,27,67,28,64,0,67,29,67,30,72,66,67,31,72,67,67,32,67,33,64,0,67,34,67,35,75,32,67,36,64,0,
+64,0,67,37,64,0,67,37,64,0,67,38,64,0,67,39,195,40,195,41,192,0,195,42,195,43,203,40,195,44,192,0,192,0,195,45,192,0,195,45,192,0,195,46,192,0,195,47,192,0,192,0,195,48,195,49,195,50,195,51,227,52,227,53,
+64,0,64,0,67,54,67,55,67,56,67,57,99,58,99,59,131,60,131,61,131,62,131,63,131,64,131,65,131,66,131,67,3,68,3,69,3,70,3,71,3,72,3,73,3,74,3,75,131,76,131,77,131,78,128,0,131,79,131,77,128,0,128,0,
+131,79,139,76,128,0,139,78,131,80,128,0,131,81,131,82,128,0,128,0,131,82,131,82,128,0,139,80,131,82,139,81,35,83,35,84,35,85,32,0,35,86,35,84,32,0,32,0,35,86,43,83,32,0,43,85,35,87,32,0,35,88,35,89,
+32,0,32,0,35,89,35,89,32,0,43,87,35,89,43,88,67,90,67,91,67,92,67,93,67,94,64,0,67,95,64,0,67,96,67,97,67,98,67,99,67,100,64,0,67,101,64,0,72,7,67,102,72,8,67,103,67,91,67,94,67,93,67,95,
+72,7,67,104,72,8,67,105,67,97,67,100,67,99,67,101,200,7,192,94,200,8,192,95,192,21,192,21,192,22,192,22,192,0,193,88,192,0,192,0,193,89,193,90,192,0,192,0,193,91,193,92,193,93,193,94,193,95,193,96,193,97,193,98,
+200,94,192,7,193,99,192,8,193,100,193,101,192,0,193,102,193,103,193,104,193,105,193,106,193,107,193,108,193,109,192,8,193,110,193,111,193,112,193,113,193,114,192,7,193,115,193,116,192,0,193,117,192,0,193,118,193,119,193,120,193,121,193,122,
+192,0,193,123,192,0,192,0,193,124,193,125,200,15,200,88,192,0,192,137,192,0,193,126,193,127,200,88,193,128,193,129,192,0,193,130,192,137,193,131,193,132,193,133,193,134,193,135,193,16,193,136,193,18,193,19,193,137,192,94,193,138,192,95,
+193,139,193,42,193,43,193,44,193,54,193,55,193,56,193,147,193,58,201,141,193,148,201,142,192,0,193,140,193,46,193,47,192,0,192,0,192,0,193,10,193,16,193,17,193,18,193,19,193,20,192,94,193,21,192,95,192,0,193,22,193,23,193,24,
+193,25,193,26,193,27,193,28,192,0,193,29,193,30,193,31,193,32,193,33,193,34,193,35,193,36,192,94,200,8,192,95,192,0,193,37,192,0,192,0,192,0,193,38,193,39,193,40,193,41,193,42,193,43,193,44,193,45,192,94,200,8,192,95,
+192,88,192,15,192,88,192,15,64,0,65,140,65,46,65,47,65,141,73,58,65,142,65,143,201,145,201,144,201,53,201,146,201,55,201,54,201,147,201,56,193,141,201,58,193,142,201,148
@@ -0,0 +1,54 @@
+96,0,96,0,96,0,96,0,64,0,64,145,64,146,64,147,64,148,64,149,64,150,64,151,64,152,64,153,64,154,64,153,64,0,64,145,64,0,64,155,64,156,64,153,64,153,64,153,64,157,64,158,64,159,64,160,64,161,64,162,64,163,64,164,
+64,165,64,166,64,167,64,168,64,169,64,170,64,171,64,153,64,172,64,173,64,174,64,175,64,176,64,177,64,178,64,179,64,180,64,181,64,182,64,183,64,184,64,185,64,186,64,187,64,188,64,189,64,190,64,191,64,192,64,193,64,194,64,195,
+64,196,64,197,64,198,64,198,64,199,64,200,64,201,64,201,64,202,64,203,64,170,64,170,64,171,64,153,64,171,64,153,64,170,64,170,64,153,64,153,64,204,64,205,64,178,64,179,64,206,64,206,64,153,64,153,64,207,64,208,64,186,64,209,
+64,210,64,211,64,190,64,191,64,212,64,213,64,214,64,175,64,215,64,215,64,153,64,153,64,153,64,153,64,153,64,153,64,167,64,168,64,216,64,217,64,167,64,168,64,218,64,219,64,0,64,0,64,220,64,220,64,221,64,222,64,221,64,222,
+64,223,64,224,64,223,64,224,96,225,96,226,96,0,96,0,96,227,96,228,96,225,96,226,96,229,96,230,96,231,96,232,96,0,96,0,96,233,96,0,64,202,64,203,64,169,64,170,64,234,64,235,64,236,64,237,64,238,64,239,64,240,64,241,
+64,242,64,243,64,244,64,245,64,221,64,222,64,194,64,195,64,223,64,224,64,194,64,195,64,246,64,247,64,248,64,249,96,250,96,251,96,252,96,253,64,159,64,160,64,196,64,197,96,254,96,255,97,0,97,1,64,171,64,153,65,2,65,3,
+65,4,65,5,65,4,65,5,64,0,64,0,64,0,65,6,65,7,65,8,65,9,65,9,96,0,97,10,97,11,97,12,97,13,97,14,97,15,97,16,97,17,97,18,97,19,97,20,97,21,97,22,97,23,97,24,64,198,64,198,64,215,64,215,
+97,25,97,26,96,252,96,252,65,27,65,28,65,27,65,28,64,0,65,6,65,29,65,30,65,29,65,30,65,31,65,32,64,0,64,0,64,0,64,220,64,0,64,0,65,33,65,34,64,0,64,0,65,35,65,36,96,225,96,226,96,0,97,11,
+97,10,97,13,97,12,97,15,65,33,65,34,65,37,65,38,65,35,65,36,64,246,65,39,64,157,64,162,64,159,64,164,65,31,65,32,65,40,65,41,65,40,65,41,65,42,65,43,64,165,64,243,64,167,64,245,65,37,65,38,64,180,65,44,
+64,246,65,39,64,248,65,45,97,46,97,47,97,48,97,49,97,50,97,51,97,52,97,53,64,180,65,44,64,182,65,54,64,248,65,45,65,55,65,56,64,196,64,200,64,198,64,201,65,42,65,43,65,57,64,153,65,57,64,153,64,153,64,153,
+64,202,65,8,64,170,65,9,64,182,65,54,64,206,65,58,65,55,65,56,65,59,65,60,97,61,97,62,97,63,97,64,97,65,97,66,96,252,97,67,64,206,65,58,64,153,64,153,65,59,65,60,64,153,64,153,64,215,64,153,64,153,64,153,
+65,68,65,69,64,234,64,235,65,70,65,71,64,238,64,239,64,0,64,0,65,72,65,73,64,0,65,74,65,75,65,76,65,72,65,73,65,77,65,78,65,75,65,76,65,79,65,80,64,0,64,0,64,0,65,74,65,81,65,82,65,83,65,84,
+65,85,65,86,65,87,65,88,64,153,64,153,65,89,65,3,65,90,65,82,65,91,65,84,65,85,65,92,65,87,65,93,65,77,65,78,65,94,65,95,65,79,65,96,65,97,65,98,65,94,65,95,65,99,65,100,65,97,65,98,65,101,65,102,
+64,216,64,217,65,103,64,235,64,218,64,219,64,238,65,104,65,103,64,235,65,105,64,237,64,238,65,104,64,240,65,106,65,107,65,108,65,109,65,110,65,111,65,112,65,113,65,114,65,99,65,100,65,115,65,116,65,101,65,102,65,117,64,153,
+65,115,65,116,64,153,64,153,65,117,64,153,64,153,64,153,65,118,65,119,65,120,65,121,65,118,65,119,65,122,65,123,65,124,65,125,64,167,64,168,65,126,65,127,64,167,64,168,65,128,65,129,65,107,65,108,65,130,65,131,65,111,65,112,
+65,132,65,133,65,134,65,135,65,136,65,137,89,40,89,32,33,138,33,139,33,140,33,139,33,141,33,142,33,141,33,143,32,0,33,144,65,145,65,146,33,147,32,0,65,148,65,149,73,119,73,118,73,123,65,150,65,118,65,119,65,122,65,151,
+33,152,33,153,33,154,33,155,33,156,33,157,33,158,33,159,89,40,89,32,89,31,65,160,89,31,65,160,65,161,65,162,32,0,33,163,32,0,33,144,33,164,32,0,33,147,32,0,32,0,33,144,65,165,65,166,33,147,65,74,65,167,65,76,
+65,118,65,168,65,169,65,170,65,171,65,172,65,31,65,32,73,119,65,173,65,174,65,175,65,176,65,172,65,31,65,32,65,161,65,162,80,153,80,153,65,177,65,178,64,163,64,164,32,0,33,144,32,0,33,144,33,147,32,0,33,147,32,0,
+73,133,65,179,65,180,65,181,65,182,65,183,89,40,89,32,65,118,65,119,65,184,65,185,65,118,65,186,65,187,65,76,73,6,64,0,65,188,65,189,65,190,64,0,65,191,64,0,65,192,65,193,64,102,65,194,65,195,65,196,65,32,65,197,
+65,198,65,199,65,200,65,201,65,202,65,203,65,204,65,205,65,206,65,207,65,208,65,209,97,210,97,211,96,252,97,212,72,148,65,213,72,150,65,214,72,152,72,149,72,154,65,215,64,153,64,153,65,216,65,217,64,153,64,153,65,218,64,153,
+65,219,65,220,65,221,65,222,65,223,73,118,65,224,73,122,65,225,65,226,65,221,65,222,65,227,65,119,65,228,65,123,73,119,73,118,65,229,65,230,65,231,65,232,65,233,65,234,65,235,65,232,65,236,65,234,65,237,65,238,65,239,65,240,
+65,241,65,242,65,243,65,244,65,245,64,153,65,246,65,247,65,248,65,249,65,250,65,251,65,252,65,253,65,254,65,255,65,248,65,249,66,0,65,251,65,252,66,1,65,254,66,2,64,242,66,3,64,244,66,4,64,153,66,5,64,153,64,153,
+64,153,66,5,64,153,64,153,66,6,66,7,66,8,66,9,66,10,66,11,66,12,66,13,66,14,66,15,66,16,66,17,66,18,66,19,66,20,66,21,66,22,66,23,82,22,66,24,66,25,66,19,66,26,66,21,66,22,66,27,82,22,66,28,
+65,7,66,29,65,9,66,30,65,118,65,119,66,31,66,32,73,119,73,118,73,123,66,33,65,118,65,119,65,122,66,34,81,202,66,35,66,12,66,36,66,37,66,38,66,16,66,17,66,39,66,19,66,40,66,41,66,22,66,42,66,43,66,44,
+66,45,66,19,66,46,66,41,66,22,66,47,66,43,66,48,66,49,66,50,66,51,66,52,66,53,66,54,66,55,66,56,66,57,66,58,89,133,66,59,81,202,66,60,66,61,66,62,81,202,66,63,66,61,66,64,66,65,66,66,66,67,66,68,
+66,69,66,70,66,71,66,72,66,73,66,74,66,75,66,76,66,77,66,78,66,79,66,80,66,81,66,82,66,83,66,84,66,85,66,86,89,40,89,32,66,87,66,88,66,89,65,28,64,0,66,90,66,91,66,92,66,93,66,94,65,28,66,95,
+66,96,66,54,66,97,66,98,66,99,73,118,66,100,73,122,66,101,64,166,66,102,66,103,73,119,73,118,66,104,66,105,73,119,66,106,66,107,65,76,64,0,64,0,66,108,66,109,66,110,74,81,66,110,74,81,64,0,66,91,66,111,66,112,
+66,113,66,114,66,115,66,116,66,117,64,244,66,118,66,116,66,119,66,120,66,121,66,120,66,122,66,123,66,124,66,120,66,124,66,125,66,124,66,120,64,202,64,203,66,126,64,170,64,0,64,0,65,33,66,127,64,0,64,0,66,128,66,129,
+66,130,66,131,66,132,66,116,66,133,66,95,66,118,66,116,66,134,66,135,66,136,66,137,65,56,65,56,64,215,64,215,66,138,66,120,66,138,66,120,66,124,66,120,66,124,66,120,66,139,66,140,64,167,66,141,66,142,66,143,65,28,66,116,
+66,144,66,145,66,118,66,116,65,28,66,95,66,118,66,116,66,134,66,135,66,136,66,137,64,0,66,146,64,0,66,146,65,56,64,171,64,215,64,153,64,0,66,146,64,0,66,147,66,148,66,120,66,149,66,150,66,124,66,120,66,151,66,120,
+66,152,66,153,66,154,66,153,66,134,66,155,66,134,66,156,65,56,65,56,66,157,66,157,66,154,66,158,66,159,66,160,65,56,64,171,66,157,66,161,64,153,64,153,66,161,66,161,98,162,96,252,96,252,96,252,64,0,66,163,64,0,66,164,
+64,0,66,165,64,0,66,146,66,121,66,120,66,121,66,120,65,105,64,237,66,166,66,167,64,240,65,106,66,168,66,169,64,236,64,237,66,166,66,167,64,240,64,241,66,168,66,169,66,166,66,167,65,27,65,28,66,168,66,169,65,4,65,5,
+66,170,82,170,66,171,66,172,66,171,66,172,64,116,80,116,66,173,64,203,66,174,66,174,66,175,64,153,66,176,66,175,66,177,65,56,66,178,66,179,66,179,66,179,66,179,66,179,66,179,66,179,66,180,66,181,66,179,66,182,66,182,64,153,
+66,183,66,184,66,185,66,172,66,186,66,187,66,188,66,189,64,116,80,116,64,116,80,116,64,116,80,116,66,186,66,187,66,190,66,191,66,192,66,193,66,194,66,195,66,196,66,197,66,198,66,199,65,122,65,123,66,200,66,58,66,201,66,202,
+66,200,66,58,89,133,66,59,66,200,66,58,66,203,66,204,66,205,66,206,65,122,65,123,65,118,65,119,66,207,65,123,66,208,74,208,66,208,74,208,66,209,74,209,66,208,74,208,66,192,66,193,66,210,66,211,66,196,66,197,66,212,66,213,
+66,200,66,214,66,215,66,216,66,217,65,119,65,122,65,123,65,118,66,218,65,122,65,123,66,200,66,58,66,219,66,220,66,221,74,221,66,208,74,208,66,222,65,119,66,223,65,123,66,190,66,191,66,210,66,211,66,194,66,195,66,212,66,213,
+66,192,66,193,66,192,66,193,66,196,66,197,66,196,66,197,66,205,65,119,66,224,65,123,66,225,74,225,66,226,66,226,66,77,66,77,66,79,66,79,66,227,66,228,66,229,66,230,66,231,72,149,72,154,65,215,64,145,64,148,64,155,64,150,
+66,232,66,233,66,232,66,233,66,234,66,235,66,234,66,235,66,236,66,237,66,238,64,167,66,239,66,240,66,238,64,167,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,64,0,64,0,64,0,66,241,66,242,66,243,66,244,66,245,
+66,244,66,246,66,247,66,248,66,249,66,248,66,221,74,221,64,102,65,194,64,102,65,194,1,138,2,250,1,140,2,251,1,141,1,142,1,141,1,143,72,149,65,32,66,252,65,41,64,0,66,241,66,242,66,243,66,242,66,243,66,244,66,246,
+66,244,66,246,66,249,66,248,66,249,66,253,64,102,65,194,66,254,66,255,74,226,67,0,66,254,67,1,66,226,67,2,0,0,1,163,0,0,1,144,1,164,0,0,1,147,0,0,96,0,96,0,99,3,99,4,96,0,96,0,99,4,99,4,
+99,5,99,4,99,6,96,0,99,7,96,0,99,6,96,0,99,5,99,8,99,9,99,10,99,11,96,0,99,6,96,0,67,12,65,43,64,153,64,153,99,7,96,0,99,6,96,0,99,5,99,4,99,13,99,14,123,3,96,0,96,0,96,0,
+96,0,96,0,99,4,123,3,96,45,96,45,96,0,96,0,99,6,96,0,123,7,99,4,99,6,96,0,123,5,96,0,99,6,123,10,123,11,123,8,123,9,96,0,123,5,96,0,99,9,99,4,123,11,96,0,123,5,96,0,96,0,96,0,
+99,15,99,16,123,7,99,4,96,0,96,0,123,3,96,0,96,33,96,33,96,0,96,0,96,37,96,37,64,0,64,0,96,0,96,0,96,0,96,254,96,0,96,0,96,255,99,17,0,0,1,144,0,0,1,144,1,147,0,0,1,147,0,0,
+0,0,9,147,67,18,67,19,9,144,65,74,67,20,65,76,67,21,67,22,0,49,0,0,67,23,65,112,3,24,0,56,99,25,99,25,64,0,64,0,99,26,99,26,99,27,99,27,99,28,97,0,99,29,97,25,97,1,96,252,97,26,96,252,
+0,0,1,144,65,145,65,146,1,147,0,0,65,148,65,149,99,30,107,30,99,31,107,31,64,0,64,0,64,0,67,32,0,49,0,0,65,107,65,108,3,24,0,56,65,111,65,112,96,252,96,252,99,26,99,26,96,252,96,252,99,33,107,33,
+96,0,96,0,99,34,96,0,99,35,99,35,99,36,99,36,67,37,67,38,72,168,64,167,67,39,67,40,72,168,64,167,99,41,107,41,99,42,107,42,99,43,99,43,99,43,99,43,99,44,99,45,99,46,99,47,99,48,107,48,99,49,96,172,
+96,252,96,252,99,50,99,51,96,252,96,252,99,52,96,252,96,250,96,251,96,252,99,53,96,0,96,0,99,54,99,55,99,56,99,57,99,58,99,59,99,60,99,61,99,62,99,63,96,252,99,64,96,252,96,252,96,0,96,0,99,65,96,0,
+96,252,96,253,96,252,96,252,99,66,96,252,96,252,96,252,99,67,99,68,99,69,99,70,99,71,99,71,99,71,99,71,99,72,99,73,96,252,99,74,96,0,99,75,99,76,99,77,99,78,107,53,99,79,96,252,96,252,96,252,96,252,96,252,
+67,80,64,166,67,81,66,103,194,186,194,187,194,188,194,189,192,116,208,116,192,116,208,116,192,116,208,116,194,186,194,187,194,183,194,184,194,185,194,172,194,170,210,170,194,171,194,172,66,200,65,119,89,133,65,123,192,165,192,166,192,167,192,168,
+192,202,192,203,192,170,192,170,192,153,192,153,192,153,192,153,66,200,67,82,89,133,65,123,65,171,67,83,65,31,67,84,99,85,99,86,99,87,99,36,99,88,96,252,99,89,99,90,99,71,99,71,99,91,99,71,99,91,99,36,99,71,99,36,
+99,71,99,71,99,35,99,35,99,71,99,71,99,71,99,35,99,71,99,36,99,35,99,36,96,252,96,252,107,48,99,92,99,90,99,90,99,87,99,36,99,93,99,94,99,95,99,96,96,252,96,252,99,97,96,252,99,71,99,71,99,36,99,35,
+96,252,96,252,99,98,99,94,96,252,99,71,99,71,99,91,99,71,99,35,99,35,99,35,99,35,99,71,99,35,99,35,96,252,96,252,96,252,99,52,96,172,99,92,96,172,99,99,99,91,99,71,99,71,99,91,99,36,99,36,99,36,99,36,
+99,100,99,101,99,49,96,172,96,252,99,102,99,103,96,172,99,104,99,105,99,71,99,36,99,35,99,36,99,35,99,36,99,49,96,172,99,36,99,106,99,35,99,35,99,35,99,71,99,36,99,106,99,36,99,36,99,71,99,36,99,71,99,36,
+99,35,99,35,99,35,99,35,99,36,99,35,99,36,99,35,99,35,99,36,99,36,99,36,99,90,99,90,99,36,99,36,67,32,67,107,67,107,67,108,67,108,67,109,67,110,67,111,67,112,67,110,65,40,67,113
@@ -0,0 +1,133 @@
+253,175,0,255,248,11,214,0,215,0,216,0,217,0,218,234,248,12,255,253,255,248,9,219,0,220,0,221,0,222,0,223,224,248,22,224,0,225,0,239,251,226,0,227,0,228,237,248,9,1,171,1,172,243,255,229,0,230,247,249,0,231,0,232,
+205,248,11,1,173,1,174,248,175,1,92,159,176,212,233,244,252,250,254,0,103,0,121,207,132,224,177,1,178,212,224,122,38,244,250,254,224,255,179,1,180,244,224,242,121,244,250,253,0,131,0,246,151,179,0,248,179,242,237,0,133,0,234,8,
+39,244,255,63,238,252,39,40,19,40,47,40,46,40,13,32,181,32,185,32,0,221,246,242,240,185,40,181,238,255,127,24,35,40,33,40,30,40,29,32,254,30,32,64,126,246,242,240,248,9,238,8,1,8,38,28,34,254,37,0,254,38,254,232,
+59,242,240,248,9,238,253,1,66,0,118,254,248,17,1,68,120,247,230,254,253,110,1,69,254,248,17,0,114,224,248,13,0,184,221,213,0,182,254,248,11,1,65,224,254,1,67,240,248,13,254,248,46,12,240,9,255,254,193,0,194,0,195,0,
+196,0,197,12,240,22,198,0,199,0,200,247,191,0,201,0,202,12,240,22,203,0,204,0,205,0,206,0,207,254,213,184,232,12,12,240,9,208,0,209,0,210,0,211,184,232,18,76,241,255,253,170,216,212,184,232,20,224,248,15,184,232,15,224,
+248,15,255,16,236,254,235,135,3,32,41,12,243,224,248,22,32,19,32,20,40,254,255,254,51,40,50,40,49,40,48,8,136,224,248,16,36,0,36,32,35,255,95,32,55,40,54,40,53,40,52,40,60,40,59,8,58,160,248,12,255,175,186,244,
+57,8,37,8,36,8,56,40,62,40,61,220,252,62,67,224,248,14,254,253,8,64,8,63,220,144,137,238,36,144,3,224,232,15,1,68,220,144,254,168,168,98,0,240,15,24,245,144,253,98,0,240,63,170,254,10,240,21,255,248,9,10,240,21,
+255,248,9,10,240,9,20,229,1,107,1,10,9,106,181,107,224,255,10,240,9,20,224,9,9,188,248,14,106,246,52,230,10,165,211,224,248,14,213,216,241,254,131,0,133,246,1,180,95,11,242,8,15,225,254,32,16,40,19,32,70,225,237,87,
+52,241,254,248,11,18,128,222,32,17,40,35,32,70,225,56,241,187,202,254,248,11,110,108,255,114,8,184,226,120,247,100,229,140,168,224,108,224,222,88,231,190,138,100,229,224,248,14,1,67,1,64,86,244,116,245,224,252,175,39,76,1,134,8,
+71,222,252,86,240,10,71,0,132,58,255,71,72,252,40,76,40,74,40,69,40,67,32,66,254,248,178,250,69,32,74,32,76,58,253,72,31,170,140,220,40,28,40,27,32,254,28,134,220,58,252,168,170,142,218,252,140,219,120,223,134,221,254,248,
+36,4,208,80,234,73,14,208,12,255,248,9,76,231,250,237,15,8,3,254,4,214,45,105,56,224,10,250,235,96,44,241,254,4,214,224,255,15,111,245,250,235,15,96,32,116,211,35,4,215,224,253,200,252,32,70,18,104,96,118,210,254,156,16,
+212,192,234,234,213,16,200,254,4,241,224,253,132,241,47,254,32,156,213,254,146,244,70,104,234,68,241,224,254,132,242,2,171,33,146,246,200,226,224,248,10,132,244,140,85,146,247,224,234,119,150,240,17,200,254,254,248,23,85,237,200,252,74,253,
+210,252,218,248,22,224,248,61,0,240,22,15,214,210,40,226,1,41,108,243,246,32,42,40,254,93,97,242,225,254,96,16,214,212,216,245,248,22,40,64,187,254,242,224,255,32,116,233,36,8,42,170,212,210,106,234,202,209,96,217,242,26,244,136,
+241,170,171,220,227,104,254,148,228,152,226,26,244,32,18,136,244,220,255,168,170,152,244,204,26,244,136,244,190,225,92,230,216,243,170,170,136,228,208,248,9,158,230,220,192,9,224,248,15,254,248,19,84,229,96,192,16,42,169,80,248,12,36,229,
+0,229,116,209,164,76,245,58,192,16,170,186,224,220,224,254,102,248,17,104,248,9,254,248,111,238,232,18,52,220,31,64,110,117,144,184,9,254,248,10,64,110,224,248,201,64,61,241,254,248,16,224,255,0,152,125,88,254,248,22,224,248,62,1,
+134,0,65,254,1,136,224,248,23,189,85,0,236,254,225,114,32,1,254,248,18,110,0,236,254,225,224,248,22,181,170,38,247,0,248,20,144,216,10,115,122,168,19,88,217,2,160,51,214,248,21,170,170,74,176,9,212,200,21,74,176,9,216,152,
+18,54,176,12,216,152,18,22,176,16,246,248,9,38,17,224,248,28,114,200,9,8,251,246,171,246,90,122,250,234,238,203,3,108,190,255,113,124,96,20,67,149,242,154,32,254,47,30,217,20,219,108,190,175,250,224,125,96,36,118,194,130,197,20,
+219,224,248,9,113,126,97,90,253,137,138,201,242,204,38,86,218,184,187,82,201,113,129,113,128,73,214,113,127,226,6,220,232,208,217,76,242,31,195,32,104,32,105,96,116,254,106,252,0,218,71,112,232,253,84,242,119,224,253,108,40,109,8,254,
+131,146,54,241,111,157,152,216,19,128,216,9,240,146,42,152,216,13,224,248,9,232,220,168,21,116,208,9,234,248,15,248,182,171,170,148,192,232,15,96,253,110,248,14,90,152,12,248,182,66,168,16,234,69,238,225,254,255,70,255,254,255,21,96,
+25,154,205,248,121,213,224,248,12,206,1,136,148,202,254,254,38,248,10,200,253,245,86,40,19,152,242,254,255,65,8,71,116,211,71,200,248,9,24,248,11,188,160,208,75,40,74,144,177,250,200,248,13,202,174,224,254,132,179,4,148,238,30,248,
+10,1,64,16,150,170,170,144,176,10,108,240,12,112,192,18,224,248,14,112,208,22,224,248,57,88,240,11,122,185,90,149,0,208,32,216,240,10,220,248,14,71,96,245,108,245,216,242,92,171,172,85,254,94,170,75,224,227,224,252,31,168,177,92,
+173,96,169,173,170,94,168,10,76,247,114,92,174,96,171,94,175,28,242,184,248,10,170,170,160,240,16,24,240,9,224,240,62,126,232,13,224,248,17,192,208,19,224,248,43,160,208,19,106,85,250,168,18,254,248,144,8,245,14,244,8,226,243,154,
+182,0,226,224,231,95,125,220,227,96,70,0,81,14,224,9,96,219,224,112,12,96,110,0,95,21,86,124,216,9,148,244,224,112,11,224,1,133,144,248,11,160,234,171,160,128,216,11,96,144,248,14,0,136,10,160,243,218,144,248,13,170,170,108,
+227,238,208,14,112,112,13,206,208,20,244,238,160,233,160,128,13,226,237,170,170,20,246,32,244,224,252,0,240,11,224,248,12,42,144,12,166,252,96,232,25,172,170,186,255,10,224,232,9,98,232,17,196,248,13,130,232,17,224,248,13,170,250,130,
+232,17,132,232,39,8,161,254,248,9,172,128,9,8,160,12,254,253,96,19,104,54,106,16,224,248,16,17,116,208,9,96,254,224,248,15,104,176,11,96,212,117,254,224,248,19,144,238,97,68,224,248,21,62,246,96,114,125,141,192,248,22,98,163,
+0,184,97,65,192,248,22,188,205,8,27,234,128,121,123,224,248,27,104,224,124,96,248,20,18,202,115,177,0,1,68,224,125,96,248,25,190,175,194,224,105,137,121,126,224,248,13,198,120,9,158,252,222,57,47,234,127,57,128,57,129,146,241,254,
+64,252,2,240,10,106,31,191,32,116,32,112,40,116,254,105,40,104,32,19,134,95,40,168,16,248,188,109,254,32,109,40,108,32,35,224,248,15,85,85,24,192,16,232,168,21,254,248,42,242,216,11,236,248,20,242,216,10,44,88,15,110,184,11,
+85,85,114,184,15,74,104,17,150,248,19,4,248,13,150,248,18,4,248,14,170,248,37,64,248,73,85,179,166,192,9,152,192,15,246,253,160,208,9,176,195,8,240,170,42,160,192,9,16,216,10,176,195,244,153,240,248,12,16,223,176,197,128,76,
+170,234,242,160,198,16,222,18,221,112,184,10,254,104,39,16,124,241,85,245,0,242,252,248,19,38,252,224,248,59,176,117,224,248,246,26,173,132,0,171,170,239,0,240,252,248,19,76,88,14,254,248,17,74,88,15,254,248,14,132,232,11,42,75,
+124,232,15,52,176,9,246,254,254,168,13,242,8,112,23,168,86,244,254,8,112,23,78,137,222,146,20,0,210,8,112,19,17,84,102,193,244,254,104,128,21,94,128,10,0,215,85,85,10,224,12,114,196,96,193,160,208,9,116,227,106,158,126,86,
+224,248,14,85,85,212,159,240,196,252,193,224,248,10,170,144,10,128,248,13,126,48,13,180,198,85,85,112,252,32,208,12,8,114,248,111,148,187,224,248,13,180,248,12,152,252,80,84,224,194,204,166,252,172,224,248,16,96,184,13,69,85,64,144,
+9,144,220,192,46,144,22,64,248,10,160,240,30,254,248,34,85,85,84,76,255,248,19,72,94,224,248,54,224,231,224,248,118,92,101,224,248,186,85,85,96,240,31,224,248,62,0,112,21,30,112,19,42,112,11,30,112,19,42,112,11,30,112,19,
+213,170,42,112,11,30,112,12,4,19,252,60,233,80,114,244,254,61,255,130,170,4,18,252,60,224,80,113,244,254,224,255,0,65,160,170,252,61,236,112,113,244,255,40,75,0,69,18,19,74,213,10,113,240,10,0,20,224,3,208,57,16,19,0,
+16,18,91,80,138,32,46,236,121,17,0,16,27,242,32,177,0,16,27,85,85,0,228,0,16,26,0,224,13,36,112,17,224,254,232,128,9,154,45,224,255,85,85,0,32,15,240,248,13,0,224,38,254,168,36,64,8,22,62,8,20,178,176,19,
+224,248,87,85,81,10,64,13,214,208,13,144,177,140,181,36,120,18,254,128,85,85,85,36,125,34,123,36,127,112,179,128,84,36,126,130,32,14,128,196,85,85,12,246,136,177,130,32,20,32,200,16,128,136,13,30,136,14,128,136,16,62,136,17,
+85,85,184,202,106,155,0,248,17,8,253,20,203,0,32,44,248,8,74,255,248,20,213,7,248,8,10,255,248,24,248,14,224,248,45,90,0,91,8,252,127,176,224,248,23,15,0,93,0,101,8,252,12,82,213,191,234,32,136,19,40,51,40,102,
+32,13,12,82,18,225,204,11,32,136,13,40,170,85,55,2,230,30,137,184,208,16,0,225,57,2,224,9,176,57,32,136,24,85,85,76,242,224,248,21,64,184,9,224,248,53,14,224,9,192,248,22,240,48,11,224,240,16,85,91,238,66,178,199,
+218,242,248,124,242,237,32,224,210,46,242,209,210,86,254,230,68,232,226,18,242,238,32,224,208,9,220,242,65,85,230,230,152,242,238,224,208,9,220,243,220,225,38,236,85,85,242,238,110,112,12,108,112,9,50,242,68,67,224,252,58,248,9,108,
+117,86,101,224,68,66,230,252,0,120,9,10,236,224,45,180,100,67,0,216,19,71,112,161,26,213,244,201,238,95,240,224,248,16,71,32,82,32,83,130,167,24,224,254,65,32,255,107,77,32,78,32,79,32,80,32,61,32,55,128,167,192,46,21,
+239,215,56,89,52,32,53,226,217,62,0,63,0,57,82,248,10,224,45,119,85,32,32,0,56,240,161,37,0,12,230,224,248,14,248,252,150,208,9,85,181,132,70,224,248,13,194,168,15,192,248,16,194,168,14,192,248,16,8,176,17,3,170,170,
+0,240,22,255,253,254,209,0,240,21,224,254,240,192,12,0,240,10,32,184,9,170,170,0,240,21,100,54,158,200,14,140,63,236,186,20,194,124,56,10,8,248,11,170,42,252,187,32,247,8,248,17,252,187,0,240,27,252,186,100,49,0,240,23,
+40,168,10,22,252,0,240,24,24,128,132,0,240,22,170,170,122,131,160,16,10,0,240,22,224,255,248,224,21,232,241,224,248,13,248,224,17,170,170,224,248,13,248,224,17,0,240,31,224,248,29,96,248,14,180,112,18,224,248,10,22,152,10,170,
+170,178,248,9,192,248,11,58,240,9,20,200,15,224,248,14,186,248,10,224,248,86,52,147,170,170,212,234,224,248,23,62,254,32,248,11,164,98,0,149,224,248,19,92,104,19,160,170,0,22,248,124,188,178,104,10,0,117,152,189,124,189,170,170,
+162,51,124,184,11,150,221,136,175,160,48,15,52,135,248,104,10,124,184,18,170,170,0,80,25,0,224,30,0,208,23,224,254,0,208,23,255,254,0,208,23,0,230,170,64,0,80,10,0,224,12,248,154,32,214,104,240,17,238,202,170,228,32,230,
+224,248,18,228,224,248,10,158,64,12,0,226,170,170,4,210,0,213,204,80,12,0,208,13,0,224,25,104,46,0,208,29,0,224,20,42,169,186,224,12,160,224,19,186,224,11,0,208,22,46,64,232,16,246,168,19,170,170,32,224,37,254,248,25,
+64,152,16,98,80,14,78,120,11,102,159,194,8,10,154,163,182,170,168,44,88,112,18,1,128,164,32,168,40,10,88,112,13,128,164,176,233,178,170,168,41,88,112,14,224,0,135,224,248,108,194,223,224,248,10,170,202,36,228,98,144,13,192,248,
+14,178,40,18,224,248,79,244,174,8,16,14,170,42,96,254,144,9,230,248,10,0,240,32,54,152,28,192,248,15,212,32,25,22,152,21,171,170,224,158,232,10,6,237,186,248,10,40,208,18,224,248,59,166,94,170,170,224,248,24,240,40,10,96,
+255,40,245,10,240,9,224,248,13,238,248,14,224,248,26,170,170,126,143,192,248,54,224,248,25,8,48,13,242,248,10,32,240,44,14,128,18,104,223,170,170,14,128,21,208,240,10,200,80,11,224,248,18,238,248,11,214,224,16,134,192,19,180,232,
+11,170,122,224,248,50,104,221,96,248,9,156,16,13,0,133,200,208,9,164,80,12,21,96,25,213,175,102,220,224,240,12,184,121,16,91,71,1,136,96,32,102,220,36,84,224,248,10,204,68,52,250,19,118,25,0,197,149,101,204,248,12,68,52,
+72,12,254,16,55,204,85,85,68,55,140,255,16,55,204,248,10,60,64,13,204,248,17,254,248,44,224,168,44,85,85,0,224,16,96,152,20,90,168,12,224,248,19,0,224,9,224,248,12,192,168,9,216,200,9,85,85,32,176,25,224,248,53,158,
+160,10,16,242,224,248,17,80,216,14,0,176,16,126,64,13,85,85,160,160,32,0,176,15,122,152,12,232,41,0,176,128,64,248,16,20,224,12,32,248,19,85,85,134,154,94,104,9,192,248,17,218,240,11,32,240,15,186,216,13,120,178,128,240,
+12,85,47,166,248,10,120,179,128,231,128,240,13,92,180,61,32,62,128,231,170,86,224,14,45,228,255,120,177,148,178,134,0,98,128,242,89,245,64,176,10,228,116,244,0,101,124,186,64,178,54,32,170,85,55,200,252,128,224,10,254,253,64,181,
+57,66,96,16,174,208,23,66,101,85,85,36,136,16,34,96,24,14,208,15,224,248,22,28,150,2,96,16,226,40,17,254,248,34,85,21,22,71,4,161,0,162,71,128,9,122,68,22,71,224,248,13,20,84,246,122,69,22,64,10,236,254,252,110,
+100,126,130,84,212,244,22,71,226,254,236,110,100,126,130,234,215,3,252,155,86,67,226,255,58,32,59,32,102,142,153,110,66,106,111,19,24,163,22,69,228,253,60,62,241,54,40,54,84,241,62,111,173,128,81,121,8,103,224,253,39,228,253,34,
+242,37,142,154,111,171,148,154,8,133,32,236,54,65,45,70,153,51,6,240,9,254,248,9,84,223,8,241,178,30,26,97,6,243,1,66,8,118,254,254,0,185,9,244,224,36,178,38,160,175,26,97,254,182,179,114,246,9,69,8,110,154,176,13,
+79,171,224,254,0,184,8,182,254,9,67,14,147,10,237,170,170,224,248,10,236,176,16,38,192,14,224,176,11,138,216,15,242,232,15,70,192,15,242,232,61,170,74,216,56,64,226,152,14,152,192,9,22,248,15,232,253,0,221,0,167,168,162,4,
+188,176,146,0,8,11,128,160,12,188,74,170,176,145,128,64,11,96,160,13,224,240,218,238,220,224,248,73,170,170,248,175,224,255,160,160,11,50,240,12,160,248,21,224,248,22,20,227,224,248,48,170,234,54,160,9,224,248,11,210,237,112,200,15,
+192,248,9,254,252,240,136,25,242,168,24,1,170,170,68,64,200,14,10,160,16,20,236,216,136,15,42,198,158,112,24,206,112,10,170,170,66,157,188,144,13,224,255,156,224,11,224,248,18,4,104,10,248,168,15,74,118,170,170,158,40,83,194,32,
+39,230,224,9,238,248,14,64,248,22,126,254,64,248,21,116,152,10,118,171,96,248,20,98,248,39,64,240,149,8,120,226,248,20,110,192,61,138,234,170,224,250,136,18,224,248,21,80,56,11,224,252,220,120,11,150,80,56,11,96,187,120,114,96,
+1,254,248,12,110,97,182,248,10,224,10,96,140,252,116,254,141,96,142,96,143,224,97,67,96,97,250,80,248,10,224,16,144,254,112,145,112,146,31,133,112,147,112,148,112,149,236,112,248,10,224,225,135,8,183,254,0,144,0,151,16,152,254,223,
+255,112,153,112,154,112,155,224,248,13,96,104,96,105,96,156,112,157,199,19,112,158,112,159,222,160,112,161,224,136,31,94,158,252,224,108,104,109,96,162,126,188,136,112,163,112,164,112,165,222,166,112,167,138,241,14,248,9,176,49,78,199,222,168,
+224,169,96,194,240,170,224,248,21,188,120,172,224,120,171,112,10,227,173,224,248,14,56,116,224,163,96,192,96,245,227,169,112,192,248,15,194,252,174,96,175,96,176,224,166,122,60,96,128,248,15,224,252,177,96,178,162,178,120,177,251,225,32,224,
+248,14,120,167,120,166,24,226,176,120,251,225,175,120,174,224,248,19,104,170,120,169,8,224,168,120,122,88,163,192,245,224,248,15,173,112,171,224,112,172,42,154,143,215,224,248,51,120,170,104,160,104,168,104,160,255,252,236,210,241,65,188,178,192,
+167,104,166,224,165,104,160,62,164,222,192,253,80,46,32,253,104,161,104,160,254,237,222,159,104,158,72,157,64,140,254,255,11,224,255,155,7,120,104,154,104,153,222,254,24,151,24,144,253,127,254,248,9,176,176,9,104,149,104,148,104,147,104,146,
+104,145,8,144,71,253,254,252,0,183,254,178,21,254,252,120,143,120,142,135,127,120,141,120,140,254,96,150,96,107,104,105,104,104,253,85,220,128,19,88,236,96,111,96,109,104,108,224,248,9,42,224,17,238,168,14,85,85,230,72,13,224,248,48,
+198,72,10,192,248,21,108,208,16,244,255,166,216,9,254,248,9,85,85,158,98,0,16,11,255,248,109,138,175,224,248,22,138,175,224,248,22,138,168,10,85,183,255,248,20,138,175,255,248,26,170,173,224,248,59,1,10,224,248,30,9,183,111,226,
+248,24,15,0,234,2,169,11,225,248,23,32,16,32,20,100,169,19,111,85,224,248,24,17,32,36,232,81,35,160,248,24,210,197,224,248,32,32,96,18,85,85,82,200,12,64,96,18,82,206,64,72,10,70,72,14,64,72,16,100,48,17,128,48,
+13,85,85,6,192,12,160,48,18,2,168,25,64,248,13,2,168,16,0,148,132,132,66,184,10,73,7,132,51,254,2,149,132,131,40,67,254,213,87,132,128,12,104,130,2,148,132,131,40,28,32,27,132,128,11,128,172,171,162,64,209,64,132,132,
+144,153,136,130,132,132,234,168,162,96,180,94,216,155,238,254,248,253,234,170,170,98,231,54,148,238,254,248,252,234,254,254,248,9,238,254,230,248,17,10,255,76,160,59,128,146,20,150,255,193,0,194,0,195,0,196,85,248,0,197,104,247,128,146,
+20,150,255,198,0,199,0,175,32,200,0,201,0,202,128,175,128,146,249,146,18,253,247,255,203,0,204,0,205,0,206,0,207,224,255,133,8,74,127,131,158,41,20,146,255,208,0,209,0,210,0,211,245,255,128,234,224,252,156,243,47,40,185,40,
+181,40,49,40,48,8,88,227,58,230,212,96,236,224,253,36,254,35,255,95,32,55,40,54,40,53,40,52,40,60,40,59,8,136,224,248,11,251,103,254,253,57,130,241,36,8,56,40,62,40,61,220,240,249,184,32,168,20,8,64,8,63,220,51,
+40,95,73,86,40,78,40,77,40,218,233,44,104,15,220,144,254,85,85,128,225,50,184,10,32,152,10,144,253,238,121,74,56,20,76,232,21,184,248,18,85,85,210,176,9,240,226,106,78,248,144,9,178,176,12,246,143,56,109,28,236,85,85,178,
+176,9,126,112,20,254,248,31,14,240,9,255,248,21,14,240,9,255,248,21,14,240,9,85,93,255,248,21,14,240,9,255,248,25,14,244,224,248,85,50,25,0,213,48,24,9,173,86,184,208,16,132,99,96,48,31,224,248,16,26,227,96,48,24,
+9,255,248,15,85,85,160,150,224,248,193,108,192,21,224,248,9,108,192,21,224,248,9,108,192,21,224,248,9,85,85,108,198,152,248,13,252,230,126,220,140,194,152,248,13,224,254,126,220,82,73,224,152,248,13,224,254,126,220,224,4,192,12,85,
+215,2,211,152,81,126,221,44,198,36,199,41,72,254,252,124,217,150,173,181,200,217,139,68,192,10,110,0,103,33,238,217,226,42,164,222,224,252,110,1,10,252,127,0,210,164,220,33,173,220,184,110,1,9,0,112,14,72,171,128,222,220,110,1,
+11,238,109,196,55,95,148,220,248,10,51,32,47,32,19,142,104,11,254,40,38,170,86,220,55,122,202,138,28,10,200,9,28,32,10,57,254,72,36,8,240,23,85,85,192,184,9,8,240,21,224,248,9,8,240,21,224,248,9,116,176,21,96,184,
+13,148,176,17,245,65,224,248,40,190,88,9,255,253,186,0,187,8,252,224,248,9,249,139,190,88,10,255,188,0,191,8,188,104,68,37,191,254,0,190,88,10,255,158,90,192,32,47,33,72,170,234,254,252,224,248,12,130,95,0,192,9,224,255,
+228,254,130,91,134,240,9,8,87,29,3,8,133,0,126,90,228,254,136,77,234,238,40,19,176,170,156,230,27,228,252,234,252,46,116,12,212,164,87,28,179,174,196,188,190,103,1,67,8,28,211,110,112,13,213,32,234,254,254,248,42,237,216,19,
+42,168,15,15,58,184,211,160,228,52,254,74,171,244,172,215,32,146,58,16,86,170,252,254,248,12,172,211,98,242,32,17,145,170,58,252,254,248,12,108,219,98,243,198,104,14,116,85,228,47,255,103,0,121,36,67,36,48,19,224,248,10,254,112,
+13,233,138,36,53,255,131,0,133,132,48,18,132,60,238,104,58,72,252,40,76,0,180,32,66,254,254,172,76,217,85,128,94,68,0,181,40,27,254,168,15,126,244,0,182,85,85,138,74,130,48,44,254,248,26,78,168,14,224,248,87,255,248,91,
+164,186,255,248,27,85,85,164,186,255,248,27,164,186,255,248,27,164,186,136,248,23,44,190,72,238,85,85,254,184,11,44,184,10,82,232,13,44,184,17,82,232,13,44,184,18,158,80,9,108,184,21,177,5,146,239,124,39,224,248,10,213,182,226,
+252,189,80,146,232,11,124,201,46,40,13,6,57,254,46,4,210,213,170,100,235,146,232,10,122,159,238,248,9,35,146,232,11,122,152,12,238,252,74,146,0,224,52,255,248,44,196,168,27,255,196,168,27,255,164,127,196,168,27,255,152,241,154,128,
+28,212,1,107,1,9,9,107,171,170,224,248,24,213,80,218,72,220,246,232,18,68,219,0,37,246,232,19,170,170,152,129,254,190,246,232,20,120,207,150,240,10,224,248,12,132,222,224,255,86,21,136,219,246,238,8,128,233,132,221,6,18,246,232,
+14,248,233,212,170,254,10,246,6,18,246,232,17,28,10,247,16,44,246,232,15,170,170,254,34,246,216,26,0,226,12,32,11,255,248,19,224,248,40,140,228,224,248,23,170,170,184,152,89,18,224,9,248,152,21,134,248,9,224,248,21,134,248,9,
+224,248,21,134,248,9,89,107,152,152,25,212,26,224,248,18,46,27,39,122,234,126,233,213,133,170,8,244,22,31,242,3,20,228,130,238,254,216,10,170,170,232,254,12,243,130,238,8,244,246,233,244,237,0,225,20,227,170,194,12,183,8,243,250,
+235,232,253,2,240,19,70,40,12,126,41,189,190,40,41,224,144,28,20,40,20,236,224,13,224,144,13,0,36,8,36,234,91,236,224,14,0,248,11,0,46,128,152,30,1,169,1,170,252,248,20,66,240,179,184,160,192,241,0,242,252,248,20,230,
+226,187,170,170,224,248,23,54,65,236,161,192,248,26,76,230,224,248,55,2,114,224,248,27,170,170,2,115,224,248,26,50,113,96,248,92,224,248,31,106,200,12,108,236,36,176,12,85,170,116,216,11,46,104,206,240,232,9,108,239,254,30,232,183,
+138,170,16,240,9,108,238,230,180,244,220,208,9,70,163,136,88,21,170,170,240,139,228,170,220,32,13,226,64,10,240,138,4,179,8,96,20,240,140,170,126,224,255,254,248,14,124,210,240,138,228,169,224,248,16,71,32,82,32,83,162,253,10,22,
+96,19,80,8,9,32,77,32,78,55,2,32,79,32,80,82,161,55,30,24,238,95,22,96,35,224,253,21,96,25,32,52,32,53,104,225,171,175,56,162,57,10,252,20,59,224,252,31,96,32,0,210,106,170,210,56,166,32,62,224,255,184,37,114,
+35,246,84,240,65,170,170,66,224,248,14,82,248,9,212,91,224,49,224,248,13,188,24,10,224,248,20,170,170,32,32,16,0,144,22,190,176,11,0,144,19,50,208,11,0,144,9,182,248,9,50,208,11,170,170,0,144,9,182,248,9,50,208,15,
+160,148,182,136,13,178,208,11,224,252,182,136,13,178,10,224,248,17,246,248,13,224,32,92,224,248,26,32,91,170,164,234,144,235,14,130,224,248,14,188,235,224,18,130,170,103,140,234,224,248,23,18,130,140,234,224,248,15,237,0,246,138,169,10,
+144,234,252,234,116,186,112,187,254,169,250,85,254,134,185,160,226,137,32,181,32,185,142,233,14,209,254,248,14,85,85,160,224,9,164,226,14,209,254,248,13,134,123,136,158,246,200,10,0,144,59,85,175,64,160,75,128,245,78,192,21,250,233,28,
+227,155,1,156,140,88,24,47,93,160,241,1,157,1,158,212,184,24,224,159,1,160,212,184,24,175,178,0,146,149,1,150,30,200,16,194,237,82,136,14,118,72,47,248,235,224,242,33,161,33,162,82,136,10,75,248,118,248,235,224,242,1,163,1,
+178,132,164,46,216,10,118,248,235,224,175,7,242,1,151,1,152,0,160,10,122,107,8,180,8,248,233,181,2,241,104,33,147,33,148,10,176,10,248,66,13,170,239,244,237,0,160,101,64,160,98,36,80,63,0,160,125,33,165,33,166,0,160,27,
+1,251,234,167,1,168,0,160,27,9,146,9,145,0,160,13,246,136,9,0,164,41,254,31,144,0,160,121,8,255,8,254,8,253,8,252,0,251,0,142,232,252,253,0,255,248,254,234,248,9,9,183,143,3,9,2,9,57,26,251,153,194,1,3,
+1,4,197,15,236,4,234,248,9,232,5,1,6,1,7,170,62,183,198,252,254,248,13,234,248,15,212,248,27,254,248,27,1,57,1,54,136,227,252,240,248,12,238,9,55,250,92,127,8,1,93,1,62,1,61,1,59,252,9,49,2,248,62,252,
+63,252,240,225,63,238,236,1,27,1,28,1,29,1,30,30,66,248,101,1,95,254,9,250,42,132,143,240,250,12,9,14,1,17,31,15,254,31,1,32,1,33,254,112,1,43,99,132,234,9,94,246,46,252,244,255,143,18,17,18,9,22,1,21,
+1,35,1,98,1,47,199,72,254,113,1,109,254,50,252,120,248,240,250,9,25,1,254,47,9,53,1,240,4,53,252,9,52,1,51,252,225,196,254,25,252,52,17,53,254,192,211,240,252,230,0,248,228,17,32,17,51,248,246,252,228,244,96,18,
+238,248,249,254,248,254,49,151,234,252,9,242,16,242,252,243,145,246,8,252,0,250,24,252,41,50,230,248,250,238,240,28,37,254,8,250,16,240,188,253,246,224,44,228,238,24,244,254,252,1,16,244,236,232,244,147,170,210,244,255,248,33,224,72,
+21,255,248,9,224,72,21,170,218,255,248,9,224,72,21,255,248,9,224,72,21,255,248,13,0,80,17,162,228,102,224,248,24,191,254,90,0,91,8,90,1,103,0,192,16,255,254,93,0,101,8,93,213,170,1,104,0,198,226,248,14,50,82,102,
+250,74,32,198,228,248,14,90,85,250,79,224,248,14,250,72,17,131,0,197,166,161,228,248,10,204,153,20,84,11,213,0,195,50,224,73,252,51,222,72,13,20,84,134,60,37,85,32,26,2,226,228,26,32,15,134,60,142,88,35,250,216,22,63,
+213,210,32,16,32,41,32,42,40,254,41,202,211,255,248,12,123,170,104,18,96,240,137,32,22,40,254,20,202,210,150,212,224,248,14,238,162,36,238,138,254,202,210,224,248,14,128,248,30,107,171,96,1,97,228,16,13,224,248,16,96,234,243,24,
+188,16,9,224,248,20,14,170,214,64,9,128,184,11,113,123,224,146,55,84,21,0,245,85,131,224,252,124,224,252,148,152,12,32,244,224,252,125,224,190,254,146,48,13,224,248,11,113,126,97,137,136,240,18,128,185,49,129,49,128,49,128,136,127,
+226,162,72,232,15,166,72,64,254,32,104,32,105,32,116,135,250,254,0,106,0,252,112,4,16,9,96,254,32,108,40,209,160,109,8,254,170,201,111,157,178,8,13,170,214,68,152,12,16,254,96,248,15,236,8,31,255,248,252,32,193,243,254,248,
+29,192,248,31,247,21,1,181,1,182,252,248,27,0,124,0,125,252,248,252,252,248,252,239,123,252,99,0,100,252,248,27,32,126,32,127,252,248,28,128,32,129,239,91,252,248,27,0,128,0,252,248,60,32,112,32,107,254,254,96,254,253,191,240,
+238,248,9,32,106,64,114,64,90,121,254,121,137,105,31,254,127,105,128,105,129,97,254,128,97,127,97,139,65,220,119,73,254,71,124,220,25,137,9,126,234,224,11,97,79,24,63,222,1,73,254,71,8,122,1,82,44,156,224,9,125,238,80,13,
+254,97,75,97,197,182,224,190,162,224,124,224,248,16,76,224,248,12,123,216,109,176,72,13,224,77,224,248,11,25,83,104,224,15,113,224,248,13,80,113,247,224,248,16,160,9,78,224,254,24,84,224,248,16,75,105,143,248,78,9,130,1,74,148,
+62,1,140,9,66,121,86,226,248,12,32,138,226,252,110,122,9,120,126,220,141,9,85,9,186,97,120,97,121,253,255,226,248,9,188,196,8,110,33,114,33,115,33,116,33,117,33,118,175,119,33,119,33,138,105,226,252,0,130,20,40,123,144,240,
+10,107,0,26,134,254,117,32,208,81,32,250,248,161,123,226,36,40,130,32,109,254,0,113,8,254,248,11,111,224,95,32,250,130,90,80,226,22,192,19,246,201,110,20,169,250,246,184,22,224,248,11,21,189,0,240,9,2,246,0,240,51,226,0,
+240,12,1,79,1,119,69,0,240,10,96,1,105,0,240,16,1,75,224,252,128,242,224,87,110,0,240,16,1,76,224,248,12,0,240,12,224,77,224,248,11,121,107,20,0,240,16,17,224,248,13,0,240,16,17,160,0,246,250,222,224,120,0,240,
+16,17,75,9,131,0,240,9,97,140,105,0,240,12,245,51,17,79,226,254,0,246,97,141,105,85,105,186,128,254,179,145,226,248,9,0,246,1,114,105,88,105,255,101,87,41,96,41,106,41,105,41,131,41,0,240,24,254,85,173,0,240,18,254,
+248,12,0,240,74,32,160,157,224,248,161,54,53,233,44,55,86,106,255,248,15,136,124,234,224,248,23,202,73,254,18,224,248,24,56,174,250,254,110,160,248,24,130,8,21,224,248,41,255,248,184,1,91,1,171,173,103,9,91,222,248,28,226,142,
+255,248,19,15,128,97,104,102,241,86,85,232,168,23,232,107,32,32,152,14,232,8,15,0,145,255,248,23,232,11,160,160,26,149,171,224,248,135,154,112,9,0,112,10,244,254,242,255,140,116,38,255,0,119,244,253,2,242,52,112,17,9,8,9,
+7,9,6,221,175,9,5,10,112,41,1,54,236,248,27,9,57,1,56,1,22,113,112,250,226,248,12,240,56,9,54,234,9,62,9,61,219,227,1,60,9,2,116,63,242,107,93,9,92,240,60,233,189,1,59,234,1,12,1,13,22,113,40,1,
+41,112,135,8,113,248,13,1,15,240,248,10,108,9,252,255,191,18,1,21,9,43,1,44,1,45,1,46,17,43,9,19,14,198,14,113,240,255,1,100,238,20,113,50,252,35,68,48,1,49,248,254,38,254,111,111,240,248,9,35,1,36,16,116,
+1,14,117,17,51,9,254,107,9,85,66,254,111,28,116,4,118,254,252,238,218,82,153,238,30,114,254,248,9,66,116,236,85,85,208,240,254,254,248,13,24,112,9,240,248,19,20,116,244,248,11,254,248,28,85,85,106,245,16,240,16,254,89,234,
+92,4,240,9,16,243,108,245,254,90,173,81,0,101,32,240,27,9,226,232,34,6,96,30,55,204,4,103,181,154,248,236,6,244,176,253,59,2,97,18,242,10,98,63,81,160,246,240,6,243,242,236,250,13,108,10,98,254,248,26,100,1,94,1,
+99,232,248,17,9,87,207,236,28,1,30,224,233,28,241,18,97,111,1,110,68,67,252,250,254,110,9,236,37,53,70,228,90,26,241,24,243,17,254,9,254,85,43,18,243,0,241,2,100,230,233,20,102,249,46,241,34,247,74,170,230,236,89,248,
+6,240,14,254,239,0,240,16,170,170,44,244,4,240,15,28,240,36,254,248,28,146,240,12,242,72,10,254,248,18,8,80,11,170,162,38,240,11,42,80,49,206,248,41,16,244,252,217,14,240,9,248,122,21,242,73,240,253,24,243,59,9,61,254,
+219,16,242,240,218,228,218,252,254,235,242,108,24,225,6,226,17,246,221,132,96,13,248,240,250,240,252,32,253,141,6,83,16,82,23,9,21,17,21,1,12,82,22,16,172,248,254,18,248,246,217,36,6,81,225,2,12,225,9,252,25,9,26,14,
+81,250,0,4,244,252,254,38,248,86,82,244,10,227,252,220,246,254,252,252,76,85,85,240,252,12,230,0,224,13,230,248,9,24,247,248,252,240,252,254,216,19,85,85,40,224,13,2,240,69,0,80,35,255,248,252,255,248,63,18,23,132,44,244,
+248,12,149,85,0,163,130,40,10,244,248,15,250,24,21,18,36,244,248,13,85,85,0,35,34,80,10,244,248,15,18,80,11,224,248,24,4,208,12,104,228,248,216,13,85,85,4,208,15,0,48,15,28,224,29,242,248,17,10,224,17,0,192,19,
+22,192,10,20,193,21,173,222,252,250,217,246,205,236,246,254,58,12,211,42,169,4,227,6,225,250,219,254,201,234,248,217,240,185,133,106,0,54,39,252,184,10,252,15,4,51,246,218,0,52,34,133,187,254,217,12,196,248,19,1,20,252,218,1,
+23,86,128,228,186,0,211,37,254,217,12,198,246,240,88,85,26,254,24,2,50,232,217,34,209,52,193,18,225,82,144,252,8,194,248,218,238,250,186,53,43,234,242,202,230,43,9,238,228,253,4,227,169,162,246,240,44,246,222,190,44,214,216,9,
+244,214,40,236,221,2,51,248,250,42,238,252,16,244,244,41,179,4,252,228,216,47,232,164,74,254,248,206,44,254,252,8,52,254,40,11,160,170,242,246,114,240,16,6,176,19,82,208,10,242,232,17,254,248,25,170,170,2,192,15,16,208,23,0,
+240,27,12,243,0,241,14,34,4,212,226,248,13,170,10,12,243,20,177,16,244,10,209,254,172,252,169,248,171,221,53,236,16,22,242,9,14,12,178,8,96,254,248,15,238,233,23,222,125,254,21,9,20,12,178,8,97,254,248,15,1,45,9,24,
+172,187,254,26,2,209,0,241,8,98,254,248,15,1,49,170,170,0,209,12,243,38,242,16,35,248,255,254,252,4,244,12,212,82,85,248,28,22,245,244,52,236,233,18,240,10,252,238,6,37,150,72,254,6,36,238,236,12,244,85,85,24,244,26,
+243,238,237,234,237,254,239,206,254,0,242,22,34,85,85,14,244,2,244,230,28,252,238,108,244,8,192,41,62,181,64,176,30,65,85,206,232,12,244,246,253,242,168,17,252,232,37,252,156,250,170,5,85,250,152,11,236,187,236,16,19,252,158,12,
+227,250,155,93,65,4,243,234,233,9,94,18,240,12,4,18,254,250,188,136,90,248,27,240,10,240,10,0,227,112,2,18,135,168,248,153,18,9,250,32,240,10,240,10,223,130,0,227,113,9,37,9,36,2,193,113,234,219,240,170,5,0,241,30,
+242,14,244,16,182,244,170,17,0,227,250,69,85,10,242,46,18,236,244,237,24,246,2,19,2,199,37,85,230,239,12,231,228,38,246,248,252,250,255,0,195,85,81,30,242,244,254,28,244,224,221,246,254,230,18,16,11,85,85,2,224,13,232,237,
+255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,85,85,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,85,85,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,
+255,248,252,255,248,252,85,85,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,85,85,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,0,240,1,255,248,252,255,248,252,21,0,255,248,252,255,
+248,112,0,240,0,0,0,0,0,0,0,0,0,0,0,0
@@ -0,0 +1,160 @@
+125,79,0,255,253,96,10,96,11,244,248,9,32,11,32,231,63,252,1,96,2,244,22,32,23,96,173,96,13,76,8,240,32,2,232,244,225,25,254,12,240,96,3,96,4,248,15,30,216,0,10,0,232,240,253,0,1,0,14,31,240,5,0,6,
+236,64,11,64,173,0,126,128,254,3,0,4,0,12,0,232,246,123,120,22,0,23,240,253,7,0,8,236,64,13,64,106,193,51,214,252,194,248,255,18,0,19,190,194,162,252,194,64,107,214,252,194,103,68,248,254,20,0,21,190,252,224,2,32,
+206,174,252,206,122,129,244,14,0,15,0,172,252,234,4,130,128,136,252,252,206,248,95,32,9,0,16,0,17,0,172,252,242,128,129,136,200,248,11,226,132,246,16,74,214,244,98,64,68,254,64,68,200,236,132,246,8,12,56,244,98,128,68,64,
+232,204,196,246,42,1,176,242,254,128,254,138,252,196,246,73,64,176,242,254,128,150,138,142,84,196,252,200,255,172,238,243,64,6,68,32,224,84,210,246,200,255,58,19,172,238,243,64,8,128,140,8,76,194,188,240,11,212,40,184,68,128,156,3,
+64,214,242,246,204,248,206,138,236,246,104,59,104,170,244,58,8,246,255,248,19,232,234,220,248,27,32,96,22,96,54,168,23,220,248,23,64,214,242,107,98,220,248,23,0,241,95,165,130,246,18,96,19,96,106,220,248,15,0,241,130,246,6,161,
+138,107,96,182,173,220,248,11,0,251,198,232,11,168,18,182,76,220,255,128,235,198,232,11,182,181,2,76,173,148,252,64,198,232,15,184,254,152,96,65,148,4,64,198,232,13,250,184,254,80,80,246,192,236,208,254,198,66,246,248,254,21,84,122,
+233,64,241,208,254,56,60,254,52,255,64,243,34,149,210,64,190,232,9,188,236,192,230,72,173,210,64,202,254,176,242,192,230,173,56,241,146,238,66,254,248,246,240,240,226,232,235,64,2,24,246,64,43,248,22,64,23,2,243,244,236,240,232,237,
+96,5,32,175,103,6,32,96,32,97,28,226,12,227,106,32,173,244,242,95,232,0,249,96,7,96,8,96,98,96,99,208,241,149,244,8,228,126,242,86,242,232,236,217,123,243,100,0,132,151,101,172,14,96,0,97,218,229,144,239,48,64,224,102,
+0,103,52,244,64,75,200,98,64,99,214,245,48,64,151,84,224,104,0,105,49,245,182,214,244,244,243,226,233,17,73,255,248,13,182,204,154,124,243,148,153,212,255,248,13,182,154,6,9,220,96,64,252,255,248,19,154,233,151,220,252,104,76,104,
+75,8,74,154,248,17,136,36,220,252,12,220,248,16,154,34,95,220,114,144,241,96,14,96,15,220,248,20,20,85,252,192,219,48,72,235,148,248,18,192,239,85,171,72,234,108,234,220,248,14,192,239,130,236,107,148,210,220,248,11,10,170,242,241,
+238,234,2,228,252,164,211,76,227,220,253,36,232,8,243,252,10,228,254,244,253,40,254,104,171,136,78,8,77,12,224,16,240,234,0,242,112,234,164,218,222,248,16,240,235,0,244,107,64,112,222,248,15,138,170,160,242,128,242,128,235,112,188,248,
+15,200,242,92,242,170,124,116,234,4,235,192,241,222,248,11,196,242,188,64,97,64,85,181,4,237,188,248,23,222,233,14,234,190,241,222,248,14,188,254,107,170,170,210,227,210,235,162,241,188,248,17,130,223,124,241,36,233,188,248,15,42,171,128,
+241,136,208,9,28,202,188,248,14,64,12,214,84,242,172,36,188,248,14,64,12,214,36,226,86,222,248,10,171,42,128,72,242,198,222,196,227,240,240,9,64,219,252,232,11,169,80,144,240,240,10,0,227,252,238,254,106,232,219,85,85,4,227,104,
+244,16,227,252,238,178,193,252,235,4,227,84,193,244,170,188,4,208,28,58,96,59,228,248,27,8,195,228,248,23,232,162,176,186,132,228,248,20,173,96,184,212,120,171,65,228,248,16,5,96,242,196,192,216,11,228,254,9,170,242,199,149,128,56,
+211,192,252,172,253,202,170,117,85,200,238,241,254,187,64,106,228,253,64,210,74,212,0,213,115,149,192,213,107,144,106,62,208,14,126,190,128,210,170,160,216,107,62,208,14,126,190,0,212,164,196,184,13,164,170,230,202,252,128,184,9,196,184,13,
+22,208,9,0,188,206,184,11,170,202,34,245,190,214,128,185,64,236,236,254,72,188,22,242,74,146,54,48,241,4,206,186,250,234,252,170,162,236,206,128,202,14,198,8,212,250,236,236,238,228,160,146,20,183,252,10,210,12,177,28,177,246,87,65,
+252,218,96,96,97,48,177,20,180,10,212,244,200,234,69,153,204,241,252,219,252,64,228,10,4,84,96,10,226,76,168,192,214,64,230,85,5,220,252,78,227,76,212,192,214,132,244,50,252,244,82,16,202,192,208,13,132,244,230,174,241,149,8,244,
+182,205,128,224,10,20,138,81,137,16,192,182,200,9,224,254,20,84,175,138,252,242,210,200,15,80,216,10,233,248,19,32,58,32,0,236,170,170,138,248,16,228,252,44,186,64,200,14,228,248,9,0,234,0,217,200,248,20,170,86,200,226,232,234,
+224,224,14,172,255,14,242,168,242,106,0,200,9,200,248,10,85,82,188,164,104,235,46,252,144,255,200,244,238,0,245,21,234,172,254,252,191,244,238,248,173,88,243,255,248,27,77,162,170,96,224,216,27,226,168,225,226,248,27,0,248,18,196,248,
+12,170,168,224,216,18,226,248,10,254,241,0,192,16,166,255,30,254,241,4,170,46,240,18,226,202,246,242,52,177,192,248,16,160,170,166,252,202,106,172,174,234,226,248,15,198,156,188,245,24,212,128,216,9,255,187,226,204,244,176,224,10,64,216,
+11,66,189,71,180,240,28,255,72,224,248,30,192,248,85,83,0,186,86,173,252,253,192,248,20,96,16,182,36,149,12,178,226,248,10,80,16,177,170,87,82,209,8,229,16,177,32,147,255,254,81,96,82,64,229,204,148,81,21,144,176,14,194,64,
+218,66,191,12,195,255,248,9,85,81,194,192,185,192,148,148,147,120,224,13,194,192,164,21,149,182,210,148,147,120,224,12,194,192,163,192,222,68,5,132,120,224,10,194,192,138,128,254,248,85,85,132,248,16,192,139,192,212,184,170,132,248,15,184,
+211,64,185,152,165,65,21,132,248,16,238,154,233,252,234,88,139,134,216,12,5,73,194,234,202,172,0,140,218,152,232,11,2,82,194,42,136,192,203,156,232,12,85,82,194,252,76,158,64,148,156,224,13,194,28,214,192,248,18,38,73,132,164,244,
+219,128,192,248,12,65,255,140,242,202,60,238,192,194,41,0,42,96,43,96,175,234,44,96,45,96,46,32,163,12,162,208,217,248,254,164,248,12,47,37,245,96,48,240,203,228,236,202,152,145,176,232,16,49,96,170,255,50,232,155,72,187,212,232,
+10,255,248,9,51,96,52,96,53,96,54,31,255,96,55,96,56,96,24,254,25,96,26,96,27,96,47,21,28,96,29,0,30,96,232,18,116,106,132,203,174,10,250,31,96,32,192,136,16,248,242,96,197,88,233,87,165,254,33,96,34,0,208,13,
+248,241,46,134,156,162,176,255,171,35,96,36,96,37,96,38,96,39,96,40,64,195,144,158,170,170,88,196,250,242,80,139,0,147,64,132,34,204,96,150,76,150,170,170,184,146,128,238,68,183,36,157,64,242,192,234,100,252,136,188,170,170,156,248,
+9,206,196,0,174,240,254,214,252,218,254,128,124,14,196,170,164,194,254,244,229,2,243,128,120,9,188,188,232,242,188,10,170,158,116,128,188,16,178,218,82,220,66,222,244,156,44,249,0,243,24,20,252,250,28,147,104,46,104,255,168,45,104,44,
+104,43,8,42,8,41,240,232,252,62,168,16,242,40,241,104,48,104,47,111,254,248,9,216,227,248,210,160,114,248,104,50,104,49,228,248,11,254,104,255,175,24,104,56,104,55,104,54,104,53,104,52,8,51,226,248,15,255,7,254,248,20,30,104,
+29,104,28,104,27,104,26,104,25,194,175,189,176,248,16,32,104,31,246,233,96,246,173,228,248,12,34,104,33,245,255,108,235,107,52,133,32,122,40,104,39,104,38,104,37,104,36,104,172,170,35,204,240,108,250,108,224,241,52,235,24,106,130,42,
+156,233,56,221,200,2,117,160,131,64,110,56,216,9,144,170,246,228,146,243,96,217,64,144,10,60,160,12,170,74,254,170,146,243,68,160,10,56,144,9,210,253,32,241,138,172,170,164,154,252,236,0,240,9,32,244,138,172,154,252,238,170,162,218,
+232,9,32,242,20,196,126,242,4,242,90,157,60,170,170,160,108,24,118,2,134,0,180,246,177,246,253,52,225,12,209,21,84,20,146,106,254,203,244,204,250,2,147,0,131,8,242,171,148,20,146,107,254,203,120,226,210,242,238,9,84,73,228,128,
+101,100,236,62,236,210,242,2,64,172,85,85,192,228,76,252,226,166,146,164,64,172,192,228,2,252,216,174,65,85,146,164,214,160,242,192,224,11,10,173,212,247,0,110,85,85,188,242,124,96,11,32,244,128,253,28,217,240,236,124,96,9,142,244,
+86,86,128,156,149,106,240,12,242,192,120,10,250,235,85,85,102,160,10,192,227,192,125,24,144,12,140,120,11,0,173,56,128,9,204,248,14,85,85,0,173,120,168,16,204,254,0,173,104,120,16,116,168,18,140,120,15,216,184,30,171,42,160,208,
+13,173,32,84,252,157,8,245,236,158,8,231,252,156,168,172,250,8,242,2,162,248,186,236,64,85,170,170,122,234,200,226,116,242,78,220,60,107,64,243,254,131,252,194,42,171,124,164,122,156,60,108,64,244,240,40,208,19,84,140,170,170,156,168,
+20,40,111,156,168,25,4,124,156,168,23,40,245,132,248,19,36,128,9,138,170,128,82,128,248,21,12,244,64,156,137,224,248,24,0,210,170,170,156,168,15,60,248,14,144,80,19,80,240,28,172,192,21,196,248,9,92,122,188,248,22,170,66,80,
+243,12,210,188,248,10,0,231,6,230,244,174,246,106,80,85,232,22,241,24,242,18,228,4,226,250,252,246,218,145,85,224,82,232,56,8,234,104,204,250,254,85,85,56,221,228,244,8,235,124,125,68,229,56,221,228,245,216,224,11,213,170,146,112,
+9,248,81,36,245,12,236,84,144,119,190,254,192,246,95,214,12,236,85,0,86,0,87,144,143,120,162,233,255,248,9,47,232,88,0,89,0,90,80,199,254,78,201,36,240,12,91,215,96,0,92,0,93,144,223,28,195,64,148,255,248,9,94,73,
+171,48,79,252,28,195,192,144,12,95,48,77,26,216,10,85,86,228,232,12,73,48,77,56,208,10,228,232,12,192,238,109,28,197,89,85,96,248,12,192,182,221,38,237,128,152,12,192,253,180,232,24,85,138,192,253,4,224,11,60,178,0,245,248,
+173,170,164,254,0,134,8,51,208,194,0,213,248,104,105,86,85,250,207,0,180,11,0,72,10,90,184,9,0,206,156,187,0,79,28,202,85,85,246,206,244,205,128,226,52,173,66,208,9,192,244,224,76,44,130,85,85,128,196,234,232,9,244,176,
+9,44,132,136,74,132,64,15,192,112,9,208,234,85,85,132,64,17,26,213,114,217,208,234,12,118,124,248,9,90,253,96,253,85,85,12,118,102,112,10,128,199,0,204,72,198,68,248,9,128,236,32,50,80,149,96,34,176,9,68,254,212,45,224,
+217,168,206,84,85,188,56,252,146,254,160,156,184,171,224,245,56,252,164,197,37,85,58,138,250,233,128,224,246,244,196,102,154,174,252,21,100,0,182,8,118,128,212,250,250,92,240,85,85,204,232,17,252,109,244,234,184,216,18,8,39,244,234,0,
+70,82,160,10,85,73,242,171,188,198,192,224,13,142,235,30,255,214,128,120,14,21,80,42,131,222,96,11,36,208,14,136,24,226,176,10,85,85,192,120,15,198,231,246,84,128,224,15,164,218,52,164,20,83,128,224,15,85,85,200,145,250,30,28,
+246,64,248,12,198,171,102,63,0,224,17,6,231,85,85,194,254,160,216,14,40,56,11,56,245,132,200,10,136,123,148,238,220,252,171,170,0,120,12,96,248,232,11,226,236,0,120,12,56,155,248,238,12,236,170,170,124,193,192,240,9,12,165,248,
+236,246,174,0,50,0,224,11,48,80,14,170,170,12,51,0,224,11,8,241,176,200,16,132,156,18,93,36,56,15,128,233,168,106,64,92,38,136,137,210,232,14,102,236,206,235,20,112,14,96,85,81,116,203,192,106,192,217,214,235,20,112,13,102,
+72,82,129,84,128,132,138,222,130,248,12,242,241,192,135,85,149,208,100,130,248,13,234,253,128,8,10,194,248,11,246,233,26,213,81,85,64,182,194,248,13,246,235,192,254,88,189,44,24,14,173,170,106,69,156,242,96,148,83,44,24,14,236,245,
+64,10,0,128,16,170,130,118,145,236,247,64,226,156,224,15,238,114,236,246,128,170,170,156,224,16,14,221,168,59,64,74,28,96,15,74,189,0,133,0,113,22,172,8,210,8,80,9,10,6,227,234,0,182,107,8,80,10,4,42,12,228,240,234,
+0,176,9,74,136,13,248,72,9,170,162,252,2,187,100,60,8,208,13,246,165,224,170,170,2,14,132,160,10,246,109,234,187,0,219,132,208,11,234,242,246,108,170,170,234,187,138,229,176,213,206,193,16,252,246,167,138,229,252,108,170,170,144,176,
+18,192,14,88,176,23,128,106,216,80,27,192,168,27,196,159,255,248,154,170,170,0,241,6,242,254,218,2,242,6,198,242,93,234,129,8,148,170,170,254,218,2,242,244,236,254,204,254,234,64,150,238,182,226,192,11,170,170,250,225,0,127,198,112,
+11,0,8,9,0,126,202,172,228,254,96,150,170,170,64,196,84,221,204,215,152,232,9,64,151,140,229,70,192,11,248,141,42,43,164,224,9,120,248,10,86,112,10,100,240,9,156,52,236,126,206,169,164,160,100,224,12,200,194,212,45,220,150,193,
+170,170,192,192,17,152,253,96,196,4,240,18,16,219,52,254,192,248,18,110,237,170,178,194,147,0,72,21,58,203,194,147,0,72,20,204,30,186,170,130,228,144,21,0,119,240,224,14,244,233,246,207,0,241,242,10,162,0,96,15,14,163,0,247,
+242,224,184,16,134,162,170,28,128,11,0,248,16,48,28,128,11,68,217,100,35,194,240,11,164,168,240,182,220,96,42,108,200,12,176,80,182,170,36,16,187,32,217,252,184,15,56,242,160,190,28,160,208,16,171,170,186,96,232,9,32,225,58,88,
+15,44,221,96,236,86,81,74,170,150,201,28,240,15,190,252,128,120,193,158,208,16,114,102,146,168,132,99,232,192,18,76,76,205,116,178,201,170,170,150,146,58,208,18,160,207,150,150,58,208,11,160,93,24,85,186,232,20,170,170,24,38,24,176,
+18,186,158,12,241,254,189,202,49,224,216,19,22,212,86,99,254,107,231,248,12,108,48,232,12,244,226,124,248,9,111,252,109,193,170,238,232,12,196,124,248,11,112,224,248,12,12,231,128,191,170,170,224,248,11,18,202,16,245,128,191,224,248,11,
+10,110,12,227,110,237,170,170,224,248,11,114,124,142,237,78,173,224,248,11,48,224,9,78,136,9,224,248,11,26,171,240,142,252,77,142,227,113,252,110,10,176,12,168,222,170,170,242,241,188,228,230,230,128,200,10,42,237,178,182,192,255,194,156,
+42,170,134,92,232,173,236,146,244,244,192,20,156,134,92,170,170,58,77,196,74,244,244,192,241,240,78,118,156,216,92,196,223,106,171,12,181,14,38,238,226,244,94,107,32,64,10,108,4,229,250,46,170,81,234,45,236,235,50,243,4,229,8,212,
+13,242,244,188,85,85,242,242,210,243,136,227,10,194,188,96,11,128,220,178,247,4,107,85,73,56,144,9,0,38,146,240,9,208,10,36,188,186,168,52,149,85,224,248,11,208,10,62,171,186,64,51,224,248,12,4,111,85,46,186,253,100,196,82,
+240,10,230,104,12,182,96,82,240,12,249,191,255,151,226,16,167,16,168,16,169,16,170,16,171,254,175,82,245,222,216,14,16,162,16,163,16,164,16,165,16,166,136,163,254,162,134,241,190,224,15,16,159,16,160,16,161,64,237,54,170,172,190,224,
+18,86,254,64,148,172,170,250,216,16,192,180,52,160,138,14,179,188,108,208,15,224,220,80,174,214,217,170,170,188,48,248,11,6,243,18,254,6,245,62,211,184,253,144,104,35,170,170,140,248,15,212,208,14,218,106,186,248,24,0,101,74,104,24,
+64,76,196,216,9,170,170,182,248,15,32,218,252,160,11,52,216,15,32,208,15,240,248,16,208,248,15,240,248,15,170,170,192,160,16,242,192,10,32,122,4,176,24,50,241,0,136,16,126,208,15,228,88,25,170,170,38,244,228,88,25,240,139,40,
+208,18,240,136,12,192,184,20,52,143,32,203,170,170,42,240,23,246,123,0,146,12,192,9,8,162,252,174,236,253,0,179,130,170,254,229,194,51,250,8,228,248,190,184,57,0,211,170,170,70,112,9,30,120,11,0,91,238,48,10,224,104,11,64,
+133,0,215,206,157,164,170,194,159,202,224,194,118,150,206,158,60,234,184,222,170,130,48,218,128,226,140,66,196,64,11,184,218,112,219,232,42,169,136,70,196,64,12,248,253,116,71,200,196,64,11,248,254,170,170,176,254,140,64,23,232,254,140,64,
+23,116,64,46,0,160,116,0,224,31,176,218,175,254,222,176,13,159,0,160,0,38,217,160,192,9,220,216,12,162,0,163,0,164,87,253,0,165,0,166,120,184,10,220,193,202,234,26,187,167,0,168,0,175,42,169,0,170,0,171,50,168,10,40,
+109,170,234,126,239,112,139,168,162,172,224,219,38,48,10,126,155,120,94,104,170,170,0,187,134,152,11,156,32,9,102,219,32,197,104,96,9,90,236,108,188,74,170,250,195,206,248,10,100,112,9,252,96,132,166,214,164,254,170,170,84,136,11,128,
+234,10,118,96,46,84,136,11,84,234,36,252,220,184,11,170,170,18,198,146,186,160,252,206,88,9,132,152,10,146,187,64,92,172,166,170,170,58,248,15,38,18,16,78,196,102,176,202,188,166,32,171,210,72,10,170,170,2,38,0,112,10,16,202,
+31,218,27,222,240,141,242,61,46,204,170,170,160,22,240,173,134,242,202,14,64,219,244,15,180,234,126,12,170,170,62,156,228,133,224,255,80,242,130,124,132,153,12,202,64,220,255,171,224,254,16,181,16,182,16,183,16,184,16,185,168,204,0,122,
+255,37,224,248,12,176,16,177,16,178,16,179,16,180,116,147,182,241,171,192,248,12,222,172,16,174,16,175,79,208,11,64,234,170,42,156,8,17,184,208,11,140,233,4,62,140,177,224,248,15,64,234,6,143,170,170,6,128,192,16,32,194,166,24,
+10,24,235,128,192,11,224,168,9,170,170,152,175,178,210,14,166,224,168,10,162,232,11,244,228,128,202,160,208,9,170,164,34,232,11,220,252,184,242,64,108,232,254,244,118,70,170,170,0,99,216,245,2,192,10,4,21,0,102,0,162,14,112,9,
+248,120,11,42,144,234,105,0,211,14,112,11,8,210,236,240,160,178,242,204,180,128,160,9,36,238,254,128,9,142,74,170,177,241,230,200,13,58,232,9,96,128,160,9,230,206,32,64,9,170,42,202,27,174,47,190,104,11,64,135,132,43,208,206,
+226,120,9,64,134,168,170,224,140,22,78,132,4,64,10,224,218,4,193,200,205,170,170,240,243,50,204,194,142,224,219,140,16,15,56,47,20,22,140,16,22,90,85,224,8,15,200,208,15,136,254,96,146,227,160,209,200,208,14,136,254,146,230,85,
+85,200,208,15,136,254,0,245,206,213,60,144,17,0,245,86,218,178,243,125,101,70,230,0,239,96,32,97,32,252,248,10,228,248,11,224,85,213,136,198,48,248,17,76,8,13,16,8,14,76,8,16,68,8,23,192,246,68,8,27,175,255,172,0,
+174,0,175,188,240,18,255,252,176,0,177,0,178,0,179,245,191,0,180,188,240,16,255,252,181,0,182,0,183,0,184,0,185,170,170,188,240,16,150,79,2,95,12,121,2,186,120,160,9,2,237,2,94,170,170,242,84,114,128,10,0,95,104,214,
+114,147,136,64,10,76,146,142,206,170,170,160,204,120,88,12,0,55,204,40,9,236,168,12,96,47,222,142,180,72,15,170,170,148,126,196,140,146,120,16,8,215,10,228,12,48,20,255,248,251,0,59,170,170,252,255,16,40,22,252,248,10,150,160,
+20,96,198,192,201,184,248,15,202,40,12,170,170,12,201,184,248,15,12,43,78,24,10,6,220,224,201,96,150,216,194,202,164,8,77,196,128,11,72,182,128,252,16,59,42,170,244,253,196,107,156,252,68,255,172,244,255,66,164,170,170,46,164,16,
+196,0,164,250,244,244,230,0,131,16,197,190,252,170,170,194,252,134,180,0,214,144,254,120,136,9,112,161,108,213,160,209,170,170,128,187,184,210,88,107,222,252,176,223,164,144,10,210,147,96,45,170,170,180,216,19,248,48,12,180,216,23,172,216,
+15,192,216,17,255,248,19,192,216,9,232,160,14,42,137,132,93,192,216,9,224,179,4,253,252,246,242,172,42,220,244,250,130,208,34,158,212,64,204,160,98,169,170,220,204,221,8,243,64,200,9,160,168,9,192,192,9,116,104,9,170,170,128,29,
+84,93,200,64,11,26,200,9,38,210,76,72,9,0,59,242,191,170,170,124,43,192,169,20,18,16,192,10,242,191,2,147,128,136,14,44,101,86,85,196,176,11,239,248,12,109,244,107,196,176,12,224,248,14,116,114,168,231,128,136,16,21,85,224,
+248,11,196,130,112,48,15,224,112,233,136,234,204,212,37,213,52,220,12,208,9,224,134,108,30,13,236,233,12,208,11,163,170,110,0,113,168,248,212,220,242,32,194,12,208,10,170,102,20,114,94,235,144,230,244,114,6,236,12,234,11,48,209,74,
+96,8,11,64,14,235,106,0,212,24,160,12,130,170,242,64,62,146,68,56,9,248,182,96,252,64,57,170,170,0,187,234,128,11,216,254,0,162,192,50,200,182,252,168,15,0,164,74,170,202,8,9,160,8,11,96,158,192,254,206,214,252,128,160,
+11,170,168,108,81,24,245,16,111,242,184,12,192,241,36,80,234,202,85,58,234,196,190,250,239,234,107,38,235,16,67,90,247,85,73,236,92,100,217,36,25,110,67,24,64,12,224,24,243,149,148,32,22,220,32,14,224,248,9,110,128,116,134,232,
+11,85,149,224,132,227,0,234,220,220,114,85,224,248,10,0,90,212,170,52,220,236,108,255,244,253,113,72,148,4,79,140,255,10,170,218,234,28,187,118,220,96,92,236,224,255,242,243,42,171,56,159,160,63,192,248,11,116,219,104,36,218,128,248,
+9,202,170,224,255,100,192,9,0,122,128,128,90,224,248,17,102,243,170,170,124,210,150,227,224,248,16,188,252,124,243,102,234,56,90,224,248,17,170,170,182,13,216,48,13,22,88,17,184,175,64,200,15,182,203,18,222,244,255,170,34,44,100,230,
+238,8,210,254,12,186,206,50,220,228,91,13,128,8,208,15,10,242,205,224,230,60,112,15,12,170,170,202,66,241,128,244,224,226,214,10,220,234,8,208,10,40,164,170,170,64,113,16,118,8,208,14,112,168,12,212,206,8,208,11,188,200,11,212,
+200,19,170,90,188,200,11,136,168,19,112,168,27,218,88,12,224,248,29,158,208,12,120,200,18,64,212,184,9,85,85,120,200,20,94,73,104,139,120,200,15,192,168,11,104,139,66,194,62,67,85,85,248,232,13,16,214,66,195,62,69,64,248,12,
+32,242,42,242,14,242,137,200,40,206,240,254,228,64,200,11,130,86,9,246,135,246,234,165,128,217,10,64,200,10,92,206,85,149,106,204,0,124,40,200,11,120,222,234,165,32,217,54,212,85,86,190,216,216,11,232,92,66,217,192,232,189,24,32,
+15,98,171,234,192,152,80,21,64,192,234,174,27,170,170,216,16,22,188,234,64,216,17,36,152,12,64,68,184,80,22,112,58,32,234,170,170,56,200,15,188,232,10,32,235,76,160,14,18,16,17,88,80,23,0,69,160,248,23,170,170,128,38,132,
+32,11,20,16,22,32,96,25,10,53,28,96,13,252,200,9,10,54,170,170,228,160,13,112,215,198,241,20,226,134,41,156,248,12,224,248,11,222,218,130,170,124,107,224,248,22,254,124,64,13,144,44,118,123,0,97,202,42,8,59,124,64,12,16,
+51,104,128,218,120,134,72,248,9,169,170,224,28,212,128,218,72,136,13,196,204,158,185,128,238,130,86,216,216,10,74,30,224,26,73,192,125,107,216,216,10,152,46,85,171,92,185,156,187,210,28,216,216,9,224,254,113,218,138,158,188,138,170,136,
+232,12,72,252,166,33,132,206,228,8,240,13,72,252,42,168,32,185,26,195,160,189,224,248,10,168,172,178,166,189,106,85,0,14,56,240,11,172,179,208,242,12,108,243,108,18,152,152,9,208,241,85,85,246,168,14,238,139,240,144,18,252,110,176,
+122,240,144,19,134,242,236,134,85,85,168,8,17,90,188,56,189,104,8,18,240,80,9,224,242,192,248,17,176,226,85,85,28,254,96,248,18,176,227,150,21,224,248,20,248,86,190,243,232,216,17,85,5,80,203,24,87,232,216,17,112,19,0,182,
+160,248,19,206,85,85,110,100,90,243,200,216,17,240,72,12,0,185,0,248,22,244,173,192,248,20,149,85,222,48,10,64,248,18,112,14,152,64,248,18,156,146,108,172,85,37,0,107,240,216,20,238,88,10,228,56,38,230,152,14,196,191,160,85,
+85,200,230,36,216,18,0,243,96,16,9,168,216,11,116,162,110,9,224,248,10,85,81,184,255,96,226,14,187,192,8,13,184,255,138,144,188,85,85,192,8,13,160,228,220,226,120,190,128,244,224,248,13,66,185,180,40,11,85,85,160,248,19,128,
+136,14,192,14,120,8,12,196,190,88,219,248,244,120,8,13,85,85,196,189,210,227,184,148,120,8,18,0,213,44,233,126,132,144,224,17,21,85,224,51,192,10,64,194,252,32,192,16,246,242,44,234,85,85,4,149,244,187,128,72,11,4,144,18,
+72,245,255,248,11,132,242,100,243,85,85,240,101,240,29,34,191,132,240,10,222,187,252,170,206,186,128,238,161,234,164,244,255,97,102,243,128,234,168,192,13,224,252,98,170,74,96,144,193,142,196,44,12,128,239,160,252,4,182,42,129,228,64,141,
+224,248,12,4,182,200,134,85,85,230,10,107,132,240,12,80,176,10,232,206,132,240,10,92,232,12,124,120,9,132,241,85,85,232,164,60,232,13,232,79,164,161,224,252,68,240,13,252,237,80,219,85,245,60,241,104,240,15,96,87,140,242,24,233,
+136,176,15,255,248,9,16,167,191,254,16,168,16,169,16,170,16,106,88,10,224,248,12,162,16,163,16,164,235,107,16,165,16,42,88,13,222,248,11,159,16,160,16,234,80,15,240,96,55,106,1,84,0,167,246,248,0,208,17,248,58,182,172,85,
+109,230,139,224,248,15,194,50,204,39,72,192,13,224,248,9,12,110,235,13,85,81,116,218,108,152,19,214,248,9,96,172,194,160,15,232,236,123,82,85,224,48,210,16,235,194,160,11,236,120,10,64,51,136,114,85,85,194,160,11,236,120,10,160,
+179,182,209,136,124,4,111,238,44,128,190,85,85,182,209,6,85,242,166,248,162,220,243,32,13,62,96,11,96,134,85,85,0,234,96,130,72,112,9,194,120,9,192,204,96,51,34,80,10,246,252,85,85,32,112,9,92,131,196,253,28,24,15,32,
+125,128,235,4,226,8,214,149,84,252,30,32,125,128,235,184,8,208,11,64,138,248,252,85,85,8,168,21,255,248,29,244,200,20,36,176,14,216,104,12,200,248,14,212,128,20,252,200,14,85,85,224,248,11,200,248,15,224,248,15,200,248,15,224,
+248,19,28,208,15,224,248,32,104,51,181,85,232,216,9,224,248,11,248,218,113,246,235,9,224,211,200,248,18,64,201,85,85,128,188,224,210,200,248,17,190,233,128,189,128,242,172,173,136,236,85,73,32,240,15,200,255,8,108,182,104,9,64,110,
+144,180,194,85,85,238,172,194,180,124,59,128,20,12,96,12,2,116,246,252,0,116,85,85,30,209,0,87,252,254,242,23,0,177,30,81,0,87,252,252,85,85,2,88,13,190,234,136,236,140,198,252,248,12,128,145,176,178,132,170,85,85,184,40,
+14,252,255,176,179,12,80,10,252,248,14,48,179,16,210,184,40,15,85,85,128,214,168,75,152,185,184,40,15,128,214,160,194,0,152,26,0,227,85,85,128,144,22,160,155,32,144,11,64,128,14,0,139,52,203,56,243,64,128,16,85,85,36,106,
+120,110,64,128,19,116,100,150,172,138,42,182,185,128,240,9,5,85,130,241,214,41,254,182,116,114,130,140,210,94,128,9,85,85,176,202,226,129,0,251,252,222,136,214,236,223,64,105,10,22,85,85,16,244,250,232,9,0,102,4,18,14,16,9,
+246,84,254,158,44,76,85,21,34,72,9,10,246,132,149,172,155,150,156,250,242,22,112,10,9,84,238,104,130,20,43,132,45,134,92,85,85,126,252,0,130,134,241,224,226,0,200,9,246,192,11,72,243,192,171,85,149,0,200,9,246,192,11,40,
+136,11,0,200,9,246,192,49,16,101,248,208,24,85,85,24,8,48,15,248,232,10,128,236,156,201,4,66,84,204,248,232,12,5,85,32,241,128,233,22,64,179,252,188,248,232,12,128,235,89,43,60,20,14,132,103,112,100,106,160,77,160,242,169,
+170,214,132,96,9,112,100,34,17,160,122,138,245,8,86,170,170,118,247,10,87,18,213,8,229,118,240,10,0,117,6,112,11,244,248,9,160,164,6,86,246,6,112,9,16,62,240,0,242,170,146,136,202,80,206,136,218,240,242,22,206,128,234,74,
+74,170,48,222,228,148,224,148,240,60,242,72,238,62,72,9,170,250,62,204,184,21,88,222,254,253,8,164,172,77,184,22,16,181,16,95,213,182,16,183,16,184,16,174,241,144,241,16,114,104,210,88,207,255,170,16,176,16,177,16,178,16,179,16,
+110,241,2,237,104,214,225,171,88,203,8,222,172,16,174,16,175,83,189,88,200,55,170,170,176,200,23,224,248,28,142,247,124,233,176,181,224,248,15,94,244,6,245,162,170,240,206,248,254,22,142,242,190,236,116,97,208,253,202,74,76,230,0,66,
+18,52,10,202,227,174,246,160,170,238,172,2,211,180,30,248,228,164,31,0,240,9,170,170,180,30,224,252,240,254,0,243,188,184,29,144,8,252,0,8,163,18,230,170,170,68,146,4,216,19,22,22,68,145,224,248,16,0,202,0,226,128,98,170,
+42,80,16,14,230,67,184,233,142,235,128,98,124,64,16,196,137,104,198,169,170,196,148,64,16,6,218,0,149,20,16,20,6,218,0,125,170,10,196,248,16,250,121,32,102,32,226,46,227,250,252,58,111,182,172,134,0,115,8,54,225,8,46,227,
+250,236,245,90,174,154,217,90,218,168,81,8,118,225,230,112,224,248,10,168,170,156,110,64,224,248,19,236,203,32,36,192,248,20,204,157,42,218,0,107,224,248,15,112,193,142,157,190,192,185,8,22,225,178,170,8,22,227,250,80,243,182,31,64,
+30,80,194,74,170,56,180,114,66,4,164,252,128,209,82,144,10,208,204,170,138,4,166,228,37,28,195,210,242,224,232,23,72,14,112,232,103,170,170,116,180,128,16,128,88,13,184,198,255,248,252,108,216,220,148,56,13,252,232,19,170,170,106,219,
+120,88,9,252,226,116,120,17,88,88,10,196,198,56,248,111,168,224,25,170,170,186,101,148,240,128,12,163,144,224,14,214,208,11,12,165,62,184,13,202,210,70,65,218,252,64,157,9,186,126,240,9,224,64,187,82,69,218,78,179,244,129,210,172,
+224,248,14,250,180,170,192,194,174,9,88,241,16,212,224,248,11,182,28,170,10,14,219,130,169,16,212,224,248,11,160,28,14,222,134,130,85,18,206,110,202,210,160,255,180,212,190,24,115,100,37,188,16,189,218,128,171,176,134,214,68,81,176,84,
+236,148,46,52,211,85,65,136,118,102,112,9,240,164,0,186,32,170,156,38,118,85,21,84,254,240,252,64,170,104,178,196,248,9,84,254,90,210,84,73,238,116,163,129,170,196,255,224,110,170,26,170,85,85,224,18,212,252,224,110,80,254,160,204,
+224,18,190,156,128,160,11,18,85,248,190,163,192,144,149,12,215,184,165,85,69,120,16,10,64,132,200,158,248,248,11,92,83,56,98,92,82,85,168,248,248,15,114,167,252,248,24,86,70,238,104,14,192,235,85,85,228,252,244,252,214,160,14,234,
+195,206,253,20,243,224,248,19,238,253,85,89,224,248,96,180,234,142,164,224,248,9,106,194,238,80,204,85,85,204,130,2,236,192,67,182,94,58,146,80,205,2,238,176,183,85,85,170,117,148,208,130,92,216,20,168,187,100,154,92,248,22,124,211,
+224,115,37,85,68,16,9,188,174,248,188,179,148,141,224,255,188,173,86,85,248,58,148,118,235,140,64,12,248,253,200,107,192,138,85,84,92,88,11,248,174,8,114,46,233,192,252,122,212,200,9,85,85,248,174,248,253,28,188,128,241,176,184,22,
+96,115,206,146,176,184,22,21,85,68,68,120,24,21,4,220,254,70,131,124,252,180,98,5,85,150,248,11,228,146,188,220,218,60,252,124,180,116,32,14,85,65,192,144,26,80,229,252,24,16,20,24,9,160,217,192,252,24,16,85,111,188,199,8,
+84,32,240,21,248,34,164,242,117,0,118,254,248,12,119,150,10,238,250,252,248,120,240,248,10,71,21,250,121,0,122,238,250,254,248,252,240,248,9,232,51,250,252,123,0,124,0,125,250,129,64,248,232,240,248,9,250,255,71,224,114,0,115,0,
+135,0,136,8,136,0,137,170,245,175,184,252,254,248,9,224,252,138,0,139,8,139,0,140,194,253,64,127,254,248,11,188,224,141,0,142,8,142,0,143,255,255,98,255,126,0,127,0,128,0,147,0,148,8,148,0,149,0,255,254,116,0,144,0,
+145,8,145,0,146,98,255,129,0,130,0,131,127,38,0,150,0,151,8,151,0,152,210,254,240,255,206,224,254,132,0,133,0,134,0,153,0,154,8,51,1,154,0,155,210,254,206,72,240,130,224,252,140,170,156,0,157,103,2,8,157,0,158,210,
+254,206,80,82,236,224,252,122,252,218,176,240,9,240,252,85,85,8,252,186,248,9,78,254,240,254,166,252,218,252,224,252,182,240,9,68,21,48,228,94,240,11,112,242,182,240,9,85,64,48,126,253,194,240,9,242,248,9,244,48,21,80,164,253,
+194,240,9,242,248,9,244,48,198,245,85,85,64,248,9,252,248,15,198,244,64,248,9,32,248,15,198,244,64,248,11,54,240,13,73,0,162,232,15,224,146,252,224,132,80,82,134,210,254,236,254,224,146,252,106,242,80,82,166,230,254,236,254,248,
+146,252,160,252,85,181,210,254,236,254,32,248,11,224,252,208,246,108,252,134,238,116,10,42,6,253,162,232,15,134,238,224,6,252,12,248,15,134,238,72,42,224,6,252,60,44,240,11,134,238,192,246,41,170,60,44,240,11,162,224,11,246,80,235,
+44,240,11,168,178,162,224,11,246,80,235,172,240,11,18,248,9,80,170,2,80,235,12,248,11,86,240,9,166,235,80,235,140,252,78,9,170,254,150,252,248,222,254,36,248,11,106,224,9,170,170,80,240,13,132,254,106,224,9,112,248,11,4,248,
+9,106,224,9,224,248,11,4,248,9,170,170,106,224,9,224,248,11,4,248,9,180,242,92,254,80,232,19,180,242,100,248,11,170,170,208,252,96,216,11,242,224,11,192,236,94,230,250,252,242,252,148,238,170,170,160,228,96,216,11,224,252,148,238,
+160,226,172,216,9,86,228,128,232,11,170,42,160,226,172,222,176,246,160,224,15,172,222,146,236,188,252,76,222,169,146,240,172,222,146,236,154,252,108,222,18,170,130,136,254,146,236,198,252,146,224,11,60,240,11,218,230,210,160,130,54,246,214,108,
+224,11,250,240,9,54,246,226,74,170,64,236,234,252,244,232,19,122,228,240,9,20,240,9,190,254,170,170,192,216,11,20,240,11,244,238,192,216,11,20,240,11,244,238,192,216,11,68,240,11,42,169,226,244,172,244,156,252,232,232,13,104,92,216,
+13,60,216,13,170,170,64,205,68,243,156,252,26,254,56,240,9,160,230,170,240,11,184,238,170,172,64,205,68,243,198,252,146,236,244,248,9,240,68,243,170,42,198,252,146,236,244,248,9,240,252,16,246,168,246,48,208,15,156,224,15,168,170,54,
+48,208,13,18,224,11,94,232,9,224,248,9,246,238,88,232,9,130,10,224,248,13,246,244,156,88,238,160,248,15,224,232,19,130,42,220,66,246,226,192,232,21,26,216,9,12,232,11,186,230,168,170,192,116,240,9,68,246,238,252,90,254,202,192,
+9,68,244,170,170,106,252,142,227,14,223,146,252,68,244,168,246,178,230,250,208,9,164,160,54,216,9,252,178,230,90,246,132,230,254,146,32,36,216,11,20,246,132,192,252,248,36,216,11,73,170,30,34,242,224,192,254,238,246,244,230,160,170,30,
+244,100,222,252,238,240,9,176,252,234,224,9,98,248,11,170,160,252,216,9,234,224,9,192,252,230,252,234,252,242,170,192,11,42,144,98,252,230,252,234,252,178,254,238,202,170,146,192,252,230,248,13,232,224,11,96,224,11,8,190,122,254,202,130,
+170,146,222,166,246,206,208,184,13,224,254,166,246,182,252,170,170,226,178,124,252,70,246,140,254,190,238,184,230,108,216,9,208,252,164,146,152,208,11,216,70,198,174,254,184,208,11,216,42,168,34,236,252,248,11,164,254,250,252,54,200,248,13,124,
+248,9,170,10,250,252,62,196,110,232,11,124,254,250,252,132,234,204,248,9,170,32,144,94,238,64,254,170,244,204,254,248,94,232,13,8,170,240,170,240,13,208,184,246,64,254,132,172,160,42,176,174,252,184,246,238,230,122,236,224,254,40,246,169,
+42,42,158,252,234,236,224,254,50,244,132,234,110,254,168,170,236,224,248,11,76,184,9,236,254,90,236,80,174,216,236,170,170,206,240,9,166,238,218,160,9,118,248,15,96,208,11,182,248,11,188,252,206,254,10,170,104,252,168,248,11,254,252,206,
+248,252,104,248,9,222,248,13,164,170,128,204,216,172,248,9,178,248,13,24,208,11,16,208,13,242,252,170,170,2,240,17,146,254,230,248,17,108,176,9,210,224,9,120,254,188,248,15,254,248,15,170,170,226,248,37,244,248,15,222,248,13,250,252,
+190,224,9,166,248,21,166,238,254,252,170,74,32,152,11,118,232,13,232,160,11,14,248,19,232,160,11,224,216,17,184,254,170,160,168,50,204,216,216,13,128,246,136,220,196,216,232,15,170,170,222,238,168,254,216,232,15,50,246,84,216,11,154,254,
+14,216,9,78,248,9,170,170,172,252,166,248,9,46,254,44,240,13,56,248,9,14,248,15,240,248,23,192,254,170,170,198,248,9,206,208,11,94,240,11,100,248,9,28,240,21,158,248,11,202,248,15,20,236,170,170,98,208,13,202,248,13,212,232,
+21,6,232,9,242,232,23,200,240,11,132,248,13,232,240,11,170,238,160,224,13,98,208,11,160,252,160,224,13,254,248,11,255,248,42,24,66,228,248,27,24,191,170,65,24,64,0,190,0,191,228,248,24,255,252,222,248,18,228,255,85,80,222,248,
+23,62,240,248,14,222,248,15,224,248,15,174,238,248,13,224,248,252,253,86,224,248,252,224,248,69,192,0,193,0,194,238,248,12,67,27,232,16,220,248,11,168,234,226,68,219,224,20,220,252,226,248,23,255,248,252,255,248,131,24,171,170,68,24,
+67,64,216,19,226,248,10,64,216,20,226,248,10,30,216,23,226,248,9,170,170,222,248,20,226,248,12,30,216,252,224,248,252,222,208,202,224,248,14,220,248,16,224,248,18,170,170,220,248,12,224,248,22,220,255,224,248,26,220,254,0,40,38,24,
+41,252,255,170,174,232,11,216,48,16,252,248,11,192,248,17,98,17,32,20,173,0,2,49,160,106,184,248,15,204,98,17,100,18,76,18,204,17,184,248,15,96,181,172,128,8,11,28,22,136,33,32,218,25,224,48,22,162,146,152,42,28,22,148,
+32,51,128,254,252,146,202,108,18,244,254,212,156,253,68,255,52,37,178,90,252,108,41,240,156,253,255,248,252,255,248,75,63,254,248,13,85,80,92,232,16,240,248,14,224,248,131,150,233,254,68,13,224,248,21,84,65,254,68,13,96,248,99,112,
+225,112,186,21,213,221,224,248,20,64,234,186,21,128,248,71,8,63,254,252,0,70,248,253,86,115,188,224,248,13,16,200,254,248,254,224,248,121,189,254,69,85,117,248,252,224,248,16,255,254,192,253,255,254,224,248,252,224,248,196,8,189,85,85,
+254,248,11,224,248,15,122,160,210,186,208,9,182,160,29,226,248,104,92,160,18,255,248,15,85,85,110,184,29,224,248,252,224,248,252,224,248,71,4,212,254,248,15,204,176,206,254,248,12,85,213,216,216,29,208,240,30,224,248,252,224,248,252,224,
+248,204,10,224,21,2,176,10,255,248,72,170,170,195,254,248,20,128,208,252,224,248,78,64,208,147,10,240,21,4,240,15,96,224,252,110,181,64,224,85,68,192,133,8,71,224,248,30,72,192,248,252,192,248,160,255,248,64,173,10,85,210,91,122,
+90,248,248,19,226,106,166,91,122,90,248,248,19,136,23,226,107,220,22,0,23,252,248,20,192,191,230,226,255,248,158,96,5,32,6,32,1,32,242,42,72,85,252,248,10,236,96,11,212,83,144,105,188,80,14,88,82,248,236,253,64,144,82,20,
+72,82,252,74,245,35,202,242,60,83,228,241,10,64,11,64,12,246,128,164,254,230,72,82,232,202,242,6,65,60,84,198,241,64,254,192,72,9,208,252,78,144,72,244,250,252,192,194,8,82,1,200,180,242,238,254,244,250,254,146,68,12,192,253,
+232,122,244,138,32,135,242,254,62,242,128,64,92,35,65,22,64,23,248,146,244,107,164,147,250,240,3,64,4,236,245,26,241,240,14,71,128,97,238,242,22,32,23,254,242,240,64,16,72,189,14,12,238,242,18,96,19,254,243,240,64,15,71,64,
+36,8,128,68,18,253,128,192,248,15,44,168,128,68,220,253,112,192,248,16,192,242,8,74,32,252,46,88,192,248,16,192,242,10,36,194,156,235,224,248,16,192,8,226,244,162,138,218,114,192,248,15,70,234,84,244,40,144,218,114,64,248,17,136,
+66,68,170,160,248,21,64,230,94,245,192,240,17,0,253,74,170,62,253,224,248,16,0,254,126,224,242,192,248,19,242,62,130,108,224,242,64,248,17,192,194,236,152,64,248,18,10,89,175,124,237,152,128,248,18,240,234,7,64,8,252,235,222,186,
+32,248,17,255,248,13,77,96,78,226,248,29,96,160,248,15,226,248,13,1,64,42,170,56,83,196,248,24,124,233,226,248,26,58,0,248,16,166,255,42,168,26,241,246,233,0,248,16,226,252,202,26,242,128,226,170,100,192,248,15,166,252,60,244,
+128,226,192,248,13,226,10,220,11,85,82,192,230,196,248,16,128,234,44,50,158,176,225,226,248,14,209,21,10,227,194,250,252,5,64,168,68,226,252,4,82,238,164,234,142,194,250,252,120,241,137,8,76,248,10,228,138,196,152,37,252,120,128,76,
+254,164,34,96,138,246,252,120,20,72,128,76,248,11,234,138,120,41,114,82,68,244,42,64,106,196,16,243,8,242,80,170,246,250,252,4,228,246,107,0,40,10,210,97,12,226,8,220,246,96,32,97,252,96,97,173,62,20,219,12,218,9,12,227,
+8,220,208,57,96,98,96,99,169,7,252,80,227,14,236,104,234,96,0,97,90,122,210,144,0,100,0,101,252,80,227,14,230,7,79,9,64,98,64,206,140,244,102,0,103,10,228,252,16,237,114,228,244,202,255,252,104,73,37,0,105,252,16,237,
+42,218,82,242,202,69,82,255,248,12,16,227,138,48,202,253,224,248,13,66,179,20,138,120,232,22,74,250,190,170,138,248,9,228,248,12,96,75,96,76,84,255,228,248,18,192,39,138,248,13,170,170,228,252,96,34,0,232,17,228,252,32,58,188,
+235,0,232,12,172,248,9,86,173,26,242,168,242,106,64,239,200,248,11,24,212,168,242,107,180,243,164,42,144,248,9,200,8,242,0,246,128,233,172,254,248,200,10,168,138,248,4,213,88,242,128,184,19,236,235,250,202,138,10,172,128,184,19,188,
+31,248,192,248,19,138,217,188,42,36,120,64,2,192,248,19,76,203,0,253,192,248,20,169,186,228,0,229,192,248,20,30,236,0,227,192,248,17,96,57,162,162,0,224,11,192,248,15,226,0,224,12,192,248,13,226,178,178,0,224,14,192,248,11,
+196,0,224,14,192,248,9,226,162,178,0,224,16,192,254,226,0,224,20,192,252,76,164,160,0,224,20,192,76,253,0,224,20,192,76,248,10,168,189,0,224,19,196,0,224,27,128,168,30,71,128,168,30,72,8,73,85,85,224,248,28,73,192,248,
+252,192,248,162,182,40,219,255,248,252,255,248,252,255,248,252,255,248,252,85,5,0,240,1,255,248,252,255,248,252,255,248,252,255,248,56,0,240,0,0,0,0,0,0,0,0,0,0
@@ -0,0 +1,95 @@
+253,112,0,255,248,15,111,0,112,0,113,254,8,112,8,240,195,246,228,248,19,114,0,115,0,116,254,8,251,217,115,8,114,220,248,16,117,0,118,0,119,252,250,252,193,239,118,8,238,255,248,13,120,0,121,0,122,254,253,123,253,156,0,124,
+158,248,16,125,0,126,0,127,246,128,253,198,244,255,254,98,0,99,0,100,224,253,129,248,11,255,130,0,131,224,248,10,226,102,0,103,0,104,0,132,255,231,0,133,0,134,0,135,0,67,0,68,0,136,244,255,255,137,104,4,32,5,32,59,
+40,58,40,57,40,56,0,63,32,127,248,64,32,65,32,66,32,69,40,254,70,40,71,40,255,31,72,8,73,96,8,32,9,32,10,32,11,32,16,40,252,19,248,244,252,23,32,24,32,25,32,26,238,252,127,226,96,12,0,13,0,14,0,15,
+0,17,0,18,32,255,4,244,252,27,0,28,0,29,0,30,238,255,245,226,96,1,0,2,0,1,64,2,64,252,255,240,248,9,1,93,231,79,97,95,96,3,234,3,1,108,1,109,0,0,252,244,226,222,194,171,236,244,252,226,1,106,1,107,
+252,248,11,184,254,170,234,236,255,200,253,252,248,24,192,248,14,252,248,16,192,248,30,126,240,16,255,248,206,96,191,255,5,32,31,40,31,104,5,232,248,23,96,9,32,32,40,32,104,250,255,9,224,248,16,232,253,64,13,0,33,0,34,64,
+18,1,110,1,234,171,111,252,248,11,232,254,16,246,33,106,33,107,252,248,9,56,242,85,85,248,237,3,16,243,0,247,248,239,232,253,216,254,248,232,17,192,248,39,85,213,208,232,14,184,232,15,0,240,150,104,240,23,128,240,15,224,248,23,
+128,246,224,248,24,17,84,3,0,254,250,152,248,23,224,255,152,248,22,86,82,224,188,242,0,240,23,224,128,242,184,253,65,20,0,240,13,252,0,240,44,192,0,240,20,85,125,232,160,254,192,232,57,128,216,13,192,248,9,254,252,96,1,96,
+2,82,85,252,192,216,23,64,248,23,184,255,128,248,22,192,248,252,192,248,140,85,85,0,240,21,0,224,15,216,224,15,232,238,112,224,23,104,254,112,224,15,224,231,245,160,104,253,224,255,216,214,108,33,109,252,128,235,170,170,226,228,176,248,
+13,56,248,16,192,248,15,64,248,23,216,247,192,248,88,176,208,22,10,170,236,222,128,240,22,16,252,252,64,192,87,0,192,252,104,184,210,170,170,0,200,79,224,248,25,254,252,123,240,252,255,248,162,136,184,15,252,248,15,136,184,15,250,111,
+252,248,15,0,224,252,144,224,106,65,93,1,95,1,93,65,95,224,248,24,96,0,80,226,222,250,112,248,23,16,182,85,29,112,248,15,144,168,12,248,170,128,152,14,144,168,15,240,248,11,1,96,85,125,138,16,176,9,120,136,13,128,192,14,
+255,248,252,255,248,90,8,4,8,20,255,251,104,232,28,8,104,22,104,21,104,35,0,36,224,248,22,12,96,25,127,189,96,26,97,94,104,38,0,42,24,208,22,116,122,39,96,40,206,234,222,248,21,24,246,64,41,222,154,248,16,40,188,20,
+177,3,170,58,96,222,252,188,248,14,158,136,9,212,153,222,248,18,236,179,0,1,32,106,255,250,116,222,248,16,156,202,1,248,202,254,21,1,22,1,20,144,155,222,248,14,127,108,192,6,1,24,1,25,1,23,250,8,188,255,45,225,147,192,
+248,10,249,83,0,84,0,82,250,244,103,248,227,222,46,104,6,104,5,104,4,192,73,124,160,253,250,184,228,222,47,96,16,104,217,190,64,113,192,160,248,9,25,240,247,48,64,17,96,10,186,64,113,64,252,160,248,9,250,52,252,250,252,0,
+110,86,80,64,248,11,250,248,18,28,64,248,14,250,248,15,224,64,248,14,250,248,13,253,234,192,253,160,248,18,96,1,32,2,32,104,241,64,248,15,250,254,96,0,34,3,226,222,74,241,220,169,172,246,252,248,15,104,107,144,242,216,252,248,
+16,234,31,4,194,0,224,252,0,224,105,128,89,6,32,7,40,6,40,5,106,93,244,96,120,104,17,128,88,12,96,120,104,17,128,88,12,64,13,120,120,16,85,213,16,236,254,252,120,104,16,248,201,64,224,9,248,136,20,99,240,252,255,248,
+87,254,161,20,12,208,25,96,6,32,21,32,22,40,254,21,107,85,238,234,0,4,224,248,16,128,72,10,32,64,217,80,208,16,128,72,14,72,104,21,85,85,244,186,176,184,13,48,208,18,0,224,20,8,134,166,217,164,219,224,248,16,85,85,
+206,111,218,252,176,200,17,132,253,0,128,14,152,128,13,252,254,96,248,18,85,85,192,248,37,26,253,192,248,22,240,224,10,192,248,52,64,248,71,128,240,20,192,248,13,85,85,48,224,20,128,248,10,192,126,252,254,192,248,16,8,96,20,192,
+248,9,8,96,18,173,170,240,216,13,192,120,28,65,64,127,252,248,23,128,120,63,64,72,15,240,248,16,170,106,216,104,16,72,200,252,184,168,25,208,189,240,248,24,208,189,240,248,15,80,240,15,65,85,85,64,104,22,0,240,95,106,181,146,
+168,10,86,183,222,248,15,218,248,12,11,240,252,85,85,80,213,92,208,18,232,243,56,214,224,248,24,228,248,18,255,248,22,234,13,93,85,254,254,6,18,8,0,99,205,234,8,10,254,254,226,8,12,234,8,9,85,191,230,8,10,226,8,12,
+234,8,11,226,8,19,22,18,143,0,144,0,145,122,140,240,253,2,16,13,224,252,139,0,147,234,141,81,248,242,146,248,224,248,17,192,152,0,153,0,10,130,19,194,253,224,248,19,192,255,248,9,220,64,130,160,248,17,192,162,160,252,246,246,
+191,224,248,9,138,12,156,138,9,74,0,75,0,76,0,77,0,78,42,187,130,14,0,178,138,8,9,160,9,254,130,8,9,0,4,86,93,0,179,138,14,12,254,253,2,197,240,169,128,9,32,13,138,15,5,85,68,206,2,197,214,64,154,148,
+206,8,192,10,0,208,10,85,85,192,224,18,240,248,12,24,64,15,248,184,15,144,208,23,120,208,135,24,220,252,248,23,69,85,0,234,8,152,13,254,218,144,11,192,37,188,240,10,184,240,12,85,85,64,38,234,255,154,240,14,64,38,132,240,
+18,192,30,106,240,18,128,184,11,85,85,80,192,13,192,248,40,128,248,13,162,248,22,0,240,18,252,248,15,0,192,30,128,56,97,85,173,192,248,252,192,248,130,4,115,0,112,36,136,117,222,248,15,110,4,119,174,162,102,118,222,248,12,1,
+28,4,119,188,248,11,120,111,224,66,117,4,112,9,68,118,222,43,224,248,9,4,112,11,120,110,104,44,189,65,160,248,15,250,253,4,1,5,178,113,4,106,160,248,18,65,85,250,248,11,170,160,248,18,250,248,9,224,248,11,4,112,20,224,
+248,11,85,69,160,248,20,128,182,160,248,23,64,112,9,68,216,21,64,115,18,85,73,64,112,22,78,210,240,75,216,252,252,248,23,192,0,208,37,85,85,12,151,8,149,0,208,14,90,176,24,131,176,252,32,48,99,128,160,94,8,192,23,85,
+37,0,8,15,0,128,14,184,111,196,248,17,68,144,9,192,248,15,196,85,85,124,104,15,180,72,16,52,136,12,128,128,13,244,83,52,136,13,92,120,12,192,248,19,85,85,28,168,11,192,248,19,156,248,11,192,248,19,220,16,11,192,248,35,
+52,136,16,192,248,13,85,85,124,48,15,192,120,18,188,248,9,0,248,15,192,120,9,188,252,192,248,21,8,133,85,85,192,248,24,124,248,9,192,248,19,176,72,13,0,112,21,192,176,11,0,240,17,64,184,13,85,85,196,248,15,154,176,13,
+128,248,13,52,184,17,0,240,15,0,184,17,80,248,11,244,208,17,85,85,0,243,80,255,30,176,17,192,176,18,222,248,12,0,176,58,192,248,13,64,176,45,85,85,192,248,33,192,168,42,0,176,29,0,208,12,252,248,19,222,248,9,230,206,
+218,200,11,85,85,64,240,10,240,138,236,143,234,248,12,222,248,13,224,248,29,192,64,16,236,248,12,21,84,224,248,25,250,254,176,192,13,94,224,248,13,8,126,248,158,80,85,242,224,254,200,254,64,232,15,224,255,120,197,128,232,17,85,85,
+132,232,23,64,192,13,218,232,21,64,240,14,154,232,11,0,160,17,102,232,11,0,240,33,85,85,0,160,38,0,240,42,226,248,20,67,192,252,8,96,136,80,208,27,16,136,13,16,64,24,85,85,196,248,18,16,64,14,20,240,252,112,240,103,
+192,48,97,0,128,29,30,224,15,208,168,15,245,170,0,48,15,208,176,16,136,254,189,0,190,32,171,132,56,21,72,255,170,214,8,64,15,224,160,16,196,255,16,248,23,174,255,144,188,191,208,176,20,218,248,9,42,171,192,208,32,19,136,248,
+17,24,104,39,76,140,248,14,184,176,9,170,170,192,147,140,248,16,184,176,9,98,148,108,224,21,64,215,64,80,19,192,200,9,170,170,224,248,14,86,229,192,200,10,224,248,14,124,165,254,254,64,120,191,144,231,138,170,38,96,14,0,96,14,
+226,248,19,236,0,96,18,192,176,32,176,232,14,94,47,128,160,22,176,232,42,171,0,172,211,248,22,230,252,169,0,170,224,248,22,170,170,230,0,88,28,50,128,16,18,128,20,236,200,28,192,56,22,226,255,170,170,64,232,19,248,240,11,64,
+232,19,248,240,11,192,248,23,36,231,192,248,22,112,150,170,170,64,106,0,160,9,144,208,17,0,226,242,232,11,224,248,18,16,160,10,248,192,17,170,170,0,160,14,188,248,16,128,176,17,188,248,13,72,222,184,232,11,188,248,11,128,216,33,
+170,170,8,216,21,144,232,58,192,64,29,214,226,210,231,218,239,196,232,19,0,244,186,135,96,242,30,48,13,252,253,8,117,64,240,10,94,0,95,149,89,175,0,97,141,244,255,192,128,12,167,0,168,107,255,242,85,244,253,92,222,236,161,0,
+162,224,255,244,253,228,232,12,245,189,224,248,18,255,248,12,224,248,14,8,181,8,180,224,248,28,182,8,176,159,191,224,248,28,175,8,174,8,173,242,98,0,99,0,100,51,252,128,248,17,8,177,190,226,102,0,103,0,104,87,188,16,165,16,
+166,225,254,244,252,190,179,8,178,170,170,64,56,38,106,240,12,64,56,45,0,96,42,252,248,19,16,240,13,248,232,16,0,136,13,170,170,80,184,83,16,152,13,16,184,50,80,88,40,116,216,27,144,232,16,104,16,34,172,160,23,42,169,184,
+96,11,192,248,25,180,220,192,248,25,14,192,72,26,168,221,250,107,0,208,25,0,144,70,132,245,1,7,1,8,1,6,250,248,13,108,232,11,1,80,170,244,250,64,16,80,239,224,4,154,64,17,140,146,192,253,250,172,154,64,16,200,170,170,
+152,71,160,248,18,94,252,242,244,160,248,19,42,234,208,103,160,248,18,170,170,130,221,144,100,160,248,18,166,236,192,253,160,248,18,192,248,12,160,248,23,170,170,24,245,252,56,21,0,128,9,60,24,19,64,104,24,0,128,29,4,182,0,244,
+170,170,12,64,18,0,240,43,64,104,54,0,104,67,0,59,128,223,68,176,16,64,96,20,170,170,192,96,17,204,208,16,128,16,40,128,248,9,0,248,101,30,248,18,192,104,22,0,96,42,122,189,248,184,12,154,200,16,128,221,180,0,181,4,
+96,10,0,112,17,176,0,182,126,133,95,216,16,14,192,9,173,0,174,0,175,61,216,18,14,198,194,122,88,177,29,216,20,174,196,178,0,179,194,8,85,224,248,23,85,101,0,230,136,208,11,224,248,12,0,230,176,53,48,168,10,224,159,84,
+64,230,33,106,33,107,252,240,22,224,255,144,64,10,85,85,120,142,8,252,58,196,128,236,184,144,9,48,224,11,192,36,216,236,85,85,56,136,13,48,227,136,227,80,64,11,192,248,9,64,240,16,204,56,11,64,128,28,85,85,112,128,15,4,
+16,28,192,51,128,184,36,158,160,10,0,224,27,192,199,2,244,84,84,252,0,192,24,2,242,252,64,192,24,130,242,84,125,252,192,248,24,224,254,192,248,224,80,224,21,16,159,16,160,82,85,252,64,184,23,232,224,15,64,184,15,48,231,216,
+248,10,80,184,19,85,85,192,230,204,253,16,136,28,80,40,22,0,235,192,176,23,192,248,12,224,248,19,85,37,64,152,10,128,176,43,0,96,129,176,80,23,116,80,27,128,56,11,214,73,82,188,248,13,238,18,200,11,188,114,32,14,0,208,
+16,85,125,84,128,12,244,184,18,83,80,252,255,248,130,104,206,252,248,23,33,108,33,109,85,245,252,248,27,192,96,65,30,144,31,208,104,16,240,248,12,67,240,252,78,232,245,42,1,190,190,43,238,248,27,1,44,1,45,224,248,14,238,248,
+12,1,46,1,47,234,65,224,248,14,238,252,184,116,224,248,18,17,42,17,160,184,117,85,85,242,253,64,104,25,248,88,14,64,184,13,60,191,128,96,9,192,152,16,60,200,13,85,5,224,157,16,166,204,208,16,80,48,79,0,224,15,0,160,
+13,242,85,149,0,224,15,208,168,15,252,168,16,0,120,14,48,48,18,0,80,21,30,103,85,85,224,92,72,12,244,152,10,64,102,142,96,19,140,184,11,60,72,24,64,86,85,85,212,112,23,64,86,212,112,23,192,240,9,144,112,21,64,240,
+10,0,80,122,222,248,16,85,85,128,232,13,94,136,16,188,248,9,64,136,22,188,255,0,128,25,26,117,0,128,21,85,85,120,79,0,112,31,64,128,86,192,248,101,4,232,12,192,248,21,56,240,20,244,216,18,85,85,120,248,14,128,127,248,
+232,25,192,248,20,146,120,14,192,248,18,64,112,14,184,232,27,85,85,64,248,24,0,248,10,8,16,22,248,111,88,88,27,16,192,10,132,224,20,64,136,9,85,85,132,224,22,64,240,10,132,224,21,64,240,11,184,40,22,132,208,9,0,224,
+25,204,243,85,85,72,232,13,56,222,0,224,15,48,248,11,64,248,9,8,240,21,94,40,9,200,160,21,85,85,112,152,131,72,119,222,88,20,30,224,24,34,208,9,0,128,44,128,56,26,184,96,20,85,85,64,104,16,222,248,14,128,96,14,
+64,104,20,38,88,21,0,224,12,64,96,19,0,224,16,85,85,252,80,20,64,168,252,132,179,192,152,62,192,248,63,102,40,24,232,248,9,76,72,15,111,111,64,136,23,193,0,194,254,253,195,21,248,20,196,0,197,254,253,198,125,131,13,240,
+252,255,248,40,97,93,97,57,224,248,28,60,254,170,170,240,248,27,176,248,47,72,248,72,120,248,50,204,248,32,224,248,30,0,128,183,88,232,195,170,170,20,88,19,160,240,11,60,88,11,255,248,15,12,68,124,32,15,180,248,9,140,64,9,
+170,170,8,56,18,192,213,200,8,27,152,70,140,8,27,192,248,27,0,88,11,76,8,39,234,171,124,88,11,132,248,19,60,112,12,246,248,9,41,96,40,104,38,128,14,224,144,10,23,170,148,18,41,104,44,64,136,28,148,41,128,144,27,0,
+136,35,170,170,0,176,25,252,168,21,128,128,42,192,248,59,144,39,192,248,24,80,189,0,128,48,170,170,160,240,9,124,232,9,64,177,0,144,23,30,182,72,134,0,184,20,240,160,10,170,170,0,144,31,132,224,91,192,56,15,64,128,25,0,
+232,57,160,208,64,8,37,252,248,23,170,170,0,184,95,192,176,71,4,32,19,192,176,11,4,32,18,0,64,228,0,240,224,200,160,23,170,170,0,240,13,226,248,24,8,64,24,222,200,17,226,248,20,132,144,24,116,216,9,226,248,57,170,170,
+222,248,13,150,248,19,64,136,13,8,138,244,128,12,64,136,20,222,248,10,64,8,15,170,170,128,104,32,64,136,17,226,248,26,64,104,48,192,248,41,112,207,64,248,33,0,240,29,170,170,196,184,25,40,208,21,176,241,192,240,12,112,112,25,
+176,192,96,48,192,33,176,8,20,170,90,112,64,34,64,248,33,48,184,67,0,248,33,64,248,55,128,248,28,252,184,12,3,136,216,23,181,170,0,246,136,216,23,252,236,96,192,248,24,40,198,72,216,25,64,252,250,253,192,248,252,192,248,124,
+0,192,32,94,0,95,0,96,230,248,26,97,0,167,0,30,60,168,197,248,21,8,168,8,228,234,40,26,8,162,8,216,223,228,224,248,25,85,224,248,11,8,100,8,99,8,98,226,248,10,251,253,86,0,87,224,248,12,104,8,103,8,102,222,
+248,10,92,0,55,0,253,255,60,24,128,253,8,4,32,56,32,57,32,58,40,59,40,5,240,255,0,244,5,32,53,32,54,32,22,40,61,40,62,255,255,40,6,40,50,0,49,96,8,32,9,32,10,32,11,32,16,224,159,40,248,244,252,23,
+32,24,32,25,32,26,224,255,238,226,96,12,0,13,0,14,0,15,0,17,251,39,0,18,32,244,252,27,0,28,0,29,0,30,238,80,21,226,152,246,170,208,9,240,248,14,128,176,14,120,60,84,253,236,244,252,64,240,17,48,176,16,192,184,
+94,160,176,63,8,96,8,95,21,84,8,94,238,248,12,246,232,16,238,254,252,222,248,9,242,248,9,117,125,54,245,160,248,25,224,248,50,8,85,224,248,17,92,8,11,8,87,8,86,125,125,224,248,16,92,8,10,8,93,8,92,224,248,16,
+106,11,9,43,9,42,221,251,190,248,13,224,248,14,45,9,222,130,20,8,55,190,254,8,49,32,255,254,50,32,6,32,7,40,52,40,51,128,233,51,32,52,32,21,189,170,32,22,126,233,54,40,53,110,234,128,232,69,252,64,23,0,192,16,
+255,149,210,168,15,3,1,77,1,78,1,79,1,80,248,248,24,228,248,27,252,71,248,192,248,62,9,86,1,87,1,85,1,88,254,32,2,250,244,252,244,194,253,236,248,9,88,189,241,244,0,246,0,91,248,248,0,250,45,247,254,244,248,10,
+255,243,0,245,0,227,199,247,0,249,254,251,0,252,0,253,252,76,4,255,244,232,238,159,125,244,230,0,231,0,232,222,254,248,11,222,0,223,8,128,255,252,248,213,0,233,0,234,0,235,0,63,2,219,0,207,8,215,0,220,248,252,28,194,
+236,225,0,224,252,8,252,218,231,63,0,240,0,239,252,221,0,208,8,226,8,227,166,222,248,212,240,8,232,254,242,0,241,252,248,9,32,170,16,250,240,248,12,252,218,252,252,248,25,170,170,210,248,13,252,248,17,194,248,29,128,248,14,252,
+248,18,128,248,30,0,240,128,8,245,10,87,248,254,12,242,254,237,252,86,9,86,18,247,250,232,11,85,251,244,248,11,18,240,9,250,238,238,232,13,18,244,236,0,240,16,215,8,236,224,23,8,250,20,242,214,0,237,0,229,8,241,13,7,
+236,0,245,249,228,0,217,8,236,80,71,232,0,240,11,216,236,0,241,8,237,228,85,85,252,238,4,240,12,0,246,248,232,10,0,240,252,192,248,34,10,242,4,243,73,65,246,217,252,4,243,248,254,252,18,224,14,181,160,242,248,11,244,252,
+0,240,9,248,4,224,12,242,244,252,138,194,44,241,40,227,0,240,15,254,0,241,254,217,141,10,0,218,40,227,213,244,252,234,254,248,11,61,131,240,214,210,240,10,225,0,221,182,254,149,193,174,220,207,244,233,0,240,14,182,216,214,236,138,
+106,208,128,240,17,206,234,216,240,252,228,252,70,240,24,8,85,5,0,240,100,31,40,252,255,248,252,255,248,252,255,248,252,224,80,12,254,232,247,255,2,250,253,56,1,104,1,58,244,248,14,3,1,251,253,4,1,5,250,253,59,1,105,1,
+61,244,248,14,6,1,29,1,248,31,30,254,31,1,8,1,62,1,63,1,64,11,7,238,7,244,248,10,190,28,0,109,254,80,128,250,154,255,250,248,13,190,224,128,10,199,254,224,154,254,250,248,13,7,4,190,28,16,109,254,224,172,5,245,
+166,252,250,248,13,190,128,254,160,248,23,178,248,9,9,1,214,135,10,254,248,10,11,160,253,178,248,9,12,1,15,9,254,1,215,16,1,254,248,1,14,160,253,178,248,9,248,9,12,234,15,25,16,17,16,248,125,192,224,160,248,15,12,17,
+13,1,254,196,3,72,25,13,9,248,224,160,248,16,122,171,200,252,254,160,248,18,17,1,18,254,248,10,19,160,248,16,224,240,21,86,143,236,240,17,250,248,11,72,254,248,30,206,240,17,250,254,37,1,38,30,149,250,130,248,25,39,1,40,
+250,148,248,11,246,232,9,32,106,238,224,50,250,172,248,11,246,232,12,17,168,4,160,41,160,248,14,246,232,11,180,245,175,182,51,160,248,12,246,232,11,52,1,53,1,54,1,55,160,248,12,170,214,246,232,19,194,240,29,64,248,13,250,248,
+19,184,254,196,236,11,218,240,16,184,254,214,90,12,200,235,14,160,248,24,228,233,25,236,234,160,248,23,12,168,234,212,170,224,160,248,23,228,236,19,64,248,48,0,240,31,8,240,13,170,170,254,216,11,250,252,206,240,13,254,216,11,250,252,
+8,240,13,254,216,11,250,252,170,170,8,240,16,250,248,14,8,240,15,92,240,15,8,240,15,28,248,15,8,240,23,64,248,21,122,189,160,248,21,188,240,27,238,224,17,32,1,33,160,248,22,238,228,34,1,35,66,13,160,248,22,238,228,224,
+49,160,248,21,238,228,17,85,168,160,36,160,248,20,26,252,254,252,20,65,160,248,16,86,85,238,228,250,254,66,232,253,0,240,31,4,224,21,192,208,21,128,216,51,162,232,21,85,85,182,244,160,248,15,162,232,9,182,244,160,252,162,232,19,
+182,244,160,252,85,85,162,232,18,164,221,160,200,23,174,254,188,242,162,232,19,188,240,11,160,200,43,85,245,224,240,63,160,248,83,0,208,57,192,208,49,160,192,13,208,212,178,248,11,12,9,170,10,13,2,203,218,193,254,195,240,210,178,248,
+11,224,194,178,168,230,184,209,252,182,193,224,172,200,11,202,4,96,193,186,209,216,209,252,188,86,17,224,2,240,11,12,158,209,130,195,120,193,248,73,21,250,224,2,240,9,160,192,13,176,212,162,184,29,84,85,250,2,240,13,4,228,66,232,
+9,224,240,15,4,228,66,232,9,96,208,15,85,85,4,228,66,232,9,224,192,13,4,229,66,232,10,160,248,13,116,252,66,232,11,85,85,160,248,13,254,216,19,0,208,39,6,208,17,128,216,13,6,208,17,128,216,13,6,208,17,85,85,192,
+208,17,96,208,55,168,184,13,238,248,13,160,200,21,238,248,9,160,200,21,238,248,9,85,85,160,200,21,238,248,9,160,200,21,238,248,9,160,200,75,64,200,83,0,240,31,8,240,23,85,85,232,254,8,240,23,232,254,8,240,23,0,160,9,
+160,200,105,92,192,19,18,208,9,85,85,92,192,21,20,241,212,237,92,192,21,180,234,212,236,92,192,21,180,233,85,85,212,237,92,192,21,66,232,13,94,224,17,0,208,141,36,184,13,32,216,23,128,168,25,85,85,36,184,13,32,216,22,160,
+248,24,36,184,15,32,216,23,36,190,160,248,13,54,232,21,85,85,2,240,9,78,238,240,232,13,2,240,9,78,238,240,232,13,2,240,12,164,221,85,85,238,248,11,2,240,11,164,221,238,248,12,68,216,27,224,240,16,128,192,62,0,160,65,
+85,85,128,216,21,40,192,19,128,216,11,40,136,12,36,136,10,32,222,8,194,46,196,86,85,248,8,195,160,248,11,136,131,252,248,12,196,132,160,254,85,85,72,192,19,160,248,9,8,240,17,238,248,11,8,240,19,44,216,11,8,240,19,44,
+216,11,85,85,8,240,23,96,208,17,246,232,17,96,208,13,246,232,17,0,208,131,192,8,62,192,248,63,213,222,102,24,24,232,248,9,226,254,222,248,19,3,59,107,193,0,194,254,253,210,173,195,242,248,16,255,196,0,197,254,253,198,242,248,
+16,86,85,255,248,252,255,248,43,8,254,253,224,248,45,238,248,11,192,248,29,212,248,13,222,248,23,225,47,230,248,29,250,96,1,96,2,32,1,32,252,253,56,96,244,198,248,15,96,3,222,230,3,68,80,254,248,242,224,254,200,254,8,4,
+248,0,204,252,160,106,230,254,158,233,224,255,200,252,226,254,252,253,64,84,144,234,200,248,14,252,248,12,192,200,248,10,173,164,174,192,248,15,64,238,248,11,222,254,248,128,253,170,170,30,233,226,248,11,222,248,11,192,248,17,128,248,18,170,
+224,22,192,231,98,252,64,168,252,248,23,36,64,250,252,248,23,170,170,128,248,9,98,248,11,128,248,12,64,248,20,0,248,9,42,248,18,128,240,11,192,248,14,170,139,192,240,21,230,248,18,206,252,170,216,26,254,253,0,110,160,208,27,127,
+225,226,28,1,23,1,24,1,25,250,248,22,226,28,0,47,253,82,0,83,0,84,250,248,21,224,1,20,1,21,1,146,126,22,250,248,22,224,160,248,124,74,216,223,96,5,32,31,40,239,83,254,254,5,0,45,224,248,16,9,32,32,40,254,
+9,122,127,254,104,46,104,35,220,248,13,64,13,0,33,0,34,14,175,252,18,254,96,47,96,37,220,248,13,94,245,0,239,122,236,48,0,39,220,248,13,64,232,10,252,254,220,248,9,6,104,122,189,5,64,224,20,184,254,16,104,9,192,248,
+18,184,248,9,17,64,18,170,245,0,224,63,45,200,252,96,232,131,84,200,18,108,200,11,96,88,203,84,204,1,110,213,95,1,111,252,248,11,100,210,0,240,9,64,2,33,106,33,107,252,248,11,89,98,192,176,10,246,132,176,16,228,226,255,
+42,24,211,41,96,40,104,38,0,42,124,248,13,192,248,11,222,248,20,136,170,120,80,175,212,222,248,16,240,163,112,221,106,85,144,210,188,248,15,144,163,112,216,9,8,110,233,222,252,158,229,144,162,37,43,10,216,11,208,203,222,194,227,104,
+64,145,160,248,9,9,6,250,240,205,222,194,227,96,164,251,23,160,248,13,25,176,175,48,64,17,96,18,96,12,160,248,15,84,85,250,126,160,11,0,211,160,248,12,250,248,14,160,210,160,248,12,250,248,14,82,210,224,160,248,14,148,248,12,
+224,160,248,20,232,236,160,170,96,124,160,248,22,232,236,162,190,252,248,17,112,187,170,142,144,242,192,239,252,248,12,232,198,0,224,252,190,160,112,4,0,146,95,254,250,248,9,252,64,240,12,16,32,9,40,8,254,254,188,194,244,9,104,8,
+50,173,80,170,254,30,119,85,32,17,32,13,254,248,11,96,13,128,176,20,192,168,11,162,144,13,248,248,11,85,85,0,188,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,85,85,255,248,252,255,248,252,255,248,
+252,255,248,252,255,248,252,255,248,252,0,240,1,255,248,252,85,0,255,248,252,255,248,252,255,248,46,0,240,0,0,0
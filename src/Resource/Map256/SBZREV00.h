@@ -0,0 +1,170 @@
+181,254,0,255,248,252,255,248,41,8,254,248,14,255,254,96,4,32,5,32,255,251,6,32,4,40,3,40,2,40,1,40,154,224,248,16,224,32,238,255,215,32,236,32,224,40,13,40,12,40,11,40,10,216,254,224,254,63,28,64,224,0,238,0,
+236,0,250,149,0,129,75,176,246,229,216,254,172,166,96,5,255,31,224,253,228,0,240,0,241,0,242,0,243,0,139,0,109,25,246,238,172,166,96,229,224,253,238,16,99,4,229,0,237,224,251,254,216,240,255,254,248,252,242,64,243,64,228,64,
+253,64,227,64,10,255,238,254,248,23,28,248,11,84,104,229,96,238,112,237,120,255,65,242,112,241,112,243,96,129,96,149,96,166,255,248,10,56,132,148,8,239,8,130,248,254,240,251,16,250,239,0,24,24,23,64,224,248,15,243,8,242,129,191,
+8,251,254,86,179,0,169,64,169,239,254,224,248,11,80,54,80,55,254,254,64,56,224,248,17,26,42,10,29,10,225,232,28,2,254,29,18,42,40,224,248,16,10,143,208,34,10,24,2,37,254,250,25,224,254,242,199,96,220,241,254,65,96,76,
+10,21,228,99,12,38,2,39,250,21,8,179,216,167,226,224,238,254,253,75,96,77,26,224,195,11,40,2,41,250,18,21,0,221,254,252,194,159,14,178,242,254,98,22,98,23,26,25,26,223,2,160,18,24,18,25,224,255,250,102,243,252,252,195,
+222,26,98,27,26,29,26,28,18,254,29,133,194,2,42,224,255,14,240,246,242,224,2,207,131,30,98,31,98,32,236,76,104,114,33,48,106,252,6,134,8,190,158,32,125,254,122,168,202,104,73,104,245,99,195,106,253,236,224,239,178,241,180,254,
+8,124,50,109,224,204,0,205,224,152,244,80,26,243,236,172,243,241,154,129,224,14,7,24,0,225,104,246,224,242,24,149,162,81,254,64,192,164,252,24,56,224,248,12,38,77,234,224,20,240,9,224,253,235,194,253,224,236,253,224,214,96,252,254,
+248,26,226,64,224,16,63,66,237,16,241,16,242,16,251,254,248,243,84,0,170,118,234,160,235,108,192,137,4,128,235,238,254,10,242,242,16,131,16,102,241,254,189,6,170,35,224,253,254,242,98,234,220,254,224,248,14,16,240,166,40,160,254,158,
+252,248,252,144,182,160,90,192,255,254,10,234,220,241,236,242,230,241,209,172,252,225,252,224,248,10,254,129,0,119,168,189,0,218,233,145,0,219,172,24,237,24,229,224,162,164,228,149,192,228,252,254,206,245,247,253,224,243,238,120,249,254,248,27,
+66,69,120,244,254,248,27,66,70,0,107,55,58,16,117,0,108,170,241,118,252,254,254,118,24,240,1,236,246,72,25,0,246,196,132,230,228,252,236,8,214,235,63,254,8,107,224,254,218,234,104,18,104,17,104,16,104,15,194,44,216,232,108,8,
+196,250,252,250,175,224,74,241,104,13,104,12,104,11,104,10,216,255,192,122,146,255,224,32,254,253,216,252,96,30,16,138,252,184,14,104,224,81,254,80,14,165,5,254,248,11,64,40,232,24,120,253,224,7,2,64,25,8,118,254,96,98,32,225,
+104,246,132,252,254,10,63,41,160,74,62,224,16,234,104,24,159,32,248,10,254,16,240,10,65,74,64,89,81,224,208,12,254,20,253,184,224,254,6,117,164,156,232,255,178,254,224,252,104,19,35,136,40,254,24,228,168,220,241,160,250,218,140,224,
+254,40,254,0,248,12,178,243,10,67,74,10,160,66,0,248,19,122,254,142,254,224,248,11,44,232,124,231,194,224,248,28,230,158,245,224,248,19,24,234,170,107,222,244,152,241,224,248,18,97,254,238,201,254,253,64,209,170,106,224,248,14,68,211,
+254,255,98,226,224,248,17,96,232,11,224,248,65,254,248,32,25,151,177,106,236,24,117,56,244,244,238,8,170,74,0,247,180,234,78,238,8,242,194,246,32,240,10,110,243,170,104,218,24,242,254,254,224,248,9,14,242,238,252,234,118,0,21,190,
+162,224,248,11,0,240,9,76,235,64,213,220,188,224,248,12,0,240,17,160,255,0,240,22,126,248,9,85,85,66,68,0,232,19,72,242,224,252,0,236,104,228,30,253,38,244,84,5,244,0,248,9,232,243,228,247,4,242,208,82,89,60,0,248,
+15,192,228,24,235,158,0,248,10,82,129,42,106,255,98,238,0,248,15,192,84,85,150,2,254,0,248,89,224,248,9,96,217,255,248,252,255,248,77,244,171,215,83,254,248,12,96,6,160,176,13,10,227,240,32,241,254,40,208,107,248,0,193,192,
+176,13,0,237,8,224,194,142,186,119,75,30,8,193,237,160,176,15,224,246,185,119,0,24,43,168,222,240,224,248,18,250,233,200,114,197,190,193,218,158,224,248,14,244,170,254,248,13,227,0,192,12,226,210,183,240,96,241,150,148,254,104,240,160,
+199,254,152,169,120,175,123,172,238,88,128,170,214,0,252,254,226,224,253,98,5,20,194,238,252,254,64,192,185,36,169,240,32,138,226,228,252,239,26,99,252,172,255,64,195,228,254,227,254,209,4,130,224,162,166,240,172,193,253,254,224,252,242,241,
+16,244,42,194,26,163,236,26,169,146,254,130,254,224,224,4,32,212,254,254,188,212,164,252,16,145,182,216,192,242,44,240,198,189,248,208,252,214,248,64,23,86,227,80,249,16,254,248,26,226,80,244,254,248,29,204,222,85,197,68,202,254,253,180,
+218,210,222,16,198,194,199,216,98,225,107,214,199,204,96,214,236,255,33,32,182,255,34,196,232,12,31,192,204,96,206,234,208,32,179,32,169,32,189,49,82,32,180,254,248,254,248,199,180,112,234,0,161,72,64,170,10,149,8,129,197,242,28,185,
+90,169,254,119,182,155,244,64,255,8,239,72,243,72,242,64,241,64,251,254,106,116,250,248,248,15,224,153,14,246,112,180,4,206,104,246,180,66,244,232,236,226,192,243,196,242,254,247,183,194,224,248,9,112,239,42,244,96,160,242,134,178,146,199,
+141,87,0,250,192,248,10,250,224,179,0,189,128,243,130,178,144,34,220,224,248,25,254,208,224,139,4,160,136,194,224,160,32,98,254,226,160,252,32,254,239,87,213,192,252,8,108,192,248,12,206,226,114,170,108,233,160,248,26,100,196,211,44,83,
+96,84,224,112,115,224,138,233,236,239,224,112,249,254,254,96,80,96,81,96,104,70,242,112,8,98,105,224,226,172,241,224,244,223,183,254,254,96,90,96,91,168,178,112,131,112,132,78,169,243,234,95,150,234,160,225,236,176,10,26,209,117,112,120,
+112,121,112,122,128,169,66,127,62,224,14,183,108,112,110,112,111,112,56,147,255,113,112,114,114,126,254,87,128,162,64,158,5,112,100,112,101,112,102,112,103,82,253,192,253,97,149,0,243,254,149,32,238,218,190,164,186,166,89,89,224,32,222,244,
+136,224,10,254,160,228,85,253,22,192,11,0,224,18,40,136,15,254,248,252,254,248,26,240,120,39,32,154,32,1,215,250,32,2,32,3,64,225,64,130,6,224,254,232,255,10,32,11,215,130,32,12,32,13,64,225,64,130,236,192,125,210,170,222,
+232,253,74,241,6,219,240,225,0,244,192,124,199,8,229,28,223,86,251,124,2,209,228,224,254,140,129,168,211,24,168,210,238,16,149,191,186,16,129,16,139,16,218,16,254,145,224,253,0,133,72,243,255,5,8,227,242,72,237,72,238,80,149,80,
+209,242,237,178,255,247,255,248,12,72,144,72,143,72,142,72,141,72,140,28,200,23,72,153,239,93,8,152,72,151,8,224,248,29,161,8,160,224,248,27,80,170,188,192,25,195,87,224,248,29,8,224,173,8,172,64,171,112,240,17,224,255,234,191,
+128,181,224,248,25,88,183,88,182,104,191,8,190,223,241,26,112,24,193,8,163,104,162,32,248,23,8,150,224,174,104,90,181,164,224,248,9,12,192,14,6,66,208,11,0,242,12,197,254,254,236,85,170,248,253,199,0,165,64,136,9,158,192,9,
+254,199,224,192,10,90,255,224,248,61,12,224,13,246,110,199,240,254,130,240,14,128,72,127,72,126,72,254,189,125,98,240,24,138,72,137,8,136,64,135,96,240,24,148,72,147,208,175,224,248,28,190,146,224,248,30,157,8,156,64,155,224,232,26,
+239,191,192,248,28,72,168,72,167,224,248,27,104,178,104,177,88,166,80,165,127,143,224,248,24,188,96,187,8,176,8,175,224,248,24,186,96,185,85,85,224,145,12,176,24,8,245,4,226,0,240,20,8,245,4,226,0,240,20,85,171,72,245,222,
+182,32,240,16,224,248,49,0,240,13,199,246,200,14,0,176,11,235,130,2,177,112,25,234,154,224,106,104,238,254,252,64,250,176,142,183,116,201,224,248,9,8,109,8,180,254,112,109,213,64,32,179,208,68,179,224,248,13,120,187,72,150,90,113,
+224,68,179,224,252,16,224,145,224,252,222,149,72,62,216,192,8,209,8,190,192,248,9,107,224,254,30,108,8,192,253,8,219,8,190,224,248,9,117,224,255,238,86,21,224,46,182,224,252,194,145,224,248,14,228,231,30,47,224,120,94,120,93,224,
+36,104,35,224,248,19,124,248,252,120,66,120,92,16,160,86,104,85,104,122,190,58,0,180,224,248,14,74,120,82,126,95,104,68,2,124,0,180,128,168,10,126,224,64,120,63,120,99,237,255,160,151,12,145,64,108,192,13,226,120,70,120,67,120,
+98,120,97,65,225,120,96,186,238,130,64,224,15,108,24,57,127,82,120,46,120,45,120,44,104,5,254,32,224,22,186,125,85,175,192,121,224,248,24,0,133,0,224,21,236,88,9,214,104,252,254,252,10,85,0,241,244,255,236,248,10,160,240,160,
+178,138,153,90,74,213,86,146,178,162,78,0,97,64,234,16,16,98,189,128,89,58,72,9,80,20,254,146,99,96,100,224,100,254,170,106,224,119,56,97,78,170,224,248,23,236,233,164,177,246,93,24,69,21,160,92,38,203,166,224,252,32,248,13,
+128,255,149,81,136,218,66,244,152,9,254,16,224,254,88,149,136,236,16,204,153,8,244,254,252,224,243,156,255,224,188,164,236,24,226,104,238,105,200,105,199,37,229,105,198,254,92,128,52,177,100,245,226,191,152,211,105,210,105,209,121,208,254,92,
+192,229,68,252,62,96,193,224,226,203,105,202,9,10,162,201,246,113,254,235,248,32,91,224,248,171,96,193,224,105,206,105,205,9,204,244,120,11,224,254,116,122,218,73,224,223,105,207,234,105,213,105,212,197,227,234,172,224,248,11,162,218,9,217,
+226,216,215,226,105,215,105,214,72,164,192,86,24,96,241,224,222,191,214,9,221,8,117,105,220,105,0,194,0,240,15,227,50,225,192,226,87,85,118,120,246,88,0,86,0,241,0,80,29,0,241,148,244,6,240,12,85,213,0,86,0,242,86,76,
+156,144,12,94,58,172,241,96,87,110,154,170,186,139,68,240,14,172,241,224,255,160,67,158,248,12,158,139,24,239,122,85,32,216,16,254,248,12,192,79,237,24,242,190,72,16,192,238,236,232,16,164,142,245,171,192,236,26,244,0,162,97,224,97,
+225,97,252,209,190,215,168,255,72,153,224,26,243,0,162,97,234,97,235,97,236,97,69,43,237,97,224,253,8,128,65,8,200,97,46,118,252,51,254,1,227,97,228,97,229,97,230,192,168,240,10,0,163,142,242,224,152,9,250,97,239,97,200,250,
+240,154,40,0,166,22,226,97,231,97,227,183,232,97,233,188,246,97,247,97,248,170,211,226,226,111,0,162,254,75,254,97,241,97,242,97,243,88,106,97,80,57,84,64,158,56,177,246,243,254,97,244,249,92,245,190,106,97,251,97,252,160,218,64,
+102,232,219,26,244,72,254,188,112,192,147,120,171,170,246,120,245,232,237,0,128,13,0,240,21,0,230,130,240,13,142,155,86,173,0,229,128,58,250,58,211,246,137,208,57,60,130,109,234,202,203,202,32,224,9,24,229,58,211,196,14,229,234,201,
+170,162,224,16,226,74,246,168,123,240,59,254,59,224,199,48,58,50,189,64,130,254,224,56,80,229,10,251,50,238,252,244,240,88,0,122,184,0,158,71,171,0,159,0,197,254,248,248,19,198,111,104,252,76,104,35,122,234,0,246,2,209,10,247,
+240,96,251,254,104,88,233,96,11,246,224,96,139,86,45,246,76,45,112,54,130,238,104,209,193,229,120,248,0,226,8,248,254,98,208,10,130,86,236,238,238,254,160,210,36,227,119,224,248,26,62,140,149,156,224,248,23,64,230,78,117,246,208,44,
+24,240,85,145,224,160,192,9,236,106,242,254,114,106,190,108,53,160,102,209,240,192,33,237,236,107,216,192,10,202,217,240,103,21,224,239,144,64,204,20,191,192,215,64,36,224,226,84,217,220,224,88,21,242,208,16,84,187,2,225,22,217,64,186,
+148,84,224,106,105,48,218,224,116,191,192,248,9,102,149,21,85,192,252,192,224,9,224,103,160,106,41,224,255,192,196,37,85,76,105,160,220,96,64,202,124,201,224,252,180,114,42,175,250,149,170,210,224,243,0,224,25,130,86,208,209,160,254,232,
+154,194,0,176,17,227,0,128,19,240,232,22,107,65,242,238,226,224,248,16,250,234,229,242,235,222,0,113,173,170,224,248,15,48,241,229,84,253,160,115,224,248,18,144,242,84,197,178,65,128,248,17,208,218,192,182,203,64,56,224,248,19,193,205,
+212,194,230,252,241,64,129,224,248,18,247,170,229,192,114,203,192,248,22,192,236,158,217,64,32,248,16,224,171,96,199,24,243,118,219,128,201,160,248,20,224,236,185,8,37,68,8,193,224,248,20,192,92,220,161,64,224,248,29,252,247,224,248,20,
+200,0,42,224,160,248,224,248,21,192,253,8,241,40,171,64,224,248,19,242,187,250,224,72,14,252,72,18,234,93,128,240,16,140,64,193,120,133,174,82,33,96,34,128,148,40,229,138,70,161,87,136,67,242,236,174,83,169,96,189,204,69,60,226,
+127,181,204,227,24,109,24,229,16,247,192,233,92,11,152,201,224,90,179,244,233,162,178,28,14,241,94,67,224,248,11,239,228,26,188,238,69,160,223,224,255,8,178,224,172,240,8,251,85,93,254,253,242,114,217,224,248,10,64,181,248,166,192,248,
+15,239,16,4,98,8,106,252,239,252,236,218,6,228,224,248,10,243,81,34,170,252,126,234,218,212,218,143,160,224,254,180,64,248,254,250,248,248,22,106,85,44,240,148,186,134,192,48,14,224,255,199,50,242,56,242,192,101,190,100,193,250,4,247,
+224,222,217,149,44,241,192,225,96,224,56,42,236,208,214,65,190,97,200,69,250,109,0,60,225,0,106,43,129,136,209,192,170,78,214,199,152,59,139,188,241,68,217,214,210,192,139,128,228,160,205,226,68,208,10,224,240,245,175,24,237,128,228,192,
+255,224,24,208,24,219,24,218,246,131,122,80,140,175,140,209,192,255,8,209,24,228,246,132,224,48,13,13,10,196,155,26,141,149,186,152,148,152,233,85,148,252,229,32,172,254,201,36,152,11,148,180,236,169,36,128,224,243,174,233,240,98,234,233,
+170,248,94,233,106,164,64,109,12,208,18,0,48,13,216,229,218,128,116,240,24,216,229,224,248,23,64,152,235,96,220,10,164,186,184,248,19,224,252,254,186,184,248,19,197,106,224,243,226,82,236,184,189,198,116,8,240,9,12,43,240,213,85,28,
+192,9,198,116,136,200,9,0,250,24,247,234,227,240,33,252,198,80,5,224,184,254,224,244,240,38,220,199,224,171,42,184,253,64,70,152,13,136,162,116,136,9,192,194,226,248,13,224,248,17,84,132,248,129,146,198,160,248,11,248,234,92,21,119,
+224,119,172,233,222,50,232,252,208,239,175,173,234,139,64,149,64,128,16,60,188,226,160,188,80,224,114,170,106,30,184,11,60,190,224,216,10,230,232,12,128,248,11,0,96,21,8,165,0,160,41,104,181,171,232,42,238,26,240,172,237,234,26,96,
+208,226,109,96,188,170,170,226,43,120,236,72,234,110,186,204,156,0,250,126,43,150,41,86,245,72,163,254,248,11,189,194,25,64,160,152,168,220,128,216,21,52,21,119,32,170,46,209,120,232,9,208,248,15,104,241,32,155,208,248,10,214,32,208,
+176,10,94,213,224,202,0,203,96,217,64,221,152,145,208,176,12,168,241,43,84,203,8,202,64,218,68,201,150,139,208,176,15,136,217,85,112,0,186,32,121,2,231,170,201,208,8,204,32,34,223,193,136,220,64,226,88,109,20,210,72,248,254,248,
+252,171,170,96,179,96,82,225,8,201,0,245,3,152,252,112,184,96,192,232,17,85,85,48,241,139,50,33,64,204,56,216,10,16,216,12,2,123,40,241,64,176,19,85,189,208,216,12,224,248,20,198,219,192,217,224,248,21,8,244,129,64,119,174,
+191,228,201,0,240,18,120,40,110,13,64,248,22,104,25,96,229,56,109,11,23,182,196,48,109,64,248,17,224,112,239,24,132,202,67,177,124,16,158,236,218,32,15,192,250,214,203,90,144,9,224,248,20,247,22,144,9,192,248,22,119,0,23,252,
+33,170,190,32,192,248,20,98,121,208,177,216,145,224,248,15,114,49,112,94,122,213,152,181,210,202,224,248,17,48,112,66,54,217,38,9,218,252,224,248,16,11,254,47,112,74,70,19,8,224,248,18,114,46,112,63,16,2,160,64,70,19,224,250,
+186,255,43,224,254,114,43,114,44,114,45,112,67,112,70,212,169,70,18,233,67,192,32,11,128,195,34,112,44,112,226,46,5,181,238,218,26,177,168,246,217,224,255,128,194,189,138,192,236,235,26,13,72,90,254,90,130,168,224,160,195,224,236,232,
+9,214,18,137,170,106,18,202,176,219,210,117,0,192,25,22,244,202,220,198,219,198,195,6,173,92,192,198,128,9,229,214,193,250,187,254,189,198,195,85,80,192,192,9,22,10,48,84,254,252,116,94,234,128,202,85,85,0,116,22,10,224,248,21,
+0,116,18,114,6,114,16,114,244,188,215,162,224,253,8,209,192,195,238,130,109,222,90,152,202,138,164,137,38,205,208,181,224,244,234,160,194,170,168,224,6,147,194,234,160,194,236,185,224,170,92,64,170,174,92,236,116,134,235,160,196,252,225,138,
+234,96,182,220,74,196,147,120,82,124,182,161,64,202,24,151,84,243,24,242,24,80,162,70,94,241,196,169,116,79,86,68,224,144,234,112,194,224,212,32,85,214,156,180,124,0,241,32,131,148,234,82,81,154,46,89,124,73,164,169,164,232,50,61,
+70,64,242,192,154,250,16,248,254,109,194,136,42,214,130,160,224,234,224,255,120,169,169,42,106,220,241,122,157,38,243,224,248,10,0,130,2,180,169,170,28,80,168,9,0,244,0,176,15,0,192,14,64,216,49,48,40,11,170,170,64,216,20,116,
+178,58,125,64,216,21,132,244,96,171,128,152,16,192,122,234,160,52,239,224,120,21,144,242,28,188,214,64,22,192,248,17,90,117,128,242,204,170,188,241,72,0,128,19,28,243,106,145,214,233,64,253,85,85,160,208,22,162,129,184,225,64,185,224,
+248,23,46,234,128,74,224,248,18,85,81,92,243,202,137,80,241,224,248,20,144,59,128,224,240,22,85,173,176,57,238,225,20,241,64,208,22,32,56,13,144,160,22,189,248,236,170,253,32,120,18,122,180,0,192,252,16,192,76,202,212,8,254,254,
+40,3,40,2,215,254,40,1,40,154,224,255,202,211,40,206,196,109,48,149,40,129,223,235,40,22,40,21,40,20,216,252,104,154,64,234,212,202,52,149,13,233,16,23,210,156,16,216,23,216,104,20,105,127,88,33,254,80,8,254,248,16,20,16,
+21,16,22,112,240,223,208,255,248,22,80,154,80,1,80,2,112,3,24,168,38,170,170,5,232,248,23,16,228,80,57,248,216,20,128,29,88,224,20,0,222,74,85,44,154,152,96,19,96,221,224,214,24,232,23,32,170,56,226,91,85,224,248,18,
+199,192,163,199,224,248,24,0,237,240,225,104,209,120,224,20,149,148,224,204,224,248,27,160,82,184,88,224,21,86,241,147,174,64,208,184,64,248,20,224,140,149,8,184,201,42,43,96,248,18,92,209,32,46,128,248,20,40,224,248,64,24,224,22,
+170,146,232,252,202,0,150,24,80,17,34,82,252,40,169,24,80,22,232,252,74,128,120,203,96,248,26,164,42,224,248,25,124,216,72,25,86,193,224,114,62,43,224,248,21,117,191,40,198,216,138,8,194,160,248,20,179,64,189,0,217,119,212,174,
+129,203,8,195,224,248,25,8,221,254,224,248,19,224,234,56,168,119,192,202,8,254,224,248,19,126,73,170,26,64,181,202,182,128,88,10,104,246,192,116,202,179,126,90,251,85,85,254,6,162,192,184,9,80,214,232,202,150,125,20,18,16,150,107,
+171,32,63,124,158,130,24,187,149,142,129,208,192,104,11,226,171,170,194,4,194,154,18,186,217,120,132,240,140,0,112,31,54,1,191,175,10,1,11,2,53,2,54,222,216,23,1,20,1,21,29,208,252,170,90,255,248,68,184,152,13,86,154,0,
+32,142,254,24,13,0,112,10,6,113,241,12,115,175,218,16,226,139,96,149,250,29,244,29,32,19,158,225,24,102,164,170,18,129,136,145,92,234,0,88,9,144,180,34,162,224,168,170,228,72,179,0,88,13,224,35,70,162,244,224,9,146,67,146,
+170,64,235,64,34,222,224,248,12,190,13,160,211,18,235,10,170,206,131,216,103,226,146,252,128,206,84,10,238,66,164,37,152,96,11,224,128,205,72,13,139,230,253,134,85,80,178,252,160,254,72,14,252,92,198,244,88,9,32,137,165,171,112,135,
+152,156,198,130,8,130,96,128,9,128,149,234,149,6,104,13,252,96,10,0,104,127,12,243,179,96,189,4,240,16,236,253,85,85,32,4,156,138,57,214,241,96,56,9,200,195,224,248,10,42,167,69,5,32,161,224,248,18,196,108,130,102,60,240,
+85,213,192,248,17,100,246,224,248,13,64,218,88,209,56,216,10,174,244,236,252,170,234,227,192,240,39,128,224,15,120,224,15,224,248,31,48,224,23,26,224,29,224,248,33,96,170,183,4,156,177,152,144,19,232,253,104,243,226,96,199,128,192,18,
+237,66,173,108,226,128,187,250,199,168,248,15,64,202,24,192,58,133,254,200,242,227,224,248,18,232,139,0,160,143,32,154,32,1,32,235,254,2,32,3,52,49,178,165,96,31,232,248,12,20,32,21,32,22,7,88,120,149,96,199,252,254,104,129,
+114,217,24,254,246,40,104,218,20,96,21,96,22,96,225,239,23,24,254,22,24,21,88,20,64,9,218,166,96,223,95,9,104,40,120,8,88,254,254,3,88,2,88,1,88,100,167,85,85,255,248,252,0,208,17,0,64,22,6,66,4,69,254,248,
+9,236,254,0,212,85,2,98,25,122,121,96,106,150,114,248,242,245,94,88,185,128,235,80,10,218,16,219,28,211,237,24,242,244,201,171,171,130,130,209,204,201,224,108,192,203,16,209,154,114,218,203,235,135,8,225,16,247,140,211,224,108,224,80,
+240,80,241,254,13,114,88,240,248,170,80,174,8,225,238,242,212,163,236,224,82,192,208,47,195,0,221,254,40,2,150,98,248,40,176,17,224,102,220,255,230,212,0,213,224,248,24,204,0,231,0,232,0,233,0,171,94,207,24,216,224,248,17,240,
+168,13,40,224,18,240,168,9,129,32,149,192,112,18,171,170,228,196,124,144,211,160,169,168,144,21,224,168,9,168,144,21,142,102,170,181,160,201,0,80,21,186,212,224,248,18,40,232,200,32,124,241,64,48,27,179,26,84,124,241,64,104,14,4,
+104,10,6,224,170,82,128,240,13,68,65,37,85,56,133,64,161,224,8,145,204,248,12,204,154,244,225,85,210,0,101,124,73,64,50,192,83,254,60,16,9,224,252,170,170,119,0,237,192,81,210,105,136,90,26,38,0,100,0,237,42,169,48,106,
+30,26,184,180,160,89,228,224,152,9,160,179,170,86,210,105,88,24,9,32,9,244,182,160,177,0,160,15,119,4,65,236,248,9,85,173,0,112,210,160,160,31,130,160,77,0,247,206,67,184,112,18,139,210,233,110,93,2,243,206,66,96,229,80,
+96,18,189,140,171,34,67,64,243,240,40,19,85,117,114,173,230,217,184,112,18,180,55,10,242,208,216,17,0,36,64,248,245,47,182,9,246,187,0,208,50,129,96,119,104,209,96,130,0,208,12,84,85,254,149,246,155,32,123,22,233,220,164,74,
+163,72,161,171,94,68,90,109,32,214,246,252,222,162,234,204,8,129,24,66,164,153,172,32,238,246,238,232,77,109,180,201,168,226,66,138,186,160,160,10,254,248,16,142,153,224,80,187,255,53,82,33,254,248,25,80,43,82,232,159,105,24,97,25,
+97,26,97,59,252,27,97,28,250,248,18,29,97,224,23,97,30,121,27,247,85,121,26,121,28,250,248,17,97,31,97,32,64,136,145,32,136,109,144,198,253,87,136,80,15,144,192,15,40,13,40,12,40,11,40,10,216,248,15,128,119,213,19,170,
+237,216,254,64,198,224,255,109,8,180,254,166,135,248,238,254,32,228,32,253,254,170,90,96,96,112,9,254,248,20,32,140,62,141,68,115,152,141,240,92,34,89,85,160,58,224,190,34,78,28,192,201,208,225,96,138,85,21,94,185,192,180,246,11,
+44,35,168,227,92,140,216,178,85,213,106,224,224,13,216,252,66,141,224,254,0,112,32,255,248,252,64,214,254,237,6,192,232,24,224,32,119,32,149,32,236,192,232,24,224,130,25,129,93,85,0,236,254,161,24,16,64,241,192,232,16,12,196,110,
+178,88,26,5,253,8,242,136,9,254,192,23,204,209,8,240,24,109,97,21,24,248,254,16,109,168,43,68,50,206,210,186,106,254,208,64,241,250,16,48,100,2,21,212,133,206,209,16,241,0,72,121,224,247,16,119,136,42,88,220,8,39,120,28,
+182,211,176,224,209,229,192,83,80,255,254,8,38,180,128,13,0,240,80,104,69,104,88,104,87,223,143,96,37,96,38,96,39,224,248,20,79,120,78,96,47,55,60,254,48,96,49,224,248,20,89,228,0,50,0,51,118,60,222,59,224,248,19,120,
+59,224,60,0,61,236,64,250,112,89,224,248,20,49,120,166,247,255,160,78,112,79,224,248,20,39,120,38,120,37,112,87,112,88,112,250,216,69,7,232,252,12,240,252,34,56,34,57,254,58,46,248,23,199,170,34,59,34,60,254,61,186,240,107,
+108,248,147,84,248,135,42,136,144,248,105,64,216,252,0,96,252,128,184,118,26,18,252,198,16,250,124,184,19,112,28,112,14,119,255,187,250,23,104,23,40,22,40,21,40,20,216,248,11,112,8,252,135,18,252,250,20,16,21,16,22,16,149,216,
+31,246,104,22,104,21,104,20,164,112,40,180,248,11,80,154,95,168,80,1,80,2,80,3,226,246,196,96,224,248,12,162,65,68,240,68,70,245,254,104,161,96,254,68,240,12,33,26,192,117,254,248,254,104,161,96,248,195,254,232,56,119,8,109,
+24,255,23,23,92,0,129,24,149,250,141,254,64,106,169,120,44,245,157,106,76,254,254,248,9,88,33,254,120,44,80,252,0,80,74,226,63,188,14,49,169,96,25,0,14,254,104,246,104,245,253,58,24,135,224,8,33,202,96,203,96,227,224,248,
+14,234,25,104,237,88,84,224,128,155,130,130,172,186,224,255,74,106,144,116,232,136,169,224,78,106,50,169,96,229,85,135,224,248,9,74,105,90,153,104,170,226,163,224,16,224,195,74,24,112,239,224,8,118,192,253,238,26,26,97,224,40,172,32,
+155,96,224,226,8,108,37,87,224,253,0,130,160,194,119,96,243,128,248,10,128,36,18,43,224,212,29,192,149,224,248,10,96,28,168,86,254,224,254,100,145,176,217,224,248,9,189,120,162,64,146,85,65,136,99,62,27,242,241,224,248,13,64,46,
+126,12,75,209,10,224,248,23,86,224,244,226,32,248,10,192,248,11,240,85,254,154,109,0,24,96,209,32,248,10,224,254,242,36,95,0,166,17,0,218,96,219,160,248,10,174,254,253,130,160,27,238,21,218,24,218,112,130,224,248,10,206,26,68,
+240,107,210,37,14,163,96,254,224,255,238,189,31,240,104,20,255,248,10,255,1,2,229,248,23,1,4,1,5,1,250,185,255,12,228,248,20,14,1,15,1,16,246,22,183,126,172,248,18,6,1,7,214,255,3,172,248,17,242,255,17,1,19,1,
+13,233,183,172,248,17,255,2,50,2,51,1,33,199,255,254,191,119,172,248,11,2,52,2,53,2,54,168,248,12,8,1,9,172,248,9,2,55,235,245,80,248,16,18,172,248,18,224,248,11,10,1,11,172,248,15,224,248,12,20,1,170,66,21,
+189,216,252,255,248,183,32,232,252,0,80,20,30,210,254,189,85,93,236,248,10,64,106,166,126,12,58,244,100,140,9,16,237,238,210,161,54,64,219,254,124,124,10,224,248,12,119,52,107,247,107,37,224,254,118,224,248,11,237,46,121,50,121,224,
+73,85,176,100,254,224,254,238,248,9,64,104,12,68,122,76,43,85,181,64,120,12,0,32,30,72,88,15,254,248,55,240,80,39,60,168,10,240,58,6,254,215,224,254,232,255,10,32,11,32,12,32,13,32,199,240,59,192,44,168,86,6,210,232,
+253,244,201,222,44,199,64,212,128,105,65,183,196,58,242,198,44,184,241,16,149,152,105,228,42,66,224,254,192,242,166,241,30,205,228,254,139,213,227,144,21,224,252,26,211,248,193,237,64,241,254,242,195,53,72,237,72,244,208,80,209,238,109,0,
+96,194,105,252,223,254,29,105,28,105,27,105,26,105,25,97,24,224,248,18,127,184,32,105,31,113,28,113,26,113,222,30,97,23,170,170,48,64,106,66,65,224,248,18,48,71,66,64,107,255,248,219,142,240,141,114,232,141,94,255,0,160,42,0,
+32,25,237,104,240,244,157,12,162,240,120,243,112,241,112,8,213,251,254,250,243,0,36,80,34,100,59,239,255,250,0,130,24,250,50,57,130,8,203,0,203,16,130,16,239,11,21,64,236,72,50,146,252,209,44,35,14,161,108,244,224,72,33,240,
+252,68,0,224,0,32,15,24,239,17,84,8,149,184,224,56,59,0,32,17,184,254,85,85,32,165,0,32,193,208,232,9,250,248,17,190,233,208,232,9,250,248,17,190,232,133,93,45,255,248,252,104,40,94,96,6,224,248,24,104,43,192,185,32,
+156,113,84,85,254,34,224,248,15,104,44,192,185,44,181,224,248,16,240,45,191,240,224,169,38,1,39,2,71,214,171,246,37,1,34,193,4,2,76,250,208,169,72,250,79,63,238,9,37,9,36,242,2,73,2,74,2,75,1,77,238,250,228,1,
+36,64,99,216,250,200,9,38,232,36,68,133,242,228,162,252,202,252,180,69,82,1,35,124,173,246,218,255,248,9,222,252,119,139,255,248,23,2,87,226,240,29,2,88,248,253,84,178,253,159,162,248,1,44,1,45,9,254,44,232,99,135,164,81,
+1,74,248,85,226,252,9,94,252,79,166,1,54,1,55,9,254,194,161,1,54,240,211,87,222,2,86,25,61,17,59,254,9,31,15,79,1,64,9,41,1,254,9,64,1,31,63,212,85,1,86,1,97,222,75,9,61,1,59,65,72,254,224,17,
+246,62,240,143,254,206,1,94,1,95,1,96,1,107,29,18,254,87,192,255,73,1,232,105,254,198,132,206,104,248,106,212,231,36,146,103,1,43,254,60,164,254,253,43,92,184,210,252,244,253,254,121,1,122,254,255,21,192,236,254,254,248,22,172,
+255,254,246,234,254,191,209,80,1,81,1,82,1,83,242,253,132,254,206,248,9,255,243,113,9,113,1,90,1,91,1,92,1,93,240,129,199,251,1,101,1,99,212,123,9,123,4,242,1,36,10,245,63,76,9,190,233,108,242,10,75,10,74,10,
+73,17,39,18,24,64,234,76,241,1,238,250,38,241,29,149,32,242,16,242,9,35,240,208,235,212,254,84,32,228,116,245,234,235,240,252,196,186,82,5,172,16,247,2,245,246,235,4,247,176,247,99,198,224,81,1,86,248,253,84,9,48,1,48,
+248,49,111,252,254,255,51,9,86,248,233,96,252,44,9,44,1,87,118,94,9,58,1,174,57,32,244,254,30,241,17,105,240,1,254,64,243,105,9,104,9,46,224,182,254,212,69,1,70,254,253,71,176,245,111,123,67,214,234,9,111,64,243,72,
+17,79,68,244,9,250,42,3,8,108,242,9,250,246,140,248,9,21,170,210,73,60,240,18,140,248,9,244,109,160,248,16,224,248,13,3,129,254,248,19,42,9,152,254,148,247,193,12,240,9,52,1,53,40,241,101,9,53,9,246,214,248,9,8,
+77,92,254,236,116,240,233,110,35,168,226,1,88,242,246,238,234,216,235,170,191,84,240,9,106,242,2,225,24,225,72,244,10,71,9,39,9,38,34,40,230,252,24,244,222,212,234,252,218,235,41,17,230,14,242,234,236,224,216,131,178,242,234,26,
+245,252,232,9,214,130,42,252,223,238,220,220,16,224,45,228,248,20,4,225,16,226,158,213,172,79,1,55,42,250,253,224,253,252,217,69,69,9,75,234,234,224,186,240,13,226,233,224,178,22,230,48,226,84,86,243,190,248,11,58,198,217,0,188,
+254,196,230,112,240,9,59,25,122,31,161,254,253,121,1,72,9,94,200,196,72,174,171,252,220,254,252,25,112,254,253,224,233,9,104,180,233,48,240,13,170,26,46,240,21,198,235,194,237,128,252,254,252,246,216,30,52,228,9,84,129,252,254,222,
+228,248,13,228,234,12,242,254,84,85,246,254,218,228,248,13,240,218,14,247,80,242,110,242,104,208,9,85,69,20,243,56,210,36,211,0,240,11,236,248,10,18,241,214,173,170,240,239,12,243,35,242,248,9,0,240,10,0,208,12,0,224,63,6,
+214,90,213,255,252,108,209,142,231,9,200,35,6,212,250,218,6,243,126,240,9,251,135,61,17,111,82,226,2,86,1,46,1,47,9,252,106,131,94,228,203,28,224,9,122,229,9,222,202,57,252,246,223,240,218,238,217,79,64,240,15,9,85,1,
+75,1,67,1,68,88,245,26,175,73,224,248,10,58,244,95,222,77,1,78,212,236,85,85,58,208,20,95,240,248,12,128,248,9,248,238,214,232,13,192,232,19,222,232,35,22,230,85,85,244,248,15,198,237,52,242,72,225,0,209,68,214,238,184,
+11,38,240,9,85,85,46,226,232,252,6,244,28,247,206,237,20,198,240,233,254,234,80,89,214,178,253,252,200,11,178,241,210,220,252,85,85,12,192,55,252,232,23,252,220,238,248,12,252,237,236,204,46,243,12,243,237,168,232,204,6,229,56,242,
+186,9,66,224,46,241,42,95,12,242,14,225,232,201,46,114,206,66,1,68,86,241,1,175,204,201,250,222,68,1,67,208,233,125,161,232,202,68,206,252,1,76,1,78,50,243,238,59,31,35,46,243,77,1,104,9,105,254,104,170,168,170,206,28,
+244,216,202,84,242,16,196,194,206,0,240,13,90,85,42,212,2,226,178,201,9,178,202,200,204,28,246,228,252,198,184,9,45,40,230,216,33,254,254,116,2,209,250,20,194,196,216,16,66,46,230,252,129,228,100,218,217,105,17,252,204,222,228,218,
+133,222,233,254,66,140,248,9,246,100,248,102,4,153,252,232,250,120,212,18,15,254,120,222,218,118,9,210,21,254,188,252,254,102,1,117,114,203,254,248,14,193,123,232,196,222,252,127,1,128,160,253,131,9,132,4,81,254,250,210,248,16,228,80,
+201,171,44,254,248,28,98,152,252,46,187,222,248,21,152,46,253,221,32,248,134,1,135,254,254,9,244,78,252,9,146,196,70,254,254,224,178,68,68,84,248,252,232,196,248,131,166,179,4,20,254,82,242,134,252,84,68,46,220,252,192,248,9,134,
+248,11,206,212,245,20,228,248,17,166,254,254,254,118,1,119,254,9,148,81,248,224,248,21,254,248,11,62,68,224,248,23,153,205,254,248,43,46,50,18,252,98,42,235,8,238,234,254,240,9,210,248,12,212,238,234,142,246,125,33,168,1,126,254,
+9,250,222,252,114,246,74,85,142,240,9,188,248,13,114,244,138,116,172,234,22,240,10,232,233,69,85,192,234,212,232,11,252,254,248,17,158,248,11,238,240,12,234,245,5,101,158,252,218,248,11,166,140,238,170,243,170,181,90,234,238,136,245,134,
+247,88,170,241,242,232,13,144,232,15,102,242,239,37,85,186,240,14,230,239,228,234,240,13,8,240,17,234,243,160,240,16,85,73,254,248,119,46,254,188,184,9,28,248,9,126,226,246,24,234,93,21,188,186,152,169,9,53,14,232,10,206,233,204,
+245,202,240,11,84,65,210,166,241,172,243,232,220,244,236,224,86,245,85,85,134,227,224,216,10,244,232,13,254,255,224,240,33,134,240,13,230,248,10,36,201,85,85,194,248,17,154,224,11,198,180,118,244,234,162,210,248,17,202,232,11,6,224,13,
+85,85,234,232,17,152,248,25,144,216,10,8,248,9,254,248,12,118,254,240,232,115,22,226,137,84,232,186,252,244,186,156,188,154,224,252,137,168,22,226,232,248,252,110,10,170,110,212,0,227,254,254,232,72,254,206,242,244,242,86,85,130,226,112,
+214,125,250,227,242,238,224,252,130,226,238,235,14,208,18,85,145,242,237,2,226,0,229,54,240,19,194,240,11,146,5,32,222,188,208,19,254,150,146,85,5,18,228,254,248,13,164,206,74,232,9,26,240,13,42,244,90,194,65,86,84,17,129,254,
+194,248,12,80,85,224,190,252,244,216,11,162,200,15,224,254,240,219,238,219,53,67,162,200,13,140,200,21,254,248,105,116,138,250,116,85,205,46,241,2,226,148,242,252,235,28,225,12,208,9,89,174,10,246,2,226,118,9,160,240,15,106,208,9,
+248,240,9,94,206,160,170,246,198,180,244,124,242,224,252,4,212,188,245,170,42,20,208,12,14,243,254,236,246,253,168,224,15,4,208,19,162,200,15,220,248,13,73,170,80,254,252,74,168,234,6,214,164,184,17,170,170,198,252,224,204,42,224,19,
+198,252,26,248,9,224,248,9,200,236,198,252,170,231,116,200,11,16,192,21,20,224,55,20,216,24,254,248,58,158,1,161,254,154,51,170,246,255,240,254,182,254,168,232,196,120,242,180,246,196,240,190,1,253,6,200,246,240,244,195,159,137,224,172,
+1,138,1,171,224,208,136,164,196,248,224,192,252,250,152,239,173,240,189,254,142,1,143,246,253,181,135,31,1,185,9,184,224,25,163,25,162,17,183,27,225,224,165,254,248,10,146,252,202,150,9,24,133,194,224,153,152,224,254,232,156,143,147,248,
+159,224,155,9,191,112,111,160,188,186,1,187,224,253,156,1,157,224,248,10,139,6,0,224,252,192,188,47,135,224,252,166,1,167,224,248,10,160,17,100,115,195,162,1,163,224,141,224,255,169,252,17,7,34,181,17,185,25,164,34,254,128,255,30,
+234,148,1,176,1,177,1,178,1,51,105,151,25,160,192,254,202,240,13,254,248,15,170,5,72,32,252,212,253,254,176,188,8,165,254,8,244,152,186,243,32,143,67,197,9,197,1,193,86,154,1,112,150,36,201,250,104,162,242,106,192,241,3,196,
+17,197,25,224,180,139,254,4,9,183,42,252,9,248,252,44,134,106,244,181,9,186,1,185,254,248,242,7,0,152,25,44,250,70,21,84,106,242,64,254,254,248,21,222,102,254,254,248,11,226,254,126,140,242,9,145,1,144,254,192,4,0,254,248,
+242,172,71,80,254,141,17,141,166,254,204,248,15,244,252,76,32,8,9,222,100,2,242,129,146,34,206,70,242,206,252,240,50,0,216,236,214,235,34,248,52,161,170,222,206,240,253,168,244,122,238,166,238,130,112,250,244,168,232,9,168,128,240,9,
+212,154,9,140,161,194,12,241,252,164,186,241,224,254,248,152,147,160,1,153,9,234,212,248,11,254,42,232,9,0,42,2,241,226,222,180,244,188,241,96,244,17,78,192,22,248,9,196,84,168,188,244,9,14,234,240,195,160,241,58,40,10,232,9,
+148,242,190,235,9,189,254,32,234,248,248,12,84,72,48,191,10,241,22,234,224,165,132,103,254,24,250,141,1,156,242,50,40,224,18,241,25,252,224,254,60,233,30,8,250,148,1,149,214,224,94,57,226,17,184,25,181,224,248,10,92,233,248,159,
+240,69,254,192,184,17,185,86,235,224,208,220,170,224,248,16,0,240,9,171,170,175,60,235,24,80,151,128,169,254,238,4,240,15,181,10,250,216,21,254,248,9,232,242,150,254,253,128,240,11,214,254,175,16,144,154,1,155,1,120,241,122,241,246,
+171,171,66,208,190,36,235,0,228,2,224,9,246,254,230,253,36,45,222,224,10,228,26,227,9,246,254,6,181,32,9,224,192,252,230,242,0,228,174,82,6,246,255,224,242,130,152,224,6,65,138,0,228,224,246,254,224,173,85,65,226,195,224,253,
+32,228,164,242,22,230,224,180,226,85,210,192,252,0,224,11,224,248,9,116,226,22,200,252,196,242,170,22,179,186,241,246,252,28,233,128,243,128,222,159,40,242,65,178,134,192,158,218,240,32,220,191,76,96,204,226,240,100,166,224,248,11,153,69,
+18,164,233,34,241,230,240,156,252,84,117,34,224,255,164,235,0,218,68,242,180,242,240,242,190,9,80,82,246,60,244,76,236,128,246,224,11,228,218,45,32,30,236,64,216,9,172,54,229,250,244,43,106,252,0,224,9,94,233,254,100,218,186,217,
+9,176,42,174,128,224,14,17,252,242,176,252,248,238,168,252,168,42,192,130,220,136,218,176,254,238,252,26,222,240,248,10,129,86,156,236,48,241,58,252,168,26,219,254,248,9,35,1,184,226,182,236,226,254,16,21,146,244,232,154,202,213,170,68,
+156,150,14,211,28,252,116,201,224,104,84,44,98,98,222,192,236,28,252,180,252,125,1,64,219,224,252,25,187,25,186,216,227,244,9,45,226,242,244,34,252,184,64,241,180,170,238,183,42,237,140,196,254,18,228,0,254,140,211,131,200,232,247,9,
+187,42,32,253,72,84,101,224,238,181,232,247,128,255,4,241,252,143,138,102,213,187,17,188,254,88,211,224,253,170,64,250,124,201,224,253,236,248,9,244,255,98,146,238,206,28,225,248,76,252,140,234,25,181,192,240,13,17,164,170,181,32,212,248,
+17,254,248,30,16,224,11,252,184,15,64,203,170,108,80,213,58,212,222,208,11,160,213,80,212,250,222,210,145,85,85,116,243,120,242,152,242,234,190,182,244,242,252,32,201,30,201,149,172,146,242,238,254,254,254,242,198,218,155,178,247,106,85,174,
+252,46,242,134,204,114,210,173,94,244,96,193,10,234,32,200,11,21,212,146,218,88,241,124,253,250,138,226,70,210,76,185,2,84,9,172,234,244,178,153,70,240,10,170,226,45,44,162,226,142,233,17,40,188,224,163,9,82,193,169,130,220,170,229,
+134,200,9,82,202,178,192,15,142,130,42,42,216,21,246,254,174,22,211,116,221,36,190,242,248,9,89,80,224,14,228,178,46,223,210,134,218,252,210,9,212,240,194,104,70,240,210,186,254,102,220,65,2,190,17,44,200,210,38,248,229,10,196,218,
+78,222,248,9,232,252,226,212,86,85,254,8,208,9,179,0,215,46,252,24,230,90,225,234,245,236,232,11,85,149,192,222,48,232,10,236,175,192,196,200,254,142,217,222,229,30,36,224,168,25,171,25,198,192,194,200,82,26,232,142,217,134,247,224,
+170,25,172,85,206,224,252,154,146,243,228,219,1,166,194,172,174,160,196,85,173,16,186,206,235,204,233,106,243,156,231,64,184,9,155,146,202,32,136,88,184,16,202,52,248,11,84,184,255,146,170,254,16,220,180,32,196,34,194,38,237,184,176,11,
+170,42,16,205,224,172,22,176,19,224,226,68,232,9,26,188,74,241,12,211,24,42,254,64,179,9,164,152,22,238,124,219,128,85,254,250,12,179,17,172,188,142,235,224,253,7,201,124,219,17,183,204,176,227,224,64,208,9,2,1,168,30,225,72,
+66,224,73,164,204,106,248,13,118,62,66,248,13,222,213,192,248,11,246,168,19,171,104,238,254,248,29,80,5,254,248,29,64,16,81,255,248,237,11,23,96,5,32,254,248,26,226,104,238,8,254,248,26,10,170,226,72,224,248,28,226,224,248,31,
+0,240,252,255,248,252,191,223,255,252,112,179,112,169,112,189,0,240,26,32,80,33,80,34,0,240,25,221,182,66,16,160,248,29,66,17,224,248,30,18,224,248,30,19,160,248,190,20,223,127,0,224,30,32,32,33,32,34,0,224,25,96,179,32,
+169,32,189,40,238,255,85,254,248,21,104,238,64,179,0,169,0,189,32,224,25,224,248,31,160,216,9,216,165,246,112,25,106,254,104,25,4,242,240,125,151,89,254,224,254,81,254,64,40,224,254,72,40,4,242,182,202,240,72,25,224,254,64,194,
+255,255,248,11,224,248,128,10,246,86,82,254,0,208,154,255,250,239,112,86,255,120,40,110,93,104,22,245,32,179,250,232,9,96,88,240,10,32,214,0,179,26,240,9,171,154,246,240,9,72,224,248,32,16,240,11,254,248,19,186,240,15,254,252,
+16,253,255,254,0,208,19,16,211,16,221,66,5,2,6,2,15,1,255,208,247,66,241,201,224,248,17,66,1,66,2,224,248,28,11,66,244,58,12,224,66,9,66,10,224,248,19,160,254,66,8,248,175,246,224,248,21,80,125,80,126,80,127,82,
+7,224,248,23,190,247,254,248,9,224,248,53,2,3,2,4,224,248,28,13,2,14,224,248,27,96,125,207,170,96,126,96,127,98,96,16,240,15,254,216,15,124,242,170,130,16,240,11,254,216,15,48,240,15,26,224,19,224,248,10,56,240,14,254,
+16,60,0,192,63,48,0,58,254,248,15,107,0,14,67,161,254,20,201,224,248,20,230,117,222,33,224,248,30,192,248,15,202,0,203,224,248,9,16,118,228,8,25,47,190,224,252,130,236,212,0,213,218,248,10,16,24,230,126,218,224,252,230,47,
+247,238,222,0,223,218,255,160,24,192,248,9,204,0,143,90,231,0,205,0,233,194,218,252,128,253,24,192,254,202,10,238,215,154,224,248,12,96,248,12,231,83,224,200,0,206,186,207,24,216,128,16,82,35,126,224,248,11,250,248,9,192,252,118,
+62,170,170,224,2,176,27,0,210,6,208,23,0,214,34,176,27,32,210,170,213,64,240,31,12,208,9,255,248,21,202,208,149,0,160,222,33,246,200,9,0,214,12,240,11,255,215,96,169,120,24,120,23,120,22,120,21,112,30,32,160,17,88,193,
+255,235,9,88,8,88,7,88,2,88,1,24,154,14,240,17,46,240,13,96,251,127,214,96,252,254,248,26,226,64,224,0,237,8,242,0,241,0,251,240,255,254,248,255,240,0,149,0,23,0,24,0,129,64,248,31,236,224,214,0,226,0,229,0,
+109,0,180,254,249,254,8,109,8,229,8,209,8,243,214,242,8,12,31,237,224,254,236,16,240,16,241,195,255,254,251,254,24,240,8,219,8,218,0,238,0,3,31,208,16,124,250,224,228,0,227,197,8,246,154,255,250,241,158,136,119,222,254,224,
+228,64,253,254,248,17,24,229,225,143,246,253,198,184,0,158,0,159,0,197,182,255,254,248,248,19,198,64,240,96,4,86,243,6,40,3,40,2,40,1,215,227,40,154,8,0,254,252,224,255,224,32,238,254,236,127,237,40,13,40,12,40,11,40,
+10,216,254,160,231,224,182,241,209,77,26,0,236,174,241,129,14,216,254,240,185,33,198,67,254,96,34,224,218,0,219,224,24,0,0,255,216,220,254,168,97,220,237,226,242,240,185,169,254,96,189,60,158,224,208,0,124,192,214,0,252,195,8,254,
+226,228,8,239,218,22,14,232,192,240,11,227,184,247,246,238,88,229,170,170,252,232,254,131,224,252,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,170,170,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,0,240,1,255,248,252,
+255,248,252,10,0,255,248,252,255,248,41,0,240,0,0,0
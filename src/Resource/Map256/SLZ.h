@@ -0,0 +1,145 @@
+125,159,0,255,248,192,1,82,9,82,240,248,27,17,84,9,84,239,125,232,78,1,79,240,248,28,80,9,80,240,248,147,1,85,9,85,190,223,248,81,9,81,240,248,17,97,63,32,1,33,252,248,24,183,255,96,1,96,6,254,248,29,64,254,
+248,28,97,110,64,7,8,8,0,127,164,9,0,4,0,6,0,5,0,244,242,39,248,1,77,9,77,244,246,97,112,64,10,159,30,0,11,0,12,8,5,254,0,13,0,14,51,35,254,15,224,232,188,69,0,236,15,196,190,252,144,67,188,254,
+248,9,232,72,224,7,236,36,162,6,192,252,1,74,246,154,252,19,68,138,124,184,12,210,58,160,194,5,9,74,254,246,44,2,154,252,170,224,255,200,194,177,12,254,120,172,255,128,148,16,216,144,4,194,192,81,82,184,190,236,252,224,44,253,
+192,248,11,146,71,250,32,252,160,11,8,54,145,85,72,255,118,122,32,254,224,254,184,255,37,25,192,253,0,248,11,84,248,254,56,147,170,250,10,202,156,242,232,243,164,247,192,248,9,42,200,224,254,164,245,152,254,192,252,206,160,254,82,0,
+56,240,252,224,8,6,186,245,56,196,242,224,255,254,253,13,64,14,254,15,72,4,96,254,14,254,248,240,0,3,250,200,142,234,73,254,41,168,250,158,224,24,232,241,226,98,241,220,248,14,32,144,242,252,250,166,244,254,246,68,42,180,248,9,
+242,250,168,244,254,248,11,180,252,129,43,246,250,198,252,1,75,250,248,9,180,248,9,1,130,192,236,216,252,218,117,250,254,246,252,182,248,10,96,14,232,12,97,66,182,248,15,24,238,104,5,78,181,248,2,190,9,176,248,10,254,241,7,222,
+209,208,242,156,243,6,97,67,190,224,13,97,63,224,182,243,9,84,24,5,254,220,192,224,17,54,236,186,252,34,162,222,184,252,238,74,177,64,190,233,242,253,186,15,246,4,84,32,144,254,238,64,94,241,228,202,150,129,186,246,252,214,246,84,
+85,238,94,243,140,233,168,252,164,252,214,252,244,252,0,245,70,150,254,206,252,242,254,100,143,244,34,224,29,194,46,208,147,86,9,86,247,120,250,88,9,88,224,248,22,87,9,87,250,89,9,89,87,245,228,248,17,104,17,0,216,13,224,248,
+15,64,240,15,0,200,193,255,248,252,0,104,191,255,209,104,208,104,207,96,206,224,248,24,215,104,214,104,213,104,212,215,191,104,211,104,210,222,248,21,156,211,219,104,218,112,217,96,216,254,126,186,248,23,154,226,104,222,112,221,120,220,222,248,
+28,224,104,223,8,32,215,127,222,248,28,87,104,38,233,222,248,25,8,90,104,93,104,92,120,91,255,239,222,248,26,100,104,99,104,98,104,97,104,96,104,95,154,248,23,8,255,171,104,104,103,104,102,104,101,33,63,97,63,16,248,21,254,252,
+194,127,0,238,246,221,254,151,96,152,96,153,96,154,96,155,241,47,216,240,23,220,156,96,157,96,158,96,159,180,240,25,252,254,220,96,160,96,161,96,162,248,240,27,96,163,104,164,96,126,239,165,222,248,28,166,96,167,112,168,222,248,28,169,
+104,170,180,240,27,0,111,104,171,96,172,96,173,190,248,27,0,156,174,236,248,11,16,87,245,222,248,16,1,69,224,248,25,188,253,255,248,28,160,208,149,78,248,29,64,7,86,81,72,72,202,7,68,202,64,248,17,240,198,250,10,177,197,174,
+224,248,20,240,196,224,24,224,248,20,9,77,224,171,90,85,124,177,192,248,22,198,194,9,128,182,158,232,20,64,178,32,189,36,240,24,182,222,122,28,233,175,254,224,27,30,169,70,97,71,239,240,28,47,124,176,96,177,96,178,224,248,26,150,
+179,120,180,104,181,255,254,152,232,28,182,96,183,96,184,104,185,204,224,26,186,96,187,104,188,247,255,120,189,96,190,220,248,26,191,96,192,96,193,32,194,32,195,32,191,255,196,32,197,32,198,32,199,132,224,20,200,96,201,32,202,32,203,87,
+253,32,204,32,205,0,224,17,4,192,13,0,200,252,255,248,198,97,63,96,138,255,245,96,139,96,140,96,141,96,142,96,143,224,248,17,26,187,144,96,255,171,145,96,146,96,147,96,148,96,149,96,150,0,248,207,0,136,29,170,170,0,168,179,
+0,240,123,224,240,31,80,129,160,140,58,155,224,248,18,16,136,11,170,86,160,141,240,208,14,190,253,96,132,160,200,22,22,140,4,160,200,24,154,122,85,85,218,129,224,248,20,176,132,154,131,224,248,19,224,123,58,122,192,248,23,171,170,158,
+124,15,26,130,0,248,25,90,132,224,248,18,66,255,128,248,22,146,170,224,246,192,240,23,68,146,114,192,240,24,158,136,10,96,192,21,106,87,30,122,250,141,192,192,21,250,200,14,3,240,232,29,96,2,224,248,30,192,248,14,176,11,41,192,
+248,44,4,128,248,29,72,5,192,248,30,42,213,224,192,248,61,128,248,252,2,128,153,255,24,2,128,26,208,120,23,245,87,105,66,0,128,17,208,120,11,104,2,32,7,32,9,0,128,9,192,204,114,85,254,204,252,105,67,70,170,200,228,16,
+162,206,80,16,85,85,200,96,10,255,248,252,255,248,134,76,242,254,192,27,74,245,254,192,24,192,96,9,86,149,254,254,128,16,224,94,142,102,254,128,15,224,88,11,85,5,226,210,252,254,135,240,150,138,206,226,149,234,101,153,254,133,128,252,
+194,168,148,244,92,81,180,254,130,16,168,192,92,162,71,184,246,88,9,69,217,254,130,112,203,98,10,96,9,194,234,252,171,171,171,97,106,24,86,254,248,14,234,253,97,108,195,232,252,240,96,211,186,127,0,88,252,255,248,241,0,56,13,96,
+17,16,240,48,227,0,232,0,234,0,235,140,32,248,229,248,250,240,248,15,0,64,242,244,255,250,228,174,199,252,231,202,253,240,248,9,238,0,230,218,51,9,239,0,237,248,255,240,248,11,0,0,196,220,244,255,80,1,216,244,240,224,253,240,
+248,13,242,0,0,248,188,246,208,148,50,250,255,252,240,254,255,236,214,0,72,244,254,114,240,248,9,4,64,255,98,234,240,2,144,236,228,252,255,238,164,64,0,255,254,244,240,210,18,17,224,206,252,74,16,240,8,5,252,214,254,96,233,246,
+253,80,0,73,164,206,240,254,40,18,254,1,192,255,252,238,228,236,255,248,21,72,130,242,212,162,114,254,240,64,84,255,248,11,228,88,255,241,240,248,14,2,34,244,212,170,2,80,73,130,240,248,9,48,252,174,252,234,62,248,9,73,65,240,
+248,13,238,226,248,11,240,248,9,194,110,252,85,5,140,252,62,252,240,254,2,252,142,246,255,248,25,212,137,84,252,240,11,208,240,200,254,176,248,9,124,248,9,85,80,240,248,17,236,248,23,240,252,236,254,248,242,252,240,248,13,253,255,188,
+248,17,255,248,79,243,0,244,0,245,0,246,0,248,0,249,1,96,227,2,254,234,253,253,240,255,252,244,254,15,80,0,255,1,0,1,253,246,251,208,254,137,128,240,248,10,210,218,255,212,0,250,208,253,184,255,154,253,8,216,32,128,202,254,
+255,254,246,230,146,218,242,248,9,118,254,232,246,252,228,248,15,250,160,17,7,246,255,220,40,27,254,7,254,253,34,254,246,252,18,225,234,216,254,248,5,33,136,1,6,248,9,252,224,255,65,85,236,8,254,16,160,137,16,38,0,160,9,16,
+160,13,16,38,235,160,0,160,13,104,66,163,0,112,25,104,6,254,60,160,16,170,86,254,248,10,170,15,254,248,23,216,10,144,14,232,248,18,9,178,9,254,252,85,21,242,254,236,253,230,254,122,10,242,252,246,252,102,13,89,85,218,236,52,
+8,9,190,252,242,255,248,255,190,248,14,81,53,254,248,11,178,0,248,31,6,9,0,248,29,154,252,73,121,21,252,210,201,81,96,82,120,173,96,125,226,252,248,43,230,226,83,96,84,0,85,32,71,128,67,162,23,122,230,148,205,86,96,87,
+82,168,13,253,202,192,226,248,9,88,120,89,0,90,50,10,94,123,254,11,254,184,150,112,91,96,92,96,93,0,94,38,124,58,252,172,30,174,194,121,95,96,255,97,96,98,0,99,5,32,0,100,196,254,110,248,252,254,43,224,101,96,102,0,
+103,0,104,238,116,202,252,9,85,192,240,252,224,72,0,96,30,255,224,31,224,248,223,91,73,255,248,77,17,18,247,25,246,255,244,254,228,74,241,81,5,42,230,246,210,254,214,97,250,253,252,5,2,236,248,11,232,252,238,212,188,82,73,250,
+114,234,236,254,238,252,218,212,252,82,9,196,250,252,242,252,232,252,214,84,85,254,250,252,254,254,184,252,232,252,172,224,16,184,255,88,230,173,42,254,248,29,200,248,11,1,94,227,250,252,192,248,14,128,252,30,224,13,201,149,236,182,217,218,
+92,198,252,240,254,139,21,242,90,238,254,216,93,130,223,118,222,146,223,252,91,240,12,224,14,17,96,78,104,17,236,73,238,127,1,252,254,41,74,254,248,11,97,72,96,80,96,7,96,8,96,85,73,254,119,64,240,15,212,246,120,246,46,240,
+9,244,218,240,13,85,82,46,244,214,248,9,226,240,17,110,246,254,150,240,19,160,240,16,149,65,148,208,11,248,253,174,244,4,158,224,242,148,84,182,216,244,240,0,64,31,4,216,27,0,152,252,109,109,255,248,252,0,40,202,107,224,248,30,
+109,225,240,252,16,112,225,18,224,248,30,19,61,246,222,248,31,0,160,128,94,1,95,254,96,236,248,12,100,1,152,143,101,254,102,244,97,1,98,61,86,254,99,224,248,12,103,1,104,254,105,0,84,0,200,46,167,9,0,208,12,25,74,254,
+1,73,252,84,66,254,0,171,14,80,10,32,170,232,142,29,85,26,202,0,169,96,85,224,222,164,64,171,32,168,9,85,85,0,174,68,38,192,252,226,248,10,0,172,164,252,250,252,0,168,19,181,18,162,160,9,20,81,0,168,9,96,0,174,
+22,84,218,90,82,242,0,172,96,0,171,254,94,77,254,253,82,151,192,0,8,223,0,64,252,0,64,32,104,19,0,64,29,36,131,254,222,216,29,128,222,248,27,64,154,174,192,108,233,222,248,25,64,12,84,252,222,248,23,122,170,160,80,188,
+248,24,16,12,134,244,222,248,19,224,212,242,90,85,188,248,25,224,240,9,188,248,21,64,18,136,10,136,244,222,248,13,224,253,132,247,85,171,188,248,15,224,252,128,253,148,255,222,248,9,64,74,240,10,30,246,37,85,222,248,11,88,78,246,
+56,228,238,222,248,10,0,246,36,224,15,73,245,222,254,224,134,237,254,248,18,0,49,2,224,28,97,108,109,209,97,111,192,184,30,113,224,248,30,106,126,184,29,158,126,184,28,93,148,97,110,126,248,29,97,112,126,248,29,60,126,248,28,69,
+81,28,126,248,26,224,126,248,28,224,126,248,28,101,89,128,242,126,248,27,224,126,248,26,224,126,248,26,86,21,224,126,248,26,192,220,126,248,25,24,247,126,248,22,170,170,228,88,218,201,126,248,25,128,226,126,248,27,128,228,126,248,25,94,
+85,192,252,252,240,25,64,7,8,204,227,126,248,23,128,229,126,248,24,224,254,161,202,126,248,23,224,8,224,254,126,248,20,224,252,170,42,28,126,248,20,160,253,252,240,24,224,252,28,253,126,248,18,0,228,169,234,192,126,248,21,160,205,252,
+240,24,192,205,232,219,126,248,19,65,103,79,77,9,77,1,252,238,219,78,104,77,250,190,179,254,248,9,16,224,13,104,80,104,79,224,248,22,7,64,8,64,170,164,16,97,96,240,17,98,253,16,101,32,248,20,98,16,101,149,80,32,248,25,
+1,106,97,224,248,20,166,164,82,113,85,81,48,185,0,248,25,192,248,24,164,242,116,177,192,224,248,20,173,170,134,198,192,248,24,4,68,252,128,248,22,66,255,192,248,22,66,255,170,170,128,248,22,224,246,176,85,64,248,20,42,178,192,240,
+24,2,208,11,192,248,22,170,94,0,215,224,248,19,16,176,29,8,243,6,243,224,235,82,104,81,224,232,14,193,175,32,253,156,58,195,85,104,84,8,83,224,248,12,20,174,98,239,122,8,222,87,104,86,160,232,13,194,175,234,183,0,249,224,
+8,90,112,89,104,88,224,248,16,128,127,186,253,224,152,94,104,93,104,92,120,91,53,254,224,248,10,222,231,244,241,4,188,100,104,99,104,98,159,149,104,97,104,96,104,95,224,92,254,244,243,1,190,188,120,255,103,104,102,104,101,170,170,18,
+191,250,176,19,0,168,194,255,248,63,0,168,13,0,242,84,93,254,253,10,170,160,229,224,254,0,243,222,234,146,64,100,32,214,2,170,142,157,0,245,226,252,10,91,160,253,104,36,92,228,224,0,240,9,9,220,192,21,20,18,68,64,69,0,
+240,14,220,126,58,208,56,9,149,145,222,0,240,18,194,255,154,188,84,95,152,0,240,11,254,248,24,0,96,252,255,248,204,1,82,9,82,244,248,19,60,94,242,78,9,78,250,84,9,84,244,248,19,188,122,248,80,9,80,236,255,244,248,16,
+224,248,130,81,9,81,188,215,250,85,9,85,244,248,19,97,63,104,24,121,252,252,255,235,96,17,104,78,40,17,33,63,40,1,41,252,255,18,120,13,104,235,118,80,105,72,238,112,13,170,240,29,96,22,224,248,30,20,194,248,29,96,23,87,
+86,194,248,29,96,21,194,248,30,96,224,26,194,224,248,24,194,253,85,73,224,248,25,194,252,224,248,22,194,255,224,248,23,194,70,172,181,170,194,248,25,198,172,194,248,23,4,224,248,23,194,252,246,111,194,248,21,160,106,44,185,130,128,248,
+19,194,248,12,192,248,18,132,253,180,210,7,143,194,174,194,1,7,1,252,178,233,248,8,71,248,1,25,1,28,242,252,5,1,21,1,96,44,22,240,130,235,4,244,24,220,252,30,15,242,39,1,32,214,35,1,38,214,10,254,126,224,16,75,
+212,232,29,50,36,25,142,232,14,240,254,146,94,194,246,252,250,182,248,11,220,43,42,1,43,248,254,37,93,224,36,138,248,10,236,252,248,14,156,248,11,1,44,254,248,17,245,172,192,248,12,224,248,18,192,248,14,45,1,46,232,248,254,143,
+112,192,253,1,54,1,53,252,240,47,1,48,214,31,232,248,254,192,253,1,55,1,56,1,57,207,234,240,49,1,50,232,248,254,192,254,224,254,51,89,84,1,52,232,248,254,192,250,243,224,254,73,80,64,248,18,190,224,248,25,194,224,248,12,
+64,248,18,9,37,100,193,68,252,28,32,9,250,85,85,86,16,9,10,32,13,64,36,96,22,104,22,54,22,254,254,110,18,37,82,192,28,232,252,222,200,212,190,196,24,11,185,221,78,22,198,92,166,16,18,90,160,16,9,1,93,200,24,18,
+174,210,91,248,252,97,63,254,248,9,0,220,4,216,9,252,104,90,85,6,254,248,12,0,216,16,72,78,101,206,185,66,186,0,188,242,73,81,86,254,254,224,30,149,254,0,173,46,248,9,84,41,224,88,227,58,116,0,168,9,188,9,178,168,
+252,160,16,85,192,0,184,10,192,146,220,178,222,160,160,109,192,178,170,68,225,0,168,12,160,232,161,254,248,12,0,184,10,192,248,18,130,193,254,252,0,189,224,2,169,15,250,254,248,12,170,149,100,244,248,9,56,192,143,232,158,224,248,39,
+96,10,65,4,68,86,85,254,97,66,0,142,0,80,14,0,247,0,136,16,2,240,10,0,244,21,109,0,152,18,100,138,58,241,224,0,241,104,0,152,17,15,213,10,80,225,90,241,54,169,0,152,16,72,104,138,2,245,162,36,218,0,152,18,
+234,176,62,192,0,152,15,139,202,192,188,93,192,0,152,17,172,234,170,170,254,6,156,0,158,0,240,9,254,248,29,140,224,12,0,60,238,86,160,212,96,57,224,148,227,238,225,250,96,0,57,21,73,0,85,224,253,106,234,224,202,18,227,148,
+137,250,0,61,82,176,20,85,192,224,48,9,0,61,174,132,204,8,162,128,238,81,36,0,56,10,174,66,203,190,192,149,84,0,56,16,24,131,132,228,192,0,56,9,254,156,156,227,98,84,188,252,224,254,248,16,238,216,13,84,210,184,174,202,
+252,252,254,40,228,244,254,170,170,75,224,240,11,242,248,11,244,254,102,216,17,88,216,14,254,248,12,176,248,13,42,169,192,248,10,136,248,9,244,248,9,238,253,202,250,254,254,254,80,87,182,254,250,97,0,40,13,252,248,14,96,1,0,216,
+14,254,248,16,79,158,50,160,150,88,9,88,252,224,248,24,89,9,89,92,31,252,210,248,17,105,66,0,248,13,210,248,15,104,2,32,6,212,85,254,242,232,10,208,161,206,248,11,105,67,184,112,13,192,232,17,200,120,77,117,85,22,216,25,
+255,248,37,0,240,13,96,17,0,40,22,254,255,224,248,15,0,206,85,85,198,220,0,204,240,20,0,207,130,220,136,218,0,221,34,131,85,21,254,197,192,248,13,0,216,11,184,196,192,197,0,109,0,216,15,212,170,222,160,253,154,254,0,223,
+24,0,200,9,46,221,160,252,192,170,0,216,15,224,238,252,254,218,254,0,119,170,170,0,216,31,8,136,191,0,202,254,216,25,234,137,16,224,14,0,216,9,240,232,21,250,239,255,248,177,80,192,13,254,254,104,206,96,207,96,208,96,209,228,
+248,19,96,255,251,210,96,211,96,212,96,213,96,214,96,215,198,248,18,216,120,217,215,95,96,218,64,219,28,228,226,248,15,112,220,120,221,0,222,0,224,9,191,170,166,248,14,32,96,223,96,224,226,216,11,224,248,14,222,193,196,216,13,214,
+213,166,248,10,252,196,90,224,248,17,252,192,9,64,100,134,216,15,8,171,252,195,213,174,64,104,106,216,19,78,216,31,252,97,3,224,88,29,96,2,224,248,30,170,170,192,248,126,12,58,224,248,28,12,177,224,248,28,12,217,224,248,28,12,
+219,90,107,96,248,26,12,219,160,80,27,104,12,219,128,80,27,104,12,181,96,80,25,104,95,181,12,221,40,96,40,95,64,80,23,12,182,244,164,240,163,63,213,26,22,94,72,198,233,10,88,9,254,248,10,5,254,248,9,234,222,104,24,247,
+246,254,238,5,16,254,253,104,108,63,124,104,107,104,106,104,105,96,254,106,96,107,0,108,161,255,138,10,254,88,104,85,104,113,104,112,104,111,104,255,63,110,104,109,97,116,97,117,97,118,97,119,97,120,1,114,60,62,254,65,114,8,4,196,
+116,104,115,104,248,19,246,104,160,10,97,121,97,122,97,123,224,223,39,194,118,104,117,40,160,15,97,124,97,125,224,240,94,194,50,209,120,8,119,224,248,16,126,97,127,192,252,188,79,224,122,8,121,202,152,15,97,128,97,129,222,147,126,234,
+203,124,8,123,192,248,16,130,97,131,224,247,68,72,203,126,8,125,224,248,16,132,97,133,224,175,95,4,8,128,8,127,10,62,226,253,140,97,141,97,142,192,255,88,159,158,87,8,10,205,224,253,143,97,144,97,224,248,226,238,4,9,76,190,
+90,16,89,254,100,8,10,207,97,145,121,146,1,147,226,250,129,76,241,251,250,193,252,8,94,8,93,8,10,201,113,148,97,143,62,149,97,150,1,151,70,54,224,15,130,96,131,96,124,93,106,137,97,138,105,139,0,192,19,250,220,97,68,254,
+236,181,131,0,214,64,184,17,254,248,13,112,0,240,52,96,108,218,213,139,0,240,19,8,0,240,10,0,250,0,240,57,1,124,1,0,245,123,113,106,120,104,0,240,16,1,126,1,0,245,224,122,104,93,220,0,245,224,248,10,128,1,0,245,
+224,124,104,0,240,16,139,123,1,130,1,0,245,26,126,104,0,240,16,1,132,1,95,95,0,247,104,128,104,127,10,150,226,253,140,1,141,1,0,247,212,179,158,10,191,224,253,143,1,144,226,186,126,0,245,254,220,10,191,145,25,0,240,16,
+254,222,17,148,1,149,1,245,255,0,240,10,170,254,202,233,153,97,154,104,135,105,156,105,157,105,42,170,139,202,200,9,30,241,0,240,26,234,0,240,30,64,104,19,181,170,72,155,55,64,104,25,134,153,75,224,248,10,64,104,16,130,109,96,
+104,24,162,162,224,106,224,248,27,130,160,248,11,64,104,16,226,170,170,64,111,64,248,19,164,106,64,248,27,76,107,64,248,26,156,90,96,248,42,170,138,32,248,31,192,88,20,64,248,27,160,240,14,128,240,17,0,250,64,248,58,254,35,192,
+160,255,0,227,0,232,0,234,0,235,248,129,145,255,250,240,248,9,229,248,0,192,242,244,255,250,252,252,102,184,231,240,255,228,252,240,238,0,230,4,30,196,253,194,228,240,252,239,0,237,1,0,248,255,240,220,36,129,244,255,254,216,240,252,
+200,72,128,244,252,226,248,9,198,255,24,1,236,240,240,246,230,8,64,192,255,240,214,255,248,9,32,146,236,240,228,226,252,4,32,240,164,248,9,198,80,178,0,65,236,70,255,252,240,228,254,146,36,168,62,252,244,80,254,240,40,16,255,233,
+130,253,80,148,168,2,96,240,248,11,190,254,96,254,255,248,11,240,88,37,212,146,254,242,88,248,12,240,252,162,252,255,80,0,244,88,248,9,240,248,15,244,212,37,82,214,242,240,248,23,158,234,78,248,9,240,248,11,181,226,106,246,255,248,
+13,240,248,13,241,62,248,14,240,248,9,255,88,107,235,72,97,67,204,152,15,216,131,3,248,131,4,160,186,188,136,19,104,52,250,2,224,72,5,224,248,51,1,77,9,106,210,77,68,114,196,134,192,252,88,224,208,107,224,252,163,170,9,74,
+24,238,48,218,192,248,10,24,60,186,252,170,42,44,113,224,253,128,255,40,113,116,106,120,101,64,186,192,248,13,168,72,174,254,80,9,26,168,9,128,248,9,192,228,170,224,216,250,167,112,58,192,248,12,146,105,192,108,79,164,224,254,96,60,
+96,61,138,224,254,248,13,39,240,224,253,62,96,63,202,96,108,144,20,64,96,235,171,65,96,66,160,252,224,248,19,112,67,96,68,78,180,192,193,127,253,196,248,15,69,112,70,96,71,0,72,240,244,192,248,13,96,73,96,74,103,171,96,75,
+96,76,52,16,252,4,12,90,224,255,170,170,246,101,52,252,64,252,80,241,192,167,52,248,14,232,73,224,242,87,149,254,248,18,7,64,9,14,248,10,24,44,156,172,244,252,208,243,72,113,242,216,64,245,224,252,244,96,15,3,249,214,239,13,
+244,192,194,252,120,104,120,255,250,103,120,102,120,101,112,1,113,63,252,248,9,32,76,24,72,120,255,14,76,120,75,120,74,120,73,112,199,8,184,13,88,72,248,141,228,226,71,104,70,24,69,16,202,16,190,10,254,224,248,15,120,68,104,67,
+154,144,11,248,108,52,236,191,139,224,120,66,120,65,24,64,224,248,15,104,2,230,148,87,186,224,63,120,62,90,144,13,0,232,10,224,61,120,60,242,93,224,248,18,192,235,224,59,104,58,192,248,27,112,2,228,248,15,87,85,192,248,13,112,
+3,224,248,20,192,248,102,129,232,14,228,216,12,180,223,6,222,82,85,248,164,216,11,176,216,11,232,248,9,240,248,15,104,216,19,220,248,9,65,85,236,254,248,246,252,240,248,13,186,248,19,118,208,15,220,248,21,253,255,76,208,21,194,120,
+17,246,8,245,8,244,8,243,0,248,0,249,1,244,11,2,250,0,244,0,245,16,252,240,252,255,253,254,8,255,8,254,8,253,8,252,1,214,248,9,253,0,254,0,16,160,255,240,1,253,246,251,42,8,182,248,10,214,253,36,193,78,136,9,
+214,228,252,1,35,198,245,168,252,252,166,152,27,202,212,80,77,27,254,7,254,253,34,69,17,254,246,252,234,40,19,254,27,196,248,5,60,18,9,252,224,255,236,168,170,8,254,0,16,26,230,253,0,16,38,40,16,21,226,248,23,170,42,124,
+16,11,212,8,19,252,20,196,248,21,240,8,11,134,8,17,216,13,244,8,10,74,170,206,222,255,168,244,176,13,56,92,196,255,170,86,196,178,224,248,11,88,182,252,248,11,230,252,48,180,58,154,179,250,248,10,85,85,192,255,48,180,224,248,
+16,132,177,224,252,48,180,192,248,25,48,180,85,85,192,248,25,254,252,224,248,31,64,248,48,224,247,64,248,22,96,255,64,248,22,85,85,192,255,64,248,22,160,240,14,192,248,25,64,248,252,64,248,103,0,192,20,244,184,12,43,200,14,195,
+4,210,201,120,177,244,20,183,168,74,232,224,104,179,136,35,108,188,4,34,172,160,224,232,154,186,226,187,228,70,33,146,42,86,104,9,16,70,160,226,186,192,252,194,170,18,178,201,178,154,140,188,160,68,177,194,40,139,10,35,246,154,252,170,
+224,255,50,42,200,176,36,120,240,226,26,180,170,90,145,128,100,188,4,24,229,80,122,240,88,173,148,192,44,253,192,248,15,32,248,11,8,16,26,130,74,72,254,126,28,250,32,254,224,254,184,255,74,50,182,140,171,0,248,9,84,248,254,56,
+38,73,250,10,202,160,179,144,164,247,85,101,192,248,9,224,254,164,245,152,254,192,252,170,165,192,93,141,190,252,224,253,8,9,25,195,208,165,18,176,12,14,67,0,254,15,72,254,14,254,248,86,85,240,98,178,102,242,194,92,194,50,254,248,
+11,76,244,212,151,254,238,105,2,117,121,63,113,63,254,104,9,73,255,104,226,2,103,187,211,109,96,110,96,111,96,171,223,112,96,113,102,252,2,112,17,84,171,114,96,115,96,116,76,19,229,131,118,8,2,112,16,222,117,96,118,126,124,214,
+2,96,21,224,119,96,120,74,2,103,224,248,14,83,95,121,96,122,224,0,192,72,22,96,123,96,124,144,235,159,252,128,72,22,96,125,96,126,32,192,248,21,96,83,96,127,81,245,96,128,96,192,248,22,22,66,222,242,192,248,21,96,88,87,
+23,120,89,96,90,190,98,192,248,17,248,60,96,94,46,13,116,223,64,15,175,248,56,9,0,100,90,246,97,63,33,115,254,254,234,91,32,254,107,254,156,250,158,104,6,33,114,254,254,32,32,224,18,85,253,0,240,11,236,46,30,145,0,247,
+30,245,0,240,80,0,114,0,115,202,43,0,0,243,2,96,19,255,117,0,0,241,2,96,21,175,94,255,119,0,0,241,2,98,0,240,21,0,121,0,0,241,116,117,44,192,56,23,123,0,0,241,26,89,128,56,23,125,0,245,245,0,241,232,
+81,192,248,21,83,0,127,0,0,241,192,248,24,86,0,250,250,87,126,242,192,248,22,88,24,89,0,0,243,192,248,17,16,91,0,23,253,92,0,93,0,0,245,64,15,152,9,95,0,96,0,247,126,97,0,98,0,0,240,12,97,115,1,254,
+253,0,101,0,102,0,85,171,0,240,16,120,82,254,252,34,224,12,254,253,16,62,85,56,93,10,170,2,243,142,220,36,242,252,0,80,29,120,137,0,80,28,170,146,128,82,0,80,27,192,85,0,80,24,128,82,0,80,27,192,170,122,0,80,
+252,0,80,64,98,129,34,128,9,44,245,42,241,234,252,171,104,19,73,213,98,118,240,232,238,22,197,168,193,164,28,114,206,85,101,0,4,194,253,216,196,90,122,64,113,224,248,9,198,85,102,144,253,36,219,94,196,224,255,198,166,81,86,186,
+253,212,224,253,234,194,248,11,90,195,84,73,202,224,253,114,238,184,253,134,202,252,85,73,224,252,72,248,13,244,253,180,253,12,254,204,252,252,85,85,194,253,44,252,128,108,2,253,182,248,10,224,248,11,76,248,10,254,240,10,85,89,224,253,
+76,248,13,136,248,9,200,119,76,248,9,56,200,254,85,85,112,253,4,255,104,189,200,255,120,255,2,253,40,224,13,120,248,10,221,234,254,248,29,0,240,28,97,106,0,240,29,97,248,25,20,248,10,0,240,16,97,186,170,110,224,248,11,0,
+240,17,1,112,224,248,11,0,240,18,102,254,0,240,23,170,86,104,183,0,240,22,104,109,0,240,252,254,248,28,202,220,96,204,207,254,248,13,149,84,226,152,32,184,161,178,59,254,246,252,186,162,238,254,84,101,254,174,132,250,254,254,254,232,
+252,250,21,85,254,254,198,252,242,248,13,250,198,248,15,240,248,9,168,253,85,201,138,248,9,182,248,15,116,248,14,138,248,9,110,254,248,6,72,11,240,193,41,252,17,96,78,40,17,244,254,248,9,125,245,32,6,254,248,11,97,72,96,80,
+192,208,13,106,254,94,181,81,96,210,224,82,190,240,13,124,9,73,254,204,173,84,21,178,0,85,164,181,250,253,226,17,228,170,171,204,174,70,192,9,34,244,198,252,204,174,0,90,200,253,254,254,174,160,48,78,204,171,0,94,240,236,88,224,
+10,94,204,168,13,4,26,56,148,254,255,36,165,254,248,13,104,170,170,255,103,190,200,11,16,240,15,192,24,16,20,240,10,164,240,11,150,246,170,170,112,240,12,88,240,9,232,255,38,240,19,236,248,12,254,248,30,198,248,15,146,232,15,186,
+170,102,248,10,124,248,9,104,248,9,75,97,0,240,10,252,248,17,192,192,34,146,64,10,160,170,28,224,12,242,66,222,186,148,116,220,132,244,60,138,32,22,238,138,252,112,241,210,0,16,246,171,73,48,76,152,216,9,248,139,84,240,9,4,
+62,68,26,34,133,242,250,80,140,158,93,242,40,48,76,240,210,233,252,246,178,72,182,240,190,62,248,2,170,226,96,189,220,244,164,234,0,228,170,170,204,168,9,0,224,47,156,240,9,146,240,13,32,224,14,6,240,11,250,232,12,16,240,16,
+138,45,18,224,16,4,240,24,46,245,220,90,212,253,92,134,237,218,146,240,110,248,12,91,212,253,93,98,253,240,93,85,254,253,105,0,240,28,96,1,236,162,254,248,27,88,241,144,228,192,131,85,149,134,231,246,254,70,127,54,138,2,244,2,
+131,186,124,1,19,242,218,88,73,210,71,129,58,73,252,252,233,252,184,73,242,236,76,84,243,76,212,32,244,133,162,88,90,84,91,246,4,44,240,9,206,130,170,32,240,10,252,253,202,255,248,31,18,240,10,4,224,9,254,248,9,170,170,12,
+240,19,0,224,13,156,224,12,250,232,17,10,240,17,238,232,12,6,224,25,0,224,41,44,182,0,240,11,130,240,232,12,218,91,144,253,93,2,234,118,253,240,236,252,240,192,129,20,208,9,17,94,253,104,2,209,41,63,40,246,201,252,254,16,
+240,14,80,105,72,40,170,175,6,254,248,11,42,241,226,188,0,243,104,82,104,81,129,115,250,86,184,107,254,237,222,96,10,104,85,104,84,182,154,1,26,242,0,241,84,25,216,14,184,10,242,137,182,159,222,89,65,252,160,180,218,126,188,224,
+182,159,64,80,222,237,252,250,180,188,253,85,253,62,114,182,158,222,157,250,179,98,237,254,253,104,100,104,99,127,115,104,98,104,97,104,96,104,95,96,137,4,252,6,134,255,252,254,200,96,201,96,202,96,203,96,107,85,204,96,205,0,240,23,
+250,232,9,112,0,214,250,184,17,14,245,80,192,15,85,21,94,208,15,32,208,47,16,208,17,12,192,18,234,248,11,110,216,14,80,232,13,92,85,244,0,208,29,96,1,0,208,35,76,192,15,238,205,184,96,9,180,102,85,85,246,204,124,196,
+138,116,86,199,250,205,54,211,244,252,182,205,85,85,200,248,9,60,211,244,205,238,205,96,115,200,253,255,248,10,106,11,85,213,184,252,200,248,10,255,248,9,184,248,10,156,220,252,252,142,252,252,184,11,109,210,96,1,192,49,5,82,49,76,
+248,66,248,10,0,184,9,170,170,73,86,218,180,202,12,232,10,2,253,126,253,152,203,134,52,146,74,188,255,236,244,246,72,48,9,190,253,114,248,9,6,36,248,202,40,14,76,206,186,252,37,85,192,211,220,40,13,210,248,193,180,209,198,214,
+192,248,13,66,36,120,190,6,116,85,85,230,44,130,40,20,182,209,130,226,70,254,202,24,18,130,227,255,248,195,213,170,0,64,252,0,64,252,0,64,252,0,64,64,0,0,64,199,255,248,252,255,248,252,127,140,255,252,227,0,232,0,234,0,
+235,248,229,32,0,248,250,240,248,15,242,244,64,174,255,250,228,252,231,202,253,199,51,240,248,9,238,0,230,218,239,0,237,248,9,0,255,240,248,11,196,220,0,80,244,255,216,244,240,224,253,1,0,240,248,13,242,248,188,0,148,246,208,250,
+255,252,240,254,50,0,255,236,214,244,254,72,4,114,240,248,9,255,98,64,2,234,240,236,228,252,255,144,64,238,164,255,254,244,0,18,240,210,224,206,252,74,17,8,16,240,252,214,254,5,0,96,233,246,253,80,164,206,73,1,240,254,40,18,
+254,255,252,238,192,72,228,236,255,248,21,242,212,130,64,162,114,254,240,255,248,11,228,84,2,88,255,241,240,248,14,244,212,34,80,170,2,130,240,248,9,48,252,73,73,174,252,234,62,248,9,240,248,13,238,226,248,11,65,85,240,248,9,194,
+110,252,140,252,62,252,240,254,2,252,212,161,240,192,70,254,248,21,104,61,226,72,138,62,174,206,206,79,98,198,224,224,153,72,15,8,14,168,142,254,220,74,232,253,118,206,162,193,104,66,170,98,160,252,210,26,194,62,206,54,207,36,201,130,
+72,65,137,198,188,192,232,254,214,197,192,144,84,224,192,194,162,191,40,217,110,253,13,146,224,253,36,202,15,186,254,254,110,42,169,28,205,224,254,254,248,26,4,224,252,255,32,180,38,240,16,74,170,232,255,38,69,52,195,244,244,182,34,78,
+0,176,18,170,162,224,248,12,0,176,28,200,96,11,18,163,0,176,14,28,71,194,170,170,96,180,0,176,13,252,56,9,194,117,64,180,116,96,10,252,63,194,99,170,170,196,100,236,255,72,99,136,182,192,248,9,128,179,0,248,10,0,176,25,
+214,117,34,132,0,176,25,104,24,252,0,176,24,120,66,224,143,0,176,20,120,63,93,87,24,71,0,176,20,120,61,56,255,0,176,20,120,59,144,240,12,170,226,213,74,82,230,128,243,36,8,22,255,248,9,241,252,208,12,192,218,170,42,240,
+86,214,176,216,9,124,216,9,240,248,17,236,248,23,240,252,236,254,168,254,248,242,252,240,248,13,188,248,17,255,248,79,243,0,244,0,245,127,176,0,246,0,248,0,249,1,2,254,234,253,253,241,7,240,255,252,244,254,0,255,1,0,1,253,
+168,68,246,251,208,254,240,248,10,210,64,106,218,255,250,208,253,184,255,154,253,8,0,16,216,202,254,255,254,64,73,246,230,242,248,9,118,254,232,246,252,221,220,228,248,15,255,248,16,1,7,246,255,27,254,7,254,253,40,18,34,254,246,252,
+234,216,225,33,254,248,5,1,6,248,9,136,17,252,224,255,236,8,254,144,225,246,232,216,244,25,1,8,112,28,242,252,212,21,1,22,224,88,240,162,4,244,24,220,252,60,30,242,39,1,32,214,35,1,38,172,10,254,110,248,16,75,78,248,
+29,116,132,142,128,15,240,254,146,94,194,246,252,250,182,248,11,28,115,42,1,43,248,254,37,93,6,116,138,248,10,236,252,248,14,156,248,11,1,44,254,248,17,245,172,192,248,12,224,248,18,192,248,14,45,1,46,232,248,254,143,112,192,253,
+1,54,1,53,252,240,47,1,48,214,31,232,248,254,192,253,1,55,1,56,1,57,207,234,240,49,1,50,232,248,254,192,254,224,254,51,89,84,1,52,232,248,254,192,250,243,224,254,73,85,64,248,18,190,224,248,25,216,113,224,248,11,64,248,
+18,246,209,82,80,68,64,248,22,148,243,194,64,248,24,170,99,85,85,224,248,9,64,248,16,130,253,96,248,24,58,59,224,248,26,94,99,224,248,9,85,85,64,248,16,40,99,64,248,26,228,67,64,248,26,188,50,64,248,27,220,91,85,85,
+96,248,41,32,248,31,192,232,20,64,248,27,160,240,14,128,240,17,0,250,64,248,58,117,253,4,91,224,253,6,76,97,63,42,108,254,248,9,104,206,96,207,215,255,96,208,96,209,20,86,224,248,11,96,210,96,211,96,212,96,213,215,127,96,
+214,96,215,88,86,224,248,9,104,216,120,217,96,218,0,219,213,31,176,123,170,197,168,193,226,253,112,220,120,221,96,222,85,127,228,38,130,194,129,140,115,166,255,0,32,96,223,96,224,149,21,214,52,250,252,198,248,9,134,170,129,140,51,144,
+181,254,196,254,228,255,200,133,90,178,203,194,253,32,29,202,200,135,96,100,138,252,84,87,200,188,0,28,35,200,131,96,104,82,193,138,253,81,85,114,253,248,24,80,14,192,48,22,60,80,9,255,248,16,84,16,9,85,85,226,248,19,12,87,
+58,80,18,255,248,100,0,248,11,50,72,11,192,182,20,72,14,85,85,60,182,250,77,216,248,9,4,80,11,48,72,10,26,84,82,79,240,247,85,85,104,78,204,247,194,240,9,238,240,9,236,240,14,54,24,10,236,248,16,255,248,252,125,159,
+255,248,252,255,248,102,1,82,1,83,238,248,19,1,78,1,79,207,250,242,84,9,84,248,240,253,238,254,1,80,9,234,249,80,224,248,12,240,253,224,248,104,81,9,81,242,85,9,172,170,85,248,240,253,238,255,16,112,9,242,108,0,112,23,
+42,8,166,126,240,104,15,0,116,180,110,228,240,104,11,170,170,255,0,118,224,254,144,114,0,118,240,252,226,248,9,178,154,170,170,104,114,0,112,15,255,248,9,16,114,240,110,240,254,164,248,9,16,116,170,160,240,104,13,228,254,16,116,0,
+112,9,208,112,9,255,16,112,13,170,170,0,112,13,190,254,18,152,9,240,104,13,16,112,9,82,152,13,240,104,9,16,112,15,170,170,0,112,23,240,248,23,0,112,29,16,112,11,168,144,13,200,144,19,80,144,11,128,206,170,170,230,8,12,
+254,254,252,24,9,232,56,18,254,248,12,184,22,116,21,254,248,12,170,170,32,21,108,22,110,16,9,234,248,10,40,16,13,20,16,17,218,254,222,8,24,109,109,154,252,92,248,253,90,120,253,92,182,254,142,253,93,112,13,91,69,73,238,13,
+240,252,254,0,16,13,254,252,8,13,85,84,0,16,31,8,200,9,254,248,21,142,125,254,246,254,238,248,9,85,49,242,252,140,44,248,254,2,132,248,254,234,73,230,92,252,76,216,73,250,76,242,241,66,148,240,248,250,96,25,64,69,252,238,
+140,171,72,25,240,252,206,85,85,28,170,20,26,82,222,54,24,16,238,253,42,240,20,0,240,11,254,248,30,85,85,28,198,92,36,238,252,218,14,232,184,12,224,240,25,42,115,228,247,21,84,90,117,80,113,226,246,42,210,255,36,18,238,241,
+81,84,210,107,244,254,235,26,238,243,246,254,85,37,6,252,36,10,234,241,102,172,182,186,52,16,9,246,85,85,102,14,234,254,232,11,252,8,12,25,200,244,156,112,17,16,112,15,240,104,15,85,85,0,112,37,104,216,15,220,248,9,16,112,
+15,240,104,15,255,248,19,118,208,13,220,248,21,253,74,76,208,21,128,160,17,246,8,245,8,244,98,113,16,115,238,127,250,32,114,16,252,0,118,8,255,8,254,8,253,8,252,1,85,5,214,248,9,240,104,13,182,248,9,214,253,128,233,170,
+96,9,214,33,96,228,252,198,245,168,252,252,84,85,166,236,110,102,184,71,0,112,88,230,253,0,112,38,40,112,21,85,85,226,248,23,124,112,11,212,104,19,252,116,196,248,21,240,104,11,134,104,17,216,109,81,82,244,104,10,206,222,255,168,
+244,128,13,152,204,85,181,196,255,204,202,224,248,11,88,134,252,248,11,230,252,48,132,58,170,170,154,131,250,248,10,192,255,48,132,224,248,16,138,201,224,252,48,132,170,170,192,248,25,48,132,192,248,25,254,252,224,248,31,64,248,48,224,247,
+64,248,22,170,170,96,255,64,248,22,192,255,64,248,22,160,240,14,192,248,25,64,248,252,64,248,103,186,106,0,240,1,84,197,56,130,6,104,22,128,11,64,194,106,193,216,193,5,255,255,242,185,108,104,107,104,106,104,105,121,63,113,63,96,
+105,96,47,255,106,96,107,96,108,4,188,226,113,104,112,104,111,247,191,104,110,104,109,187,227,109,96,110,96,111,96,112,96,113,191,126,226,188,104,116,104,115,104,114,174,117,255,248,9,114,0,115,0,116,95,15,222,122,104,118,104,117,0,119,
+255,248,11,117,0,118,240,30,126,108,104,120,104,119,224,248,20,119,0,120,225,158,194,254,122,8,121,224,248,20,121,0,122,60,66,224,28,56,24,123,0,124,224,64,3,15,193,224,248,22,125,0,126,96,96,254,192,248,21,143,94,83,0,127,
+0,128,96,192,248,23,86,0,87,2,186,255,224,192,248,22,88,24,89,0,90,24,5,254,192,248,17,16,191,212,91,0,92,0,93,0,94,244,35,64,16,229,255,255,251,95,0,96,0,97,0,98,0,99,0,100,128,182,33,63,1,254,235,115,
+254,254,0,101,0,102,0,103,0,104,62,112,9,42,242,1,170,42,114,254,254,64,176,20,255,248,252,255,248,93,112,232,14,255,248,148,0,240,0,0,0,0,0,0,0,0,0,0
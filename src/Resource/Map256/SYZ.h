@@ -0,0 +1,143 @@
+67,233,96,40,254,32,254,248,22,228,96,104,31,79,96,89,32,37,33,1,254,2,32,18,254,63,254,244,248,9,96,88,96,105,96,252,96,253,0,19,1,10,254,57,254,8,1,0,1,3,0,27,244,5,0,189,248,254,228,96,57,96,48,74,
+70,224,253,220,254,212,255,228,224,253,9,254,237,32,220,254,244,254,5,224,248,9,9,7,242,224,255,232,31,246,244,252,224,252,95,96,99,0,47,0,97,182,15,254,1,11,254,253,6,244,253,6,96,98,96,248,233,255,64,0,37,0,18,1,
+255,2,0,213,21,88,0,242,248,10,64,248,9,74,255,252,0,242,248,10,64,254,133,85,84,74,252,224,57,0,242,248,10,96,254,102,248,9,86,82,224,242,255,224,248,44,10,224,252,0,248,16,85,92,10,255,224,252,0,248,16,10,254,254,
+98,0,242,243,67,169,0,248,10,45,254,64,254,248,22,228,0,219,186,255,248,76,1,62,254,253,72,240,252,8,208,248,30,224,248,35,1,73,122,246,254,254,192,248,53,255,248,46,128,0,129,252,255,248,23,122,0,236,217,123,252,255,248,23,
+132,0,133,252,255,248,23,179,61,142,0,143,252,204,240,9,98,252,248,12,124,0,125,57,244,252,238,254,104,8,254,40,254,248,10,33,106,137,200,33,107,252,244,228,32,234,87,95,96,37,104,18,254,248,19,32,235,224,233,96,47,96,97,254,
+248,20,21,134,224,233,0,240,77,255,248,17,90,32,7,254,255,247,40,6,40,66,40,65,40,91,40,90,8,49,224,248,13,32,37,241,255,40,17,254,16,40,76,40,75,40,101,40,100,40,219,255,59,40,58,220,248,12,19,144,227,3,8,113,
+8,112,8,111,8,175,122,110,40,69,40,68,220,248,12,164,220,144,217,216,253,79,8,78,85,85,220,248,12,224,248,9,104,223,220,248,11,68,216,10,184,248,20,68,216,10,216,248,14,85,85,184,252,224,248,14,22,224,9,184,253,224,248,14,
+36,230,184,248,9,224,252,85,85,12,231,88,253,184,248,9,228,212,12,230,200,254,208,248,9,228,212,85,61,200,248,16,220,222,228,212,224,208,12,220,208,12,10,224,68,44,1,45,169,170,252,238,248,13,236,224,28,242,248,13,236,224,16,242,
+248,11,236,224,9,170,86,216,224,9,222,224,9,252,226,236,224,11,218,224,9,224,229,88,64,202,72,200,13,189,234,244,254,224,226,64,250,64,14,211,192,245,60,200,12,0,210,64,85,85,57,64,96,202,12,214,180,232,12,128,210,224,253,220,
+232,20,224,248,14,149,20,28,200,11,224,248,19,76,242,220,0,208,12,224,248,11,244,170,136,20,244,0,208,11,64,98,64,14,209,254,200,10,20,240,9,250,247,0,211,4,208,23,0,215,38,0,39,0,9,0,20,254,248,19,64,38,233,165,
+64,39,160,64,47,72,97,254,248,19,228,221,237,72,45,254,248,29,1,16,254,248,25,0,201,54,241,115,254,248,25,8,190,119,214,224,248,109,96,108,96,109,224,248,28,118,96,119,224,248,15,96,8,47,238,254,248,10,116,96,117,240,248,12,
+254,65,136,254,248,25,97,176,81,133,254,1,137,254,248,26,130,254,224,248,55,0,235,166,254,224,248,27,131,254,252,16,208,79,1,170,174,92,254,254,206,248,40,32,192,26,255,248,66,52,192,12,1,83,254,252,146,164,228,248,10,52,192,27,
+228,52,192,27,228,86,222,234,171,200,184,16,132,185,40,216,11,252,208,12,97,90,97,91,26,221,40,219,194,189,46,220,244,255,224,100,97,101,236,252,97,106,97,62,144,40,219,28,216,13,32,116,32,117,250,228,106,140,188,234,254,248,27,24,
+246,254,248,15,65,254,97,170,107,254,118,240,106,170,232,59,72,240,13,255,255,96,235,200,248,29,224,248,32,237,219,251,224,248,30,247,224,248,30,205,226,248,28,206,96,207,226,248,26,215,96,216,165,255,0,217,2,176,14,255,30,96,222,96,
+223,96,224,96,175,255,225,0,226,0,227,4,176,11,6,243,230,32,231,96,232,96,233,248,119,96,228,0,236,0,27,32,104,32,32,201,40,18,127,60,254,254,32,240,32,241,0,242,254,244,0,245,215,235,254,95,238,156,254,255,243,0,45,254,
+248,11,86,192,9,8,90,253,201,94,208,20,0,232,9,214,190,208,20,76,239,224,252,104,164,96,146,215,23,96,147,97,139,96,175,160,136,14,96,174,96,100,130,196,84,184,84,96,171,160,139,110,199,236,184,0,110,58,169,18,206,128,147,96,
+144,12,8,27,254,224,255,224,143,170,170,34,176,9,84,144,10,224,248,17,102,198,62,182,178,145,32,144,12,62,176,14,42,169,224,255,66,176,11,86,176,10,224,248,16,160,128,248,10,224,248,16,170,94,160,248,27,164,254,160,248,23,8,196,
+2,192,10,224,253,95,96,96,2,192,21,213,160,242,140,28,195,254,248,27,146,218,10,254,46,172,172,170,74,175,244,196,243,224,254,34,128,16,224,248,14,226,160,16,170,131,224,248,18,4,248,11,224,248,15,226,176,11,224,248,10,33,133,254,
+202,65,96,252,226,181,90,176,10,224,10,254,64,254,85,85,218,120,13,224,252,100,240,12,64,254,224,248,19,224,232,18,68,240,24,224,248,15,85,85,66,120,20,224,248,10,76,246,102,160,13,224,248,10,104,253,252,124,32,232,12,85,173,142,
+168,13,22,160,10,224,254,50,160,13,0,240,12,0,177,99,4,240,27,143,241,0,134,1,64,1,71,252,65,252,69,1,224,241,70,244,130,208,16,74,1,81,252,75,1,15,186,78,1,79,1,80,244,34,208,80,138,200,78,1,82,170,146,254,
+252,58,200,143,56,200,25,255,248,29,252,120,15,254,254,232,65,213,192,227,1,254,38,158,254,248,11,160,210,32,224,15,254,248,11,31,148,96,250,96,253,65,133,254,212,171,254,248,18,6,37,228,65,130,254,184,171,254,248,18,228,163,172,224,
+248,22,129,254,224,248,15,236,254,253,146,14,54,234,224,248,15,236,220,254,26,234,129,65,234,114,254,224,248,12,30,229,244,255,65,5,190,254,220,132,84,24,76,30,226,224,253,254,64,27,73,36,230,186,184,253,218,168,89,179,212,254,34,158,
+244,220,255,5,204,114,85,254,248,10,122,240,9,240,132,238,244,224,248,24,254,248,16,22,181,85,173,4,242,188,240,20,22,181,224,248,24,22,180,254,171,131,254,248,19,190,42,6,192,9,254,248,21,0,47,32,97,254,248,27,0,80,31,202,
+134,248,248,15,169,48,254,136,234,96,216,12,34,80,12,236,65,10,168,42,254,42,120,20,236,253,224,255,136,208,11,224,248,19,254,248,19,170,213,204,224,255,16,218,250,202,9,254,252,220,254,224,254,97,152,120,233,254,97,11,254,112,40,19,
+49,254,100,244,254,224,254,79,248,120,225,120,224,120,223,120,222,16,30,255,211,254,112,90,112,91,112,59,112,68,112,69,224,104,239,3,217,120,216,120,215,110,224,15,16,49,112,58,220,189,188,188,120,207,120,206,74,224,21,220,92,120,208,174,
+222,168,28,255,120,158,168,30,120,94,168,30,120,248,160,216,29,170,190,224,248,13,34,144,113,140,248,66,222,160,14,252,248,13,228,208,13,96,162,96,163,87,167,122,171,161,104,160,238,253,252,209,160,169,88,32,250,63,30,18,96,170,96,173,
+1,19,224,171,104,170,221,251,236,134,169,64,252,0,114,32,252,32,154,171,104,189,96,227,221,153,1,29,224,188,104,180,244,58,64,19,128,116,203,213,32,57,32,186,171,224,134,224,253,130,177,224,248,79,243,117,72,189,64,224,72,188,72,224,
+248,102,42,240,73,17,63,213,175,254,248,10,220,184,42,236,192,53,192,79,8,40,67,40,92,204,72,13,191,170,176,184,11,32,18,40,77,40,102,204,72,14,255,248,11,234,241,166,73,170,170,204,72,13,224,248,12,238,162,204,72,13,96,72,
+14,158,217,176,196,220,248,20,234,85,160,72,9,184,248,21,196,88,17,132,79,104,59,104,96,78,166,168,14,184,252,149,69,128,210,224,248,10,230,152,11,254,8,194,224,85,175,12,86,122,210,248,253,224,253,64,217,64,104,64,238,35,170,223,
+254,248,23,224,80,9,254,248,21,160,236,224,248,26,95,64,99,16,140,224,248,25,127,225,80,213,80,204,80,130,80,131,220,248,24,255,200,80,251,23,144,80,145,220,248,24,0,16,214,1,14,1,15,220,248,24,85,85,224,238,218,220,248,24,
+224,253,220,248,24,224,248,10,220,248,20,224,248,14,85,189,220,248,15,224,248,19,220,248,11,224,248,23,220,254,252,233,203,8,126,190,190,60,88,25,252,234,104,137,104,138,220,248,23,252,234,104,69,104,68,174,170,220,248,23,228,172,8,78,
+220,248,23,196,174,144,238,220,248,15,228,136,15,170,170,184,248,15,4,151,72,159,148,248,13,224,248,17,148,252,220,254,224,248,16,42,168,148,253,220,254,132,136,16,58,48,13,76,132,136,15,88,136,14,170,42,224,248,16,120,136,14,224,248,
+12,118,48,11,224,248,19,96,150,86,224,10,36,136,12,170,170,136,172,234,88,143,224,254,172,248,11,188,120,14,128,246,170,170,228,120,12,212,136,10,4,136,12,190,56,11,116,253,240,179,4,160,10,216,255,130,170,236,254,6,224,24,254,192,
+155,70,224,24,96,116,224,248,28,170,36,32,130,224,248,186,222,194,224,248,31,36,216,27,224,36,216,28,137,146,224,36,216,27,224,36,216,28,96,170,170,36,216,27,224,253,220,248,24,224,248,10,220,248,20,224,248,14,220,248,15,132,43,170,
+202,36,216,26,0,50,36,216,27,158,90,36,216,27,54,179,36,216,26,170,234,224,36,216,26,94,91,180,216,10,220,248,19,216,222,220,248,23,108,216,18,212,215,175,104,211,96,185,224,248,15,184,248,10,101,104,100,104,174,0,54,255,90,144,
+216,15,72,79,72,111,104,110,104,184,252,46,44,152,16,3,126,137,61,42,88,48,11,108,216,14,65,8,65,220,224,248,14,192,222,26,212,216,76,154,65,242,224,248,9,172,110,236,221,0,234,65,222,254,224,248,10,236,112,129,206,168,31,1,
+170,89,67,102,108,224,248,24,102,109,224,248,24,63,254,74,104,80,125,223,255,248,69,144,168,15,40,202,33,36,254,248,11,40,59,96,148,224,248,12,251,251,150,33,21,254,248,11,40,69,97,37,96,149,224,248,9,9,50,1,254,222,20,254,
+248,11,8,5,97,38,105,39,224,248,10,58,1,35,254,248,11,127,93,0,19,8,3,104,2,104,4,95,248,24,36,177,96,157,190,248,11,85,213,66,248,12,192,164,190,248,24,224,252,190,248,27,224,252,124,248,26,128,163,181,127,1,3,190,
+248,24,0,172,5,190,248,16,49,32,58,32,92,32,67,253,191,224,254,124,248,12,49,96,58,96,59,32,68,32,102,32,77,242,255,224,248,9,190,253,228,96,68,96,69,0,78,0,112,0,210,190,87,224,248,9,190,96,156,228,252,96,78,96,
+79,134,85,188,213,32,160,9,3,190,97,53,228,252,121,82,186,69,5,85,96,160,10,114,193,196,228,252,54,184,9,224,248,9,6,198,213,170,250,56,13,224,152,13,246,56,11,224,252,47,32,167,254,254,250,72,13,255,189,2,64,29,45,96,
+38,96,39,0,9,0,20,254,248,20,38,0,39,87,85,188,75,47,8,97,254,248,19,160,58,28,210,254,248,27,172,40,17,158,40,14,125,175,2,208,28,254,248,111,96,108,96,109,224,248,28,118,96,119,238,248,14,85,181,28,209,32,254,248,
+9,82,97,246,252,0,214,100,80,19,188,98,97,168,26,20,42,254,124,107,192,166,132,53,24,211,0,84,85,254,188,96,12,164,96,11,36,110,220,102,210,238,216,200,11,24,209,102,213,224,248,232,173,224,168,10,196,81,84,172,139,47,30,1,
+31,198,208,24,228,1,22,1,23,224,248,24,62,170,228,1,40,1,41,246,186,25,182,24,9,168,62,224,255,228,224,252,2,8,13,224,248,17,1,86,1,87,41,31,252,2,13,204,85,224,32,1,33,85,250,245,154,26,150,31,204,86,228,33,
+42,33,43,159,244,32,8,33,106,33,107,252,222,19,122,247,97,42,160,170,97,228,224,19,74,88,11,126,246,146,25,32,170,10,170,26,113,28,224,9,126,240,11,240,228,107,252,178,224,248,9,170,170,50,192,12,4,139,224,248,9,58,88,15,
+224,248,15,56,128,16,224,248,10,62,240,11,74,242,36,231,224,248,9,206,152,9,254,254,22,224,95,85,48,0,96,32,20,4,224,17,96,177,228,4,224,26,64,42,182,254,112,240,11,228,200,15,254,59,152,243,108,170,42,252,254,238,235,206,
+235,244,252,238,232,20,206,237,198,232,19,238,232,10,171,12,244,224,248,48,14,241,238,237,244,170,170,250,128,224,14,254,253,248,237,0,100,160,11,8,245,178,25,170,82,248,232,10,254,89,0,100,6,27,12,58,132,62,244,3,85,89,254,91,
+32,127,68,56,9,156,63,190,98,224,196,255,7,85,224,248,22,33,130,254,224,255,132,58,224,248,19,4,58,85,145,220,48,12,224,248,14,8,214,224,248,13,28,241,44,180,149,224,44,59,120,248,10,6,96,209,96,28,242,102,56,21,112,81,
+230,254,38,64,0,208,25,254,28,163,73,213,0,208,22,254,0,208,127,22,82,148,214,254,248,14,244,75,170,238,72,22,81,152,210,120,210,140,214,244,253,170,64,244,73,72,170,255,181,246,81,34,242,198,96,10,162,229,182,64,183,1,29,72,
+191,245,127,72,190,112,128,11,244,248,9,64,192,64,193,1,134,104,167,104,165,31,222,192,8,21,96,166,96,167,122,104,177,8,175,192,8,21,95,85,32,176,96,177,32,18,144,255,36,128,11,58,96,12,4,16,10,216,254,85,85,44,165,224,
+255,200,8,12,32,128,14,12,135,216,248,9,160,96,14,0,64,158,213,254,206,72,25,204,72,55,126,8,25,124,8,67,8,254,253,1,46,33,54,33,242,215,47,224,248,21,228,55,33,56,33,57,226,248,17,228,255,175,3,49,9,28,1,50,
+88,248,14,228,248,10,9,20,254,144,234,224,178,255,254,228,248,13,224,248,9,222,254,33,170,98,48,228,248,11,224,252,76,240,104,158,240,74,126,240,33,144,99,239,189,56,161,92,96,67,114,248,22,99,97,172,217,193,133,96,77,85,213,226,
+248,24,173,122,229,238,252,36,184,10,196,252,238,223,255,252,36,184,9,122,236,49,196,255,224,248,11,142,0,143,250,94,164,154,97,226,143,174,86,88,12,255,96,60,96,134,96,135,7,245,82,93,96,68,108,62,209,250,216,10,54,219,70,96,
+255,10,100,96,101,96,102,96,103,0,78,38,211,212,216,9,254,245,224,32,202,80,32,110,32,111,32,112,62,200,9,176,95,6,96,90,85,95,64,162,234,189,131,254,253,218,185,186,220,250,185,6,208,24,239,255,254,253,158,0,159,66,104,21,
+8,159,72,158,8,97,64,168,64,190,167,169,224,248,21,72,169,72,168,254,201,178,64,179,212,40,255,8,212,200,159,172,72,179,64,194,1,175,90,16,72,188,64,189,212,255,254,253,172,252,84,43,138,224,253,86,31,212,254,254,172,252,52,44,
+72,198,64,199,30,20,50,72,199,64,197,212,236,206,236,248,10,142,95,224,209,72,208,174,195,64,196,1,34,224,255,31,175,236,248,12,1,26,1,27,170,24,1,25,10,112,10,90,95,236,248,18,238,152,22,26,164,135,254,248,17,0,160,9,
+97,2,97,136,254,248,18,87,85,41,121,65,2,56,164,80,112,10,38,112,10,54,114,224,248,31,192,77,85,183,224,248,25,0,83,224,248,20,246,107,178,224,33,9,71,40,32,10,72,87,173,208,224,20,64,1,71,94,114,86,113,144,224,20,
+94,113,81,94,114,6,73,86,114,188,200,17,25,196,94,116,254,160,248,20,207,158,126,216,116,128,0,129,252,255,248,23,122,0,123,85,85,252,255,248,23,14,152,20,255,248,10,238,218,234,220,255,248,21,14,152,12,135,245,255,252,96,154,254,
+97,128,30,172,18,154,97,106,125,7,97,107,203,248,13,96,235,96,220,18,152,9,97,133,254,171,247,224,248,16,229,50,152,9,224,27,224,248,13,237,96,239,224,248,28,247,96,90,253,249,242,144,11,224,248,16,205,224,248,13,230,17,226,248,
+11,206,96,207,0,250,21,218,210,144,13,226,248,10,215,96,216,0,217,224,255,254,253,255,255,231,30,96,222,96,223,96,224,96,225,0,226,0,227,0,254,167,228,224,248,13,32,230,32,231,96,232,96,233,96,228,250,241,236,136,217,224,248,15,
+240,32,241,0,242,254,244,0,236,214,245,254,224,248,14,0,243,234,144,14,238,224,248,14,252,113,37,95,0,55,254,255,242,110,16,12,0,254,0,255,0,24,10,86,85,242,86,112,11,64,148,110,64,12,238,104,12,224,248,64,124,113,145,85,
+32,214,254,242,246,104,12,0,112,30,4,176,133,245,186,156,223,0,224,24,160,217,65,1,66,160,216,21,250,79,76,1,170,170,48,195,86,248,17,156,223,160,216,90,255,248,53,18,80,13,254,248,18,18,80,12,170,170,254,248,17,18,80,13,
+254,248,18,46,128,15,254,248,14,160,72,15,255,248,15,160,72,15,186,202,148,176,16,160,72,14,255,248,16,27,104,36,80,16,120,208,12,226,72,29,170,178,224,190,248,17,255,248,9,216,100,190,248,25,192,196,190,226,95,131,17,224,248,23,
+156,152,104,151,104,92,104,58,112,64,15,251,171,224,254,1,4,10,102,104,68,40,59,40,220,248,12,64,103,87,85,36,13,40,69,40,220,248,12,64,103,184,40,10,220,248,11,224,248,12,36,8,10,26,148,220,104,59,112,32,96,12,232,136,
+10,84,29,220,164,186,224,189,108,8,12,254,254,64,210,65,11,148,6,254,16,179,226,72,14,254,97,11,254,85,125,6,224,43,18,48,74,14,48,28,136,255,138,160,11,68,192,18,1,51,1,52,189,170,72,192,20,224,254,60,1,61,72,192,
+20,224,254,142,95,72,192,14,190,255,224,248,27,76,192,10,1,96,1,97,226,248,14,49,32,134,32,135,32,65,95,255,32,66,32,6,32,7,96,192,14,110,58,59,32,100,32,101,32,191,195,75,32,76,32,16,32,17,68,162,104,30,254,32,
+143,255,61,32,62,32,91,228,68,32,69,0,110,0,111,127,135,0,85,0,86,0,26,0,27,100,106,104,40,254,71,101,32,71,32,72,202,110,58,138,62,254,61,170,228,106,0,163,81,32,82,202,228,248,12,224,255,170,170,64,67,12,240,9,
+254,248,11,36,115,182,176,51,246,200,90,226,232,25,160,72,17,170,42,224,248,14,242,232,19,224,248,11,242,232,16,174,248,13,18,240,17,174,248,13,224,248,18,246,191,174,104,148,90,67,40,66,40,65,41,89,41,88,228,255,194,216,13,206,
+96,242,40,77,40,76,40,75,40,101,40,242,254,100,194,216,13,224,252,96,128,89,8,113,8,112,8,251,208,111,8,110,230,221,91,40,62,40,84,30,160,234,43,124,96,57,96,0,192,10,230,221,182,72,40,71,32,40,21,62,160,234,224,248,
+13,220,253,182,82,8,81,32,50,169,58,132,0,240,27,228,138,92,154,77,127,254,248,15,88,0,132,197,192,104,188,0,18,254,248,10,236,149,85,0,37,244,253,114,185,64,138,232,11,176,67,82,184,9,86,13,96,228,254,94,191,82,184,9,
+224,248,9,8,181,42,252,12,254,248,17,224,248,12,22,254,248,17,160,248,12,254,248,18,224,248,99,186,228,102,254,248,22,24,140,224,252,254,228,248,17,88,171,47,131,88,130,224,248,9,220,248,11,228,252,88,121,88,120,224,248,13,249,170,
+254,228,248,9,1,17,1,18,224,248,13,228,248,13,96,139,90,86,224,255,228,248,17,224,248,9,88,228,248,20,224,192,233,228,248,23,85,181,180,131,80,129,228,248,23,182,131,78,130,228,248,22,254,248,34,127,175,170,228,248,27,32,136,32,
+137,228,248,27,176,211,228,248,27,176,210,228,248,27,254,162,116,242,230,253,40,164,32,146,32,147,228,248,14,254,213,85,140,63,174,38,211,92,208,16,148,62,0,184,38,211,92,208,16,36,240,13,181,170,182,232,25,254,248,88,152,128,81,82,
+254,254,68,128,81,84,88,102,26,72,132,94,125,12,72,21,167,248,80,37,8,18,254,254,36,212,240,248,9,64,88,64,105,85,85,164,200,12,36,208,11,160,186,196,39,98,136,11,128,184,13,132,200,12,4,210,87,246,224,255,24,140,96,27,
+14,208,15,224,84,221,204,88,186,186,213,14,208,16,56,216,10,8,200,224,156,172,208,15,112,222,8,214,170,42,224,248,11,0,216,17,224,248,9,228,208,21,224,252,228,248,21,224,254,228,208,27,75,178,224,228,208,26,224,228,208,27,128,87,
+85,0,216,27,203,32,59,0,216,83,168,154,0,216,15,200,248,11,140,91,88,153,89,98,224,248,10,228,136,106,200,224,93,36,52,157,200,248,9,96,69,96,155,236,224,245,85,72,92,224,209,172,253,96,78,96,79,200,104,11,224,255,88,253,
+85,85,193,234,224,248,19,88,254,174,253,116,151,224,255,224,34,82,65,85,37,226,253,254,255,224,248,11,196,255,164,38,224,254,180,85,85,196,248,11,164,38,190,255,54,255,132,151,224,31,222,248,10,72,39,85,82,92,38,254,253,68,146,0,
+151,168,184,142,124,253,69,84,224,248,12,164,24,12,254,220,224,248,12,228,24,14,89,149,12,34,226,0,145,222,255,48,253,254,254,148,148,224,46,107,0,16,23,228,80,179,4,16,21,84,85,228,0,16,127,254,248,127,154,12,100,8,26,154,
+11,224,248,21,100,10,85,237,154,12,224,248,22,100,9,154,12,224,248,22,100,9,64,154,9,33,126,215,135,254,248,21,104,167,72,165,0,154,9,33,136,254,248,21,100,10,33,102,64,40,254,32,254,96,254,210,87,246,244,252,248,254,64,104,
+64,89,174,73,182,73,90,82,254,1,2,8,162,246,160,78,252,204,163,14,138,42,65,254,174,228,246,254,97,130,10,6,254,252,203,224,248,22,236,224,255,129,254,171,50,224,248,14,8,52,44,224,252,50,235,224,248,12,242,85,185,224,95,188,
+201,156,203,224,248,17,254,133,146,74,254,255,224,255,146,142,254,254,248,13,224,252,164,106,146,254,156,254,254,248,10,162,112,10,88,253,224,248,77,132,37,75,60,35,254,253,224,188,242,33,254,248,22,67,105,228,97,131,254,33,254,248,22,228,
+96,45,168,87,254,32,254,248,26,76,196,32,57,32,70,195,172,36,79,65,166,233,188,72,180,230,64,236,80,148,245,97,250,221,172,36,158,34,88,170,0,95,236,64,47,85,213,18,224,13,172,38,158,36,0,224,20,172,37,158,37,0,224,252,
+0,224,69,181,175,64,167,124,159,254,248,14,72,0,225,64,176,64,177,124,158,175,170,254,248,15,72,177,72,175,230,226,124,232,14,116,239,202,230,222,224,12,75,74,254,248,9,129,65,190,226,250,254,254,216,248,13,171,170,192,130,8,180,80,
+11,216,248,10,238,222,153,122,108,80,16,224,248,10,90,85,76,80,20,152,248,10,224,248,20,131,254,248,9,2,168,30,158,178,224,248,68,184,114,149,238,124,240,19,224,254,204,211,254,2,40,18,254,254,32,47,170,88,32,105,1,98,252,169,
+252,164,247,254,218,47,43,164,181,32,252,32,253,162,105,254,200,242,218,216,12,202,74,220,74,226,172,254,253,150,216,15,171,247,224,1,131,254,248,22,248,73,36,129,96,104,248,35,248,25,96,248,215,117,96,219,104,237,224,248,26,210,25,104,
+247,224,248,26,210,25,104,205,125,253,224,248,26,210,25,104,207,104,206,226,248,22,210,25,96,218,104,217,215,33,104,216,104,215,226,248,18,210,25,96,217,224,8,252,159,252,233,104,225,104,224,104,223,104,222,0,30,20,227,254,210,30,236,25,
+224,1,255,97,135,39,5,96,20,104,218,232,104,231,96,254,195,138,210,26,9,238,0,20,24,170,72,183,196,170,244,216,236,56,181,68,183,132,182,170,170,248,248,14,172,168,15,254,248,15,224,248,28,88,177,228,168,12,248,248,15,128,201,234,
+37,136,168,12,248,248,15,96,21,32,179,6,64,97,248,248,15,254,87,73,32,66,64,45,254,248,25,228,202,208,227,204,216,171,53,202,180,168,10,128,173,168,224,12,9,254,140,168,9,170,202,242,88,136,16,104,173,218,242,100,49,224,248,16,
+236,53,170,74,22,160,248,15,224,248,10,30,171,160,252,4,128,13,184,226,130,130,224,90,194,250,192,248,17,236,243,254,86,21,94,241,128,137,27,224,248,17,64,248,10,96,248,20,28,248,11,96,248,26,85,85,62,216,252,138,56,10,134,63,
+180,242,248,248,11,170,61,166,56,10,207,238,255,248,16,124,0,125,252,255,248,16,104,8,158,74,33,147,130,106,33,107,252,242,222,254,252,230,86,171,138,217,96,81,32,174,223,254,248,13,0,81,105,28,82,0,80,24,170,170,0,224,30,254,
+218,0,224,27,254,218,0,224,27,254,218,0,224,27,254,218,234,146,0,224,25,254,220,0,224,23,254,222,0,233,0,224,12,255,224,65,254,216,10,226,0,224,13,104,230,96,254,254,223,50,72,228,204,39,20,240,2,228,170,138,210,4,153,216,
+170,172,32,16,190,35,242,248,9,72,32,14,170,87,254,206,145,156,173,248,136,10,220,248,10,254,0,255,18,169,228,248,15,65,85,8,230,198,114,179,236,248,12,8,224,12,192,253,236,248,11,213,85,44,37,248,253,88,179,236,248,11,0,45,
+254,248,29,32,67,48,70,87,191,254,248,18,96,250,96,58,224,64,30,224,248,27,95,64,99,16,140,255,194,224,248,25,80,213,80,204,80,130,80,131,220,248,24,255,200,247,47,80,144,80,145,220,248,24,0,16,214,1,14,1,15,220,248,24,
+170,170,224,144,171,220,248,23,224,253,220,248,24,224,248,10,220,248,20,170,170,224,248,14,220,248,15,224,248,19,220,248,11,224,248,23,220,254,224,248,27,128,171,191,190,92,145,104,137,104,138,8,126,224,248,21,46,234,104,69,104,68,170,170,
+220,248,24,100,88,74,98,88,82,244,72,26,242,72,45,44,80,88,144,8,10,228,248,20,74,58,144,8,10,116,8,20,234,200,27,228,234,200,20,202,200,9,105,36,148,134,254,41,254,248,22,228,104,45,254,146,170,40,254,248,22,228,0,64,
+165,120,232,147,164,56,61,144,248,103,126,175,110,8,13,186,192,18,8,104,67,40,92,142,9,90,8,94,224,248,19,255,122,192,218,40,102,40,101,104,100,104,93,216,248,19,180,179,5,8,111,201,167,104,178,216,28,9,93,104,92,104,216,234,
+83,60,224,248,9,12,118,28,11,103,104,102,104,216,70,245,135,224,146,224,248,13,238,35,113,72,112,72,111,72,216,22,93,80,224,145,89,224,248,17,244,104,138,3,64,112,59,213,232,156,178,20,201,224,248,13,230,138,5,224,62,122,88,86,
+153,64,32,202,19,224,248,24,60,61,224,248,15,244,84,85,224,128,107,224,248,154,188,50,32,177,224,248,16,0,193,242,186,85,213,24,162,24,194,244,130,224,255,232,130,254,190,230,32,192,0,232,61,215,215,40,59,40,58,220,248,17,158,200,
+9,40,69,40,68,220,248,21,160,253,171,170,79,8,78,220,248,28,46,234,220,248,27,248,14,220,248,23,148,174,85,85,204,170,5,220,248,18,116,168,11,32,241,184,248,16,20,164,224,255,184,248,15,149,171,72,248,23,254,246,0,248,97,110,
+3,0,248,25,126,160,9,170,42,220,248,20,224,248,10,220,248,20,210,164,94,160,9,220,248,14,224,253,226,240,11,171,168,216,220,254,224,248,14,148,248,16,224,86,166,170,170,226,126,28,80,12,68,76,246,152,18,224,255,182,152,12,142,152,
+16,224,248,14,170,170,214,152,9,224,248,21,214,152,9,224,254,4,147,238,155,214,152,13,252,141,170,170,14,68,172,158,184,232,17,236,12,186,240,10,162,248,10,0,251,236,13,170,234,30,248,24,236,13,44,152,17,224,248,18,40,45,224,248,
+25,100,69,224,248,11,98,170,146,0,0,219,42,248,11,30,248,12,64,252,34,152,21,228,146,146,44,8,14,254,248,12,228,44,8,14,254,248,12,228,170,42,224,248,127,0,253,254,248,20,0,213,254,248,27,0,128,29,128,121,0,128,28,138,
+162,224,0,128,28,224,0,128,28,224,127,233,0,128,23,49,96,58,96,92,96,67,0,128,20,228,59,96,214,167,68,100,186,8,254,121,0,96,11,96,90,96,91,228,138,146,96,202,9,196,187,255,220,122,212,39,213,28,43,100,96,101,228,202,
+10,16,111,42,41,80,99,63,169,2,104,50,0,110,0,111,228,224,22,8,96,16,170,170,40,237,224,102,70,224,16,156,22,224,248,23,160,96,14,8,96,16,244,248,10,170,146,228,8,12,128,8,15,96,42,32,22,8,96,10,0,232,11,236,
+85,171,0,240,30,238,32,34,224,224,10,210,224,12,196,177,105,224,182,238,224,10,164,162,242,255,228,96,190,82,224,13,224,253,228,170,106,224,248,64,192,121,32,232,10,114,44,242,253,4,186,128,8,31,94,201,201,107,85,132,8,24,201,179,
+234,160,128,25,24,34,67,224,248,125,0,100,254,248,21,178,171,228,0,99,37,0,96,29,64,47,240,76,254,248,15,250,251,0,98,106,128,125,255,248,205,41,47,41,54,9,46,224,248,26,57,41,56,253,197,41,55,220,248,25,9,50,1,28,
+41,49,220,248,25,224,168,106,20,254,220,248,24,224,253,220,248,12,224,248,22,220,254,48,215,90,106,240,225,1,109,254,254,248,247,109,254,254,32,248,196,108,252,248,28,117,16,236,35,254,248,25,72,130,64,40,254,172,131,201,161,254,244,254,
+248,11,97,130,254,65,94,46,54,19,254,253,2,64,18,254,252,208,2,242,8,9,170,170,254,136,29,90,136,11,112,24,9,244,253,224,248,24,172,193,146,14,0,24,12,224,248,14,232,212,248,10,224,254,97,129,165,165,254,33,254,248,10,240,
+1,7,94,195,110,106,173,5,224,212,12,8,9,236,209,89,158,204,182,171,5,32,200,14,42,170,44,203,240,248,12,96,200,13,240,248,36,86,60,23,224,248,19,42,139,172,242,248,246,224,248,47,222,194,6,240,242,106,85,254,224,192,14,222,
+195,32,130,33,254,253,0,64,31,58,242,224,192,23,169,234,30,243,148,134,96,200,21,236,238,224,248,31,78,200,9,96,211,235,162,96,163,230,104,161,104,160,44,9,224,253,33,246,3,2,22,113,105,90,242,96,170,96,173,1,18,28,236,224,
+171,104,170,240,160,255,5,136,190,104,143,87,189,96,153,1,29,224,188,104,180,56,117,40,122,127,122,8,61,8,97,72,199,64,197,114,72,198,88,170,32,127,242,228,242,184,13,64,195,64,196,1,34,188,247,224,209,72,208,224,184,22,24,1,
+25,132,67,26,1,170,227,27,224,184,131,0,192,63,224,234,0,192,27,1,142,254,143,63,64,1,154,1,163,1,144,9,250,244,167,200,80,250,17,250,252,25,248,252,76,1,228,25,224,123,216,7,56,242,163,17,252,246,167,1,168,18,192,238,
+234,248,254,170,1,1,1,159,254,220,248,71,32,246,9,170,222,232,236,252,247,252,0,10,0,11,0,13,0,14,248,248,24,21,0,175,32,23,0,24,0,25,248,248,24,226,248,29,248,226,248,29,8,247,248,226,248,29,254,32,0,31,252,248,
+28,41,0,118,108,42,252,248,28,15,254,248,189,1,158,254,123,84,241,164,21,0,36,241,44,242,36,242,238,252,5,32,248,0,241,254,248,232,34,80,220,230,216,242,234,232,236,177,160,0,241,250,105,26,241,252,250,234,12,32,188,235,246,248,
+254,238,233,214,254,232,105,0,240,252,254,248,163,33,125,217,51,0,52,0,53,71,40,0,54,0,63,244,252,64,244,253,0,168,248,250,226,240,254,218,248,9,63,192,10,98,54,8,53,8,52,8,238,255,34,165,35,1,110,202,253,210,73,0,
+74,240,1,144,172,255,250,228,174,74,236,248,13,214,248,9,0,24,238,252,240,255,216,248,10,172,252,181,138,255,34,182,253,228,254,73,230,253,212,248,9,208,254,93,197,248,8,138,253,0,35,220,72,46,254,248,12,236,248,11,255,234,97,155,
+232,248,17,250,254,160,177,116,1,127,222,0,46,164,19,252,238,83,0,84,232,16,96,234,248,254,226,117,120,226,224,1,120,0,56,218,242,50,203,118,248,253,202,226,254,254,180,30,218,248,1,121,248,248,12,254,248,31,140,1,103,239,179,250,
+161,1,147,74,210,1,148,1,152,234,0,45,250,252,254,240,144,116,225,171,34,225,228,35,222,123,222,162,1,160,210,92,84,250,93,1,102,24,226,80,2,240,9,20,246,171,170,238,255,16,0,244,96,242,220,232,11,74,240,10,248,243,192,232,
+19,168,42,2,243,226,250,238,22,240,19,230,254,50,240,11,66,240,9,163,10,192,190,12,244,210,252,234,238,204,170,220,234,224,166,238,204,253,240,248,11,42,246,74,246,2,240,29,72,244,254,248,19,255,84,72,244,1,119,112,81,1,246,85,
+1,104,203,253,206,244,252,251,87,88,241,126,150,243,124,1,94,1,95,0,44,244,234,22,245,37,193,244,252,32,240,13,250,30,240,11,252,30,240,33,26,63,103,84,241,48,242,112,252,102,1,149,1,141,106,33,250,224,248,10,42,241,158,48,
+241,246,122,86,42,232,144,90,209,66,210,230,150,24,241,128,5,200,210,70,212,157,60,211,248,59,168,94,210,170,242,233,160,9,240,228,233,50,240,12,106,73,158,244,50,240,9,234,253,146,241,36,64,240,12,216,218,254,85,85,248,254,196,248,
+13,10,224,13,188,216,9,210,238,184,248,9,50,224,9,240,252,85,181,244,254,218,248,9,48,246,210,252,220,248,11,255,254,108,236,33,234,213,18,240,10,236,232,11,18,224,26,50,247,155,1,104,232,248,12,238,239,30,241,86,5,125,88,227,
+114,42,225,218,253,238,238,0,227,254,33,74,80,224,11,218,115,208,238,238,170,208,216,244,252,24,224,10,40,231,30,224,39,254,149,26,225,26,91,141,224,248,26,254,234,143,248,153,32,241,156,204,237,0,97,206,202,196,252,238,154,1,168,96,
+70,163,254,233,246,234,216,0,226,144,161,85,28,179,248,103,24,136,170,98,252,248,21,184,77,216,160,22,117,172,24,15,8,145,248,140,33,1,254,2,240,142,171,174,224,255,250,96,158,153,70,86,192,48,10,224,254,57,96,120,145,170,170,30,
+56,18,224,248,21,220,248,9,224,248,25,152,252,224,248,17,250,72,11,224,248,19,186,6,250,72,12,224,255,24,97,0,47,250,48,18,224,254,45,254,13,38,0,144,19,236,203,170,250,242,217,167,250,174,88,240,164,224,235,208,219,248,144,202,
+219,53,145,34,177,244,155,204,217,9,228,242,170,196,22,178,2,164,22,177,250,156,246,157,234,170,74,240,0,176,252,254,248,163,224,238,228,49,244,28,254,248,9,170,86,236,224,255,152,139,196,224,13,180,115,224,254,252,192,227,228,224,12,150,
+85,236,192,224,26,236,224,248,13,222,24,12,224,248,17,85,65,180,16,12,224,248,13,0,235,20,24,13,32,137,236,64,248,10,85,85,38,58,240,42,16,49,24,59,64,248,17,152,31,144,123,64,248,15,85,85,226,216,10,88,59,96,248,15,
+42,224,10,224,248,57,254,242,224,248,27,4,227,21,171,224,248,18,0,249,252,46,254,98,10,130,0,248,12,178,170,0,225,2,48,15,236,16,96,14,254,248,15,26,100,12,102,170,170,254,248,17,96,117,96,24,21,90,102,44,103,224,248,21,
+16,104,11,192,248,20,170,74,54,99,236,248,9,6,108,254,252,218,93,236,242,228,255,145,37,176,33,254,168,196,248,14,236,21,85,224,248,11,250,92,224,248,11,176,254,248,10,116,248,11,144,255,82,85,172,16,93,224,248,11,212,83,112,255,
+68,92,196,248,11,149,131,226,252,208,240,9,224,248,11,196,129,254,44,7,220,80,11,244,24,253,196,5,254,117,96,224,248,15,24,102,248,101,97,1,250,248,81,85,246,227,244,0,96,36,254,248,22,0,103,254,248,22,96,103,85,85,254,248,
+26,224,248,9,190,79,188,248,20,254,248,35,136,246,236,248,19,24,244,85,85,254,253,236,248,19,220,232,10,12,244,238,248,11,254,248,25,238,240,12,4,22,85,73,236,248,10,148,232,12,108,85,236,248,11,244,248,11,248,244,248,11,85,37,
+208,239,248,245,224,254,236,248,11,128,240,59,100,240,31,254,85,37,20,208,11,244,248,19,18,214,216,58,200,209,232,11,244,85,82,232,254,36,230,40,232,11,28,232,15,220,224,248,16,200,248,10,85,86,24,80,10,224,248,9,24,237,224,248,
+23,254,204,58,20,240,12,85,85,224,248,18,0,240,18,68,228,224,252,254,248,19,224,235,192,254,72,216,22,38,85,224,60,188,248,22,130,247,224,248,31,204,237,85,85,254,248,16,224,253,236,238,254,248,17,224,248,37,254,248,31,146,160,23,
+0,214,181,168,224,248,23,208,46,92,160,14,92,254,252,224,124,245,170,94,50,160,24,128,255,200,8,21,96,248,31,224,248,31,156,230,1,44,1,28,65,147,175,204,253,83,254,224,248,13,0,122,0,123,32,248,20,247,95,194,246,60,1,61,
+224,248,27,0,142,0,143,0,128,0,129,252,255,79,122,192,248,15,86,1,87,188,252,254,224,248,16,96,1,97,253,171,252,248,11,224,248,15,97,106,97,107,33,106,33,252,255,40,158,170,170,224,255,116,225,254,248,19,188,223,230,203,254,248,
+21,224,203,255,248,22,170,85,252,222,224,248,24,168,37,192,232,24,184,36,113,76,240,12,22,245,20,242,85,85,40,45,224,248,12,192,248,12,224,248,42,140,238,192,248,55,224,248,69,162,236,85,181,160,238,128,248,113,224,248,14,232,30,224,
+248,23,252,173,68,253,82,250,247,254,252,54,128,101,170,115,99,96,58,96,92,96,67,34,224,22,99,97,222,202,172,63,185,133,96,77,226,248,24,173,0,136,11,26,224,12,186,85,196,86,167,255,252,132,0,86,222,49,196,255,224,248,11,58,
+226,136,215,255,94,108,59,97,174,196,253,224,255,31,47,96,60,96,134,96,135,82,93,96,68,250,193,56,254,254,64,128,10,96,8,254,70,96,100,96,101,95,33,96,102,96,103,0,78,44,227,58,152,9,224,18,252,171,254,32,80,32,110,32,
+111,32,112,40,212,236,202,142,116,58,157,22,161,1,137,254,82,3,0,113,65,73,204,253,224,226,146,216,254,224,206,150,65,0,226,252,254,248,254,98,204,85,86,224,254,254,254,38,214,246,125,224,174,126,254,248,10,85,213,254,175,22,112,147,
+114,237,112,232,73,156,200,21,4,248,148,186,216,12,40,105,250,235,248,208,248,29,224,248,64,67,104,92,104,58,9,216,143,224,248,16,77,95,245,105,133,105,0,105,172,222,248,11,146,228,140,229,206,129,97,10,125,157,105,173,222,248,11,1,
+51,1,52,250,254,42,236,97,8,86,197,222,8,49,224,253,248,195,242,197,10,237,222,195,168,174,104,59,118,8,94,230,204,193,226,15,250,254,234,231,222,104,69,104,68,104,93,31,212,80,105,89,105,88,104,194,210,196,224,255,146,226,255,87,
+8,78,104,103,104,102,104,101,104,100,104,70,210,196,224,253,133,127,110,228,208,225,254,8,112,104,111,104,110,104,80,21,7,0,101,224,252,110,228,224,9,0,254,149,212,116,226,254,248,9,248,221,248,250,252,184,253,224,248,12,168,170,8,202,
+250,254,224,248,19,10,96,15,224,248,11,210,216,9,170,42,10,96,9,224,248,10,12,120,10,10,96,9,224,248,9,20,96,9,16,228,254,88,10,171,170,254,0,144,30,0,80,169,255,248,252,255,248,252,255,248,252,255,248,252,170,170,255,248,
+252,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,255,248,252,170,2,0,240,1,255,248,252,255,248,252,255,248,252,255,248,130,0,240,0,0,0,0,0,0,0
@@ -0,0 +1,4 @@
+0,12,0,43,0,74,0,110,0,146,0,177,6,244,9,0,0,232,244,9,0,15,0,4,8,0,21,232,4,4,0,24,0,241,8,0,26,236,241,4,0,29,4,6,244,9,0,0,232,244,9,0,15,0,4,8,0,21,232,4,4,0,24,0,
+244,8,0,31,236,244,4,0,34,4,7,4,0,0,48,12,244,9,0,0,232,244,9,0,15,0,4,8,0,21,232,4,4,0,24,0,241,8,0,26,236,241,4,0,29,4,7,4,4,0,49,12,244,9,0,0,232,244,9,0,15,0,4,8,
+0,21,232,4,4,0,24,0,244,8,0,31,236,244,4,0,34,4,6,244,13,0,0,236,4,12,0,8,236,4,0,0,12,12,12,4,0,13,244,241,8,0,26,236,241,4,0,29,4,4,244,13,0,0,236,4,12,0,8,236,4,0,0,12,
+12,12,4,0,13,244,244,8,0,31,236,244,4,0,34,4
@@ -0,0 +1 @@
+0,8,0,14,0,20,0,26,1,244,10,0,0,244,1,244,10,0,9,244,1,244,10,0,18,244,1,244,10,0,27,244
@@ -0,0 +1 @@
+0,8,0,14,0,20,0,26,1,248,5,0,36,248,1,248,5,0,40,248,1,248,5,0,44,248,1,248,5,0,51,248
@@ -0,0 +1 @@
+0,4,0,10,1,240,15,0,0,240,1,240,15,0,16,240
@@ -0,0 +1,3 @@
+0,14,0,35,0,56,0,77,0,98,0,129,0,135,4,240,9,0,0,232,240,9,8,0,0,0,5,0,6,240,0,5,8,6,0,4,240,9,0,10,232,240,9,0,16,0,0,5,0,22,240,0,9,0,26,0,4,236,9,0,0,232,236,9,
+8,0,0,252,5,8,6,0,252,6,0,32,240,4,236,9,0,10,232,236,9,0,16,0,252,9,0,38,0,252,6,0,44,240,6,240,4,0,50,240,240,4,8,50,0,248,9,0,52,232,248,9,8,52,0,8,4,0,58,240,8,4,8,58,
+0,1,248,5,0,60,248,1,248,5,0,64,248,0
@@ -0,0 +1,17 @@
+0,22,0,93,0,174,0,225,1,90,1,191,2,66,2,182,3,82,3,158,3,199,14,248,5,0,46,136,248,5,0,38,152,248,5,0,26,168,248,1,0,70,184,248,5,0,30,192,248,5,0,62,216,248,5,0,14,232,248,5,0,4,248,248,
+9,0,8,8,248,5,0,46,40,248,5,0,62,56,248,5,0,4,72,248,5,0,92,88,248,5,0,92,104,16,216,5,0,0,128,216,5,0,4,144,216,9,0,8,160,216,5,0,14,180,216,5,0,18,208,216,5,0,22,224,216,5,0,4,
+240,216,5,0,26,0,8,5,0,30,200,8,5,0,4,216,8,5,0,34,232,8,5,0,38,248,8,5,0,22,8,8,5,0,42,32,8,5,0,4,48,8,5,0,46,68,10,216,5,0,18,128,216,5,0,34,144,216,5,0,38,160,216,5,
+0,0,176,216,5,0,34,192,216,5,0,4,208,216,9,0,8,224,8,5,0,42,232,8,5,0,50,248,8,5,0,54,8,24,216,5,0,30,136,216,5,0,58,152,216,5,0,4,168,216,5,0,34,184,216,5,0,4,200,216,5,0,30,216,
+216,5,0,62,232,216,5,0,14,248,216,5,0,34,8,216,5,0,66,32,216,5,0,14,48,216,5,0,46,64,216,1,0,70,80,216,5,0,0,88,216,5,0,26,104,8,5,0,72,192,8,1,0,70,208,8,5,0,0,216,8,1,0,70,
+232,8,5,0,46,240,8,5,0,22,0,8,5,0,4,16,8,5,0,26,32,8,5,0,66,48,20,208,5,0,66,160,208,5,0,14,176,208,5,0,46,192,208,1,0,70,208,208,5,0,0,216,208,5,0,26,232,0,5,0,76,232,0,1,
+0,70,248,0,5,0,26,4,0,5,0,42,20,0,5,0,4,36,32,5,0,18,208,32,5,0,58,224,32,5,0,14,240,32,5,0,26,0,32,1,0,70,16,32,5,0,80,24,32,5,0,34,48,32,1,0,70,64,32,5,0,14,72,26,
+216,5,0,46,152,216,5,0,38,168,216,5,0,50,184,216,5,0,26,200,216,5,0,84,216,216,5,0,18,248,216,5,0,34,8,216,5,0,38,24,216,5,0,66,40,216,5,0,50,56,216,5,0,30,72,216,5,0,14,88,8,9,0,8,
+136,8,5,0,4,156,8,5,0,46,172,8,5,0,4,188,8,5,0,62,204,8,5,0,38,220,8,5,0,26,248,8,5,0,4,8,8,5,0,88,24,8,5,0,4,40,8,9,0,8,56,8,5,0,50,76,8,5,0,34,92,8,5,0,
+4,108,23,208,5,0,46,152,208,5,0,38,168,208,5,0,50,184,208,5,0,26,200,208,5,0,84,216,208,5,0,18,248,208,5,0,34,8,208,5,0,38,24,208,5,0,0,40,208,5,0,34,56,208,5,0,4,72,208,9,0,8,88,0,
+5,0,76,208,0,1,0,70,224,0,9,0,8,232,0,1,0,70,252,0,5,0,62,4,0,5,0,4,20,32,9,0,8,208,32,5,0,4,228,32,5,0,30,244,32,5,0,88,4,32,5,0,42,20,31,216,5,0,46,128,216,5,0,18,
+144,216,5,0,14,160,216,5,0,30,176,216,1,0,70,192,216,5,0,4,200,216,5,0,22,216,216,5,0,62,248,216,5,0,58,8,216,5,0,4,24,216,5,0,26,40,216,5,0,88,56,216,5,0,46,72,0,5,0,92,176,0,5,0,
+50,192,0,5,0,76,208,0,1,0,70,224,0,5,0,38,232,0,9,0,8,0,0,1,0,70,20,0,5,0,26,28,0,5,0,14,44,0,5,0,0,60,0,1,0,70,76,0,5,0,46,84,0,5,0,58,100,0,1,0,70,116,32,5,
+0,18,248,32,5,0,4,8,32,5,0,18,24,32,5,0,4,40,15,248,5,0,18,128,248,5,0,34,144,248,5,0,14,160,248,5,0,46,176,248,5,0,14,192,248,5,0,26,208,248,5,0,62,224,248,5,0,14,240,248,5,0,66,0,
+248,5,0,72,24,248,5,0,42,40,248,5,0,46,64,248,5,0,14,80,248,5,0,0,96,248,5,0,4,112,8,48,5,0,62,192,48,5,0,34,208,48,5,0,42,224,48,5,0,4,248,48,5,0,0,8,48,5,0,4,24,48,1,0,
+70,40,48,5,0,26,48,17,232,5,0,46,180,232,5,0,38,196,232,5,0,26,212,232,1,0,70,228,232,5,0,30,236,232,5,0,62,4,232,5,0,14,20,232,5,0,4,36,232,9,0,8,52,0,5,0,18,192,0,5,0,34,208,0,
+5,0,14,224,0,5,0,46,240,0,5,0,14,0,0,5,0,26,16,0,5,0,62,32,0,5,0,46,48,0
@@ -0,0 +1,2 @@
+0,10,0,16,0,22,0,28,0,49,1,248,9,0,0,244,1,240,15,0,6,240,1,240,15,0,22,240,4,236,10,0,38,236,236,5,0,47,4,4,5,24,47,236,252,10,24,38,252,4,236,10,0,51,236,236,5,0,60,4,4,5,24,60,
+236,252,10,24,51,252
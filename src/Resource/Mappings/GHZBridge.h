@@ -0,0 +1 @@
+0,6,0,12,0,23,1,248,5,0,0,248,2,248,4,0,4,240,0,12,0,6,240,1,252,4,0,8,248,0
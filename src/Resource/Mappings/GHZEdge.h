@@ -0,0 +1,2 @@
+0,6,0,27,0,48,4,224,5,0,4,248,240,5,0,8,248,0,5,0,8,248,16,5,0,8,248,4,224,5,0,8,248,240,5,0,8,248,0,5,0,8,248,16,5,0,8,248,4,224,5,0,0,248,240,5,0,0,248,0,5,0,0,248,
+16,5,0,0,248,0
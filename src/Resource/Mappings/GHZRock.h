@@ -0,0 +1 @@
+0,2,2,240,11,0,0,232,240,11,0,12,0,0
@@ -0,0 +1 @@
+0,8,0,19,0,30,0,41,2,248,13,0,0,184,248,13,0,8,216,2,248,13,0,20,8,248,13,0,12,40,2,248,9,0,28,196,248,13,0,8,220,2,248,13,0,20,12,248,13,0,12,44
@@ -0,0 +1,2 @@
+0,14,0,35,0,56,0,82,0,88,0,94,0,100,4,240,13,0,0,236,0,12,0,8,236,248,1,0,12,12,8,8,0,14,244,4,241,13,0,0,236,1,12,0,8,236,249,1,0,12,12,9,8,0,17,244,5,240,13,0,0,236,0,12,
+0,20,236,248,1,0,12,12,8,4,0,24,236,8,4,0,18,252,1,250,0,0,26,16,1,250,0,0,27,16,1,250,0,0,28,16,0,0
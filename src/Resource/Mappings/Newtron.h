@@ -0,0 +1,3 @@
+0,22,0,38,0,54,0,70,0,91,0,107,0,118,0,134,0,150,0,166,0,182,3,236,13,0,0,236,244,0,0,8,12,252,14,0,9,244,3,236,6,0,21,236,236,9,0,27,252,252,10,0,33,252,3,236,6,0,42,236,236,9,0,27,
+252,252,10,0,33,252,4,236,6,0,48,236,236,9,0,27,252,252,9,0,54,252,12,0,0,60,12,3,244,13,0,61,236,252,0,0,32,12,4,8,0,69,252,2,248,13,0,72,236,248,1,0,80,12,3,248,13,0,72,236,248,1,0,80,
+12,254,0,0,82,20,3,248,13,0,72,236,248,1,0,80,12,254,4,0,83,20,3,248,13,0,72,236,248,1,0,80,12,254,0,224,82,20,3,248,13,0,72,236,248,1,0,80,12,254,4,224,83,20,0,0
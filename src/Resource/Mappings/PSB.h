@@ -0,0 +1,4 @@
+0,9,0,8,0,39,0,190,6,0,12,0,240,0,0,0,0,243,32,0,0,0,243,48,0,12,0,244,56,0,8,0,248,96,0,8,0,251,120,30,184,15,0,0,128,184,15,0,0,128,184,15,0,0,128,184,15,0,0,128,184,15,0,0,
+128,184,15,0,0,128,184,15,0,0,128,184,15,0,0,128,184,15,0,0,128,184,15,0,0,128,216,15,0,0,128,216,15,0,0,128,216,15,0,0,128,216,15,0,0,128,216,15,0,0,128,216,15,0,0,128,216,15,0,0,128,216,15,0,
+0,128,216,15,0,0,128,216,15,0,0,128,248,15,0,0,128,248,15,0,0,128,248,15,0,0,128,248,15,0,0,128,248,15,0,0,128,248,15,0,0,128,248,15,0,0,128,248,15,0,0,128,248,15,0,0,128,248,15,0,0,128,1,252,
+4,0,0,248
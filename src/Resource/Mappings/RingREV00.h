@@ -0,0 +1 @@
+0,16,0,22,0,28,0,34,0,40,0,46,0,52,0,58,1,248,5,0,0,248,1,248,5,0,4,248,1,248,1,0,8,252,1,248,5,8,4,248,1,248,5,0,10,248,1,248,5,24,10,248,1,248,5,8,10,248,1,248,5,16,10,248
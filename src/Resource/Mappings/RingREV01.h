@@ -0,0 +1,2 @@
+0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,66,1,248,5,0,0,248,1,248,5,0,4,248,1,248,1,0,8,252,1,248,5,8,4,248,1,248,5,0,10,248,1,248,5,24,10,248,1,248,5,8,10,248,1,248,5,16,
+10,248,0,0
@@ -0,0 +1,25 @@
+0,176,0,177,0,198,0,214,0,230,0,246,1,6,1,27,1,38,1,49,1,70,1,81,1,97,1,123,1,154,1,175,1,201,1,222,1,248,2,13,2,24,2,35,2,56,2,67,2,83,2,114,2,145,2,166,2,192,2,213,2,239,2,250,
+3,5,3,16,3,27,3,48,3,64,3,85,3,101,3,112,3,123,3,134,3,145,3,166,3,177,3,198,3,209,3,215,3,221,3,227,3,233,3,239,3,250,4,0,4,11,4,17,4,28,4,49,4,70,4,86,4,102,4,118,4,129,4,145,
+4,161,4,177,4,198,4,219,4,245,5,15,5,26,5,42,5,53,5,69,5,80,5,96,5,112,5,138,5,164,5,175,5,191,5,197,5,203,5,209,5,225,5,241,6,1,6,17,0,4,236,8,0,0,240,244,13,0,3,240,4,8,0,11,
+240,12,8,0,14,248,3,236,9,0,0,240,252,9,0,6,240,12,8,0,12,248,3,236,9,0,0,240,252,9,0,6,240,12,8,0,12,248,3,236,9,0,0,240,252,9,0,6,240,12,8,0,12,248,3,236,10,0,0,240,4,8,0,9,
+240,12,8,0,12,248,4,235,13,0,0,236,251,9,0,8,236,251,6,0,14,4,11,4,0,20,236,2,236,13,0,0,237,252,14,0,8,245,2,237,9,0,0,243,253,10,0,6,243,4,235,9,0,0,244,251,9,0,6,236,251,6,0,12,
+4,11,4,0,18,236,2,236,9,0,0,243,252,14,0,6,235,3,237,13,0,0,236,253,12,0,8,244,5,9,0,12,244,5,235,9,0,0,235,235,6,0,6,3,251,8,0,12,235,3,9,0,15,243,19,0,0,21,251,6,236,9,0,0,
+236,236,1,0,6,4,252,12,0,8,236,4,9,0,12,244,252,5,0,18,12,244,0,0,22,20,4,237,9,0,0,237,237,1,0,6,5,253,13,0,8,245,13,8,0,16,253,5,235,9,0,0,235,235,5,0,6,3,251,13,0,10,243,11,
+8,0,18,243,19,4,0,21,251,4,236,9,0,0,236,236,1,0,6,4,252,13,0,8,244,12,8,0,16,252,5,237,9,0,0,237,237,1,0,6,5,253,0,0,8,237,253,13,0,9,245,13,8,0,17,253,4,244,7,0,0,235,236,9,
+0,8,251,252,4,0,14,251,4,9,0,16,251,2,244,7,0,0,236,236,11,0,8,252,2,244,6,0,0,237,244,10,0,6,253,4,244,6,0,0,235,236,9,0,6,251,252,4,0,12,251,4,9,0,14,251,2,244,6,0,0,236,244,11,
+0,6,252,3,244,7,0,0,237,236,0,0,8,253,244,10,0,9,253,6,253,6,0,0,235,237,4,0,6,243,245,4,0,8,235,245,10,0,10,251,13,0,0,19,251,253,0,0,20,19,6,252,6,0,0,236,228,8,0,6,244,236,4,0,
+9,252,244,4,0,11,236,244,10,0,13,252,12,0,0,22,252,4,251,6,0,0,237,243,4,0,6,237,235,10,0,8,253,3,4,0,17,253,5,253,6,0,0,235,237,8,0,6,243,245,4,0,9,235,245,13,0,11,251,5,8,0,19,251,
+4,252,6,0,0,236,244,4,0,6,236,236,10,0,8,252,4,4,0,17,252,5,251,6,0,0,237,235,10,0,6,253,243,4,0,15,237,3,4,0,17,253,11,0,0,19,253,2,238,9,0,0,244,254,14,0,6,236,2,238,9,0,0,244,
+254,14,0,6,236,2,238,9,0,0,244,254,14,0,6,236,2,238,9,0,0,244,254,14,0,6,236,4,238,9,0,0,238,238,1,0,6,6,254,14,0,8,246,254,0,0,20,238,3,238,9,0,0,238,238,1,0,6,6,254,14,0,8,246,
+4,238,9,0,0,238,238,1,0,6,6,254,14,0,8,246,254,0,0,20,238,3,238,9,0,0,238,238,1,0,6,6,254,14,0,8,246,2,244,6,0,0,238,244,11,0,6,254,2,244,6,0,0,238,244,11,0,6,254,2,244,6,0,0,
+238,244,11,0,6,254,2,244,6,0,0,238,244,11,0,6,254,4,250,6,0,0,238,242,4,0,6,238,234,11,0,8,254,10,0,0,20,254,2,242,7,0,0,238,234,11,0,8,254,4,250,6,0,0,238,242,4,0,6,238,234,11,0,8,
+254,10,0,0,20,254,2,242,7,0,0,238,234,11,0,8,254,1,240,15,0,0,240,1,240,15,0,0,240,1,240,15,0,0,240,1,240,15,0,0,240,1,240,15,0,0,240,2,244,14,0,0,236,244,2,0,12,12,1,240,15,0,0,240,
+2,236,11,0,0,244,12,8,0,12,244,1,240,15,0,0,240,2,237,9,0,0,240,253,14,0,6,240,4,237,9,0,0,240,253,13,0,6,240,13,4,0,14,0,5,0,0,16,232,4,244,4,0,0,252,252,13,0,2,244,12,8,0,10,
+244,4,0,0,13,236,3,236,8,8,0,232,244,2,8,3,0,244,15,8,6,224,3,236,14,8,0,232,4,13,8,12,224,12,0,24,20,0,3,244,13,0,0,252,252,5,0,8,236,4,8,0,12,252,2,244,10,0,0,232,244,10,8,0,
+0,3,244,13,0,0,228,252,0,0,8,4,4,12,0,9,236,3,244,13,0,0,252,252,5,0,8,236,4,8,0,12,252,3,232,11,0,0,240,8,4,0,12,248,16,0,0,14,248,4,248,14,0,0,232,0,5,0,12,8,248,0,0,16,
+8,240,0,0,17,248,4,248,14,0,0,232,0,5,0,12,8,248,0,0,16,8,240,0,0,17,248,5,232,10,0,0,244,240,1,0,9,12,0,9,0,11,244,16,4,0,17,244,0,0,0,19,236,5,232,10,0,0,244,232,1,0,9,12,
+0,9,0,11,244,16,4,0,17,244,0,0,0,19,236,2,237,10,0,0,243,5,13,0,9,235,3,236,10,0,0,243,4,8,0,9,243,12,4,0,12,243,2,237,10,0,0,243,5,13,0,9,235,3,236,10,0,0,243,4,8,0,9,243,
+12,4,0,12,243,2,236,9,0,0,240,252,14,0,6,240,3,236,10,0,0,240,4,5,0,9,248,228,0,0,13,248,3,232,13,0,0,236,232,1,0,8,12,248,11,0,10,244,5,232,13,0,0,236,232,1,0,8,12,248,9,0,10,244,
+8,12,0,16,244,16,0,0,20,244,5,232,13,0,0,236,232,1,0,8,12,248,9,0,10,244,8,12,0,16,244,16,0,0,20,244,2,236,8,0,0,240,244,15,0,3,240,3,236,8,0,0,240,244,14,0,3,240,12,8,0,15,248,1,
+240,11,0,0,244,1,244,6,0,0,248,1,248,1,0,0,252,3,244,13,8,0,228,252,5,8,8,4,4,8,8,12,236,3,244,13,8,0,252,252,0,8,8,244,4,12,8,9,244,3,240,14,0,0,236,248,1,0,12,12,8,12,0,14,
+244,3,235,9,0,0,244,251,14,0,6,236,3,1,0,18,12,2,240,15,0,0,236,248,2,0,16,12
@@ -0,0 +1,12 @@
+0,176,0,177,0,186,0,193,0,200,0,207,0,214,0,223,0,228,0,233,0,242,0,247,0,254,1,9,1,22,1,31,1,42,1,51,1,62,1,71,1,76,1,81,1,90,1,95,1,102,1,115,1,128,1,137,1,148,1,157,1,168,1,173,
+1,178,1,183,1,188,1,197,1,204,1,213,1,220,1,225,1,230,1,235,1,240,1,249,1,254,2,7,2,12,2,15,2,18,2,21,2,24,2,27,2,32,2,35,2,40,2,43,2,48,2,57,2,66,2,73,2,80,2,87,2,90,2,97,
+2,104,2,111,2,120,2,129,2,140,2,151,2,156,2,163,2,168,2,175,2,180,2,187,2,194,2,205,2,216,2,221,2,228,2,231,2,234,2,80,2,90,2,237,2,244,2,251,0,4,32,0,112,3,32,11,32,14,3,80,17,80,23,32,
+29,3,80,32,80,23,32,29,3,80,32,80,23,32,38,3,128,41,32,11,32,14,4,112,50,80,58,80,64,16,70,2,112,50,176,72,2,80,84,128,90,4,80,84,80,99,80,105,16,111,2,80,84,176,113,3,112,50,48,125,80,129,5,80,
+135,80,141,32,147,80,150,0,156,6,80,135,16,157,48,159,80,163,48,169,0,173,4,80,174,16,180,112,182,32,190,5,80,193,48,199,112,203,32,211,16,214,4,80,193,16,216,112,218,32,226,5,80,135,16,157,0,147,112,229,32,237,4,112,
+240,80,248,16,254,81,0,2,112,240,177,6,2,81,18,129,24,4,81,18,81,33,17,39,81,41,2,81,18,177,47,3,112,240,1,6,129,59,6,81,68,17,74,17,76,129,78,1,87,1,88,6,81,68,33,89,17,92,17,94,129,96,1,87,
+4,81,105,17,111,129,113,17,122,5,81,124,33,130,17,133,113,135,33,143,4,81,124,17,146,129,148,17,157,5,81,68,129,159,17,94,17,168,1,87,2,81,170,177,176,2,80,84,177,188,2,81,170,177,200,2,80,84,177,212,4,81,224,17,
+230,177,232,1,244,3,81,245,17,251,177,253,4,81,224,18,9,178,11,1,244,3,81,245,17,251,178,23,2,82,35,178,41,2,81,18,178,53,2,82,35,178,65,2,81,18,178,77,4,82,89,18,95,178,97,2,109,2,114,110,178,118,4,82,
+89,18,130,178,132,2,109,2,114,110,178,144,1,242,156,1,242,172,1,242,188,1,242,204,1,242,220,2,178,236,34,248,1,242,251,2,179,11,35,23,1,243,26,2,83,42,179,48,4,83,60,115,66,19,74,3,76,4,19,77,115,79,35,87,
+3,90,3,35,91,35,94,243,97,3,179,113,115,125,0,113,3,115,133,51,141,35,145,1,131,148,3,115,157,3,165,51,166,3,115,170,51,178,35,182,3,179,185,19,197,3,199,4,179,200,51,212,3,216,3,217,4,179,218,51,230,3,234,3,
+235,5,131,236,19,245,83,247,19,253,3,255,5,132,0,20,9,83,247,19,253,3,255,2,132,11,116,20,3,132,28,36,37,20,40,2,132,42,116,51,3,132,28,36,59,20,62,2,84,64,180,70,3,132,82,52,91,4,95,3,116,96,20,104,
+180,106,5,116,118,20,126,84,128,52,134,4,138,5,116,139,20,126,84,147,52,134,4,138,2,36,153,244,156,3,36,172,180,175,36,187,1,180,190,1,84,202,1,20,208,3,180,210,20,222,52,224,3,84,228,180,234,16,109,2,244,246,37,6
@@ -0,0 +1,2 @@
+0,12,0,23,0,29,0,45,0,51,0,57,2,248,12,0,0,240,0,12,0,4,240,1,0,12,0,0,240,3,232,12,0,0,240,240,5,0,8,248,0,12,0,12,240,1,240,7,0,0,248,1,240,3,0,4,248,4,240,3,0,4,16,248,
+9,0,8,248,240,0,0,0,248,8,0,0,3,248
@@ -0,0 +1,7 @@
+0,24,0,70,0,116,0,148,0,194,0,246,1,42,1,64,1,75,1,86,1,97,1,164,9,248,5,0,24,180,248,5,0,58,196,248,5,0,16,212,248,5,0,16,228,248,5,0,46,244,248,5,0,28,20,248,1,0,32,36,248,5,0,38,
+44,248,5,0,38,60,9,248,5,0,38,188,248,5,0,0,204,248,5,0,4,220,248,5,0,74,236,248,5,0,58,252,248,1,0,32,12,248,5,0,46,20,248,5,0,66,36,248,5,0,28,52,6,248,5,0,42,207,248,5,0,0,224,248,
+5,0,58,240,248,5,0,4,0,248,5,0,38,16,248,5,0,16,32,0,9,248,5,0,62,180,248,5,0,66,196,248,5,0,0,212,248,5,0,58,228,248,5,0,38,4,248,1,0,32,20,248,5,0,24,28,248,5,0,28,44,248,5,0,
+66,60,10,248,5,0,62,172,248,5,0,54,188,248,5,0,58,204,248,1,0,32,220,248,5,0,46,228,248,5,0,24,244,248,5,0,74,20,248,5,0,0,36,248,5,0,58,52,248,5,0,12,68,0,10,248,5,0,62,172,248,5,0,8,
+188,248,5,0,58,204,248,5,0,0,220,248,5,0,54,236,248,5,0,4,12,248,5,0,58,28,248,5,0,0,44,248,1,0,32,60,248,5,0,46,68,0,4,248,5,0,78,224,248,5,0,50,240,248,5,0,46,0,248,5,0,16,16,0,
+2,4,12,0,83,236,244,2,0,87,12,2,4,12,0,83,236,244,6,0,90,8,2,4,12,0,83,236,244,6,0,96,8,13,228,12,0,112,244,228,2,0,116,20,236,4,0,119,236,244,5,0,121,228,20,12,24,112,236,4,2,24,116,228,
+12,4,24,119,4,252,5,24,121,12,236,8,0,125,252,244,12,0,124,244,252,8,0,124,244,4,12,0,124,236,12,8,0,124,236,0,5,248,5,0,20,220,248,1,0,32,236,248,5,0,46,244,248,5,0,0,4,248,5,0,38,20
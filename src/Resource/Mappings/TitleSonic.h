@@ -0,0 +1,11 @@
+0,16,0,67,0,143,0,229,1,39,1,95,1,191,2,41,10,8,8,0,0,8,16,15,0,3,8,16,15,0,19,40,48,14,0,35,8,48,14,0,47,40,72,13,0,59,0,72,9,0,67,32,72,0,0,73,56,88,12,0,74,8,88,0,
+0,78,40,15,72,14,1,189,32,56,5,1,201,56,64,0,1,205,48,72,0,1,206,64,96,0,1,207,32,16,14,0,79,8,16,14,0,91,40,24,1,0,103,72,40,2,0,105,0,40,15,0,108,8,40,15,0,124,40,48,2,0,140,72,
+72,14,0,143,16,72,9,0,155,48,88,4,0,161,48,17,56,14,1,189,40,40,5,1,201,64,48,0,1,205,56,56,0,1,206,72,80,0,1,207,40,32,15,1,169,8,32,3,1,185,40,16,14,0,79,8,16,14,0,91,40,24,1,0,
+103,72,40,2,0,105,0,40,15,0,108,8,40,15,0,124,40,48,2,0,140,72,72,14,0,143,16,72,9,0,155,48,88,4,0,161,48,13,16,15,0,163,8,8,8,0,179,40,16,15,0,182,40,24,0,0,198,72,32,6,0,199,72,56,
+0,0,205,72,48,13,0,206,8,48,14,0,214,40,64,11,0,226,16,72,8,0,238,40,80,1,0,241,8,80,4,0,243,40,88,0,0,245,40,11,8,15,0,246,16,8,11,1,6,48,16,6,1,18,72,40,14,1,24,24,40,14,1,36,
+56,40,1,1,48,16,64,14,1,50,16,64,6,1,62,48,64,4,1,68,64,72,0,1,70,64,88,8,1,71,24,19,40,14,1,228,56,24,5,1,240,72,64,8,1,244,56,72,4,1,247,56,16,15,1,74,16,8,4,1,90,32,0,11,
+1,92,48,8,0,1,104,72,24,0,1,105,72,24,5,1,106,0,40,2,1,110,8,48,15,1,113,16,32,13,1,129,48,32,1,1,137,80,48,8,1,139,48,56,14,1,142,48,80,13,1,154,8,80,12,1,162,40,88,8,1,166,40,21,
+40,14,1,228,56,24,5,1,240,72,64,8,1,244,56,72,4,1,247,56,24,15,1,208,8,24,3,1,224,40,16,15,1,74,16,8,4,1,90,32,0,11,1,92,48,8,0,1,104,72,24,0,1,105,72,24,5,1,106,0,40,2,1,110,
+8,48,15,1,113,16,32,13,1,129,48,32,1,1,137,80,48,8,1,139,48,56,14,1,142,48,80,13,1,154,8,80,12,1,162,40,88,8,1,166,40,22,24,4,1,249,56,32,0,1,251,56,40,8,1,252,48,48,1,1,255,48,48,11,
+2,1,56,24,15,1,208,8,24,3,1,224,40,16,15,1,74,16,8,4,1,90,32,0,11,1,92,48,8,0,1,104,72,24,0,1,105,72,24,5,1,106,0,40,2,1,110,8,48,15,1,113,16,32,13,1,129,48,32,1,1,137,80,48,
+8,1,139,48,56,14,1,142,48,80,13,1,154,8,80,12,1,162,40,88,8,1,166,40
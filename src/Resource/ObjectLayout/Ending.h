@@ -0,0 +1,6 @@
+0,16,1,112,40,12,0,20,1,178,40,18,0,40,1,176,40,12,0,48,1,178,40,18,0,64,1,112,40,15,0,91,1,177,40,17,0,100,1,177,40,17,0,104,1,177,40,12,0,216,1,176,40,19,0,228,1,177,40,12,0,232,1,176,
+40,15,0,244,1,176,40,16,0,248,1,175,40,20,1,8,1,176,40,14,1,8,1,180,40,19,1,16,1,115,40,12,1,20,1,176,40,16,1,40,1,116,40,14,1,40,1,176,40,20,1,40,1,178,40,19,1,48,1,184,40,12,2,16,
+1,176,40,10,2,48,1,178,40,19,2,96,1,176,40,13,2,144,1,182,40,19,2,176,1,80,40,10,2,176,1,128,40,10,2,176,1,176,40,10,2,240,1,178,40,19,3,0,1,176,40,10,3,132,1,176,40,13,4,52,1,184,40,13,
+4,120,1,164,40,19,4,216,1,118,40,19,4,248,1,112,40,10,5,48,1,112,40,16,5,96,1,112,40,16,5,144,1,112,40,16,5,192,1,112,40,16,5,216,1,112,40,16,6,36,1,112,40,10,6,196,1,164,40,13,7,52,1,184,
+40,10,7,248,1,116,40,10,8,120,1,120,40,13,9,184,1,88,40,10,10,0,1,180,40,13,10,72,1,82,40,18,10,120,1,82,40,18,10,168,1,82,40,18,10,212,1,84,40,20,11,52,1,56,40,10,11,248,1,116,40,10,12,196,
+1,171,40,13,12,200,1,72,40,10,13,52,1,186,40,13,13,248,1,116,40,10,255,255,0,0,0,0
@@ -0,0 +1 @@
+36,208,5,16,113,49,37,80,5,16,113,49,255,255,0,0,0,0
@@ -0,0 +1,21 @@
+1,68,3,96,165,18,2,72,3,81,166,6,3,52,2,44,165,69,3,52,3,40,65,2,3,64,3,172,192,0,4,32,3,48,162,0,4,48,67,120,28,3,4,108,3,32,165,20,4,160,4,96,171,0,4,168,3,136,73,0,4,168,3,136,
+17,12,5,16,3,120,28,3,5,214,3,32,166,5,6,128,3,135,165,16,6,160,3,151,165,16,6,192,3,165,165,16,6,227,3,176,165,16,7,11,3,179,165,16,7,55,3,175,165,16,7,91,3,146,165,16,8,176,3,80,159,0,9,96,
+2,250,159,0,9,196,2,192,165,17,9,205,2,253,59,0,10,48,67,8,28,3,10,120,4,0,171,0,10,168,3,24,73,0,10,168,3,24,17,12,10,200,3,192,171,0,11,16,3,8,28,3,11,148,2,208,165,17,11,160,2,254,59,0,
+12,8,2,248,68,0,12,80,3,76,192,0,13,8,3,176,68,0,13,8,3,224,68,1,13,40,3,115,54,0,13,64,2,104,162,0,13,80,2,182,165,16,13,88,3,118,54,0,13,112,2,169,165,16,13,136,3,119,54,0,13,146,2,151,
+165,16,13,176,3,123,65,2,13,180,2,135,165,16,13,208,2,112,162,0,13,216,3,112,54,0,13,218,2,119,165,16,14,44,2,120,65,2,14,177,2,17,165,16,14,208,2,64,154,0,14,210,2,10,165,16,14,245,2,3,165,16,15,26,
+2,5,165,16,15,63,2,9,165,16,15,72,2,144,54,32,15,86,3,179,54,0,15,88,2,143,54,32,15,102,2,8,165,16,15,104,2,140,54,32,15,120,2,135,54,32,15,128,3,191,65,2,15,136,2,216,165,18,15,160,2,1,59,0,
+15,172,3,183,54,0,15,216,2,114,59,0,16,48,66,176,154,1,16,160,2,176,154,0,17,0,1,208,162,0,17,88,3,44,165,18,17,112,3,119,54,0,17,212,3,112,54,0,17,232,2,44,249,1,18,32,1,232,24,1,18,32,3,44,
+165,18,18,52,3,115,54,0,18,92,2,62,165,16,18,96,1,168,24,5,18,128,2,73,165,16,18,162,2,89,165,16,18,192,3,48,166,6,18,195,2,105,165,16,18,224,3,48,166,6,18,234,2,113,165,16,18,248,2,56,194,0,19,0,
+3,48,166,6,19,8,1,112,166,6,19,32,3,48,166,5,19,160,1,48,162,0,19,160,1,136,24,3,20,32,1,168,24,3,20,72,3,4,192,0,20,160,1,200,24,3,20,208,3,52,54,0,21,0,3,49,54,0,21,16,1,124,162,0,
+21,48,3,48,54,0,21,60,2,96,165,16,21,78,2,48,165,16,21,128,1,241,166,4,21,128,2,29,165,16,21,175,2,48,165,16,21,195,2,96,165,16,22,16,1,48,162,0,22,32,1,96,24,6,22,96,1,232,24,2,22,144,0,224,
+24,2,22,228,1,181,165,16,23,12,1,181,165,16,23,52,1,171,165,16,23,64,0,160,24,1,23,91,1,156,165,16,23,132,1,137,165,16,23,166,1,121,165,16,23,224,1,116,165,16,24,8,1,192,68,1,24,8,1,240,68,1,24,12,
+1,116,165,16,24,32,0,116,165,22,24,60,1,118,165,16,24,108,1,120,165,16,24,128,65,56,194,0,24,156,1,122,165,16,24,200,0,116,165,22,24,204,1,116,165,16,24,252,1,116,165,16,25,0,65,64,194,0,25,44,1,117,165,16,
+25,64,65,56,194,0,25,80,3,112,165,20,25,92,1,122,165,16,25,112,0,116,165,21,25,128,65,96,194,0,25,128,3,115,249,2,25,140,1,123,165,16,25,188,1,118,165,16,25,236,1,116,165,16,26,248,0,192,68,2,26,248,0,224,
+68,2,26,248,2,176,68,2,26,248,2,240,68,2,27,96,0,136,24,3,27,112,2,136,24,3,27,160,0,200,24,3,27,224,1,8,24,3,28,0,66,192,162,0,28,32,1,72,24,3,28,96,1,136,24,3,28,160,1,200,24,3,28,224,
+2,8,24,3,29,64,2,8,24,3,29,88,2,104,165,22,29,100,2,88,165,22,29,112,2,72,165,21,29,120,4,118,59,0,29,124,2,56,165,20,29,136,2,40,165,19,29,160,3,32,162,0,29,224,2,4,24,1,29,248,4,176,68,2,
+30,0,2,104,165,16,30,8,3,112,68,0,30,24,67,104,194,1,30,32,4,180,54,0,30,64,68,80,194,1,30,72,3,64,68,0,30,96,67,48,194,1,30,96,68,48,194,1,30,160,2,160,162,0,30,216,2,255,59,0,31,48,67,8,
+28,3,31,100,4,128,165,21,31,112,2,180,165,20,31,128,3,192,171,0,31,168,3,24,73,0,31,168,3,24,17,12,31,192,3,208,171,0,32,16,3,10,28,3,32,32,4,176,54,0,32,72,3,144,54,32,32,88,3,142,54,32,32,104,
+3,139,54,32,32,120,3,134,54,32,32,128,3,80,194,0,32,136,3,130,54,32,32,208,3,112,59,0,33,53,3,116,165,16,33,88,3,125,165,16,33,122,3,136,165,16,33,128,4,140,159,0,33,156,3,151,165,16,33,190,3,168,165,16,
+33,226,3,177,165,16,34,72,3,80,166,6,35,52,3,32,166,6,35,66,4,117,165,16,35,103,4,126,165,16,35,120,4,8,24,2,35,134,4,141,165,16,35,165,4,157,165,16,35,198,4,174,165,16,35,236,4,182,165,16,35,240,3,128,
+162,0,36,20,4,182,165,16,36,58,4,182,165,16,36,97,4,182,165,16,36,134,4,181,165,16,37,96,4,162,13,0,37,132,4,96,125,3,37,132,4,120,125,3,37,132,4,144,125,3,37,168,4,80,75,0,37,212,4,80,125,1,37,212,
+4,112,125,2,255,255,0,0,0,0
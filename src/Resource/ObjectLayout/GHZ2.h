@@ -0,0 +1,23 @@
+0,64,2,178,54,64,0,230,0,255,59,0,0,240,2,177,166,4,1,16,2,177,166,6,1,48,65,8,28,3,1,48,2,177,166,6,1,128,0,191,165,19,1,128,1,240,171,0,1,168,1,24,73,0,1,168,1,24,17,12,1,192,1,192,
+171,0,2,14,1,10,28,3,2,72,1,144,54,32,2,80,2,160,188,0,2,92,1,142,54,32,2,112,1,137,54,32,2,112,2,160,188,1,2,132,1,130,54,32,2,144,2,160,188,1,2,152,1,126,54,32,2,176,2,160,188,1,2,208,
+2,160,188,1,2,240,0,88,165,68,2,240,1,88,65,2,2,240,1,112,59,0,2,240,2,160,188,2,3,56,2,181,166,3,3,248,2,240,68,2,4,48,2,88,162,0,4,64,3,0,192,0,4,112,1,0,159,0,4,128,2,200,24,1,
+4,248,3,50,59,0,5,8,2,240,68,16,5,48,65,8,28,3,5,100,2,104,165,21,5,112,1,0,165,20,5,128,1,240,171,0,5,144,3,208,54,64,5,168,1,24,73,0,5,168,1,24,17,12,5,176,2,176,192,0,5,192,1,192,
+171,0,5,200,3,64,21,6,6,14,1,10,28,3,6,32,3,208,54,64,6,84,1,144,54,32,6,104,1,139,54,32,6,124,1,133,54,32,6,144,1,127,54,32,6,144,66,184,192,0,6,160,3,96,24,3,6,164,1,121,54,32,6,176,
+3,208,54,64,6,240,1,112,59,0,7,8,2,176,68,0,7,32,3,128,24,3,7,64,3,208,54,64,7,80,0,208,162,0,7,160,64,240,162,0,7,160,3,160,24,3,7,172,3,208,54,48,7,208,2,16,162,0,7,220,3,208,54,32,
+7,244,3,208,54,32,8,0,1,176,59,0,8,8,3,240,68,0,8,52,1,36,166,4,8,96,1,161,165,16,8,106,1,221,165,16,8,116,3,52,165,66,8,116,3,176,59,0,8,134,2,13,165,16,8,180,2,41,165,16,8,199,2,173,
+165,16,8,232,1,200,21,8,8,232,2,48,165,16,8,234,2,183,165,16,9,18,2,181,165,16,9,28,2,41,165,16,9,56,3,136,194,0,9,61,2,174,165,16,9,72,2,13,165,16,9,91,2,147,165,16,9,96,2,64,165,64,9,96,
+2,107,165,64,9,102,1,221,165,16,9,119,1,161,165,16,9,136,3,88,194,0,9,180,1,252,54,0,9,200,3,120,194,0,10,24,3,72,194,0,10,44,66,8,28,3,10,104,2,176,171,0,10,160,2,144,171,0,10,168,2,24,73,0,
+10,168,2,24,17,12,10,216,2,224,171,0,11,16,2,8,28,3,11,88,67,176,65,16,11,144,2,24,165,16,11,144,2,64,165,16,11,145,2,104,165,16,11,152,2,144,165,16,11,184,2,174,165,16,11,184,67,144,65,16,11,232,2,181,
+165,16,12,25,2,181,165,16,12,32,3,112,59,0,12,104,3,80,194,0,12,180,3,38,194,0,13,0,3,88,194,0,13,24,1,240,165,19,13,36,1,224,165,18,13,48,1,208,165,17,13,60,1,192,165,16,13,61,2,96,165,16,13,68,
+2,62,165,16,13,68,2,130,165,16,13,92,2,35,165,16,13,128,1,241,166,2,13,128,2,28,165,16,13,128,3,80,159,0,13,160,1,240,165,19,13,160,2,35,165,16,13,172,1,224,165,18,13,184,1,208,165,17,13,188,2,62,165,16,
+13,188,2,130,165,16,13,196,1,192,165,16,13,196,2,96,165,16,14,48,67,56,65,0,15,0,2,180,165,16,15,40,2,180,165,16,15,77,2,166,165,16,15,98,2,134,165,16,15,103,2,97,165,16,15,116,2,31,166,5,15,240,2,112,
+59,0,16,84,2,48,165,17,16,96,2,208,54,0,16,160,2,136,24,10,16,208,3,112,159,0,16,212,2,16,165,17,16,224,2,208,54,0,17,148,2,48,165,17,17,160,2,208,54,0,17,224,2,136,24,10,18,20,2,24,165,17,18,32,
+2,208,54,0,18,96,2,136,24,10,18,128,2,32,162,0,18,148,2,24,165,17,18,160,2,208,54,0,19,16,2,108,249,1,19,84,2,24,165,17,19,96,2,208,54,0,19,160,2,136,24,10,19,192,2,64,162,0,19,212,2,48,165,17,
+19,224,2,208,54,0,20,8,2,240,68,0,21,24,2,180,165,16,21,32,66,176,192,0,21,66,2,170,165,16,21,104,2,152,165,16,21,142,2,134,165,16,21,187,2,119,165,16,21,196,0,76,165,65,21,212,0,64,165,69,21,212,65,69,
+65,2,21,228,0,76,165,65,22,80,1,80,166,6,22,160,1,176,192,0,22,176,65,160,194,1,22,248,1,240,68,18,22,248,2,32,68,18,22,248,2,240,68,2,22,248,3,48,68,2,22,248,3,112,68,2,22,248,3,176,68,2,22,248,
+3,240,68,2,23,16,4,0,166,4,23,32,3,192,162,0,23,96,2,56,194,1,23,144,3,112,162,0,23,160,2,0,159,0,23,208,1,254,59,0,23,224,3,240,154,0,24,8,3,240,68,16,24,16,3,112,194,0,24,32,3,176,54,0,
+24,40,4,48,59,0,24,48,66,8,28,3,24,100,1,192,165,21,24,128,2,192,171,0,24,140,4,208,54,64,24,160,67,176,192,0,24,168,2,24,73,0,24,168,2,24,17,12,24,192,2,160,171,0,24,200,4,72,21,6,25,8,3,176,
+68,0,25,16,2,8,28,3,25,28,4,208,54,64,25,143,2,24,165,16,25,143,2,61,165,16,25,143,2,96,165,16,25,148,2,133,165,16,25,160,4,136,24,1,25,167,2,163,165,16,25,172,4,208,54,64,25,200,2,180,165,16,25,244,
+2,181,165,16,25,248,3,32,68,18,26,8,4,176,68,0,26,8,4,240,68,1,26,29,2,182,165,16,26,48,66,240,154,1,26,128,4,119,59,0,26,160,2,240,154,0,26,240,4,16,162,0,26,248,4,176,68,2,27,80,4,64,162,0,
+27,148,3,119,54,48,27,160,3,16,194,0,27,220,3,114,54,48,28,8,2,0,68,1,28,144,3,240,162,0,28,160,4,112,154,0,28,224,3,224,162,0,29,56,68,40,65,16,29,160,4,7,166,6,29,228,4,3,54,0,29,248,4,64,
+68,2,29,248,4,128,68,2,29,248,4,192,68,2,31,56,3,112,125,3,31,96,3,80,125,1,31,96,3,112,125,3,31,96,3,162,13,0,31,136,3,112,125,3,31,172,3,80,75,0,31,212,3,112,125,2,255,255,0,0,0,0
@@ -0,0 +1,27 @@
+0,132,3,64,166,5,1,40,3,184,65,2,1,144,3,224,54,64,1,192,3,200,24,5,1,224,3,64,154,0,2,8,3,224,54,64,2,80,3,7,192,0,2,96,2,152,162,0,2,120,3,12,65,2,2,216,2,24,162,0,2,224,2,64,
+154,0,3,32,2,208,154,0,3,80,2,8,166,4,3,80,3,114,165,16,3,116,3,106,165,16,3,144,2,80,194,0,3,152,3,94,165,16,3,188,3,77,165,16,3,224,3,58,165,16,3,240,66,120,28,3,4,8,3,52,165,16,4,32,
+2,88,165,21,4,104,2,136,17,12,4,208,2,120,28,3,5,48,2,56,162,0,5,48,2,120,65,2,5,102,3,125,165,16,5,132,3,140,165,16,5,144,2,48,162,0,5,162,3,156,165,16,5,196,3,172,165,16,5,208,2,64,154,0,
+5,232,3,182,165,16,6,72,2,148,165,16,6,80,2,7,192,0,6,108,2,140,165,16,6,144,2,130,165,16,6,144,3,56,162,0,6,184,2,116,165,16,6,232,2,114,165,16,7,22,2,116,165,16,7,48,66,176,154,1,7,69,2,126,
+165,16,7,80,1,240,162,0,7,128,2,88,24,2,7,192,3,88,65,2,8,32,3,64,194,1,8,40,2,1,165,21,8,72,2,208,68,0,8,72,3,16,68,1,8,72,3,80,68,1,8,72,3,96,68,1,8,80,3,160,188,0,8,112,
+3,160,188,1,8,144,3,160,188,1,8,176,3,160,188,1,8,208,1,152,162,0,8,208,3,160,188,1,8,240,3,160,188,2,8,240,66,120,28,3,9,32,1,192,162,0,9,32,2,80,165,21,9,104,2,136,17,12,9,208,2,120,28,3,
+10,8,2,192,68,1,10,8,2,240,68,1,11,0,2,107,249,1,11,36,2,32,166,3,11,56,2,114,165,16,11,80,1,232,24,5,11,160,2,64,162,0,11,96,2,126,165,16,11,138,2,142,165,16,11,176,2,160,165,16,11,208,1,200,
+24,1,11,218,2,173,165,16,12,9,2,179,165,16,12,16,1,2,166,6,12,56,5,112,165,22,12,128,2,128,194,0,12,208,2,96,194,0,12,224,5,112,165,18,12,240,65,120,28,3,13,32,1,64,165,21,13,32,2,176,165,16,13,71,
+2,167,165,16,13,88,69,112,65,16,13,104,1,136,17,12,13,104,2,151,165,16,13,141,2,132,165,16,13,188,2,117,165,16,13,208,1,120,28,3,13,208,5,49,59,0,13,232,2,116,165,16,13,240,1,120,65,2,14,8,0,240,68,0,
+14,8,1,48,68,1,14,8,1,112,68,1,14,8,1,176,68,1,14,8,1,240,68,1,14,8,2,48,68,1,14,32,5,32,159,0,14,132,0,64,166,6,14,160,4,192,194,0,14,176,0,172,249,2,14,224,4,224,194,0,14,248,0,240,
+68,2,14,248,1,32,68,2,14,248,1,96,68,2,14,248,1,160,68,2,14,248,1,224,68,2,15,72,4,144,165,66,15,72,5,5,59,0,15,96,4,176,194,0,15,152,5,51,54,0,15,160,0,200,24,1,15,180,3,80,166,4,16,32,
+1,8,24,2,16,60,3,96,165,16,16,64,3,69,165,16,16,64,3,124,165,16,16,79,3,47,165,16,16,96,1,136,24,6,16,100,3,32,165,16,16,126,3,28,165,16,16,128,4,208,162,0,16,132,2,240,166,2,16,152,3,32,165,16,
+16,160,5,112,154,0,16,175,3,47,165,16,16,176,2,16,24,3,16,192,3,69,165,16,16,192,3,124,165,16,16,196,3,96,165,16,17,56,69,48,65,16,17,64,2,44,24,3,17,80,4,208,162,0,17,144,5,7,59,0,17,208,2,64,
+154,0,17,240,4,240,54,16,18,8,4,240,68,0,18,37,66,5,192,0,18,64,4,128,194,0,18,80,3,114,165,16,18,112,2,136,192,0,18,116,3,106,165,16,18,128,4,40,162,0,18,144,2,2,192,0,18,144,4,80,194,0,18,152,
+3,94,165,16,18,184,3,78,165,16,18,216,3,62,165,16,18,224,66,114,192,0,18,224,4,177,54,0,19,8,4,176,68,0,19,48,66,176,154,1,19,120,4,120,54,0,20,4,67,110,65,16,20,8,4,112,68,0,20,32,3,111,59,0,
+20,40,4,32,159,0,20,112,4,13,65,2,20,132,2,72,166,4,20,168,4,6,54,32,20,184,2,176,59,0,20,192,3,108,249,3,20,192,4,4,54,32,20,216,4,3,54,32,20,232,4,32,162,0,20,240,4,1,54,32,20,248,2,240,
+68,2,20,248,3,48,68,18,20,248,3,96,68,18,20,248,3,176,68,18,20,248,3,240,68,18,20,248,4,64,68,2,20,248,4,128,68,2,20,248,4,176,68,2,21,0,2,72,162,0,21,136,3,136,73,0,21,136,3,136,23,16,21,168,
+2,200,21,8,22,32,4,176,166,6,22,72,4,176,166,6,22,112,4,176,166,6,22,128,2,200,24,3,22,136,3,136,73,0,22,136,3,136,23,16,22,152,4,176,166,6,22,192,4,176,166,6,22,232,4,176,166,2,23,8,3,176,68,16,
+23,8,3,240,68,17,23,8,4,48,68,17,23,8,4,96,68,17,23,8,4,176,68,0,23,32,2,200,24,3,23,48,4,121,65,2,23,92,3,127,165,16,23,120,4,118,54,48,23,126,3,138,165,16,23,159,3,155,165,16,23,168,4,117,
+54,32,23,192,2,200,24,3,23,192,3,169,165,16,23,216,4,112,54,48,23,230,3,179,165,16,23,248,4,176,68,2,23,248,4,240,68,2,24,112,3,96,194,0,24,120,2,5,166,5,24,192,3,144,194,0,24,212,7,113,59,0,25,76,
+3,152,165,21,25,136,2,136,73,0,25,136,2,136,23,16,25,196,3,132,165,21,26,0,3,176,59,0,26,60,3,152,165,21,26,128,3,96,162,0,26,136,2,136,73,0,26,136,2,136,23,16,26,192,2,16,162,0,26,224,3,64,162,0,
+27,118,2,32,166,6,27,160,3,148,159,0,27,214,2,31,166,6,28,48,2,120,65,2,28,176,3,62,65,2,28,208,2,64,154,0,29,16,3,48,24,2,29,69,2,7,166,6,29,72,2,208,68,0,29,72,3,16,68,1,29,72,3,80,
+68,1,29,80,3,160,188,0,29,112,3,160,188,1,29,144,3,160,188,1,29,176,3,160,188,1,29,208,3,160,188,1,29,240,3,160,188,2,30,32,66,176,154,1,30,32,3,184,165,16,30,72,3,185,165,16,30,112,3,170,165,16,30,128,
+2,32,162,0,30,128,2,152,24,2,30,152,3,151,165,16,30,192,3,132,165,16,30,224,2,192,24,6,30,230,3,120,165,16,31,17,3,117,165,16,31,248,3,224,68,2,32,0,2,160,162,0,32,48,67,176,154,1,32,80,3,208,54,64,
+32,112,3,8,21,7,32,176,2,240,162,0,32,224,3,208,54,64,33,32,3,208,154,0,33,52,3,208,54,32,34,36,2,80,165,68,34,36,3,20,65,2,34,48,0,0,162,0,34,104,2,176,162,0,34,160,2,204,162,0,34,219,3,175,
+165,16,35,0,3,181,165,16,35,40,3,180,165,16,35,76,3,166,165,16,35,99,3,133,165,16,35,118,3,33,166,6,36,144,3,64,162,0,37,48,67,184,28,3,37,53,3,32,166,5,37,136,3,240,54,64,37,168,3,200,17,12,37,220,
+3,240,54,32,37,244,3,240,54,32,38,8,3,240,68,0,38,16,3,185,28,3,38,168,3,172,249,4,41,128,3,128,24,0,42,128,3,128,24,0,43,96,3,125,62,1,43,96,3,162,62,0,255,255,0,0,0,0
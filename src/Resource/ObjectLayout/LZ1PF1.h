@@ -0,0 +1 @@
+0,7,16,120,2,26,0,0,16,190,2,145,0,2,16,190,3,7,0,2,16,190,3,126,0,2,16,92,3,144,0,4,16,34,3,82,0,5,16,34,2,219,0,5,16,34,2,101,0,5
@@ -0,0 +1 @@
+0,7,18,126,2,128,0,16,18,206,3,5,0,18,18,206,3,138,0,18,18,206,4,15,0,18,18,167,4,110,0,19,18,50,4,15,0,20,18,50,3,138,0,20,18,50,3,5,0,20
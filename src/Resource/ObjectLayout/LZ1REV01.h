@@ -0,0 +1,18 @@
+0,112,0,16,97,48,1,24,0,180,165,18,2,172,0,176,173,0,2,232,0,116,165,18,3,176,0,208,173,0,4,224,1,16,173,0,5,16,1,241,166,6,5,48,2,16,173,0,5,80,2,16,173,0,5,112,1,48,87,213,5,240,0,240,
+166,4,5,240,1,248,50,0,6,8,1,160,214,224,6,64,1,248,100,128,7,16,1,144,165,65,7,32,1,48,214,241,7,32,1,248,100,128,7,40,1,144,165,16,7,48,2,16,173,0,7,80,0,241,166,6,7,80,1,80,165,65,7,144,
+1,168,50,1,7,240,1,48,97,48,8,128,1,16,173,0,8,208,1,16,173,0,9,16,2,241,166,6,9,32,1,16,173,0,9,64,2,248,100,128,9,176,65,112,172,12,9,176,1,152,100,129,9,176,2,128,172,6,9,192,1,8,82,7,
+9,248,2,160,214,226,10,16,2,248,50,2,10,32,130,48,54,48,10,32,66,152,172,6,10,32,3,12,97,19,10,80,3,24,100,128,10,92,2,80,165,68,10,160,130,112,54,48,10,160,3,72,97,19,10,168,2,56,100,128,10,192,3,56,
+100,129,10,224,2,16,172,6,10,240,2,216,50,3,10,240,2,240,97,48,11,8,2,224,214,227,11,80,1,240,54,64,11,228,1,240,54,64,12,32,131,48,54,48,12,32,4,80,97,19,12,32,4,248,100,129,12,64,4,88,100,128,12,76,
+131,16,54,0,12,96,0,176,54,48,12,124,131,16,54,0,12,128,4,76,97,19,12,160,131,112,54,48,12,172,131,16,54,0,12,192,4,184,87,212,12,220,131,16,54,0,12,224,0,144,173,0,13,48,68,112,172,10,13,64,4,248,100,129,
+13,92,4,76,165,19,13,208,4,136,172,10,13,224,4,248,100,129,14,96,4,64,87,181,14,144,0,84,165,16,14,200,3,240,165,18,15,56,5,108,249,1,15,80,3,128,87,181,15,88,1,16,101,7,15,88,1,32,101,9,15,104,65,48,
+101,8,15,136,65,64,101,8,15,160,69,16,173,0,15,168,65,80,101,8,15,176,4,248,100,128,15,184,2,176,165,18,15,192,4,16,214,244,15,200,65,96,101,8,15,208,5,168,150,2,15,216,5,112,165,17,15,232,65,112,101,8,16,8,
+65,128,101,8,16,24,5,144,165,17,16,32,130,16,54,0,16,47,2,76,99,127,16,47,3,135,99,127,16,48,4,248,100,129,16,80,3,48,97,48,16,80,5,216,150,2,16,88,3,80,165,18,16,96,4,48,97,48,16,112,2,128,99,128,
+16,112,3,48,97,48,16,118,2,44,99,127,16,139,3,178,99,127,16,144,3,48,97,48,16,160,5,232,100,128,16,177,2,102,99,127,16,177,3,141,99,127,16,192,3,248,100,129,16,208,5,248,50,133,16,224,130,16,54,0,16,240,2,104,
+50,4,16,240,2,123,97,48,16,240,3,248,65,0,17,24,5,160,214,229,17,80,5,220,165,65,17,112,5,188,165,65,17,176,5,188,165,65,17,208,5,220,165,65,18,32,68,96,224,0,18,62,4,23,99,127,18,63,2,211,99,127,18,112,
+133,200,150,2,18,127,2,144,99,127,18,128,3,0,99,129,18,193,2,213,99,127,18,200,4,96,99,127,18,204,6,208,54,64,18,208,5,248,150,2,18,240,2,128,226,1,19,16,131,208,54,32,19,32,4,244,54,1,19,48,131,176,54,32,
+19,48,67,232,172,8,19,68,4,152,165,65,19,80,2,48,226,1,19,80,131,160,54,32,19,80,133,200,150,2,19,84,4,88,165,65,19,192,3,80,165,18,19,240,3,176,97,48,19,240,5,248,150,2,20,16,3,48,165,20,20,32,67,144,
+173,0,20,48,2,48,113,49,20,48,2,144,97,39,20,48,5,248,65,0,20,84,2,148,165,17,20,148,2,132,165,17,20,160,2,160,173,0,20,184,3,16,165,18,20,208,2,240,113,49,20,208,4,48,97,39,20,212,2,116,165,17,21,32,
+2,16,173,0,21,48,2,48,113,49,21,48,2,144,97,39,21,80,2,16,173,0,21,116,2,92,165,17,21,144,1,184,50,8,21,144,2,160,173,0,21,208,1,160,172,10,21,212,2,116,165,17,21,232,1,160,214,232,22,0,1,80,214,249,
+22,16,1,144,165,17,22,16,1,168,165,16,22,16,2,176,173,0,22,48,2,48,113,49,22,48,2,144,97,39,22,80,1,240,173,0,22,112,1,224,173,0,22,144,1,168,50,9,22,176,1,112,97,48,22,176,2,136,50,7,22,232,2,32,
+214,231,22,240,1,16,97,48,22,240,1,48,97,48,23,0,1,16,173,0,23,48,1,16,173,0,23,80,1,48,97,48,23,80,2,120,100,129,23,136,1,248,150,0,23,152,65,152,150,0,23,160,65,48,214,250,23,176,1,108,50,10,23,240,
+1,241,166,6,26,80,0,204,125,3,26,80,0,232,13,0,26,88,0,180,125,3,26,104,0,156,125,3,26,128,0,144,125,2,26,160,0,144,75,0,26,240,0,144,125,1,255,255,0,0,0,0
@@ -0,0 +1,14 @@
+0,80,4,17,166,6,0,144,4,81,166,6,0,176,68,96,172,12,0,184,0,184,165,18,0,224,4,120,100,129,1,48,4,48,172,10,1,96,131,112,54,0,1,96,67,224,224,0,1,160,131,112,54,0,1,192,3,248,100,129,2,16,4,192,
+87,196,2,48,67,144,172,10,2,64,3,248,100,128,2,80,1,16,173,0,2,80,3,80,165,20,2,96,4,80,165,19,2,96,4,104,165,19,2,96,4,128,165,19,2,128,1,4,54,1,2,144,128,112,54,48,2,208,1,16,173,0,2,240,
+4,192,87,196,3,64,131,144,54,48,3,64,4,8,97,19,3,88,1,16,101,7,3,88,1,32,101,9,3,104,65,48,101,8,3,136,65,64,101,8,3,144,3,248,100,130,3,168,65,80,101,8,3,180,128,240,54,48,3,192,4,248,100,129,
+3,200,65,96,101,8,3,208,130,176,54,48,3,232,65,112,101,8,3,240,3,145,166,5,3,248,2,248,101,6,3,248,3,16,101,0,3,252,3,40,101,73,4,8,65,128,101,8,4,48,5,16,173,0,4,144,4,168,100,129,4,144,4,192,
+173,0,4,200,4,32,140,2,4,224,130,48,54,48,4,228,129,144,54,48,5,4,2,116,101,9,5,8,65,248,101,6,5,8,66,16,101,0,5,8,66,48,101,0,5,8,66,80,101,0,5,8,66,112,101,0,5,112,129,208,54,48,5,248,
+65,240,65,16,6,112,2,49,166,6,6,160,2,145,166,6,7,16,68,184,172,10,7,32,131,48,54,48,7,64,132,144,54,48,7,112,1,144,165,70,7,112,4,248,65,0,7,136,3,48,165,18,7,160,4,248,100,128,7,208,2,156,50,2,
+7,208,2,161,166,6,7,208,4,65,166,4,7,224,130,208,54,48,7,224,132,208,54,48,7,240,68,88,172,6,8,8,1,240,165,18,8,16,6,16,97,1,8,32,6,120,100,128,8,40,3,80,165,18,8,48,4,248,100,128,8,48,6,16,
+97,1,8,64,131,144,54,48,8,96,69,228,224,0,8,160,130,112,54,48,8,160,6,112,226,4,8,214,133,80,54,48,8,240,2,12,226,2,8,240,3,145,166,6,9,16,134,200,150,2,9,48,70,112,172,9,9,64,6,248,100,128,9,72,
+1,160,214,226,9,112,5,192,87,84,9,192,3,16,214,240,9,192,5,16,214,241,9,192,6,164,172,9,9,224,1,236,249,1,9,224,133,176,54,48,9,240,134,200,150,2,10,16,3,248,165,66,10,16,4,56,100,129,10,32,133,16,54,48,
+10,32,5,248,100,129,10,64,4,152,165,65,10,88,66,16,150,0,10,104,66,80,150,0,10,104,68,72,150,0,10,144,2,248,50,0,10,144,4,248,50,1,10,152,68,176,150,0,10,192,6,248,100,128,10,224,6,228,224,0,10,240,1,241,
+166,5,11,0,2,0,87,213,11,80,6,128,87,197,11,192,5,248,100,128,12,64,5,208,224,0,12,80,5,112,165,20,12,104,5,88,165,18,12,104,5,136,165,18,13,32,3,240,54,48,13,32,132,48,54,48,13,44,68,141,99,127,13,44,
+69,210,99,127,13,104,68,128,99,130,13,109,3,171,99,127,13,109,4,212,99,127,13,120,3,132,165,20,13,128,5,248,100,129,13,160,3,128,99,131,13,160,4,48,54,48,13,160,132,112,54,48,13,165,68,141,99,127,13,165,69,211,99,127,
+13,232,5,240,54,0,13,228,3,173,99,127,13,228,4,211,99,127,16,80,3,204,125,3,17,80,3,232,13,0,16,88,3,180,125,3,16,104,3,156,125,3,17,128,3,144,125,2,17,144,3,144,75,0,17,216,3,144,125,1,255,255,0,0,
+0,0
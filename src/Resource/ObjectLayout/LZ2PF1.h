@@ -0,0 +1 @@
+0,7,13,34,4,131,0,33,13,156,4,130,0,32,13,174,4,234,0,35,13,174,5,100,0,35,13,174,5,221,0,35,13,52,5,222,0,34,13,34,5,118,0,33,13,34,4,252,0,33
@@ -0,0 +1 @@
+0,7,13,98,3,162,0,48,13,212,3,162,0,49,13,238,3,250,0,50,13,238,4,108,0,50,13,238,4,221,0,50,13,124,4,222,0,51,13,98,4,134,0,48,13,98,4,20,0,48
@@ -0,0 +1,2 @@
+0,11,12,173,2,66,0,65,13,45,2,66,0,65,13,172,2,66,0,65,13,222,2,143,0,66,13,222,3,14,0,66,13,222,3,141,0,66,13,176,3,222,0,67,13,49,3,222,0,67,12,178,3,222,0,67,12,82,3,191,0,68,12,82,
+3,64,0,68,12,82,2,193,0,68
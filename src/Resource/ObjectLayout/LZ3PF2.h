@@ -0,0 +1 @@
+0,8,18,82,2,10,0,80,18,210,2,10,0,81,19,82,2,10,0,81,19,210,2,10,0,81,19,222,2,126,0,82,19,158,2,190,0,83,19,30,2,190,0,83,18,158,2,190,0,83,18,82,2,138,0,80,255,255,0,0,0,0
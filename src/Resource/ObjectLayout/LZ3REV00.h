@@ -0,0 +1,24 @@
+0,184,2,180,165,18,1,48,3,16,173,0,1,112,3,16,173,0,1,176,3,16,173,0,1,240,3,16,173,0,2,88,3,16,101,7,2,88,3,32,101,9,2,104,67,48,101,8,2,136,67,64,101,8,2,168,67,80,101,8,2,200,67,96,
+101,8,2,232,67,112,101,8,3,8,67,128,101,8,4,8,67,248,101,2,4,80,2,241,166,6,4,144,2,184,50,15,5,8,68,248,101,4,5,120,5,16,101,0,5,120,5,48,101,0,5,120,5,80,101,0,5,120,5,112,101,0,5,128,
+5,112,101,9,5,248,2,248,101,3,6,8,69,248,101,4,6,48,1,193,166,4,6,72,4,112,165,21,6,72,4,136,165,21,6,88,2,240,101,169,6,96,4,88,165,19,6,96,4,160,165,19,6,192,5,112,214,240,6,240,3,224,97,48,
+6,248,1,248,101,4,7,8,70,248,101,4,7,16,68,248,172,12,7,64,67,224,214,250,7,112,3,120,50,10,7,112,3,144,97,48,7,192,4,128,87,196,7,208,5,248,100,129,7,240,4,248,50,0,8,0,0,248,101,9,8,8,64,240,
+101,0,8,8,71,248,101,5,8,16,3,145,166,6,8,32,70,120,172,12,8,32,70,224,172,12,8,48,5,248,150,2,8,80,6,16,97,48,8,112,5,248,150,2,8,112,6,248,100,129,8,144,6,16,97,1,8,176,5,248,150,2,8,208,
+6,16,97,48,8,208,6,248,100,129,8,224,3,244,54,1,8,240,5,248,150,2,8,240,6,160,172,12,9,16,2,240,54,0,9,32,5,248,100,128,9,80,5,128,87,197,9,80,6,240,173,0,9,96,3,0,87,101,9,96,3,244,54,1,
+9,160,3,248,100,129,9,176,2,240,54,0,9,176,6,128,173,0,9,208,4,248,100,128,9,224,3,244,54,1,10,0,3,0,87,69,10,48,2,81,166,6,10,80,2,240,54,0,10,80,5,16,173,0,10,160,3,0,87,101,10,160,4,248,
+100,129,10,168,4,80,150,0,11,8,6,96,12,2,11,32,2,208,54,48,11,80,3,177,166,2,11,100,2,208,173,0,11,112,129,208,54,48,11,112,3,177,166,6,11,144,3,177,166,6,11,160,2,176,173,0,11,176,3,177,166,6,11,208,
+129,176,54,48,11,208,3,177,166,6,11,224,2,144,173,0,12,64,68,112,214,246,12,92,3,212,99,127,12,95,2,163,99,127,12,96,4,184,100,128,12,144,4,200,50,1,12,152,4,80,54,0,12,176,4,56,65,0,12,177,2,79,99,127,
+12,216,4,32,54,0,12,240,3,248,50,6,12,240,5,16,173,0,13,0,2,128,99,132,13,8,4,160,214,225,13,72,3,240,54,64,13,128,2,128,99,132,13,144,4,208,173,0,13,180,3,240,54,48,13,212,2,76,99,127,13,212,3,212,
+99,127,14,32,2,208,54,48,14,144,3,161,166,6,14,144,4,168,100,128,14,160,2,144,54,48,14,224,3,56,100,128,14,240,2,113,166,5,15,32,6,96,11,4,15,176,6,72,54,16,15,240,6,184,54,16,17,32,4,144,54,48,17,32,
+6,96,11,4,17,96,4,184,100,128,17,144,4,144,165,20,17,176,6,72,54,16,17,208,4,33,166,5,17,208,4,248,50,2,17,224,6,128,11,4,18,8,4,160,214,226,18,24,2,240,54,0,18,64,4,248,100,128,18,80,6,104,54,16,
+18,92,2,179,99,127,18,93,2,20,99,127,18,112,6,112,97,48,18,144,4,172,249,1,18,204,6,208,54,64,18,240,1,184,50,14,18,240,1,208,97,48,18,240,1,240,97,48,19,0,2,128,99,133,19,32,2,240,54,48,19,32,4,16,
+87,38,19,48,69,128,172,12,19,80,65,136,54,16,19,80,65,184,54,16,19,80,65,232,54,16,19,128,2,128,99,133,19,160,3,48,54,48,19,160,4,80,87,38,19,176,5,248,100,129,19,212,2,20,99,127,19,212,2,179,99,127,20,0,
+4,248,100,128,20,32,4,16,87,38,20,32,6,96,11,4,20,96,2,16,173,0,20,97,5,160,172,12,20,112,69,192,172,8,20,128,2,16,173,0,20,160,2,16,173,0,20,160,4,80,87,38,20,160,5,248,100,128,20,176,6,72,54,16,
+20,192,2,16,173,0,20,224,2,16,173,0,20,240,5,241,166,6,21,16,6,128,11,4,21,32,4,224,224,0,21,88,2,16,101,7,21,88,2,32,101,9,21,104,66,48,101,8,21,112,5,209,166,6,21,112,6,104,54,16,21,128,5,80,
+172,12,21,136,66,64,101,8,21,144,3,177,166,6,21,160,69,16,214,243,21,168,66,80,101,8,21,184,129,240,54,48,21,192,5,88,50,3,21,200,66,96,101,8,21,208,3,248,100,128,21,232,66,112,101,8,22,8,66,128,101,8,22,32,
+130,48,54,48,22,64,135,144,54,48,22,96,4,248,65,0,22,128,6,56,50,7,22,128,6,80,97,48,22,160,4,248,100,128,22,160,7,248,100,128,22,192,135,112,54,48,22,208,7,72,65,0,22,224,130,144,54,48,22,240,4,113,166,4,
+23,8,66,248,101,2,23,32,7,248,100,128,23,32,130,112,54,48,23,152,6,160,214,231,23,192,6,248,100,128,24,8,67,248,101,3,24,8,68,240,101,0,24,8,4,240,101,9,24,16,131,112,54,48,24,16,70,112,173,0,24,48,70,144,
+173,0,24,80,4,236,249,2,24,80,6,48,97,48,24,128,5,208,97,48,24,144,5,152,50,9,24,144,5,176,97,48,24,144,5,240,97,48,24,160,6,248,100,128,24,192,69,16,214,249,24,192,5,48,97,48,24,208,6,232,224,0,24,224,
+5,48,97,48,24,224,134,144,54,48,24,240,132,16,54,64,25,16,3,240,113,49,25,16,4,240,97,39,25,112,3,64,113,49,25,112,4,240,97,39,25,144,5,16,173,0,25,160,131,80,54,48,25,240,3,112,113,17,25,240,4,240,97,39,
+26,64,2,16,173,0,26,208,2,80,173,0,27,32,2,16,173,0,27,96,0,16,173,0,27,192,8,16,214,248,27,192,0,48,97,48,27,224,0,48,97,48,28,0,0,16,173,0,28,16,5,241,166,4,30,16,69,48,226,3,30,48,65,208,
+226,3,30,48,2,208,97,48,30,48,68,224,226,3,30,72,1,128,150,0,30,72,3,128,150,0,30,72,4,128,150,0,30,80,66,208,226,3,30,88,65,48,150,0,30,88,67,48,150,0,30,88,68,48,150,0,30,152,2,176,150,0,30,176,
+2,80,226,3,30,216,65,128,150,0,30,216,67,128,150,0,32,208,0,187,62,1,32,208,0,224,62,0,255,255,0,0,0,0
@@ -0,0 +1,14 @@
+0,152,2,72,165,18,2,80,2,56,165,16,2,104,2,40,165,18,2,128,2,168,47,1,2,176,2,56,165,16,3,80,2,56,165,16,3,104,2,40,165,18,3,128,2,168,47,41,3,128,2,184,84,1,3,176,2,56,165,16,4,0,2,48,
+162,0,4,32,2,104,248,0,4,80,2,56,165,16,4,104,2,40,165,18,4,128,2,168,47,1,4,176,2,56,165,16,5,32,2,176,47,34,5,160,2,48,47,34,5,160,2,48,47,34,6,16,1,168,248,0,6,144,1,224,19,48,6,224,
+1,232,47,1,6,224,1,248,84,2,7,32,1,112,162,0,7,48,1,224,19,66,7,152,1,80,165,17,7,160,1,232,47,35,8,48,2,209,166,6,8,80,2,209,166,6,8,112,1,232,165,64,8,112,2,209,166,6,8,136,2,0,165,64,
+8,160,2,24,165,64,8,184,2,48,165,64,8,215,2,72,165,64,9,32,2,232,47,43,9,88,2,64,165,17,9,152,2,88,165,17,9,160,2,200,47,33,10,16,5,80,166,4,10,96,3,124,49,128,10,120,3,208,179,0,10,128,5,76,
+249,1,10,208,3,248,50,128,11,0,2,248,84,2,11,16,3,108,213,0,11,32,2,232,47,21,11,52,5,0,54,18,11,64,3,244,54,1,11,96,3,108,213,0,11,96,5,16,113,49,11,96,5,167,48,1,11,160,3,108,213,0,11,208,
+3,240,70,0,12,0,2,232,47,21,12,0,2,248,84,2,12,20,3,240,165,17,12,80,5,48,70,10,12,96,3,152,48,2,12,112,5,48,70,2,12,128,5,232,84,2,12,144,5,48,70,10,12,148,3,240,165,17,12,208,5,32,70,0,
+12,224,2,232,47,21,12,224,3,152,48,1,12,240,5,48,70,2,13,0,2,248,84,2,13,16,5,48,70,10,13,20,3,240,165,17,13,48,5,48,70,2,13,80,5,48,70,10,13,96,3,152,48,2,13,112,5,48,70,1,13,128,5,232,
+84,2,13,144,5,48,70,0,13,148,3,240,165,17,13,176,5,48,70,2,13,192,2,232,47,21,13,192,2,248,84,1,13,208,5,48,70,10,13,224,3,152,48,1,13,240,5,48,70,2,14,16,5,48,70,0,14,48,5,48,70,1,14,80,
+4,177,166,6,14,80,5,48,70,2,14,112,2,232,165,64,14,112,4,177,166,6,14,112,5,48,70,2,14,128,5,232,84,2,14,136,3,0,165,64,14,144,4,177,166,2,14,160,3,24,165,64,14,176,4,177,166,6,14,176,5,48,70,2,
+14,184,3,48,165,64,14,208,4,177,166,6,14,208,5,48,70,1,14,216,3,72,165,64,14,240,5,48,70,2,15,32,3,216,47,35,15,80,5,48,70,2,15,96,3,152,47,32,15,112,3,93,166,4,15,112,5,16,70,1,15,176,5,16,
+70,2,16,8,5,80,165,19,16,16,3,208,70,0,16,48,3,44,213,0,16,48,4,60,49,17,16,80,3,48,70,0,16,80,3,92,49,35,16,112,3,44,213,0,16,112,3,240,113,17,16,144,4,8,82,65,16,192,3,60,49,2,17,16,
+4,64,113,0,17,48,4,88,82,65,18,80,2,112,162,0,18,148,2,104,165,17,18,160,2,234,19,65,18,212,2,92,165,17,18,224,2,208,47,41,18,224,2,252,84,2,19,16,2,80,165,17,19,32,2,224,19,66,19,160,2,208,47,33,
+20,104,2,88,165,18,20,128,2,168,47,21,20,212,2,32,165,17,21,32,2,200,47,33,21,84,2,96,165,17,21,160,2,208,47,41,21,224,2,168,248,0,22,160,2,64,162,0,22,168,2,152,165,18,22,192,2,232,47,21,24,96,2,112,
+125,3,24,96,2,144,13,0,24,112,2,88,125,3,24,136,2,72,125,3,24,156,2,64,125,2,24,176,2,64,75,0,24,240,2,88,125,1,255,255,0,0,0,0
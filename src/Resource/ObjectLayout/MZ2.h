@@ -0,0 +1,19 @@
+1,32,2,232,47,35,1,84,2,88,165,17,1,160,2,240,47,43,2,0,2,168,248,0,2,32,4,176,19,55,2,80,5,192,206,0,2,128,4,112,19,55,2,208,2,64,162,0,2,208,4,32,19,53,2,224,5,80,179,129,2,232,68,192,
+54,16,3,0,5,48,54,48,3,32,2,208,19,65,3,48,4,144,70,0,3,64,5,80,54,48,3,80,4,144,70,0,3,80,5,224,70,0,3,112,2,96,162,0,3,128,2,232,47,21,3,128,2,248,84,2,3,128,4,208,76,1,3,128,
+4,232,84,2,3,136,5,212,165,18,3,144,4,112,70,0,3,224,2,208,19,66,4,64,67,200,248,0,4,64,4,144,70,0,4,80,5,224,70,0,4,96,4,144,70,0,4,112,3,76,213,0,4,128,4,232,84,2,4,136,5,212,165,18,
+4,144,3,208,166,6,4,176,3,208,166,4,4,208,3,140,213,0,4,240,4,48,70,0,5,16,4,144,179,0,5,80,3,12,165,20,5,80,5,224,70,0,5,112,3,80,70,0,5,144,3,80,70,0,5,144,4,44,213,0,5,160,5,212,
+54,1,6,15,3,88,50,1,6,24,5,144,165,18,6,48,5,208,70,0,6,52,3,84,165,17,6,64,4,40,48,20,6,112,3,16,70,0,7,16,2,177,166,6,7,40,69,16,54,82,7,48,4,140,213,0,7,128,2,156,249,5,7,176,
+4,140,213,0,7,184,5,16,54,82,7,200,4,244,165,18,7,232,69,16,54,82,8,48,4,140,213,0,8,112,3,80,113,17,8,176,3,104,82,65,8,176,4,140,213,0,8,192,5,232,84,1,9,16,3,16,113,17,9,48,3,40,82,65,
+9,48,69,104,21,5,9,72,67,200,248,0,9,112,4,176,166,6,9,128,5,232,84,2,9,144,2,224,19,65,9,144,4,176,166,2,9,176,4,176,166,6,9,192,2,208,47,33,9,192,2,248,84,1,9,240,2,224,19,49,10,0,5,104,
+21,4,10,20,2,108,165,17,10,80,2,144,19,65,10,104,3,88,165,18,10,128,2,176,47,34,10,128,2,184,84,1,10,128,5,232,84,2,10,176,2,144,19,49,10,208,69,104,21,5,10,212,2,108,165,17,10,232,68,124,54,16,11,16,
+3,240,70,0,11,16,4,104,82,2,11,32,2,156,47,41,11,84,1,252,165,17,11,128,4,152,84,2,11,128,5,232,84,2,11,160,2,40,19,49,11,160,2,72,84,0,11,160,5,104,21,4,11,212,1,172,165,17,12,8,4,20,165,18,
+12,32,1,224,47,34,12,32,4,64,113,49,12,84,1,108,165,17,12,128,4,152,84,2,12,160,1,224,47,42,12,176,1,80,162,0,13,8,4,20,165,18,13,32,4,64,113,49,13,80,5,16,70,0,13,96,5,72,248,0,13,112,5,16,
+70,0,13,128,4,152,84,2,13,144,5,16,70,0,13,176,1,160,248,0,13,176,5,16,70,0,13,224,5,72,248,0,14,0,4,152,84,0,14,48,4,80,179,0,14,56,4,128,54,16,14,88,69,80,65,16,14,96,1,96,162,0,14,128,
+1,156,248,0,14,176,4,216,50,0,14,192,1,120,162,0,14,208,4,240,70,0,14,208,5,16,70,0,14,208,5,48,70,0,14,208,5,80,70,0,14,208,5,112,70,0,14,208,5,144,70,0,14,224,5,72,48,4,14,240,4,16,166,4,
+14,240,4,48,70,0,14,240,4,240,70,0,14,240,5,16,70,0,14,240,5,48,70,0,14,240,5,80,70,0,14,240,5,112,70,0,14,240,5,144,70,0,15,48,2,208,166,6,15,64,2,44,213,0,15,80,2,208,166,6,15,112,2,76,
+213,0,16,16,5,96,166,5,16,16,5,128,70,0,16,16,5,144,70,0,16,32,2,232,47,35,16,48,5,144,70,0,16,80,5,48,70,0,16,80,5,208,76,1,16,128,5,232,84,2,16,160,2,216,47,34,16,192,5,208,76,1,16,208,
+5,184,82,2,17,8,4,144,165,19,17,16,2,180,165,16,17,48,2,187,165,16,17,77,2,201,165,16,17,80,4,200,248,0,17,80,5,160,70,0,17,98,2,224,165,16,17,120,5,160,165,18,17,121,2,248,165,16,17,128,5,232,84,2,
+17,144,3,48,81,0,17,144,3,80,81,0,17,144,3,112,81,0,17,144,4,44,213,0,17,176,3,48,81,0,17,176,3,80,81,0,17,176,3,112,81,0,17,208,3,48,81,0,17,208,3,80,81,0,17,208,3,112,81,0,17,208,5,160,
+70,0,17,240,3,48,81,0,17,240,3,80,81,0,17,240,3,112,81,0,17,240,3,208,81,0,17,240,4,144,166,4,17,248,5,160,165,18,18,16,3,208,81,0,18,16,3,240,81,0,18,48,3,208,81,0,18,48,3,240,81,0,18,80,
+5,160,70,0,18,112,4,16,70,0,18,128,5,232,84,2,19,240,5,44,213,0,20,48,4,60,49,17,20,56,5,80,248,0,20,176,4,136,248,0,21,48,3,156,49,18,22,48,3,60,49,18,22,208,3,28,49,18,24,96,2,112,125,3,
+24,96,2,160,13,0,24,112,2,88,125,3,24,136,2,72,125,3,24,156,2,64,125,2,24,176,2,64,75,0,24,240,2,88,125,1,255,255,0,0,0,0
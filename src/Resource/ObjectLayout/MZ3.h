@@ -0,0 +1,22 @@
+0,16,4,16,70,0,0,16,4,48,70,0,0,16,4,80,70,0,0,16,4,208,70,0,0,16,4,240,70,0,0,32,3,176,19,55,0,48,4,112,81,0,0,48,4,144,81,0,0,48,4,176,81,0,0,80,4,112,81,0,0,80,4,144,
+81,0,0,80,4,176,81,0,0,128,3,112,19,55,0,160,5,244,54,1,0,208,3,32,19,37,1,16,4,240,166,4,1,16,6,208,166,6,1,32,1,204,47,33,1,80,6,16,81,0,1,80,6,48,81,0,1,80,6,80,81,0,1,84,
+1,48,165,17,1,96,3,16,113,49,1,96,3,167,48,1,1,96,4,153,48,1,1,144,5,72,50,1,1,144,5,96,70,0,1,160,1,204,47,41,1,160,6,104,48,20,1,224,4,153,48,2,2,32,3,168,83,1,2,64,4,32,84,1,
+2,64,4,232,83,1,2,64,70,208,248,0,2,96,3,168,83,1,2,128,4,232,83,1,2,144,3,28,49,35,2,208,3,28,49,35,2,208,4,108,213,0,2,208,4,240,70,0,2,240,1,80,162,0,2,240,6,144,179,0,3,16,5,76,
+248,0,3,32,4,140,213,0,3,56,6,168,165,19,3,128,6,232,84,2,3,176,6,160,70,0,3,224,1,168,248,0,3,240,6,168,165,20,4,32,4,168,83,1,4,48,1,80,162,0,4,48,2,156,49,2,4,112,4,28,49,35,4,128,
+4,232,84,2,4,128,6,232,84,2,4,144,6,128,70,0,4,144,6,160,70,0,4,176,4,16,70,2,4,192,1,96,162,0,4,200,6,168,165,20,4,240,4,28,49,35,4,240,5,160,113,0,5,16,5,184,82,1,5,16,6,16,70,0,
+5,48,1,184,165,16,5,48,4,16,70,2,5,48,6,16,70,0,5,64,2,200,248,0,5,84,1,206,165,16,5,112,1,236,165,16,5,112,4,28,49,35,5,128,4,232,84,2,5,128,6,232,84,2,5,140,2,8,165,16,5,144,5,128,
+70,0,5,171,2,37,165,16,5,176,5,128,70,0,5,192,4,16,70,2,5,202,2,67,165,16,5,244,2,83,165,16,6,24,4,84,165,18,6,32,2,232,47,35,6,32,3,176,19,71,6,64,6,232,84,1,6,112,4,20,165,16,6,128,
+3,112,19,71,6,144,3,212,165,16,6,152,6,192,54,16,6,160,2,204,47,33,6,176,3,180,165,16,6,192,5,168,248,0,6,208,3,32,19,69,6,212,3,148,165,17,7,16,3,96,70,0,7,32,5,244,54,1,7,80,5,80,70,0,
+7,84,5,212,165,17,7,112,5,80,70,0,7,160,5,244,54,1,7,208,5,80,70,0,7,232,5,212,165,18,7,240,2,176,166,6,7,240,5,80,70,0,8,32,6,176,19,55,8,72,71,80,54,82,8,80,5,224,70,0,8,128,6,112,
+19,55,8,136,71,144,54,82,8,160,5,212,54,1,8,208,6,32,19,53,9,48,5,60,49,17,9,64,71,192,248,0,9,184,71,208,65,16,9,208,5,60,49,17,10,192,7,232,84,1,11,32,7,104,21,4,11,128,7,208,19,80,11,128,
+7,232,84,2,11,144,5,176,166,2,11,224,71,104,21,4,12,64,7,208,19,80,12,128,7,232,84,2,12,160,7,104,21,4,13,16,6,241,166,4,13,160,6,236,249,1,13,236,71,16,54,82,14,0,7,72,248,16,14,40,3,176,19,71,
+14,48,4,49,38,6,14,72,68,80,54,82,14,136,3,112,19,71,14,136,68,144,54,82,14,200,68,208,54,82,14,208,3,40,19,69,14,224,6,244,54,1,15,48,4,156,49,17,15,96,6,152,48,1,15,144,4,140,213,0,15,148,6,242,
+165,17,15,160,3,84,54,1,15,208,6,80,70,0,15,212,6,160,165,17,15,224,4,140,213,0,15,224,6,212,54,1,15,232,69,120,54,16,15,240,6,80,70,0,16,8,5,20,165,18,16,20,6,242,165,17,16,48,5,64,113,17,16,64,
+3,60,49,35,16,96,6,154,48,2,16,128,5,152,84,2,16,148,6,242,165,17,16,152,3,12,213,0,16,152,4,12,213,0,16,192,3,148,54,1,16,192,4,12,213,0,16,208,6,80,70,0,16,212,6,160,165,17,16,224,3,12,213,0,
+16,224,6,212,54,1,16,232,4,12,213,0,16,240,6,80,70,0,17,8,5,20,165,18,17,16,6,240,81,0,17,16,7,16,81,0,17,48,5,64,113,17,17,48,6,240,81,0,17,48,7,16,81,0,17,64,3,60,49,35,17,96,7,16,
+113,49,17,96,7,167,48,1,17,128,5,152,84,2,17,152,4,12,213,0,17,160,3,12,213,0,17,192,3,148,54,1,17,192,4,12,213,0,17,232,4,12,213,0,17,240,3,12,213,0,18,0,5,152,84,0,18,8,5,20,165,18,18,16,
+7,184,82,2,18,48,5,64,113,17,18,48,7,144,70,0,18,80,3,28,49,35,18,128,5,152,84,2,18,128,6,32,84,2,18,128,7,208,76,1,18,128,7,232,84,2,18,176,3,28,49,35,18,208,7,104,82,2,18,240,6,240,166,4,
+19,16,2,240,70,0,19,16,5,80,179,0,19,16,7,16,70,0,19,48,7,144,70,0,19,84,3,64,54,18,19,128,7,232,84,2,19,160,68,236,248,0,19,232,2,168,165,18,20,24,7,192,54,16,20,56,6,60,213,0,20,72,69,80,
+54,82,20,80,4,140,213,0,20,80,7,16,165,20,20,88,6,60,213,0,20,104,6,112,165,18,20,120,6,60,213,0,20,136,69,144,54,82,20,152,6,60,213,0,20,160,4,140,213,0,20,168,2,216,19,64,20,184,4,244,165,18,20,184,
+6,60,213,0,20,192,2,252,84,1,20,200,69,208,54,82,20,216,2,216,19,81,21,24,7,82,165,18,21,48,6,60,49,17,21,80,2,160,19,65,21,128,2,168,47,42,21,128,2,184,84,1,21,144,5,144,70,0,21,176,2,160,19,65,
+21,176,5,144,70,0,21,176,5,188,49,17,21,208,5,144,70,0,22,64,2,104,249,2,23,192,2,248,84,1,24,160,2,248,84,1,26,0,2,124,62,1,26,0,2,161,62,0,255,255,0,0,0,0
@@ -0,0 +1 @@
+0,7,14,20,3,112,0,0,14,90,3,77,0,1,14,160,3,42,0,1,14,231,3,7,0,1,14,239,3,64,0,2,14,169,3,99,0,3,14,99,3,134,0,3,14,28,3,169,0,3
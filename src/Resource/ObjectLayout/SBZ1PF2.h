@@ -0,0 +1 @@
+0,7,15,20,2,224,0,16,15,90,2,189,0,17,15,160,2,154,0,17,15,231,2,119,0,17,15,239,2,176,0,18,15,169,2,211,0,19,15,99,2,246,0,19,15,28,3,25,0,19
@@ -0,0 +1 @@
+0,7,16,20,2,112,0,32,16,90,2,77,0,33,16,160,2,42,0,33,16,231,2,7,0,33,16,239,2,64,0,34,16,169,2,99,0,35,16,99,2,134,0,35,16,28,2,169,0,35
@@ -0,0 +1 @@
+0,7,15,20,5,112,0,48,15,90,5,77,0,49,15,160,5,42,0,49,15,231,5,7,0,49,15,239,5,64,0,50,15,169,5,99,0,51,15,99,5,134,0,51,15,28,5,169,0,51
@@ -0,0 +1 @@
+0,7,27,20,6,112,0,64,27,90,6,77,0,65,27,160,6,42,0,65,27,231,6,7,0,65,27,239,6,64,0,66,27,169,6,99,0,67,27,99,6,134,0,67,27,28,6,169,0,67
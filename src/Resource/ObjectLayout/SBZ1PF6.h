@@ -0,0 +1 @@
+0,7,28,20,5,224,0,80,28,90,5,189,0,81,28,160,5,154,0,81,28,231,5,119,0,81,28,239,5,176,0,82,28,169,5,211,0,83,28,99,5,246,0,83,28,28,6,25,0,83,255,255,0,0,0,0
@@ -0,0 +1,29 @@
+0,208,4,176,165,20,1,240,4,208,113,21,2,40,4,140,165,18,2,64,4,172,105,2,2,144,4,208,113,21,2,240,4,208,113,21,3,40,4,140,165,18,3,64,4,172,105,1,3,144,4,208,113,21,4,21,4,134,109,67,4,128,4,104,
+248,0,5,11,68,80,109,67,5,48,4,88,50,0,5,112,3,145,166,4,5,144,4,112,102,0,5,148,4,192,165,70,5,220,5,172,165,18,5,240,3,192,113,19,6,32,3,167,105,128,6,64,3,167,105,128,6,80,4,7,105,128,6,96,
+5,248,113,112,6,96,6,120,113,112,6,96,6,248,113,112,6,112,4,7,105,128,6,144,4,103,105,128,6,152,3,135,105,128,6,160,6,24,112,0,6,160,6,152,112,0,6,160,7,24,112,0,6,176,4,103,105,128,6,184,3,135,105,128,
+7,0,5,216,113,23,7,0,6,88,113,23,7,0,6,216,113,23,7,8,4,172,42,0,7,56,4,172,165,22,7,144,3,76,248,0,7,186,135,135,109,67,8,56,7,172,165,22,8,80,3,76,248,0,8,96,4,248,113,112,8,96,5,120,
+113,112,8,96,5,248,113,112,8,160,5,24,112,0,8,160,5,152,112,0,8,160,6,24,112,0,9,0,4,216,113,23,9,0,5,88,113,23,9,0,5,216,113,23,9,16,3,176,108,192,9,48,3,8,108,0,9,48,3,241,166,6,9,56,
+71,176,65,16,9,80,2,200,108,64,9,80,3,241,166,6,9,84,7,144,165,17,9,160,66,144,223,0,9,160,7,96,107,52,9,192,134,120,110,8,9,192,6,168,248,0,9,224,7,48,113,225,9,240,2,144,223,0,10,21,2,136,109,67,
+10,32,7,96,107,36,10,48,6,168,248,0,10,64,2,144,223,0,10,64,134,120,110,8,10,84,7,144,165,17,10,160,7,96,107,52,10,208,6,136,248,0,10,224,7,48,113,225,11,16,2,104,108,0,11,16,4,241,166,4,11,32,7,96,
+107,36,11,48,2,104,108,0,11,56,6,128,42,0,11,80,5,8,108,64,11,80,5,136,108,192,11,80,6,8,108,64,11,84,7,144,165,17,11,112,2,167,108,64,11,144,2,167,108,64,11,160,7,48,113,97,11,160,7,96,107,52,11,176,
+5,72,108,0,11,176,5,200,108,128,11,176,6,72,108,0,11,240,2,135,108,128,12,16,2,135,108,128,12,16,3,103,108,128,12,48,2,199,108,192,12,48,3,103,108,128,12,64,4,232,110,8,12,80,2,199,108,192,12,112,3,40,108,64,
+12,112,3,168,108,192,12,144,3,40,108,64,12,144,3,168,108,192,12,160,4,236,249,1,12,176,2,232,108,0,12,208,2,232,108,0,12,208,7,146,165,20,13,0,4,232,110,8,13,0,7,192,106,3,13,84,5,16,165,17,13,96,2,199,
+108,64,13,128,2,199,108,64,13,148,5,48,165,17,13,187,135,135,109,67,13,208,7,178,165,20,13,212,5,80,165,17,13,224,7,192,106,3,13,240,3,192,113,19,14,0,2,128,107,136,14,16,2,101,166,6,14,48,2,101,166,4,14,59,
+69,72,109,67,14,128,3,128,111,128,14,165,5,72,109,67,14,208,7,146,165,20,14,240,5,240,113,23,15,64,70,12,107,129,15,64,6,232,110,8,15,112,6,72,108,0,15,112,6,168,108,192,15,128,3,0,111,129,15,128,5,0,111,131,
+15,160,7,192,106,3,15,187,135,135,109,67,15,208,7,178,165,20,16,0,5,248,50,1,16,48,5,8,108,64,16,56,4,240,165,18,16,80,5,8,108,64,16,96,5,232,110,8,16,112,5,8,108,64,16,128,2,128,111,130,16,176,4,216,
+108,128,16,184,4,192,165,18,16,208,4,216,108,128,16,208,7,146,165,20,16,240,4,216,108,128,17,16,2,32,113,23,17,32,5,232,110,8,17,48,4,168,108,192,17,56,4,144,165,18,17,75,65,168,109,67,17,80,4,168,108,192,17,112,
+4,168,108,192,17,144,135,16,223,0,17,144,7,96,248,0,17,192,135,16,223,0,17,240,3,0,113,19,17,240,135,16,223,0,18,16,5,241,166,6,18,32,1,167,105,128,18,40,3,176,165,68,18,48,5,248,65,0,18,64,67,8,82,57,
+18,64,3,176,165,68,18,64,4,172,105,2,18,64,7,104,82,57,18,80,5,248,65,0,18,88,3,176,165,68,18,96,1,167,105,128,18,112,5,241,166,6,18,144,6,242,165,20,18,144,7,96,113,23,18,160,1,167,105,128,18,192,3,8,
+82,57,18,224,1,167,105,128,19,16,3,0,113,19,19,24,1,148,165,18,19,64,7,8,82,57,19,120,1,116,165,18,19,144,4,160,248,0,19,144,7,0,113,23,20,16,1,88,50,2,20,112,0,145,166,4,20,144,0,145,166,6,20,144,
+1,112,102,2,20,148,1,192,165,70,20,148,2,104,165,70,20,148,3,16,165,67,20,160,6,164,248,0,20,176,0,145,166,6,20,240,3,172,165,22,20,245,6,166,109,67,21,16,0,232,108,128,21,16,1,56,108,192,21,24,5,172,165,20,
+21,27,70,166,109,67,21,144,1,108,249,2,21,152,3,172,165,22,21,160,6,48,113,81,21,160,6,96,107,52,21,235,134,112,109,67,22,16,1,104,108,0,22,32,6,48,113,81,22,32,6,96,107,36,22,80,1,40,108,64,22,80,1,232,
+110,8,22,144,0,232,108,128,22,148,2,240,165,69,22,160,6,48,113,81,22,160,6,96,107,52,22,176,1,241,166,6,22,235,134,112,109,67,22,240,0,232,108,192,23,0,1,232,110,8,23,40,5,144,165,18,23,48,0,168,108,0,23,64,
+5,172,105,1,23,75,70,168,109,67,23,96,2,248,113,112,23,96,3,120,113,112,23,96,3,248,113,112,23,112,1,8,108,64,23,112,1,104,108,0,23,112,1,200,108,192,23,152,0,148,165,22,23,160,3,24,112,0,23,160,3,152,112,0,
+23,160,4,24,112,0,23,192,134,24,110,8,24,0,2,216,113,23,24,0,3,88,113,23,24,0,3,216,113,23,24,8,4,128,42,0,24,21,6,134,109,67,24,40,5,144,165,18,24,64,5,172,105,1,24,186,132,144,109,67,24,192,134,24,
+110,8,24,220,6,13,165,19,25,48,5,16,113,23,25,56,5,128,42,0,25,59,70,70,109,67,25,64,134,24,110,8,25,92,6,13,165,19,25,128,4,204,107,128,25,128,5,13,82,57,25,128,5,80,82,57,25,148,0,241,165,68,25,165,
+6,70,109,67,25,176,5,155,50,0,25,192,134,24,110,8,25,208,4,240,113,21,25,208,5,96,113,23,25,220,6,13,165,19,26,59,70,70,109,67,26,64,134,24,110,8,26,92,6,13,165,19,26,96,1,248,113,112,26,96,2,120,113,112,
+26,96,2,248,113,112,26,160,2,24,112,0,26,160,2,152,112,0,26,160,3,24,112,0,26,165,6,70,109,67,26,192,134,24,110,8,26,240,4,192,113,19,26,240,6,144,113,21,27,0,1,216,113,23,27,0,2,88,113,23,27,0,2,216,
+113,23,27,16,4,167,105,128,27,48,4,167,105,129,27,80,4,167,105,130,27,112,4,167,105,131,27,118,132,144,109,67,27,128,6,0,111,132,27,144,4,192,113,19,27,156,4,144,165,19,27,192,131,120,110,8,27,208,3,180,165,20,27,240,
+4,192,113,19,28,16,4,167,105,128,28,48,4,167,105,129,28,64,131,120,110,8,28,80,4,167,105,130,28,112,4,167,105,131,28,118,132,144,109,67,28,128,5,128,111,133,28,144,4,192,113,19,28,156,4,144,165,19,28,248,3,128,42,0,
+28,248,4,128,42,0,29,96,5,104,83,1,29,160,5,104,83,1,29,224,5,104,83,1,30,24,67,160,42,0,30,24,68,160,42,0,30,240,68,204,158,6,31,144,3,12,158,6,31,176,5,17,166,6,31,208,5,17,166,6,31,240,3,12,
+158,6,31,240,4,12,158,6,31,240,5,17,166,6,32,21,2,232,109,67,34,48,2,224,253,1,34,96,3,72,13,0,34,96,3,32,253,3,34,108,3,0,253,3,34,128,2,236,253,3,34,152,2,224,253,2,255,255,0,0,0,0
@@ -0,0 +1,28 @@
+0,48,129,24,110,4,0,48,1,136,110,4,0,64,131,24,110,4,0,64,3,136,110,4,0,148,65,144,114,1,0,200,7,80,165,18,0,208,1,56,165,18,0,208,3,56,165,18,1,64,131,24,110,4,1,88,7,80,165,18,1,117,1,150,
+109,67,1,117,3,150,109,67,1,229,7,38,109,67,2,16,7,72,108,0,2,24,1,120,165,18,2,48,7,72,108,0,2,64,7,232,110,8,2,128,1,208,104,32,2,128,3,208,104,32,2,152,3,160,106,2,2,160,1,160,106,2,2,176,
+7,80,103,64,2,224,7,232,110,8,3,80,6,80,103,64,3,80,7,80,103,64,3,88,6,180,165,18,3,96,3,160,106,2,3,128,129,112,223,0,3,128,3,208,104,32,3,176,5,176,103,64,3,184,5,4,165,18,3,219,131,144,109,67,
+3,224,6,104,50,0,3,248,65,128,42,0,4,21,1,134,109,67,4,32,7,232,110,8,4,56,5,68,165,18,4,72,3,176,165,16,4,96,3,170,165,16,4,120,3,164,165,16,4,144,3,158,165,16,4,144,6,176,113,17,4,168,3,152,
+165,16,4,176,5,176,103,64,4,193,6,196,107,128,4,224,5,8,50,1,4,240,3,208,166,21,5,16,1,39,105,158,5,48,1,39,105,156,5,64,1,232,110,4,5,64,3,172,105,1,5,64,3,232,110,4,5,80,1,39,105,154,5,112,
+1,39,105,152,5,118,131,144,109,67,5,144,1,39,105,150,5,144,1,103,105,150,5,144,3,208,166,21,5,144,4,192,113,18,5,160,6,160,248,0,5,168,3,148,165,18,5,176,1,39,105,148,5,176,1,103,105,148,5,193,4,204,107,129,
+5,208,1,39,105,146,5,208,1,103,105,146,5,208,1,232,110,4,5,208,6,178,165,20,5,240,1,103,105,144,5,240,3,208,166,21,5,240,4,208,166,21,6,16,1,103,105,158,6,16,1,167,105,158,6,40,4,144,165,18,6,48,1,103,
+105,156,6,48,1,167,105,156,6,64,3,172,105,1,6,64,3,232,110,4,6,64,4,172,105,1,6,75,70,168,109,67,6,80,1,103,105,154,6,80,1,167,105,154,6,96,1,232,110,4,6,112,1,167,105,152,6,118,131,144,109,67,6,144,
+1,167,105,150,6,144,3,208,166,21,6,144,4,208,166,21,6,176,1,167,105,148,6,208,1,167,105,146,6,208,6,144,248,0,6,240,1,241,166,6,7,16,1,176,166,17,7,40,1,64,165,18,7,48,3,64,165,18,7,64,132,24,110,4,
+7,88,68,144,65,16,7,148,6,144,114,0,7,148,3,144,114,2,7,192,132,24,110,4,7,232,1,136,110,4,7,232,6,136,110,2,8,48,6,136,110,2,8,59,68,70,109,67,8,64,1,136,110,4,8,64,132,24,110,4,8,148,65,144,
+114,7,8,148,69,144,114,3,8,165,4,70,109,67,8,184,1,72,165,18,8,184,5,64,165,18,8,192,132,24,110,4,8,192,6,64,165,18,8,200,0,64,165,18,9,88,4,84,165,18,9,96,131,208,223,0,9,117,0,150,109,67,9,117,
+6,150,109,67,9,144,131,208,223,0,9,187,129,144,109,67,9,192,131,208,223,0,9,208,0,180,165,20,9,208,5,180,165,20,9,208,6,96,165,20,9,240,131,208,223,0,10,16,2,145,166,6,10,16,4,241,166,6,10,48,2,0,166,23,
+10,48,2,145,166,6,10,80,4,80,103,64,10,96,1,199,105,128,10,96,2,23,105,128,10,128,1,199,105,128,10,128,2,23,105,128,10,128,2,103,105,128,10,160,1,199,105,128,10,160,2,103,105,128,10,208,1,224,166,19,10,208,2,112,
+166,21,10,208,3,144,21,7,10,208,6,144,248,0,10,224,1,193,106,3,11,0,1,180,165,18,11,0,133,120,110,4,11,16,6,168,108,0,11,32,0,168,83,1,11,64,0,232,110,2,11,64,7,232,110,4,11,80,4,80,103,64,11,80,
+6,168,108,64,11,96,0,168,83,1,11,144,0,148,165,20,11,144,6,168,108,128,11,160,7,241,166,2,11,176,3,176,103,64,11,196,3,1,166,4,11,208,6,168,108,192,11,248,1,128,42,0,12,0,7,232,110,4,12,16,6,168,108,0,
+12,32,0,168,83,1,12,80,6,168,108,64,12,96,0,168,83,1,12,96,7,241,166,6,12,112,1,104,248,0,12,128,5,104,107,19,12,128,5,208,104,32,12,128,7,241,166,6,12,144,0,148,165,20,12,144,6,168,108,128,12,192,129,24,
+110,4,12,208,6,168,108,192,12,240,7,16,108,64,12,240,7,112,108,0,12,240,7,208,108,192,13,8,2,176,65,16,13,32,0,168,83,1,13,72,1,112,104,33,13,80,6,148,165,16,13,96,0,168,83,1,13,104,6,154,165,16,13,128,
+3,112,21,6,13,128,3,208,104,32,13,128,5,104,107,19,13,128,5,208,104,32,13,128,6,160,165,16,13,144,0,148,165,20,13,152,6,166,165,16,13,176,6,172,165,16,13,184,1,176,104,225,13,208,2,148,165,20,13,240,1,48,106,1,
+14,32,0,168,83,1,14,72,1,112,104,225,14,75,69,166,109,67,14,96,0,168,83,1,14,128,3,112,21,6,14,128,3,208,104,224,14,128,6,160,106,2,14,128,6,208,104,32,14,144,0,148,165,20,14,184,1,176,104,33,14,208,2,16,
+21,7,14,240,1,48,106,1,15,32,0,168,83,1,15,48,5,72,165,18,15,72,1,112,104,225,15,96,0,168,83,1,15,128,3,112,21,6,15,128,3,208,104,64,15,128,6,160,106,2,15,128,6,208,104,224,15,176,0,148,165,20,15,184,
+1,176,104,33,16,128,6,192,106,3,16,128,6,208,104,32,16,186,128,144,109,67,16,192,6,160,106,2,17,16,0,241,166,6,17,32,129,216,110,2,17,48,0,241,166,6,17,48,3,64,165,18,17,64,128,128,110,4,17,80,0,241,166,2,
+17,112,0,241,166,6,17,128,0,208,104,224,17,144,0,241,166,6,17,148,3,144,114,4,17,192,128,128,110,4,17,224,129,176,113,49,17,224,1,224,107,52,18,48,6,64,165,18,18,56,4,136,110,2,18,64,128,128,110,4,18,88,2,84,
+165,18,18,128,0,208,104,32,18,148,6,144,114,5,18,165,2,70,109,67,18,192,128,128,110,4,18,192,130,16,223,0,18,240,130,16,223,0,19,16,1,40,108,230,19,16,1,136,108,214,19,16,1,232,108,198,19,64,128,128,110,4,19,64,
+4,8,21,7,19,80,2,80,223,0,19,128,0,208,104,224,19,128,0,208,106,3,19,128,2,80,223,0,19,192,128,128,110,4,19,208,4,144,165,20,19,240,2,56,50,3,19,245,4,166,109,67,20,32,2,240,82,40,20,56,5,136,110,2,
+20,112,2,241,166,4,20,118,129,144,109,67,20,144,1,208,113,21,20,193,1,252,107,131,20,248,4,128,42,0,21,32,66,140,158,8,21,32,67,140,158,8,21,48,0,72,165,18,21,112,132,240,223,0,21,120,5,116,165,18,21,148,0,144,
+114,6,21,144,2,232,21,6,21,144,132,240,223,0,21,176,132,240,223,0,21,220,5,84,165,18,21,240,1,8,21,6,22,24,1,180,165,18,22,172,4,44,158,8,22,176,5,48,248,0,22,248,68,32,42,0,22,248,5,32,42,0,23,112,
+3,104,21,6,23,144,1,12,158,8,23,144,3,12,158,8,23,144,5,16,165,20,23,224,2,12,158,8,23,240,1,17,166,5,24,80,4,240,248,0,24,117,132,144,109,67,25,0,4,240,248,0,25,208,5,84,165,20,26,192,4,224,21,7,
+27,192,5,0,21,7,28,192,5,32,21,7,28,248,4,128,42,0,30,224,5,164,13,0,255,255,0,0,0,0
@@ -0,0 +1,19 @@
+0,80,5,241,166,2,0,224,5,240,54,0,1,8,4,240,165,18,1,32,3,248,100,130,1,32,132,48,54,48,1,32,133,48,54,48,1,32,134,48,54,48,1,40,69,232,224,0,1,80,1,248,50,3,1,96,69,16,172,8,1,128,6,248,
+100,130,1,136,4,48,165,18,1,136,5,48,165,18,1,136,6,48,165,18,1,160,66,16,214,243,1,160,132,112,54,48,1,160,133,112,54,48,1,160,134,112,54,48,1,176,2,241,166,6,1,176,3,232,172,6,1,224,3,80,172,8,1,224,
+71,16,173,0,2,16,6,192,87,195,2,112,1,192,87,68,2,184,3,192,165,70,2,208,66,16,173,0,2,208,3,192,165,70,2,208,5,248,65,0,2,236,3,192,165,70,2,240,6,192,87,195,3,0,5,248,100,130,3,16,66,16,173,0,
+3,64,133,144,54,48,3,64,6,8,97,19,3,96,66,48,173,0,3,112,6,48,97,48,3,112,6,224,173,0,3,144,6,168,50,2,3,192,70,48,214,242,3,208,68,96,172,8,3,224,66,96,224,0,4,16,68,240,173,0,4,48,5,232,
+172,6,4,64,131,144,54,48,4,64,4,6,97,19,4,80,5,84,165,20,4,144,5,184,50,10,4,208,2,144,97,1,4,208,3,72,50,1,4,240,2,144,97,1,4,240,4,240,173,0,4,248,5,160,214,234,5,6,129,176,54,0,5,16,
+0,241,166,6,5,16,2,144,97,48,5,32,70,88,172,6,5,48,65,32,173,0,5,48,2,144,97,48,5,64,68,16,214,241,5,64,133,144,54,48,5,64,6,248,100,129,5,80,2,144,97,1,5,112,1,112,97,48,5,112,2,144,97,1,
+5,136,6,236,249,1,5,140,1,244,165,17,5,224,6,152,172,6,5,240,1,48,97,48,6,8,0,212,165,18,6,80,64,208,173,0,6,112,6,168,87,213,6,136,0,148,165,18,7,0,6,248,100,129,7,16,1,248,50,8,7,64,2,80,
+214,248,7,112,6,168,87,213,7,128,2,48,165,20,7,152,2,112,150,0,7,240,0,108,226,3,8,0,6,248,100,129,8,24,1,144,165,18,8,24,66,144,150,0,8,32,3,8,100,129,8,112,6,168,87,213,8,128,2,192,87,212,8,160,
+1,0,173,0,8,160,2,160,87,197,8,224,129,48,54,48,9,16,4,241,166,6,9,32,67,112,172,8,9,48,66,141,226,3,9,48,5,16,173,0,9,112,5,232,50,5,9,128,1,64,235,64,9,128,3,248,100,129,9,128,7,16,173,0,
+9,160,6,248,100,130,9,176,5,76,165,65,9,208,2,141,226,4,9,208,5,20,165,65,9,224,6,224,224,0,9,232,5,160,214,229,10,16,66,48,226,2,10,16,66,176,226,2,10,24,5,16,173,0,10,32,6,16,214,244,10,80,6,240,
+173,0,10,96,5,16,173,0,10,112,3,208,172,10,10,128,0,192,235,203,10,144,4,248,100,129,10,144,6,208,173,0,10,176,5,16,173,0,10,192,6,88,50,4,10,224,4,72,172,10,11,32,1,160,87,197,11,48,0,120,50,11,11,80,
+5,224,165,65,11,112,5,192,165,65,11,176,5,192,165,65,11,184,1,244,165,18,11,208,5,224,165,65,12,16,2,8,210,4,12,16,67,13,226,3,12,16,3,241,166,6,12,32,6,16,173,0,12,40,2,96,165,69,12,48,68,112,172,6,
+12,64,2,96,165,69,12,80,6,24,100,130,12,88,2,96,165,69,12,112,67,173,226,3,12,128,4,248,100,129,12,176,2,16,173,0,12,224,5,248,224,0,13,0,2,16,173,0,13,8,6,96,140,2,13,16,67,16,173,0,13,32,4,176,
+172,6,13,80,2,96,165,69,13,144,2,96,165,69,13,144,4,168,100,129,13,160,2,248,100,130,13,176,3,48,214,247,13,176,4,104,50,6,13,192,67,16,173,0,13,248,3,224,214,230,14,16,0,152,65,0,14,16,4,97,166,6,14,40,
+129,208,54,0,14,48,0,152,65,0,14,64,2,192,87,53,14,80,0,152,65,0,14,80,1,144,87,196,14,80,3,16,97,48,14,112,0,248,65,0,14,144,0,152,65,0,14,144,1,192,87,69,14,144,3,152,50,7,14,144,3,176,97,48,
+14,176,0,152,65,0,14,208,0,152,65,0,14,208,1,80,173,0,14,240,0,152,65,0,14,240,4,176,97,48,14,248,4,64,214,233,15,16,4,248,50,9,15,80,69,48,173,0,15,128,4,192,87,68,15,224,69,96,224,0,16,16,68,16,
+226,2,16,128,132,80,54,48,16,176,5,56,100,129,16,192,4,144,165,18,16,224,3,236,249,2,16,240,5,16,173,0,17,88,3,208,165,18,18,0,3,248,87,52,18,160,4,128,87,197,19,128,4,64,87,53,19,192,6,248,100,130,19,208,
+68,208,173,0,19,224,134,16,54,48,19,224,7,8,97,19,19,240,4,112,165,18,20,32,68,208,173,0,20,96,68,208,173,0,20,144,6,208,173,0,21,16,4,241,166,6,21,16,70,48,226,3,21,16,70,176,226,3,21,64,69,16,173,0,
+21,80,69,176,226,3,21,128,69,48,226,3,21,240,5,16,173,0,255,255,0,0,0,0
@@ -0,0 +1,21 @@
+0,0,0,0,92,0,0,168,2,176,165,18,1,168,2,176,165,18,2,16,2,192,188,1,2,48,2,192,188,1,2,80,2,192,188,1,2,112,2,112,223,0,2,112,2,192,188,1,2,144,3,241,166,6,2,144,3,248,65,0,2,176,3,241,
+166,6,2,176,3,248,65,0,2,208,3,241,166,6,2,208,3,248,65,0,2,240,2,88,65,2,2,240,3,241,166,5,2,240,3,248,65,0,3,104,1,176,165,18,3,232,1,208,223,0,4,16,65,240,91,0,4,16,2,113,166,2,8,43,
+2,167,165,16,8,48,2,248,65,0,8,48,3,240,165,70,8,48,4,152,165,70,8,52,2,134,165,16,8,72,2,104,165,16,8,100,2,85,165,16,8,133,2,76,165,16,8,168,5,212,165,20,10,8,66,80,93,2,11,8,3,80,28,0,
+11,8,3,208,28,0,11,8,4,80,28,0,11,8,4,208,28,0,11,8,5,80,28,0,11,16,67,112,91,0,11,16,68,112,91,0,11,24,3,80,19,55,11,24,3,208,19,55,11,24,4,80,19,55,11,24,4,208,19,55,11,24,5,80,
+19,55,11,144,1,240,91,2,11,144,2,48,224,2,11,144,3,240,91,0,11,144,68,240,91,0,11,184,2,112,165,22,12,58,6,111,165,16,12,64,5,48,165,18,12,67,6,78,165,16,12,93,6,53,165,16,12,112,1,0,165,68,12,112,
+1,216,65,2,12,128,6,44,165,16,12,136,5,112,28,0,12,144,2,240,91,0,12,160,5,112,19,55,12,161,6,53,165,16,12,187,6,78,165,16,12,197,6,111,165,16,13,16,2,112,91,0,13,96,3,208,223,0,13,96,5,112,19,54,
+13,104,3,96,165,18,13,120,69,112,28,0,13,128,3,96,90,0,13,128,3,96,90,1,13,128,3,96,90,2,13,128,3,96,90,3,13,208,3,208,223,0,13,240,2,80,93,2,14,0,0,160,224,2,14,32,6,104,83,129,14,48,3,208,
+223,0,14,96,6,104,83,129,14,144,3,208,223,0,14,144,4,240,91,2,14,160,6,104,83,129,14,192,2,200,224,2,14,224,6,104,83,129,14,240,2,209,166,5,14,240,3,208,223,0,15,96,5,112,19,54,15,120,69,112,28,0,15,128,
+4,200,224,2,15,168,6,112,165,18,16,0,6,40,224,2,16,8,1,80,28,0,16,32,1,80,19,55,16,104,6,128,165,18,16,128,6,128,90,0,16,128,6,128,90,1,16,128,6,128,90,2,16,128,6,128,90,3,17,16,2,209,166,6,
+17,88,2,208,223,0,17,112,6,112,223,0,17,120,66,208,223,0,17,136,1,128,165,18,17,136,4,112,65,16,17,160,1,128,90,0,17,160,1,128,90,1,17,160,1,128,90,2,17,160,1,128,90,3,17,160,4,112,165,22,17,216,2,208,
+223,0,17,248,66,208,223,0,18,16,3,81,166,5,18,72,4,112,165,17,18,88,2,208,223,0,18,120,1,128,165,18,18,120,68,112,65,16,18,144,1,128,90,0,18,144,1,128,90,1,18,144,1,128,90,2,18,144,1,128,90,3,19,16,
+2,240,91,2,19,16,70,80,93,2,19,32,5,232,83,129,19,88,1,0,165,18,19,96,5,232,83,129,19,112,1,0,90,0,19,112,1,0,90,1,19,112,1,0,90,2,19,112,1,0,90,3,19,216,5,232,89,1,19,248,67,208,65,16,
+20,16,66,80,93,2,20,136,6,112,28,0,20,160,6,112,19,55,21,8,0,80,93,0,21,16,66,112,91,2,21,48,3,88,65,0,21,104,5,160,165,18,21,104,6,112,165,18,21,128,2,64,224,2,21,128,5,160,90,0,21,128,5,160,
+90,1,21,128,5,160,90,2,21,128,5,160,90,3,21,128,6,112,90,0,21,128,6,112,90,1,21,128,6,112,90,2,21,128,6,112,90,3,21,224,3,88,65,2,22,32,5,104,83,129,22,48,0,48,224,2,22,56,2,80,165,22,22,96,
+5,104,83,129,22,168,5,32,165,18,22,208,2,209,166,6,22,224,2,80,165,16,22,240,2,209,166,6,23,8,0,208,165,22,23,104,5,160,165,18,23,128,5,160,90,0,23,128,5,160,90,1,23,128,5,160,90,2,23,128,5,160,90,3,
+23,176,0,208,165,18,23,232,6,64,165,18,23,248,3,208,93,2,24,0,6,64,90,4,24,0,6,64,90,5,24,0,6,64,90,6,24,0,6,64,90,7,24,16,0,160,224,2,24,136,4,112,65,16,25,112,69,144,91,2,25,120,68,112,
+65,16,25,144,5,48,91,2,25,144,5,240,91,2,26,43,2,167,165,16,26,48,2,248,65,0,26,52,2,134,165,16,26,60,1,112,165,16,26,66,1,80,165,16,26,72,2,104,165,16,26,90,1,54,165,16,26,96,6,112,19,54,26,100,
+2,85,165,16,26,120,70,112,28,0,26,128,1,44,165,16,26,133,2,76,165,16,26,164,1,54,165,16,26,188,1,80,165,16,26,196,1,112,165,16,27,120,66,80,93,2,27,144,2,113,166,6,27,160,1,232,83,129,27,224,1,232,83,129,
+27,248,68,80,65,16,28,16,3,209,166,6,28,16,6,81,166,6,28,32,65,64,224,2,28,112,2,113,166,6,28,200,5,128,165,18,28,216,3,104,89,0,28,224,5,128,90,0,28,224,5,128,90,1,28,224,5,128,90,2,28,224,5,128,
+90,3,28,240,1,81,166,6,29,40,6,104,89,12,29,80,4,208,165,20,29,152,2,16,165,20,29,200,66,80,93,2,30,16,2,112,91,2,30,40,5,232,89,0,30,72,2,232,89,3,30,104,4,160,165,18,30,128,4,160,90,0,30,128,
+4,160,90,1,30,128,4,160,90,2,30,128,4,160,90,3,32,96,1,224,125,3,32,96,2,0,125,3,32,96,2,32,125,3,32,96,2,64,13,0,32,184,1,232,75,0,32,184,2,32,125,2,32,240,1,232,125,1,255,255,0,0,0,0
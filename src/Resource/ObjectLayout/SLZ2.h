@@ -0,0 +1,18 @@
+0,0,0,0,92,0,0,8,1,80,65,16,1,24,1,48,165,18,2,16,64,208,93,2,2,224,0,176,165,18,3,144,0,176,224,2,6,48,2,16,165,66,6,104,1,48,165,18,7,58,2,111,165,16,7,67,2,78,165,16,7,93,2,53,
+165,16,7,128,2,44,165,16,7,161,2,53,165,16,7,187,2,78,165,16,7,197,2,111,165,16,9,160,2,104,83,129,9,224,2,104,83,129,10,16,65,208,93,1,10,32,66,208,93,2,12,16,65,112,223,0,12,16,66,80,93,2,12,112,
+1,112,223,0,13,48,4,16,165,70,13,48,4,184,165,70,13,104,3,48,165,18,13,144,130,16,223,0,13,144,66,112,223,0,13,224,66,112,223,0,13,240,0,240,165,66,13,240,1,120,65,2,14,16,69,80,93,2,14,24,130,16,223,0,
+14,24,66,112,223,0,14,80,130,16,223,0,14,112,4,28,165,69,14,128,0,168,224,2,14,128,4,16,165,70,14,144,4,28,165,69,14,240,5,88,65,2,15,0,0,168,224,2,15,104,1,112,165,18,15,104,4,80,223,0,15,128,1,112,
+90,4,15,128,1,112,90,5,15,128,1,112,90,6,15,128,1,112,90,7,15,128,4,80,223,0,15,136,3,208,165,18,15,152,4,80,223,0,15,160,3,208,90,0,15,160,3,208,90,1,15,160,3,208,90,2,15,160,3,208,90,3,15,176,
+4,80,223,0,15,224,0,192,165,18,15,240,1,208,93,2,15,248,68,80,93,0,16,88,3,64,165,18,16,112,3,64,90,0,16,112,3,64,90,1,16,112,3,64,90,2,16,112,3,64,90,3,16,200,1,16,165,19,16,232,0,212,165,18,
+16,248,65,80,93,2,17,208,4,32,224,2,17,240,2,168,224,2,18,58,1,111,165,16,18,67,1,78,165,16,18,93,1,53,165,16,18,128,1,44,165,16,18,161,1,53,165,16,18,187,1,78,165,16,18,197,1,111,165,16,18,232,0,212,
+165,18,19,48,5,16,165,66,19,58,1,111,165,16,19,67,1,78,165,16,19,93,1,53,165,16,19,104,4,48,165,18,19,128,1,44,165,16,19,136,2,112,28,0,19,160,2,112,19,23,19,161,1,53,165,16,19,168,5,212,165,18,19,187,
+1,78,165,16,19,197,1,111,165,16,20,16,3,248,65,0,20,32,2,136,83,129,20,48,3,248,65,0,20,80,3,248,65,0,20,96,2,168,83,129,20,112,3,248,65,0,20,144,3,248,65,0,20,160,2,200,83,129,20,176,3,248,65,0,
+20,208,3,248,65,0,20,224,2,232,83,129,20,232,0,212,165,18,20,240,3,248,65,0,21,8,65,80,93,2,21,24,69,80,93,2,21,72,66,208,93,2,21,240,2,216,65,2,22,16,64,112,91,0,22,16,1,44,224,2,22,16,4,209,
+166,2,22,48,4,216,65,0,22,58,6,111,165,16,22,67,6,78,165,16,22,93,6,53,165,16,22,128,6,44,165,16,22,144,64,240,91,0,22,148,2,80,165,18,22,161,6,53,165,16,22,187,6,78,165,16,22,197,6,111,165,16,22,208,
+4,209,166,6,22,240,130,16,223,0,22,240,4,209,166,5,22,248,64,80,65,16,23,32,130,16,223,0,23,40,1,104,89,3,23,80,130,16,223,0,23,144,65,240,91,0,23,144,66,112,93,2,23,216,1,172,224,2,23,224,5,200,24,3,
+24,32,5,168,24,3,24,96,5,136,24,3,24,144,2,16,165,20,25,40,3,80,165,69,25,64,3,80,165,69,25,64,2,112,94,0,25,64,5,32,94,0,25,88,3,80,165,69,25,96,0,176,165,68,25,128,6,96,86,88,25,128,134,96,
+86,88,25,128,6,96,86,89,25,128,134,96,86,89,25,128,6,96,86,90,25,128,134,96,86,90,25,128,6,96,86,91,25,128,134,96,86,91,25,192,2,0,94,0,25,224,0,56,165,68,25,240,4,88,65,2,26,40,5,208,165,18,26,112,
+129,16,223,0,26,192,4,64,165,68,26,192,6,0,94,0,26,240,129,16,223,0,27,40,3,232,89,0,27,40,4,208,165,18,27,104,1,128,165,18,27,128,1,128,90,0,27,128,1,128,90,1,27,128,1,128,90,2,27,128,1,128,90,3,
+27,128,3,104,89,0,27,192,2,76,165,18,27,192,3,240,165,68,27,192,5,0,94,0,27,216,1,232,89,3,27,216,2,232,89,0,28,24,67,208,93,2,28,112,0,209,166,6,28,144,0,209,166,6,28,160,3,232,83,129,28,176,0,209,
+166,6,28,208,0,209,166,6,28,224,3,232,83,129,28,240,0,209,166,6,29,24,3,208,165,20,29,112,131,144,223,0,29,144,3,208,165,18,29,160,131,144,223,0,29,208,131,144,223,0,30,240,3,80,93,2,32,32,2,104,125,1,32,96,
+2,160,125,3,32,96,2,192,13,0,32,112,2,136,125,3,32,136,2,112,125,3,32,160,2,104,125,2,32,184,2,96,75,0,255,255,0,0,0,0
@@ -0,0 +1,24 @@
+0,0,0,0,92,0,0,208,1,32,165,18,1,160,1,32,165,18,1,224,1,64,224,2,3,20,1,224,165,134,4,152,4,224,165,16,4,154,5,7,165,16,4,176,5,40,165,16,4,192,1,240,94,0,4,208,5,64,165,16,4,228,0,64,
+165,66,4,248,5,75,165,16,5,144,129,16,223,0,5,208,129,16,223,0,5,216,1,81,166,5,6,16,64,80,93,2,6,16,129,16,223,0,6,16,68,208,93,2,6,64,2,96,94,0,6,80,129,16,223,0,6,96,2,0,165,66,6,100,
+2,188,165,65,6,116,2,176,165,69,6,132,2,188,165,65,6,144,129,16,223,0,6,144,70,80,93,2,7,32,4,232,83,129,7,40,4,208,165,18,7,40,5,72,165,18,7,64,3,0,94,0,7,96,4,232,83,129,7,112,4,176,224,2,
+7,144,70,112,223,0,7,240,6,112,223,0,8,16,68,80,93,1,8,16,70,112,223,0,8,24,0,80,165,20,8,112,6,112,223,0,8,132,1,212,165,33,8,132,1,236,165,33,8,148,1,200,165,69,8,224,2,208,19,54,8,248,66,208,
+28,0,8,248,6,88,65,2,9,16,4,209,166,2,9,32,6,88,65,2,9,48,4,209,166,5,9,72,6,88,65,2,9,80,4,209,166,6,9,112,6,88,65,2,9,128,4,64,224,2,9,168,6,112,165,18,10,48,2,16,165,66,10,64,
+0,172,224,2,10,64,6,144,94,0,10,104,1,48,165,18,10,144,69,208,223,0,10,160,0,172,224,2,10,240,5,208,223,0,10,248,67,208,65,16,11,0,0,172,224,2,11,16,64,80,93,2,11,104,5,224,165,18,11,128,5,224,90,0,
+11,128,5,224,90,1,11,128,5,224,90,2,11,128,5,224,90,3,12,44,1,168,165,16,12,44,2,240,165,68,12,48,1,248,65,0,12,52,1,131,165,16,12,72,1,104,165,16,12,104,1,83,165,16,12,104,5,224,165,18,12,128,5,224,
+90,4,12,128,5,224,90,5,12,128,5,224,90,6,12,128,5,224,90,7,12,140,1,76,165,16,12,176,1,112,165,68,13,136,6,208,28,0,13,144,69,240,91,0,13,144,70,240,91,0,13,160,6,208,19,55,14,16,6,112,91,0,14,48,
+1,16,165,68,14,104,0,48,165,18,14,96,6,80,19,54,14,120,70,80,28,0,15,32,7,104,83,1,15,40,7,80,165,18,15,48,2,16,165,68,15,96,7,104,83,1,15,104,1,48,165,18,16,0,71,80,93,2,16,16,5,209,166,5,
+16,60,2,112,165,16,16,68,2,78,165,16,16,94,2,51,165,16,16,128,2,44,165,16,16,144,71,112,223,0,16,163,2,51,165,16,16,176,5,216,65,0,16,188,2,78,165,16,16,196,2,112,165,16,16,208,5,216,65,0,16,240,5,216,
+65,0,16,240,7,112,223,0,17,0,71,112,223,0,17,16,1,81,166,4,17,112,0,160,165,18,17,112,7,112,223,0,17,124,0,136,165,17,17,128,4,32,86,88,17,128,132,32,86,88,17,128,4,32,86,89,17,128,132,32,86,89,17,128,
+4,32,86,90,17,128,132,32,86,90,17,128,4,32,86,91,17,128,132,32,86,91,17,132,7,80,93,0,17,136,0,112,165,16,18,0,0,192,21,7,18,32,7,104,83,1,18,40,7,80,165,18,18,48,130,16,223,0,18,80,130,16,223,0,
+18,96,0,160,165,18,18,96,7,104,83,1,18,108,0,136,165,17,18,112,130,16,223,0,18,120,0,112,165,16,18,144,130,16,223,0,18,144,67,112,223,0,18,176,130,16,223,0,18,208,130,16,223,0,18,240,130,16,223,0,18,240,3,112,
+223,0,19,16,67,112,223,0,19,16,4,72,165,18,19,16,70,208,93,2,19,40,5,232,89,138,19,88,1,104,89,0,19,88,2,104,89,0,19,112,3,112,223,0,19,168,0,208,165,18,19,192,4,72,165,18,19,216,5,232,89,138,20,64,
+6,232,89,1,20,96,4,232,83,129,21,16,69,80,223,0,21,32,3,232,83,129,21,40,3,208,165,18,21,56,5,216,165,22,21,64,5,48,94,0,21,96,3,232,83,129,21,96,5,80,223,0,21,112,69,80,223,0,21,128,6,112,86,88,
+21,128,134,112,86,88,21,128,6,112,86,89,21,128,134,112,86,89,21,128,6,112,86,90,21,128,134,112,86,90,21,128,6,112,86,91,21,128,134,112,86,91,21,192,4,240,94,0,21,240,5,80,223,0,22,16,67,80,93,2,22,32,4,80,
+165,18,22,48,2,16,165,66,22,104,1,48,165,18,23,16,66,80,93,2,23,16,5,209,166,4,23,16,70,80,93,2,23,32,3,32,224,2,23,48,5,209,166,6,23,80,4,113,166,6,23,80,5,209,166,6,23,112,4,113,166,5,23,112,
+5,209,166,6,23,128,3,32,224,2,24,64,2,64,94,0,24,168,1,208,165,18,24,176,0,208,165,18,24,216,3,176,224,2,25,0,5,224,21,7,25,16,3,192,188,1,25,16,4,81,166,5,25,48,3,192,188,1,25,48,4,81,166,6,
+25,80,3,192,188,1,25,80,4,81,166,6,25,88,1,232,89,3,25,96,3,112,19,54,25,112,3,192,188,1,25,112,4,81,166,6,25,120,67,112,28,0,25,240,130,16,223,0,26,16,130,16,223,0,26,32,6,104,24,3,26,48,130,16,
+223,0,26,96,6,104,24,3,26,136,3,112,28,0,26,160,3,112,19,55,26,176,5,240,94,0,27,16,66,240,91,0,27,32,6,104,24,3,27,48,69,192,224,2,27,96,3,112,19,54,27,120,66,208,65,16,27,120,67,112,28,0,27,96,
+6,104,24,3,27,112,132,144,223,0,27,144,132,144,223,0,27,160,3,16,165,20,27,176,132,144,223,0,27,208,67,80,93,2,27,208,132,144,223,0,27,240,68,80,93,2,28,208,132,16,223,0,28,208,5,192,224,2,28,224,4,80,165,20,
+28,240,132,16,223,0,28,240,5,208,166,6,29,16,132,16,223,0,29,32,131,16,223,0,29,48,2,16,165,66,29,48,132,16,223,0,29,64,131,16,223,0,29,80,132,16,223,0,29,96,131,16,223,0,29,104,1,48,165,18,29,128,131,16,
+223,0,29,128,3,68,224,2,29,160,131,16,223,0,29,192,131,16,223,0,29,232,66,208,93,2,30,16,67,240,91,2,30,120,68,112,65,16,30,176,4,80,165,18,30,224,3,240,19,54,30,248,2,204,249,1,30,248,67,240,28,0,32,60,
+2,212,94,255,32,160,2,212,94,255,33,4,2,212,94,255,34,0,2,154,62,1,34,0,2,191,62,0,255,255,0,0,0,0
@@ -0,0 +1,19 @@
+0,184,3,64,165,1,0,192,3,192,18,0,1,32,0,212,165,38,1,37,3,194,159,0,1,112,0,211,166,2,1,131,3,194,159,0,1,144,0,211,166,3,1,220,3,194,159,0,2,0,3,195,86,0,2,24,3,194,65,16,2,32,1,26,
+24,12,2,192,3,112,162,0,3,0,3,104,162,0,4,16,1,8,165,70,4,16,2,72,65,0,4,96,0,144,165,18,4,128,0,240,199,0,4,184,1,56,199,0,4,240,0,240,199,0,5,32,1,128,199,0,5,36,0,208,165,21,5,36,
+1,16,165,21,5,40,0,168,199,0,5,40,1,56,199,0,5,96,0,240,199,0,5,104,66,97,65,18,5,128,1,176,199,0,5,128,2,98,86,0,5,152,0,168,199,0,5,152,1,56,199,0,5,152,2,97,65,16,5,208,0,240,199,0,
+5,224,64,176,162,0,5,236,0,64,199,0,6,16,0,240,165,18,6,32,64,208,162,0,6,88,0,240,165,22,7,16,2,80,195,0,7,32,1,94,86,19,7,32,1,220,86,19,7,96,65,32,86,19,7,96,65,158,86,19,7,96,66,28,
+86,19,7,160,1,94,86,19,7,160,1,220,86,19,8,80,0,192,162,0,8,176,0,160,162,0,9,48,0,242,166,4,9,80,0,242,166,6,10,88,67,144,65,18,10,96,0,240,165,3,10,112,3,144,18,0,10,120,1,10,24,0,10,120,
+1,10,88,243,10,120,129,10,88,243,11,96,3,149,195,0,11,48,1,48,24,0,11,104,3,84,165,3,11,128,3,106,24,7,11,240,1,48,86,0,12,0,3,202,50,128,12,16,65,16,86,1,12,16,1,80,86,1,12,48,64,240,86,2,
+12,48,1,112,86,2,12,144,1,48,86,0,12,176,1,16,86,1,12,176,65,80,86,1,12,208,0,240,86,2,12,208,65,112,86,2,13,32,1,8,24,2,13,80,3,224,88,2,13,104,1,80,165,37,14,16,68,96,88,2,15,16,1,160,
+165,35,15,128,4,144,18,0,15,130,2,136,199,0,15,136,1,176,165,36,15,165,68,146,159,0,16,88,4,96,165,4,16,88,4,112,165,4,16,120,68,168,87,84,16,120,4,169,86,0,16,176,2,56,65,2,16,176,2,80,18,0,16,213,
+66,82,159,0,17,24,1,96,165,3,17,64,66,82,159,0,17,128,4,144,18,0,17,232,66,82,159,0,18,24,1,144,165,4,18,32,4,72,88,1,19,24,1,96,165,3,19,48,4,72,88,1,19,112,129,227,65,32,19,128,4,144,18,0,
+20,48,1,189,249,1,20,88,4,96,165,4,20,88,4,112,165,4,20,120,68,168,87,84,20,120,4,169,86,0,20,192,1,192,18,0,21,14,3,202,65,0,21,46,3,202,65,0,21,78,3,202,65,0,21,96,4,141,249,2,21,128,1,192,
+86,0,21,128,3,195,166,5,21,152,4,144,65,18,21,160,65,160,86,1,21,160,1,224,86,1,21,178,3,202,65,0,21,192,65,128,86,2,21,192,2,0,86,2,21,210,3,202,65,0,21,242,3,202,65,0,22,32,1,196,165,37,22,232,
+1,202,65,2,24,32,2,95,86,19,24,32,2,221,86,19,24,96,66,33,86,19,24,96,66,159,86,19,24,96,67,29,86,19,24,160,2,95,86,19,24,178,3,202,65,2,25,0,1,104,162,0,25,128,1,136,162,0,25,208,3,196,165,35,
+26,8,1,228,165,3,26,33,1,249,24,0,26,80,3,164,165,0,26,112,129,227,65,32,26,112,3,132,165,0,26,144,3,84,165,0,26,176,3,68,165,34,26,240,1,192,208,0,27,20,1,216,165,67,27,96,2,96,165,3,27,120,2,10,
+24,0,27,120,2,10,88,195,27,160,2,93,165,0,27,220,2,10,165,0,28,20,2,10,165,0,28,80,2,93,165,0,28,96,2,96,165,3,28,120,2,10,24,0,28,120,130,10,88,195,28,160,2,93,165,0,28,220,2,10,165,0,29,14,
+2,202,65,0,29,40,0,152,165,18,29,46,2,202,65,0,29,76,0,136,165,20,29,78,2,202,65,0,29,168,0,152,165,18,29,178,2,202,65,0,29,210,2,202,65,0,29,242,2,202,65,0,30,48,64,194,159,0,30,208,0,194,159,0,
+31,14,2,202,65,0,31,40,0,152,165,18,31,46,2,202,65,0,31,76,0,136,165,20,31,78,2,202,65,0,31,126,2,195,166,6,31,168,0,152,165,18,31,174,2,202,65,0,31,206,2,202,65,0,31,238,2,202,65,0,32,16,2,192,
+18,0,32,39,2,194,65,18,32,64,2,202,50,0,32,128,0,192,208,0,32,240,0,192,208,0,32,240,2,96,214,160,33,32,1,47,86,19,33,32,1,236,86,19,33,32,2,106,86,19,33,96,64,241,86,19,33,96,65,111,86,19,33,96,
+66,44,86,19,33,160,1,47,86,19,33,160,1,236,86,19,34,138,0,104,162,0,34,234,0,136,162,0,35,32,2,148,125,3,35,64,2,122,125,2,35,96,2,96,125,1,35,96,2,178,13,0,35,160,2,148,125,3,35,168,2,80,75,0,
+35,192,2,122,125,3,255,255,0,0,0,0
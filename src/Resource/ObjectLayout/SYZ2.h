@@ -0,0 +1,22 @@
+0,8,1,194,65,16,3,16,1,216,165,86,3,16,3,216,165,86,3,48,1,192,199,0,3,48,5,81,165,0,3,80,5,96,165,0,3,112,5,100,165,33,3,176,5,96,165,0,3,208,5,81,165,0,3,240,3,216,165,84,4,64,67,194,
+159,0,4,80,4,224,88,2,5,0,3,194,159,0,5,48,69,112,88,2,6,8,2,228,165,3,6,16,0,212,165,37,6,32,2,249,24,0,6,112,130,227,65,32,6,128,5,144,18,0,6,144,2,193,208,0,6,208,0,212,165,38,6,232,
+5,144,159,0,6,240,2,193,208,0,7,88,5,104,165,4,7,96,2,244,165,3,7,120,3,10,24,0,7,120,3,10,88,227,7,120,131,10,88,227,7,120,69,168,87,84,7,120,5,169,86,0,7,128,0,211,166,5,7,176,0,212,165,34,
+7,240,2,138,165,1,7,248,2,152,165,50,8,96,1,16,86,0,8,96,2,244,165,3,8,120,3,10,24,0,8,120,67,10,88,227,8,120,195,10,88,227,8,128,64,240,86,1,8,128,1,48,86,1,8,128,5,144,18,0,8,160,64,208,
+86,2,8,160,1,80,86,2,9,0,1,176,86,0,9,16,2,160,24,11,9,32,65,144,86,1,9,32,1,208,86,1,9,32,5,72,88,1,9,48,66,241,159,0,9,64,65,112,86,2,9,64,1,240,86,2,9,144,2,64,24,12,9,160,
+1,48,86,0,9,192,65,16,86,1,9,192,1,80,86,1,9,208,2,241,159,0,9,224,64,240,86,2,9,224,1,112,86,2,9,240,2,249,65,0,10,48,64,241,159,0,10,48,5,72,88,1,10,208,0,241,159,0,10,240,5,206,113,17,
+11,16,10,186,65,2,11,32,1,94,86,19,11,32,2,27,86,19,11,32,2,216,86,19,11,96,65,32,86,19,11,96,65,221,86,19,11,96,66,154,86,19,11,96,67,87,86,19,11,96,3,144,165,146,11,112,3,128,165,70,11,128,3,144,
+165,98,11,144,5,56,65,0,11,144,5,80,86,0,11,160,1,94,86,19,11,160,2,27,86,19,11,160,2,216,86,19,11,178,5,202,65,0,11,240,0,238,208,0,12,112,0,238,208,0,12,240,0,238,208,0,13,16,2,249,65,0,13,40,
+0,216,165,34,13,48,2,249,65,0,13,80,2,249,65,0,13,88,0,200,165,35,13,168,0,216,165,34,13,176,2,249,65,0,13,208,2,249,65,0,13,240,2,249,65,0,14,146,2,192,65,0,14,148,1,128,165,69,14,148,2,16,165,68,
+15,128,5,128,86,19,15,176,5,128,165,37,16,128,5,64,113,49,16,128,69,192,86,19,16,176,5,128,165,37,17,128,5,128,86,19,17,176,5,128,165,37,18,128,5,64,113,49,18,128,69,192,86,19,18,176,5,128,165,37,19,128,5,128,
+86,19,20,15,5,178,166,2,20,16,4,160,199,0,20,16,4,249,65,2,20,24,2,72,162,0,20,32,4,192,165,38,20,48,4,64,199,0,20,48,4,208,165,37,20,48,4,249,65,2,20,80,4,80,199,0,20,80,4,160,199,0,20,80,
+4,249,65,2,20,112,3,128,165,2,20,112,4,160,199,0,20,112,4,242,166,4,20,120,3,143,165,1,20,128,3,158,165,0,20,128,4,0,199,0,20,144,4,160,199,0,20,144,5,194,65,0,20,176,4,80,199,0,20,176,4,160,199,0,
+20,176,4,249,65,2,20,184,2,136,162,0,20,208,4,64,199,0,20,208,4,249,65,2,20,224,3,186,24,2,20,240,4,160,199,0,20,240,4,249,65,2,21,48,2,200,162,0,22,8,2,228,165,3,22,32,2,250,24,0,22,112,130,227,
+65,32,23,80,2,224,88,2,24,48,67,112,88,2,24,240,3,141,249,1,25,48,66,82,159,0,25,128,3,144,18,0,25,144,66,82,159,0,25,240,66,82,159,0,26,160,1,160,165,86,26,160,2,96,165,85,26,160,3,218,65,0,26,176,
+3,176,88,1,28,144,2,144,86,0,28,176,2,144,86,1,28,176,66,144,86,1,28,208,2,144,86,2,28,208,66,144,86,2,29,0,3,196,195,0,29,80,2,208,86,0,29,112,2,208,86,1,29,112,66,208,86,1,29,144,2,208,86,2,
+29,144,66,208,86,2,30,16,2,144,86,0,30,48,2,144,86,1,30,48,66,144,86,1,30,80,2,144,86,2,30,80,66,144,86,2,31,0,3,83,195,0,31,112,2,112,86,0,31,144,2,112,86,1,31,144,66,112,86,1,31,176,2,112,
+86,2,31,176,66,112,86,2,32,16,2,240,86,0,32,48,2,208,86,1,32,48,67,16,86,1,32,80,2,176,86,2,32,80,67,48,86,2,32,192,3,192,18,0,32,224,2,202,24,1,33,16,3,216,165,66,33,80,4,92,165,0,33,104,
+4,96,165,18,33,128,4,10,24,0,33,128,132,10,88,195,33,160,3,10,24,5,33,176,4,92,165,0,33,240,3,216,165,66,34,40,3,32,165,3,34,64,3,58,24,0,35,8,3,194,65,18,36,16,3,216,165,86,36,48,3,192,199,0,
+36,93,5,95,165,17,36,144,5,89,165,0,36,168,5,80,165,0,36,192,5,68,165,0,36,216,5,57,165,0,36,240,5,45,165,0,37,8,5,31,165,0,37,32,5,16,165,0,38,56,4,16,165,22,38,70,4,36,165,21,38,144,4,202,
+65,2,38,216,4,192,165,19,39,56,4,188,165,0,39,80,4,181,165,0,39,104,4,169,165,0,39,160,4,151,165,0,39,184,4,147,165,0,39,207,4,145,165,0,39,232,4,144,165,18,40,136,4,169,165,0,40,160,4,181,165,0,40,184,
+4,188,165,0,40,208,4,191,165,0,40,232,4,192,165,19,40,240,4,96,125,1,40,240,5,96,125,1,41,40,4,120,125,2,41,40,5,120,125,2,41,96,4,144,125,3,41,96,4,177,13,0,41,96,5,144,125,3,41,96,5,177,13,0,
+41,152,4,120,125,3,41,152,5,120,125,3,41,192,4,128,75,0,41,192,5,128,75,0,41,208,4,120,125,3,41,208,5,120,125,3,255,255,0,0,0,0
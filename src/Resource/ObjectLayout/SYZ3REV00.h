@@ -0,0 +1,25 @@
+2,128,0,216,162,0,3,0,0,248,162,0,3,128,1,24,162,0,4,0,1,56,162,0,7,16,4,96,199,0,7,16,5,90,65,0,7,48,5,90,65,0,7,80,5,90,65,0,7,128,4,8,199,0,7,128,4,128,199,0,7,128,5,83,
+166,4,7,176,5,90,65,0,7,208,5,90,65,0,7,240,4,96,199,0,7,240,5,90,65,0,8,104,3,195,166,6,8,224,3,42,24,11,9,80,68,0,88,2,9,176,2,192,165,38,10,48,4,80,88,2,10,144,2,195,166,5,11,88,
+4,104,165,4,11,120,68,168,87,84,11,120,4,169,86,0,12,0,4,224,113,19,12,16,3,90,65,2,12,40,4,210,165,20,12,40,4,238,165,20,12,56,67,82,159,0,12,112,4,144,18,0,12,128,2,218,24,1,12,192,3,82,159,0,
+12,224,4,144,159,0,13,32,2,224,113,49,13,32,3,65,86,19,13,32,3,254,86,19,13,32,4,187,86,19,13,64,2,26,24,11,13,96,2,224,113,49,13,96,67,129,86,19,13,96,68,62,86,19,13,96,68,251,86,19,13,160,2,224,
+113,49,13,160,3,65,86,19,13,160,3,254,86,19,13,160,5,90,65,2,13,192,1,154,24,12,13,192,2,192,18,0,14,8,1,80,165,34,14,16,5,66,113,19,14,112,2,154,50,0,14,240,2,67,214,160,15,128,2,144,18,0,15,240,
+0,184,165,82,15,240,2,146,159,0,16,16,0,194,86,0,16,16,5,192,18,0,16,40,0,193,65,18,16,64,2,146,159,0,16,88,0,192,165,35,16,112,2,144,18,0,16,240,0,96,162,0,17,112,0,128,162,0,17,144,1,33,86,0,
+17,176,1,1,86,1,17,176,65,65,86,1,17,208,0,225,86,2,17,208,65,97,86,2,18,48,0,161,86,0,18,80,0,129,86,1,18,80,64,193,86,1,18,96,2,240,165,3,18,112,0,97,86,2,18,112,64,225,86,2,18,120,3,10,
+24,0,18,120,3,10,88,243,18,120,131,10,88,243,18,208,1,33,86,0,18,240,1,1,86,1,18,240,65,65,86,1,18,240,2,138,165,0,18,248,2,152,165,0,19,0,2,138,165,0,19,16,0,224,86,2,19,16,65,97,86,2,19,96,
+2,242,165,3,19,112,0,129,86,0,19,120,3,10,24,0,19,120,67,10,88,243,19,120,195,10,88,243,19,144,0,97,86,1,19,144,64,161,86,1,19,176,0,65,86,2,19,176,64,193,86,2,19,224,0,170,24,11,20,48,65,82,159,0,
+20,48,66,194,159,0,20,80,0,218,24,12,20,192,0,234,24,11,20,208,1,82,159,0,20,208,2,194,159,0,21,32,0,224,113,49,21,32,1,65,86,19,21,32,1,191,86,19,21,32,2,124,86,19,21,32,3,57,86,19,21,32,3,162,
+24,0,21,72,3,196,165,18,21,96,0,224,113,49,21,96,65,129,86,19,21,96,65,255,86,19,21,96,66,188,86,19,21,96,67,121,86,19,21,160,0,224,113,49,21,160,1,65,86,19,21,160,1,191,86,19,21,160,2,124,86,19,21,160,
+3,57,86,19,21,160,3,162,24,0,21,192,0,192,18,0,21,208,3,64,86,32,21,240,0,192,208,0,22,155,0,192,208,0,22,192,0,192,18,0,23,24,0,189,249,1,24,16,0,216,165,86,24,16,2,152,165,85,24,16,4,56,165,86,
+24,48,0,194,199,0,24,48,5,144,199,0,24,48,6,0,199,0,24,80,5,144,199,0,24,80,6,16,199,0,24,110,6,98,165,0,24,128,5,26,24,11,24,128,5,202,24,0,24,128,6,64,199,0,24,146,6,98,165,0,24,176,5,144,
+199,0,24,176,6,16,199,0,24,179,6,94,165,0,24,206,6,79,165,0,24,208,5,144,199,0,24,208,6,0,199,0,24,229,6,56,165,0,24,240,1,144,165,86,24,240,3,112,165,85,24,240,5,184,165,83,25,80,69,0,88,2,25,160,
+3,178,166,5,25,200,3,178,166,3,26,48,5,80,88,2,27,120,5,90,50,15,27,184,5,73,86,55,28,56,5,208,165,22,28,176,5,192,88,1,29,48,65,82,159,0,29,56,5,208,165,22,29,96,3,234,24,11,29,144,65,82,159,0,
+29,176,69,192,88,1,29,240,65,82,159,0,30,32,3,138,24,1,30,160,3,128,165,70,30,160,5,218,65,0,30,199,4,253,113,19,30,224,3,57,24,12,31,48,66,241,159,0,31,208,2,241,159,0,32,16,3,8,165,65,32,17,5,147,
+166,6,32,53,5,147,166,4,32,88,5,147,166,6,32,96,3,96,165,18,32,120,3,8,24,0,32,120,3,8,88,179,32,128,5,144,18,0,32,224,3,8,165,65,33,88,5,104,165,4,33,96,2,240,165,3,33,120,3,8,24,0,33,120,
+3,8,88,227,33,120,131,8,88,227,33,120,69,168,87,84,33,120,5,169,86,0,34,16,3,8,165,65,34,96,3,96,165,18,34,112,5,144,18,0,34,120,3,8,24,0,34,120,131,8,88,179,34,224,3,8,165,65,35,32,3,95,86,19,
+35,32,4,28,86,19,35,32,4,217,86,19,35,96,67,159,86,19,35,96,68,92,86,19,35,160,3,95,86,19,35,160,4,28,86,19,35,160,4,217,86,19,37,16,3,224,165,86,37,16,5,72,65,0,37,23,3,193,165,0,37,40,3,168,
+165,0,37,67,3,150,165,0,37,100,3,144,165,0,37,133,3,144,165,0,37,224,4,16,199,0,38,16,6,202,65,0,38,32,4,216,165,34,38,48,4,16,199,0,38,48,6,202,65,0,38,80,4,192,165,35,38,80,6,202,65,0,38,128,
+4,16,199,0,38,128,6,195,166,5,38,160,4,216,165,34,38,176,6,202,65,0,38,208,6,202,65,0,38,224,3,218,24,11,38,240,6,202,65,0,39,96,3,122,24,12,39,152,4,236,249,2,39,224,3,26,24,11,40,32,5,208,24,2,
+40,80,5,18,86,0,40,112,4,242,86,1,40,112,69,50,86,1,40,144,4,210,86,2,40,144,69,82,86,2,40,240,2,212,165,38,40,240,5,18,86,0,41,16,68,242,86,1,41,16,5,50,86,1,41,48,68,210,86,2,41,48,5,82,
+86,2,41,144,5,18,86,0,41,176,4,242,86,1,41,176,69,50,86,1,41,208,2,212,165,33,41,208,4,210,86,2,41,208,69,82,86,2,42,48,5,18,86,0,42,80,68,242,86,1,42,80,5,50,86,1,42,112,68,210,86,2,42,112,
+5,82,86,2,42,160,2,178,166,4,42,200,2,178,166,2,42,208,5,18,86,0,42,224,5,208,24,2,42,240,4,242,86,1,42,240,69,50,86,1,43,16,4,210,86,2,43,16,69,82,86,2,45,224,5,28,62,1,45,224,5,65,62,0,
+255,255,0,0,0,0
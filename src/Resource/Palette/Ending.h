@@ -0,0 +1,2 @@
+14,128,0,0,8,34,10,68,12,102,14,136,14,238,10,170,8,136,4,68,8,174,4,106,0,14,0,8,0,4,0,238,14,128,0,0,6,8,8,42,10,76,12,110,14,238,10,174,6,108,2,42,8,234,4,106,0,238,0,136,0,68,0,14,
+14,128,0,2,14,238,0,38,0,72,0,108,0,142,0,206,10,134,14,134,14,168,14,202,0,64,0,96,0,164,0,232,12,130,10,2,12,66,14,134,14,202,14,236,14,238,14,172,14,138,14,104,0,232,0,164,0,2,0,38,0,108,0,206
@@ -0,0 +1,2 @@
+8,0,0,0,2,66,4,100,6,134,8,200,14,238,10,170,8,136,4,68,8,234,4,106,0,238,0,136,0,68,0,14,14,128,0,2,14,238,0,38,0,72,0,108,0,142,0,206,10,134,14,134,14,168,14,202,0,64,0,96,0,164,0,232,
+12,130,10,2,12,66,14,134,14,202,14,236,14,238,14,172,14,138,14,104,0,232,0,164,0,2,0,38,0,108,0,206
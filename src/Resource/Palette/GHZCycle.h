@@ -0,0 +1 @@
+10,134,14,134,14,168,14,202,14,202,10,134,14,134,14,168,14,168,14,202,10,134,14,134,14,134,14,168,14,202,10,134
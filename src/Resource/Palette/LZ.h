@@ -0,0 +1,2 @@
+8,0,0,0,6,38,10,42,12,76,14,142,14,238,10,170,8,136,4,68,8,224,2,96,0,238,0,136,0,68,0,14,0,0,0,38,0,72,0,106,2,140,4,206,6,238,0,0,4,134,0,128,0,64,6,128,12,230,10,196,8,162,14,238,
+0,0,0,0,0,2,0,36,0,70,8,34,10,102,14,170,4,40,6,74,10,142,10,170,6,102,2,34,0,104,14,238
@@ -0,0 +1,2 @@
+0,0,0,0,2,32,4,66,6,98,8,132,14,238,10,170,8,136,4,68,6,170,2,102,0,72,0,36,0,2,0,238,8,0,0,0,2,38,2,42,4,76,8,142,14,238,10,170,8,136,4,68,6,192,2,64,0,234,0,132,0,64,0,14,
+0,0,0,0,0,32,0,66,0,100,2,134,4,168,0,0,2,100,0,64,0,32,6,128,12,230,10,196,8,162,14,238,0,0,0,0,0,0,0,32,2,66,2,64,4,98,6,132,2,36,4,70,6,104,0,38,0,72,0,106,4,100,8,136
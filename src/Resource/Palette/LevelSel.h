@@ -0,0 +1,2 @@
+0,0,0,0,0,2,0,2,2,36,2,36,4,70,4,70,2,36,2,36,4,70,6,104,2,36,0,2,0,0,0,0,0,0,0,0,0,2,2,36,2,36,4,70,6,104,2,36,4,70,2,36,0,2,2,36,4,70,2,36,0,0,2,36,
+0,0,0,238,0,0,0,0,0,0,0,0,0,238,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,236,0,0,0,0,0,0,0,0,14,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
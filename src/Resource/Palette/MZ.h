@@ -0,0 +1,2 @@
+8,0,0,0,6,38,10,42,12,76,14,142,14,238,10,170,8,136,4,68,8,234,4,106,0,238,0,136,0,68,0,14,10,0,2,2,14,238,6,36,8,70,10,104,12,138,14,172,0,64,6,134,8,168,10,202,4,100,0,98,0,164,0,232,
+10,0,4,2,14,238,0,4,0,8,0,14,0,142,0,238,8,32,10,96,12,128,14,160,0,164,0,232,14,192,6,36
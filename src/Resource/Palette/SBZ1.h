@@ -0,0 +1,2 @@
+8,0,0,0,6,38,10,42,12,76,14,142,14,238,10,170,8,136,4,68,8,224,2,96,0,238,0,136,0,68,0,14,0,70,0,0,14,238,2,32,4,66,6,100,8,134,12,202,0,68,0,238,0,14,0,10,12,170,8,102,4,34,0,6,
+0,70,0,0,14,238,0,2,0,36,0,104,2,138,0,10,0,14,12,230,0,138,0,206,14,174,14,78,8,8,14,160
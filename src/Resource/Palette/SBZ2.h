@@ -0,0 +1,2 @@
+8,0,0,0,6,38,10,42,12,76,14,142,14,238,10,170,8,136,4,68,8,224,2,96,0,238,0,136,0,68,0,14,0,70,0,0,14,238,2,32,4,66,6,100,8,134,12,202,0,68,0,238,0,14,0,10,12,170,8,102,4,34,0,6,
+0,70,0,0,8,168,0,0,0,0,0,32,2,66,4,100,14,160,0,72,0,10,0,6,14,174,14,78,8,8,0,2
@@ -0,0 +1,2 @@
+8,0,0,0,6,38,10,42,12,76,14,142,14,238,10,170,8,136,4,68,8,224,2,96,0,238,0,136,0,68,0,14,0,0,4,68,6,102,8,136,10,170,12,204,14,238,0,0,12,140,10,106,8,72,14,206,14,140,10,72,8,38,14,238,
+0,0,0,0,0,32,2,64,4,98,8,130,12,198,14,234,2,130,4,164,8,232,10,170,6,102,2,34,6,132,14,238
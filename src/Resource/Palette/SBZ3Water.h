@@ -0,0 +1,2 @@
+0,0,0,0,10,38,12,72,14,106,14,140,14,206,12,172,8,104,6,70,12,174,8,108,6,12,4,38,0,4,0,238,8,0,0,0,2,38,2,42,4,76,8,142,14,238,10,170,8,136,4,68,6,192,2,64,0,234,0,132,0,64,0,14,
+0,0,2,2,4,4,6,38,8,72,10,106,12,140,0,0,8,72,6,38,4,4,14,206,14,140,10,72,8,38,14,238,0,0,0,0,0,0,2,0,4,2,6,68,8,102,10,136,2,100,4,134,6,168,0,38,0,72,0,106,6,4,10,170
@@ -0,0 +1,2 @@
+8,0,0,0,2,96,6,160,8,192,10,224,14,238,10,170,8,136,4,68,8,234,4,106,0,238,0,136,0,68,0,14,0,0,2,34,4,68,6,102,8,136,10,170,12,204,6,168,4,134,2,100,0,66,14,224,0,32,0,14,0,238,14,238,
+0,0,0,2,2,36,4,70,0,0,0,0,0,34,6,2,4,0,10,34,10,68,10,102,0,0,0,36,0,68,0,0
@@ -0,0 +1,2 @@
+14,238,14,170,14,170,0,238,0,238,0,238,8,160,10,192,12,224,14,170,0,36,0,104,0,172,2,238,14,238,4,192,14,238,0,0,8,34,10,68,12,102,14,136,14,238,10,170,8,136,4,68,8,174,4,106,0,14,0,8,0,4,0,0,
+14,238,0,0,2,4,6,40,10,76,12,110,14,206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,238,0,0,0,96,0,160,0,198,0,234,10,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
@@ -0,0 +1,2 @@
+8,0,0,0,6,38,10,42,12,76,14,142,14,238,10,170,8,136,4,68,8,234,4,106,0,238,0,136,0,68,0,14,6,38,0,0,14,238,8,174,4,140,2,74,0,40,0,6,0,4,6,198,2,130,0,64,10,200,6,132,2,64,0,0,
+6,38,0,0,6,72,6,108,8,174,10,238,14,238,0,238,0,170,0,102,0,34,0,14,4,4,14,238,14,72,2,2
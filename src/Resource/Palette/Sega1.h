@@ -0,0 +1 @@
+14,238,14,234,14,228,14,192,14,228,14,234
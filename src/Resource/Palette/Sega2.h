@@ -0,0 +1 @@
+14,236,14,234,14,234,14,234,14,234,14,234,14,236,14,234,14,228,14,192,14,192,14,192,14,236,14,234,14,228,14,192,14,160,14,96,14,234,14,228,14,192,14,160,14,128,14,0
@@ -0,0 +1,2 @@
+14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,
+14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238,14,238
@@ -0,0 +1 @@
+0,0,0,0,8,34,10,68,12,102,14,136,14,238,10,170,8,136,4,68,8,174,4,106,0,14,0,8,0,4,0,238
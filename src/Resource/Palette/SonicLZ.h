@@ -0,0 +1 @@
+0,0,0,0,2,32,4,66,6,98,8,132,14,238,10,170,8,136,4,68,6,170,2,102,0,72,0,36,0,2,0,238
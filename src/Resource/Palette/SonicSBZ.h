@@ -0,0 +1 @@
+0,0,0,0,10,38,12,72,14,106,14,140,14,206,12,172,8,104,6,70,12,174,8,108,6,12,4,38,0,4,0,238
@@ -0,0 +1,2 @@
+4,0,0,0,8,34,10,68,12,102,14,136,14,238,10,170,8,136,4,68,8,174,4,106,0,14,0,8,0,4,0,238,4,0,0,0,0,36,0,104,0,172,2,238,14,238,10,170,8,136,4,68,10,228,6,162,0,238,0,136,0,68,0,0,
+4,0,0,0,2,4,6,40,10,76,12,110,14,206,8,0,12,66,14,134,14,202,14,236,0,0,14,224,10,160,4,64,4,0,0,0,0,96,0,160,0,198,0,234,10,236,14,234,14,224,10,160,8,128,6,96,4,64,14,224,10,160,4,64
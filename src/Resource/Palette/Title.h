@@ -0,0 +1,2 @@
+10,32,6,0,12,0,14,68,14,102,14,136,14,238,0,174,0,106,0,38,0,238,14,170,0,12,0,6,0,2,0,0,0,0,12,0,14,34,14,68,14,102,14,136,14,238,10,170,8,136,6,102,4,68,2,72,8,174,6,140,0,0,0,14,
+8,0,0,2,14,238,0,38,0,72,0,108,0,142,0,206,12,66,14,134,14,202,14,236,0,64,0,96,0,164,0,232,12,130,10,2,12,66,14,134,14,202,14,236,14,238,14,172,14,138,14,104,0,232,0,164,0,2,0,38,0,108,0,206
@@ -0,0 +1 @@
+12,66,14,134,14,202,14,236,14,236,12,66,14,134,14,202,14,202,14,236,12,66,14,134,14,134,14,202,14,236,12,66
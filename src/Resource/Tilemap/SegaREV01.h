@@ -0,0 +1,42 @@
+32,1,32,2,32,3,32,4,32,5,32,6,32,7,32,8,64,1,64,2,64,3,64,4,64,5,64,6,64,7,64,8,96,9,96,10,96,11,96,12,96,13,96,14,96,15,96,16,32,1,32,2,32,3,32,4,32,5,32,6,32,7,32,8,
+64,1,64,2,64,3,64,4,64,5,64,6,64,7,64,8,96,9,96,10,96,11,96,12,96,13,96,14,96,15,96,16,32,1,32,2,32,3,32,4,32,5,32,6,32,7,32,8,64,1,64,2,64,3,64,4,64,5,64,6,64,7,64,8,
+96,9,96,10,96,11,96,12,96,13,96,14,96,15,96,16,32,1,32,2,32,3,32,4,32,5,32,6,32,7,32,8,64,1,64,2,64,3,64,4,64,5,64,6,64,7,64,8,96,9,96,10,96,11,96,12,96,13,96,14,96,15,96,16,
+32,1,32,2,32,3,32,4,32,5,32,6,32,7,32,8,64,1,64,2,64,3,64,4,64,5,64,6,64,7,64,8,96,9,96,10,96,11,96,12,96,13,96,14,96,15,96,16,32,1,32,2,32,3,32,4,32,5,32,6,32,7,32,8,
+64,1,64,2,64,3,64,4,64,5,64,6,64,7,64,8,96,9,96,10,96,11,96,12,96,13,96,14,96,15,96,16,32,1,32,2,32,3,32,4,32,5,32,6,32,7,32,8,64,1,64,2,64,3,64,4,64,5,64,6,64,7,64,8,
+96,9,96,10,96,11,96,12,96,13,96,14,96,15,96,16,32,1,32,2,32,3,32,4,32,5,32,6,32,17,32,8,64,1,64,2,64,3,64,4,64,5,64,6,64,7,64,18,96,9,96,10,96,11,96,12,96,13,96,14,96,15,96,16,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,20,0,21,0,22,0,23,0,23,0,24,0,25,0,23,
+0,23,0,23,0,26,0,27,0,28,0,23,0,23,0,23,0,29,0,19,0,30,0,31,0,32,0,33,0,34,0,35,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,36,0,37,0,38,0,39,0,39,0,40,0,41,0,42,0,39,0,39,0,43,0,44,0,45,0,39,0,39,0,39,0,46,0,47,0,48,0,49,0,50,0,51,0,52,0,53,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,54,0,55,0,56,0,57,16,23,0,58,0,59,0,60,0,61,0,61,0,62,0,0,0,63,0,64,0,61,0,61,0,65,0,66,0,0,0,67,0,68,0,69,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,70,0,71,0,72,0,73,0,74,0,58,0,59,0,75,0,75,0,75,0,76,0,0,8,59,0,77,0,75,0,78,
+0,79,0,80,0,81,0,82,0,83,0,84,0,85,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,86,0,87,0,88,0,89,0,90,0,91,0,59,16,75,
+16,75,16,75,16,76,0,0,8,59,16,77,16,75,8,59,0,92,0,93,0,94,0,95,0,96,0,97,0,98,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,99,0,23,0,100,0,101,0,102,0,103,0,59,16,60,16,61,16,61,16,62,0,0,16,63,16,64,0,0,8,59,0,104,0,0,0,105,0,106,0,107,0,68,0,69,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,108,0,39,0,109,0,110,0,111,0,112,16,41,16,42,0,39,0,39,0,43,16,44,16,45,0,39,0,39,0,113,0,114,0,81,0,115,0,39,0,39,0,116,0,84,0,85,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,16,99,16,23,0,117,0,118,0,119,16,24,16,25,16,23,16,23,16,23,16,26,16,27,16,28,16,23,16,23,16,23,
+16,23,0,120,0,121,16,23,16,23,16,23,16,23,0,122,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,0,19,
+0,123,0,19,0,19,0,124,0,19,0,19
@@ -0,0 +1,24 @@
+2,1,2,2,2,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,4,2,5,2,6,2,7,2,7,10,6,10,5,10,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,10,2,10,1,
+0,0,0,0,2,8,2,9,2,10,2,11,2,2,2,3,0,0,0,0,0,0,0,0,2,12,2,13,2,14,2,15,2,16,2,17,2,17,10,16,10,15,10,14,10,13,10,12,0,0,0,0,0,0,0,0,10,3,10,2,10,11,10,10,
+10,9,10,8,0,0,0,0,2,18,2,19,2,20,2,21,2,21,2,22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,32,10,31,2,30,10,29,10,28,10,27,10,26,10,25,10,24,10,23,10,22,2,21,
+2,21,10,20,10,19,10,18,0,0,0,0,0,0,2,33,2,34,2,35,2,21,2,21,2,21,2,21,2,21,2,36,2,37,2,38,2,39,2,40,2,41,2,42,10,42,10,41,10,40,10,39,10,38,10,37,10,36,2,21,2,21,2,21,
+2,21,2,21,10,35,10,34,10,33,0,0,0,0,0,0,0,0,0,0,2,43,2,44,2,45,2,46,2,21,2,21,2,47,2,48,2,49,2,50,2,51,2,52,2,53,2,53,2,53,2,53,10,52,10,51,10,50,10,49,10,48,10,47,
+2,21,2,21,10,46,10,45,10,44,10,43,0,0,0,0,0,0,0,0,0,0,0,0,2,54,2,55,2,56,2,57,2,21,2,21,2,58,2,59,2,60,2,61,2,53,2,53,2,53,2,53,2,53,2,53,2,53,2,53,10,61,10,60,
+10,59,10,58,2,21,2,21,10,57,10,56,10,55,10,54,0,0,0,0,0,0,0,0,0,0,0,0,2,33,2,62,2,20,2,21,2,21,2,63,2,64,2,30,2,65,2,66,2,53,2,53,2,53,2,53,2,53,2,53,2,53,2,53,
+10,66,10,65,2,30,10,64,10,63,2,21,2,21,10,20,10,62,10,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,67,2,68,2,35,2,21,2,69,2,70,2,71,2,72,2,53,2,53,2,53,2,53,2,53,2,53,2,53,
+2,53,2,53,2,53,10,72,10,71,10,70,10,69,2,21,10,35,10,68,10,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,73,2,74,2,75,2,76,2,77,2,78,2,79,2,53,2,53,2,53,2,53,2,53,
+2,53,2,53,2,53,2,53,2,53,10,79,10,78,10,77,10,76,10,75,10,74,10,73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,80,2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,89,
+2,90,2,91,2,92,2,93,2,94,2,95,2,96,2,97,2,98,2,99,2,100,10,82,10,81,10,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,101,2,102,2,103,2,104,2,105,2,106,2,107,
+2,108,2,109,2,110,2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,10,102,10,101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,121,2,122,2,123,2,124,
+2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,134,2,135,2,136,2,137,2,138,2,139,10,121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,140,2,141,
+2,142,2,143,2,144,2,145,2,146,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,10,140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,159,2,160,2,161,
+2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,10,162,10,161,10,160,10,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,181,2,182,
+2,183,2,184,2,185,2,186,2,187,2,188,2,189,2,190,2,191,2,192,2,193,2,194,2,195,2,196,2,197,2,198,2,199,10,189,2,188,2,187,10,186,10,185,10,184,10,183,10,182,10,181,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,2,200,2,21,2,201,2,202,2,203,2,0,2,0,2,0,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,10,205,10,204,2,0,2,0,2,0,10,203,10,202,10,201,2,21,10,200,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,212,2,213,2,214,2,215,2,216,2,217,2,0,2,0,2,0,2,0,2,218,2,219,2,220,2,221,2,222,2,223,2,224,10,218,2,0,2,0,2,0,2,0,10,217,10,216,10,215,10,214,10,213,10,212,0,0,0,0,
+0,0,0,0,0,0,0,0,2,225,2,177,2,226,2,227,2,228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,228,10,227,10,226,2,177,10,225,
+0,0,0,0,0,0,0,0,0,0,0,0,2,229,2,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+10,230,10,229,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,231,2,232,2,233,2,234,2,235,2,236,2,237,2,238,2,239
@@ -69,15 +69,5 @@ void ClearScreen()
 
 void CopyTilemap(const uint8_t *tilemap, size_t offset, size_t width, size_t height)
 {
-	while (height-- > 0)
-	{
-		VDP_SeekVRAM(offset);
-		for (size_t x = 0; x < width; x++)
-		{
-			uint16_t v = (tilemap[0] << 8) | (tilemap[1] << 0);
-			tilemap += 2;
-			VDP_WriteVRAM((const uint8_t*)&v, 2);
-		}
-		offset += PLANE_WIDTH * 2;
-	}
+	VDP_WriteVRAMRect(offset, PLANE_WIDTH * 2, tilemap, width, height, 0);
 }